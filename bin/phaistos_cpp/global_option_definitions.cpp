@@ -49,7 +49,14 @@ struct EnergyOptions {
                          DefineEnergyCommonOptions(),
                          "CHARMM36/EEF1-SB angle bend term (" + prefix + ")",
                          prefix+"-charmm-angle-bend", settings,
-                         make_vector()),
+                         make_vector(
+                             make_vector(std::string("threads"),
+                                         std::string("Number of threads used in evaluation (0: all available). Results do not depend on the number of threads."),
+                                          &settings->threads),
+                             make_vector(std::string("topology-image-dir"),
+                                         std::string("Directory of binary topology images. The interaction lists are read from an image if there is one for the chain, and otherwise generated and written to the directory (empty: always generate)."),
+                                          &settings->topology_image_dir)
+                        )),
                     super_group, counter==1);
           }
 
@@ -121,7 +128,26 @@ struct EnergyOptions {
                          DefineEnergyCommonOptions(),
                          "CHARMM36/EEF1-SB Coulomb term (" + prefix + ")",
                          prefix+"-charmm-coulomb", settings,
-                         make_vector()),
+                         make_vector(
+                             make_vector(std::string("spatial-reorder-interval"),
+                                         std::string("Number of evaluations between reorderings of the coordinate buffer along a Morton curve (0: never)."),
+                                          &settings->spatial_reorder_interval),
+                             make_vector(std::string("ctonnb"),
+                                         std::string("Distance where switching of van der Waals and Coulomb energies to zero starts (Angstrom, CHARMM ctonnb)."),
+                                          &settings->ctonnb),
+                             make_vector(std::string("ctofnb"),
+                                         std::string("Distance beyond which atom pairs do not contribute (Angstrom, CHARMM ctofnb, 0: no cutoff)."),
+                                          &settings->ctofnb),
+                             make_vector(std::string("cutnb"),
+                                         std::string("Distance within which atom pairs are kept in the pair list (Angstrom, CHARMM cutnb, 0: ctofnb + 2)."),
+                                          &settings->cutnb),
+                             make_vector(std::string("threads"),
+                                         std::string("Number of threads used in evaluation (0: all available). Results do not depend on the number of threads."),
+                                          &settings->threads),
+                             make_vector(std::string("topology-image-dir"),
+                                         std::string("Directory of binary topology images (only used without cutoff). The interaction lists are read from an image if there is one for the chain, and otherwise generated and written to the directory (empty: always generate)."),
+                                          &settings->topology_image_dir)
+                        )),
                     super_group, counter==1);
           }
 
@@ -145,7 +171,11 @@ struct EnergyOptions {
                          DefineEnergyCommonOptions(),
                          "CHARMM36/EEF1-SB implicit solvation term (" + prefix + ")",
                          prefix+"-charmm-implicit-solvent", settings,
-                         make_vector()),
+                         make_vector(
+                             make_vector(std::string("threads"),
+                                         std::string("Number of threads used in evaluation (0: all available). Results do not depend on the number of threads."),
+                                          &settings->threads)
+                        )),
                     super_group, counter==1);
           }
 
@@ -169,7 +199,17 @@ struct EnergyOptions {
                          DefineEnergyCommonOptions(),
                          "CHARMM36/EEF1-SB torsion angle term (" + prefix + ")",
                          prefix+"-charmm-torsion", settings,
-                         make_vector()),
+                         make_vector(
+                             make_vector(std::string("threads"),
+                                         std::string("Number of threads used in evaluation (0: all available). Results do not depend on the number of threads."),
+                                          &settings->threads),
+                             make_vector(std::string("read-degrees-of-freedom"),
+                                         std::string("Read torsions around the phi, psi, omega and chi bonds from the internal coordinates of the chain in moves that leave the bond lengths and bond angles unchanged."),
+                                          &settings->read_degrees_of_freedom),
+                             make_vector(std::string("topology-image-dir"),
+                                         std::string("Directory of binary topology images. The interaction lists are read from an image if there is one for the chain, and otherwise generated and written to the directory (empty: always generate)."),
+                                          &settings->topology_image_dir)
+                        )),
                          super_group, counter==1);
           }
 
@@ -217,7 +257,26 @@ struct EnergyOptions {
                          DefineEnergyCommonOptions(),
                          "CHARMM36/EEF1-SB van der Waals term (" + prefix + ")",
                          prefix+"-charmm-vdw", settings,
-                         make_vector()),
+                         make_vector(
+                             make_vector(std::string("spatial-reorder-interval"),
+                                         std::string("Number of evaluations between reorderings of the coordinate buffer along a Morton curve (0: never)."),
+                                          &settings->spatial_reorder_interval),
+                             make_vector(std::string("ctonnb"),
+                                         std::string("Distance where switching of van der Waals and Coulomb energies to zero starts (Angstrom, CHARMM ctonnb)."),
+                                          &settings->ctonnb),
+                             make_vector(std::string("ctofnb"),
+                                         std::string("Distance beyond which atom pairs do not contribute (Angstrom, CHARMM ctofnb, 0: no cutoff)."),
+                                          &settings->ctofnb),
+                             make_vector(std::string("cutnb"),
+                                         std::string("Distance within which atom pairs are kept in the pair list (Angstrom, CHARMM cutnb, 0: ctofnb + 2)."),
+                                          &settings->cutnb),
+                             make_vector(std::string("threads"),
+                                         std::string("Number of threads used in evaluation (0: all available). Results do not depend on the number of threads."),
+                                          &settings->threads),
+                             make_vector(std::string("topology-image-dir"),
+                                         std::string("Directory of binary topology images (only used without cutoff). The interaction lists are read from an image if there is one for the chain, and otherwise generated and written to the directory (empty: always generate)."),
+                                          &settings->topology_image_dir)
+                        )),
                     super_group, counter==1);
           }
 
@@ -241,7 +300,32 @@ struct EnergyOptions {
                          DefineEnergyCommonOptions(),
                          "CHARMM36/EEF1-SB van der Waals, Coulomb and implicit solvent terms (" + prefix + ")",
                          prefix+"-charmm-non-bonded", settings,
-                         make_vector()),
+                         make_vector(
+                             make_vector(std::string("far-field-cutoff"),
+                                         std::string("Residue pairs with centroids further apart than this distance are approximated from residue charges, dipoles and summed van der Waals parameters (Angstrom, 0: disabled)."),
+                                          &settings->far_field_cutoff),
+                             make_vector(std::string("far-field-tolerance"),
+                                         std::string("Largest error bound allowed for an approximated residue pair (kcal/mol). Pairs with a larger bound are evaluated exactly."),
+                                          &settings->far_field_tolerance),
+                             make_vector(std::string("spatial-reorder-interval"),
+                                         std::string("Number of evaluations between reorderings of the coordinate buffer along a Morton curve (0: never)."),
+                                          &settings->spatial_reorder_interval),
+                             make_vector(std::string("ctonnb"),
+                                         std::string("Distance where switching of van der Waals and Coulomb energies to zero starts (Angstrom, CHARMM ctonnb)."),
+                                          &settings->ctonnb),
+                             make_vector(std::string("ctofnb"),
+                                         std::string("Distance beyond which atom pairs do not contribute (Angstrom, CHARMM ctofnb, 0: no cutoff)."),
+                                          &settings->ctofnb),
+                             make_vector(std::string("cutnb"),
+                                         std::string("Distance within which atom pairs are kept in the pair list (Angstrom, CHARMM cutnb, 0: ctofnb + 2)."),
+                                          &settings->cutnb),
+                             make_vector(std::string("threads"),
+                                         std::string("Number of threads used in evaluation (0: all available). Results do not depend on the number of threads."),
+                                          &settings->threads),
+                             make_vector(std::string("topology-image-dir"),
+                                         std::string("Directory of binary topology images (only used without cutoff). The interaction lists are read from an image if there is one for the chain, and otherwise generated and written to the directory (empty: always generate)."),
+                                          &settings->topology_image_dir)
+                        )),
                     super_group, counter==1);
           }
 
@@ -280,7 +364,19 @@ struct EnergyOptions {
                                           &settings->ignore_improper_torsion_angles),
                              make_vector(std::string("ignore-cmap-correction"),
                                          std::string("Ignore CMAP correction terms."),
-                                          &settings->ignore_cmap_correction)
+                                          &settings->ignore_cmap_correction),
+                             make_vector(std::string("print-cache-statistics"),
+                                         std::string("Print cache statistics (residues and interactions recomputed per move, none-moves, accepts and rejects) on exit."),
+                                          &settings->print_cache_statistics),
+                             make_vector(std::string("skip-invariant-terms"),
+                                         std::string("Keep bond stretch, angle bend and Urey-Bradley energies from the cache if the bond geometry of the moved residues is unchanged, and backbone dihedral energies if no backbone atom has moved."),
+                                          &settings->skip_invariant_terms),
+                             make_vector(std::string("threads"),
+                                         std::string("Number of threads used to generate the interactions (0: all available). Results do not depend on the number of threads."),
+                                          &settings->threads),
+                             make_vector(std::string("topology-image-dir"),
+                                         std::string("Directory of binary topology images. The interaction lists are read from an image if there is one for the chain, and otherwise generated and written to the directory (empty: always generate)."),
+                                          &settings->topology_image_dir)
                         )),
                     super_group, counter==1);
           }
@@ -305,7 +401,35 @@ struct EnergyOptions {
                          DefineEnergyCommonOptions(),
                          "Cached CHARMM36/EEF1-SB van der Waals, Coulomb and implicit solvent terms (" + prefix + ")",
                          prefix+"-charmm-non-bonded-cached", settings,
-                         make_vector()),
+                         make_vector(
+                             make_vector(std::string("block-size"),
+                                         std::string("Number of residues per block in the block level of the cache (0: sqrt of chain length)."),
+                                          &settings->block_size),
+                             make_vector(std::string("print-cache-statistics"),
+                                         std::string("Print cache statistics (residue and atom pairs recomputed per move, none-moves, accepts, rejects and full resums) on exit."),
+                                          &settings->print_cache_statistics),
+                             make_vector(std::string("far-field-cutoff"),
+                                         std::string("Residue pairs with centroids further apart than this distance are approximated from residue charges, dipoles and summed van der Waals parameters (Angstrom, 0: disabled)."),
+                                          &settings->far_field_cutoff),
+                             make_vector(std::string("far-field-tolerance"),
+                                         std::string("Largest error bound allowed for an approximated residue pair (kcal/mol). Pairs with a larger bound are evaluated exactly."),
+                                          &settings->far_field_tolerance),
+                             make_vector(std::string("ctonnb"),
+                                         std::string("Distance where switching of van der Waals and Coulomb energies to zero starts (Angstrom, CHARMM ctonnb)."),
+                                          &settings->ctonnb),
+                             make_vector(std::string("ctofnb"),
+                                         std::string("Distance beyond which atom pairs do not contribute (Angstrom, CHARMM ctofnb, 0: no cutoff)."),
+                                          &settings->ctofnb),
+                             make_vector(std::string("cutnb"),
+                                         std::string("Distance within which atom pairs are kept in the Verlet lists (Angstrom, CHARMM cutnb, 0: ctofnb + 2)."),
+                                          &settings->cutnb),
+                             make_vector(std::string("threads"),
+                                         std::string("Number of threads used to generate the interactions (0: all available). Results do not depend on the number of threads."),
+                                          &settings->threads),
+                             make_vector(std::string("topology-image-dir"),
+                                         std::string("Directory of binary topology images. The interaction lists are read from an image if there is one for the chain, and otherwise generated and written to the directory (empty: always generate)."),
+                                          &settings->topology_image_dir)
+                        )),
                     super_group, counter==1);
           }
 
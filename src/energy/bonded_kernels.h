@@ -0,0 +1,1006 @@
+// bonded_kernels.h -- Block kernels for the CHARMM bonded terms
+// Copyright (C) 2026 agent
+//
+// This file is part of Phaistos
+//
+// Phaistos is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Phaistos is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Phaistos.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+#ifndef CHARMM_BONDED_KERNELS_H
+#define CHARMM_BONDED_KERNELS_H
+
+#include <vector>
+#include <map>
+#include <set>
+#include <functional>
+#include <iostream>
+#include <cstdlib>
+#include <cmath>
+#include <algorithm>
+
+#include "parsers/topology_parser.h"
+#include "constants.h"
+
+// Interactions are stored as structure-of-arrays lists. The kernels process
+// them in blocks of BLOCK_SIZE: atom positions are first gathered into
+// contiguous x, y, z arrays, after which the geometry, the trigonometric
+// functions and the energies are computed in separate loops over plain arrays
+// without branches or calls other than sqrt and atan2. These loops are
+// vectorized by the compiler (with OpenMP SIMD support and a vector math
+// library also the atan2 loops).
+namespace charmm_bonded {
+
+//! Number of interactions processed together in a kernel call
+const unsigned int BLOCK_SIZE = 64;
+
+
+//! Positions of a block of atoms in structure-of-arrays layout
+struct PositionBlock {
+
+     //! x coordinates
+     double x[BLOCK_SIZE];
+
+     //! y coordinates
+     double y[BLOCK_SIZE];
+
+     //! z coordinates
+     double z[BLOCK_SIZE];
+
+     //! Copy the positions of a range of atoms into the block
+     //! \param atoms List of atoms
+     //! \param begin Index of first atom
+     //! \param n Number of atoms (at most BLOCK_SIZE)
+     void gather(const std::vector<phaistos::Atom *> &atoms, const unsigned int begin, const unsigned int n) {
+
+          for (unsigned int i = 0; i < n; i++) {
+               const phaistos::Vector_3D &position = atoms[begin + i]->position;
+               this->x[i] = position[0];
+               this->y[i] = position[1];
+               this->z[i] = position[2];
+          }
+     }
+};
+
+
+//! Difference vectors b = p2 - p1 of a block
+//! \param p1 First positions
+//! \param p2 Second positions
+//! \param n Number of positions
+//! \param b Difference vectors (output)
+inline void subtract(const PositionBlock &p1, const PositionBlock &p2, const unsigned int n, PositionBlock &b) {
+
+#pragma omp simd
+     for (unsigned int i = 0; i < n; i++) {
+          b.x[i] = p2.x[i] - p1.x[i];
+          b.y[i] = p2.y[i] - p1.y[i];
+          b.z[i] = p2.z[i] - p1.z[i];
+     }
+}
+
+//! Lengths of a block of vectors
+//! \param b Vectors
+//! \param n Number of vectors
+//! \param length Lengths (output)
+inline void norms(const PositionBlock &b, const unsigned int n, double *length) {
+
+#pragma omp simd
+     for (unsigned int i = 0; i < n; i++) {
+          length[i] = std::sqrt(b.x[i] * b.x[i] + b.y[i] * b.y[i] + b.z[i] * b.z[i]);
+     }
+}
+
+//! Angles at atom 2 of a block of atom triplets. The angle is computed as
+//! atan2(|u x v|, u.v), which is accurate also close to 0 and 180 degrees.
+//! \param atom1 First atoms
+//! \param atom2 Second (central) atoms
+//! \param atom3 Third atoms
+//! \param begin Index of first triplet
+//! \param n Number of triplets (at most BLOCK_SIZE)
+//! \param theta Angles in radians (output)
+//! \param r13 Distances between first and third atom in Angstrom (output)
+inline void angles(const std::vector<phaistos::Atom *> &atom1,
+                   const std::vector<phaistos::Atom *> &atom2,
+                   const std::vector<phaistos::Atom *> &atom3,
+                   const unsigned int begin, const unsigned int n,
+                   double *theta, double *r13) {
+
+     PositionBlock p1, p2, p3;
+     p1.gather(atom1, begin, n);
+     p2.gather(atom2, begin, n);
+     p3.gather(atom3, begin, n);
+
+     PositionBlock u, v, w;
+     subtract(p2, p1, n, u);
+     subtract(p2, p3, n, v);
+     subtract(p3, p1, n, w);
+
+     norms(w, n, r13);
+
+     double sin_term[BLOCK_SIZE];
+     double cos_term[BLOCK_SIZE];
+
+#pragma omp simd
+     for (unsigned int i = 0; i < n; i++) {
+          const double cx = u.y[i] * v.z[i] - u.z[i] * v.y[i];
+          const double cy = u.z[i] * v.x[i] - u.x[i] * v.z[i];
+          const double cz = u.x[i] * v.y[i] - u.y[i] * v.x[i];
+          sin_term[i] = std::sqrt(cx * cx + cy * cy + cz * cz);
+          cos_term[i] = u.x[i] * v.x[i] + u.y[i] * v.y[i] + u.z[i] * v.z[i];
+     }
+
+#pragma omp simd
+     for (unsigned int i = 0; i < n; i++) {
+          theta[i] = std::atan2(sin_term[i], cos_term[i]);
+     }
+}
+
+//! Unnormalized sine and cosine of the dihedral angles of a block of atom
+//! quadruplets. The dihedral angle is atan2(y, x), with the same convention
+//! as calc_dihedral (IUPAC sign, range -pi to pi).
+//! \param atom1 First atoms
+//! \param atom2 Second atoms
+//! \param atom3 Third atoms
+//! \param atom4 Fourth atoms
+//! \param begin Index of first quadruplet
+//! \param n Number of quadruplets (at most BLOCK_SIZE)
+//! \param y Sine components (output)
+//! \param x Cosine components (output)
+inline void dihedral_components(const std::vector<phaistos::Atom *> &atom1,
+                                const std::vector<phaistos::Atom *> &atom2,
+                                const std::vector<phaistos::Atom *> &atom3,
+                                const std::vector<phaistos::Atom *> &atom4,
+                                const unsigned int begin, const unsigned int n,
+                                double *y, double *x) {
+
+     PositionBlock p1, p2, p3, p4;
+     p1.gather(atom1, begin, n);
+     p2.gather(atom2, begin, n);
+     p3.gather(atom3, begin, n);
+     p4.gather(atom4, begin, n);
+
+     PositionBlock b1, b2, b3;
+     subtract(p1, p2, n, b1);
+     subtract(p2, p3, n, b2);
+     subtract(p3, p4, n, b3);
+
+#pragma omp simd
+     for (unsigned int i = 0; i < n; i++) {
+
+          // n1 = b1 x b2
+          const double n1x = b1.y[i] * b2.z[i] - b1.z[i] * b2.y[i];
+          const double n1y = b1.z[i] * b2.x[i] - b1.x[i] * b2.z[i];
+          const double n1z = b1.x[i] * b2.y[i] - b1.y[i] * b2.x[i];
+
+          // n2 = b2 x b3
+          const double n2x = b2.y[i] * b3.z[i] - b2.z[i] * b3.y[i];
+          const double n2y = b2.z[i] * b3.x[i] - b2.x[i] * b3.z[i];
+          const double n2z = b2.x[i] * b3.y[i] - b2.y[i] * b3.x[i];
+
+          const double b2_norm = std::sqrt(b2.x[i] * b2.x[i] + b2.y[i] * b2.y[i] + b2.z[i] * b2.z[i]);
+
+          y[i] = b2_norm * (b1.x[i] * n2x + b1.y[i] * n2y + b1.z[i] * n2z);
+          x[i] = n1x * n2x + n1y * n2y + n1z * n2z;
+     }
+}
+
+//! Dihedral angles of a block of atom quadruplets
+//! \param atom1 First atoms
+//! \param atom2 Second atoms
+//! \param atom3 Third atoms
+//! \param atom4 Fourth atoms
+//! \param begin Index of first quadruplet
+//! \param n Number of quadruplets (at most BLOCK_SIZE)
+//! \param phi Dihedral angles in radians (output)
+inline void dihedrals(const std::vector<phaistos::Atom *> &atom1,
+                      const std::vector<phaistos::Atom *> &atom2,
+                      const std::vector<phaistos::Atom *> &atom3,
+                      const std::vector<phaistos::Atom *> &atom4,
+                      const unsigned int begin, const unsigned int n,
+                      double *phi) {
+
+     double y[BLOCK_SIZE];
+     double x[BLOCK_SIZE];
+     dihedral_components(atom1, atom2, atom3, atom4, begin, n, y, x);
+
+#pragma omp simd
+     for (unsigned int i = 0; i < n; i++) {
+          phi[i] = std::atan2(y[i], x[i]);
+     }
+}
+
+//! Cosine and sine of the dihedral angles of a block of atom quadruplets,
+//! computed without trigonometric functions. Degenerate (collinear)
+//! quadruplets get the angle 0, as with atan2(0, 0).
+//! \param atom1 First atoms
+//! \param atom2 Second atoms
+//! \param atom3 Third atoms
+//! \param atom4 Fourth atoms
+//! \param begin Index of first quadruplet
+//! \param n Number of quadruplets (at most BLOCK_SIZE)
+//! \param cos_phi Cosines of dihedral angles (output)
+//! \param sin_phi Sines of dihedral angles (output)
+inline void dihedral_cos_sin(const std::vector<phaistos::Atom *> &atom1,
+                             const std::vector<phaistos::Atom *> &atom2,
+                             const std::vector<phaistos::Atom *> &atom3,
+                             const std::vector<phaistos::Atom *> &atom4,
+                             const unsigned int begin, const unsigned int n,
+                             double *cos_phi, double *sin_phi) {
+
+     double y[BLOCK_SIZE];
+     double x[BLOCK_SIZE];
+     dihedral_components(atom1, atom2, atom3, atom4, begin, n, y, x);
+
+#pragma omp simd
+     for (unsigned int i = 0; i < n; i++) {
+          const double r = std::sqrt(x[i] * x[i] + y[i] * y[i]);
+          const double inv_r = (r > 0.0) ? 1.0 / r : 0.0;
+          cos_phi[i] = (r > 0.0) ? x[i] * inv_r : 1.0;
+          sin_phi[i] = y[i] * inv_r;
+     }
+}
+
+
+//! Bond stretch interactions in structure-of-arrays layout
+class BondList {
+public:
+
+     //! First atoms
+     std::vector<phaistos::Atom *> atom1;
+
+     //! Second atoms
+     std::vector<phaistos::Atom *> atom2;
+
+     //! Force constants in kJ/mol/nm^2
+     std::vector<double> kb;
+
+     //! Equilibrium distances in nm
+     std::vector<double> r0;
+
+     //! Number of interactions
+     unsigned int size() const {
+          return this->atom1.size();
+     }
+
+     //! Append an interaction
+     //! \param interaction Bond stretch interaction
+     void add(const topology::BondedPairInteraction &interaction) {
+          this->atom1.push_back(interaction.atom1);
+          this->atom2.push_back(interaction.atom2);
+          this->kb.push_back(interaction.kb);
+          this->r0.push_back(interaction.r0);
+     }
+
+     //! Bond lengths and energies of a block of interactions
+     //! \param begin Index of first interaction
+     //! \param n Number of interactions (at most BLOCK_SIZE)
+     //! \param r Bond lengths in nm (output)
+     //! \param energy Energies in kJ/mol (output)
+     void evaluate_block(const unsigned int begin, const unsigned int n, double *r, double *energy) const {
+
+          PositionBlock p1, p2, b;
+          p1.gather(this->atom1, begin, n);
+          p2.gather(this->atom2, begin, n);
+          subtract(p1, p2, n, b);
+          norms(b, n, r);
+
+          const double *kb = &this->kb[begin];
+          const double *r0 = &this->r0[begin];
+
+#pragma omp simd
+          for (unsigned int i = 0; i < n; i++) {
+               r[i] *= charmm_constants::ANGS_TO_NM;
+               const double dr = r[i] - r0[i];
+               energy[i] = 0.5 * kb[i] * dr * dr;
+          }
+     }
+
+     //! Add the energies of a range of interactions
+     //! \param begin Index of first interaction
+     //! \param end Index after last interaction
+     //! \param energies Sum of energies (index 0) in kJ/mol
+     void add_energies(const unsigned int begin, const unsigned int end, double *energies) const {
+
+          double r[BLOCK_SIZE];
+          double energy[BLOCK_SIZE];
+
+          for (unsigned int block = begin; block < end; block += BLOCK_SIZE) {
+
+               const unsigned int n = std::min(BLOCK_SIZE, end - block);
+               evaluate_block(block, n, r, energy);
+
+               for (unsigned int i = 0; i < n; i++) {
+                    energies[0] += energy[i];
+               }
+          }
+     }
+};
+
+
+//! Angle bend and Urey-Bradley interactions in structure-of-arrays layout
+class AngleList {
+public:
+
+     //! First atoms
+     std::vector<phaistos::Atom *> atom1;
+
+     //! Second (central) atoms
+     std::vector<phaistos::Atom *> atom2;
+
+     //! Third atoms
+     std::vector<phaistos::Atom *> atom3;
+
+     //! Equilibrium angles in radians
+     std::vector<double> theta0;
+
+     //! Angle force constants in kJ/mol/rad^2
+     std::vector<double> k0;
+
+     //! Urey-Bradley equilibrium distances in nm
+     std::vector<double> r13;
+
+     //! Urey-Bradley force constants in kJ/mol/nm^2
+     std::vector<double> kub;
+
+     //! Number of interactions
+     unsigned int size() const {
+          return this->atom1.size();
+     }
+
+     //! Append an interaction
+     //! \param interaction Angle bend interaction
+     void add(const topology::AngleBendInteraction &interaction) {
+          this->atom1.push_back(interaction.atom1);
+          this->atom2.push_back(interaction.atom2);
+          this->atom3.push_back(interaction.atom3);
+          this->theta0.push_back(interaction.theta0 * charmm_constants::DEG_TO_RAD);
+          this->k0.push_back(interaction.k0);
+          this->r13.push_back(interaction.r13);
+          this->kub.push_back(interaction.kub);
+     }
+
+     //! Angles, distances and energies of a block of interactions
+     //! \param begin Index of first interaction
+     //! \param n Number of interactions (at most BLOCK_SIZE)
+     //! \param theta Angles in radians (output)
+     //! \param r Distances between first and third atom in nm (output)
+     //! \param energy_angle_bend Angle bend energies in kJ/mol (output)
+     //! \param energy_urey_bradley Urey-Bradley energies in kJ/mol (output)
+     void evaluate_block(const unsigned int begin, const unsigned int n,
+                         double *theta, double *r,
+                         double *energy_angle_bend, double *energy_urey_bradley) const {
+
+          angles(this->atom1, this->atom2, this->atom3, begin, n, theta, r);
+
+          const double *theta0 = &this->theta0[begin];
+          const double *k0 = &this->k0[begin];
+          const double *r13 = &this->r13[begin];
+          const double *kub = &this->kub[begin];
+
+#pragma omp simd
+          for (unsigned int i = 0; i < n; i++) {
+               const double dtheta = theta[i] - theta0[i];
+               energy_angle_bend[i] = 0.5 * k0[i] * dtheta * dtheta;
+
+               r[i] *= charmm_constants::ANGS_TO_NM;
+               const double dr = r[i] - r13[i];
+               energy_urey_bradley[i] = 0.5 * kub[i] * dr * dr;
+          }
+     }
+
+     //! Add the energies of a range of interactions
+     //! \param begin Index of first interaction
+     //! \param end Index after last interaction
+     //! \param energies Sums of angle bend energies (index 0) and Urey-Bradley energies (index 1) in kJ/mol
+     void add_energies(const unsigned int begin, const unsigned int end, double *energies) const {
+
+          double theta[BLOCK_SIZE];
+          double r[BLOCK_SIZE];
+          double energy_angle_bend[BLOCK_SIZE];
+          double energy_urey_bradley[BLOCK_SIZE];
+
+          for (unsigned int block = begin; block < end; block += BLOCK_SIZE) {
+
+               const unsigned int n = std::min(BLOCK_SIZE, end - block);
+               evaluate_block(block, n, theta, r, energy_angle_bend, energy_urey_bradley);
+
+               for (unsigned int i = 0; i < n; i++) {
+                    energies[0] += energy_angle_bend[i];
+                    energies[1] += energy_urey_bradley[i];
+               }
+          }
+     }
+};
+
+
+//! Atom quadruplets of dihedral interactions in structure-of-arrays layout
+class DihedralList {
+public:
+
+     //! First atoms
+     std::vector<phaistos::Atom *> atom1;
+
+     //! Second atoms
+     std::vector<phaistos::Atom *> atom2;
+
+     //! Third atoms
+     std::vector<phaistos::Atom *> atom3;
+
+     //! Fourth atoms
+     std::vector<phaistos::Atom *> atom4;
+
+     //! Number of interactions
+     unsigned int size() const {
+          return this->atom1.size();
+     }
+
+     //! Dihedral angles of a block of interactions
+     //! \param begin Index of first interaction
+     //! \param n Number of interactions (at most BLOCK_SIZE)
+     //! \param phi Dihedral angles in radians (output)
+     void angles(const unsigned int begin, const unsigned int n, double *phi) const {
+          dihedrals(this->atom1, this->atom2, this->atom3, this->atom4, begin, n, phi);
+     }
+
+     //! Cosine and sine of the dihedral angles of a block of interactions
+     //! \param begin Index of first interaction
+     //! \param n Number of interactions (at most BLOCK_SIZE)
+     //! \param cos_phi Cosines of dihedral angles (output)
+     //! \param sin_phi Sines of dihedral angles (output)
+     void cos_sin(const unsigned int begin, const unsigned int n, double *cos_phi, double *sin_phi) const {
+          dihedral_cos_sin(this->atom1, this->atom2, this->atom3, this->atom4, begin, n, cos_phi, sin_phi);
+     }
+
+protected:
+
+     //! Append the atoms of an interaction
+     //! \param interaction Torsion or improper torsion interaction
+     template <typename INTERACTION>
+     void add_atoms(const INTERACTION &interaction) {
+          this->atom1.push_back(interaction.atom1);
+          this->atom2.push_back(interaction.atom2);
+          this->atom3.push_back(interaction.atom3);
+          this->atom4.push_back(interaction.atom4);
+     }
+};
+
+
+//! Cosine and sine of the torsional degrees of freedom (phi, psi, omega,
+//! chi1-4) of the residues of a chain, read from its internal coordinates.
+class DegreesOfFreedom {
+public:
+
+     //! Cosines, indexed by index()
+     std::vector<double> cos_value;
+
+     //! Sines, indexed by index()
+     std::vector<double> sin_value;
+
+     //! Whether each degree of freedom is used, indexed by index()
+     std::vector<bool> used;
+
+     //! Index of a degree of freedom in the table
+     //! \param residue_index Index of residue
+     //! \param dof_type Degree of freedom (topology::DOF_PHI, ...)
+     static unsigned int index(const int residue_index, const unsigned int dof_type) {
+          return residue_index * topology::N_DOF_TYPES + dof_type;
+     }
+
+     //! Make room for the degrees of freedom of a chain
+     //! \param n_residues Number of residues
+     void resize(const int n_residues) {
+          this->cos_value.resize(n_residues * topology::N_DOF_TYPES, 1.0);
+          this->sin_value.resize(n_residues * topology::N_DOF_TYPES, 0.0);
+          this->used.resize(n_residues * topology::N_DOF_TYPES, false);
+     }
+
+     //! Read the used degrees of freedom of a range of residues from the chain
+     //! \param chain Molecule chain
+     //! \param first_residue Index of first residue (clipped to the chain)
+     //! \param last_residue Index of last residue (clipped to the chain)
+     void update(phaistos::ChainFB *chain, const int first_residue, const int last_residue) {
+
+          const int begin = std::max(first_residue, 0);
+          const int end = std::min(last_residue, chain->size() - 1);
+
+          for (int r = begin; r <= end; r++) {
+
+               bool used_chi = false;
+               for (unsigned int dof_type = topology::DOF_CHI1; dof_type < topology::N_DOF_TYPES; dof_type++) {
+                    used_chi = used_chi || this->used[index(r, dof_type)];
+               }
+
+               std::vector<double> sidechain_dihedrals;
+               if (used_chi) {
+                    sidechain_dihedrals = (*chain)[r].get_sidechain_dihedrals();
+               }
+
+               for (unsigned int dof_type = 0; dof_type < topology::N_DOF_TYPES; dof_type++) {
+
+                    const unsigned int i = index(r, dof_type);
+                    if (!this->used[i])
+                         continue;
+
+                    const double value = topology::get_degree_of_freedom((*chain)[r], dof_type, sidechain_dihedrals);
+                    this->cos_value[i] = std::cos(value);
+                    this->sin_value[i] = std::sin(value);
+               }
+          }
+     }
+};
+
+
+//! Proper torsion interactions in structure-of-arrays layout. The
+//! multiplicities of each atom quadruplet are merged into one Fourier series
+//!   E(phi) = c + sum_n a_n cos(n phi) + b_n sin(n phi),
+//! where a term cp (1 + cos(n phi - phi0)) contributes cp to c,
+//! cp cos(phi0) to a_n and cp sin(phi0) to b_n. The dihedral angle of each
+//! quadruplet is thus computed once, and cos(n phi) and sin(n phi) follow
+//! from cos(phi) and sin(phi) by recurrence, without trigonometric functions.
+//! If all quadruplets in a list correspond to degrees of freedom of the chain,
+//! cos(phi) and sin(phi) can instead be obtained from the degrees of freedom,
+//! rotated by the offset to the dihedral angle of the quadruplet.
+class TorsionList: public DihedralList {
+public:
+
+     //! Highest multiplicity supported
+     static const unsigned int MAX_MULTIPLICITY = 6;
+
+     //! Constant terms of the series in kJ/mol
+     std::vector<double> constant;
+
+     //! Cosine coefficients a_n in kJ/mol (index n-1)
+     std::vector<double> cos_coefficient[MAX_MULTIPLICITY];
+
+     //! Sine coefficients b_n in kJ/mol (index n-1)
+     std::vector<double> sin_coefficient[MAX_MULTIPLICITY];
+
+     //! Highest multiplicity in the series
+     std::vector<unsigned int> max_multiplicity;
+
+     //! Index of the degree of freedom with the same central bond in a
+     //! DegreesOfFreedom table (only meaningful if there is one)
+     std::vector<unsigned int> dof_index;
+
+     //! Cosines of the offsets between dihedral angles and degrees of freedom
+     std::vector<double> offset_cos;
+
+     //! Sines of the offsets between dihedral angles and degrees of freedom
+     std::vector<double> offset_sin;
+
+     //! Append an interaction. Interactions on a quadruplet that is already
+     //! in the list (in either direction) are added to its series.
+     //! \param interaction Torsion interaction
+     void add(const topology::TorsionInteraction &interaction) {
+
+          if (interaction.mult > MAX_MULTIPLICITY) {
+               std::cerr << "# Error: torsion multiplicity " << interaction.mult
+                         << " is larger than " << MAX_MULTIPLICITY << ".\n";
+               exit(EXIT_FAILURE);
+          }
+
+          // The dihedral angle is the same in both directions
+          std::vector<phaistos::Atom *> key(4);
+          key[0] = interaction.atom1;
+          key[1] = interaction.atom2;
+          key[2] = interaction.atom3;
+          key[3] = interaction.atom4;
+          if (std::less<phaistos::Atom *>()(key[3], key[0])) {
+               std::reverse(key.begin(), key.end());
+          }
+
+          std::map<std::vector<phaistos::Atom *>, unsigned int>::iterator it = this->quadruplet_index.find(key);
+
+          unsigned int index;
+          if (it == this->quadruplet_index.end()) {
+               index = size();
+               this->quadruplet_index[key] = index;
+               add_atoms(interaction);
+               this->constant.push_back(0.0);
+               for (unsigned int n = 0; n < MAX_MULTIPLICITY; n++) {
+                    this->cos_coefficient[n].push_back(0.0);
+                    this->sin_coefficient[n].push_back(0.0);
+               }
+               this->max_multiplicity.push_back(0);
+               this->dof_index.push_back((interaction.dof_type == topology::DOF_NONE) ? 0 :
+                                         DegreesOfFreedom::index(interaction.dof_residue_index, interaction.dof_type));
+               this->offset_cos.push_back(1.0);
+               this->offset_sin.push_back(0.0);
+          } else {
+               index = it->second;
+          }
+
+          const double phi0 = interaction.phi0 * charmm_constants::DEG_TO_RAD;
+          const double cp = interaction.cp;
+
+          this->constant[index] += cp;
+          if (interaction.mult == 0) {
+               this->constant[index] += cp * std::cos(phi0);
+          } else {
+               this->cos_coefficient[interaction.mult - 1][index] += cp * std::cos(phi0);
+               this->sin_coefficient[interaction.mult - 1][index] += cp * std::sin(phi0);
+          }
+          this->max_multiplicity[index] = std::max(this->max_multiplicity[index], interaction.mult);
+     }
+
+     //! Mark the degrees of freedom of the list as used in a table
+     //! \param dofs Degrees of freedom
+     void use_degrees_of_freedom(DegreesOfFreedom &dofs) const {
+
+          for (unsigned int i = 0; i < size(); i++) {
+               dofs.used[this->dof_index[i]] = true;
+          }
+     }
+
+     //! Cosine and sine of the dihedral angles of a block of quadruplets,
+     //! obtained from the degrees of freedom of the chain
+     //! \param begin Index of first quadruplet
+     //! \param n Number of quadruplets (at most BLOCK_SIZE)
+     //! \param dofs Current degrees of freedom
+     //! \param cos_phi Cosines of dihedral angles (output)
+     //! \param sin_phi Sines of dihedral angles (output)
+     void internal_cos_sin(const unsigned int begin, const unsigned int n, const DegreesOfFreedom &dofs,
+                           double *cos_phi, double *sin_phi) const {
+
+          double cos_dof[BLOCK_SIZE];
+          double sin_dof[BLOCK_SIZE];
+
+          for (unsigned int i = 0; i < n; i++) {
+               cos_dof[i] = dofs.cos_value[this->dof_index[begin + i]];
+               sin_dof[i] = dofs.sin_value[this->dof_index[begin + i]];
+          }
+
+          const double *offset_cos = &this->offset_cos[begin];
+          const double *offset_sin = &this->offset_sin[begin];
+
+#pragma omp simd
+          for (unsigned int i = 0; i < n; i++) {
+               cos_phi[i] = cos_dof[i] * offset_cos[i] - sin_dof[i] * offset_sin[i];
+               sin_phi[i] = sin_dof[i] * offset_cos[i] + cos_dof[i] * offset_sin[i];
+          }
+     }
+
+     //! Set the offsets between the dihedral angles (computed from the atom
+     //! positions) and the degrees of freedom of the chain
+     //! \param dofs Current degrees of freedom
+     void update_offsets(const DegreesOfFreedom &dofs) {
+
+          double cos_phi[BLOCK_SIZE];
+          double sin_phi[BLOCK_SIZE];
+
+          for (unsigned int block = 0; block < size(); block += BLOCK_SIZE) {
+
+               const unsigned int n = std::min(BLOCK_SIZE, size() - block);
+               cos_sin(block, n, cos_phi, sin_phi);
+
+               for (unsigned int i = 0; i < n; i++) {
+                    const double cos_dof = dofs.cos_value[this->dof_index[block + i]];
+                    const double sin_dof = dofs.sin_value[this->dof_index[block + i]];
+                    this->offset_cos[block + i] = cos_phi[i] * cos_dof + sin_phi[i] * sin_dof;
+                    this->offset_sin[block + i] = sin_phi[i] * cos_dof - cos_phi[i] * sin_dof;
+               }
+          }
+     }
+
+     //! Dihedral angle cosines, sines and energies of a block of quadruplets
+     //! \param begin Index of first quadruplet
+     //! \param n Number of quadruplets (at most BLOCK_SIZE)
+     //! \param cos_phi Cosines of dihedral angles (output)
+     //! \param sin_phi Sines of dihedral angles (output)
+     //! \param energy Energies in kJ/mol (output)
+     //! \param dofs Degrees of freedom the angles are read from (NULL: compute from atom positions)
+     void evaluate_block(const unsigned int begin, const unsigned int n,
+                         double *cos_phi, double *sin_phi, double *energy,
+                         const DegreesOfFreedom *dofs=NULL) const {
+
+          if (dofs) {
+               internal_cos_sin(begin, n, *dofs, cos_phi, sin_phi);
+          } else {
+               cos_sin(begin, n, cos_phi, sin_phi);
+          }
+
+          const double *constant = &this->constant[begin];
+
+#pragma omp simd
+          for (unsigned int i = 0; i < n; i++) {
+               energy[i] = constant[i];
+          }
+
+          double cos_n_phi[BLOCK_SIZE];
+          double sin_n_phi[BLOCK_SIZE];
+
+#pragma omp simd
+          for (unsigned int i = 0; i < n; i++) {
+               cos_n_phi[i] = 1.0;
+               sin_n_phi[i] = 0.0;
+          }
+
+          // Only go as far as the highest multiplicity in the block
+          unsigned int block_max_multiplicity = 0;
+          for (unsigned int i = 0; i < n; i++) {
+               block_max_multiplicity = std::max(block_max_multiplicity, this->max_multiplicity[begin + i]);
+          }
+
+          for (unsigned int m = 0; m < block_max_multiplicity; m++) {
+
+               const double *a = &this->cos_coefficient[m][begin];
+               const double *b = &this->sin_coefficient[m][begin];
+
+#pragma omp simd
+               for (unsigned int i = 0; i < n; i++) {
+
+                    // cos((m+1) phi) and sin((m+1) phi) from cos(m phi) and sin(m phi)
+                    const double c = cos_n_phi[i] * cos_phi[i] - sin_n_phi[i] * sin_phi[i];
+                    const double s = sin_n_phi[i] * cos_phi[i] + cos_n_phi[i] * sin_phi[i];
+                    cos_n_phi[i] = c;
+                    sin_n_phi[i] = s;
+
+                    energy[i] += a[i] * c + b[i] * s;
+               }
+          }
+     }
+
+     //! Add the energies of a range of quadruplets
+     //! \param begin Index of first quadruplet
+     //! \param end Index after last quadruplet
+     //! \param energies Sum of energies (index 0) in kJ/mol
+     //! \param dofs Degrees of freedom the angles are read from (NULL: compute from atom positions)
+     void add_energies(const unsigned int begin, const unsigned int end, double *energies,
+                       const DegreesOfFreedom *dofs=NULL) const {
+
+          double cos_phi[BLOCK_SIZE];
+          double sin_phi[BLOCK_SIZE];
+          double energy[BLOCK_SIZE];
+
+          for (unsigned int block = begin; block < end; block += BLOCK_SIZE) {
+
+               const unsigned int n = std::min(BLOCK_SIZE, end - block);
+               evaluate_block(block, n, cos_phi, sin_phi, energy, dofs);
+
+               for (unsigned int i = 0; i < n; i++) {
+                    energies[0] += energy[i];
+               }
+          }
+     }
+
+private:
+
+     //! Index of each quadruplet, with the atoms in canonical direction
+     std::map<std::vector<phaistos::Atom *>, unsigned int> quadruplet_index;
+};
+
+
+//! Improper torsion interactions in structure-of-arrays layout
+class ImproperList: public DihedralList {
+public:
+
+     //! Equilibrium angles in radians
+     std::vector<double> phi0;
+
+     //! Force constants in kJ/mol/rad^2
+     std::vector<double> cp;
+
+     //! Append an interaction
+     //! \param interaction Improper torsion interaction
+     void add(const topology::ImproperTorsionInteraction &interaction) {
+          add_atoms(interaction);
+          this->phi0.push_back(interaction.phi0 * charmm_constants::DEG_TO_RAD);
+          this->cp.push_back(interaction.cp);
+     }
+
+     //! Dihedral angles and energies of a block of interactions
+     //! \param begin Index of first interaction
+     //! \param n Number of interactions (at most BLOCK_SIZE)
+     //! \param phi Dihedral angles in radians (output)
+     //! \param energy Energies in kJ/mol (output)
+     void evaluate_block(const unsigned int begin, const unsigned int n, double *phi, double *energy) const {
+
+          angles(begin, n, phi);
+
+          const double *phi0 = &this->phi0[begin];
+          const double *cp = &this->cp[begin];
+
+#pragma omp simd
+          for (unsigned int i = 0; i < n; i++) {
+               const double dphi = phi[i] - phi0[i];
+               energy[i] = 0.5 * cp[i] * dphi * dphi;
+          }
+     }
+
+     //! Add the energies of a range of interactions
+     //! \param begin Index of first interaction
+     //! \param end Index after last interaction
+     //! \param energies Sum of energies (index 0) in kJ/mol
+     void add_energies(const unsigned int begin, const unsigned int end, double *energies) const {
+
+          double phi[BLOCK_SIZE];
+          double energy[BLOCK_SIZE];
+
+          for (unsigned int block = begin; block < end; block += BLOCK_SIZE) {
+
+               const unsigned int n = std::min(BLOCK_SIZE, end - block);
+               evaluate_block(block, n, phi, energy);
+
+               for (unsigned int i = 0; i < n; i++) {
+                    energies[0] += energy[i];
+               }
+          }
+     }
+};
+
+
+//! Relative change of a squared distance still considered unchanged (BondGeometry)
+const double GEOMETRY_TOLERANCE = 1e-8;
+
+//! Squared displacement in square angstrom still considered unchanged (PositionReference)
+const double POSITION_TOLERANCE = 1e-16;
+
+
+//! Squared lengths of the bonds and of the 1-3 distances across the bond
+//! angles of a chain, grouped by residue. If none of them has changed in a move
+//! of a range of residues, the move only changed dihedral angles: the bond
+//! stretch, angle bend and Urey-Bradley energies are unchanged, and so are the
+//! offsets between torsions and the degrees of freedom of the chain.
+class BondGeometry {
+public:
+
+     //! First atoms
+     std::vector<phaistos::Atom *> atom1;
+
+     //! Second atoms
+     std::vector<phaistos::Atom *> atom2;
+
+     //! Reference squared distances
+     std::vector<double> reference;
+
+     //! Index of the first pair of each residue (followed by the number of pairs)
+     std::vector<unsigned int> residue_begin;
+
+     //! Default constructor
+     BondGeometry() {}
+
+     //! Constructor. Pairs are assigned to the residue of their first atom in
+     //! chain iteration order, so the pairs of a residue that can change in a
+     //! move of residues first..last are those of residues first-1..last+1.
+     //! \param bond_graph Covalent bond graph of the chain
+     BondGeometry(const topology::BondGraph &bond_graph) {
+
+          const unsigned int n_residues = bond_graph.residue_begin.size() - 1;
+          this->residue_begin.resize(n_residues + 1);
+
+          for (unsigned int r = 0; r < n_residues; r++) {
+
+               this->residue_begin[r] = size();
+
+               for (unsigned int i = bond_graph.residue_begin[r]; i < bond_graph.residue_begin[r + 1]; i++) {
+                    for (unsigned int k = 0; k < bond_graph.neighbours[i].size(); k++) {
+
+                         const unsigned int j = bond_graph.neighbours[i][k].first;
+                         if (j > i && bond_graph.neighbours[i][k].second <= 2) {
+                              this->atom1.push_back(bond_graph.atoms[i]);
+                              this->atom2.push_back(bond_graph.atoms[j]);
+                         }
+                    }
+               }
+          }
+          this->residue_begin[n_residues] = size();
+
+          this->reference.resize(size());
+          update(0, n_residues - 1);
+     }
+
+     //! Number of atom pairs
+     unsigned int size() const {
+          return this->atom1.size();
+     }
+
+     //! Whether the bond geometry of a range of residues is the same as the reference
+     //! \param first_residue Index of first residue (clipped to the chain)
+     //! \param last_residue Index of last residue (clipped to the chain)
+     bool is_unchanged(const int first_residue, const int last_residue) const {
+
+          const unsigned int begin = this->residue_begin[std::max(first_residue, 0)];
+          const unsigned int end = this->residue_begin[std::min(last_residue + 1, int(this->residue_begin.size()) - 1)];
+
+          for (unsigned int i = begin; i < end; i++) {
+               const double distance_sq = (this->atom1[i]->position - this->atom2[i]->position).norm_squared();
+               if (std::fabs(distance_sq - this->reference[i]) > GEOMETRY_TOLERANCE * this->reference[i])
+                    return false;
+          }
+          return true;
+     }
+
+     //! Set the reference of a range of residues to the current bond geometry
+     //! \param first_residue Index of first residue (clipped to the chain)
+     //! \param last_residue Index of last residue (clipped to the chain)
+     void update(const int first_residue, const int last_residue) {
+
+          const unsigned int begin = this->residue_begin[std::max(first_residue, 0)];
+          const unsigned int end = this->residue_begin[std::min(last_residue + 1, int(this->residue_begin.size()) - 1)];
+
+          for (unsigned int i = begin; i < end; i++) {
+               this->reference[i] = (this->atom1[i]->position - this->atom2[i]->position).norm_squared();
+          }
+     }
+};
+
+//! Reference positions of a set of atoms, to find out whether a move
+//! changed any of them
+class PositionReference {
+
+     //! Atoms already in the set
+     std::set<phaistos::Atom *> atom_set;
+
+public:
+
+     //! Atoms
+     std::vector<phaistos::Atom *> atoms;
+
+     //! Reference positions
+     std::vector<phaistos::Vector_3D> reference;
+
+     //! Add an atom (atoms already in the set are ignored)
+     //! \param atom Atom
+     void add(phaistos::Atom *atom) {
+
+          if (this->atom_set.insert(atom).second) {
+               this->atoms.push_back(atom);
+               this->reference.push_back(atom->position);
+          }
+     }
+
+     //! Add the atoms of a list of dihedral interactions
+     //! \param list Torsion or improper torsion list
+     void add(const DihedralList &list) {
+
+          for (unsigned int i = 0; i < list.size(); i++) {
+               add(list.atom1[i]);
+               add(list.atom2[i]);
+               add(list.atom3[i]);
+               add(list.atom4[i]);
+          }
+     }
+
+     //! Whether all atoms are at their reference positions
+     bool is_unchanged() const {
+
+          for (unsigned int i = 0; i < this->atoms.size(); i++) {
+               if ((this->atoms[i]->position - this->reference[i]).norm_squared() > POSITION_TOLERANCE)
+                    return false;
+          }
+          return true;
+     }
+
+     //! Set the reference to the current positions
+     void update() {
+
+          for (unsigned int i = 0; i < this->atoms.size(); i++) {
+               this->reference[i] = this->atoms[i]->position;
+          }
+     }
+};
+
+//! Copy a list of interactions into a structure-of-arrays list
+//! \param interactions Interactions
+//! \param list Structure-of-arrays list (output)
+template <typename INTERACTION, typename LIST>
+void fill(const std::vector<INTERACTION> &interactions, LIST &list) {
+
+     for (unsigned int i = 0; i < interactions.size(); i++) {
+          list.add(interactions[i]);
+     }
+}
+
+} // End namespace charmm_bonded
+
+#endif
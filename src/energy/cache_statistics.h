@@ -0,0 +1,172 @@
+// cache_statistics.h -- Counters for the cached CHARMM36/EEF1-SB energy terms
+// Copyright (C) 2026 agent
+//
+// This file is part of Phaistos
+//
+// Phaistos is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Phaistos is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Phaistos.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+#ifndef CHARMM_CACHE_STATISTICS_H
+#define CHARMM_CACHE_STATISTICS_H
+
+#include <string>
+#include <vector>
+#include <iostream>
+#include <cstdio>
+
+namespace charmm_cache {
+
+//! Counters that keep track of how much work a cached term does per evaluation.
+//! Work per evaluation is recorded in histograms with power-of-two bins,
+//! i.e. bin 0 counts 0, bin 1 counts 1, bin 2 counts 2-3, bin 3 counts 4-7, etc.
+class CacheStatistics {
+
+public:
+
+     //! Number of histogram bins
+     static const unsigned int n_bins = 32;
+
+     //! Index of thread|rank in which the owning term exists (for output only)
+     int thread_index;
+
+     //! Number of evaluations with a move (i.e. excluding none-moves)
+     unsigned long evaluations;
+
+     //! Number of evaluations of none-moves
+     unsigned long none_moves;
+
+     //! Number of accepted moves
+     unsigned long accepts;
+
+     //! Number of rejected moves
+     unsigned long rejects;
+
+     //! Number of times the total energy was resummed from the cache
+     unsigned long full_resums;
+
+     //! Number of residues whose pair lists were rebuilt
+     unsigned long pair_list_rebuilds;
+
+     //! Total number of cache cells (residues or residue pairs) recomputed
+     unsigned long cells_total;
+
+     //! Total number of interactions recomputed
+     unsigned long interactions_total;
+
+     //! Histogram of cache cells recomputed per evaluation
+     std::vector<unsigned long> cells_histogram;
+
+     //! Histogram of interactions recomputed per evaluation
+     std::vector<unsigned long> interactions_histogram;
+
+     //! Constructor
+     //! \param thread_index Index of thread|rank in which the owning term exists
+     CacheStatistics(int thread_index=0)
+          : thread_index(thread_index),
+            evaluations(0),
+            none_moves(0),
+            accepts(0),
+            rejects(0),
+            full_resums(0),
+            pair_list_rebuilds(0),
+            cells_total(0),
+            interactions_total(0),
+            cells_histogram(n_bins, 0),
+            interactions_histogram(n_bins, 0) {}
+
+     //! Histogram bin of a count
+     //! \param count Number of cells or interactions
+     //! \return Bin index
+     static unsigned int bin(unsigned long count) {
+
+          unsigned int bin_index = 0;
+          while (count > 0 && bin_index < n_bins - 1) {
+               count >>= 1;
+               bin_index++;
+          }
+          return bin_index;
+     }
+
+     //! Register the work done in an evaluation
+     //! \param cells Number of cache cells recomputed
+     //! \param interactions Number of interactions recomputed
+     void add_evaluation(const unsigned long cells, const unsigned long interactions) {
+
+          evaluations++;
+          cells_total += cells;
+          interactions_total += interactions;
+          cells_histogram[bin(cells)]++;
+          interactions_histogram[bin(interactions)]++;
+     }
+
+     //! Output statistics
+     //! \param o Output stream
+     //! \param term_name Name of the owning energy term
+     //! \param cell_name What a cache cell is in the owning term (e.g. "residue pairs")
+     //! \param interaction_name What an interaction is in the owning term (e.g. "atom pairs")
+     //! \param report_full_resums Whether the owning term can resum its total energy
+     void print(std::ostream &o,
+                const std::string &term_name,
+                const std::string &cell_name,
+                const std::string &interaction_name,
+                const bool report_full_resums=false) const {
+
+          const double evaluations_norm = (evaluations > 0) ? (double)evaluations : 1.0;
+
+          o << "# " << term_name << " cache statistics (thread " << thread_index << "):\n";
+          o << "#   evaluations:          " << evaluations << "\n";
+          o << "#   none-moves:           " << none_moves << "\n";
+          o << "#   accepted:             " << accepts << "\n";
+          o << "#   rejected:             " << rejects << "\n";
+          if (report_full_resums) {
+               o << "#   full resums:          " << full_resums << "\n";
+          }
+          if (pair_list_rebuilds > 0) {
+               o << "#   pair list rebuilds:   " << pair_list_rebuilds << "\n";
+          }
+          o << "#   " << cell_name << " per evaluation: " << cells_total / evaluations_norm << "\n";
+          o << "#   " << interaction_name << " per evaluation: " << interactions_total / evaluations_norm << "\n";
+
+          print_histogram(o, cell_name, cells_histogram);
+          print_histogram(o, interaction_name, interactions_histogram);
+          o << std::flush;
+     }
+
+     //! Output a single histogram (empty bins are skipped)
+     //! \param o Output stream
+     //! \param name What is counted in the histogram
+     //! \param histogram Histogram counts
+     static void print_histogram(std::ostream &o,
+                                 const std::string &name,
+                                 const std::vector<unsigned long> &histogram) {
+
+          o << "#   histogram of " << name << " per evaluation:\n";
+          for (unsigned int i = 0; i < histogram.size(); i++) {
+
+               if (histogram[i] == 0)
+                    continue;
+
+               const unsigned long low  = (i == 0) ? 0 : (1ul << (i - 1));
+               const unsigned long high = (i == 0) ? 0 : (1ul << i) - 1;
+
+               char buffer[64];
+               sprintf(buffer, "#     %10lu - %10lu : ", low, high);
+               o << buffer << histogram[i] << "\n";
+          }
+     }
+};
+
+} // End namespace charmm_cache
+
+#endif
@@ -0,0 +1,235 @@
+// far_field.h -- Far-field approximation of residue pair non-bonded energies
+// Copyright (C) 2026 agent
+//
+// This file is part of Phaistos
+//
+// Phaistos is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Phaistos is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Phaistos.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+#ifndef CHARMM_FAR_FIELD_H
+#define CHARMM_FAR_FIELD_H
+
+#include <vector>
+#include <cmath>
+#include <algorithm>
+
+#include "parsers/topology_items.h"
+#include "constants.h"
+
+namespace charmm_far_field {
+
+//! Distance beyond which the EEF1-SB pair term is exactly zero (Angstrom)
+const double EEF1_CUTOFF = 9.0;
+
+//! An atom and its partial charge
+struct ChargedAtom {
+
+     phaistos::Atom *atom;
+     double charge;
+};
+
+//! Multipole summary of the atoms in a residue
+struct ResidueSummary {
+
+     //! Geometric center of the residue atoms
+     phaistos::Vector_3D centroid;
+
+     //! Largest distance from an atom to the centroid
+     double radius;
+
+     //! Net charge
+     double charge;
+
+     //! Sum of absolute charges
+     double abs_charge;
+
+     //! Dipole moment about the centroid
+     phaistos::Vector_3D dipole;
+};
+
+//! Constant summary of all atom pairs between two residues
+struct ResiduePairSummary {
+
+     //! Whether the pair can be approximated, i.e. all atom pairs
+     //! between the residues are regular (non 1-4) interactions
+     bool eligible;
+
+     //! Sum of c6 over all atom pairs
+     double c6_sum;
+
+     //! Sum of c12 over all atom pairs
+     double c12_sum;
+};
+
+
+//! Calculate the multipole summary of a residue from the current atom positions
+//! \param atoms Atoms in the residue with their charges
+//! \return Residue summary
+inline ResidueSummary calculate_residue_summary(const std::vector<ChargedAtom> &atoms) {
+
+     ResidueSummary summary;
+     summary.centroid = phaistos::Vector_3D(0.0, 0.0, 0.0);
+     summary.dipole = phaistos::Vector_3D(0.0, 0.0, 0.0);
+     summary.radius = 0.0;
+     summary.charge = 0.0;
+     summary.abs_charge = 0.0;
+
+     if (atoms.empty())
+          return summary;
+
+     for (unsigned int i = 0; i < atoms.size(); i++) {
+          summary.centroid = summary.centroid + atoms[i].atom->position;
+     }
+     summary.centroid = summary.centroid * (1.0 / atoms.size());
+
+     double radius_sq = 0.0;
+     for (unsigned int i = 0; i < atoms.size(); i++) {
+
+          const phaistos::Vector_3D d = atoms[i].atom->position - summary.centroid;
+
+          radius_sq = std::max(radius_sq, d.norm_squared());
+
+          summary.charge += atoms[i].charge;
+          summary.abs_charge += std::fabs(atoms[i].charge);
+          summary.dipole = summary.dipole + d * atoms[i].charge;
+     }
+     summary.radius = std::sqrt(radius_sq);
+
+     return summary;
+}
+
+
+//! Summarize the atom pairs between two residues
+//! \param interactions Interaction list
+//! \param begin Index of first interaction between the two residues
+//! \param end Index after last interaction between the two residues
+//! \param n_atoms1 Number of atoms in first residue
+//! \param n_atoms2 Number of atoms in second residue
+//! \return Residue pair summary
+inline ResiduePairSummary calculate_residue_pair_summary(const std::vector<topology::NonBondedInteraction> &interactions,
+                                                         const unsigned int begin,
+                                                         const unsigned int end,
+                                                         const unsigned int n_atoms1,
+                                                         const unsigned int n_atoms2) {
+
+     ResiduePairSummary summary;
+     summary.c6_sum = 0.0;
+     summary.c12_sum = 0.0;
+
+     // Charges (and the multipole expansion) only factorize if every atom pair is present as a regular pair
+     summary.eligible = (end - begin == n_atoms1 * n_atoms2);
+
+     for (unsigned int k = begin; k < end; k++) {
+
+          if (interactions[k].is_14_interaction)
+               summary.eligible = false;
+
+          summary.c6_sum += interactions[k].c6;
+          summary.c12_sum += interactions[k].c12;
+     }
+
+     return summary;
+}
+
+
+//! Approximate the non-bonded energy between two distant residues.
+//! van der Waals is evaluated at the centroid distance, and Coulomb
+//! (with the r-dependent dielectric) is expanded to dipole order.
+//! The EEF1-SB term is zero since all atom pairs are beyond its cutoff.
+//! The returned bound is a rigorous bound on the error, obtained from the
+//! Taylor remainder of each kernel over the spread of the residues.
+//! \param summary1 Summary of first residue
+//! \param summary2 Summary of second residue
+//! \param pair_summary Summary of the pair
+//! \param cutoff Centroid distance beyond which pairs may be approximated (Angstrom)
+//! \param tolerance Largest error bound accepted for a single pair (kcal/mol)
+//! \param energy Approximated energy (kJ/mol). Only set if true is returned.
+//! \param error_bound Bound on the approximation error (kJ/mol). Only set if true is returned.
+//! \param ctofnb Non-bonded cutoff (Angstrom, 0: none). With a cutoff, pairs entirely beyond
+//!               it are exactly zero and all other pairs are left for exact evaluation.
+//! \return Whether the pair is in the far field and was approximated
+inline bool calculate_far_field_energy(const ResidueSummary &summary1,
+                                       const ResidueSummary &summary2,
+                                       const ResiduePairSummary &pair_summary,
+                                       const double cutoff,
+                                       const double tolerance,
+                                       double &energy,
+                                       double &error_bound,
+                                       const double ctofnb=0.0) {
+
+     if (!pair_summary.eligible)
+          return false;
+
+     const phaistos::Vector_3D r_vec = summary2.centroid - summary1.centroid;
+     const double r_sq = r_vec.norm_squared();
+
+     if (r_sq <= cutoff * cutoff)
+          return false;
+
+     const double r = std::sqrt(r_sq);
+
+     // Shortest possible atom-atom distance between the residues
+     const double spread = summary1.radius + summary2.radius;
+     const double r_min = r - spread;
+
+     // With a non-bonded cutoff, the approximation is not needed (or valid) since the switching
+     // function is not included, but pairs that are entirely beyond the cutoff can be skipped.
+     if (ctofnb > 0.0) {
+
+          if (r_min < ctofnb)
+               return false;
+
+          energy = 0.0;
+          error_bound = 0.0;
+          return true;
+     }
+
+     // Only approximate pairs with no EEF1-SB contribution
+     if (r_min <= EEF1_CUTOFF)
+          return false;
+
+     const double inv_r2 = 1.0 / r_sq;
+     const double inv_r6 = inv_r2 * inv_r2 * inv_r2 * charmm_constants::NM6_TO_ANGS6;
+
+     const double inv_r_min2 = 1.0 / (r_min * r_min);
+     const double inv_r_min6 = inv_r_min2 * inv_r_min2 * inv_r_min2 * charmm_constants::NM6_TO_ANGS6;
+
+     // Bounds on the error of evaluating 1/r^6 and 1/r^12 at the centroid distance
+     const double vdw_bound = pair_summary.c12_sum * (inv_r_min6 * inv_r_min6 - inv_r6 * inv_r6)
+                            + pair_summary.c6_sum * (inv_r_min6 - inv_r6);
+
+     // The Hessian of 1/r^2 is bounded by 6/r^4, so the first order remainder is at most 3*spread^2/r_min^4
+     const double coul_bound = charmm_constants::FELEC * charmm_constants::TEN_OVER_ONE_POINT_FIVE
+                             * summary1.abs_charge * summary2.abs_charge
+                             * 3.0 * spread * spread * inv_r_min2 * inv_r_min2;
+
+     error_bound = vdw_bound + coul_bound;
+
+     if (error_bound * charmm_constants::KJ_TO_KCAL > tolerance)
+          return false;
+
+     // Monopole and dipole terms of sum_ij q_i q_j / |r + d_j - d_i|^2
+     const double monopole = summary1.charge * summary2.charge * inv_r2;
+     const double dipole = -2.0 * inv_r2 * inv_r2 * (summary1.charge * (r_vec * summary2.dipole)
+                                                   - summary2.charge * (r_vec * summary1.dipole));
+
+     energy = (pair_summary.c12_sum * inv_r6 - pair_summary.c6_sum) * inv_r6
+            + charmm_constants::FELEC * charmm_constants::TEN_OVER_ONE_POINT_FIVE * (monopole + dipole);
+
+     return true;
+}
+
+} // End namespace charmm_far_field
+
+#endif
@@ -0,0 +1,254 @@
+// neighbour_list.h -- Bookkeeping for cutoff-based non-bonded pair lists
+// Copyright (C) 2026 agent
+//
+// This file is part of Phaistos
+//
+// Phaistos is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Phaistos is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Phaistos.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+#ifndef CHARMM_NEIGHBOUR_LIST_H
+#define CHARMM_NEIGHBOUR_LIST_H
+
+#include <vector>
+#include <iostream>
+#include <cstdlib>
+#include <cmath>
+#include <algorithm>
+
+#include "parsers/topology_items.h"
+
+namespace charmm_neighbour_list {
+
+//! Default distance between the pair list cutoff (cutnb) and the energy cutoff (ctofnb) (Angstrom)
+const double DEFAULT_SKIN = 2.0;
+
+//! Distance within which atom pairs are kept in the pair list
+//! \param ctofnb Distance beyond which atom pairs do not contribute (Angstrom, 0: no cutoff)
+//! \param cutnb Requested pair list cutoff (Angstrom, 0: ctofnb + DEFAULT_SKIN)
+//! \return Pair list cutoff (0 if all pairs must be included)
+inline double pair_list_cutoff(const double ctofnb, const double cutnb) {
+
+     if (ctofnb <= 0.0)
+          return 0.0;
+
+     if (cutnb <= 0.0)
+          return ctofnb + DEFAULT_SKIN;
+
+     if (cutnb < ctofnb) {
+          std::cerr << "# Error: cutnb (" << cutnb << ") must not be smaller than ctofnb (" << ctofnb << ").\n";
+          exit(EXIT_FAILURE);
+     }
+
+     return cutnb;
+}
+
+
+//! Keeps track of how far atoms have moved since a pair list was built.
+//! A list containing all pairs within cutnb stays complete for the cutoff
+//! ctofnb until some atom has moved more than half the skin (cutnb - ctofnb).
+//! References can also be reset per residue, in which case a pair list is
+//! complete as long as it contains all pairs whose reference positions are
+//! within cutnb of each other.
+class DisplacementTracker {
+
+public:
+
+     //! Atoms that are tracked (in chain iteration order)
+     std::vector<phaistos::Atom *> atoms;
+
+     //! Positions of atoms when the pair list was built
+     std::vector<phaistos::Vector_3D> reference_positions;
+
+     //! Index of first atom of each residue in atoms (plus a final entry with the number of atoms)
+     std::vector<unsigned int> residue_begins;
+
+     //! Center of the reference positions of each residue
+     std::vector<phaistos::Vector_3D> reference_centers;
+
+     //! Largest distance from a reference position to its residue center
+     std::vector<double> reference_radii;
+
+     //! Half the skin
+     double half_skin;
+
+     //! Square of half the skin
+     double half_skin_sq;
+
+     //! Default constructor
+     DisplacementTracker()
+          : half_skin(0.0),
+            half_skin_sq(0.0) {}
+
+     //! Constructor
+     //! \param chain Molecule chain
+     //! \param skin Difference between pair list cutoff and energy cutoff (Angstrom)
+     DisplacementTracker(phaistos::ChainFB *chain, const double skin)
+          : half_skin(0.5 * skin),
+            half_skin_sq(0.25 * skin * skin) {
+
+          this->residue_begins.assign(chain->size() + 1, 0);
+
+          for (phaistos::AtomIterator<phaistos::ChainFB, phaistos::definitions::ALL> it(*chain); !it.end(); ++it) {
+               this->atoms.push_back(&*it);
+               this->residue_begins[it->residue->index + 1] = this->atoms.size();
+          }
+          this->reference_positions.resize(this->atoms.size());
+          this->reference_centers.resize(chain->size());
+          this->reference_radii.resize(chain->size());
+          reset();
+     }
+
+     //! Register that the pair list was (re)built from the current positions
+     void reset() {
+
+          for (unsigned int i = 0; i + 1 < this->residue_begins.size(); i++) {
+               reset(i);
+          }
+     }
+
+     //! Register that the pair list of a residue was rebuilt from its current positions
+     //! \param residue_index Index of residue
+     void reset(const unsigned int residue_index) {
+
+          const unsigned int begin = this->residue_begins[residue_index];
+          const unsigned int end = this->residue_begins[residue_index + 1];
+
+          for (unsigned int i = begin; i < end; i++) {
+               this->reference_positions[i] = this->atoms[i]->position;
+          }
+          calculate_sphere(begin, end, this->reference_positions,
+                           this->reference_centers[residue_index], this->reference_radii[residue_index]);
+     }
+
+     //! Whether any atom has moved more than half the skin since the last reset
+     //! \return True if the pair list must be rebuilt
+     bool needs_rebuild() const {
+
+          for (unsigned int i = 0; i < this->atoms.size(); i++) {
+               if ((this->atoms[i]->position - this->reference_positions[i]).norm_squared() > this->half_skin_sq)
+                    return true;
+          }
+          return false;
+     }
+
+     //! Whether any atom in a residue has moved more than half the skin since its last reset
+     //! \param residue_index Index of residue
+     //! \return True if the pair list of the residue must be rebuilt
+     bool needs_rebuild(const unsigned int residue_index) const {
+
+          for (unsigned int i = this->residue_begins[residue_index]; i < this->residue_begins[residue_index + 1]; i++) {
+               if ((this->atoms[i]->position - this->reference_positions[i]).norm_squared() > this->half_skin_sq)
+                    return true;
+          }
+          return false;
+     }
+
+     //! Bounding sphere of the current positions of a residue
+     //! \param residue_index Index of residue
+     //! \param center Center of the sphere
+     //! \param radius Radius of the sphere
+     void current_sphere(const unsigned int residue_index, phaistos::Vector_3D &center, double &radius) const {
+
+          const unsigned int begin = this->residue_begins[residue_index];
+          const unsigned int end = this->residue_begins[residue_index + 1];
+
+          center = phaistos::Vector_3D(0.0, 0.0, 0.0);
+          radius = 0.0;
+
+          if (end <= begin)
+               return;
+
+          for (unsigned int i = begin; i < end; i++) {
+               center = center + this->atoms[i]->position;
+          }
+          center = center * (1.0 / (end - begin));
+
+          double radius_sq = 0.0;
+          for (unsigned int i = begin; i < end; i++) {
+               radius_sq = std::max(radius_sq, (this->atoms[i]->position - center).norm_squared());
+          }
+          radius = std::sqrt(radius_sq);
+     }
+
+     //! Whether two residues can have atom pairs closer than a cutoff, judged from their reference positions
+     //! \param residue1_index Index of first residue
+     //! \param residue2_index Index of second residue
+     //! \param cutoff Distance cutoff (Angstrom)
+     //! \return False if all reference positions are further apart than the cutoff
+     bool references_within(const unsigned int residue1_index,
+                            const unsigned int residue2_index,
+                            const double cutoff) const {
+
+          const double reach = cutoff + this->reference_radii[residue1_index] + this->reference_radii[residue2_index];
+
+          return (this->reference_centers[residue1_index] - this->reference_centers[residue2_index]).norm_squared() < reach * reach;
+     }
+
+     //! Bounding sphere of a range of positions (center at the mean position)
+     //! \param begin Index of first position
+     //! \param end Index after last position
+     //! \param positions Positions
+     //! \param center Center of the sphere
+     //! \param radius Radius of the sphere
+     static void calculate_sphere(const unsigned int begin, const unsigned int end,
+                                  const std::vector<phaistos::Vector_3D> &positions,
+                                  phaistos::Vector_3D &center, double &radius) {
+
+          center = phaistos::Vector_3D(0.0, 0.0, 0.0);
+          radius = 0.0;
+
+          if (end <= begin)
+               return;
+
+          for (unsigned int i = begin; i < end; i++) {
+               center = center + positions[i];
+          }
+          center = center * (1.0 / (end - begin));
+
+          double radius_sq = 0.0;
+          for (unsigned int i = begin; i < end; i++) {
+               radius_sq = std::max(radius_sq, (positions[i] - center).norm_squared());
+          }
+          radius = std::sqrt(radius_sq);
+     }
+};
+
+
+//! Predicate selecting interactions whose atoms had reference positions within a cutoff.
+//! Interaction indexes (index1, index2) must refer to DisplacementTracker::atoms.
+struct ReferenceDistanceWithin {
+
+     //! Reference positions
+     const std::vector<phaistos::Vector_3D> *reference_positions;
+
+     //! Square of cutoff
+     double cutoff_sq;
+
+     //! Constructor
+     //! \param tracker Displacement tracker holding the reference positions
+     //! \param cutoff Distance cutoff (Angstrom)
+     ReferenceDistanceWithin(const DisplacementTracker &tracker, const double cutoff)
+          : reference_positions(&tracker.reference_positions),
+            cutoff_sq(cutoff * cutoff) {}
+
+     //! Predicate
+     bool operator()(const topology::NonBondedInteraction &interaction) const {
+          return ((*this->reference_positions)[interaction.index1]
+                  - (*this->reference_positions)[interaction.index2]).norm_squared() < this->cutoff_sq;
+     }
+};
+
+} // End namespace charmm_neighbour_list
+
+#endif
@@ -0,0 +1,154 @@
+// parallel_sum.h -- Deterministic multithreaded summation of energy contributions and list building
+// Copyright (C) 2026 agent
+//
+// This file is part of Phaistos
+//
+// Phaistos is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Phaistos is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Phaistos.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+#ifndef CHARMM_PARALLEL_SUM_H
+#define CHARMM_PARALLEL_SUM_H
+
+#include <vector>
+#include <algorithm>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace charmm_parallel {
+
+//! Default number of interactions summed in one chunk
+const unsigned int DEFAULT_CHUNK_SIZE = 1024;
+
+//! Number of threads to use
+//! \param threads Requested number of threads (0: all available)
+//! \return Number of threads (always 1 without OpenMP)
+inline int get_n_threads(const int threads) {
+
+#ifdef _OPENMP
+     if (threads <= 0)
+          return omp_get_max_threads();
+     return threads;
+#else
+     (void)threads;
+     return 1;
+#endif
+}
+
+
+//! Sum the energy contributions of a range of interactions in parallel.
+//! The range is split into chunks of fixed size, which are summed by the
+//! threads independently. The chunk sums are then added in chunk order, so
+//! the result does not depend on the number of threads or on scheduling.
+//! \param term Energy term providing the contributions
+//! \param range_function Member function adding the contributions of interactions [begin, end) to an array of components
+//! \param n Number of interactions
+//! \param n_components Number of separately summed components (e.g. 1-4 and regular pairs)
+//! \param threads Requested number of threads (0: all available)
+//! \param sums Output array with n_components sums
+//! \param chunk_size Number of interactions per chunk
+template <typename TERM>
+void chunked_sum(const TERM &term,
+                 void (TERM::*range_function)(const unsigned int, const unsigned int, double *) const,
+                 const unsigned int n,
+                 const unsigned int n_components,
+                 const int threads,
+                 double *sums,
+                 const unsigned int chunk_size=DEFAULT_CHUNK_SIZE) {
+
+     const int n_chunks = (n + chunk_size - 1) / chunk_size;
+
+     std::vector<double> partial_sums(n_chunks * n_components + 1, 0.0);
+
+#ifdef _OPENMP
+     const int n_threads = std::max(1, std::min(get_n_threads(threads), n_chunks));
+
+#pragma omp parallel for schedule(dynamic) num_threads(n_threads) if(n_threads > 1)
+#else
+     (void)threads;
+#endif
+     for (int chunk = 0; chunk < n_chunks; chunk++) {
+
+          const unsigned int begin = chunk * chunk_size;
+          const unsigned int end = std::min(begin + chunk_size, n);
+
+          (term.*range_function)(begin, end, &partial_sums[chunk * n_components]);
+     }
+
+     for (unsigned int c = 0; c < n_components; c++) {
+          sums[c] = 0.0;
+     }
+
+     for (int chunk = 0; chunk < n_chunks; chunk++) {
+          for (unsigned int c = 0; c < n_components; c++) {
+               sums[c] += partial_sums[chunk * n_components + c];
+          }
+     }
+}
+
+
+//! Default number of range elements (e.g. atoms or residues) per chunk when building lists
+const unsigned int DEFAULT_BUILD_CHUNK_SIZE = 64;
+
+//! Build a list in parallel. The range [0, n) is split into chunks of fixed
+//! size, for which the builder appends elements to separate lists. These are
+//! then concatenated in chunk order, so the list is the same as that of a
+//! serial build, for any number of threads.
+//! \param builder Function object; builder(begin, end, list) appends the elements for range [begin, end) to list
+//! \param n Size of the range
+//! \param threads Requested number of threads (0: all available)
+//! \param list Output list
+//! \param chunk_size Number of range elements per chunk
+template <typename BUILDER, typename T>
+void chunked_build(const BUILDER &builder,
+                   const unsigned int n,
+                   const int threads,
+                   std::vector<T> &list,
+                   const unsigned int chunk_size=DEFAULT_BUILD_CHUNK_SIZE) {
+
+     const int n_chunks = (n + chunk_size - 1) / chunk_size;
+
+     std::vector<std::vector<T> > chunk_lists(n_chunks);
+
+#ifdef _OPENMP
+     const int n_threads = std::max(1, std::min(get_n_threads(threads), n_chunks));
+
+#pragma omp parallel for schedule(dynamic) num_threads(n_threads) if(n_threads > 1)
+#else
+     (void)threads;
+#endif
+     for (int chunk = 0; chunk < n_chunks; chunk++) {
+
+          const unsigned int begin = chunk * chunk_size;
+          const unsigned int end = std::min(begin + chunk_size, n);
+
+          builder(begin, end, chunk_lists[chunk]);
+     }
+
+     unsigned int size = 0;
+     for (int chunk = 0; chunk < n_chunks; chunk++) {
+          size += chunk_lists[chunk].size();
+     }
+
+     list.clear();
+     list.reserve(size);
+     for (int chunk = 0; chunk < n_chunks; chunk++) {
+          list.insert(list.end(), chunk_lists[chunk].begin(), chunk_lists[chunk].end());
+     }
+}
+
+} // End namespace charmm_parallel
+
+#endif
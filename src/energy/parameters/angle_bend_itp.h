@@ -1,2728 +0,0 @@
-// angle_bend_itp.h.h --- std::string'ed version of angle_bend.itp
-// Copyright (C) 2014 Anders S. Christensen
-// Copyright (c) 1991-2000, University of Groningen, The Netherlands.
-// Copyright (c) 2001-2004, The GROMACS development team,
-//
-// This file is part of Phaistos
-//
-// Phaistos is free software: you can redistribute it and/or modify
-// it under the terms of the GNU General Public License as published by
-// the Free Software Foundation, either version 3 of the License, or
-// (at your option) any later version.
-//
-// Phaistos is distributed in the hope that it will be useful,
-// but WITHOUT ANY WARRANTY; without even the implied warranty of
-// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
-// GNU General Public License for more details.
-//
-// You should have received a copy of the GNU General Public License
-// along with Phaistos.  If not, see <http://www.gnu.org/licenses/>.
-//
-
-#ifndef TERM_CHARMM_ANGLE_BEND_ITP_H
-#define TERM_CHARMM_ANGLE_BEND_ITP_H
-
-namespace charmm_constants {
-
-const static std::string angle_bend_itp = ";       i        j        k  func       theta0       ktheta          ub0          kub\n\
-       H      NH2      CT1     5   111.000000   418.400000   0.00000000         0.00\n\
-     NH2      CT1      CT1     5   110.000000   566.513600   0.00000000         0.00\n\
-     NH2      CT1      CT2     5   110.000000   566.513600   0.00000000         0.00\n\
-     NH2      CT1      CT3     5   110.000000   566.513600   0.00000000         0.00\n\
-     CT1       CD      OH1     5   110.500000   460.240000   0.00000000         0.00\n\
-     CT3      CT1       CD     5   108.000000   435.136000   0.00000000         0.00\n\
-     NH2      CT1      HB1     5   109.500000   317.984000   0.21400000     41840.00\n\
-     NH2      CT1        C     5   107.000000   418.400000   0.00000000         0.00\n\
-     CAI      CAI       CA     5   120.000000   334.720000   0.24162000     29288.00\n\
-     CAI       CA       CA     5   120.000000   334.720000   0.24162000     29288.00\n\
-     CPT       CA       CA     5   113.200000   418.400000   0.00000000         0.00\n\
-     CPT      CPT       CA     5   110.000000   418.400000   0.00000000         0.00\n\
-     CPT      CAI       CA     5   113.200000   418.400000   0.00000000         0.00\n\
-     CPT      CPT      CAI     5   110.000000   418.400000   0.00000000         0.00\n\
-     CPT       CY       CA     5   106.400000   711.280000   0.22610000     20920.00\n\
-     CPT       NY       CA     5   112.000000   711.280000   0.00000000         0.00\n\
-     CT2       CY       CA     5   127.000000   251.040000   0.00000000         0.00\n\
-     CT2       CY      CPT     5   126.700000   251.040000   0.00000000         0.00\n\
-     CT3       CY       CA     5   127.000000   251.040000   0.00000000         0.00\n\
-     CT3       CY      CPT     5   126.700000   251.040000   0.00000000         0.00\n\
-      CY      CPT       CA     5   133.500000  1087.840000   0.00000000         0.00\n\
-      CY      CPT      CAI     5   133.500000  1087.840000   0.00000000         0.00\n\
-      CY      CPT      CPT     5   108.000000   711.280000   0.00000000         0.00\n\
-      CY      CT2      CT1     5   114.000000   488.272800   0.00000000         0.00\n\
-      CY      CT2      CT3     5   114.000000   488.272800   0.00000000         0.00\n\
-       H       NY       CA     5   126.000000   234.304000   0.00000000         0.00\n\
-       H       NY      CAI     5   126.000000   234.304000   0.00000000         0.00\n\
-       H       NY      CPT     5   126.000000   234.304000   0.00000000         0.00\n\
-     HA2      CT2       CY     5   109.500000   460.240000   0.00000000         0.00\n\
-     HA3      CT3       CY     5   109.500000   460.240000   0.00000000         0.00\n\
-      HP       CA      CAI     5   120.000000   251.040000   0.21525000     18409.60\n\
-      HP      CAI       CA     5   120.000000   251.040000   0.21525000     18409.60\n\
-      HP       CA      CPT     5   122.000000   251.040000   0.21460000     18409.60\n\
-      HP      CAI      CPT     5   122.000000   251.040000   0.21460000     18409.60\n\
-      HP       CA       CY     5   125.000000   267.776000   0.21730000     20920.00\n\
-      HP       CY       CA     5   126.400000   267.776000   0.21860000     20920.00\n\
-      HP       CY      CPT     5   126.400000   267.776000   0.22550000     20920.00\n\
-      NY       CA       CY     5   110.500000   711.280000   0.22400000     20920.00\n\
-      NY       CA       HP     5   125.000000   267.776000   0.21770000     20920.00\n\
-      NY      CPT       CA     5   129.500000  1087.840000   0.00000000         0.00\n\
-      NY      CPT      CAI     5   129.500000  1087.840000   0.00000000         0.00\n\
-      NY      CPT      CPT     5   107.400000   794.960000   0.00000000         0.00\n\
-      CA       CA       CA     5   120.000000   334.720000   0.24162000     29288.00\n\
-     CE1      CE1      CT2     5   123.500000   401.664000   0.00000000         0.00\n\
-     CE1      CE1      CT3     5   123.500000   401.664000   0.00000000         0.00\n\
-     CE1      CT2      CT3     5   112.200000   267.776000   0.00000000         0.00\n\
-     CE2      CE1      CT2     5   126.000000   401.664000   0.00000000         0.00\n\
-     CE2      CE1      CT3     5   125.200000   393.296000   0.00000000         0.00\n\
-     CP1        N        C     5   117.000000   502.080000   0.00000000         0.00\n\
-     CP2      CP1        C     5   112.300000   435.136000   0.00000000         0.00\n\
-     CP2      CP1       CC     5   112.300000   435.136000   0.00000000         0.00\n\
-     CP2      CP1       CD     5   112.300000   418.400000   0.00000000         0.00\n\
-     CP2      CP2      CP1     5   108.500000   585.760000   0.00000000         0.00\n\
-     CP3      CP2      CP2     5   108.500000   585.760000   0.00000000         0.00\n\
-     CP3        N        C     5   117.000000   502.080000   0.00000000         0.00\n\
-     CP3        N      CP1     5   114.200000   836.800000   0.00000000         0.00\n\
-     CP3       NP      CP1     5   111.000000   836.800000   0.00000000         0.00\n\
-    CPH2      NR1     CPH1     5   107.500000  1087.840000   0.00000000         0.00\n\
-    CPH2      NR2     CPH1     5   104.000000  1087.840000   0.00000000         0.00\n\
-    CPH2      NR3     CPH1     5   108.000000  1213.360000   0.00000000         0.00\n\
-     CT1      CT1        C     5   108.000000   435.136000   0.00000000         0.00\n\
-     CT1      CT1       CC     5   108.000000   435.136000   0.00000000         0.00\n\
-     CT1      CT1       CD     5   108.000000   435.136000   0.00000000         0.00\n\
-     CT1      CT1      CT1     5   111.000000   446.432800   0.25610000      6694.40\n\
-     CT1      CT2       CA     5   107.500000   433.462400   0.00000000         0.00\n\
-     CT1      CT2       CC     5   108.000000   435.136000   0.00000000         0.00\n\
-     CT1      CT2       CD     5   108.000000   435.136000   0.00000000         0.00\n\
-     CT1      CT2     CPH1     5   113.000000   488.272800   0.00000000         0.00\n\
-     CT1      CT2      CT1     5   113.500000   488.272800   0.25610000      9338.69\n\
-     CT1      NH1        C     5   120.000000   418.400000   0.00000000         0.00\n\
-     CT2       CA       CA     5   122.300000   383.254400   0.00000000         0.00\n\
-     CT2     CPH1     CPH1     5   130.000000   383.254400   0.00000000         0.00\n\
-     CT2      CT1        C     5   108.000000   435.136000   0.00000000         0.00\n\
-     CT2      CT1       CC     5   108.000000   435.136000   0.00000000         0.00\n\
-    CT2A      CT1       CC     5   108.000000   435.136000   0.00000000         0.00\n\
-     CT2      CT1       CD     5   108.000000   435.136000   0.00000000         0.00\n\
-     CT2      CT1      CT1     5   111.000000   446.432800   0.25610000      6694.40\n\
-     CT2      CT2        C     5   108.000000   435.136000   0.00000000         0.00\n\
-     CT2      CT2       CC     5   108.000000   435.136000   0.00000000         0.00\n\
-     CT3      CT2       CC     5   108.000000   435.136000   0.00000000         0.00\n\
-     CT2      CT2       CD     5   108.000000   435.136000   0.00000000         0.00\n\
-    CT2A      CT2       CD     5   108.000000   435.136000   0.00000000         0.00\n\
-     CT2      CT2      CT1     5   113.500000   488.272800   0.25610000      9338.69\n\
-     CT2      CT2      CT2     5   113.600000   488.272800   0.25610000      9338.69\n\
-     CT2      CT3      CT1     5   113.500000   488.272800   0.25610000      9338.69\n\
-     CT2      NC2        C     5   120.000000   521.326400   0.00000000         0.00\n\
-     CT2      NH1        C     5   120.000000   418.400000   0.00000000         0.00\n\
-     CT2       OS       CD     5   109.600000   334.720000   0.22651000     25104.00\n\
-     CT3       CA       CA     5   122.300000   383.254400   0.00000000         0.00\n\
-     CT3     CPH1     CPH1     5   130.000000   383.254400   0.00000000         0.00\n\
-     CT3      CT1        C     5   108.000000   435.136000   0.00000000         0.00\n\
-     CT3      CT1       CC     5   108.000000   435.136000   0.00000000         0.00\n\
-     CT3      CT1      CT1     5   108.500000   446.432800   0.25610000      6694.40\n\
-     CT3      CT1      CT2     5   114.000000   446.432800   0.25610000      6694.40\n\
-     CT3      CT1      CT3     5   114.000000   446.432800   0.25610000      6694.40\n\
-     CT3      CT2       CA     5   107.500000   433.462400   0.00000000         0.00\n\
-     CT3      CT2     CPH1     5   113.000000   488.272800   0.00000000         0.00\n\
-     CT3      CT2      CT1     5   113.500000   488.272800   0.25610000      9338.69\n\
-     CT3      CT2      CT2     5   115.000000   485.344000   0.25610000      6694.40\n\
-     CT3      CT2      CT3     5   114.000000   446.432800   0.25610000      6694.40\n\
-     CT3      NC2        C     5   120.000000   521.326400   0.00000000         0.00\n\
-     CT3      NH1        C     5   120.000000   418.400000   0.00000000         0.00\n\
-     CT3       OS       CD     5   109.600000   334.720000   0.22651000     25104.00\n\
-     CT3        S      CT2     5    95.000000   284.512000   0.00000000         0.00\n\
-       H      NH1        C     5   123.000000   284.512000   0.00000000         0.00\n\
-       H      NH1      CT1     5   117.000000   292.880000   0.00000000         0.00\n\
-       H      NH1      CT2     5   117.000000   292.880000   0.00000000         0.00\n\
-       H      NH1      CT3     5   117.000000   292.880000   0.00000000         0.00\n\
-       H      NH2       CC     5   120.000000   418.400000   0.00000000         0.00\n\
-       H      NH2        H     5   120.000000   192.464000   0.00000000         0.00\n\
-       H      NR1     CPH1     5   125.500000   251.040000   0.21500000     16736.00\n\
-       H      NR1     CPH2     5   127.000000   251.040000   0.21400000     16736.00\n\
-       H      NR3     CPH1     5   126.000000   209.200000   0.21300000     12552.00\n\
-       H      NR3     CPH2     5   126.000000   209.200000   0.20900000     12552.00\n\
-       H      OH1       CA     5   108.000000   543.920000   0.00000000         0.00\n\
-       H      OH1       CD     5   115.000000   460.240000   0.00000000         0.00\n\
-       H      OH1      CT1     5   106.000000   481.160000   0.00000000         0.00\n\
-       H      OH1      CT2     5   106.000000   481.160000   0.00000000         0.00\n\
-       H      OH1      CT3     5   106.000000   481.160000   0.00000000         0.00\n\
-     HA2      CP2      CP1     5   110.100000   279.742240   0.21790000     18853.10\n\
-     HA2      CP2      CP2     5   110.100000   221.752000   0.21790000     18853.10\n\
-     HA2      CP2      CP3     5   110.100000   221.752000   0.21790000     18853.10\n\
-     HA2      CP2      HA2     5   109.000000   297.064000   0.18020000      4518.72\n\
-     HA2      CP3      CP2     5   110.100000   221.752000   0.21790000     18853.10\n\
-     HA2      CP3      HA2     5   109.000000   297.064000   0.18020000      4518.72\n\
-     HA2       CS      CT3     5   110.100000   289.532800   0.21790000     18853.10\n\
-     HA2       CS      HA2     5   108.400000   297.064000   0.17750000     11715.20\n\
-     HA3       CS      HA3     5   108.400000   297.064000   0.17750000     11715.20\n\
-     HA1      CT1        C     5   109.500000   276.144000   0.21630000     25104.00\n\
-     HA1      CT1       CD     5   109.500000   276.144000   0.21630000     25104.00\n\
-     HA1      CT1      CT1     5   110.100000   288.696000   0.21790000     18853.10\n\
-     HA1      CT1      CT2     5   110.100000   288.696000   0.21790000     18853.10\n\
-     HA1      CT1      CT3     5   110.100000   288.696000   0.21790000     18853.10\n\
-     HA1      CT1      HA1     5   109.000000   297.064000   0.18020000      4518.72\n\
-     HA2      CT2        C     5   109.500000   276.144000   0.21630000     25104.00\n\
-     HA2      CT2       CA     5   107.500000   412.542400   0.00000000         0.00\n\
-     HA2      CT2       CC     5   109.500000   276.144000   0.21630000     25104.00\n\
-     HA2      CT2       CD     5   109.500000   276.144000   0.21630000     25104.00\n\
-     HA2      CT2      CE1     5   111.500000   376.560000   0.00000000         0.00\n\
-     HA2      CT2     CPH1     5   109.500000   279.742240   0.00000000         0.00\n\
-     HA2      CT2      CT1     5   110.100000   221.752000   0.21790000     18853.10\n\
-     HA2      CT2      CT2     5   110.100000   221.752000   0.21790000     18853.10\n\
-     HA2      CT2      CT3     5   110.100000   289.532800   0.21790000     18853.10\n\
-     HA2      CT2      HA2     5   109.000000   297.064000   0.18020000      4518.72\n\
-     HA3      CT3        C     5   109.500000   276.144000   0.21630000     25104.00\n\
-     HA3      CT3       CA     5   107.500000   412.542400   0.00000000         0.00\n\
-     HA3      CT3       CC     5   109.500000   276.144000   0.21630000     25104.00\n\
-     HA3      CT3       CD     5   109.500000   276.144000   0.21630000     25104.00\n\
-     HA3      CT3      CE1     5   111.500000   351.456000   0.00000000         0.00\n\
-     HA3      CT3     CPH1     5   109.500000   279.742240   0.00000000         0.00\n\
-     HA3      CT3       CS     5   110.100000   289.532800   0.21790000     18853.10\n\
-     HA3      CT3      CT1     5   110.100000   279.742240   0.21790000     18853.10\n\
-     HA3      CT3      CT2     5   110.100000   289.532800   0.21790000     18853.10\n\
-     HA3      CT3      CT3     5   110.100000   313.800000   0.21790000     18853.10\n\
-     HA3      CT3      HA3     5   108.400000   297.064000   0.18020000      4518.72\n\
-     HE1      CE1      CE1     5   119.500000   435.136000   0.00000000         0.00\n\
-     HE1      CE1      CE2     5   118.000000   351.456000   0.00000000         0.00\n\
-     HE1      CE1      CT2     5   116.000000   334.720000   0.00000000         0.00\n\
-     HE1      CE1      CT3     5   117.000000   184.096000   0.00000000         0.00\n\
-     HE2      CE2      CE1     5   120.500000   376.560000   0.00000000         0.00\n\
-     HE2      CE2      CE2     5   120.500000   464.424000   0.00000000         0.00\n\
-     HE2      CE2      HE2     5   119.000000   158.992000   0.00000000         0.00\n\
-     HB1      CP1        C     5   112.000000   418.400000   0.00000000         0.00\n\
-     HB1      CP1       CC     5   112.000000   418.400000   0.00000000         0.00\n\
-     HB1      CP1       CD     5   112.000000   418.400000   0.00000000         0.00\n\
-     HB1      CP1      CP2     5   118.000000   292.880000   0.00000000         0.00\n\
-     HB1      CT1        C     5   109.500000   418.400000   0.00000000         0.00\n\
-     HB1      CT1       CC     5   109.500000   418.400000   0.00000000         0.00\n\
-     HB1      CT1       CD     5   109.500000   418.400000   0.00000000         0.00\n\
-     HB1      CT1      CT1     5   111.000000   292.880000   0.00000000         0.00\n\
-     HB1      CT1      CT2     5   111.000000   292.880000   0.00000000         0.00\n\
-     HB1      CT1      CT3     5   111.000000   292.880000   0.00000000         0.00\n\
-     HB2      CT2        C     5   109.500000   418.400000   0.00000000         0.00\n\
-     HB2      CT2       CC     5   109.500000   418.400000   0.00000000         0.00\n\
-     HB2      CT2       CD     5   109.500000   418.400000   0.00000000         0.00\n\
-     HB2      CT2      HB2     5   115.000000   301.248000   0.00000000         0.00\n\
-      HC      NC2        C     5   120.000000   410.032000   0.00000000         0.00\n\
-      HC      NC2      CT2     5   120.000000   338.067200   0.00000000         0.00\n\
-      HC      NC2      CT3     5   120.000000   338.067200   0.00000000         0.00\n\
-      HC      NC2       HC     5   120.000000   209.200000   0.00000000         0.00\n\
-      HC      NH2      CT2     5   111.000000   418.400000   0.00000000         0.00\n\
-      HC      NH2      CT3     5   111.000000   418.400000   0.00000000         0.00\n\
-      HC      NH2       HC     5   106.500000   326.352000   0.00000000         0.00\n\
-      HC      NH3      CT1     5   109.500000   251.040000   0.20740000     16736.00\n\
-      HC      NH3      CT2     5   109.500000   251.040000   0.20740000     16736.00\n\
-      HC      NH3      CT3     5   109.500000   251.040000   0.20740000     16736.00\n\
-      HC      NH3       HC     5   109.500000   368.192000   0.00000000         0.00\n\
-      HC       NP      CP1     5   109.500000   276.144000   0.20560000      3347.20\n\
-      HC       NP      CP3     5   109.500000   276.144000   0.20560000      3347.20\n\
-      HC       NP       HC     5   107.500000   426.768000   0.00000000         0.00\n\
-      HP       CA       CA     5   120.000000   251.040000   0.21525000     18409.60\n\
-     HR1     CPH1     CPH1     5   130.000000   184.096000   0.22150000     12552.00\n\
-     HR3     CPH1     CPH1     5   130.000000   209.200000   0.22000000     16736.00\n\
-      HS        S      CT2     5    95.000000   324.678400   0.00000000         0.00\n\
-      HS        S      CT3     5    95.000000   359.824000   0.00000000         0.00\n\
-       N        C      CP1     5   112.500000   167.360000   0.00000000         0.00\n\
-       N        C      CT1     5   112.500000   167.360000   0.00000000         0.00\n\
-       N        C      CT2     5   112.500000   167.360000   0.00000000         0.00\n\
-       N        C      CT3     5   112.500000   167.360000   0.00000000         0.00\n\
-       N      CP1        C     5   108.200000   418.400000   0.00000000         0.00\n\
-       N      CP1       CC     5   108.200000   418.400000   0.00000000         0.00\n\
-       N      CP1       CD     5   108.200000   418.400000   0.00000000         0.00\n\
-       N      CP1      CP2     5   110.800000   585.760000   0.00000000         0.00\n\
-       N      CP1      HB1     5   112.000000   401.664000   0.00000000         0.00\n\
-       N      CP3      CP2     5   110.500000   585.760000   0.00000000         0.00\n\
-       N      CP3      HA2     5   108.000000   401.664000   0.00000000         0.00\n\
-     NC2        C      NC2     5   120.000000   334.720000   0.23100000     58576.00\n\
-     NC2      CT2      CT2     5   107.500000   566.513600   0.00000000         0.00\n\
-     NC2      CT2      HA2     5   107.500000   472.792000   0.00000000         0.00\n\
-     NC2      CT3      HA3     5   107.500000   472.792000   0.00000000         0.00\n\
-     NH1        C      CP1     5   116.500000   669.440000   0.00000000         0.00\n\
-     NH1        C      CT1     5   116.500000   669.440000   0.00000000         0.00\n\
-     NH1        C      CT2     5   116.500000   669.440000   0.00000000         0.00\n\
-     NH1        C      CT3     5   116.500000   669.440000   0.00000000         0.00\n\
-     NH1      CT1        C     5   107.000000   418.400000   0.00000000         0.00\n\
-     NH1      CT1       CC     5   107.000000   418.400000   0.00000000         0.00\n\
-     NH1      CT1       CD     5   107.000000   418.400000   0.00000000         0.00\n\
-     NH1      CT1      CT1     5   113.500000   585.760000   0.00000000         0.00\n\
-     NH1      CT1      CT2     5   113.500000   585.760000   0.00000000         0.00\n\
-     NH1      CT1      CT3     5   113.500000   585.760000   0.00000000         0.00\n\
-     NH1      CT1      HB1     5   108.000000   401.664000   0.00000000         0.00\n\
-     NH1      CT2        C     5   107.000000   418.400000   0.00000000         0.00\n\
-     NH1      CT2       CC     5   107.000000   418.400000   0.00000000         0.00\n\
-     NH1      CT2       CD     5   107.000000   418.400000   0.00000000         0.00\n\
-     NH1      CT2      CT2     5   113.500000   585.760000   0.00000000         0.00\n\
-     NH1      CT2      HA2     5   109.500000   430.952000   0.00000000         0.00\n\
-     NH1      CT2      HB2     5   108.000000   401.664000   0.00000000         0.00\n\
-     NH1      CT3      HA3     5   109.500000   430.952000   0.00000000         0.00\n\
-     NH2       CC      CP1     5   112.500000   669.440000   0.00000000         0.00\n\
-     NH2       CC      CT1     5   116.500000   418.400000   0.24500000     41840.00\n\
-     NH2       CC      CT2     5   116.500000   418.400000   0.24500000     41840.00\n\
-     NH2       CC      CT3     5   116.500000   418.400000   0.24500000     41840.00\n\
-     NH2       CC      HA1     5   111.000000   368.192000   0.19800000     41840.00\n\
-     NH2      CT2      HB2     5   109.500000   317.984000   0.21400000     41840.00\n\
-     NH2      CT2       CD     5   108.000000   435.136000   0.00000000         0.00\n\
-     NH2      CT2      CT2     5   110.000000   566.513600   0.00000000         0.00\n\
-     NH2      CT2      HA2     5   109.500000   317.984000   0.21400000     41840.00\n\
-     NH2      CT3      HA3     5   109.500000   317.984000   0.21400000     41840.00\n\
-     NH3      CT1        C     5   110.000000   365.681600   0.00000000         0.00\n\
-     NH3      CT1       CC     5   110.000000   365.681600   0.00000000         0.00\n\
-     NH3      CT1      CT1     5   110.000000   566.513600   0.00000000         0.00\n\
-     NH3      CT1      CT2     5   110.000000   566.513600   0.00000000         0.00\n\
-     NH3      CT1      CT3     5   110.000000   566.513600   0.00000000         0.00\n\
-     NH3      CT1      HB1     5   107.500000   430.952000   0.00000000         0.00\n\
-     NH3      CT2        C     5   110.000000   365.681600   0.00000000         0.00\n\
-     NH3      CT2       CC     5   110.000000   365.681600   0.00000000         0.00\n\
-     NH3      CT2       CD     5   110.000000   365.681600   0.00000000         0.00\n\
-     NH3      CT2      CT2     5   110.000000   566.513600   0.00000000         0.00\n\
-     NH3      CT2      CT3     5   110.000000   566.513600   0.00000000         0.00\n\
-     NH3      CT2      HA2     5   107.500000   376.560000   0.21010000     29288.00\n\
-     NH3      CT2      HB2     5   107.500000   430.952000   0.00000000         0.00\n\
-     NH3      CT3      HA3     5   107.500000   376.560000   0.21010000     29288.00\n\
-      NP      CP1        C     5   106.000000   418.400000   0.00000000         0.00\n\
-      NP      CP1       CC     5   106.000000   418.400000   0.00000000         0.00\n\
-      NP      CP1       CD     5   106.000000   418.400000   0.00000000         0.00\n\
-      NP      CP1      CP2     5   108.500000   585.760000   0.00000000         0.00\n\
-      NP      CP1      HB1     5   107.500000   430.952000   0.00000000         0.00\n\
-      NP      CP3      CP2     5   108.500000   585.760000   0.00000000         0.00\n\
-      NP      CP3      HA2     5   109.150000   430.952000   0.00000000         0.00\n\
-     NR1     CPH1     CPH1     5   106.000000  1087.840000   0.00000000         0.00\n\
-     NR1     CPH1      CT2     5   124.000000   383.254400   0.00000000         0.00\n\
-     NR1     CPH1      CT3     5   124.000000   383.254400   0.00000000         0.00\n\
-     NR1     CPH1      HR3     5   124.000000   209.200000   0.21400000     16736.00\n\
-     NR1     CPH2      HR1     5   122.500000   209.200000   0.21400000     16736.00\n\
-     NR2     CPH1     CPH1     5   110.000000  1087.840000   0.00000000         0.00\n\
-     NR2     CPH1      CT2     5   120.000000   383.254400   0.00000000         0.00\n\
-     NR2     CPH1      HR3     5   120.000000   209.200000   0.21400000     16736.00\n\
-     NR2     CPH2      HR1     5   125.000000   209.200000   0.21200000     16736.00\n\
-     NR2     CPH2      NR1     5   112.500000  1087.840000   0.00000000         0.00\n\
-     NR3     CPH1     CPH1     5   108.000000  1213.360000   0.00000000         0.00\n\
-     NR3     CPH1      CT2     5   122.000000   383.254400   0.00000000         0.00\n\
-     NR3     CPH1      HR1     5   122.000000   184.096000   0.21800000     12552.00\n\
-     NR3     CPH2      HR2     5   126.000000   267.776000   0.21400000     20920.00\n\
-     NR3     CPH2      NR3     5   108.000000  1213.360000   0.00000000         0.00\n\
-       O        C      CP1     5   118.000000   669.440000   0.00000000         0.00\n\
-       O        C      CT1     5   121.000000   669.440000   0.00000000         0.00\n\
-       O        C      CT2     5   121.000000   669.440000   0.00000000         0.00\n\
-       O        C      CT3     5   121.000000   669.440000   0.00000000         0.00\n\
-       O        C        H     5   121.700000   418.400000   0.00000000         0.00\n\
-       O        C        N     5   122.500000   669.440000   0.00000000         0.00\n\
-       O        C      NH1     5   122.500000   669.440000   0.00000000         0.00\n\
-       O       CC      CP1     5   118.000000   669.440000   0.00000000         0.00\n\
-       O       CC      CT1     5   121.000000   125.520000   0.24400000     41840.00\n\
-       O       CC      CT2     5   121.000000   125.520000   0.24400000     41840.00\n\
-       O       CC      CT3     5   121.000000   125.520000   0.24400000     41840.00\n\
-       O       CC      HA1     5   122.000000   368.192000   0.00000000         0.00\n\
-       O       CC      NH2     5   122.500000   627.600000   0.23700000     41840.00\n\
-      OB       CD      CP1     5   125.000000   585.760000   0.24420000     16736.00\n\
-      OB       CD      CT1     5   125.000000   585.760000   0.24420000     16736.00\n\
-      OB       CD      CT2     5   125.000000   585.760000   0.24420000     16736.00\n\
-      OB       CD      CT3     5   125.000000   585.760000   0.24420000     16736.00\n\
-      OC       CA       CA     5   120.000000   334.720000   0.00000000         0.00\n\
-      OC       CC      CP1     5   118.000000   334.720000   0.23880000     41840.00\n\
-      OC       CC      CT1     5   118.000000   334.720000   0.23880000     41840.00\n\
-      OC       CC      CT2     5   118.000000   334.720000   0.23880000     41840.00\n\
-      OC       CC      CT3     5   118.000000   334.720000   0.23880000     41840.00\n\
-      OC       CC       OC     5   124.000000   836.800000   0.22250000     58576.00\n\
-      OC      CT2      CT3     5   122.000000   543.920000   0.00000000         0.00\n\
-      OC      CT2      HA2     5   118.300000   543.920000   0.00000000         0.00\n\
-      OC      CT3      HA3     5   118.300000   543.920000   0.00000000         0.00\n\
-     OH1       CA       CA     5   120.000000   378.233600   0.00000000         0.00\n\
-     OH1       CD      CT2     5   110.500000   460.240000   0.00000000         0.00\n\
-     OH1       CD      CT3     5   110.500000   460.240000   0.00000000         0.00\n\
-     OH1       CD       OB     5   123.000000   418.400000   0.22620000    175728.00\n\
-     OH1      CT1      CT1     5   110.100000   633.457600   0.00000000         0.00\n\
-     OH1      CT1      CT3     5   110.100000   633.457600   0.00000000         0.00\n\
-     OH1      CT1      HA1     5   108.890000   384.091200   0.00000000         0.00\n\
-     OH1      CT2      CT1     5   110.100000   633.457600   0.00000000         0.00\n\
-     OH1      CT2      CT2     5   110.100000   633.457600   0.00000000         0.00\n\
-     OH1      CT2      CT3     5   110.100000   633.457600   0.00000000         0.00\n\
-     OH1      CT2      HA2     5   108.890000   384.091200   0.00000000         0.00\n\
-     OH1      CT3      HA3     5   108.890000   384.091200   0.00000000         0.00\n\
-      OS       CD      CP1     5   109.000000   460.240000   0.23260000     16736.00\n\
-      OS       CD      CT1     5   109.000000   460.240000   0.23260000     16736.00\n\
-      OS       CD      CT2     5   109.000000   460.240000   0.23260000     16736.00\n\
-      OS       CD      CT3     5   109.000000   460.240000   0.23260000     16736.00\n\
-      OS       CD       OB     5   125.900000   753.120000   0.22576000    133888.00\n\
-      OS      CT2      HA2     5   109.500000   502.080000   0.00000000         0.00\n\
-      OS      CT3      HA3     5   109.500000   502.080000   0.00000000         0.00\n\
-       S      CT2      CT1     5   112.500000   485.344000   0.00000000         0.00\n\
-       S      CT2      CT2     5   114.500000   485.344000   0.00000000         0.00\n\
-       S      CT2      CT3     5   114.500000   485.344000   0.00000000         0.00\n\
-       S      CT2      HA2     5   111.300000   385.764800   0.00000000         0.00\n\
-       S      CT3      HA3     5   111.300000   385.764800   0.00000000         0.00\n\
-      SM      CT2      CT1     5   112.500000   485.344000   0.00000000         0.00\n\
-      SM      CT2      CT3     5   112.500000   485.344000   0.00000000         0.00\n\
-      SM      CT2      HA2     5   111.000000   317.984000   0.00000000         0.00\n\
-      SM      CT3      HA3     5   111.000000   317.984000   0.00000000         0.00\n\
-      SM       SM      CT2     5   103.300000   606.680000   0.00000000         0.00\n\
-      SM       SM      CT3     5   103.300000   606.680000   0.00000000         0.00\n\
-      SS       CS      CT3     5   118.000000   460.240000   0.00000000         0.00\n\
-      SS       CS      HA2     5   112.300000   334.720000   0.00000000         0.00\n\
-      SS       CS      HA3     5   112.300000   334.720000   0.00000000         0.00\n\
-       O       CD      HR1     5   121.000000   627.600000   0.00000000         0.00\n\
-     NH1      CT1     CT2A     5   113.500000   585.760000   0.00000000         0.00\n\
-     HB1      CT1     CT2A     5   111.000000   292.880000   0.00000000         0.00\n\
-    CT2A      CT1        C     5   108.000000   435.136000   0.00000000         0.00\n\
-     CT1     CT2A      HA2     5   110.100000   221.752000   0.21790000     18853.10\n\
-     CT1     CT2A      CT2     5   113.500000   488.272800   0.25610000      9338.69\n\
-     HA2     CT2A      HA2     5   109.000000   297.064000   0.18020000      4518.72\n\
-     HA2     CT2A      CT2     5   110.100000   221.752000   0.21790000     18853.10\n\
-    CT2A      CT2      HA2     5   110.100000   221.752000   0.21790000     18853.10\n\
-    CT2A      CT2       CC     5   108.000000   435.136000   0.00000000         0.00\n\
-     CT1     CT2A     CPH1     5   113.000000   488.272800   0.00000000         0.00\n\
-     HA2     CT2A     CPH1     5   109.500000   279.742240   0.00000000         0.00\n\
-    CT2A     CPH1     CPH1     5   130.000000   383.254400   0.00000000         0.00\n\
-    CT2A     CPH1      NR3     5   122.000000   383.254400   0.00000000         0.00\n\
-     CT1     CT2A       CC     5   108.000000   435.136000   0.00000000         0.00\n\
-     HA2     CT2A       CC     5   109.500000   276.144000   0.21630000     25104.00\n\
-      OC       CC     CT2A     5   118.000000   334.720000   0.23880000     41840.00\n\
-     NH3      CT1     CT2A     5   110.000000   566.513600   0.00000000         0.00\n\
-    CT2A      CT1       CD     5   108.000000   435.136000   0.00000000         0.00\n\
-      HT       OT       HT     5   104.520000   460.240000   0.00000000         0.00\n\
-  CG2R61    CG1N1    NG1T1     5   180.000000   334.720000   0.00000000         0.00\n\
-   CG331    CG1N1    NG1T1     5   180.000000   177.401600   0.00000000         0.00\n\
-   CG1T1    CG1T1    CG331     5   180.000000   158.992000   0.00000000         0.00\n\
-  CG25C1   CG251O   CG2R53     5   125.000000   334.720000   0.00000000         0.00\n\
-  CG25C1   CG251O   NG2R53     5   124.000000   334.720000   0.00000000         0.00\n\
-  CG25C1   CG251O    SG311     5   124.000000   334.720000   0.00000000         0.00\n\
-  CG2DC3   CG251O   CG2R53     5   119.000000   334.720000   0.00000000         0.00\n\
-  CG2DC3   CG251O   NG2R53     5   130.000000   334.720000   0.00000000         0.00\n\
-  CG2DC3   CG251O    SG311     5   130.000000   334.720000   0.00000000         0.00\n\
-  CG2R53   CG251O   NG2R53     5   111.000000   970.688000   0.00000000         0.00\n\
-  CG2R53   CG251O    SG311     5   111.000000   920.480000   0.00000000         0.00\n\
-  CG25C2   CG252O   CG2R53     5   125.000000   334.720000   0.00000000         0.00\n\
-  CG25C2   CG252O   NG2R53     5   124.000000   334.720000   0.00000000         0.00\n\
-  CG25C2   CG252O    SG311     5   124.000000   334.720000   0.00000000         0.00\n\
-  CG2DC3   CG252O   CG2R53     5   119.000000   334.720000   0.00000000         0.00\n\
-  CG2DC3   CG252O   NG2R53     5   130.000000   334.720000   0.00000000         0.00\n\
-  CG2DC3   CG252O    SG311     5   130.000000   334.720000   0.00000000         0.00\n\
-  CG2R53   CG252O   NG2R53     5   111.000000   970.688000   0.00000000         0.00\n\
-  CG2R53   CG252O    SG311     5   111.000000   920.480000   0.00000000         0.00\n\
-  CG251O   CG25C1   CG2R53     5   113.000000   276.144000   0.00000000         0.00\n\
-  CG251O   CG25C1   CG2RC0     5   131.500000   276.144000   0.00000000         0.00\n\
-  CG2DC3   CG25C1   CG2R53     5   115.500000   276.144000   0.00000000         0.00\n\
-  CG2DC3   CG25C1   CG2RC0     5   130.000000   276.144000   0.00000000         0.00\n\
-  CG2R53   CG25C1   CG2RC0     5   114.500000   376.560000   0.00000000         0.00\n\
-  CG252O   CG25C2   CG2R53     5   113.000000   276.144000   0.00000000         0.00\n\
-  CG252O   CG25C2   CG2RC0     5   131.500000   276.144000   0.00000000         0.00\n\
-  CG2DC3   CG25C2   CG2R53     5   115.500000   276.144000   0.00000000         0.00\n\
-  CG2DC3   CG25C2   CG2RC0     5   130.000000   276.144000   0.00000000         0.00\n\
-  CG2R53   CG25C2   CG2RC0     5   114.500000   376.560000   0.00000000         0.00\n\
-   CG2D1    CG2D1    CG301     5   123.500000   401.664000   0.00000000         0.00\n\
-   CG2D1    CG2D1    CG321     5   123.500000   401.664000   0.00000000         0.00\n\
-   CG2D1    CG2D1    CG331     5   123.500000   401.664000   0.00000000         0.00\n\
-   CG2D1    CG2D1     HGA4     5   119.500000   435.136000   0.00000000         0.00\n\
-  CG2D1O    CG2D1    CG321     5   127.500000   334.720000   0.00000000         0.00\n\
-  CG2D1O    CG2D1     HGA4     5   119.500000   435.136000   0.00000000         0.00\n\
-   CG2D2    CG2D1    CG321     5   126.000000   401.664000   0.00000000         0.00\n\
-   CG2D2    CG2D1    CG331     5   125.200000   393.296000   0.00000000         0.00\n\
-   CG2D2    CG2D1     HGA4     5   118.000000   351.456000   0.00000000         0.00\n\
-  CG2D2O    CG2D1    CG321     5   127.500000   334.720000   0.00000000         0.00\n\
-  CG2D2O    CG2D1     HGA4     5   119.500000   435.136000   0.00000000         0.00\n\
-   CG301    CG2D1    CG321     5   113.000000   418.400000   0.00000000         0.00\n\
-   CG301    CG2D1    CG331     5   123.500000   401.664000   0.00000000         0.00\n\
-   CG321    CG2D1    CG331     5   123.500000   401.664000   0.00000000         0.00\n\
-   CG321    CG2D1     HGA4     5   116.000000   334.720000   0.00000000         0.00\n\
-   CG331    CG2D1    NG2D1     5   123.000000   669.440000   0.00000000         0.00\n\
-   CG331    CG2D1    NG2P1     5   125.600000   393.296000   0.00000000         0.00\n\
-   CG331    CG2D1     HGA4     5   117.000000   184.096000   0.00000000         0.00\n\
-   CG331    CG2D1    HGR52     5   120.400000   351.456000   0.00000000         0.00\n\
-   NG2D1    CG2D1     HGA4     5   119.500000   410.032000   0.00000000         0.00\n\
-   NG2P1    CG2D1    HGR52     5   114.000000   326.352000   0.00000000         0.00\n\
-   CG2D1   CG2D1O    NG301     5   122.000000   502.080000   0.00000000         0.00\n\
-   CG2D1   CG2D1O    NG311     5   122.000000   502.080000   0.00000000         0.00\n\
-   CG2D1   CG2D1O   OG3R60     5   126.000000   334.720000   0.00000000         0.00\n\
-   CG2D1   CG2D1O     HGA4     5   122.000000   435.136000   0.00000000         0.00\n\
-   CG2D2   CG2D1O    NG321     5   128.000000   669.440000   0.00000000         0.00\n\
-   CG2D2   CG2D1O    OG301     5   123.500000   543.920000   0.00000000         0.00\n\
-   CG2D2   CG2D1O     HGA4     5   121.000000   368.192000   0.00000000         0.00\n\
-  CG2DC1   CG2D1O    NG301     5   122.000000   502.080000   0.00000000         0.00\n\
-  CG2DC1   CG2D1O    NG311     5   122.000000   502.080000   0.00000000         0.00\n\
-  CG2DC1   CG2D1O    OG301     5   124.500000   468.608000   0.00000000         0.00\n\
-  CG2DC1   CG2D1O   OG3R60     5   128.000000   334.720000   0.00000000         0.00\n\
-  CG2DC1   CG2D1O     HGA4     5   120.000000   351.456000   0.00000000         0.00\n\
-   NG301   CG2D1O     HGA4     5   119.000000   351.456000   0.00000000         0.00\n\
-   NG311   CG2D1O     HGA4     5   119.000000   351.456000   0.00000000         0.00\n\
-   NG321   CG2D1O     HGA4     5   113.000000   251.040000   0.00000000         0.00\n\
-   OG301   CG2D1O     HGA4     5   115.500000   251.040000   0.00000000         0.00\n\
-  OG3R60   CG2D1O     HGA4     5   112.000000   251.040000   0.00000000         0.00\n\
-   CG2D1    CG2D2     HGA5     5   120.500000   376.560000   0.00000000         0.00\n\
-  CG2D1O    CG2D2     HGA5     5   120.500000   292.880000   0.00000000         0.00\n\
-   CG2D2    CG2D2     HGA5     5   120.500000   464.424000   0.00000000         0.00\n\
-  CG2D2O    CG2D2     HGA5     5   120.500000   292.880000   0.00000000         0.00\n\
-    HGA5    CG2D2     HGA5     5   119.000000   158.992000   0.00000000         0.00\n\
-   CG2D1   CG2D2O    NG301     5   122.000000   502.080000   0.00000000         0.00\n\
-   CG2D1   CG2D2O    NG311     5   122.000000   502.080000   0.00000000         0.00\n\
-   CG2D1   CG2D2O   OG3R60     5   126.000000   334.720000   0.00000000         0.00\n\
-   CG2D1   CG2D2O     HGA4     5   122.000000   435.136000   0.00000000         0.00\n\
-   CG2D2   CG2D2O    NG321     5   128.000000   669.440000   0.00000000         0.00\n\
-   CG2D2   CG2D2O    OG301     5   123.500000   543.920000   0.00000000         0.00\n\
-   CG2D2   CG2D2O     HGA4     5   121.000000   368.192000   0.00000000         0.00\n\
-  CG2DC2   CG2D2O    NG301     5   122.000000   502.080000   0.00000000         0.00\n\
-  CG2DC2   CG2D2O    NG311     5   122.000000   502.080000   0.00000000         0.00\n\
-  CG2DC2   CG2D2O    OG301     5   124.500000   468.608000   0.00000000         0.00\n\
-  CG2DC2   CG2D2O   OG3R60     5   128.000000   334.720000   0.00000000         0.00\n\
-  CG2DC2   CG2D2O     HGA4     5   120.000000   351.456000   0.00000000         0.00\n\
-   NG301   CG2D2O     HGA4     5   119.000000   351.456000   0.00000000         0.00\n\
-   NG311   CG2D2O     HGA4     5   119.000000   351.456000   0.00000000         0.00\n\
-   NG321   CG2D2O     HGA4     5   113.000000   251.040000   0.00000000         0.00\n\
-   OG301   CG2D2O     HGA4     5   115.500000   251.040000   0.00000000         0.00\n\
-  OG3R60   CG2D2O     HGA4     5   112.000000   251.040000   0.00000000         0.00\n\
-  CG2D1O   CG2DC1   CG2DC2     5   120.000000   401.664000   0.00000000         0.00\n\
-  CG2D1O   CG2DC1    CG2O1     5   113.000000   543.920000   0.00000000         0.00\n\
-  CG2D1O   CG2DC1    CG321     5   126.500000   364.008000   0.00000000         0.00\n\
-  CG2D1O   CG2DC1     HGA4     5   122.000000   351.456000   0.00000000         0.00\n\
-  CG2DC1   CG2DC1   CG2DC2     5   123.000000   401.664000   0.00000000         0.00\n\
-  CG2DC1   CG2DC1    CG2O1     5   123.500000   401.664000   0.00000000         0.00\n\
-  CG2DC1   CG2DC1    CG2O3     5   123.500000   401.664000   0.00000000         0.00\n\
-  CG2DC1   CG2DC1    CG2O4     5   120.000000   502.080000   0.00000000         0.00\n\
-  CG2DC1   CG2DC1    CG301     5   123.500000   401.664000   0.00000000         0.00\n\
-  CG2DC1   CG2DC1    CG321     5   123.500000   401.664000   0.00000000         0.00\n\
-  CG2DC1   CG2DC1    CG331     5   123.500000   401.664000   0.00000000         0.00\n\
-  CG2DC1   CG2DC1     HGA4     5   119.000000   351.456000   0.00000000         0.00\n\
-  CG2DC2   CG2DC1   CG2DC3     5   123.500000   401.664000   0.00000000         0.00\n\
-  CG2DC2   CG2DC1    CG301     5   123.500000   401.664000   0.00000000         0.00\n\
-  CG2DC2   CG2DC1    CG331     5   113.000000   401.664000   0.00000000         0.00\n\
-  CG2DC2   CG2DC1    NG2P1     5   125.600000   334.720000   0.00000000         0.00\n\
-  CG2DC2   CG2DC1     HGA4     5   118.000000   351.456000   0.00000000         0.00\n\
-  CG2DC2   CG2DC1    HGR52     5   120.400000   351.456000   0.00000000         0.00\n\
-  CG2DC3   CG2DC1    CG2O3     5   119.000000   334.720000   0.25267000     29288.00\n\
-  CG2DC3   CG2DC1    CG2O4     5   120.000000   502.080000   0.00000000         0.00\n\
-  CG2DC3   CG2DC1    CG2O5     5   118.600000   292.880000   0.00000000         0.00\n\
-  CG2DC3   CG2DC1   CG2R61     5   122.000000   242.672000   0.00000000         0.00\n\
-  CG2DC3   CG2DC1    CG331     5   123.500000   401.664000   0.00000000         0.00\n\
-  CG2DC3   CG2DC1     HGA4     5   118.000000   351.456000   0.00000000         0.00\n\
-   CG2O1   CG2DC1    CG321     5   123.500000   543.920000   0.00000000         0.00\n\
-   CG2O1   CG2DC1     HGA4     5   119.500000   435.136000   0.00000000         0.00\n\
-   CG2O3   CG2DC1     HGA4     5   119.500000   435.136000   0.00000000         0.00\n\
-   CG2O4   CG2DC1     HGA4     5   122.000000   267.776000   0.00000000         0.00\n\
-   CG2O5   CG2DC1     HGA4     5   123.400000   267.776000   0.00000000         0.00\n\
-  CG2R61   CG2DC1    NG2D1     5   117.000000   468.608000   0.00000000         0.00\n\
-  CG2R61   CG2DC1     HGA4     5   120.000000   267.776000   0.00000000         0.00\n\
-   CG321   CG2DC1    CG331     5   123.500000   401.664000   0.00000000         0.00\n\
-   CG321   CG2DC1     HGA4     5   116.000000   334.720000   0.00000000         0.00\n\
-   CG331   CG2DC1    CG331     5   113.000000   393.296000   0.00000000         0.00\n\
-   CG331   CG2DC1     HGA4     5   117.500000   351.456000   0.00000000         0.00\n\
-   NG2D1   CG2DC1     HGA4     5   123.000000   317.984000   0.00000000         0.00\n\
-   NG2P1   CG2DC1    HGR52     5   114.000000   317.984000   0.00000000         0.00\n\
-  CG2D2O   CG2DC2   CG2DC1     5   120.000000   401.664000   0.00000000         0.00\n\
-  CG2D2O   CG2DC2    CG2O1     5   113.000000   543.920000   0.00000000         0.00\n\
-  CG2D2O   CG2DC2    CG321     5   126.500000   364.008000   0.00000000         0.00\n\
-  CG2D2O   CG2DC2     HGA4     5   122.000000   351.456000   0.00000000         0.00\n\
-  CG2DC1   CG2DC2   CG2DC2     5   123.000000   401.664000   0.00000000         0.00\n\
-  CG2DC1   CG2DC2   CG2DC3     5   123.500000   401.664000   0.00000000         0.00\n\
-  CG2DC1   CG2DC2    CG301     5   123.500000   401.664000   0.00000000         0.00\n\
-  CG2DC1   CG2DC2    CG331     5   113.000000   401.664000   0.00000000         0.00\n\
-  CG2DC1   CG2DC2    NG2P1     5   125.600000   334.720000   0.00000000         0.00\n\
-  CG2DC1   CG2DC2     HGA4     5   118.000000   351.456000   0.00000000         0.00\n\
-  CG2DC1   CG2DC2    HGR52     5   120.400000   351.456000   0.00000000         0.00\n\
-  CG2DC2   CG2DC2    CG2O1     5   123.500000   401.664000   0.00000000         0.00\n\
-  CG2DC2   CG2DC2    CG2O3     5   123.500000   401.664000   0.00000000         0.00\n\
-  CG2DC2   CG2DC2    CG2O4     5   120.000000   502.080000   0.00000000         0.00\n\
-  CG2DC2   CG2DC2    CG301     5   123.500000   401.664000   0.00000000         0.00\n\
-  CG2DC2   CG2DC2    CG321     5   123.500000   401.664000   0.00000000         0.00\n\
-  CG2DC2   CG2DC2    CG331     5   123.500000   401.664000   0.00000000         0.00\n\
-  CG2DC2   CG2DC2     HGA4     5   119.000000   351.456000   0.00000000         0.00\n\
-  CG2DC3   CG2DC2    CG2O3     5   119.000000   334.720000   0.25267000     29288.00\n\
-  CG2DC3   CG2DC2    CG2O4     5   120.000000   502.080000   0.00000000         0.00\n\
-  CG2DC3   CG2DC2    CG2O5     5   118.600000   292.880000   0.00000000         0.00\n\
-  CG2DC3   CG2DC2   CG2R61     5   122.000000   242.672000   0.00000000         0.00\n\
-  CG2DC3   CG2DC2    CG331     5   123.500000   401.664000   0.00000000         0.00\n\
-  CG2DC3   CG2DC2     HGA4     5   118.000000   351.456000   0.00000000         0.00\n\
-   CG2O1   CG2DC2    CG321     5   123.500000   543.920000   0.00000000         0.00\n\
-   CG2O1   CG2DC2     HGA4     5   119.500000   435.136000   0.00000000         0.00\n\
-   CG2O3   CG2DC2     HGA4     5   119.500000   435.136000   0.00000000         0.00\n\
-   CG2O4   CG2DC2     HGA4     5   122.000000   267.776000   0.00000000         0.00\n\
-   CG2O5   CG2DC2     HGA4     5   123.400000   267.776000   0.00000000         0.00\n\
-  CG2R61   CG2DC2    NG2D1     5   117.000000   468.608000   0.00000000         0.00\n\
-  CG2R61   CG2DC2     HGA4     5   120.000000   267.776000   0.00000000         0.00\n\
-   CG321   CG2DC2    CG331     5   123.500000   401.664000   0.00000000         0.00\n\
-   CG321   CG2DC2     HGA4     5   116.000000   334.720000   0.00000000         0.00\n\
-   CG331   CG2DC2    CG331     5   113.000000   393.296000   0.00000000         0.00\n\
-   CG331   CG2DC2     HGA4     5   117.500000   351.456000   0.00000000         0.00\n\
-   NG2D1   CG2DC2     HGA4     5   123.000000   317.984000   0.00000000         0.00\n\
-   NG2P1   CG2DC2    HGR52     5   114.000000   317.984000   0.00000000         0.00\n\
-  CG251O   CG2DC3     HGA5     5   120.500000   292.880000   0.00000000         0.00\n\
-  CG252O   CG2DC3     HGA5     5   120.500000   292.880000   0.00000000         0.00\n\
-  CG25C1   CG2DC3     HGA5     5   120.500000   376.560000   0.00000000         0.00\n\
-  CG25C2   CG2DC3     HGA5     5   120.500000   376.560000   0.00000000         0.00\n\
-  CG2DC1   CG2DC3     HGA5     5   120.500000   376.560000   0.00000000         0.00\n\
-  CG2DC2   CG2DC3     HGA5     5   120.500000   376.560000   0.00000000         0.00\n\
-    HGA5   CG2DC3     HGA5     5   119.000000   158.992000   0.00000000         0.00\n\
-   NG2D1    CG2N1    NG311     5   125.000000   418.400000   0.00000000         0.00\n\
-   NG2D1    CG2N1    NG321     5   125.000000   836.800000   0.00000000         0.00\n\
-   NG2P1    CG2N1    NG2P1     5   120.000000   435.136000   0.23642000     75312.00\n\
-   NG311    CG2N1    NG321     5   113.000000   418.400000   0.00000000         0.00\n\
-   NG321    CG2N1    NG321     5   113.000000   627.600000   0.00000000         0.00\n\
-  CG2R61    CG2N2    NG2P1     5   118.500000   669.440000   0.00000000         0.00\n\
-   CG331    CG2N2    NG2P1     5   118.500000   435.136000   0.00000000         0.00\n\
-   NG2P1    CG2N2    NG2P1     5   123.000000   435.136000   0.23642000     75312.00\n\
-  CG2DC1    CG2O1    NG2S1     5   116.500000   669.440000   0.00000000         0.00\n\
-  CG2DC1    CG2O1    NG2S2     5   113.000000   711.280000   0.24600000     66944.00\n\
-  CG2DC1    CG2O1    OG2D1     5   122.500000   669.440000   0.00000000         0.00\n\
-  CG2DC2    CG2O1    NG2S1     5   116.500000   669.440000   0.00000000         0.00\n\
-  CG2DC2    CG2O1    NG2S2     5   113.000000   711.280000   0.24600000     66944.00\n\
-  CG2DC2    CG2O1    OG2D1     5   122.500000   669.440000   0.00000000         0.00\n\
-  CG2R61    CG2O1    NG2S1     5   116.500000   669.440000   0.00000000         0.00\n\
-  CG2R61    CG2O1    NG2S2     5   110.230000   418.400000   0.00000000         0.00\n\
-  CG2R61    CG2O1    OG2D1     5   121.000000   251.040000   0.00000000         0.00\n\
-  CG2R62    CG2O1    NG2S2     5   113.000000   711.280000   0.24600000     66944.00\n\
-  CG2R62    CG2O1    OG2D1     5   118.500000   711.280000   0.24300000     16736.00\n\
-   CG311    CG2O1    NG2S0     5   112.500000   167.360000   0.00000000         0.00\n\
-   CG311    CG2O1    NG2S1     5   116.500000   669.440000   0.00000000         0.00\n\
-   CG311    CG2O1    NG2S2     5   116.500000   418.400000   0.24500000     41840.00\n\
-   CG311    CG2O1    OG2D1     5   121.000000   669.440000   0.00000000         0.00\n\
-   CG314    CG2O1    NG2S0     5   112.500000   167.360000   0.00000000         0.00\n\
-   CG314    CG2O1    NG2S1     5   116.500000   669.440000   0.00000000         0.00\n\
-   CG314    CG2O1    NG2S2     5   116.500000   418.400000   0.24500000     41840.00\n\
-   CG314    CG2O1    OG2D1     5   121.000000   669.440000   0.00000000         0.00\n\
-   CG321    CG2O1    NG2S0     5   112.500000   167.360000   0.00000000         0.00\n\
-   CG321    CG2O1    NG2S1     5   116.500000   669.440000   0.00000000         0.00\n\
-   CG321    CG2O1    NG2S2     5   116.500000   418.400000   0.24500000     41840.00\n\
-   CG321    CG2O1    OG2D1     5   121.000000   669.440000   0.00000000         0.00\n\
-   CG324    CG2O1    NG2S0     5   112.500000   167.360000   0.00000000         0.00\n\
-   CG324    CG2O1    NG2S1     5   116.500000   669.440000   0.00000000         0.00\n\
-   CG324    CG2O1    NG2S2     5   116.500000   418.400000   0.24500000     41840.00\n\
-   CG324    CG2O1    OG2D1     5   121.000000   669.440000   0.00000000         0.00\n\
-   CG331    CG2O1    NG2S0     5   115.000000   334.720000   0.00000000         0.00\n\
-   CG331    CG2O1    NG2S1     5   116.500000   669.440000   0.00000000         0.00\n\
-   CG331    CG2O1    NG2S2     5   116.500000   418.400000   0.24500000     41840.00\n\
-   CG331    CG2O1    OG2D1     5   121.000000   669.440000   0.00000000         0.00\n\
-  CG3C51    CG2O1    NG2S0     5   112.500000   167.360000   0.00000000         0.00\n\
-  CG3C51    CG2O1    NG2S1     5   116.500000   669.440000   0.00000000         0.00\n\
-  CG3C51    CG2O1    NG2S2     5   112.500000   669.440000   0.00000000         0.00\n\
-  CG3C51    CG2O1    OG2D1     5   118.000000   669.440000   0.00000000         0.00\n\
-  CG3C53    CG2O1    NG2S0     5   112.500000   167.360000   0.00000000         0.00\n\
-  CG3C53    CG2O1    NG2S1     5   116.500000   669.440000   0.00000000         0.00\n\
-  CG3C53    CG2O1    NG2S2     5   112.500000   669.440000   0.00000000         0.00\n\
-  CG3C53    CG2O1    OG2D1     5   118.000000   669.440000   0.00000000         0.00\n\
-   NG2S0    CG2O1    OG2D1     5   124.000000   669.440000   0.00000000         0.00\n\
-   NG2S0    CG2O1    HGR52     5   115.000000   359.824000   0.00000000         0.00\n\
-   NG2S1    CG2O1    OG2D1     5   122.500000   669.440000   0.00000000         0.00\n\
-   NG2S2    CG2O1    OG2D1     5   122.500000   627.600000   0.23700000     41840.00\n\
-   NG2S2    CG2O1    HGR52     5   111.000000   368.192000   0.19800000     41840.00\n\
-   OG2D1    CG2O1    HGR52     5   122.000000   368.192000   0.00000000         0.00\n\
-  CG2R61    CG2O2    OG2D1     5   123.100000   585.760000   0.24420000     16736.00\n\
-  CG2R61    CG2O2    OG302     5   111.000000   418.400000   0.23600000     16736.00\n\
-  CG2R61    CG2O2    OG311     5   113.900000   334.720000   0.23700000     25104.00\n\
-   CG311    CG2O2    OG2D1     5   125.000000   585.760000   0.24420000     16736.00\n\
-   CG311    CG2O2    OG302     5   109.000000   460.240000   0.23260000     16736.00\n\
-   CG311    CG2O2    OG311     5   110.500000   460.240000   0.00000000         0.00\n\
-   CG321    CG2O2    OG2D1     5   125.000000   585.760000   0.24420000     16736.00\n\
-   CG321    CG2O2    OG302     5   109.000000   460.240000   0.23260000     16736.00\n\
-   CG321    CG2O2    OG311     5   110.500000   460.240000   0.00000000         0.00\n\
-   CG331    CG2O2    OG2D1     5   125.000000   585.760000   0.24420000     16736.00\n\
-   CG331    CG2O2    OG302     5   109.000000   460.240000   0.23260000     16736.00\n\
-   CG331    CG2O2    OG311     5   110.500000   460.240000   0.00000000         0.00\n\
-   OG2D1    CG2O2    OG302     5   125.900000   753.120000   0.22576000    133888.00\n\
-   OG2D1    CG2O2    OG311     5   123.000000   418.400000   0.22620000    175728.00\n\
-   OG2D1    CG2O2    HGR52     5   119.000000   326.352000   0.00000000         0.00\n\
-   OG311    CG2O2    HGR52     5   105.000000   393.296000   0.00000000         0.00\n\
-  CG2DC1    CG2O3    OG2D2     5   116.000000   334.720000   0.23530000     41840.00\n\
-  CG2DC2    CG2O3    OG2D2     5   116.000000   334.720000   0.23530000     41840.00\n\
-   CG2O5    CG2O3    OG2D2     5   116.000000   794.960000   0.00000000         0.00\n\
-  CG2R61    CG2O3    OG2D2     5   116.000000   334.720000   0.23530000     41840.00\n\
-   CG301    CG2O3    OG2D2     5   116.000000   334.720000   0.23530000     41840.00\n\
-   CG311    CG2O3    OG2D2     5   116.000000   334.720000   0.23530000     41840.00\n\
-   CG314    CG2O3    OG2D2     5   116.000000   334.720000   0.23530000     41840.00\n\
-   CG321    CG2O3    OG2D2     5   116.000000   334.720000   0.23530000     41840.00\n\
-   CG324    CG2O3    OG2D2     5   116.000000   334.720000   0.23530000     41840.00\n\
-   CG331    CG2O3    OG2D2     5   116.000000   334.720000   0.23530000     41840.00\n\
-  CG3C51    CG2O3    OG2D2     5   116.000000   334.720000   0.23530000     41840.00\n\
-  CG3C53    CG2O3    OG2D2     5   116.000000   334.720000   0.23530000     41840.00\n\
-   OG2D2    CG2O3    OG2D2     5   128.000000   836.800000   0.22587000     58576.00\n\
-   OG2D2    CG2O3    HGR52     5   116.000000   376.560000   0.00000000         0.00\n\
-  CG2DC1    CG2O4    OG2D1     5   126.000000   627.600000   0.00000000         0.00\n\
-  CG2DC1    CG2O4    HGR52     5   116.000000   125.520000   0.00000000         0.00\n\
-  CG2DC2    CG2O4    OG2D1     5   126.000000   627.600000   0.00000000         0.00\n\
-  CG2DC2    CG2O4    HGR52     5   116.000000   125.520000   0.00000000         0.00\n\
-  CG2R61    CG2O4    OG2D1     5   126.000000   627.600000   0.00000000         0.00\n\
-  CG2R61    CG2O4    HGR52     5   116.000000   125.520000   0.00000000         0.00\n\
-   CG321    CG2O4    OG2D1     5   126.000000   376.560000   0.00000000         0.00\n\
-   CG321    CG2O4    HGR52     5   116.000000   543.920000   0.00000000         0.00\n\
-   CG331    CG2O4    OG2D1     5   126.000000   376.560000   0.00000000         0.00\n\
-   CG331    CG2O4    HGR52     5   116.000000   543.920000   0.00000000         0.00\n\
-   OG2D1    CG2O4    HGR52     5   118.000000   543.920000   0.00000000         0.00\n\
-  CG2DC1    CG2O5    CG331     5   116.000000   292.880000   0.00000000         0.00\n\
-  CG2DC1    CG2O5    OG2D3     5   121.800000   585.760000   0.00000000         0.00\n\
-  CG2DC2    CG2O5    CG331     5   116.000000   292.880000   0.00000000         0.00\n\
-  CG2DC2    CG2O5    OG2D3     5   121.800000   585.760000   0.00000000         0.00\n\
-   CG2O3    CG2O5   CG2R61     5   117.200000   334.720000   0.00000000         0.00\n\
-   CG2O3    CG2O5    OG2D3     5   121.500000   794.960000   0.00000000         0.00\n\
-  CG2R61    CG2O5    CG311     5   117.200000   334.720000   0.00000000         0.00\n\
-  CG2R61    CG2O5    CG321     5   116.500000   167.360000   0.00000000         0.00\n\
-  CG2R61    CG2O5    CG331     5   116.500000   502.080000   0.00000000         0.00\n\
-  CG2R61    CG2O5    OG2D3     5   121.300000   585.760000   0.00000000         0.00\n\
-   CG311    CG2O5    OG2D3     5   121.500000   794.960000   0.00000000         0.00\n\
-   CG321    CG2O5    CG321     5   115.600000   292.880000   0.00000000         0.00\n\
-   CG321    CG2O5    CG331     5   115.600000   292.880000   0.00000000         0.00\n\
-   CG321    CG2O5    OG2D3     5   122.200000   627.600000   0.00000000         0.00\n\
-   CG331    CG2O5    CG331     5   115.600000   292.880000   0.00000000         0.00\n\
-   CG331    CG2O5    OG2D3     5   122.200000   627.600000   0.00000000         0.00\n\
-   NG2S1    CG2O6    OG2D1     5   125.700000   502.080000   0.00000000         0.00\n\
-   NG2S1    CG2O6    OG302     5   110.300000   753.120000   0.00000000         0.00\n\
-   NG2S2    CG2O6    NG2S2     5   115.000000   585.760000   0.00000000         0.00\n\
-   NG2S2    CG2O6    OG2D1     5   122.500000   627.600000   0.23700000     41840.00\n\
-   OG2D1    CG2O6    OG302     5   123.500000   585.760000   0.00000000         0.00\n\
-   OG2D2    CG2O6    OG2D2     5   120.000000   334.720000   0.22412700     83261.60\n\
-   OG302    CG2O6    OG302     5   105.000000   711.280000   0.00000000         0.00\n\
-   SG2D1    CG2O6    SG311     5   124.000000   585.760000   0.00000000         0.00\n\
-   SG311    CG2O6    SG311     5   112.000000   334.720000   0.00000000         0.00\n\
-   OG2D5    CG2O7    OG2D5     5   180.000000   376.560000   0.00000000         0.00\n\
-  CG2R51   CG2R51   CG2R51     5   107.200000   753.120000   0.00000000         0.00\n\
-  CG2R51   CG2R51   CG2R52     5   106.000000   753.120000   0.00000000         0.00\n\
-  CG2R51   CG2R51   CG2RC0     5   105.700000   711.280000   0.22610000     20920.00\n\
-  CG2R51   CG2R51   CG2RC7     5   106.900000   585.760000   0.00000000         0.00\n\
-  CG2R51   CG2R51    CG321     5   130.000000   383.254400   0.00000000         0.00\n\
-  CG2R51   CG2R51    CG331     5   130.000000   383.254400   0.00000000         0.00\n\
-  CG2R51   CG2R51   CG3C52     5   109.000000   962.320000   0.00000000         0.00\n\
-  CG2R51   CG2R51   CG3C54     5   109.000000   962.320000   0.00000000         0.00\n\
-  CG2R51   CG2R51   NG2R50     5   110.000000  1087.840000   0.00000000         0.00\n\
-  CG2R51   CG2R51   NG2R51     5   106.000000  1087.840000   0.00000000         0.00\n\
-  CG2R51   CG2R51   NG2R52     5   108.000000  1213.360000   0.00000000         0.00\n\
-  CG2R51   CG2R51   NG2RC0     5   108.200000  1087.840000   0.00000000         0.00\n\
-  CG2R51   CG2R51   NG3C51     5   111.800000   878.640000   0.00000000         0.00\n\
-  CG2R51   CG2R51    NG3P2     5   111.000000  1004.160000   0.00000000         0.00\n\
-  CG2R51   CG2R51   OG2R50     5   111.700000  1087.840000   0.00000000         0.00\n\
-  CG2R51   CG2R51   OG3C51     5   113.200000  1129.680000   0.00000000         0.00\n\
-  CG2R51   CG2R51   SG2R50     5   109.000000   878.640000   0.00000000         0.00\n\
-  CG2R51   CG2R51    HGR51     5   126.400000   267.776000   0.21730000     20920.00\n\
-  CG2R51   CG2R51    HGR52     5   130.000000   184.096000   0.22150000     12552.00\n\
-  CG2R52   CG2R51    HGR51     5   127.600000   125.520000   0.00000000         0.00\n\
-  CG2RC0   CG2R51    CG321     5   126.700000   251.040000   0.00000000         0.00\n\
-  CG2RC0   CG2R51    CG331     5   126.700000   251.040000   0.00000000         0.00\n\
-  CG2RC0   CG2R51   NG2R51     5   107.500000   836.800000   0.00000000         0.00\n\
-  CG2RC0   CG2R51    HGR51     5   126.400000   267.776000   0.22550000     20920.00\n\
-  CG2RC0   CG2R51    HGR52     5   128.500000   259.408000   0.00000000         0.00\n\
-  CG2RC7   CG2R51    HGR51     5   126.700000   267.776000   0.00000000         0.00\n\
-   CG321   CG2R51   NG2R50     5   120.000000   383.254400   0.00000000         0.00\n\
-   CG321   CG2R51   NG2R51     5   124.000000   383.254400   0.00000000         0.00\n\
-   CG321   CG2R51   NG2R52     5   122.000000   383.254400   0.00000000         0.00\n\
-   CG331   CG2R51   NG2R51     5   124.000000   383.254400   0.00000000         0.00\n\
-  CG3C52   CG2R51    HGR51     5   124.600000   242.672000   0.00000000         0.00\n\
-  CG3C54   CG2R51    HGR51     5   124.600000   108.784000   0.00000000         0.00\n\
-  NG2R50   CG2R51    HGR52     5   120.000000   209.200000   0.21400000     16736.00\n\
-  NG2R51   CG2R51    HGR52     5   124.000000   209.200000   0.21400000     16736.00\n\
-  NG2R52   CG2R51    HGR52     5   122.000000   184.096000   0.21800000     12552.00\n\
-  NG2RC0   CG2R51    HGR52     5   121.800000   259.408000   0.00000000         0.00\n\
-  NG3C51   CG2R51    HGR52     5   118.200000   292.880000   0.00000000         0.00\n\
-   NG3P2   CG2R51    HGR52     5   119.000000   292.880000   0.00000000         0.00\n\
-  OG2R50   CG2R51    HGR52     5   118.300000   418.400000   0.00000000         0.00\n\
-  OG3C51   CG2R51    HGR52     5   116.800000   326.352000   0.00000000         0.00\n\
-  SG2R50   CG2R51    HGR52     5   121.000000   376.560000   0.00000000         0.00\n\
-  CG2R51   CG2R52   NG2R50     5   110.500000   920.480000   0.00000000         0.00\n\
-  CG2R51   CG2R52   NG2R52     5   110.000000  1012.528000   0.00000000         0.00\n\
-  CG2R51   CG2R52    HGR52     5   126.500000   267.776000   0.00000000         0.00\n\
-  CG2RC0   CG2R52   NG2R50     5   110.400000  1255.200000   0.00000000         0.00\n\
-  CG2RC0   CG2R52    HGR52     5   126.600000   267.776000   0.00000000         0.00\n\
-  CG3C52   CG2R52   NG2R50     5   112.000000  1422.560000   0.00000000         0.00\n\
-  CG3C52   CG2R52    HGR52     5   125.000000   393.296000   0.00000000         0.00\n\
-  NG2R50   CG2R52    HGR52     5   123.000000   267.776000   0.00000000         0.00\n\
-  NG2R52   CG2R52    HGR52     5   123.500000   292.880000   0.00000000         0.00\n\
-  CG251O   CG2R53   NG2R53     5   108.500000   460.240000   0.00000000         0.00\n\
-  CG251O   CG2R53    OG2D1     5   124.500000   460.240000   0.00000000         0.00\n\
-  CG252O   CG2R53   NG2R53     5   108.500000   460.240000   0.00000000         0.00\n\
-  CG252O   CG2R53    OG2D1     5   124.500000   460.240000   0.00000000         0.00\n\
-  CG25C1   CG2R53   NG2R51     5   107.000000   418.400000   0.00000000         0.00\n\
-  CG25C1   CG2R53    OG2D1     5   125.500000   460.240000   0.00000000         0.00\n\
-  CG25C2   CG2R53   NG2R51     5   107.000000   418.400000   0.00000000         0.00\n\
-  CG25C2   CG2R53    OG2D1     5   125.500000   460.240000   0.00000000         0.00\n\
-  CG3C41   CG2R53   NG2R43     5   104.500000  1004.160000   0.00000000         0.00\n\
-  CG3C41   CG2R53    OG2D1     5   135.700000   502.080000   0.00000000         0.00\n\
-  CG3C52   CG2R53   NG2R53     5   105.500000  1004.160000   0.00000000         0.00\n\
-  CG3C52   CG2R53    OG2D1     5   126.700000   543.920000   0.00000000         0.00\n\
-  NG2R43   CG2R53    OG2D1     5   134.300000   502.080000   0.00000000         0.00\n\
-  NG2R50   CG2R53   NG2R50     5   111.000000   836.800000   0.00000000         0.00\n\
-  NG2R50   CG2R53   NG2R51     5   113.000000   836.800000   0.00000000         0.00\n\
-  NG2R50   CG2R53   NG3C51     5   117.400000  1338.880000   0.00000000         0.00\n\
-  NG2R50   CG2R53   OG2R50     5   115.700000  1004.160000   0.00000000         0.00\n\
-  NG2R50   CG2R53   SG2R50     5   117.200000   920.480000   0.00000000         0.00\n\
-  NG2R50   CG2R53    HGR52     5   124.800000   326.352000   0.00000000         0.00\n\
-  NG2R51   CG2R53    OG2D1     5   127.500000   585.760000   0.00000000         0.00\n\
-  NG2R51   CG2R53    HGR52     5   122.200000   334.720000   0.00000000         0.00\n\
-  NG2R52   CG2R53   NG2R52     5   108.000000  1213.360000   0.00000000         0.00\n\
-  NG2R52   CG2R53    HGR53     5   126.000000   267.776000   0.21400000     20920.00\n\
-  NG2R53   CG2R53   NG2R53     5   104.400000   627.600000   0.00000000         0.00\n\
-  NG2R53   CG2R53    OG2D1     5   127.800000   543.920000   0.00000000         0.00\n\
-  NG2R53   CG2R53    SG2D1     5   127.000000   376.560000   0.00000000         0.00\n\
-  NG2R53   CG2R53    SG311     5   109.000000   585.760000   0.00000000         0.00\n\
-  NG3C51   CG2R53    HGR52     5   117.800000   267.776000   0.00000000         0.00\n\
-   OG2D1   CG2R53    SG311     5   125.000000   460.240000   0.00000000         0.00\n\
-  OG2R50   CG2R53    HGR52     5   119.500000   209.200000   0.21400000     16736.00\n\
-   SG2D1   CG2R53    SG311     5   124.000000   376.560000   0.00000000         0.00\n\
-  SG2R50   CG2R53    HGR52     5   118.000000   251.040000   0.00000000         0.00\n\
-   CG1N1   CG2R61   CG2R61     5   120.000000   292.880000   0.00000000         0.00\n\
-  CG2DC1   CG2R61   CG2R61     5   120.000000   301.248000   0.00000000         0.00\n\
-  CG2DC2   CG2R61   CG2R61     5   120.000000   301.248000   0.00000000         0.00\n\
-   CG2N2   CG2R61   CG2R61     5   120.000000   209.200000   0.00000000         0.00\n\
-   CG2O1   CG2R61   CG2R61     5   119.000000   376.560000   0.00000000         0.00\n\
-   CG2O1   CG2R61   CG2RC0     5   120.000000   502.080000   0.00000000         0.00\n\
-   CG2O2   CG2R61   CG2R61     5   120.000000   376.560000   0.00000000         0.00\n\
-   CG2O3   CG2R61   CG2R61     5   119.000000   376.560000   0.00000000         0.00\n\
-   CG2O4   CG2R61   CG2R61     5   119.800000   376.560000   0.00000000         0.00\n\
-   CG2O5   CG2R61   CG2R61     5   120.000000   376.560000   0.00000000         0.00\n\
-  CG2R61   CG2R61   CG2R61     5   120.000000   334.720000   0.24162000     29288.00\n\
-  CG2R61   CG2R61   CG2R64     5   115.500000   334.720000   0.24162000     29288.00\n\
-  CG2R61   CG2R61   CG2R66     5   119.000000   334.720000   0.24162000     29288.00\n\
-  CG2R61   CG2R61   CG2R67     5   120.000000   334.720000   0.00000000         0.00\n\
-  CG2R61   CG2R61   CG2RC0     5   120.000000   418.400000   0.00000000         0.00\n\
-  CG2R61   CG2R61    CG311     5   120.000000   383.254400   0.00000000         0.00\n\
-  CG2R61   CG2R61    CG312     5   120.000000   383.254400   0.00000000         0.00\n\
-  CG2R61   CG2R61    CG321     5   120.000000   383.254400   0.00000000         0.00\n\
-  CG2R61   CG2R61    CG324     5   120.000000   383.254400   0.00000000         0.00\n\
-  CG2R61   CG2R61    CG331     5   120.000000   383.254400   0.00000000         0.00\n\
-  CG2R61   CG2R61    NG2O1     5   120.000000   167.360000   0.00000000         0.00\n\
-  CG2R61   CG2R61   NG2R60     5   124.000000   167.360000   0.00000000         0.00\n\
-  CG2R61   CG2R61   NG2R62     5   124.000000   167.360000   0.00000000         0.00\n\
-  CG2R61   CG2R61   NG2RC0     5   121.400000   836.800000   0.00000000         0.00\n\
-  CG2R61   CG2R61    NG2S1     5   120.000000   334.720000   0.24162000     29288.00\n\
-  CG2R61   CG2R61    NG2S3     5   121.000000   502.080000   0.00000000         0.00\n\
-  CG2R61   CG2R61    NG311     5   120.000000   334.720000   0.00000000         0.00\n\
-  CG2R61   CG2R61    NG3N1     5   122.000000   401.664000   0.00000000         0.00\n\
-  CG2R61   CG2R61    OG301     5   120.000000   920.480000   0.00000000         0.00\n\
-  CG2R61   CG2R61    OG303     5   120.000000   627.600000   0.00000000         0.00\n\
-  CG2R61   CG2R61    OG311     5   120.000000   378.233600   0.00000000         0.00\n\
-  CG2R61   CG2R61    OG312     5   120.000000   334.720000   0.00000000         0.00\n\
-  CG2R61   CG2R61   OG3R60     5   120.000000   334.720000   0.00000000         0.00\n\
-  CG2R61   CG2R61    SG311     5   120.000000   334.720000   0.00000000         0.00\n\
-  CG2R61   CG2R61    SG3O1     5   122.300000    83.680000   0.00000000         0.00\n\
-  CG2R61   CG2R61    SG3O2     5   119.000000   292.880000   0.00000000         0.00\n\
-  CG2R61   CG2R61    CLGR1     5   120.000000   502.080000   0.00000000         0.00\n\
-  CG2R61   CG2R61    BRGR1     5   120.000000   376.560000   0.00000000         0.00\n\
-  CG2R61   CG2R61     IGR1     5   120.000000   376.560000   0.00000000         0.00\n\
-  CG2R61   CG2R61    HGR61     5   120.000000   251.040000   0.21525000     18409.60\n\
-  CG2R61   CG2R61    HGR62     5   120.000000   251.040000   0.21525000     18409.60\n\
-  CG2R64   CG2R61   NG2R60     5   123.400000   167.360000   0.00000000         0.00\n\
-  CG2R64   CG2R61    OG311     5   120.000000   378.233600   0.00000000         0.00\n\
-  CG2R64   CG2R61    HGR61     5   120.000000   251.040000   0.21525000     18409.60\n\
-  CG2R66   CG2R61   CG2R66     5   117.000000   334.720000   0.24162000     29288.00\n\
-  CG2R66   CG2R61    CG331     5   120.000000   383.254400   0.00000000         0.00\n\
-  CG2R66   CG2R61   NG2R60     5   124.000000   167.360000   0.00000000         0.00\n\
-  CG2R66   CG2R61    NG2S1     5   120.000000   334.720000   0.24162000     29288.00\n\
-  CG2R66   CG2R61    HGR62     5   121.500000   251.040000   0.21525000     18409.60\n\
-  CG2R67   CG2R61   NG2R60     5   124.000000   167.360000   0.00000000         0.00\n\
-  CG2R67   CG2R61    HGR61     5   120.000000   251.040000   0.00000000         0.00\n\
-  CG2R67   CG2R61    HGR62     5   120.000000   251.040000   0.00000000         0.00\n\
-  CG2RC0   CG2R61   NG2R62     5   119.000000   167.360000   0.00000000         0.00\n\
-  CG2RC0   CG2R61    HGR61     5   120.000000   251.040000   0.21460000     18409.60\n\
-  CG2RC0   CG2R61    HGR62     5   121.500000   251.040000   0.00000000         0.00\n\
-   CG321   CG2R61   NG2R60     5   122.300000   383.254400   0.00000000         0.00\n\
-   CG331   CG2R61   NG2R60     5   122.300000   383.254400   0.00000000         0.00\n\
-  NG2R60   CG2R61    BRGR1     5   120.000000   376.560000   0.00000000         0.00\n\
-  NG2R60   CG2R61    HGR62     5   116.000000   251.040000   0.21000000     29288.00\n\
-  NG2R62   CG2R61    HGR62     5   116.000000   251.040000   0.21000000     29288.00\n\
-  NG2RC0   CG2R61    HGR62     5   118.600000   251.040000   0.00000000         0.00\n\
-   CG2O1   CG2R62   CG2R62     5   131.800000    83.680000   0.00000000         0.00\n\
-  CG2R62   CG2R62   CG2R62     5   118.000000   334.720000   0.00000000         0.00\n\
-  CG2R62   CG2R62   CG2R63     5   116.700000  1004.160000   0.00000000         0.00\n\
-  CG2R62   CG2R62   CG2R64     5   117.800000   711.280000   0.00000000         0.00\n\
-  CG2R62   CG2R62    CG331     5   124.200000   334.720000   0.00000000         0.00\n\
-  CG2R62   CG2R62   NG2R61     5   122.900000   711.280000   0.00000000         0.00\n\
-  CG2R62   CG2R62    HGR62     5   119.000000   351.456000   0.00000000         0.00\n\
-  CG2R62   CG2R62    HGR63     5   120.500000   669.440000   0.00000000         0.00\n\
-  CG2R63   CG2R62    CG331     5   118.700000   317.984000   0.00000000         0.00\n\
-  CG2R63   CG2R62    HGR62     5   120.300000   251.040000   0.00000000         0.00\n\
-  CG2R64   CG2R62    HGR62     5   120.100000   317.984000   0.00000000         0.00\n\
-  NG2R61   CG2R62    HGR62     5   115.000000   368.192000   0.00000000         0.00\n\
-  NG2R61   CG2R62    HGR63     5   117.500000   669.440000   0.00000000         0.00\n\
-  CG2R62   CG2R63   NG2R61     5   113.500000   585.760000   0.00000000         0.00\n\
-  CG2R62   CG2R63    OG2D4     5   124.600000   836.800000   0.00000000         0.00\n\
-  CG2RC0   CG2R63   NG2R61     5   107.800000   585.760000   0.00000000         0.00\n\
-  CG2RC0   CG2R63    OG2D4     5   124.700000   418.400000   0.00000000         0.00\n\
-  NG2R61   CG2R63   NG2R61     5   114.000000   418.400000   0.00000000         0.00\n\
-  NG2R61   CG2R63   NG2R62     5   116.800000   418.400000   0.00000000         0.00\n\
-  NG2R61   CG2R63    OG2D4     5   119.400000  1087.840000   0.00000000         0.00\n\
-  NG2R62   CG2R63    OG2D4     5   123.800000  1087.840000   0.00000000         0.00\n\
-  CG2R61   CG2R64   NG2R60     5   124.000000   167.360000   0.00000000         0.00\n\
-  CG2R61   CG2R64   NG2R62     5   128.000000   167.360000   0.00000000         0.00\n\
-  CG2R61   CG2R64    NG2S1     5   120.000000   334.720000   0.24162000     29288.00\n\
-  CG2R62   CG2R64   NG2R62     5   119.300000   711.280000   0.00000000         0.00\n\
-  CG2R62   CG2R64    NG2S3     5   118.400000   677.808000   0.00000000         0.00\n\
-  CG2RC0   CG2R64   NG2R62     5   110.700000   502.080000   0.00000000         0.00\n\
-  CG2RC0   CG2R64    NG2S3     5   118.600000   418.400000   0.00000000         0.00\n\
-  NG2R60   CG2R64    NG2S1     5   120.000000   334.720000   0.24162000     29288.00\n\
-  NG2R61   CG2R64   NG2R62     5   122.200000   585.760000   0.00000000         0.00\n\
-  NG2R61   CG2R64    NG2S3     5   115.400000   794.960000   0.00000000         0.00\n\
-  NG2R62   CG2R64   NG2R62     5   128.000000   502.080000   0.00000000         0.00\n\
-  NG2R62   CG2R64    NG2S3     5   122.400000   794.960000   0.00000000         0.00\n\
-  NG2R62   CG2R64    HGR62     5   116.000000   317.984000   0.00000000         0.00\n\
-  CG2R61   CG2R66   CG2R61     5   122.500000   334.720000   0.24162000     29288.00\n\
-  CG2R61   CG2R66     FGR1     5   118.750000   502.080000   0.00000000         0.00\n\
-  CG2R61   CG2R67   CG2R61     5   120.000000   334.720000   0.00000000         0.00\n\
-  CG2R61   CG2R67   CG2R67     5   120.000000   334.720000   0.00000000         0.00\n\
-  CG2R61   CG2R67   CG2RC0     5   120.000000   418.400000   0.00000000         0.00\n\
-  CG2R67   CG2R67   CG2RC0     5   110.000000   460.240000   0.00000000         0.00\n\
-  CG2R71   CG2R71   CG2R71     5   128.600000   251.040000   0.00000000         0.00\n\
-  CG2R71   CG2R71   CG2RC7     5   129.300000   753.120000   0.00000000         0.00\n\
-  CG2R71   CG2R71    HGR71     5   115.700000   309.616000   0.00000000         0.00\n\
-  CG2RC7   CG2R71    HGR71     5   115.000000   267.776000   0.00000000         0.00\n\
-  CG25C1   CG2RC0   CG2R61     5   125.000000   334.720000   0.00000000         0.00\n\
-  CG25C1   CG2RC0   CG2RC0     5   107.000000   167.360000   0.00000000         0.00\n\
-  CG25C2   CG2RC0   CG2R61     5   125.000000   334.720000   0.00000000         0.00\n\
-  CG25C2   CG2RC0   CG2RC0     5   107.000000   167.360000   0.00000000         0.00\n\
-  CG2R51   CG2RC0   CG2R61     5   132.000000  1087.840000   0.00000000         0.00\n\
-  CG2R51   CG2RC0   CG2RC0     5   108.000000   711.280000   0.00000000         0.00\n\
-  CG2R51   CG2RC0   NG2RC0     5   109.200000   753.120000   0.00000000         0.00\n\
-  CG2R52   CG2RC0   CG2R61     5   134.100000   502.080000   0.00000000         0.00\n\
-  CG2R52   CG2RC0   CG2RC0     5   105.900000   753.120000   0.00000000         0.00\n\
-  CG2R61   CG2RC0   CG2R67     5   120.000000   418.400000   0.00000000         0.00\n\
-  CG2R61   CG2RC0   CG2RC0     5   120.000000   418.400000   0.00000000         0.00\n\
-  CG2R61   CG2RC0   CG3C52     5   130.000000   502.080000   0.00000000         0.00\n\
-  CG2R61   CG2RC0   NG2R50     5   130.000000  1087.840000   0.00000000         0.00\n\
-  CG2R61   CG2RC0   NG2R51     5   132.600000  1087.840000   0.00000000         0.00\n\
-  CG2R61   CG2RC0   NG2RC0     5   118.800000   669.440000   0.00000000         0.00\n\
-  CG2R61   CG2RC0   NG3C51     5   130.700000   292.880000   0.00000000         0.00\n\
-  CG2R61   CG2RC0   OG2R50     5   129.400000   836.800000   0.00000000         0.00\n\
-  CG2R61   CG2RC0   OG3C51     5   125.300000   418.400000   0.00000000         0.00\n\
-  CG2R61   CG2RC0   SG2R50     5   123.700000   376.560000   0.00000000         0.00\n\
-  CG2R63   CG2RC0   CG2RC0     5   119.600000   585.760000   0.00000000         0.00\n\
-  CG2R63   CG2RC0   NG2R50     5   129.000000  1046.000000   0.00000000         0.00\n\
-  CG2R64   CG2RC0   CG2RC0     5   121.000000   502.080000   0.00000000         0.00\n\
-  CG2R64   CG2RC0   NG2R50     5   129.000000   836.800000   0.00000000         0.00\n\
-  CG2R67   CG2RC0   CG3C52     5   110.000000   920.480000   0.00000000         0.00\n\
-  CG2R67   CG2RC0   NG2R51     5   105.700000   836.800000   0.00000000         0.00\n\
-  CG2RC0   CG2RC0   CG3C52     5   110.000000   920.480000   0.00000000         0.00\n\
-  CG2RC0   CG2RC0   NG2R50     5   110.000000   836.800000   0.00000000         0.00\n\
-  CG2RC0   CG2RC0   NG2R51     5   105.700000   836.800000   0.00000000         0.00\n\
-  CG2RC0   CG2RC0   NG2R62     5   127.400000   502.080000   0.00000000         0.00\n\
-  CG2RC0   CG2RC0   NG3C51     5   109.300000   836.800000   0.00000000         0.00\n\
-  CG2RC0   CG2RC0   OG2R50     5   110.600000   920.480000   0.00000000         0.00\n\
-  CG2RC0   CG2RC0   OG3C51     5   114.700000   669.440000   0.00000000         0.00\n\
-  CG2RC0   CG2RC0   SG2R50     5   116.300000   585.760000   0.00000000         0.00\n\
-  NG2R50   CG2RC0   NG2R62     5   122.600000   167.360000   0.00000000         0.00\n\
-  NG2R51   CG2RC0   NG2R62     5   126.900000   836.800000   0.00000000         0.00\n\
-  CG2R51   CG2RC7   CG2R71     5   122.700000   251.040000   0.00000000         0.00\n\
-  CG2R51   CG2RC7   CG2RC7     5   109.500000   920.480000   0.00000000         0.00\n\
-  CG2R71   CG2RC7   CG2RC7     5   127.800000   251.040000   0.00000000         0.00\n\
-   CG2D1    CG301    CG311     5   112.200000   267.776000   0.00000000         0.00\n\
-   CG2D1    CG301    CG321     5   112.200000   267.776000   0.00000000         0.00\n\
-   CG2D1    CG301    CG331     5   112.200000   267.776000   0.00000000         0.00\n\
-  CG2DC1    CG301    CG321     5   112.200000   267.776000   0.00000000         0.00\n\
-  CG2DC1    CG301    CG331     5   112.200000   267.776000   0.00000000         0.00\n\
-  CG2DC2    CG301    CG321     5   112.200000   267.776000   0.00000000         0.00\n\
-  CG2DC2    CG301    CG331     5   112.200000   267.776000   0.00000000         0.00\n\
-   CG2O3    CG301    CG331     5   108.000000   435.136000   0.00000000         0.00\n\
-   CG2O3    CG301    OG301     5   109.000000   376.560000   0.00000000         0.00\n\
-   CG2O3    CG301    OG311     5   110.100000   633.457600   0.00000000         0.00\n\
-   CG311    CG301    CG311     5   113.500000   488.272800   0.25610000      9338.69\n\
-   CG311    CG301    CG321     5   113.500000   488.272800   0.25610000      9338.69\n\
-   CG311    CG301    CG331     5   113.500000   488.272800   0.25610000      9338.69\n\
-   CG321    CG301    CG321     5   113.500000   488.272800   0.25610000      9338.69\n\
-   CG321    CG301    CG331     5   113.500000   488.272800   0.25610000      9338.69\n\
-   CG321    CG301    OG301     5   114.500000   380.744000   0.00000000         0.00\n\
-   CG331    CG301    CG331     5   113.500000   488.272800   0.25610000      9338.69\n\
-   CG331    CG301    OG301     5   111.500000   376.560000   0.00000000         0.00\n\
-   CG331    CG301    OG302     5   110.100000   633.457600   0.00000000         0.00\n\
-   CG331    CG301    OG311     5   110.100000   633.457600   0.00000000         0.00\n\
-   CG331    CG301    CLGA3     5   111.200000   811.696000   0.00000000         0.00\n\
-   CG331    CG301    BRGA3     5   111.200000   820.064000   0.00000000         0.00\n\
-   OG301    CG301    OG301     5   107.000000   589.860320   0.00000000         0.00\n\
-   OG301    CG301    OG311     5   116.500000   376.560000   0.00000000         0.00\n\
-   CLGA3    CG301    CLGA3     5   109.000000   794.960000   0.00000000         0.00\n\
-   BRGA3    CG301    BRGA3     5   110.500000   753.120000   0.00000000         0.00\n\
-   CG321    CG302     FGA3     5   112.000000   351.456000   0.23570000     25104.00\n\
-   CG331    CG302     FGA3     5   112.000000   351.456000   0.23570000     25104.00\n\
-    FGA3    CG302     FGA3     5   107.000000   987.424000   0.21550000     25104.00\n\
-   CG2O1    CG311    CG311     5   108.000000   435.136000   0.00000000         0.00\n\
-   CG2O1    CG311    CG321     5   108.000000   435.136000   0.00000000         0.00\n\
-   CG2O1    CG311    CG331     5   108.000000   435.136000   0.00000000         0.00\n\
-   CG2O1    CG311    NG2S1     5   107.000000   418.400000   0.00000000         0.00\n\
-   CG2O1    CG311     HGA1     5   109.500000   418.400000   0.00000000         0.00\n\
-   CG2O2    CG311    CG321     5   108.000000   435.136000   0.00000000         0.00\n\
-   CG2O2    CG311   NG2R53     5   107.000000   418.400000   0.00000000         0.00\n\
-   CG2O2    CG311    NG2S1     5   107.000000   418.400000   0.00000000         0.00\n\
-   CG2O2    CG311     HGA1     5   109.500000   418.400000   0.00000000         0.00\n\
-   CG2O3    CG311   CG2R61     5   107.500000   433.462400   0.00000000         0.00\n\
-   CG2O3    CG311    CG311     5   108.000000   435.136000   0.00000000         0.00\n\
-   CG2O3    CG311    CG321     5   108.000000   435.136000   0.00000000         0.00\n\
-   CG2O3    CG311    CG331     5   108.000000   435.136000   0.00000000         0.00\n\
-   CG2O3    CG311   NG2R53     5   107.000000   418.400000   0.00000000         0.00\n\
-   CG2O3    CG311    NG2S1     5   107.000000   418.400000   0.00000000         0.00\n\
-   CG2O3    CG311    OG301     5   109.000000   376.560000   0.00000000         0.00\n\
-   CG2O3    CG311     HGA1     5   109.500000   418.400000   0.00000000         0.00\n\
-   CG2O5    CG311    OG311     5   111.000000   937.216000   0.00000000         0.00\n\
-   CG2O5    CG311    OG312     5   111.000000  1087.840000   0.00000000         0.00\n\
-   CG2O5    CG311     HGA1     5   109.500000   418.400000   0.00000000         0.00\n\
-  CG2R61    CG311    CG321     5   107.500000   433.462400   0.00000000         0.00\n\
-  CG2R61    CG311    CG331     5   107.500000   433.462400   0.00000000         0.00\n\
-  CG2R61    CG311     HGA1     5   111.000000   359.824000   0.00000000         0.00\n\
-   CG301    CG311    CG311     5   108.000000   435.136000   0.00000000         0.00\n\
-   CG301    CG311    CG321     5   113.500000   488.272800   0.25610000      9338.69\n\
-   CG301    CG311     HGA1     5   110.100000   289.532800   0.21790000     18853.10\n\
-   CG311    CG311    CG311     5   111.000000   446.432800   0.25610000      6694.40\n\
-   CG311    CG311    CG321     5   111.000000   446.432800   0.25610000      6694.40\n\
-   CG311    CG311    CG331     5   108.500000   446.432800   0.25610000      6694.40\n\
-   CG311    CG311   CG3RC1     5   103.700000   446.432800   0.25610000      6694.40\n\
-   CG311    CG311    NG2S1     5   113.500000   585.760000   0.00000000         0.00\n\
-   CG311    CG311    OG311     5   110.100000   633.457600   0.00000000         0.00\n\
-   CG311    CG311     HGA1     5   110.100000   288.696000   0.21790000     18853.10\n\
-   CG314    CG311    CG321     5   111.000000   446.432800   0.25610000      6694.40\n\
-   CG314    CG311    CG331     5   108.500000   446.432800   0.25610000      6694.40\n\
-   CG314    CG311     HGA1     5   110.100000   288.696000   0.21790000     18853.10\n\
-   CG321    CG311    CG321     5   113.500000   488.272800   0.25610000      9338.69\n\
-   CG321    CG311    CG324     5   110.500000   488.272800   0.25610000      9338.69\n\
-   CG321    CG311    CG331     5   114.000000   446.432800   0.25610000      6694.40\n\
-   CG321    CG311   CG3C51     5   111.000000   446.432800   0.25610000      6694.40\n\
-   CG321    CG311   CG3RC1     5   103.700000   446.432800   0.25610000      6694.40\n\
-   CG321    CG311   NG2R53     5   113.500000   585.760000   0.00000000         0.00\n\
-   CG321    CG311    NG2S1     5   113.500000   585.760000   0.00000000         0.00\n\
-   CG321    CG311    OG302     5   109.700000   962.320000   0.00000000         0.00\n\
-   CG321    CG311    OG311     5   110.000000   633.457600   0.00000000         0.00\n\
-   CG321    CG311     HGA1     5   110.100000   288.696000   0.21790000     18853.10\n\
-   CG324    CG311    NG2S1     5   113.500000   585.760000   0.00000000         0.00\n\
-   CG324    CG311    OG311     5   112.100000   633.457600   0.00000000         0.00\n\
-   CG324    CG311     HGA1     5   111.800000   221.752000   0.21790000     18853.10\n\
-   CG331    CG311    CG331     5   114.000000   446.432800   0.25610000      6694.40\n\
-   CG331    CG311   CG3C51     5   108.500000   446.432800   0.25610000      6694.40\n\
-   CG331    CG311    NG2S1     5   113.500000   585.760000   0.00000000         0.00\n\
-   CG331    CG311    OG301     5   111.500000   376.560000   0.00000000         0.00\n\
-   CG331    CG311    OG302     5   110.100000   633.457600   0.00000000         0.00\n\
-   CG331    CG311    OG303     5   109.700000   962.320000   0.00000000         0.00\n\
-   CG331    CG311    OG311     5   110.100000   633.457600   0.00000000         0.00\n\
-   CG331    CG311    CLGA1     5   111.200000   736.384000   0.00000000         0.00\n\
-   CG331    CG311    BRGA2     5   111.000000   627.600000   0.00000000         0.00\n\
-   CG331    CG311     HGA1     5   110.100000   288.696000   0.21790000     18853.10\n\
-  CG3C51    CG311     HGA1     5   110.100000   289.532800   0.21790000     18853.10\n\
-  CG3RC1    CG311    OG311     5   110.100000   633.457600   0.00000000         0.00\n\
-  CG3RC1    CG311     HGA1     5   110.100000   288.696000   0.21790000     18853.10\n\
-  NG2R53    CG311     HGA1     5   108.000000   401.664000   0.00000000         0.00\n\
-   NG2S1    CG311     HGA1     5   108.000000   401.664000   0.00000000         0.00\n\
-   OG301    CG311     HGA1     5   109.500000   502.080000   0.00000000         0.00\n\
-   OG302    CG311     HGA1     5   109.500000   502.080000   0.00000000         0.00\n\
-   OG303    CG311     HGA1     5   109.500000   502.080000   0.00000000         0.00\n\
-   OG311    CG311    OG312     5   111.000000   936.379200   0.23500000     83680.00\n\
-   OG311    CG311     HGA1     5   108.890000   384.091200   0.00000000         0.00\n\
-   OG312    CG311     HGA1     5   117.800000   551.451200   0.00000000         0.00\n\
-   CLGA1    CG311    CLGA1     5   109.000000   794.960000   0.00000000         0.00\n\
-   CLGA1    CG311     HGA1     5   108.500000   368.192000   0.00000000         0.00\n\
-   BRGA2    CG311    BRGA2     5   110.000000   794.960000   0.00000000         0.00\n\
-   BRGA2    CG311     HGA1     5   107.000000   301.248000   0.00000000         0.00\n\
-  CG2R61    CG312      PG1     5   117.000000   753.120000   0.23000000     16736.00\n\
-  CG2R61    CG312      PG2     5   117.000000   753.120000   0.23000000     16736.00\n\
-  CG2R61    CG312     FGA2     5   115.000000   418.400000   0.23570000     25104.00\n\
-   CG331    CG312     FGA2     5   112.000000   418.400000   0.23570000     25104.00\n\
-   CG331    CG312     HGA7     5   112.000000   267.776000   0.21680000      2510.40\n\
-     PG1    CG312     FGA2     5   122.000000   418.400000   0.23570000     25104.00\n\
-     PG2    CG312     FGA2     5   122.000000   418.400000   0.23570000     25104.00\n\
-    FGA2    CG312     FGA2     5   107.000000  1255.200000   0.21700000      8368.00\n\
-    FGA2    CG312     HGA7     5   108.890000   350.619200   0.19800000      4184.00\n\
-   CG2O1    CG314    CG311     5   108.000000   435.136000   0.00000000         0.00\n\
-   CG2O1    CG314    CG321     5   108.000000   435.136000   0.00000000         0.00\n\
-   CG2O1    CG314    CG331     5   108.000000   435.136000   0.00000000         0.00\n\
-   CG2O1    CG314    NG3P3     5   110.000000   365.681600   0.00000000         0.00\n\
-   CG2O1    CG314     HGA1     5   109.500000   418.400000   0.00000000         0.00\n\
-   CG2O3    CG314    CG311     5   108.000000   435.136000   0.00000000         0.00\n\
-   CG2O3    CG314    CG321     5   108.000000   435.136000   0.00000000         0.00\n\
-   CG2O3    CG314    CG331     5   108.000000   435.136000   0.00000000         0.00\n\
-   CG2O3    CG314    NG3P3     5   110.000000   365.681600   0.00000000         0.00\n\
-   CG2O3    CG314     HGA1     5   109.500000   418.400000   0.00000000         0.00\n\
-   CG311    CG314    NG3P3     5   110.000000   566.513600   0.00000000         0.00\n\
-   CG311    CG314     HGA1     5   110.100000   288.696000   0.21790000     18853.10\n\
-   CG321    CG314    CG321     5   113.500000   488.272800   0.25610000      9338.69\n\
-   CG321    CG314    NG3P2     5   110.000000   334.720000   0.00000000         0.00\n\
-   CG321    CG314    NG3P3     5   110.000000   566.513600   0.00000000         0.00\n\
-   CG321    CG314     HGA1     5   110.100000   288.696000   0.21790000     18853.10\n\
-   CG331    CG314    NG3P3     5   110.000000   566.513600   0.00000000         0.00\n\
-   CG331    CG314     HGA1     5   110.100000   288.696000   0.21790000     18853.10\n\
-   NG3P2    CG314     HGA1     5   102.300000   376.560000   0.21010000     29288.00\n\
-   NG3P3    CG314     HGA1     5   107.500000   430.952000   0.00000000         0.00\n\
-   CG2D1    CG321    CG2D1     5   114.000000   251.040000   0.00000000         0.00\n\
-   CG2D1    CG321   CG2DC1     5   108.000000  1046.000000   0.00000000         0.00\n\
-   CG2D1    CG321   CG2DC2     5   108.000000  1046.000000   0.00000000         0.00\n\
-   CG2D1    CG321    CG311     5   112.200000   267.776000   0.00000000         0.00\n\
-   CG2D1    CG321    CG321     5   112.200000   267.776000   0.00000000         0.00\n\
-   CG2D1    CG321    CG331     5   112.200000   267.776000   0.00000000         0.00\n\
-   CG2D1    CG321    OG311     5   110.100000   633.457600   0.00000000         0.00\n\
-   CG2D1    CG321     HGA2     5   111.500000   376.560000   0.00000000         0.00\n\
-  CG2DC1    CG321    CG321     5   112.200000   267.776000   0.00000000         0.00\n\
-  CG2DC1    CG321    OG311     5   110.100000   633.457600   0.00000000         0.00\n\
-  CG2DC1    CG321   OG3R60     5    99.000000   167.360000   0.00000000         0.00\n\
-  CG2DC1    CG321     HGA2     5   111.500000   376.560000   0.00000000         0.00\n\
-  CG2DC2    CG321    CG321     5   112.200000   267.776000   0.00000000         0.00\n\
-  CG2DC2    CG321    OG311     5   110.100000   633.457600   0.00000000         0.00\n\
-  CG2DC2    CG321   OG3R60     5    99.000000   167.360000   0.00000000         0.00\n\
-  CG2DC2    CG321     HGA2     5   111.500000   376.560000   0.00000000         0.00\n\
-   CG2O1    CG321    CG311     5   108.000000   435.136000   0.00000000         0.00\n\
-   CG2O1    CG321    CG314     5   108.000000   435.136000   0.00000000         0.00\n\
-   CG2O1    CG321    CG321     5   108.000000   435.136000   0.00000000         0.00\n\
-   CG2O1    CG321    CG331     5   108.000000   435.136000   0.00000000         0.00\n\
-   CG2O1    CG321    NG2S1     5   107.000000   418.400000   0.00000000         0.00\n\
-   CG2O1    CG321     HGA2     5   109.500000   276.144000   0.21630000     25104.00\n\
-   CG2O2    CG321    CG311     5   108.000000   435.136000   0.00000000         0.00\n\
-   CG2O2    CG321    CG314     5   108.000000   435.136000   0.00000000         0.00\n\
-   CG2O2    CG321    CG321     5   108.000000   435.136000   0.00000000         0.00\n\
-   CG2O2    CG321    CG331     5   108.000000   435.136000   0.00000000         0.00\n\
-   CG2O2    CG321    NG2S1     5   107.000000   418.400000   0.00000000         0.00\n\
-   CG2O2    CG321    NG321     5   110.000000   365.681600   0.00000000         0.00\n\
-   CG2O2    CG321     HGA2     5   109.500000   276.144000   0.21630000     25104.00\n\
-   CG2O3    CG321    CG311     5   108.000000   435.136000   0.00000000         0.00\n\
-   CG2O3    CG321    CG314     5   108.000000   435.136000   0.00000000         0.00\n\
-   CG2O3    CG321    CG321     5   108.000000   435.136000   0.00000000         0.00\n\
-   CG2O3    CG321    CG331     5   108.000000   435.136000   0.00000000         0.00\n\
-   CG2O3    CG321    NG2S1     5   107.000000   418.400000   0.00000000         0.00\n\
-   CG2O3    CG321     HGA1     5   109.500000   418.400000   0.00000000         0.00\n\
-   CG2O3    CG321     HGA2     5   109.500000   276.144000   0.21630000     25104.00\n\
-   CG2O4    CG321    CG331     5   113.800000   502.080000   0.00000000         0.00\n\
-   CG2O4    CG321    CLGA1     5   111.820000   543.920000   0.00000000         0.00\n\
-   CG2O4    CG321     HGA2     5   109.500000   276.144000   0.21630000     25104.00\n\
-   CG2O5    CG321    CG321     5   113.800000   502.080000   0.00000000         0.00\n\
-   CG2O5    CG321    CG331     5   111.500000   502.080000   0.00000000         0.00\n\
-   CG2O5    CG321     HGA2     5   109.500000   418.400000   0.00000000         0.00\n\
-  CG2R51    CG321    CG311     5   114.000000   488.272800   0.00000000         0.00\n\
-  CG2R51    CG321    CG314     5   114.000000   488.272800   0.00000000         0.00\n\
-  CG2R51    CG321    CG331     5   114.000000   488.272800   0.00000000         0.00\n\
-  CG2R51    CG321     HGA2     5   109.500000   460.240000   0.00000000         0.00\n\
-  CG2R61    CG321   CG2R61     5   107.500000   433.462400   0.00000000         0.00\n\
-  CG2R61    CG321    CG311     5   107.500000   433.462400   0.00000000         0.00\n\
-  CG2R61    CG321    CG314     5   107.500000   433.462400   0.00000000         0.00\n\
-  CG2R61    CG321    CG321     5   107.500000   433.462400   0.00000000         0.00\n\
-  CG2R61    CG321    CG331     5   107.500000   433.462400   0.00000000         0.00\n\
-  CG2R61    CG321    OG302     5   110.100000   633.457600   0.00000000         0.00\n\
-  CG2R61    CG321    OG311     5   110.100000   633.457600   0.00000000         0.00\n\
-  CG2R61    CG321      PG1     5   111.000000   753.120000   0.23000000     16736.00\n\
-  CG2R61    CG321      PG2     5   111.000000   753.120000   0.23000000     16736.00\n\
-  CG2R61    CG321     HGA2     5   107.500000   412.542400   0.00000000         0.00\n\
-   CG301    CG321    CG321     5   113.500000   488.272800   0.25610000      9338.69\n\
-   CG301    CG321    CG331     5   113.500000   546.848800   0.00000000         0.00\n\
-   CG301    CG321     HGA2     5   110.100000   221.752000   0.21790000     18853.10\n\
-   CG302    CG321    OG311     5   110.100000   633.457600   0.00000000         0.00\n\
-   CG302    CG321     HGA2     5   110.100000   289.532800   0.21790000     18853.10\n\
-   CG311    CG321    CG311     5   113.500000   488.272800   0.25610000      9338.69\n\
-   CG311    CG321    CG314     5   113.500000   488.272800   0.25610000      9338.69\n\
-   CG311    CG321    CG321     5   113.500000   488.272800   0.25610000      9338.69\n\
-   CG311    CG321    CG324     5   110.500000   488.272800   0.25610000      9338.69\n\
-   CG311    CG321    CG331     5   113.500000   488.272800   0.25610000      9338.69\n\
-   CG311    CG321    NG2S1     5   113.500000   585.760000   0.00000000         0.00\n\
-   CG311    CG321    OG302     5   110.100000   633.457600   0.00000000         0.00\n\
-   CG311    CG321    OG303     5   110.100000   633.457600   0.00000000         0.00\n\
-   CG311    CG321    OG311     5   110.100000   633.457600   0.00000000         0.00\n\
-   CG311    CG321    SG311     5   112.500000   485.344000   0.00000000         0.00\n\
-   CG311    CG321     HGA2     5   110.100000   279.742240   0.21790000     18853.10\n\
-   CG314    CG321    CG321     5   113.500000   488.272800   0.25610000      9338.69\n\
-   CG314    CG321    NG2S1     5   113.500000   585.760000   0.00000000         0.00\n\
-   CG314    CG321    OG311     5   110.100000   633.457600   0.00000000         0.00\n\
-   CG314    CG321    SG311     5   112.500000   485.344000   0.00000000         0.00\n\
-   CG314    CG321     HGA2     5   110.100000   279.742240   0.21790000     18853.10\n\
-   CG321    CG321    CG321     5   113.600000   488.272800   0.25610000      9338.69\n\
-   CG321    CG321    CG324     5   110.500000   488.272800   0.25610000      9338.69\n\
-   CG321    CG321    CG331     5   115.000000   485.344000   0.25610000      6694.40\n\
-   CG321    CG321   CG3RC1     5   111.000000   446.432800   0.25610000      6694.40\n\
-   CG321    CG321    NG2S1     5   113.500000   585.760000   0.00000000         0.00\n\
-   CG321    CG321    OG301     5   111.500000   376.560000   0.00000000         0.00\n\
-   CG321    CG321    OG302     5   110.100000   633.457600   0.00000000         0.00\n\
-   CG321    CG321    OG303     5   110.100000   633.457600   0.00000000         0.00\n\
-   CG321    CG321    OG311     5   110.100000   633.457600   0.00000000         0.00\n\
-   CG321    CG321   OG3C61     5   111.500000   376.560000   0.00000000         0.00\n\
-   CG321    CG321    SG311     5   114.500000   485.344000   0.00000000         0.00\n\
-   CG321    CG321    SG3O1     5   105.500000   359.824000   0.00000000         0.00\n\
-   CG321    CG321     HGA2     5   110.100000   221.752000   0.21790000     18853.10\n\
-   CG324    CG321    CG331     5   110.500000   488.272800   0.25610000      9338.69\n\
-   CG324    CG321    OG302     5   110.100000   633.457600   0.00000000         0.00\n\
-   CG324    CG321    OG303     5   110.100000   633.457600   0.00000000         0.00\n\
-   CG324    CG321    OG311     5   112.100000   633.457600   0.00000000         0.00\n\
-   CG324    CG321   OG3C61     5   106.500000   418.400000   0.00000000         0.00\n\
-   CG324    CG321    SG311     5   110.000000   585.760000   0.00000000         0.00\n\
-   CG324    CG321     HGA2     5   110.100000   221.752000   0.21790000     18853.10\n\
-   CG331    CG321    CG331     5   114.000000   446.432800   0.25610000      6694.40\n\
-   CG331    CG321   CG3C31     5   111.000000   446.432800   0.00000000         0.00\n\
-   CG331    CG321    NG2S1     5   120.000000   585.760000   0.00000000         0.00\n\
-   CG331    CG321    NG311     5   112.200000   365.681600   0.00000000         0.00\n\
-   CG331    CG321    OG301     5   111.500000   376.560000   0.00000000         0.00\n\
-   CG331    CG321    OG302     5   110.100000   633.457600   0.00000000         0.00\n\
-   CG331    CG321    OG303     5   108.400000   585.760000   0.00000000         0.00\n\
-   CG331    CG321    OG311     5   110.100000   633.457600   0.00000000         0.00\n\
-   CG331    CG321    OG312     5   122.000000   543.920000   0.00000000         0.00\n\
-   CG331    CG321    SG301     5   112.500000   485.344000   0.00000000         0.00\n\
-   CG331    CG321    SG311     5   114.500000   485.344000   0.00000000         0.00\n\
-   CG331    CG321    SG3O1     5   105.500000   418.400000   0.00000000         0.00\n\
-   CG331    CG321    SG3O2     5   105.000000   376.560000   0.00000000         0.00\n\
-   CG331    CG321    SG3O3     5   105.000000   376.560000   0.00000000         0.00\n\
-   CG331    CG321    CLGA1     5   112.200000   594.128000   0.00000000         0.00\n\
-   CG331    CG321    BRGA1     5   111.000000   594.128000   0.00000000         0.00\n\
-   CG331    CG321     HGA2     5   110.100000   289.532800   0.21790000     18853.10\n\
-  CG3C31    CG321     HGA2     5   109.000000   351.456000   0.00000000         0.00\n\
-  CG3C51    CG321    OG301     5   110.100000   633.457600   0.00000000         0.00\n\
-  CG3C51    CG321    OG303     5   110.100000   633.457600   0.00000000         0.00\n\
-  CG3C51    CG321    OG311     5   110.100000   633.457600   0.00000000         0.00\n\
-  CG3C51    CG321    SG311     5   112.500000   485.344000   0.00000000         0.00\n\
-  CG3C51    CG321     HGA2     5   110.100000   289.532800   0.21790000     18853.10\n\
-  CG3RC1    CG321    OG303     5   110.100000   633.457600   0.00000000         0.00\n\
-  CG3RC1    CG321     HGA2     5   110.100000   288.696000   0.21790000     18853.10\n\
-   NG2S1    CG321     HGA2     5   109.500000   430.952000   0.00000000         0.00\n\
-   NG311    CG321    NG311     5   113.000000   753.120000   0.00000000         0.00\n\
-   NG311    CG321     HGA2     5   109.500000   271.123200   0.21300000     41840.00\n\
-   NG321    CG321     HGA2     5   109.500000   271.123200   0.21400000     41840.00\n\
-   OG301    CG321     HGA2     5   108.890000   384.091200   0.00000000         0.00\n\
-   OG302    CG321     HGA2     5   109.500000   502.080000   0.00000000         0.00\n\
-   OG303    CG321     HGA2     5   109.500000   502.080000   0.00000000         0.00\n\
-   OG311    CG321     HGA2     5   108.890000   384.091200   0.00000000         0.00\n\
-   OG312    CG321     HGA2     5   118.300000   543.920000   0.00000000         0.00\n\
-  OG3C61    CG321   OG3C61     5   110.500000   376.560000   0.00000000         0.00\n\
-  OG3C61    CG321     HGA2     5   109.500000   376.560000   0.00000000         0.00\n\
-  OG3R60    CG321     HGA2     5   111.500000   460.240000   0.00000000         0.00\n\
-     PG1    CG321     HGA2     5   110.000000   753.120000   0.18020000      4518.72\n\
-     PG2    CG321     HGA2     5   110.000000   753.120000   0.18020000      4518.72\n\
-   SG301    CG321     HGA2     5   111.000000   317.984000   0.00000000         0.00\n\
-   SG311    CG321    SG311     5   117.000000   836.800000   0.00000000         0.00\n\
-   SG311    CG321     HGA2     5   111.300000   385.764800   0.00000000         0.00\n\
-   SG3O1    CG321     HGA2     5   109.000000   410.032000   0.00000000         0.00\n\
-   SG3O2    CG321     HGA2     5   107.000000   376.560000   0.00000000         0.00\n\
-   SG3O3    CG321     HGA2     5   107.000000   376.560000   0.00000000         0.00\n\
-   CLGA1    CG321     HGA2     5   107.000000   351.456000   0.00000000         0.00\n\
-   BRGA1    CG321     HGA2     5   106.000000   301.248000   0.00000000         0.00\n\
-    HGA2    CG321     HGA2     5   109.000000   297.064000   0.18020000      4518.72\n\
-   CG331    CG322     FGA1     5   112.000000   368.192000   0.23690000     25104.00\n\
-   CG331    CG322     HGA6     5   112.000000   259.408000   0.21680000      2510.40\n\
-    FGA1    CG322     HGA6     5   108.890000   481.160000   0.19970000      4184.00\n\
-    HGA6    CG322     HGA6     5   108.400000   297.064000   0.17460000      8702.72\n\
-   CG331    CG323    SG302     5   118.000000   460.240000   0.00000000         0.00\n\
-   CG331    CG323     HGA2     5   110.100000   289.532800   0.21790000     18853.10\n\
-   SG302    CG323     HGA2     5   112.300000   334.720000   0.00000000         0.00\n\
-   SG302    CG323     HGA3     5   112.300000   334.720000   0.00000000         0.00\n\
-    HGA2    CG323     HGA2     5   108.400000   297.064000   0.17750000     11715.20\n\
-    HGA3    CG323     HGA3     5   108.400000   297.064000   0.17750000     11715.20\n\
-   CG2O1    CG324    NG3P3     5   110.000000   365.681600   0.00000000         0.00\n\
-   CG2O1    CG324     HGA2     5   109.500000   276.144000   0.21630000     25104.00\n\
-   CG2O3    CG324    NG3P3     5   110.000000   365.681600   0.00000000         0.00\n\
-   CG2O3    CG324     HGA2     5   109.500000   276.144000   0.21630000     25104.00\n\
-  CG2R61    CG324    NG3P1     5   102.300000   376.560000   0.21010000     29288.00\n\
-  CG2R61    CG324     HGA2     5   107.500000   412.542400   0.00000000         0.00\n\
-   CG311    CG324    NG3P1     5   110.000000   836.800000   0.00000000         0.00\n\
-   CG311    CG324    NG3P2     5   110.000000   334.720000   0.00000000         0.00\n\
-   CG311    CG324     HGA2     5   111.800000   221.752000   0.21790000     18853.10\n\
-   CG321    CG324    NG2O1     5   109.000000   475.302400   0.00000000         0.00\n\
-   CG321    CG324    NG2P1     5   110.000000   566.513600   0.00000000         0.00\n\
-   CG321    CG324    NG3P0     5   115.000000   566.513600   0.00000000         0.00\n\
-   CG321    CG324    NG3P1     5   110.000000   836.800000   0.00000000         0.00\n\
-   CG321    CG324    NG3P2     5   110.000000   334.720000   0.00000000         0.00\n\
-   CG321    CG324    NG3P3     5   110.000000   566.513600   0.00000000         0.00\n\
-   CG321    CG324     HGA2     5   111.800000   221.752000   0.21790000     18853.10\n\
-   CG321    CG324     HGP5     5   110.100000   279.742240   0.21790000     18853.10\n\
-   CG331    CG324    NG3P0     5   115.000000   566.513600   0.00000000         0.00\n\
-   CG331    CG324    NG3P3     5   110.000000   566.513600   0.00000000         0.00\n\
-   CG331    CG324     HGA2     5   110.100000   289.532800   0.21790000     18853.10\n\
-   CG331    CG324     HGP5     5   110.100000   279.742240   0.21790000     18853.10\n\
-  CG3C31    CG324    NG3P3     5   110.000000   566.513600   0.00000000         0.00\n\
-  CG3C31    CG324     HGA2     5   110.100000   289.532800   0.00000000         0.00\n\
-   NG2O1    CG324     HGA2     5   106.300000   502.080000   0.00000000         0.00\n\
-   NG2P1    CG324     HGA2     5   110.100000   351.456000   0.00000000         0.00\n\
-   NG3P0    CG324     HGP5     5   109.500000   334.720000   0.21300000     22593.60\n\
-   NG3P1    CG324     HGA2     5   102.300000   376.560000   0.21010000     29288.00\n\
-   NG3P2    CG324     HGA2     5   102.300000   376.560000   0.21010000     29288.00\n\
-   NG3P3    CG324     HGA2     5   107.500000   376.560000   0.21010000     29288.00\n\
-    HGA2    CG324     HGA2     5   109.000000   297.064000   0.18020000      4518.72\n\
-    HGP5    CG324     HGP5     5   109.500000   200.832000   0.17670000     23430.40\n\
-   CG1N1    CG331     HGA3     5   110.500000   418.400000   0.00000000         0.00\n\
-   CG1T1    CG331     HGA3     5   111.500000   393.296000   0.00000000         0.00\n\
-   CG2D1    CG331     HGA3     5   111.500000   351.456000   0.00000000         0.00\n\
-  CG2DC1    CG331     HGA3     5   111.500000   351.456000   0.00000000         0.00\n\
-  CG2DC2    CG331     HGA3     5   111.500000   351.456000   0.00000000         0.00\n\
-   CG2N2    CG331     HGA3     5   109.500000   276.144000   0.21300000     25104.00\n\
-   CG2O1    CG331     HGA3     5   109.500000   276.144000   0.21630000     25104.00\n\
-   CG2O2    CG331     HGA3     5   109.500000   276.144000   0.21630000     25104.00\n\
-   CG2O3    CG331     HGA3     5   109.500000   276.144000   0.21630000     25104.00\n\
-   CG2O4    CG331     HGA3     5   109.500000   276.144000   0.21630000     25104.00\n\
-   CG2O5    CG331     HGA3     5   109.500000   418.400000   0.00000000         0.00\n\
-  CG2R51    CG331     HGA3     5   109.500000   460.240000   0.00000000         0.00\n\
-  CG2R61    CG331     HGA3     5   107.500000   412.542400   0.00000000         0.00\n\
-  CG2R62    CG331     HGA3     5   110.100000   279.742240   0.21790000     18853.10\n\
-   CG301    CG331     HGA3     5   110.100000   279.742240   0.21790000     18853.10\n\
-   CG302    CG331     HGA3     5   110.500000   276.144000   0.21550000     32635.20\n\
-   CG311    CG331     HGA3     5   110.100000   279.742240   0.21790000     18853.10\n\
-   CG312    CG331     HGA3     5   110.500000   276.144000   0.21680000     30961.60\n\
-   CG314    CG331     HGA3     5   110.100000   279.742240   0.21790000     18853.10\n\
-   CG321    CG331     HGA3     5   110.100000   289.532800   0.21790000     18853.10\n\
-   CG322    CG331     HGA3     5   110.500000   276.144000   0.21810000     31798.40\n\
-   CG323    CG331     HGA3     5   110.100000   289.532800   0.21790000     18853.10\n\
-   CG324    CG331     HGA3     5   110.100000   289.532800   0.21790000     18853.10\n\
-   CG331    CG331     HGA3     5   110.100000   313.800000   0.21790000     18853.10\n\
-  CG3C51    CG331     HGA3     5   110.100000   289.532800   0.21790000     18853.10\n\
-  CG3RC1    CG331     HGA3     5   110.100000   279.742240   0.21790000     18853.10\n\
-   NG2D1    CG331     HGA3     5   113.500000   351.456000   0.00000000         0.00\n\
-  NG2R51    CG331     HGA3     5   110.100000   279.742240   0.00000000         0.00\n\
-  NG2R61    CG331     HGA3     5   110.100000   279.742240   0.21790000     18853.10\n\
-   NG2S0    CG331     HGA3     5   105.000000   418.400000   0.00000000         0.00\n\
-   NG2S1    CG331     HGA3     5   109.500000   430.952000   0.00000000         0.00\n\
-   NG2S3    CG331     HGA3     5   107.500000   430.952000   0.00000000         0.00\n\
-   NG311    CG331     HGA3     5   109.700000   255.224000   0.21400000     41840.00\n\
-   OG301    CG331     HGA3     5   108.890000   384.091200   0.00000000         0.00\n\
-   OG302    CG331     HGA3     5   109.500000   502.080000   0.00000000         0.00\n\
-   OG303    CG331     HGA3     5   109.500000   502.080000   0.00000000         0.00\n\
-   OG311    CG331     HGA3     5   108.890000   384.091200   0.00000000         0.00\n\
-   OG312    CG331     HGA3     5   118.300000   543.920000   0.00000000         0.00\n\
-   SG301    CG331     HGA3     5   111.000000   317.984000   0.00000000         0.00\n\
-   SG311    CG331     HGA3     5   111.300000   385.764800   0.00000000         0.00\n\
-   SG3O1    CG331     HGA3     5   110.600000   351.456000   0.00000000         0.00\n\
-   SG3O2    CG331     HGA3     5   108.500000   376.560000   0.00000000         0.00\n\
-   SG3O3    CG331     HGA3     5   111.300000   385.764800   0.00000000         0.00\n\
-    HGA3    CG331     HGA3     5   108.400000   297.064000   0.18020000      4518.72\n\
-   NG2O1    CG334     HGA3     5   108.000000   399.990400   0.00000000         0.00\n\
-   NG2P1    CG334     HGA3     5   110.100000   351.456000   0.00000000         0.00\n\
-   NG3P0    CG334     HGP5     5   109.500000   334.720000   0.21300000     22593.60\n\
-   NG3P1    CG334     HGA3     5   102.300000   376.560000   0.21010000     29288.00\n\
-   NG3P3    CG334     HGA3     5   107.500000   376.560000   0.21010000     29288.00\n\
-    HGA3    CG334     HGA3     5   108.400000   297.064000   0.18020000      4518.72\n\
-    HGP5    CG334     HGP5     5   109.500000   200.832000   0.17670000     23430.40\n\
-   NG301   CG3AM0   HGAAM0     5   109.500000   292.880000   0.21400000     41840.00\n\
-  HGAAM0   CG3AM0   HGAAM0     5   108.400000   297.064000   0.18020000      4518.72\n\
-   NG311   CG3AM1   HGAAM1     5   109.700000   255.224000   0.21400000     41840.00\n\
-  HGAAM1   CG3AM1   HGAAM1     5   109.000000   299.574400   0.18020000      4518.72\n\
-   NG321   CG3AM2   HGAAM2     5   109.500000   271.123200   0.21400000     41840.00\n\
-  HGAAM2   CG3AM2   HGAAM2     5   109.470000   292.880000   0.18020000      4518.72\n\
-   CG321   CG3C31   CG3C31     5   116.700000   563.584800   0.00000000         0.00\n\
-   CG321   CG3C31   OG3C31     5   115.500000   505.008800   0.00000000         0.00\n\
-   CG321   CG3C31     HGA1     5   115.400000   251.040000   0.00000000         0.00\n\
-   CG324   CG3C31   CG3C31     5   120.000000   488.272800   0.00000000         0.00\n\
-   CG324   CG3C31     HGA1     5   110.100000   289.532800   0.00000000         0.00\n\
-  CG3C31   CG3C31   CG3C31     5   111.000000   647.264800   0.25610000      6694.40\n\
-  CG3C31   CG3C31   OG3C31     5   103.000000   251.040000   0.00000000         0.00\n\
-  CG3C31   CG3C31     HGA1     5   117.100000   192.464000   0.21790000     18853.10\n\
-  CG3C31   CG3C31     HGA2     5   117.100000   192.464000   0.21790000     18853.10\n\
-  CG3RC1   CG3C31   CG3RC1     5    58.500000   446.432800   0.00000000         0.00\n\
-  CG3RC1   CG3C31     HGA2     5   110.100000   288.696000   0.21790000     18853.10\n\
-  OG3C31   CG3C31     HGA1     5   118.500000   535.552000   0.00000000         0.00\n\
-  OG3C31   CG3C31     HGA2     5   115.000000   573.208000   0.00000000         0.00\n\
-    HGA2   CG3C31     HGA2     5   117.000000   192.464000   0.18020000      4518.72\n\
-  CG2R53   CG3C41   CG3C41     5   106.000000   753.120000   0.00000000         0.00\n\
-  CG2R53   CG3C41     HGA2     5   112.300000   384.928000   0.00000000         0.00\n\
-  CG3C41   CG3C41   CG3C41     5   106.000000   585.760000   0.00000000         0.00\n\
-  CG3C41   CG3C41   NG2R43     5   104.500000   753.120000   0.00000000         0.00\n\
-  CG3C41   CG3C41     HGA2     5   110.500000   384.928000   0.00000000         0.00\n\
-  NG2R43   CG3C41     HGA2     5   110.800000   426.768000   0.00000000         0.00\n\
-    HGA2   CG3C41     HGA2     5   105.000000   234.304000   0.18067000      4518.72\n\
-   CG2O1   CG3C51   CG3C52     5   112.300000   435.136000   0.00000000         0.00\n\
-   CG2O1   CG3C51    NG2S0     5   108.200000   418.400000   0.00000000         0.00\n\
-   CG2O1   CG3C51     HGA1     5   112.000000   418.400000   0.00000000         0.00\n\
-   CG2O3   CG3C51   CG3C52     5   112.300000   435.136000   0.00000000         0.00\n\
-   CG2O3   CG3C51    NG2S0     5   108.200000   418.400000   0.00000000         0.00\n\
-   CG2O3   CG3C51     HGA1     5   112.000000   418.400000   0.00000000         0.00\n\
-   CG311   CG3C51   CG3C52     5   115.000000   485.344000   0.25610000      6694.40\n\
-   CG311   CG3C51   CG3RC1     5   108.000000   435.136000   0.00000000         0.00\n\
-   CG311   CG3C51     HGA1     5   110.100000   289.532800   0.21790000     18853.10\n\
-   CG321   CG3C51   CG3C51     5   115.000000   485.344000   0.25610000      6694.40\n\
-   CG321   CG3C51   CG3C52     5   115.000000   485.344000   0.25610000      6694.40\n\
-   CG321   CG3C51   CG3RC1     5   103.700000   446.432800   0.25610000      6694.40\n\
-   CG321   CG3C51   OG3C51     5   111.500000   376.560000   0.00000000         0.00\n\
-   CG321   CG3C51     HGA1     5   110.100000   289.532800   0.21790000     18853.10\n\
-   CG331   CG3C51   CG3C51     5   115.000000   485.344000   0.25610000      6694.40\n\
-   CG331   CG3C51   CG3C52     5   115.000000   485.344000   0.25610000      6694.40\n\
-   CG331   CG3C51   CG3RC1     5   108.500000   446.432800   0.25610000      6694.40\n\
-   CG331   CG3C51   OG3C51     5   111.500000   376.560000   0.00000000         0.00\n\
-   CG331   CG3C51     HGA1     5   110.100000   289.532800   0.21790000     18853.10\n\
-  CG3C51   CG3C51   CG3C51     5   109.500000   485.344000   0.25610000      9338.69\n\
-  CG3C51   CG3C51   CG3C52     5   109.500000   485.344000   0.25610000      9338.69\n\
-  CG3C51   CG3C51   CG3C53     5   111.000000   446.432800   0.25610000      6694.40\n\
-  CG3C51   CG3C51   CG3RC1     5   103.700000   446.432800   0.25610000      6694.40\n\
-  CG3C51   CG3C51   NG2R51     5   111.000000   920.480000   0.00000000         0.00\n\
-  CG3C51   CG3C51   NG2R61     5   111.000000   920.480000   0.00000000         0.00\n\
-  CG3C51   CG3C51    NG2S3     5   110.000000   365.681600   0.00000000         0.00\n\
-  CG3C51   CG3C51    NG301     5   111.000000   920.480000   0.00000000         0.00\n\
-  CG3C51   CG3C51    NG321     5   107.500000   566.513600   0.00000000         0.00\n\
-  CG3C51   CG3C51    OG303     5   109.700000   962.320000   0.00000000         0.00\n\
-  CG3C51   CG3C51    OG311     5   110.100000   633.457600   0.00000000         0.00\n\
-  CG3C51   CG3C51   OG3C51     5   111.100000   376.560000   0.00000000         0.00\n\
-  CG3C51   CG3C51     FGA1     5   112.000000   368.192000   0.23690000     25104.00\n\
-  CG3C51   CG3C51     HGA1     5   111.400000   292.880000   0.21790000     18853.10\n\
-  CG3C51   CG3C51     HGA6     5   111.400000   292.880000   0.21790000     18853.10\n\
-  CG3C52   CG3C51   CG3C52     5   109.500000   485.344000   0.25610000      9338.69\n\
-  CG3C52   CG3C51   CG3RC1     5   103.700000   446.432800   0.25610000      6694.40\n\
-  CG3C52   CG3C51   NG2R51     5   113.700000  1171.520000   0.00000000         0.00\n\
-  CG3C52   CG3C51   NG2R61     5   113.700000   920.480000   0.00000000         0.00\n\
-  CG3C52   CG3C51    NG2S0     5   110.800000   585.760000   0.00000000         0.00\n\
-  CG3C52   CG3C51    NG2S3     5   110.000000   365.681600   0.00000000         0.00\n\
-  CG3C52   CG3C51    NG321     5   107.500000   566.513600   0.00000000         0.00\n\
-  CG3C52   CG3C51    OG301     5   106.500000   485.344000   0.25610000      6694.40\n\
-  CG3C52   CG3C51    OG303     5   109.700000   962.320000   0.00000000         0.00\n\
-  CG3C52   CG3C51    OG311     5   110.000000   633.457600   0.00000000         0.00\n\
-  CG3C52   CG3C51   OG3C51     5   111.100000   376.560000   0.00000000         0.00\n\
-  CG3C52   CG3C51     FGA1     5   112.000000   368.192000   0.23690000     25104.00\n\
-  CG3C52   CG3C51     HGA1     5   111.400000   292.880000   0.21790000     18853.10\n\
-  CG3C52   CG3C51     HGA6     5   111.400000   292.880000   0.21790000     18853.10\n\
-  CG3C53   CG3C51    OG311     5   110.100000   633.457600   0.00000000         0.00\n\
-  CG3C53   CG3C51     HGA1     5   110.100000   288.696000   0.21790000     18853.10\n\
-  CG3RC1   CG3C51   NG2R51     5   108.000000   920.480000   0.00000000         0.00\n\
-  CG3RC1   CG3C51   NG2R61     5   108.000000   920.480000   0.00000000         0.00\n\
-  CG3RC1   CG3C51    OG303     5   110.100000   633.457600   0.00000000         0.00\n\
-  CG3RC1   CG3C51    OG311     5   110.100000   633.457600   0.00000000         0.00\n\
-  CG3RC1   CG3C51     HGA1     5   110.100000   288.696000   0.21790000     18853.10\n\
-  NG2R51   CG3C51   OG3C51     5   108.000000  1171.520000   0.00000000         0.00\n\
-  NG2R51   CG3C51     HGA1     5   111.000000   359.824000   0.00000000         0.00\n\
-  NG2R61   CG3C51   OG3C51     5   108.000000   920.480000   0.00000000         0.00\n\
-  NG2R61   CG3C51     HGA1     5   111.000000   359.824000   0.00000000         0.00\n\
-   NG2S0   CG3C51     HGA1     5   112.000000   401.664000   0.00000000         0.00\n\
-   NG2S3   CG3C51     HGA1     5   110.000000   401.664000   0.00000000         0.00\n\
-   NG301   CG3C51   OG3C51     5   112.000000   920.480000   0.00000000         0.00\n\
-   NG301   CG3C51     HGA1     5   111.000000   359.824000   0.00000000         0.00\n\
-   NG321   CG3C51     HGA1     5   109.500000   271.123200   0.21400000     41840.00\n\
-   OG301   CG3C51     HGA1     5   108.500000   384.091200   0.00000000         0.00\n\
-   OG303   CG3C51     HGA1     5   109.500000   502.080000   0.00000000         0.00\n\
-   OG311   CG3C51     HGA1     5   108.890000   384.091200   0.00000000         0.00\n\
-  OG3C51   CG3C51     HGA1     5   107.300000   585.760000   0.00000000         0.00\n\
-    FGA1   CG3C51     HGA6     5   108.890000   481.160000   0.19970000      4184.00\n\
-  CG2R51   CG3C52   CG2R51     5   107.600000   635.968000   0.00000000         0.00\n\
-  CG2R51   CG3C52   CG2R52     5   106.000000   702.912000   0.00000000         0.00\n\
-  CG2R51   CG3C52   CG2RC0     5   107.300000   334.720000   0.00000000         0.00\n\
-  CG2R51   CG3C52   CG3C52     5   106.000000   435.136000   0.00000000         0.00\n\
-  CG2R51   CG3C52   CG3C54     5   103.300000   435.136000   0.00000000         0.00\n\
-  CG2R51   CG3C52   NG2R50     5   111.600000   878.640000   0.00000000         0.00\n\
-  CG2R51   CG3C52   NG3C51     5   105.100000   585.760000   0.00000000         0.00\n\
-  CG2R51   CG3C52     HGA2     5   112.600000   435.136000   0.00000000         0.00\n\
-  CG2R52   CG3C52   CG2RC0     5   105.000000   585.760000   0.00000000         0.00\n\
-  CG2R52   CG3C52   CG3C52     5    99.000000   669.440000   0.00000000         0.00\n\
-  CG2R52   CG3C52     HGA2     5   112.200000   485.344000   0.00000000         0.00\n\
-  CG2R53   CG3C52   CG3C52     5   106.500000   585.760000   0.00000000         0.00\n\
-  CG2R53   CG3C52     HGA2     5   111.000000   485.344000   0.00000000         0.00\n\
-  CG2RC0   CG3C52   CG2RC0     5    95.000000   334.720000   0.00000000         0.00\n\
-  CG2RC0   CG3C52   CG3C52     5   108.200000   543.920000   0.00000000         0.00\n\
-  CG2RC0   CG3C52     HGA2     5   114.000000   317.984000   0.00000000         0.00\n\
-  CG3C51   CG3C52   CG3C51     5   109.500000   485.344000   0.25610000      9338.69\n\
-  CG3C51   CG3C52   CG3C52     5   109.500000   485.344000   0.25610000      9338.69\n\
-  CG3C51   CG3C52   CG3RC1     5   105.500000   669.440000   0.25610000      6694.40\n\
-  CG3C51   CG3C52   NG3C51     5   107.600000   702.912000   0.00000000         0.00\n\
-  CG3C51   CG3C52   OG3C51     5   111.100000   376.560000   0.00000000         0.00\n\
-  CG3C51   CG3C52     HGA2     5   111.400000   292.880000   0.21790000     18853.10\n\
-  CG3C52   CG3C52   CG3C52     5   109.500000   485.344000   0.25610000      9338.69\n\
-  CG3C52   CG3C52   CG3C53     5   108.500000   585.760000   0.00000000         0.00\n\
-  CG3C52   CG3C52   CG3C54     5   108.500000   585.760000   0.00000000         0.00\n\
-  CG3C52   CG3C52   CG3RC1     5   111.000000   446.432800   0.25610000      6694.40\n\
-  CG3C52   CG3C52   NG2R50     5   107.100000   334.720000   0.00000000         0.00\n\
-  CG3C52   CG3C52   NG2R53     5   104.500000   753.120000   0.00000000         0.00\n\
-  CG3C52   CG3C52    NG2S0     5   110.500000   585.760000   0.00000000         0.00\n\
-  CG3C52   CG3C52   NG3C51     5   107.600000   702.912000   0.00000000         0.00\n\
-  CG3C52   CG3C52   OG3C51     5   111.100000   376.560000   0.00000000         0.00\n\
-  CG3C52   CG3C52     HGA2     5   111.400000   292.880000   0.21790000     18853.10\n\
-  CG3C53   CG3C52     HGA2     5   110.100000   279.742240   0.21790000     18853.10\n\
-  CG3C54   CG3C52   NG3C51     5   110.400000   728.016000   0.00000000         0.00\n\
-  CG3C54   CG3C52     HGA2     5   110.100000   221.752000   0.21790000     18853.10\n\
-  CG3RC1   CG3C52   CG3RC1     5   105.300000   485.344000   0.00000000         0.00\n\
-  CG3RC1   CG3C52     HGA2     5   110.100000   288.696000   0.21790000     18853.10\n\
-  NG2R50   CG3C52     HGA2     5   109.800000   368.192000   0.00000000         0.00\n\
-  NG2R53   CG3C52     HGA2     5   111.000000   493.712000   0.00000000         0.00\n\
-   NG2S0   CG3C52     HGA2     5   108.000000   401.664000   0.00000000         0.00\n\
-  NG3C51   CG3C52     HGA2     5   109.000000   451.872000   0.00000000         0.00\n\
-  OG3C51   CG3C52   OG3C51     5   108.100000   711.280000   0.00000000         0.00\n\
-  OG3C51   CG3C52     HGA2     5   107.300000   585.760000   0.00000000         0.00\n\
-    HGA2   CG3C52     HGA2     5   106.800000   322.168000   0.18020000      4518.72\n\
-   CG2O1   CG3C53   CG3C52     5   112.300000   435.136000   0.00000000         0.00\n\
-   CG2O1   CG3C53    NG3P2     5   106.000000   418.400000   0.00000000         0.00\n\
-   CG2O1   CG3C53     HGA1     5   112.000000   418.400000   0.00000000         0.00\n\
-   CG2O3   CG3C53   CG3C52     5   112.300000   435.136000   0.00000000         0.00\n\
-   CG2O3   CG3C53    NG3P2     5   106.000000   418.400000   0.00000000         0.00\n\
-   CG2O3   CG3C53     HGA1     5   112.000000   418.400000   0.00000000         0.00\n\
-  CG3C51   CG3C53   NG2R61     5   111.000000   920.480000   0.00000000         0.00\n\
-  CG3C51   CG3C53   OG3C51     5   106.250000  1004.160000   0.00000000         0.00\n\
-  CG3C51   CG3C53     HGA1     5   110.100000   288.696000   0.21790000     18853.10\n\
-  CG3C52   CG3C53    NG3P2     5   108.500000   585.760000   0.00000000         0.00\n\
-  CG3C52   CG3C53     HGA1     5   118.000000   292.880000   0.00000000         0.00\n\
-  NG2R61   CG3C53   OG3C51     5   108.000000   920.480000   0.00000000         0.00\n\
-  NG2R61   CG3C53     HGA1     5   111.000000   359.824000   0.00000000         0.00\n\
-   NG3P2   CG3C53     HGA1     5   107.500000   430.952000   0.00000000         0.00\n\
-  OG3C51   CG3C53     HGA1     5   107.240000   378.233600   0.00000000         0.00\n\
-  CG2R51   CG3C54   NG2R52     5   103.100000  1154.784000   0.00000000         0.00\n\
-  CG2R51   CG3C54    NG3P2     5   103.000000   518.816000   0.00000000         0.00\n\
-  CG2R51   CG3C54     HGA2     5   114.800000   343.088000   0.00000000         0.00\n\
-  CG3C52   CG3C54    NG3P2     5   108.500000   585.760000   0.00000000         0.00\n\
-  CG3C52   CG3C54     HGA2     5   110.100000   221.752000   0.21790000     18853.10\n\
-  CG3C54   CG3C54   NG2R52     5   106.000000   569.024000   0.00000000         0.00\n\
-  CG3C54   CG3C54     HGA2     5   110.100000   221.752000   0.21790000     18853.10\n\
-  NG2R52   CG3C54     HGA2     5   107.000000   451.872000   0.00000000         0.00\n\
-  NG3C51   CG3C54    NG3P2     5   119.000000   719.648000   0.00000000         0.00\n\
-  NG3C51   CG3C54     HGA2     5   114.600000   443.504000   0.00000000         0.00\n\
-   NG3P2   CG3C54     HGA2     5   109.150000   430.952000   0.00000000         0.00\n\
-    HGA2   CG3C54     HGA2     5   109.000000   297.064000   0.18020000      4518.72\n\
-   CG311   CG3RC1    CG331     5   113.500000   488.272800   0.25610000      9338.69\n\
-   CG311   CG3RC1   CG3C51     5   113.500000   488.272800   0.25610000      9338.69\n\
-   CG311   CG3RC1   CG3C52     5   111.000000   446.432800   0.25610000      6694.40\n\
-   CG311   CG3RC1   CG3RC1     5   108.000000   446.432800   0.25610000      6694.40\n\
-   CG311   CG3RC1     HGA1     5   110.100000   288.696000   0.21790000     18853.10\n\
-   CG321   CG3RC1    CG331     5   113.500000   488.272800   0.25610000      9338.69\n\
-   CG321   CG3RC1   CG3C31     5   111.000000   446.432800   0.25610000      6694.40\n\
-   CG321   CG3RC1   CG3C51     5   111.000000   446.432800   0.25610000      6694.40\n\
-   CG321   CG3RC1   CG3C52     5   113.500000   488.272800   0.25610000      9338.69\n\
-   CG321   CG3RC1   CG3RC1     5   111.000000   446.432800   0.25610000      6694.40\n\
-   CG321   CG3RC1     HGA1     5   110.100000   288.696000   0.21790000     18853.10\n\
-   CG331   CG3RC1   CG3C51     5   113.500000   488.272800   0.25610000      9338.69\n\
-   CG331   CG3RC1   CG3RC1     5   113.500000   488.272800   0.25610000      9338.69\n\
-  CG3C31   CG3RC1   CG3C51     5   111.000000   446.432800   0.25610000      6694.40\n\
-  CG3C31   CG3RC1   CG3C52     5   111.000000   446.432800   0.25610000      6694.40\n\
-  CG3C31   CG3RC1   CG3RC1     5    62.500000   446.432800   0.00000000         0.00\n\
-  CG3C31   CG3RC1   NG2R51     5   113.700000   585.760000   0.00000000         0.00\n\
-  CG3C31   CG3RC1   NG2R61     5   113.700000   585.760000   0.00000000         0.00\n\
-  CG3C31   CG3RC1     HGA1     5   110.100000   288.696000   0.21790000     18853.10\n\
-  CG3C51   CG3RC1   CG3C52     5   109.000000   585.760000   0.00000000         0.00\n\
-  CG3C51   CG3RC1   CG3RC1     5   108.000000   446.432800   0.25610000      6694.40\n\
-  CG3C51   CG3RC1     HGA1     5   110.100000   288.696000   0.21790000     18853.10\n\
-  CG3C52   CG3RC1   CG3C52     5   109.400000   468.608000   0.00000000         0.00\n\
-  CG3C52   CG3RC1   CG3RC1     5   111.000000   446.432800   0.25610000      6694.40\n\
-  CG3C52   CG3RC1   NG2R51     5   113.700000   585.760000   0.00000000         0.00\n\
-  CG3C52   CG3RC1   NG2R61     5   113.700000   585.760000   0.00000000         0.00\n\
-  CG3C52   CG3RC1     HGA1     5   110.100000   288.696000   0.21790000     18853.10\n\
-  CG3RC1   CG3RC1   NG2R51     5   113.700000   585.760000   0.00000000         0.00\n\
-  CG3RC1   CG3RC1   NG2R61     5   113.700000   585.760000   0.00000000         0.00\n\
-  CG3RC1   CG3RC1   OG3C51     5   109.000000   418.400000   0.00000000         0.00\n\
-  CG3RC1   CG3RC1     HGA1     5   110.100000   288.696000   0.21790000     18853.10\n\
-  OG3C51   CG3RC1   OG3C51     5   105.000000   585.760000   0.00000000         0.00\n\
-  OG3C51   CG3RC1     HGA1     5   106.000000   460.240000   0.00000000         0.00\n\
-   CG2D1    NG2D1    CG331     5   111.000000   560.656000   0.00000000         0.00\n\
-   CG2D1    NG2D1    NG2S1     5   115.000000   836.800000   0.00000000         0.00\n\
-  CG2DC1    NG2D1    NG2S1     5   115.000000   836.800000   0.00000000         0.00\n\
-  CG2DC2    NG2D1    NG2S1     5   115.000000   836.800000   0.00000000         0.00\n\
-   CG2N1    NG2D1    CG331     5   108.000000   418.400000   0.00000000         0.00\n\
-   CG2N1    NG2D1     HGP1     5   113.000000   410.032000   0.00000000         0.00\n\
-  CG2R61    NG2O1    OG2N1     5   116.000000   543.920000   0.00000000         0.00\n\
-   CG324    NG2O1    OG2N1     5   117.000000   468.608000   0.00000000         0.00\n\
-   CG334    NG2O1    OG2N1     5   120.000000   502.080000   0.00000000         0.00\n\
-   OG2N1    NG2O1    OG2N1     5   128.000000   878.640000   0.00000000         0.00\n\
-   CG2D1    NG2P1    CG334     5   123.600000   560.656000   0.00000000         0.00\n\
-   CG2D1    NG2P1     HGP2     5   118.800000   317.984000   0.00000000         0.00\n\
-  CG2DC1    NG2P1    CG334     5   123.600000   560.656000   0.00000000         0.00\n\
-  CG2DC1    NG2P1     HGP2     5   118.800000   317.984000   0.00000000         0.00\n\
-  CG2DC2    NG2P1    CG334     5   123.600000   560.656000   0.00000000         0.00\n\
-  CG2DC2    NG2P1     HGP2     5   118.800000   317.984000   0.00000000         0.00\n\
-   CG2N1    NG2P1    CG324     5   120.000000   521.326400   0.00000000         0.00\n\
-   CG2N1    NG2P1    CG334     5   120.000000   521.326400   0.00000000         0.00\n\
-   CG2N1    NG2P1     HGP2     5   120.000000   410.032000   0.00000000         0.00\n\
-   CG2N2    NG2P1     HGP2     5   120.000000   334.720000   0.00000000         0.00\n\
-   CG324    NG2P1     HGP2     5   120.000000   338.067200   0.00000000         0.00\n\
-   CG334    NG2P1     HGP2     5   120.000000   338.067200   0.00000000         0.00\n\
-    HGP2    NG2P1     HGP2     5   120.000000   209.200000   0.00000000         0.00\n\
-  CG2R53   NG2R43   CG3C41     5   111.500000   711.280000   0.00000000         0.00\n\
-  CG2R53   NG2R43     HGP1     5   129.700000   284.512000   0.00000000         0.00\n\
-  CG3C41   NG2R43     HGP1     5   125.300000   284.512000   0.00000000         0.00\n\
-  CG2R51   NG2R50   CG2R52     5   103.000000   485.344000   0.00000000         0.00\n\
-  CG2R51   NG2R50   CG2R53     5   103.500000  1087.840000   0.00000000         0.00\n\
-  CG2R51   NG2R50   NG2R50     5   106.800000   920.480000   0.00000000         0.00\n\
-  CG2R52   NG2R50   CG2RC0     5   103.000000   502.080000   0.00000000         0.00\n\
-  CG2R52   NG2R50   CG3C52     5   102.900000   962.320000   0.00000000         0.00\n\
-  CG2R52   NG2R50   NG2R51     5   103.500000  1338.880000   0.00000000         0.00\n\
-  CG2R52   NG2R50   NG3C51     5   105.500000  1338.880000   0.00000000         0.00\n\
-  CG2R52   NG2R50   OG2R50     5   103.300000  1255.200000   0.00000000         0.00\n\
-  CG2R52   NG2R50   SG2R50     5   111.000000  1255.200000   0.00000000         0.00\n\
-  CG2R53   NG2R50   CG2R53     5   101.000000   836.800000   0.00000000         0.00\n\
-  CG2R53   NG2R50   CG2RC0     5   103.800000  1004.160000   0.00000000         0.00\n\
-  CG2R53   NG2R50   CG3C52     5   101.900000  1338.880000   0.00000000         0.00\n\
-  CG2R53   NG2R50   NG2R51     5   101.000000   836.800000   0.00000000         0.00\n\
-  CG2R53   NG2R50   OG2R50     5   103.000000   418.400000   0.00000000         0.00\n\
-  NG2R50   NG2R50   NG2R51     5   102.200000  1338.880000   0.00000000         0.00\n\
-  NG2R50   NG2R50   OG2R50     5   103.000000   920.480000   0.00000000         0.00\n\
-  CG2R51   NG2R51   CG2R51     5   109.000000   836.800000   0.00000000         0.00\n\
-  CG2R51   NG2R51   CG2R53     5   107.500000  1087.840000   0.00000000         0.00\n\
-  CG2R51   NG2R51   CG2RC0     5   110.000000   711.280000   0.00000000         0.00\n\
-  CG2R51   NG2R51   CG3C51     5   126.000000  1087.840000   0.00000000         0.00\n\
-  CG2R51   NG2R51   NG2R50     5   115.000000  1338.880000   0.00000000         0.00\n\
-  CG2R51   NG2R51     HGP1     5   125.500000   251.040000   0.21500000     16736.00\n\
-  CG2R53   NG2R51   CG2RC0     5   107.200000   836.800000   0.00000000         0.00\n\
-  CG2R53   NG2R51    CG331     5   127.800000   585.760000   0.00000000         0.00\n\
-  CG2R53   NG2R51   CG3C51     5   126.300000   376.560000   0.00000000         0.00\n\
-  CG2R53   NG2R51   CG3RC1     5   127.600000   376.560000   0.00000000         0.00\n\
-  CG2R53   NG2R51   NG2R50     5   114.000000  1087.840000   0.00000000         0.00\n\
-  CG2R53   NG2R51     HGP1     5   127.000000   251.040000   0.21400000     16736.00\n\
-  CG2RC0   NG2R51   CG2RC0     5   110.000000   711.280000   0.00000000         0.00\n\
-  CG2RC0   NG2R51    CG331     5   125.900000   585.760000   0.00000000         0.00\n\
-  CG2RC0   NG2R51   CG3C51     5   126.500000   376.560000   0.00000000         0.00\n\
-  CG2RC0   NG2R51   CG3RC1     5   126.500000   376.560000   0.00000000         0.00\n\
-  CG2RC0   NG2R51   NG2R50     5   114.500000  1589.920000   0.00000000         0.00\n\
-  CG2RC0   NG2R51     HGP1     5   126.000000   234.304000   0.00000000         0.00\n\
-  NG2R50   NG2R51     HGP1     5   119.500000   267.776000   0.00000000         0.00\n\
-  CG2R51   NG2R52   CG2R53     5   108.000000  1213.360000   0.00000000         0.00\n\
-  CG2R51   NG2R52     HGP2     5   124.900000   209.200000   0.21300000     12552.00\n\
-  CG2R52   NG2R52   CG3C54     5   111.900000   845.168000   0.00000000         0.00\n\
-  CG2R52   NG2R52     HGP2     5   123.200000   242.672000   0.00000000         0.00\n\
-  CG2R53   NG2R52   CG3C54     5   108.000000  1171.520000   0.00000000         0.00\n\
-  CG2R53   NG2R52     HGP2     5   127.100000   209.200000   0.20900000     12552.00\n\
-  CG3C54   NG2R52     HGP2     5   124.900000   242.672000   0.00000000         0.00\n\
-  CG251O   NG2R53   CG2R53     5   117.500000   970.688000   0.00000000         0.00\n\
-  CG251O   NG2R53     HGP1     5   123.000000   317.984000   0.00000000         0.00\n\
-  CG252O   NG2R53   CG2R53     5   117.500000   970.688000   0.00000000         0.00\n\
-  CG252O   NG2R53     HGP1     5   123.000000   317.984000   0.00000000         0.00\n\
-  CG2R53   NG2R53   CG2R53     5   120.500000   460.240000   0.00000000         0.00\n\
-  CG2R53   NG2R53    CG311     5   120.000000   418.400000   0.00000000         0.00\n\
-  CG2R53   NG2R53   CG3C52     5   111.000000   627.600000   0.00000000         0.00\n\
-  CG2R53   NG2R53     HGP1     5   119.500000   317.984000   0.00000000         0.00\n\
-  CG3C52   NG2R53     HGP1     5   116.000000   317.984000   0.00000000         0.00\n\
-  CG2R61   NG2R60   CG2R61     5   112.000000   167.360000   0.00000000         0.00\n\
-  CG2R61   NG2R60   CG2R64     5   112.000000   167.360000   0.00000000         0.00\n\
-  CG2R62   NG2R61   CG2R62     5   120.000000   251.040000   0.00000000         0.00\n\
-  CG2R62   NG2R61   CG2R63     5   122.000000   585.760000   0.00000000         0.00\n\
-  CG2R62   NG2R61    CG331     5   120.500000   585.760000   0.00000000         0.00\n\
-  CG2R62   NG2R61   CG3C51     5   118.400000   376.560000   0.00000000         0.00\n\
-  CG2R62   NG2R61   CG3C53     5   118.400000   376.560000   0.00000000         0.00\n\
-  CG2R62   NG2R61   CG3RC1     5   115.900000   376.560000   0.00000000         0.00\n\
-  CG2R62   NG2R61     HGP1     5   117.400000   267.776000   0.00000000         0.00\n\
-  CG2R62   NG2R61     HGP2     5   117.400000   267.776000   0.00000000         0.00\n\
-  CG2R63   NG2R61   CG2R63     5   130.200000   418.400000   0.00000000         0.00\n\
-  CG2R63   NG2R61   CG2R64     5   131.100000   585.760000   0.00000000         0.00\n\
-  CG2R63   NG2R61    CG331     5   115.400000   585.760000   0.00000000         0.00\n\
-  CG2R63   NG2R61   CG3C51     5   118.400000   376.560000   0.00000000         0.00\n\
-  CG2R63   NG2R61   CG3RC1     5   120.000000   376.560000   0.00000000         0.00\n\
-  CG2R63   NG2R61     HGP1     5   115.400000   338.904000   0.00000000         0.00\n\
-  CG2R64   NG2R61     HGP1     5   115.600000   376.560000   0.00000000         0.00\n\
-  CG2R61   NG2R62   CG2R64     5   110.500000   334.720000   0.00000000         0.00\n\
-  CG2R61   NG2R62   NG2R62     5   120.000000    83.680000   0.00000000         0.00\n\
-  CG2R63   NG2R62   CG2R64     5   119.100000   711.280000   0.00000000         0.00\n\
-  CG2R64   NG2R62   CG2R64     5   117.800000   753.120000   0.00000000         0.00\n\
-  CG2R64   NG2R62   CG2RC0     5   115.100000   753.120000   0.00000000         0.00\n\
-  CG2R64   NG2R62   NG2R62     5   121.000000   543.920000   0.00000000         0.00\n\
-  CG2R51   NG2RC0   CG2R61     5   130.500000   125.520000   0.00000000         0.00\n\
-  CG2R51   NG2RC0   CG2RC0     5   109.700000   836.800000   0.00000000         0.00\n\
-  CG2R61   NG2RC0   CG2RC0     5   119.800000   125.520000   0.00000000         0.00\n\
-   CG2O1    NG2S0    CG331     5   119.500000   351.456000   0.00000000         0.00\n\
-   CG2O1    NG2S0   CG3C51     5   117.000000   502.080000   0.00000000         0.00\n\
-   CG2O1    NG2S0   CG3C52     5   117.000000   502.080000   0.00000000         0.00\n\
-   CG331    NG2S0    CG331     5   121.000000   376.560000   0.00000000         0.00\n\
-  CG3C51    NG2S0   CG3C52     5   114.200000   836.800000   0.00000000         0.00\n\
-   CG2O1    NG2S1   CG2R61     5   120.000000   418.400000   0.00000000         0.00\n\
-   CG2O1    NG2S1   CG2R64     5   120.000000   418.400000   0.00000000         0.00\n\
-   CG2O1    NG2S1    CG311     5   120.000000   418.400000   0.00000000         0.00\n\
-   CG2O1    NG2S1    CG321     5   120.000000   418.400000   0.00000000         0.00\n\
-   CG2O1    NG2S1    CG331     5   120.000000   418.400000   0.00000000         0.00\n\
-   CG2O1    NG2S1    NG2D1     5   115.000000   418.400000   0.00000000         0.00\n\
-   CG2O1    NG2S1     HGP1     5   123.000000   284.512000   0.00000000         0.00\n\
-   CG2O6    NG2S1    CG321     5   120.000000   502.080000   0.00000000         0.00\n\
-   CG2O6    NG2S1    CG331     5   120.000000   502.080000   0.00000000         0.00\n\
-   CG2O6    NG2S1     HGP1     5   121.500000   334.720000   0.00000000         0.00\n\
-  CG2R61    NG2S1     HGP1     5   117.000000   284.512000   0.00000000         0.00\n\
-  CG2R64    NG2S1     HGP1     5   117.000000   284.512000   0.00000000         0.00\n\
-   CG311    NG2S1     HGP1     5   117.000000   292.880000   0.00000000         0.00\n\
-   CG321    NG2S1     HGP1     5   117.000000   292.880000   0.00000000         0.00\n\
-   CG331    NG2S1     HGP1     5   117.000000   292.880000   0.00000000         0.00\n\
-   NG2D1    NG2S1     HGP1     5   122.000000   284.512000   0.00000000         0.00\n\
-   CG2O1    NG2S2     HGP1     5   120.000000   418.400000   0.00000000         0.00\n\
-   CG2O6    NG2S2     HGP1     5   120.000000   418.400000   0.00000000         0.00\n\
-    HGP1    NG2S2     HGP1     5   120.000000   192.464000   0.00000000         0.00\n\
-  CG2R61    NG2S3     HGP4     5   111.600000   502.080000   0.00000000         0.00\n\
-  CG2R64    NG2S3     HGP4     5   121.500000   334.720000   0.00000000         0.00\n\
-   CG331    NG2S3      PG1     5   118.300000   920.480000   0.23300000     29288.00\n\
-   CG331    NG2S3     HGP1     5   109.000000   292.880000   0.00000000         0.00\n\
-  CG3C51    NG2S3      PG1     5   118.300000   920.480000   0.23300000     29288.00\n\
-  CG3C51    NG2S3     HGP1     5   109.000000   292.880000   0.00000000         0.00\n\
-     PG1    NG2S3     HGP1     5   123.600000   251.040000   0.23500000     33472.00\n\
-    HGP4    NG2S3     HGP4     5   117.000000   259.408000   0.00000000         0.00\n\
-  CG2D1O    NG301   CG2D1O     5   114.000000   167.360000   0.00000000         0.00\n\
-  CG2D1O    NG301   CG3C51     5   121.700000   585.760000   0.00000000         0.00\n\
-  CG2D2O    NG301   CG2D2O     5   114.000000   167.360000   0.00000000         0.00\n\
-  CG2D2O    NG301   CG3C51     5   121.700000   585.760000   0.00000000         0.00\n\
-  CG3AM0    NG301   CG3AM0     5   110.900000   443.504000   0.00000000         0.00\n\
-  CG2D1O    NG311   CG2D1O     5   114.000000   167.360000   0.00000000         0.00\n\
-  CG2D1O    NG311   HGPAM1     5   123.000000   326.352000   0.00000000         0.00\n\
-  CG2D2O    NG311   CG2D2O     5   114.000000   167.360000   0.00000000         0.00\n\
-  CG2D2O    NG311   HGPAM1     5   123.000000   326.352000   0.00000000         0.00\n\
-   CG2N1    NG311    CG331     5   106.000000   359.824000   0.00000000         0.00\n\
-   CG2N1    NG311   HGPAM1     5   106.000000   376.560000   0.00000000         0.00\n\
-  CG2R61    NG311   CG2R61     5   109.000000   334.720000   0.00000000         0.00\n\
-  CG2R61    NG311    CG321     5   113.000000   460.240000   0.00000000         0.00\n\
-  CG2R61    NG311    SG3O2     5   115.000000   292.880000   0.00000000         0.00\n\
-  CG2R61    NG311     HGP1     5   114.000000   334.720000   0.00000000         0.00\n\
-  CG2R61    NG311   HGPAM1     5   115.000000   376.560000   0.00000000         0.00\n\
-   CG321    NG311    SG3O2     5   115.000000   502.080000   0.00000000         0.00\n\
-   CG321    NG311     HGP1     5   111.000000   384.928000   0.00000000         0.00\n\
-   CG321    NG311   HGPAM1     5   111.000000   292.880000   0.00000000         0.00\n\
-   CG331    NG311    SG3O2     5   114.000000   569.024000   0.00000000         0.00\n\
-   CG331    NG311     HGP1     5   111.500000   353.966400   0.00000000         0.00\n\
-   CG331    NG311   HGPAM1     5   104.000000   376.560000   0.00000000         0.00\n\
-  CG3AM1    NG311   CG3AM1     5   112.200000   338.904000   0.24217000      4184.00\n\
-  CG3AM1    NG311   HGPAM1     5   108.900000   352.292800   0.20292000      4184.00\n\
-   SG3O2    NG311     HGP1     5   113.200000   353.966400   0.00000000         0.00\n\
-  CG2D1O    NG321   HGPAM2     5   113.000000   460.240000   0.00000000         0.00\n\
-  CG2D2O    NG321   HGPAM2     5   113.000000   460.240000   0.00000000         0.00\n\
-   CG2N1    NG321   HGPAM2     5   108.000000   460.240000   0.00000000         0.00\n\
-   CG321    NG321   HGPAM2     5   112.100000   343.088000   0.00000000         0.00\n\
-  CG3AM2    NG321   HGPAM2     5   112.100000   343.088000   0.00000000         0.00\n\
-  CG3C51    NG321   HGPAM2     5   112.100000   343.088000   0.00000000         0.00\n\
-   SG3O2    NG321     HGP1     5   115.000000   410.032000   0.00000000         0.00\n\
-    HGP1    NG321     HGP1     5   110.000000   317.984000   0.00000000         0.00\n\
-  HGPAM2    NG321   HGPAM2     5   105.850000   351.456000   0.00000000         0.00\n\
-  HGPAM3    NG331   HGPAM3     5   107.100000   347.272000   0.00000000         0.00\n\
-  CG2R51   NG3C51   CG3C52     5   104.800000   376.560000   0.00000000         0.00\n\
-  CG2R51   NG3C51     HGP1     5   113.900000   359.824000   0.00000000         0.00\n\
-  CG2R53   NG3C51   CG3C52     5   107.000000   334.720000   0.00000000         0.00\n\
-  CG2R53   NG3C51     HGP1     5   115.600000   359.824000   0.00000000         0.00\n\
-  CG2RC0   NG3C51   CG3C52     5   106.900000   502.080000   0.00000000         0.00\n\
-  CG2RC0   NG3C51     HGP1     5   114.500000   343.088000   0.00000000         0.00\n\
-  CG3C52   NG3C51   CG3C52     5   103.700000  1171.520000   0.00000000         0.00\n\
-  CG3C52   NG3C51   CG3C54     5   104.100000   560.656000   0.00000000         0.00\n\
-  CG3C52   NG3C51   NG2R50     5   109.000000   393.296000   0.00000000         0.00\n\
-  CG3C52   NG3C51    NG3P2     5   103.900000   393.296000   0.00000000         0.00\n\
-  CG3C52   NG3C51     HGP1     5   112.000000   359.824000   0.00000000         0.00\n\
-  CG3C54   NG3C51     HGP1     5   109.250000   418.400000   0.00000000         0.00\n\
-  NG2R50   NG3C51     HGP1     5   103.600000   418.400000   0.00000000         0.00\n\
-   NG3P2   NG3C51     HGP1     5   100.600000   468.608000   0.00000000         0.00\n\
-  CG2R61    NG3N1    NG3N1     5   112.000000   502.080000   0.00000000         0.00\n\
-  CG2R61    NG3N1     HGP1     5   115.000000   435.136000   0.00000000         0.00\n\
-   NG3N1    NG3N1     HGP1     5   102.000000   460.240000   0.00000000         0.00\n\
-    HGP1    NG3N1     HGP1     5   102.000000   418.400000   0.00000000         0.00\n\
-   CG324    NG3P0    CG324     5   109.500000   502.080000   0.24660000     21756.80\n\
-   CG324    NG3P0    CG334     5   109.500000   502.080000   0.24660000     21756.80\n\
-   CG334    NG3P0    CG334     5   109.500000   502.080000   0.24660000     21756.80\n\
-   CG334    NG3P0    OG311     5   100.000000   577.392000   0.00000000         0.00\n\
-   CG334    NG3P0    OG312     5   112.000000   669.440000   0.00000000         0.00\n\
-   CG324    NG3P1    CG324     5   115.200000   376.560000   0.00000000         0.00\n\
-   CG324    NG3P1    CG334     5   109.500000   376.560000   0.00000000         0.00\n\
-   CG324    NG3P1     HGP2     5   110.800000   251.040000   0.20740000     22593.60\n\
-   CG334    NG3P1     HGP2     5   110.800000   251.040000   0.20740000     22593.60\n\
-  CG2R51    NG3P2   CG3C54     5   107.000000   711.280000   0.00000000         0.00\n\
-  CG2R51    NG3P2     HGP2     5   112.000000   317.984000   0.00000000         0.00\n\
-   CG314    NG3P2    CG324     5   115.200000   376.560000   0.00000000         0.00\n\
-   CG314    NG3P2     HGP2     5   110.800000   251.040000   0.20740000     22593.60\n\
-   CG324    NG3P2    CG324     5   115.200000   334.720000   0.00000000         0.00\n\
-   CG324    NG3P2     HGP2     5   110.800000   251.040000   0.20740000     22593.60\n\
-  CG3C53    NG3P2   CG3C54     5   111.000000   836.800000   0.00000000         0.00\n\
-  CG3C53    NG3P2     HGP2     5   109.500000   276.144000   0.20560000      3347.20\n\
-  CG3C54    NG3P2   CG3C54     5   113.000000   870.272000   0.00000000         0.00\n\
-  CG3C54    NG3P2   NG3C51     5   114.200000  1129.680000   0.00000000         0.00\n\
-  CG3C54    NG3P2     HGP2     5   109.500000   276.144000   0.20560000      3347.20\n\
-  NG3C51    NG3P2     HGP2     5   106.300000   351.456000   0.00000000         0.00\n\
-    HGP2    NG3P2     HGP2     5   107.500000   426.768000   0.00000000         0.00\n\
-   CG314    NG3P3     HGP2     5   109.500000   251.040000   0.20740000     16736.00\n\
-   CG324    NG3P3     HGP2     5   109.500000   251.040000   0.20740000     16736.00\n\
-   CG334    NG3P3     HGP2     5   109.500000   251.040000   0.20740000     16736.00\n\
-    HGP2    NG3P3     HGP2     5   109.500000   368.192000   0.00000000         0.00\n\
-  CG2R51   OG2R50   CG2R51     5   106.000000   836.800000   0.00000000         0.00\n\
-  CG2R51   OG2R50   CG2R53     5   104.000000  1171.520000   0.00000000         0.00\n\
-  CG2R51   OG2R50   CG2RC0     5   104.000000   418.400000   0.00000000         0.00\n\
-  CG2R51   OG2R50   NG2R50     5   108.500000  1255.200000   0.00000000         0.00\n\
-  CG2R53   OG2R50   NG2R50     5   109.300000  1380.720000   0.00000000         0.00\n\
-  CG2D1O    OG301    CG331     5   109.000000   443.504000   0.00000000         0.00\n\
-  CG2D2O    OG301    CG331     5   109.000000   443.504000   0.00000000         0.00\n\
-  CG2R61    OG301   CG2R61     5   120.000000  1548.080000   0.00000000         0.00\n\
-  CG2R61    OG301    CG321     5   108.000000   543.920000   0.00000000         0.00\n\
-  CG2R61    OG301    CG331     5   108.000000   543.920000   0.00000000         0.00\n\
-   CG301    OG301    CG331     5   109.700000   794.960000   0.00000000         0.00\n\
-   CG311    OG301    CG331     5   109.700000   794.960000   0.00000000         0.00\n\
-   CG321    OG301    CG321     5   109.700000   794.960000   0.00000000         0.00\n\
-   CG321    OG301    CG331     5   109.700000   794.960000   0.00000000         0.00\n\
-   CG331    OG301    CG331     5   109.700000   794.960000   0.00000000         0.00\n\
-   CG331    OG301   CG3C51     5   107.000000   543.920000   0.00000000         0.00\n\
-   CG2O2    OG302    CG301     5   109.600000   334.720000   0.22651000     25104.00\n\
-   CG2O2    OG302    CG311     5   109.600000   334.720000   0.22651000     25104.00\n\
-   CG2O2    OG302    CG321     5   109.600000   334.720000   0.22651000     25104.00\n\
-   CG2O2    OG302    CG331     5   109.600000   334.720000   0.22651000     25104.00\n\
-   CG2O6    OG302    CG321     5   111.000000   334.720000   0.00000000         0.00\n\
-   CG2O6    OG302    CG331     5   111.000000   334.720000   0.00000000         0.00\n\
-  CG2R61    OG303      PG1     5   120.000000   753.120000   0.23000000     16736.00\n\
-  CG2R61    OG303    SG3O2     5   108.000000   276.144000   0.00000000         0.00\n\
-   CG311    OG303      PG2     5   120.000000   167.360000   0.23300000     29288.00\n\
-   CG321    OG303      PG1     5   120.000000   167.360000   0.23300000     29288.00\n\
-   CG321    OG303      PG2     5   120.000000   167.360000   0.23300000     29288.00\n\
-   CG321    OG303    SG3O1     5   109.000000   125.520000   0.19000000     22593.60\n\
-   CG331    OG303      PG0     5   120.000000   167.360000   0.23300000     29288.00\n\
-   CG331    OG303      PG1     5   120.000000   167.360000   0.23300000     29288.00\n\
-   CG331    OG303      PG2     5   120.000000   167.360000   0.23300000     29288.00\n\
-   CG331    OG303    SG3O1     5   109.000000   125.520000   0.19000000     22593.60\n\
-   CG331    OG303    SG3O2     5   113.000000   401.664000   0.00000000         0.00\n\
-  CG3C51    OG303      PG1     5   120.000000   167.360000   0.23300000     29288.00\n\
-  CG3C51    OG303      PG2     5   120.000000   167.360000   0.23300000     29288.00\n\
-     PG1    OG304      PG1     5   143.000000   376.560000   0.32500000     33472.00\n\
-     PG1    OG304      PG2     5   139.500000   376.560000   0.30500000     33472.00\n\
-   CG2O2    OG311     HGP1     5   115.000000   460.240000   0.00000000         0.00\n\
-  CG2R61    OG311     HGP1     5   108.000000   543.920000   0.00000000         0.00\n\
-   CG301    OG311     HGP1     5   106.000000   418.400000   0.00000000         0.00\n\
-   CG311    OG311     HGP1     5   106.000000   418.400000   0.00000000         0.00\n\
-   CG321    OG311     HGP1     5   106.000000   418.400000   0.00000000         0.00\n\
-   CG331    OG311     HGP1     5   106.000000   481.160000   0.00000000         0.00\n\
-  CG3C51    OG311     HGP1     5   109.000000   418.400000   0.00000000         0.00\n\
-   NG3P0    OG311     HGP1     5   101.500000   502.080000   0.00000000         0.00\n\
-     PG0    OG311     HGP1     5   115.000000   251.040000   0.23500000     33472.00\n\
-     PG1    OG311     HGP1     5   115.000000   251.040000   0.23500000     33472.00\n\
-  CG3C31   OG3C31   CG3C31     5    97.000000   421.328800   0.00000000         0.00\n\
-  CG2R51   OG3C51   CG3C52     5   104.400000  1046.000000   0.00000000         0.00\n\
-  CG2RC0   OG3C51   CG3C52     5   108.050000   635.968000   0.00000000         0.00\n\
-  CG3C51   OG3C51   CG3C51     5   111.000000   794.960000   0.00000000         0.00\n\
-  CG3C51   OG3C51   CG3C52     5   111.000000   794.960000   0.00000000         0.00\n\
-  CG3C51   OG3C51   CG3C53     5   108.000000   920.480000   0.00000000         0.00\n\
-  CG3C52   OG3C51   CG3C52     5   111.000000   794.960000   0.00000000         0.00\n\
-  CG3C52   OG3C51   CG3RC1     5   109.000000  1422.560000   0.00000000         0.00\n\
-   CG321   OG3C61    CG321     5   109.700000   794.960000   0.00000000         0.00\n\
-  CG2D1O   OG3R60   CG2D1O     5    99.000000   334.720000   0.00000000         0.00\n\
-  CG2D1O   OG3R60    CG321     5    99.000000   167.360000   0.00000000         0.00\n\
-  CG2D2O   OG3R60   CG2D2O     5    99.000000   334.720000   0.00000000         0.00\n\
-  CG2D2O   OG3R60    CG321     5    99.000000   167.360000   0.00000000         0.00\n\
-  CG2R61   OG3R60   CG2R61     5   115.000000   334.720000   0.00000000         0.00\n\
-   OG2P1      PG0    OG303     5   111.600000   827.595200   0.00000000         0.00\n\
-   OG2P1      PG0    OG311     5   108.230000   827.595200   0.00000000         0.00\n\
-   OG303      PG0    OG311     5   108.000000   402.500800   0.00000000         0.00\n\
-   OG311      PG0    OG311     5   104.000000   827.595200   0.00000000         0.00\n\
-   CG312      PG1    OG2P1     5    94.000000   827.595200   0.00000000         0.00\n\
-   CG312      PG1    OG311     5    90.000000   753.956800   0.00000000         0.00\n\
-   CG321      PG1    OG2P1     5   103.000000   827.595200   0.00000000         0.00\n\
-   CG321      PG1    OG311     5    94.000000   753.956800   0.00000000         0.00\n\
-   NG2S3      PG1    OG2P1     5   110.600000  1171.520000   0.00000000         0.00\n\
-   NG2S3      PG1    OG303     5   103.200000   502.080000   0.00000000         0.00\n\
-   OG2P1      PG1    OG2P1     5   120.000000   870.272000   0.00000000         0.00\n\
-   OG2P1      PG1    OG303     5   107.500000   827.595200   0.00000000         0.00\n\
-   OG2P1      PG1    OG304     5   111.600000   743.915200   0.00000000         0.00\n\
-   OG2P1      PG1    OG311     5   111.000000   827.595200   0.00000000         0.00\n\
-   OG303      PG1    OG303     5   104.300000   669.440000   0.00000000         0.00\n\
-   OG303      PG1    OG304     5   105.000000   402.500800   0.00000000         0.00\n\
-   OG303      PG1    OG311     5   108.000000   402.500800   0.00000000         0.00\n\
-   OG304      PG1    OG304     5   107.500000   402.500800   0.00000000         0.00\n\
-   OG304      PG1    OG311     5   111.000000   402.500800   0.00000000         0.00\n\
-   CG312      PG2    OG2P1     5    94.000000   827.595200   0.00000000         0.00\n\
-   CG321      PG2    OG2P1     5   103.000000   827.595200   0.00000000         0.00\n\
-   OG2P1      PG2    OG2P1     5   121.000000   870.272000   0.00000000         0.00\n\
-   OG2P1      PG2    OG303     5   111.000000   743.915200   0.00000000         0.00\n\
-   OG2P1      PG2    OG304     5   111.600000   743.915200   0.00000000         0.00\n\
-  CG2R51   SG2R50   CG2R51     5    95.000000   878.640000   0.00000000         0.00\n\
-  CG2R51   SG2R50   CG2R53     5    97.000000   920.480000   0.00000000         0.00\n\
-  CG2R51   SG2R50   CG2RC0     5    99.500000   585.760000   0.00000000         0.00\n\
-  CG2R51   SG2R50   NG2R50     5   103.000000  1255.200000   0.00000000         0.00\n\
-  CG2R53   SG2R50   CG2RC0     5    97.000000   920.480000   0.00000000         0.00\n\
-   CG321    SG301    SG301     5   103.300000   606.680000   0.00000000         0.00\n\
-   CG331    SG301    SG301     5   103.300000   606.680000   0.00000000         0.00\n\
-  CG251O    SG311   CG2R53     5    92.000000   627.600000   0.00000000         0.00\n\
-  CG252O    SG311   CG2R53     5    92.000000   627.600000   0.00000000         0.00\n\
-   CG2O6    SG311    CG331     5    96.000000   502.080000   0.00000000         0.00\n\
-  CG2R61    SG311   CG2R61     5   109.000000   418.400000   0.00000000         0.00\n\
-   CG321    SG311    CG321     5    95.000000   284.512000   0.00000000         0.00\n\
-   CG321    SG311    CG331     5    95.000000   284.512000   0.00000000         0.00\n\
-   CG321    SG311     HGP3     5    95.000000   324.678400   0.00000000         0.00\n\
-   CG331    SG311     HGP3     5    95.000000   359.824000   0.00000000         0.00\n\
-  CG2R61    SG3O1    OG2P1     5    98.000000   711.280000   0.00000000         0.00\n\
-   CG321    SG3O1    OG2P1     5    99.000000   669.440000   0.00000000         0.00\n\
-   CG331    SG3O1    OG2P1     5   100.000000   711.280000   0.00000000         0.00\n\
-   OG2P1    SG3O1    OG2P1     5   109.470000  1087.840000   0.24500000     29288.00\n\
-   OG2P1    SG3O1    OG303     5    98.000000   711.280000   0.00000000         0.00\n\
-  CG2R61    SG3O2    NG311     5    97.000000   585.760000   0.00000000         0.00\n\
-  CG2R61    SG3O2    NG321     5    98.000000   502.080000   0.00000000         0.00\n\
-  CG2R61    SG3O2    OG2P1     5   101.000000   502.080000   0.00000000         0.00\n\
-   CG321    SG3O2    CG331     5   102.000000   669.440000   0.00000000         0.00\n\
-   CG321    SG3O2    NG311     5   101.000000   518.816000   0.00000000         0.00\n\
-   CG321    SG3O2    OG2P1     5   107.500000   627.600000   0.00000000         0.00\n\
-   CG331    SG3O2    CG331     5   102.000000   669.440000   0.00000000         0.00\n\
-   CG331    SG3O2    NG311     5   103.000000   610.864000   0.00000000         0.00\n\
-   CG331    SG3O2    NG321     5   101.000000   694.544000   0.00000000         0.00\n\
-   CG331    SG3O2    OG2P1     5   108.500000   661.072000   0.00000000         0.00\n\
-   CG331    SG3O2    OG303     5    96.000000   778.224000   0.00000000         0.00\n\
-   NG311    SG3O2    OG2P1     5   110.500000   627.600000   0.00000000         0.00\n\
-   NG321    SG3O2    OG2P1     5   111.000000   669.440000   0.00000000         0.00\n\
-   NG321    SG3O2    OG303     5   102.000000   836.800000   0.00000000         0.00\n\
-   OG2P1    SG3O2    OG2P1     5   121.000000   711.280000   0.00000000         0.00\n\
-   OG2P1    SG3O2    OG303     5   109.000000   753.120000   0.00000000         0.00\n\
-   CG321    SG3O3    CG331     5    95.000000   711.280000   0.00000000         0.00\n\
-   CG321    SG3O3    OG2P1     5   106.500000   543.920000   0.00000000         0.00\n\
-   CG331    SG3O3    CG331     5    95.000000   284.512000   0.00000000         0.00\n\
-   CG331    SG3O3    OG2P1     5   106.750000   661.072000   0.00000000         0.00\n\
-    FGP1     ALG1     FGP1     5   109.470000   192.464000   0.28185500     12552.00\n\
-   CC311    CC311    CC321     5   111.000000   446.432800   0.25610000      6694.40\n\
-   CC322    CC312    CC322     5   111.000000   376.560000   0.00000000         0.00\n\
-   CC312    CC312    CC322     5   111.000000   376.560000   0.00000000         0.00\n\
-   CC312    CC2O3    OC2D3     5   121.500000   627.600000   0.00000000         0.00\n\
-   CC331    CC2O3    OC2D3     5   121.500000   627.600000   0.00000000         0.00\n\
-   CC322    CC2O3    OC2D3     5   121.500000   627.600000   0.00000000         0.00\n\
-   CC331    CC2O3    CC331     5   116.000000   292.880000   0.00000000         0.00\n\
-   CC312    CC2O3    CC322     5   116.000000   292.880000   0.00000000         0.00\n\
-   CC322    CC2O3    CC322     5   116.000000   292.880000   0.00000000         0.00\n\
-   CC312    CC312    CC2O3     5   113.800000   502.080000   0.00000000         0.00\n\
-   CC2O3    CC331     HCA3     5   109.500000   418.400000   0.00000000         0.00\n\
-   CC2O3    CC322     HCA2     5   109.500000   418.400000   0.00000000         0.00\n\
-    HCA1    CC312    CC2O3     5   109.500000   418.400000   0.00000000         0.00\n\
-   OC311    CC312    CC2O3     5   108.890000   460.240000   0.00000000         0.00\n\
-   CC2O3    CC322    OC311     5   108.890000   460.240000   0.00000000         0.00\n\
-   OC2D4    CC2O4     HCR1     5   118.000000   543.920000   0.00000000         0.00\n\
-    HCR1    CC2O4    CC331     5   116.000000   543.920000   0.00000000         0.00\n\
-    HCR1    CC2O4    CC312     5   116.000000   543.920000   0.00000000         0.00\n\
-   CC312    CC2O4    OC2D4     5   126.000000   376.560000   0.00000000         0.00\n\
-   CC331    CC2O4    OC2D4     5   126.000000   376.560000   0.00000000         0.00\n\
-   CC312    CC312    CC2O4     5   113.800000   502.080000   0.00000000         0.00\n\
-   OC311    CC312    CC2O4     5   108.890000   460.240000   0.00000000         0.00\n\
-   CC2O4    CC312     HCA1     5   109.500000   276.144000   0.21630000     25104.00\n\
-   CC2O4    CC331     HCA3     5   109.500000   276.144000   0.21630000     25104.00\n\
-  CC3161   CC3161   CC3161     5   111.000000   446.432800   0.25610000      6694.40\n\
-  CC3261   CC3161   CC3161     5   111.000000   446.432800   0.25610000      6694.40\n\
-  CC3161   CC3161   CC3163     5   111.000000   446.432800   0.25610000      6694.40\n\
-  CC3161   CC3161   CC3263     5   111.000000   446.432800   0.25610000      6694.40\n\
-   CC312    CC312    CC312     5   111.000000   376.560000   0.00000000         0.00\n\
-  CC3162   CC3161   CC3161     5   111.000000   446.432800   0.25610000      6694.40\n\
-  CC3163    CC312    CC312     5   111.000000   446.432800   0.25610000      6694.40\n\
-  CC3062   CC3261   CC3161     5   113.500000   488.272800   0.25610000      9338.69\n\
-  CC3161   CC3163    CC321     5   113.500000   488.272800   0.25610000      9338.69\n\
-  CC3161   CC3163    CC312     5   113.500000   488.272800   0.25610000      9338.69\n\
-  CC3161   CC3163    CC331     5   113.500000   488.272800   0.25610000      9338.69\n\
-   CC2O2    CC311    CC331     5   108.000000   435.136000   0.00000000         0.00\n\
-   CC2O2   CC3163   CC3161     5   108.000000   435.136000   0.00000000         0.00\n\
-   CC2O2    CC301    CC331     5   112.000000   435.136000   0.00000000         0.00\n\
-   CC2O2   CC3062   CC3261     5   112.000000   435.136000   0.00000000         0.00\n\
-   CC321    CC321    CC321     5   113.600000   488.272800   0.25610000      9338.69\n\
-   CC331    CC321    CC321     5   115.000000   485.344000   0.25610000      6694.40\n\
-   CC331    CC311    CC331     5   114.000000   446.432800   0.25610000      6694.40\n\
-  CC321C   CC321C   CC321C     5   112.000000   488.272800   0.25610000      9338.69\n\
-  CC321C   CC311C   CC321C     5   112.000000   488.272800   0.25610000      9338.69\n\
-  CC321D   CC321C   CC311C     5   112.000000   488.272800   0.25610000      9338.69\n\
-  CC321D   CC311C   CC321C     5   112.000000   488.272800   0.25610000      9338.69\n\
-  CC321D   CC321C   CC321C     5   112.000000   488.272800   0.25610000      9338.69\n\
-  CC311D   CC321C   CC321C     5   112.000000   488.272800   0.25610000      9338.69\n\
-  CC311C   CC321C   CC321C     5   112.000000   488.272800   0.25610000      9338.69\n\
-  CC321C   CC321D   CC321C     5   112.000000   488.272800   0.25610000      9338.69\n\
-   CC321   CC311C   CC321C     5   113.500000   488.272800   0.25610000      9338.69\n\
-   CC2O2    CC321    CC331     5   108.000000   435.136000   0.00000000         0.00\n\
-   CC312    CC312     HCA1     5   110.100000   288.696000   0.21790000     18853.10\n\
-   CC312   CC3163     HCA1     5   110.100000   288.696000   0.21790000     18853.10\n\
-  CC3161   CC3161     HCA1     5   110.100000   288.696000   0.21790000     18853.10\n\
-  CC3161   CC3162     HCA1     5   110.100000   288.696000   0.21790000     18853.10\n\
-  CC3261   CC3161     HCA1     5   110.100000   288.696000   0.21790000     18853.10\n\
-  CC3162   CC3161     HCA1     5   110.100000   288.696000   0.21790000     18853.10\n\
-  CC3163   CC3161     HCA1     5   110.100000   288.696000   0.21790000     18853.10\n\
-  CC3161   CC3163     HCA1     5   110.100000   288.696000   0.21790000     18853.10\n\
-  CC3163    CC312     HCA1     5   110.100000   288.696000   0.21790000     18853.10\n\
-   CC322    CC312     HCA1     5   110.100000   288.696000   0.21790000     18853.10\n\
-   CC321   CC3163     HCA1     5   110.100000   288.696000   0.21790000     18853.10\n\
-   CC331    CC311     HCA1     5   110.100000   288.696000   0.21790000     18853.10\n\
-   CC331   CC3163     HCA1     5   110.100000   288.696000   0.21790000     18853.10\n\
-  CC3263   CC3161     HCA1     5   110.100000   288.696000   0.21790000     18853.10\n\
-   CC321    CC311     HCA1     5   110.100000   288.696000   0.21790000     18853.10\n\
-   CC312    CC322     HCA2     5   110.100000   279.742240   0.21790000     18853.10\n\
-  CC3163    CC321     HCA2     5   110.100000   279.742240   0.21790000     18853.10\n\
-  CC3062   CC3261     HCA2     5   110.100000   279.742240   0.21790000     18853.10\n\
-  CC3161   CC3261     HCA2     5   110.100000   279.742240   0.21790000     18853.10\n\
-   CC311    CC321     HCA2     5   110.100000   279.742240   0.21790000     18853.10\n\
-  CC3161   CC3263     HCA2     5   110.100000   279.742240   0.21790000     18853.10\n\
-  CC3163    CC331     HCA3     5   110.100000   279.742240   0.21790000     18853.10\n\
-   CC311    CC331     HCA3     5   110.100000   279.742240   0.21790000     18853.10\n\
-   CC301    CC331     HCA3     5   110.100000   279.742240   0.21790000     18853.10\n\
-   CC2O2   CC3163     HCA1     5   109.500000   418.400000   0.00000000         0.00\n\
-   CC2O2    CC311     HCA1     5   109.500000   418.400000   0.00000000         0.00\n\
-   CC2O1    CC331     HCA3     5   109.500000   276.144000   0.21630000     25104.00\n\
-    HCA1   CC311C    CC321     5   110.100000   288.696000   0.21790000     18853.10\n\
-    HCA1   CC311D   CC321C     5   110.100000   288.696000   0.21790000     18853.10\n\
-    HCA1   CC311C   CC321C     5   110.100000   288.696000   0.21790000     18853.10\n\
-    HCA1   CC311C   CC321D     5   110.100000   288.696000   0.21790000     18853.10\n\
-    HCA2    CC321   CC311C     5   110.100000   279.742240   0.21790000     18853.10\n\
-    HCA2    CC321    CC321     5   110.100000   221.752000   0.21790000     18853.10\n\
-    HCA2    CC321    CC331     5   110.100000   289.532800   0.21790000     18853.10\n\
-    HCA3    CC331    CC321     5   110.100000   289.532800   0.21790000     18853.10\n\
-    HCA2   CC321C   CC321C     5   110.100000   288.696000   0.21790000     18853.10\n\
-    HCA2   CC321D   CC321C     5   110.100000   288.696000   0.21790000     18853.10\n\
-    HCA2   CC321C   CC321D     5   110.100000   288.696000   0.21790000     18853.10\n\
-    HCA2   CC321C   CC311D     5   110.100000   288.696000   0.21790000     18853.10\n\
-    HCA2   CC321C   CC311C     5   110.100000   288.696000   0.21790000     18853.10\n\
-    HCA2   CC321D   CC311C     5   110.100000   288.696000   0.21790000     18853.10\n\
-   CC2O2    CC321     HCA2     5   109.500000   276.144000   0.21630000     25104.00\n\
-  CC3161   CC3161    NC2D1     5   113.500000   585.760000   0.00000000         0.00\n\
-  CC3162   CC3161    NC2D1     5   113.500000   585.760000   0.00000000         0.00\n\
-  CC3163   CC3161    NC2D1     5   113.500000   585.760000   0.00000000         0.00\n\
-   CC331    CC311    NC2D1     5   113.500000   585.760000   0.00000000         0.00\n\
-   NC2D1    CC2O1    CC331     5   116.500000   669.440000   0.00000000         0.00\n\
-  CC3161    NC2D1    CC2O1     5   120.000000   418.400000   0.00000000         0.00\n\
-   CC2O1    NC2D1    CC311     5   120.000000   418.400000   0.00000000         0.00\n\
-   CC2O1    NC2D1    CC331     5   120.000000   418.400000   0.00000000         0.00\n\
-   NC2D1    CC2O1    OC2D1     5   122.500000   669.440000   0.00000000         0.00\n\
-   NC2D1   CC3161     HCA1     5   108.000000   401.664000   0.00000000         0.00\n\
-   NC2D1    CC311     HCA1     5   108.000000   401.664000   0.00000000         0.00\n\
-   NC2D1    CC331     HCA3     5   109.500000   430.952000   0.00000000         0.00\n\
-    HCP1    NC2D1    CC2O1     5   123.000000   284.512000   0.00000000         0.00\n\
-  CC3161    NC2D1     HCP1     5   117.000000   292.880000   0.00000000         0.00\n\
-    HCP1    NC2D1    CC311     5   117.000000   292.880000   0.00000000         0.00\n\
-    HCP1    NC2D1    CC331     5   117.000000   292.880000   0.00000000         0.00\n\
-    HCA2    CC321     HCA2     5   109.000000   297.064000   0.18020000      4518.72\n\
-    HCA2    CC322     HCA2     5   109.000000   297.064000   0.18020000      4518.72\n\
-    HCA2   CC321C     HCA2     5   109.000000   297.064000   0.18020000      4518.72\n\
-    HCA2   CC321D     HCA2     5   109.000000   297.064000   0.18020000      4518.72\n\
-    HCA2   CC3261     HCA2     5   109.000000   297.064000   0.18020000      4518.72\n\
-    HCA2   CC3263     HCA2     5   109.000000   297.064000   0.18020000      4518.72\n\
-    HCA3    CC331     HCA3     5   108.400000   297.064000   0.18020000      4518.72\n\
-  CC3161   CC3163   OC3C61     5   110.000000   376.560000   0.00000000         0.00\n\
-  CC3161   CC3263   OC3C61     5   110.000000   376.560000   0.00000000         0.00\n\
-  CC3161   CC3162   OC3C61     5   106.000000   376.560000   0.00000000         0.00\n\
-  OC3C61   CC3062   CC3261     5   111.500000   376.560000   0.00000000         0.00\n\
-   CC321   CC3163   OC3C61     5   109.000000   376.560000   0.00000000         0.00\n\
-   CC312   CC3163   OC3C61     5   109.000000   376.560000   0.00000000         0.00\n\
-   CC331   CC3163   OC3C61     5   111.500000   376.560000   0.00000000         0.00\n\
-   CC2O2    CC311    OC301     5   103.000000   376.560000   0.00000000         0.00\n\
-   CC2O2   CC3163   OC3C61     5   103.000000   376.560000   0.00000000         0.00\n\
-   CC2O2    CC301    OC301     5   103.000000   376.560000   0.00000000         0.00\n\
-   CC2O2   CC3062    OC301     5   103.000000   376.560000   0.00000000         0.00\n\
-   CC2O2   CC3062   OC3C61     5   103.000000   376.560000   0.00000000         0.00\n\
-  CC3161   CC3162    OC311     5   107.000000   633.457600   0.00000000         0.00\n\
-   CC312    CC312    OC311     5   108.000000   633.457600   0.00000000         0.00\n\
-  CC3161   CC3161    OC311     5   110.100000   633.457600   0.00000000         0.00\n\
-  CC3261   CC3161    OC311     5   110.100000   633.457600   0.00000000         0.00\n\
-  CC3162   CC3161    OC311     5   110.100000   633.457600   0.00000000         0.00\n\
-  CC3163   CC3161    OC311     5   110.100000   633.457600   0.00000000         0.00\n\
-  CC3163    CC312    OC311     5   110.100000   633.457600   0.00000000         0.00\n\
-  CC3263   CC3161    OC311     5   110.100000   633.457600   0.00000000         0.00\n\
-   CC312    CC322    OC311     5   106.000000   418.400000   0.00000000         0.00\n\
-  CC3163    CC321    OC311     5   110.100000   633.457600   0.00000000         0.00\n\
-   CC311    CC321    OC311     5   110.100000   633.457600   0.00000000         0.00\n\
-   CC321    CC311    OC311     5   110.100000   633.457600   0.00000000         0.00\n\
-   CC322    CC312    OC311     5   108.000000   633.457600   0.00000000         0.00\n\
-   CC331    CC301    OC311     5   113.000000   633.457600   0.00000000         0.00\n\
-  CC3261   CC3062    OC311     5   113.000000   633.457600   0.00000000         0.00\n\
-   CC2O2    CC301    OC311     5   110.100000   633.457600   0.00000000         0.00\n\
-   CC2O2   CC3062    OC311     5   110.100000   633.457600   0.00000000         0.00\n\
-  CC3163    CC2O2    OC2D2     5   114.000000   334.720000   0.23880000     41840.00\n\
-  CC3062    CC2O2    OC2D2     5   114.000000   334.720000   0.23880000     41840.00\n\
-   CC311    CC2O2    OC2D2     5   114.000000   334.720000   0.23880000     41840.00\n\
-   CC301    CC2O2    OC2D2     5   114.000000   334.720000   0.23880000     41840.00\n\
-   CC321    CC2O2    OC2D2     5   114.000000   334.720000   0.23880000     41840.00\n\
-   OC2D1    CC2O1    CC331     5   121.000000   669.440000   0.00000000         0.00\n\
-   OC301    CC311    CC331     5   111.500000   376.560000   0.00000000         0.00\n\
-   OC301    CC321    CC321     5   111.500000   376.560000   0.00000000         0.00\n\
-   OC301    CC301    CC331     5   109.000000   376.560000   0.00000000         0.00\n\
-  OC3C61   CC311C    CC321     5   109.000000   376.560000   0.00000000         0.00\n\
-  OC3C61   CC311C   CC321C     5   111.500000   376.560000   0.00000000         0.00\n\
-  OC3C61   CC321C   CC321C     5   111.500000   376.560000   0.00000000         0.00\n\
-  OC3C61   CC321C   CC311C     5   111.500000   376.560000   0.00000000         0.00\n\
-  OC3C61   CC321D   CC321C     5   111.500000   376.560000   0.00000000         0.00\n\
-  OC3C61   CC321D   CC311C     5   111.500000   376.560000   0.00000000         0.00\n\
-  OC3C61   CC311D   CC321C     5   111.500000   376.560000   0.00000000         0.00\n\
-   OC301   CC311D   CC321C     5   109.000000   376.560000   0.00000000         0.00\n\
-   OC301   CC3162   CC3161     5   105.000000   376.560000   0.00000000         0.00\n\
-   OC301   CC3062   CC3261     5   105.000000   376.560000   0.00000000         0.00\n\
-   OC302   CC311D   CC321C     5   109.000000   376.560000   0.00000000         0.00\n\
-   OC302   CC3162   CC3161     5   105.000000   376.560000   0.00000000         0.00\n\
-   OC301   CC311C   CC321C     5   109.000000   376.560000   0.00000000         0.00\n\
-   OC301   CC3161   CC3161     5   109.000000   376.560000   0.00000000         0.00\n\
-   OC301   CC3161   CC3163     5   109.000000   376.560000   0.00000000         0.00\n\
-   OC301   CC311C   CC321D     5   109.000000   376.560000   0.00000000         0.00\n\
-   OC301   CC3161   CC3162     5   109.000000   376.560000   0.00000000         0.00\n\
-   OC301    CC321   CC311C     5   106.000000   376.560000   0.00000000         0.00\n\
-   OC301    CC321   CC3163     5   106.000000   376.560000   0.00000000         0.00\n\
-   CC321    CC321   OC311M     5   110.100000   633.457600   0.00000000         0.00\n\
-   CC331    CC321   OC311M     5   110.100000   633.457600   0.00000000         0.00\n\
-   CC331    CC311   OC311M     5   110.100000   633.457600   0.00000000         0.00\n\
-  CC3161    OC311     HCP1     5   109.000000   418.400000   0.00000000         0.00\n\
-   CC321    OC311     HCP1     5   109.000000   418.400000   0.00000000         0.00\n\
-  CC3162    OC311     HCP1     5   109.000000   418.400000   0.00000000         0.00\n\
-  CC3062    OC311     HCP1     5   109.000000   418.400000   0.00000000         0.00\n\
-    HCP1    OC311    CC311     5   106.000000   418.400000   0.00000000         0.00\n\
-    HCP1    OC311    CC312     5   106.000000   418.400000   0.00000000         0.00\n\
-    HCP1    OC311    CC301     5   106.000000   418.400000   0.00000000         0.00\n\
-    HCP1    OC311    CC322     5   106.000000   418.400000   0.00000000         0.00\n\
-    HCP1   OC311M    CC321     5   106.000000   418.400000   0.00000000         0.00\n\
-   HCP1M   OC311M    CC321     5   106.000000   418.400000   0.00000000         0.00\n\
-    HCP1   OC311M    CC311     5   106.000000   418.400000   0.00000000         0.00\n\
-    HCP1   OC311M    CC331     5   106.000000   481.160000   0.00000000         0.00\n\
-   OC311   CC3162   OC3C61     5   116.500000   376.560000   0.00000000         0.00\n\
-   OC311    CC301    OC301     5   116.500000   376.560000   0.00000000         0.00\n\
-   OC311   CC3062   OC3C61     5   113.000000   376.560000   0.00000000         0.00\n\
-   OC2D2    CC2O2    OC2D2     5   132.000000   836.800000   0.22250000     58576.00\n\
-   OC301   CC311D   OC3C61     5   110.000000   753.120000   0.00000000         0.00\n\
-   OC301   CC3162   OC3C61     5   112.000000   753.120000   0.00000000         0.00\n\
-   OC301   CC3062   OC3C61     5   112.000000   753.120000   0.00000000         0.00\n\
-   OC302   CC311D   OC3C61     5   110.000000   753.120000   0.00000000         0.00\n\
-   OC302   CC3162   OC3C61     5   112.000000   753.120000   0.00000000         0.00\n\
-  CC3163   OC3C61   CC3162     5   109.700000   794.960000   0.00000000         0.00\n\
-  CC3163   OC3C61   CC3062     5   109.700000   794.960000   0.00000000         0.00\n\
-  CC3263   OC3C61   CC3162     5   109.700000   794.960000   0.00000000         0.00\n\
-   CC311    OC301    CC331     5   109.700000   794.960000   0.00000000         0.00\n\
-   CC301    OC301    CC331     5   109.700000   794.960000   0.00000000         0.00\n\
-  CC321C   OC3C61   CC321C     5   109.700000   794.960000   0.00000000         0.00\n\
-  CC321D   OC3C61   CC321C     5   109.700000   794.960000   0.00000000         0.00\n\
-  CC321D   OC3C61   CC311C     5   109.700000   794.960000   0.00000000         0.00\n\
-  CC311D   OC3C61   CC321C     5   109.700000   794.960000   0.00000000         0.00\n\
-  CC311D    OC301    CC331     5   109.700000   794.960000   0.00000000         0.00\n\
-  CC3162    OC301    CC331     5   109.700000   794.960000   0.00000000         0.00\n\
-  CC3162    OC301    CC321     5   109.700000   794.960000   0.00000000         0.00\n\
-   CC321    OC301    CC331     5   109.700000   794.960000   0.00000000         0.00\n\
-  CC311D    OC302   CC311D     5   111.500000   418.400000   0.00000000         0.00\n\
-  CC3162    OC302   CC3162     5   111.500000   418.400000   0.00000000         0.00\n\
-  CC311C    OC301   CC311D     5   109.200000   418.400000   0.00000000         0.00\n\
-  CC3161    OC301   CC3162     5   109.200000   418.400000   0.00000000         0.00\n\
-  CC3161    OC301   CC3062     5   109.200000   418.400000   0.00000000         0.00\n\
-    HCA1    CC312    OC311     5   108.890000   460.240000   0.00000000         0.00\n\
-    HCA1   CC3161    OC311     5   108.890000   460.240000   0.00000000         0.00\n\
-    HCA1   CC3162    OC311     5   108.890000   460.240000   0.00000000         0.00\n\
-    HCA1   CC3163    OC311     5   108.890000   460.240000   0.00000000         0.00\n\
-    HCA2    CC321    OC311     5   108.890000   460.240000   0.00000000         0.00\n\
-    HCA2    CC322    OC311     5   108.890000   460.240000   0.00000000         0.00\n\
-    HCA1   CC3162   OC3C61     5   109.500000   376.560000   0.00000000         0.00\n\
-    HCA1   CC3163   OC3C61     5   109.500000   376.560000   0.00000000         0.00\n\
-    HCA2   CC3263   OC3C61     5   109.500000   376.560000   0.00000000         0.00\n\
-    HCA1    CC311    OC301     5   109.500000   502.080000   0.00000000         0.00\n\
-   OC301    CC321     HCA2     5   109.500000   502.080000   0.00000000         0.00\n\
-   OC301    CC331     HCA3     5   109.500000   502.080000   0.00000000         0.00\n\
-    HCA3    CC331   OC311M     5   108.890000   460.240000   0.00000000         0.00\n\
-    HCA2    CC321   OC311M     5   108.890000   460.240000   0.00000000         0.00\n\
-    HCA1    CC311   OC311M     5   108.890000   460.240000   0.00000000         0.00\n\
-    HCA2   CC321C   OC3C61     5   109.500000   376.560000   0.00000000         0.00\n\
-    HCA2   CC321D   OC3C61     5   109.500000   376.560000   0.00000000         0.00\n\
-    HCA1   CC311C   OC3C61     5   109.500000   376.560000   0.00000000         0.00\n\
-    HCA1   CC311D   OC3C61     5   109.500000   376.560000   0.00000000         0.00\n\
-    HCA1   CC311D    OC301     5   109.500000   502.080000   0.00000000         0.00\n\
-    HCA1   CC3162    OC301     5   109.500000   502.080000   0.00000000         0.00\n\
-    HCA1   CC311D    OC302     5   109.500000   502.080000   0.00000000         0.00\n\
-    HCA1   CC3162    OC302     5   109.500000   502.080000   0.00000000         0.00\n\
-    HCA1   CC311C    OC301     5   109.500000   502.080000   0.00000000         0.00\n\
-    HCA1   CC3161    OC301     5   109.500000   502.080000   0.00000000         0.00\n\
-  CC322C   CC322C   CC322C     5   109.500000   485.344000   0.25610000      9338.69\n\
-  HCA2C2   CC322C   CC322C     5   111.400000   292.880000   0.21790000     18853.10\n\
-  HCA2C2   CC322C   HCA2C2     5   106.800000   322.168000   0.18020000      4518.72\n\
-  OC3C5M   CC322C   CC322C     5   111.100000   376.560000   0.00000000         0.00\n\
-  CC322C   OC3C5M   CC322C     5   111.000000   794.960000   0.00000000         0.00\n\
-  HCA2C2   CC322C   OC3C5M     5   107.300000   585.760000   0.00000000         0.00\n\
-    HCA3    CC331   CC312C     5   110.100000   279.742240   0.21790000     18853.10\n\
-  CC322C   CC312C    CC331     5   114.000000   446.432800   0.25610000      6694.40\n\
-  HCA1C2   CC312C    CC331     5   110.100000   288.696000   0.21790000     18853.10\n\
-  OC3C5M   CC312C    CC331     5   111.500000   376.560000   0.00000000         0.00\n\
-  HCA1C2   CC312C   CC322C     5   111.400000   292.880000   0.21790000     18853.10\n\
-  HCA2C2   CC322C   CC312C     5   111.400000   292.880000   0.21790000     18853.10\n\
-  CC312C   CC322C   CC322C     5   109.500000   485.344000   0.25610000      9338.69\n\
-  CC322C   CC312C   CC322C     5   109.500000   485.344000   0.25610000      9338.69\n\
-  OC3C5M   CC312C   CC322C     5   111.100000   376.560000   0.00000000         0.00\n\
-  CC312C   OC3C5M   CC322C     5   111.000000   794.960000   0.00000000         0.00\n\
-  HCA1C2   CC312C   OC3C5M     5   107.300000   585.760000   0.00000000         0.00\n\
-  HCA1C2   CC312C    OC301     5   109.500000   502.080000   0.00000000         0.00\n\
-   OC301   CC312C   CC322C     5   106.500000   376.560000   0.00000000         0.00\n\
-  CC312C    OC301    CC331     5   109.700000   794.960000   0.00000000         0.00\n\
-   OC301   CC312C   OC3C5M     5   112.000000   753.120000   0.00000000         0.00\n\
-  OC3C51   CC3152   CC3251     5   111.100000   376.560000   0.00000000         0.00\n\
-  OC3C51   CC3051   CC3251     5   111.100000   376.560000   0.00000000         0.00\n\
-  OC3C51   CC3152   CC3151     5   111.100000   376.560000   0.00000000         0.00\n\
-  OC3C51   CC3051   CC3151     5   111.100000   376.560000   0.00000000         0.00\n\
-  OC3C51   CC3153   CC3151     5   111.100000   376.560000   0.00000000         0.00\n\
-  OC3C51   CC3153    CC321     5   108.000000   376.560000   0.00000000         0.00\n\
-  OC3C51   CC3051    CC321     5   108.000000   376.560000   0.00000000         0.00\n\
-   OC311   CC3151   CC3251     5   110.100000   633.457600   0.00000000         0.00\n\
-   OC311   CC3151   CC3153     5   110.100000   633.457600   0.00000000         0.00\n\
-   OC311   CC3151   CC3152     5   110.100000   633.457600   0.00000000         0.00\n\
-   OC311   CC3151   CC3051     5   110.100000   633.457600   0.00000000         0.00\n\
-   OC311   CC3151   CC3151     5   110.100000   633.457600   0.00000000         0.00\n\
-   OC311    CC321   CC3153     5   110.100000   633.457600   0.00000000         0.00\n\
-   OC311    CC321   CC3152     5   110.100000   633.457600   0.00000000         0.00\n\
-   OC311    CC321   CC3051     5   110.100000   633.457600   0.00000000         0.00\n\
-   OC311   CC3152   CC3251     5   110.100000   633.457600   0.00000000         0.00\n\
-   OC311   CC3051   CC3251     5   110.100000   633.457600   0.00000000         0.00\n\
-   OC311   CC3152    CC321     5   110.100000   633.457600   0.00000000         0.00\n\
-   OC311   CC3051    CC321     5   110.100000   633.457600   0.00000000         0.00\n\
-   OC311   CC3152   CC3151     5   110.100000   633.457600   0.00000000         0.00\n\
-   OC311   CC3051   CC3151     5   110.100000   633.457600   0.00000000         0.00\n\
-  OC3C51   CC3152    OC311     5   116.500000   376.560000   0.00000000         0.00\n\
-  OC3C51   CC3051    OC311     5   116.500000   376.560000   0.00000000         0.00\n\
-  OC3C51   CC3152     HCA1     5   107.300000   585.760000   0.00000000         0.00\n\
-  OC3C51   CC3153     HCA1     5   107.300000   585.760000   0.00000000         0.00\n\
-   OC311   CC3152     HCA1     5   108.890000   460.240000   0.00000000         0.00\n\
-   OC311   CC3151     HCA1     5   108.890000   460.240000   0.00000000         0.00\n\
-  CC3152    OC311     HCP1     5   109.000000   418.400000   0.00000000         0.00\n\
-  CC3051    OC311     HCP1     5   109.000000   418.400000   0.00000000         0.00\n\
-  CC3151    OC311     HCP1     5   109.000000   418.400000   0.00000000         0.00\n\
-  CC3153   OC3C51   CC3152     5   111.000000   794.960000   0.00000000         0.00\n\
-  CC3153   OC3C51   CC3051     5   111.000000   794.960000   0.00000000         0.00\n\
-  CC3152   CC3251   CC3151     5   109.500000   485.344000   0.25610000      9338.69\n\
-  CC3051   CC3251   CC3151     5   109.500000   485.344000   0.25610000      9338.69\n\
-  CC3152   CC3151   CC3151     5   109.500000   485.344000   0.25610000      9338.69\n\
-  CC3051   CC3151   CC3151     5   109.500000   485.344000   0.25610000      9338.69\n\
-  CC3251   CC3151   CC3153     5   109.500000   485.344000   0.25610000      9338.69\n\
-  CC3151   CC3151   CC3153     5   109.500000   485.344000   0.25610000      9338.69\n\
-  CC3151   CC3153    CC321     5   113.500000   488.272800   0.25610000      9338.69\n\
-  CC3151   CC3051    CC321     5   113.500000   488.272800   0.25610000      9338.69\n\
-  CC3152   CC3251     HCA2     5   111.400000   292.880000   0.21790000     18853.10\n\
-  CC3051   CC3251     HCA2     5   111.400000   292.880000   0.21790000     18853.10\n\
-  CC3251   CC3152     HCA1     5   111.400000   292.880000   0.21790000     18853.10\n\
-  CC3251   CC3151     HCA1     5   111.400000   292.880000   0.21790000     18853.10\n\
-  CC3151   CC3251     HCA2     5   111.400000   292.880000   0.21790000     18853.10\n\
-  CC3153   CC3151     HCA1     5   111.400000   292.880000   0.21790000     18853.10\n\
-  CC3152   CC3151     HCA1     5   111.400000   292.880000   0.21790000     18853.10\n\
-  CC3051   CC3151     HCA1     5   111.400000   292.880000   0.21790000     18853.10\n\
-  CC3151   CC3151     HCA1     5   111.400000   292.880000   0.21790000     18853.10\n\
-  CC3151   CC3152     HCA1     5   111.400000   292.880000   0.21790000     18853.10\n\
-  CC3151   CC3153     HCA1     5   111.400000   292.880000   0.21790000     18853.10\n\
-  CC3153    CC321     HCA2     5   110.100000   279.742240   0.21790000     18853.10\n\
-  CC3152    CC321     HCA2     5   110.100000   279.742240   0.21790000     18853.10\n\
-  CC3051    CC321     HCA2     5   110.100000   279.742240   0.21790000     18853.10\n\
-   CC321   CC3153     HCA1     5   110.100000   288.696000   0.21790000     18853.10\n\
-    HCA2   CC3251     HCA2     5   106.800000   322.168000   0.18020000      4518.72\n\
-    HCA1   CC3152    OC301     5   109.500000   502.080000   0.00000000         0.00\n\
-   OC301   CC3152   CC3151     5   105.000000   376.560000   0.00000000         0.00\n\
-  CC3152    OC301    CC331     5   111.000000   794.960000   0.00000000         0.00\n\
-   OC301   CC3152   OC3C51     5   112.000000   753.120000   0.00000000         0.00\n\
-  CC321C   CC311D   CC321C     5   112.000000   488.272800   0.25610000      9338.69\n\
-  CC321D   CC311D   CC321C     5   112.000000   488.272800   0.25610000      9338.69\n\
-  CC311D   CC311D   CC321C     5   112.000000   488.272800   0.25610000      9338.69\n\
-  OC3C61   CC311D   CC311D     5   111.500000   376.560000   0.00000000         0.00\n\
-  OC3C61   CC321D   CC311D     5   111.500000   376.560000   0.00000000         0.00\n\
-    HCA1   CC311D   CC311D     5   110.100000   288.696000   0.21790000     18853.10\n\
-    HCA2   CC321D   CC311D     5   110.100000   288.696000   0.21790000     18853.10\n\
-    HCA1   CC311D   CC321D     5   110.100000   288.696000   0.21790000     18853.10\n\
-   OC30P   CC311D   CC321C     5   107.000000   376.560000   0.00000000         0.00\n\
-   OC30P   CC311D   CC311D     5   107.000000   376.560000   0.00000000         0.00\n\
-   OC30P   CC3161   CC3161     5   107.000000   376.560000   0.00000000         0.00\n\
-   OC30P   CC3161   CC3163     5   107.000000   376.560000   0.00000000         0.00\n\
-   OC30P   CC311D   CC321D     5   109.000000   376.560000   0.00000000         0.00\n\
-   OC30P   CC3162   CC3161     5   109.000000   376.560000   0.00000000         0.00\n\
-   OC30P   CC3161   CC3162     5   109.000000   376.560000   0.00000000         0.00\n\
-   OC30P    CC321   CC311C     5   107.500000   633.457600   0.00000000         0.00\n\
-   OC30P    CC321   CC3163     5   107.500000   633.457600   0.00000000         0.00\n\
-   OC30P   CC311D   OC3C61     5   110.000000   753.120000   0.00000000         0.00\n\
-   OC30P   CC3162   OC3C61     5   110.000000   753.120000   0.00000000         0.00\n\
-   OC30P    CC321     HCA2     5   109.500000   502.080000   0.00000000         0.00\n\
-   OC30P   CC3162     HCA1     5   109.500000   502.080000   0.00000000         0.00\n\
-   OC30P   CC3161     HCA1     5   109.500000   502.080000   0.00000000         0.00\n\
-   OC30P   CC311D     HCA1     5   109.500000   502.080000   0.00000000         0.00\n\
-   OC30P       PC    OC2DP     5   111.600000   827.595200   0.00000000         0.00\n\
-   OC2DP       PC    OC2DP     5   120.000000  1004.160000   0.00000000         0.00\n\
-   OC2DP       PC    OC312     5   113.230000   827.595200   0.00000000         0.00\n\
-   OC312       PC    OC312     5   104.413000   827.595200   0.00000000         0.00\n\
-   OC30P       PC    OC312     5   108.000000   402.500800   0.00000000         0.00\n\
-    HCP1    OC312       PC     5   115.000000   251.040000   0.23500000     33472.00\n\
-  CC3161    OC30P       PC     5   120.000000   167.360000   0.23300000     29288.00\n\
-  CC311D    OC30P       PC     5   120.000000   167.360000   0.23300000     29288.00\n\
-  CC3162    OC30P       PC     5   120.000000   167.360000   0.23300000     29288.00\n\
-  CC311D    OC30P       SC     5   109.000000   125.520000   0.19000000     22593.60\n\
-  CC3161    OC30P       SC     5   109.000000   125.520000   0.19000000     22593.60\n\
-   CC321    OC30P       SC     5   110.100000   125.520000   0.19000000     22593.60\n\
-   OC2DP       SC    OC2DP     5   109.470000  1087.840000   0.24500000     29288.00\n\
-   OC30P       SC    OC2DP     5    98.000000   711.280000   0.00000000         0.00\n\
-  CC311D    OC301    CC321     5   109.700000   794.960000   0.00000000         0.00\n\
-   OC301    CC321    CC331     5   111.500000   376.560000   0.00000000         0.00\n\
-   OC301   CC312D   OC3C5M     5   112.000000   753.120000   0.00000000         0.00\n\
-    HCA1   CC312D    OC301     5   109.500000   502.080000   0.00000000         0.00\n\
-   OC301   CC312D   CC322C     5   106.500000   376.560000   0.00000000         0.00\n\
-  CC312D    OC301    CC331     5   109.700000   794.960000   0.00000000         0.00\n\
-  CC311D    OC302   CC312D     5   111.500000   418.400000   0.00000000         0.00\n\
-  CC312D   OC3C5M   CC322C     5   111.000000   794.960000   0.00000000         0.00\n\
-   OC302   CC312D   OC3C5M     5   112.000000   753.120000   0.00000000         0.00\n\
-  HCA2C2   CC322C   CC312D     5   111.400000   292.880000   0.21790000     18853.10\n\
-  CC312D   CC322C   CC322C     5   109.500000   485.344000   0.25610000      9338.69\n\
-  OC3C5M   CC312D   CC322C     5   111.100000   376.560000   0.00000000         0.00\n\
-   OC302   CC312D   CC322C     5   106.500000   376.560000   0.00000000         0.00\n\
-    HCA1   CC312D    OC302     5   109.500000   502.080000   0.00000000         0.00\n\
-    HCA1   CC312D   OC3C5M     5   107.300000   585.760000   0.00000000         0.00\n\
-    HCA1   CC312D   CC322C     5   111.400000   292.880000   0.21790000     18853.10\n\
-    HCA1   CC312C   OC3C5M     5   107.300000   585.760000   0.00000000         0.00\n\
-    HCA1   CC312C   CC322C     5   111.400000   292.880000   0.21790000     18853.10\n\
-   CC321   CC312C   CC322C     5   113.000000   488.272800   0.25610000      9338.69\n\
-    HCA1   CC312C    CC321     5   110.100000   288.696000   0.21790000     18853.10\n\
-    HCA2    CC321   CC312C     5   110.100000   279.742240   0.21790000     18853.10\n\
-   OC301    CC321   CC312C     5   106.000000   376.560000   0.00000000         0.00\n\
-  OC3C5M   CC312C    CC321     5   109.000000   502.080000   0.00000000         0.00\n\
-  CC312C    OC303    CC331     5   109.700000   794.960000   0.00000000         0.00\n\
-   OC303    CC331     HCA3     5   109.500000   502.080000   0.00000000         0.00\n\
-   OC303   CC311D   CC321C     5   109.000000   376.560000   0.00000000         0.00\n\
-   OC303   CC311D   OC3C61     5   110.000000   753.120000   0.00000000         0.00\n\
-    HCA1   CC311D    OC303     5   109.500000   502.080000   0.00000000         0.00\n\
-    HCA1   CC312C    OC303     5   109.500000   502.080000   0.00000000         0.00\n\
-   OC303   CC312C   CC322C     5   110.500000   376.560000   0.00000000         0.00\n\
-  CC311D    OC303   CC312C     5   109.500000   418.400000   0.00000000         0.00\n\
-  OC3C5M   CC322C   CC312C     5   111.100000   376.560000   0.00000000         0.00\n\
-  CC311C    OC301   CC312D     5   109.200000   418.400000   0.00000000         0.00\n\
-  CC3162    OC302   CC3051     5   111.500000   418.400000   0.00000000         0.00\n\
-   OC302   CC3051   OC3C51     5   112.000000   753.120000   0.00000000         0.00\n\
-   OC302   CC3051    CC321     5   110.100000   633.457600   0.00000000         0.00\n\
-   OC302   CC3051   CC3151     5   105.000000   376.560000   0.00000000         0.00\n\
-    HCA1   CC3162    OC303     5   109.500000   502.080000   0.00000000         0.00\n\
-   OC303   CC3162   OC3C61     5   112.000000   753.120000   0.00000000         0.00\n\
-   OC303   CC3162   CC3161     5   105.000000   376.560000   0.00000000         0.00\n\
-  CC3162    OC303   CC3151     5   109.500000   418.400000   0.00000000         0.00\n\
-   OC303   CC3151   CC3153     5   110.500000   376.560000   0.00000000         0.00\n\
-   OC303   CC3151   CC3151     5   110.500000   376.560000   0.00000000         0.00\n\
-   OC303   CC3151     HCA1     5   109.500000   502.080000   0.00000000         0.00\n\
-   OC303   CC3151   CC3051     5   110.500000   376.560000   0.00000000         0.00\n\
-  CC3051    CC321    OC301     5   106.000000   376.560000   0.00000000         0.00\n\
-   CC321    OC301   CC3051     5   112.200000   794.960000   0.00000000         0.00\n\
-   OC301   CC3051   OC3C51     5   112.000000   753.120000   0.00000000         0.00\n\
-   OC301   CC3051    CC321     5   110.100000   633.457600   0.00000000         0.00\n\
-   OC301   CC3051   CC3151     5   106.500000   376.560000   0.00000000         0.00\n\
-  CC3153    CC321    OC301     5   106.000000   376.560000   0.00000000         0.00\n\
-  CC3152    OC301    CC321     5   111.000000   794.960000   0.00000000         0.00\n\
-  CC3161    OC301   CC3152     5   109.200000   418.400000   0.00000000         0.00\n\
-   OC301   CC3161   CC3263     5   109.000000   376.560000   0.00000000         0.00\n\
-  CC3162    OC30P       SC     5   109.000000   125.520000   0.19000000     22593.60\n\
-     CN7      CN8      CN8     5   113.600000   488.272800   0.25610000      9338.69\n\
-     CN8      CN7      CN8     5   113.600000   488.272800   0.25610000      9338.69\n\
-     CN8      CN8      CN8     5   113.600000   488.272800   0.25610000      9338.69\n\
-     HN1      NN6      CN8     5   109.500000   251.040000   0.20740000     16736.00\n\
-     NN6      CN8      HN8     5   107.500000   376.560000   0.21010000     29288.00\n\
-     CN7      CN8      ON2     5   109.700000   962.320000   0.00000000         0.00\n\
-     NN6      CN8      CN8     5   110.000000   566.513600   0.00000000         0.00\n\
-     HN1      NN6      HN1     5   109.500000   368.192000   0.00000000         0.00\n\
-     ON2      CN8      CN8     5   109.700000   962.320000   0.00000000         0.00\n\
-     CN7      ON6     CN8B     5   109.000000   920.480000   0.00000000         0.00\n\
-     ON6     CN8B      CN8     5   106.000000   753.120000   0.00000000         0.00\n\
-    CN8B      CN8      CN7     5   106.000000   669.440000   0.00000000         0.00\n\
-     ON6     CN8B      HN8     5   107.240000   378.233600   0.00000000         0.00\n\
-     HN8     CN8B      CN8     5   110.100000   288.947040   0.21790000     18853.10\n\
-     HN8      CN8     CN8B     5   110.100000   288.947040   0.21790000     18853.10\n\
-     CN2     NN3A      CN4     5   117.800000   753.120000   0.00000000         0.00\n\
-    NN3A      CN4     NN3A     5   133.000000   502.080000   0.00000000         0.00\n\
-     CN4     NN3A      CN5     5   110.100000   753.120000   0.00000000         0.00\n\
-     CN5      CN5     NN3A     5   127.400000   502.080000   0.00000000         0.00\n\
-     CN2      CN5      CN5     5   121.000000   502.080000   0.00000000         0.00\n\
-     CN5      CN2     NN3A     5   110.700000   502.080000   0.00000000         0.00\n\
-     CN5      CN5      NN2     5   105.700000   836.800000   0.00000000         0.00\n\
-     CN5      CN5      NN4     5   110.000000   836.800000   0.00000000         0.00\n\
-     CN4      NN4      CN5     5   104.600000  1004.160000   0.00000000         0.00\n\
-     NN2      CN4      NN4     5   113.400000   836.800000   0.00000000         0.00\n\
-     CN4      NN2      CN5     5   106.300000   836.800000   0.00000000         0.00\n\
-     NN2      CN5     NN3A     5   126.900000   836.800000   0.00000000         0.00\n\
-     CN2      CN5      NN4     5   129.000000   836.800000   0.00000000         0.00\n\
-     HN3      CN4     NN3A     5   113.500000   317.984000   0.00000000         0.00\n\
-    NN3A      CN2      NN1     5   130.700000   418.400000   0.00000000         0.00\n\
-     CN5      CN2      NN1     5   118.600000   418.400000   0.00000000         0.00\n\
-     CN2      NN1      HN1     5   121.500000   334.720000   0.00000000         0.00\n\
-     HN1      NN1      HN1     5   117.000000   259.408000   0.00000000         0.00\n\
-     NN4      CN4      HN3     5   124.800000   326.352000   0.00000000         0.00\n\
-     NN2      CN4      HN3     5   121.800000   326.352000   0.00000000         0.00\n\
-     CN5      NN2      HN2     5   129.400000   251.040000   0.00000000         0.00\n\
-     CN4      NN2      HN2     5   125.000000   251.040000   0.00000000         0.00\n\
-     CN1     NN2G      CN2     5   131.100000   585.760000   0.00000000         0.00\n\
-    NN2G      CN2     NN3G     5   122.200000   585.760000   0.00000000         0.00\n\
-     CN2     NN3G      CN5     5   109.400000   753.120000   0.00000000         0.00\n\
-    CN5G      CN5     NN3G     5   129.900000   585.760000   0.00000000         0.00\n\
-     CN1     CN5G      CN5     5   119.600000   585.760000   0.00000000         0.00\n\
-    CN5G      CN1     NN2G     5   107.800000   585.760000   0.00000000         0.00\n\
-    CN5G      CN5     NN2B     5   104.600000   836.800000   0.00000000         0.00\n\
-     CN5     CN5G      NN4     5   111.400000   836.800000   0.00000000         0.00\n\
-     CN4      NN4     CN5G     5   103.800000  1004.160000   0.00000000         0.00\n\
-    NN2B      CN4      NN4     5   113.000000   836.800000   0.00000000         0.00\n\
-     CN4     NN2B      CN5     5   107.200000   836.800000   0.00000000         0.00\n\
-    NN2B      CN5     NN3G     5   125.500000  1171.520000   0.00000000         0.00\n\
-     CN1     CN5G      NN4     5   129.000000  1046.000000   0.00000000         0.00\n\
-     CN1     NN2G      HN2     5   113.300000   376.560000   0.00000000         0.00\n\
-     CN2     NN2G      HN2     5   115.600000   376.560000   0.00000000         0.00\n\
-     NN1      CN2     NN2G     5   115.400000   794.960000   0.00000000         0.00\n\
-     NN1      CN2     NN3G     5   122.400000   794.960000   0.00000000         0.00\n\
-    NN2G      CN1      ON1     5   127.500000   418.400000   0.00000000         0.00\n\
-    CN5G      CN1      ON1     5   124.700000   418.400000   0.00000000         0.00\n\
-     HN3      CN4     NN2B     5   122.200000   334.720000   0.00000000         0.00\n\
-     CN4     NN2B      HN2     5   124.600000   251.040000   0.00000000         0.00\n\
-     CN5     NN2B      HN2     5   129.300000   251.040000   0.00000000         0.00\n\
-     CN1      NN2      CN3     5   124.100000   418.400000   0.00000000         0.00\n\
-     NN2      CN1      NN3     5   116.800000   418.400000   0.00000000         0.00\n\
-     CN1      NN3      CN2     5   119.100000   711.280000   0.00000000         0.00\n\
-     CN3      CN2      NN3     5   119.300000   711.280000   0.00000000         0.00\n\
-     CN2      CN3      CN3     5   117.800000   711.280000   0.00000000         0.00\n\
-     CN3      CN3      NN2     5   122.900000   711.280000   0.00000000         0.00\n\
-     CN1      NN2      HN2     5   121.200000   309.616000   0.00000000         0.00\n\
-     CN3      NN2      HN2     5   114.700000   309.616000   0.00000000         0.00\n\
-     NN2      CN1     ON1C     5   119.400000  1087.840000   0.00000000         0.00\n\
-     NN3      CN1     ON1C     5   123.800000  1087.840000   0.00000000         0.00\n\
-     NN3      CN2      NN1     5   122.300000   677.808000   0.00000000         0.00\n\
-     CN3      CN2      NN1     5   118.400000   677.808000   0.00000000         0.00\n\
-     CN2      CN3      HN3     5   120.100000   317.984000   0.00000000         0.00\n\
-     CN3      CN3      HN3     5   122.100000   317.984000   0.00000000         0.00\n\
-     HN3      CN3      NN2     5   115.000000   368.192000   0.00000000         0.00\n\
-    CN1T     NN2B      CN3     5   122.000000   585.760000   0.00000000         0.00\n\
-    NN2B     CN1T     NN2U     5   114.000000   418.400000   0.00000000         0.00\n\
-    CN1T     NN2U      CN1     5   130.200000   418.400000   0.00000000         0.00\n\
-    NN2U      CN1      CN3     5   112.600000   585.760000   0.00000000         0.00\n\
-     CN1      CN3      CN3     5   117.600000   836.800000   0.00000000         0.00\n\
-     CN3      CN3     NN2B     5   123.600000   836.800000   0.00000000         0.00\n\
-    CN1T     NN2B      HN2     5   122.000000   338.904000   0.00000000         0.00\n\
-     CN3     NN2B      HN2     5   116.000000   267.776000   0.00000000         0.00\n\
-    NN2B     CN1T      ON1     5   121.600000   836.800000   0.00000000         0.00\n\
-    NN2U     CN1T      ON1     5   124.400000   836.800000   0.00000000         0.00\n\
-    CN1T     NN2U      HN2     5   114.400000   338.904000   0.00000000         0.00\n\
-     CN1     NN2U      HN2     5   115.400000   338.904000   0.00000000         0.00\n\
-    NN2U      CN1      ON1     5   121.900000   836.800000   0.00000000         0.00\n\
-     CN3      CN1      ON1     5   125.500000   836.800000   0.00000000         0.00\n\
-     CN1      CN3      HN3     5   120.300000   251.040000   0.00000000         0.00\n\
-     HN3      CN3     NN2B     5   114.300000   251.040000   0.00000000         0.00\n\
-    CN3T      CN1     NN2U     5   113.500000   585.760000   0.00000000         0.00\n\
-     CN1     CN3T      CN3     5   116.700000  1004.160000   0.00000000         0.00\n\
-    CN3T      CN3     NN2B     5   123.600000  1004.160000   0.00000000         0.00\n\
-    CN3T      CN1      ON1     5   124.600000   836.800000   0.00000000         0.00\n\
-     CN1     CN3T      CN9     5   118.700000   317.984000   0.00000000         0.00\n\
-     CN3     CN3T      CN9     5   124.600000   317.984000   0.00000000         0.00\n\
-    CN3T      CN3      HN3     5   122.100000   251.040000   0.00000000         0.00\n\
-    CN1T     NN2B      CN9     5   116.000000   585.760000   0.00000000         0.00\n\
-     CN3     NN2B      CN9     5   122.000000   585.760000   0.00000000         0.00\n\
-     CN1      NN2      CN9     5   115.400000   585.760000   0.00000000         0.00\n\
-     CN3      NN2      CN9     5   120.500000   585.760000   0.00000000         0.00\n\
-     CN5      NN2      CN9     5   125.900000   585.760000   0.00000000         0.00\n\
-     CN4      NN2      CN9     5   127.800000   585.760000   0.00000000         0.00\n\
-     CN5     NN2B      CN9     5   125.900000   585.760000   0.00000000         0.00\n\
-     CN4     NN2B      CN9     5   126.900000   585.760000   0.00000000         0.00\n\
-     CN5     NN2B      CN8     5   125.900000   585.760000   0.00000000         0.00\n\
-     CN4     NN2B      CN8     5   126.900000   585.760000   0.00000000         0.00\n\
-    NN2B      CN8      CN9     5   113.700000   585.760000   0.00000000         0.00\n\
-    CN1T     NN2B     CN7B     5   118.400000   376.560000   0.00000000         0.00\n\
-     CN3     NN2B     CN7B     5   119.600000   376.560000   0.00000000         0.00\n\
-     CN1      NN2     CN7B     5   120.000000   376.560000   0.00000000         0.00\n\
-     CN3      NN2     CN7B     5   115.900000   376.560000   0.00000000         0.00\n\
-     CN5      NN2     CN7B     5   126.100000   376.560000   0.00000000         0.00\n\
-     CN4      NN2     CN7B     5   127.600000   376.560000   0.00000000         0.00\n\
-     CN5     NN2B     CN7B     5   126.500000   376.560000   0.00000000         0.00\n\
-     CN4     NN2B     CN7B     5   126.300000   376.560000   0.00000000         0.00\n\
-     ON6     CN7B      NN2     5   108.000000   920.480000   0.00000000         0.00\n\
-    ON6B     CN7B      NN2     5   112.000000   920.480000   0.00000000         0.00\n\
-     CN8     CN7B      NN2     5   113.700000   920.480000   0.00000000         0.00\n\
-    CN7B     CN7B      NN2     5   111.000000   920.480000   0.00000000         0.00\n\
-     ON6     CN7B     NN2B     5   108.000000   920.480000   0.00000000         0.00\n\
-    ON6B     CN7B     NN2B     5   112.000000   920.480000   0.00000000         0.00\n\
-     CN8     CN7B     NN2B     5   113.700000   920.480000   0.00000000         0.00\n\
-    CN7B     CN7B     NN2B     5   111.000000   920.480000   0.00000000         0.00\n\
-     HN7     CN7B      NN2     5   111.000000   359.824000   0.00000000         0.00\n\
-     HN7     CN7B     NN2B     5   111.000000   359.824000   0.00000000         0.00\n\
-     CN9      CN8      HN8     5   110.100000   289.532800   0.21790000     18853.10\n\
-     CN9      CN7      HN7     5   110.100000   289.532800   0.21790000     18853.10\n\
-     HN8      CN8      NN2     5   110.100000   279.742240   0.00000000         0.00\n\
-     HN8      CN8      ON5     5   108.890000   384.091200   0.00000000         0.00\n\
-     CN3      CN9      HN9     5   110.100000   279.742240   0.21790000     18853.10\n\
-    CN3T      CN9      HN9     5   110.100000   279.742240   0.21790000     18853.10\n\
-     CN8      CN9      HN9     5   110.100000   289.532800   0.21790000     18853.10\n\
-     HN9      CN9      CN7     5   110.100000   279.742240   0.21790000     18853.10\n\
-     HN9      CN9      NN2     5   110.100000   279.742240   0.00000000         0.00\n\
-     HN9      CN9     NN2B     5   110.100000   279.742240   0.00000000         0.00\n\
-     HN8      CN8     NN2B     5   110.100000   279.742240   0.00000000         0.00\n\
-     HN9      CN9      ON2     5   109.500000   502.080000   0.00000000         0.00\n\
-     CN9      ON2        P     5   120.000000   167.360000   0.23300000     29288.00\n\
-     HN4      ON4        P     5   115.000000   251.040000   0.23500000     33472.00\n\
-     HN4      ON4       P2     5   115.000000   251.040000   0.23500000     33472.00\n\
-     HN5      ON5      CN8     5   106.000000   481.160000   0.00000000         0.00\n\
-     HN5      ON5      CN9     5   106.000000   481.160000   0.00000000         0.00\n\
-     ON2        P      ON2     5   104.300000   669.440000   0.00000000         0.00\n\
-     ON2       P2      ON2     5   104.300000   669.440000   0.00000000         0.00\n\
-     ON2        P      ON4     5   108.000000   402.500800   0.00000000         0.00\n\
-     ON2       P2      ON4     5   108.000000   402.500800   0.00000000         0.00\n\
-     ON3        P      ON4     5   108.230000   827.595200   0.00000000         0.00\n\
-     ON3       P2      ON4     5   108.230000   827.595200   0.00000000         0.00\n\
-     ON4        P      ON4     5   104.000000   827.595200   0.00000000         0.00\n\
-     ON4       P2      ON4     5   104.000000   827.595200   0.00000000         0.00\n\
-     CN7      CN8      ON5     5   110.100000   633.457600   0.00000000         0.00\n\
-     HN9      CN9      HN9     5   108.400000   297.064000   0.18020000      4518.72\n\
-     CN7      ON6     CN7B     5   108.000000   920.480000   0.00000000         0.00\n\
-     ON6     CN7B      CN8     5   102.000000   753.120000   0.00000000         0.00\n\
-    CN7B      CN8      CN7     5   100.000000   669.440000   0.00000000         0.00\n\
-     CN8      CN7      CN7     5   102.000000   502.080000   0.25610000      6694.40\n\
-     CN9      CN7      CN7     5   102.000000   502.080000   0.25610000      6694.40\n\
-     CN7      CN7      ON6     5   104.000000   836.800000   0.00000000         0.00\n\
-     HN7      CN7      ON6     5   107.240000   378.233600   0.00000000         0.00\n\
-     HN7     CN7B      ON6     5   107.240000   378.233600   0.00000000         0.00\n\
-     HN7      CN7      CN7     5   108.000000   334.720000   0.00000000         0.00\n\
-    CN7B      CN8      HN8     5   110.100000   279.491200   0.21790000     18853.10\n\
-     CN8     CN7B      HN7     5   110.100000   279.491200   0.21790000     18853.10\n\
-     HN7      CN7      CN8     5   110.100000   288.696000   0.21790000     18853.10\n\
-     HN8      CN8      CN7     5   110.100000   288.947040   0.21790000     18853.10\n\
-     HN8      CN8      CN8     5   110.100000   288.947040   0.21790000     18853.10\n\
-     HN8      CN8      HN8     5   109.000000   297.064000   0.18020000      4518.72\n\
-     HN7      CN7      HN7     5   109.000000   297.064000   0.18020000      4518.72\n\
-     CN7     ON6B     CN7B     5   115.000000   920.480000   0.00000000         0.00\n\
-     CN7      CN7     ON6B     5   110.000000   836.800000   0.00000000         0.00\n\
-    ON6B     CN7B     CN7B     5   106.000000   753.120000   0.00000000         0.00\n\
-    CN7B     CN7B      CN7     5    96.000000   920.480000   0.00000000         0.00\n\
-    CN7B      CN7      CN7     5   100.000000   502.080000   0.25610000      6694.40\n\
-     HN7      CN7     ON6B     5   107.240000   378.233600   0.00000000         0.00\n\
-     HN7     CN7B     ON6B     5   107.240000   378.233600   0.00000000         0.00\n\
-    CN7B     CN7B      HN7     5   110.100000   279.491200   0.21790000     18853.10\n\
-     HN7     CN7B      HN7     5   109.000000   297.064000   0.18020000      4518.72\n\
-     ON6      CN7     CN8B     5   108.200000   753.120000   0.00000000         0.00\n\
-     ON6      CN7      CN9     5   108.200000   753.120000   0.00000000         0.00\n\
-     CN7      CN7     CN8B     5   110.000000   376.560000   0.00000000         0.00\n\
-     CN8      CN7     CN8B     5   113.600000   488.272800   0.25610000      9338.69\n\
-     CN7     CN8B      ON2     5   108.400000   585.760000   0.00000000         0.00\n\
-     CN7      CN7      ON2     5   109.700000   962.320000   0.00000000         0.00\n\
-    CN7B     CN7B      ON2     5   109.700000   962.320000   0.00000000         0.00\n\
-     CN8      CN7      ON2     5   109.700000   962.320000   0.00000000         0.00\n\
-    CN8B      ON2        P     5   120.000000   167.360000   0.23300000     29288.00\n\
-    CN8B      ON2       P2     5   120.000000   167.360000   0.23300000     29288.00\n\
-     CN7      ON2        P     5   120.000000   167.360000   0.23300000     29288.00\n\
-     CN7      ON2       P2     5   120.000000   167.360000   0.23300000     29288.00\n\
-    CN7B      ON2        P     5   120.000000   167.360000   0.23300000     29288.00\n\
-    CN7B      ON2       P2     5   120.000000   167.360000   0.23300000     29288.00\n\
-     HN7      CN7     CN8B     5   110.100000   288.696000   0.21790000     18853.10\n\
-     HN8     CN8B      ON2     5   109.500000   502.080000   0.00000000         0.00\n\
-     HN5      ON5     CN8B     5   106.000000   481.160000   0.00000000         0.00\n\
-     HN8     CN8B      HN8     5   109.000000   297.064000   0.18020000      4518.72\n\
-     HN8     CN8B      CN7     5   110.100000   288.947040   0.21790000     18853.10\n\
-     HN7      CN7      ON2     5   109.500000   502.080000   0.00000000         0.00\n\
-     HN7     CN7B      ON2     5   109.500000   502.080000   0.00000000         0.00\n\
-     CN7     CN8B      ON5     5   110.100000   633.457600   0.00000000         0.00\n\
-    CN8B      CN7      ON5     5   108.200000   753.120000   0.00000000         0.00\n\
-     HN8     CN8B      ON5     5   108.890000   384.091200   0.00000000         0.00\n\
-     ON5      CN7      CN8     5   110.000000   633.457600   0.00000000         0.00\n\
-     ON5      CN7      CN7     5   110.100000   633.457600   0.00000000         0.00\n\
-     HN7      CN7      ON5     5   109.500000   502.080000   0.00000000         0.00\n\
-     HN5      ON5      CN7     5   109.000000   481.160000   0.00000000         0.00\n\
-    ON6B      CN7     CN8B     5   108.200000   753.120000   0.00000000         0.00\n\
-    ON6B      CN7      CN9     5   108.200000   753.120000   0.00000000         0.00\n\
-     ON2      CN7     CN7B     5   110.000000   753.120000   0.00000000         0.00\n\
-     ON5      CN7     CN7B     5   110.000000   753.120000   0.00000000         0.00\n\
-     ON5     CN7B     CN7B     5   108.400000   669.440000   0.00000000         0.00\n\
-     ON5     CN7B      CN7     5   108.000000   753.120000   0.00000000         0.00\n\
-     HN7     CN7B      ON5     5   109.500000   502.080000   0.00000000         0.00\n\
-     HN5      ON5     CN7B     5   109.000000   481.160000   0.00000000         0.00\n\
-     HN7     CN7B      CN7     5   110.100000   288.947040   0.21790000     18853.10\n\
-     HN7      CN7     CN7B     5   110.100000   288.947040   0.21790000     18853.10\n\
-     CN8      ON2        P     5   120.000000   167.360000   0.23300000     29288.00\n\
-     CN8      ON2       P2     5   120.000000   167.360000   0.23300000     29288.00\n\
-     ON2        P      ON3     5   111.600000   827.595200   0.00000000         0.00\n\
-     ON2       P2      ON3     5   111.600000   827.595200   0.00000000         0.00\n\
-     ON3        P      ON3     5   120.000000  1004.160000   0.00000000         0.00\n\
-     ON3       P2      ON3     5   120.000000  1004.160000   0.00000000         0.00\n\
-     HN8      CN8      ON2     5   109.500000   502.080000   0.00000000         0.00\n\
-     ON5        P      ON3     5   111.600000   827.595200   0.00000000         0.00\n\
-     ON6     CN7B      CN7     5   106.250000  1004.160000   0.00000000         0.00\n\
-    CN7B      CN7      CN8     5   113.600000   488.272800   0.25610000      9338.69\n\
-     OBL       CL     CTL3     5   125.000000   585.760000   0.24420000     16736.00\n\
-     OBL       CL     CTL2     5   125.000000   585.760000   0.24420000     16736.00\n\
-     OBL       CL     CTL1     5   125.000000   585.760000   0.24420000     16736.00\n\
-     OSL       CL      OBL     5   125.900000   753.120000   0.22576000    133888.00\n\
-      CL      OSL     CTL1     5   109.600000   334.720000   0.22651000     25104.00\n\
-      CL      OSL     CTL2     5   109.600000   334.720000   0.22651000     25104.00\n\
-      CL      OSL     CTL3     5   109.600000   334.720000   0.22651000     25104.00\n\
-    HAL2     CTL2       CL     5   109.500000   276.144000   0.21630000     25104.00\n\
-    HAL3     CTL3       CL     5   109.500000   276.144000   0.21630000     25104.00\n\
-    CTL2     CTL2       CL     5   108.000000   435.136000   0.00000000         0.00\n\
-    CTL2     CTL1      CCL     5   108.000000   435.136000   0.00000000         0.00\n\
-    CTL3     CTL2       CL     5   108.000000   435.136000   0.00000000         0.00\n\
-     OSL       CL     CTL3     5   109.000000   460.240000   0.23260000     16736.00\n\
-     OSL       CL     CTL2     5   109.000000   460.240000   0.23260000     16736.00\n\
-     OSL       CL     CTL1     5   109.000000   460.240000   0.23260000     16736.00\n\
-     OHL       CL      OBL     5   123.000000   418.400000   0.22620000    175728.00\n\
-     OCL       CL     CTL2     5   118.000000   334.720000   0.23880000     41840.00\n\
-     OCL       CL     CTL3     5   118.000000   334.720000   0.23880000     41840.00\n\
-     OCL       CL      OCL     5   124.000000   836.800000   0.22250000     58576.00\n\
-     OCL      CCL      OCL     5   124.000000   836.800000   0.22250000     58576.00\n\
-     OCL      CCL     CTL1     5   118.000000   334.720000   0.23880000     41840.00\n\
-     OHL       CL     CTL3     5   110.500000   460.240000   0.00000000         0.00\n\
-     OHL       CL     CTL2     5   110.500000   460.240000   0.00000000         0.00\n\
-     HOL      OHL       CL     5   115.000000   460.240000   0.00000000         0.00\n\
-     OSL     CTL1     CTL1     5   110.100000   633.457600   0.00000000         0.00\n\
-     OSL     CTL1     CTL2     5   110.100000   633.457600   0.00000000         0.00\n\
-     OSL     CTL1     CTL3     5   110.100000   633.457600   0.00000000         0.00\n\
-     OSL     CTL2     CTL1     5   110.100000   633.457600   0.00000000         0.00\n\
-     OSL     CTL2     CTL2     5   110.100000   633.457600   0.00000000         0.00\n\
-     OSL     CTL2     CTL3     5   110.100000   633.457600   0.00000000         0.00\n\
-    OSLP     CTL1     CTL1     5   110.100000   633.457600   0.00000000         0.00\n\
-    OSLP     CTL1     CTL2     5   110.100000   633.457600   0.00000000         0.00\n\
-    OSLP     CTL1     CTL3     5   110.100000   633.457600   0.00000000         0.00\n\
-    OSLP     CTL2     CTL1     5   110.100000   633.457600   0.00000000         0.00\n\
-    OSLP     CTL2     CTL2     5   110.100000   633.457600   0.00000000         0.00\n\
-    OSLP     CTL2     CTL3     5   110.100000   633.457600   0.00000000         0.00\n\
-    HAL2     CTL2     HAL2     5   109.000000   297.064000   0.18020000      4518.72\n\
-    HAL3     CTL3     HAL3     5   108.400000   297.064000   0.18020000      4518.72\n\
-    HAL1     CTL1      OSL     5   109.500000   502.080000   0.00000000         0.00\n\
-    HAL2     CTL2      OSL     5   109.500000   502.080000   0.00000000         0.00\n\
-    HAL3     CTL3      OSL     5   109.500000   502.080000   0.00000000         0.00\n\
-    HAL1     CTL1     OSLP     5   109.500000   502.080000   0.00000000         0.00\n\
-    HAL2     CTL2     OSLP     5   109.500000   502.080000   0.00000000         0.00\n\
-    HAL3     CTL3     OSLP     5   109.500000   502.080000   0.00000000         0.00\n\
-    CTL1      OSL       PL     5   120.000000   167.360000   0.23300000     29288.00\n\
-    CTL2      OSL       PL     5   120.000000   167.360000   0.23300000     29288.00\n\
-    CTL3      OSL       PL     5   120.000000   167.360000   0.23300000     29288.00\n\
-    CTL1     OSLP       PL     5   120.000000   167.360000   0.23300000     29288.00\n\
-    CTL2     OSLP       PL     5   120.000000   167.360000   0.23300000     29288.00\n\
-    CTL3     OSLP       PL     5   120.000000   167.360000   0.23300000     29288.00\n\
-     HOL      OHL       PL     5   115.000000   251.040000   0.23000000     33472.00\n\
-     OSL       PL      OSL     5   104.300000   669.440000   0.00000000         0.00\n\
-     OSL       PL      O2L     5   111.600000   827.595200   0.00000000         0.00\n\
-     OSL       PL      OHL     5   108.000000   402.500800   0.00000000         0.00\n\
-    OSLP       PL     OSLP     5   104.300000   669.440000   0.00000000         0.00\n\
-    OSLP       PL      O2L     5   111.600000   827.595200   0.00000000         0.00\n\
-    OSLP       PL      OHL     5   108.000000   402.500800   0.00000000         0.00\n\
-     O2L       PL      O2L     5   120.000000  1004.160000   0.00000000         0.00\n\
-     O2L       PL      OHL     5   108.230000   827.595200   0.00000000         0.00\n\
-     NTL     CTL2       HL     5   109.500000   334.720000   0.21300000     22593.60\n\
-     NTL     CTL5       HL     5   109.500000   334.720000   0.21300000     22593.60\n\
-      HL     CTL2       HL     5   109.500000   200.832000   0.17670000     23430.40\n\
-      HL     CTL5       HL     5   109.500000   200.832000   0.17670000     23430.40\n\
-    CTL2      NTL     CTL2     5   109.500000   502.080000   0.24660000     21756.80\n\
-    CTL5      NTL     CTL2     5   109.500000   502.080000   0.24660000     21756.80\n\
-    CTL5      NTL     CTL5     5   109.500000   502.080000   0.24660000     21756.80\n\
-      HL     CTL2     CTL2     5   110.100000   279.742240   0.21790000     18853.10\n\
-      HL     CTL2     CTL3     5   110.100000   279.742240   0.21790000     18853.10\n\
-    HAL1     CTL1     CTL1     5   110.100000   288.696000   0.21790000     18853.10\n\
-    HAL1     CTL1     CTL2     5   110.100000   288.696000   0.21790000     18853.10\n\
-    HAL1     CTL1     CTL3     5   110.100000   288.696000   0.21790000     18853.10\n\
-    HAL2     CTL2     CTL1     5   110.100000   221.752000   0.21790000     18853.10\n\
-    HAL2     CTL2     CTL2     5   110.100000   221.752000   0.21790000     18853.10\n\
-    HAL2     CTL2     CTL3     5   110.100000   289.532800   0.21790000     18853.10\n\
-    HAL3     CTL3     CTL1     5   110.100000   279.742240   0.21790000     18853.10\n\
-    HAL3     CTL3     CTL2     5   110.100000   289.532800   0.21790000     18853.10\n\
-    HAL3     CTL3     CTL3     5   110.100000   313.800000   0.21790000     18853.10\n\
-     HBL     CTL1      CCL     5   109.500000   418.400000   0.00000000         0.00\n\
-     HBL     CTL1     CTL2     5   111.000000   292.880000   0.00000000         0.00\n\
-     NTL     CTL2     CTL2     5   115.000000   566.513600   0.00000000         0.00\n\
-     NTL     CTL2     CTL3     5   115.000000   566.513600   0.00000000         0.00\n\
-     HCL     NH3L     CTL2     5   109.500000   276.144000   0.20560000      3347.20\n\
-     HCL     NH3L     CTL1     5   109.500000   251.040000   0.20740000     16736.00\n\
-     HCL     NH3L      HCL     5   109.500000   343.088000   0.00000000         0.00\n\
-    NH3L     CTL2     CTL2     5   110.000000   566.513600   0.00000000         0.00\n\
-    NH3L     CTL2     HAL2     5   107.500000   376.560000   0.20836000     29288.00\n\
-    CTL1     CTL1     CTL1     5   111.000000   446.432800   0.25610000      6694.40\n\
-    NH3L     CTL1      CCL     5   110.000000   365.681600   0.00000000         0.00\n\
-    NH3L     CTL1     CTL2     5   110.000000   566.513600   0.00000000         0.00\n\
-    NH3L     CTL1      HBL     5   107.500000   430.952000   0.00000000         0.00\n\
-    CTL1     CTL1     CTL2     5   113.500000   488.272800   0.25610000      9338.69\n\
-    CTL1     CTL1     CTL3     5   108.500000   446.432800   0.25610000      6694.40\n\
-    CTL1     CTL2     CTL1     5   113.500000   488.272800   0.25610000      9338.69\n\
-    CTL1     CTL2     CTL2     5   113.500000   488.272800   0.25610000      9338.69\n\
-    CTL1     CTL2     CTL3     5   113.500000   488.272800   0.25610000      9338.69\n\
-    CTL2     CTL1     CTL2     5   113.500000   488.272800   0.25610000      9338.69\n\
-    CTL2     CTL1     CTL3     5   113.500000   488.272800   0.25610000      9338.69\n\
-    CTL2     CTL2     CTL2     5   113.600000   488.272800   0.25610000      9338.69\n\
-    CTL2     CTL2     CTL3     5   115.000000   485.344000   0.25610000      6694.40\n\
-    CTL3     CTL1     CTL3     5   113.500000   488.272800   0.25610000      9338.69\n\
-     HOL      OHL     CTL1     5   106.000000   481.160000   0.00000000         0.00\n\
-     HOL      OHL     CTL2     5   106.000000   481.160000   0.00000000         0.00\n\
-     HOL      OHL     CTL3     5   106.000000   481.160000   0.00000000         0.00\n\
-     OHL     CTL1     CTL1     5   110.100000   633.457600   0.00000000         0.00\n\
-     OHL     CTL1     CTL2     5   110.100000   633.457600   0.00000000         0.00\n\
-     OHL     CTL2     CTL1     5   110.100000   633.457600   0.00000000         0.00\n\
-     OHL     CTL2     CTL2     5   110.100000   633.457600   0.00000000         0.00\n\
-     OHL     CTL2     CTL3     5   110.100000   633.457600   0.00000000         0.00\n\
-     OHL     CTL1     HAL1     5   108.890000   384.091200   0.00000000         0.00\n\
-     OHL     CTL2     HAL2     5   108.890000   384.091200   0.00000000         0.00\n\
-     OHL     CTL3     HAL3     5   108.890000   384.091200   0.00000000         0.00\n\
-     O2L       SL      O2L     5   109.470000  1087.840000   0.24500000     29288.00\n\
-     O2L       SL      OSL     5    98.000000   711.280000   0.00000000         0.00\n\
-    CTL2      OSL       SL     5   109.000000   125.520000   0.19000000     22593.60\n\
-    CTL3      OSL       SL     5   109.000000   125.520000   0.19000000     22593.60\n\
-    CEL1     CEL1     CTL2     5   123.500000   401.664000   0.00000000         0.00\n\
-    CEL1     CEL1     CTL3     5   123.500000   401.664000   0.00000000         0.00\n\
-    CEL2     CEL1     CTL2     5   126.000000   401.664000   0.00000000         0.00\n\
-    CEL2     CEL1     CTL3     5   125.200000   393.296000   0.00000000         0.00\n\
-    HEL1     CEL1     CEL1     5   119.500000   435.136000   0.00000000         0.00\n\
-    HEL1     CEL1     CEL2     5   118.000000   351.456000   0.00000000         0.00\n\
-    HEL1     CEL1     CTL2     5   116.000000   334.720000   0.00000000         0.00\n\
-    HEL1     CEL1     CTL3     5   117.000000   184.096000   0.00000000         0.00\n\
-    HEL2     CEL2     CEL1     5   120.500000   376.560000   0.00000000         0.00\n\
-    HEL2     CEL2     CEL2     5   120.500000   464.424000   0.00000000         0.00\n\
-    HEL2     CEL2     HEL2     5   119.000000   158.992000   0.00000000         0.00\n\
-    CEL1     CTL2     CTL2     5   112.200000   267.776000   0.00000000         0.00\n\
-    CEL1     CTL2     CTL3     5   112.200000   267.776000   0.00000000         0.00\n\
-    HAL2     CTL2     CEL1     5   111.500000   376.560000   0.00000000         0.00\n\
-    HAL3     CTL3     CEL1     5   111.500000   351.456000   0.00000000         0.00\n\
-    CEL1     CTL2     CEL1     5   114.000000   251.040000   0.00000000         0.00\n\
-   HCA1A    CC31A    CC31A     5   110.100000   288.696000   0.21790000     18853.10\n\
-   HCA1A    CC31A    CC32A     5   110.100000   288.696000   0.21790000     18853.10\n\
-   HCA1A    CC31A    CC33A     5   110.100000   288.696000   0.21790000     18853.10\n\
-   HCA2A    CC32A    CC30A     5   110.100000   221.752000   0.21790000     18853.10\n\
-   HCA2A    CC32A    CC31A     5   110.100000   221.752000   0.21790000     18853.10\n\
-   HCA2A    CC32A    CC32A     5   110.100000   221.752000   0.21790000     18853.10\n\
-   HCA2A    CC32A    CC33A     5   110.100000   289.532800   0.21790000     18853.10\n\
-   HCA3A    CC33A    CC30A     5   110.100000   279.742240   0.21790000     18853.10\n\
-   HCA3A    CC33A    CC31A     5   110.100000   279.742240   0.21790000     18853.10\n\
-   HCA3A    CC33A    CC32A     5   110.100000   289.532800   0.21790000     18853.10\n\
-   HCA3A    CC33A    CC33A     5   110.100000   313.800000   0.21790000     18853.10\n\
-   HCA2A    CC32A    HCA2A     5   109.000000   297.064000   0.18020000      4518.72\n\
-   HCA3A    CC33A    HCA3A     5   108.400000   297.064000   0.18020000      4518.72\n\
-   CC30A    CC32A    CC32A     5   113.500000   488.272800   0.25610000      9338.69\n\
-   CC30A    CC32A    CC33A     5   113.500000   488.272800   0.25610000      9338.69\n\
-   CC31A    CC31A    CC31A     5   111.000000   446.432800   0.25610000      6694.40\n\
-   CC31A    CC31A    CC32A     5   113.500000   488.272800   0.25610000      9338.69\n\
-   CC31A    CC31A    CC33A     5   108.500000   446.432800   0.25610000      6694.40\n\
-   CC31A    CC32A    CC31A     5   113.500000   488.272800   0.25610000      9338.69\n\
-   CC31A    CC32A    CC32A     5   113.500000   488.272800   0.25610000      9338.69\n\
-   CC31A    CC32A    CC33A     5   113.500000   488.272800   0.25610000      9338.69\n\
-   CC32A    CC30A    CC32A     5   113.500000   488.272800   0.25610000      9338.69\n\
-   CC32A    CC31A    CC32A     5   113.500000   488.272800   0.25610000      9338.69\n\
-   CC32A    CC32A    CC32A     5   113.600000   488.272800   0.25610000      9338.69\n\
-   CC32A    CC32A    CC33A     5   115.000000   485.344000   0.25610000      6694.40\n\
-   CC33A    CC30A    CC33A     5   114.000000   446.432800   0.25610000      6694.40\n\
-   CC33A    CC31A    CC32A     5   114.000000   446.432800   0.25610000      6694.40\n\
-   CC33A    CC31A    CC33A     5   114.000000   446.432800   0.25610000      6694.40\n\
-   CC33A    CC32A    CC33A     5   114.000000   446.432800   0.25610000      6694.40\n\
-  CC325A   CC325A   CC325A     5   106.000000   485.344000   0.25610000      9338.69\n\
-  HCA25A   CC325A   CC325A     5   111.400000   292.880000   0.21790000     18853.10\n\
-  HCA25A   CC325A   HCA25A     5   106.800000   322.168000   0.18020000      4518.72\n\
-  HCA25A   CC325B   CC325B     5   111.400000   292.880000   0.21790000     18853.10\n\
-  HCA25A   CC325B   HCA25A     5   106.800000   322.168000   0.18020000      4518.72\n\
-  CC325B   CC325B   CC325B     5   109.500000   485.344000   0.25610000      9338.69\n\
-  OC305A   CC325B   CC325B     5   111.100000   376.560000   0.00000000         0.00\n\
-  CC325B   OC305A   CC325B     5   111.000000   794.960000   0.00000000         0.00\n\
-  HCA25A   CC325B   OC305A     5   107.300000   585.760000   0.00000000         0.00\n\
-   HCA3A    CC33A   CC325B     5   110.100000   289.532800   0.21790000     18853.10\n\
-  CC325B   CC325B    CC33A     5   115.000000   485.344000   0.25610000      6694.40\n\
-  HCA25A   CC325B    CC33A     5   110.100000   289.532800   0.21790000     18853.10\n\
-  OC305A   CC325B    CC33A     5   111.500000   376.560000   0.00000000         0.00\n\
-   CC32A    OC30A    CC32A     5   109.700000   794.960000   0.00000000         0.00\n\
-   CC33A    OC30A    CC32A     5   109.700000   794.960000   0.00000000         0.00\n\
-   CC33A    OC30A    CC33A     5   109.700000   794.960000   0.00000000         0.00\n\
-   OC30A    CC32A    CC32A     5   111.500000   376.560000   0.00000000         0.00\n\
-   OC30A    CC32A    CC33A     5   111.500000   376.560000   0.00000000         0.00\n\
-   HCA3A    CC33A    OC30A     5   109.500000   502.080000   0.00000000         0.00\n\
-   HCA2A    CC32A    OC30A     5   109.500000   502.080000   0.00000000         0.00\n\
-   HCA2A   CC326A   CC326A     5   110.100000   288.696000   0.21790000     18853.10\n\
-   HCA2A   CC326A    HCA2A     5   109.000000   297.064000   0.18020000      4518.72\n\
-  CC326A   CC326A   CC326A     5   112.000000   488.272800   0.25610000      9338.69\n\
-   OC30A   CC326A   CC326A     5   111.500000   376.560000   0.00000000         0.00\n\
-  CC326A    OC30A   CC326A     5   109.700000   794.960000   0.00000000         0.00\n\
-   HCA2A   CC326A    OC30A     5   109.500000   376.560000   0.00000000         0.00\n\
-     OST      CST      OST     5   180.000000 25104.000000   0.00000000         0.00\n\
-      CS       SS       FE     5   100.600000   418.400000   0.00000000         0.00\n\
-      SS       FE      NPH     5    90.000000   836.800000   0.00000000         0.00\n\
-     CPA      CPB      CE1     5   126.740000   585.760000   0.00000000         0.00\n\
-     CPA      CPM      CPA     5   125.120000   788.265600   0.00000000         0.00\n\
-     CPA      NPH      CPA     5   103.900000  1165.662400   0.00000000         0.00\n\
-     CPB      CE1      CE2     5   121.500000   585.760000   0.00000000         0.00\n\
-     CPB      CPB      CE1     5   126.750000   585.760000   0.00000000         0.00\n\
-     CPB      CPB      CPA     5   106.510000   257.734400   0.00000000         0.00\n\
-     CPM      CPA      CPB     5   124.070000   515.468800   0.00000000         0.00\n\
-     CT2      CPB      CPA     5   126.740000   543.920000   0.00000000         0.00\n\
-     CT2      CPB      CPB     5   126.750000   543.920000   0.00000000         0.00\n\
-     CT2      CT2      CPB     5   113.000000   585.760000   0.00000000         0.00\n\
-     CT3      CPB      CPA     5   126.740000   543.920000   0.00000000         0.00\n\
-     CT3      CPB      CPB     5   126.750000   543.920000   0.00000000         0.00\n\
-      FE      NPH      CPA     5   128.050000   804.583200   0.00000000         0.00\n\
-      FE      NR2     CPH1     5   133.000000   251.040000   0.00000000         0.00\n\
-      FE      NR2     CPH2     5   123.000000   251.040000   0.00000000         0.00\n\
-      HA      CPM      CPA     5   117.440000   106.273600   0.00000000         0.00\n\
-      HA      CPM       FE     5   180.000000     0.000000   0.00000000         0.00\n\
-     HA2      CT2      CPB     5   109.500000   418.400000   0.00000000         0.00\n\
-     HA3      CT3      CPB     5   109.500000   418.400000   0.00000000         0.00\n\
-     HE1      CE1      CPB     5   120.000000   418.400000   0.00000000         0.00\n\
-     NPH      CPA      CPB     5   111.540000  1020.896000   0.00000000         0.00\n\
-     NPH      CPA      CPM     5   124.390000   736.384000   0.00000000         0.00\n\
-     NPH       FE       CM     5    90.000000   418.400000   0.00000000         0.00\n\
-     NPH       FE      CPM     5    45.000000     0.000000   0.00000000         0.00\n\
-     NPH       FE      NPH     5    90.000000   120.415520   0.00000000         0.00\n\
-     NR2       FE       CM     5   180.000000   418.400000   0.00000000         0.00\n\
-     NR2       FE      NPH     5    90.000000   418.400000   0.00000000         0.00\n\
-      OM       CM       FE     5   180.000000   292.880000   0.00000000         0.00\n\
-      OM       FE      NPH     5    90.000000    41.840000   0.00000000         0.00\n\
-      OM       OM       FE     5   180.000000     0.000000   0.00000000         0.00\n\
-    CTL1     CTL2     CEL1     5   112.200000   267.776000   0.00000000         0.00\n\
-    CTL1     CEL1     CTL2     5   113.000000   418.400000   0.00000000         0.00\n\
-    CEL1     CEL1     CTL1     5   123.500000   401.664000   0.00000000         0.00\n\
-    CTL1     CTL1     CEL1     5   112.200000   267.776000   0.00000000         0.00\n\
-    CTL3     CTL1     CEL1     5   112.200000   267.776000   0.00000000         0.00\n\
-    CTL2     CTL1     CEL1     5   112.200000   267.776000   0.00000000         0.00\n\
-     OHL     CTL1     CTL3     5   110.100000   633.457600   0.00000000         0.00\n\
-     HOL      OHL     CRL1     5   106.000000   481.160000   0.00000000         0.00\n\
-     OHL     CRL1     CRL2     5   110.100000   633.457600   0.00000000         0.00\n\
-     OHL     CRL1     HGA1     5   108.890000   384.091200   0.00000000         0.00\n\
-    HAL3     CTL3     CRL1     5   110.100000   279.742240   0.21790000     18853.10\n\
-    CRL1     CRL1     CTL3     5   108.500000   446.432800   0.25610000      6694.40\n\
-    CRL2     CRL1     CTL3     5   113.500000   488.272800   0.25610000      9338.69\n\
-    HEL1     CEL1     CRL2     5   116.000000   334.720000   0.00000000         0.00\n\
-    HGA2     CRL2     CEL1     5   111.500000   376.560000   0.00000000         0.00\n\
-    HAL2     CRL2     CEL1     5   111.500000   376.560000   0.00000000         0.00\n\
-    HGA2     CTL2     CEL1     5   111.500000   376.560000   0.00000000         0.00\n\
-    CRL1     CRL2     CEL1     5   112.200000   267.776000   0.00000000         0.00\n\
-    CEL1     CEL1     CRL2     5   123.500000   401.664000   0.00000000         0.00\n\
-    CEL1     CEL1     CRL1     5   123.500000   401.664000   0.00000000         0.00\n\
-    CRL1     CRL1     CEL1     5   112.200000   267.776000   0.00000000         0.00\n\
-    CTL1     CRL1     CEL1     5   112.200000   267.776000   0.00000000         0.00\n\
-    CRL1     CTL1     CEL1     5   112.200000   267.776000   0.00000000         0.00\n\
-    CTL3     CRL1     CEL1     5   112.200000   267.776000   0.00000000         0.00\n\
-    CRL2     CRL1     CEL1     5   112.200000   267.776000   0.00000000         0.00\n\
-    CTL2     CRL1     CEL1     5   112.200000   267.776000   0.00000000         0.00\n\
-    CRL2     CTL1     CEL1     5   112.200000   267.776000   0.00000000         0.00\n\
-    CRL2     CRL1     CTL2     5   113.500000   488.272800   0.25610000      9338.69\n\
-    CRL2     CRL1     CRL2     5   113.500000   488.272800   0.25610000      9338.69\n\
-    HGA1     CRL1     CTL2     5   110.100000   288.696000   0.21790000     18853.10\n\
-    HGA1     CRL1     CRL2     5   110.100000   288.696000   0.21790000     18853.10\n\
-    CRL1     CRL1     CTL2     5   113.500000   488.272800   0.25610000      9338.69\n\
-    CRL1     CRL1     CRL2     5   113.500000   488.272800   0.25610000      9338.69\n\
-    CRL1     CTL2     CTL3     5   113.500000   488.272800   0.25610000      9338.69\n\
-    HAL2     CTL2     CRL1     5   110.100000   221.752000   0.21790000     18853.10\n\
-    HGA2     CRL2     CRL1     5   110.100000   221.752000   0.21790000     18853.10\n\
-    CRL1     CTL2     CTL2     5   113.500000   488.272800   0.25610000      9338.69\n\
-    CRL1     CRL2     CRL2     5   113.500000   488.272800   0.25610000      9338.69\n\
-    CRL1     CEL1     CRL2     5   113.000000   418.400000   0.00000000         0.00\n\
-    CRL1     CRL1     CRL1     5   111.000000   446.432800   0.25610000      6694.40\n\
-    CTL1     CRL1     CRL2     5   113.500000   488.272800   0.25610000      9338.69\n\
-    HGA1     CRL1     CTL1     5   110.100000   288.696000   0.21790000     18853.10\n\
-    HGA1     CRL1     CRL1     5   110.100000   288.696000   0.21790000     18853.10\n\
-    CTL1     CRL1     CRL1     5   111.000000   446.432800   0.25610000      6694.40\n\
-    HAL1     CTL1     CRL1     5   110.100000   288.696000   0.21790000     18853.10\n\
-    CRL1     CTL1     CTL3     5   108.500000   446.432800   0.25610000      6694.40\n\
-    CRL1     CTL1     CTL2     5   113.500000   488.272800   0.25610000      9338.69\n\
-    CEL2     CEL1     CRL2     5   126.000000   401.664000   0.00000000         0.00\n\
-    CEL1     CRL2     CRL2     5   112.200000   267.776000   0.00000000         0.00\n\
-    CEL1     CTL2     CRL2     5   112.200000   267.776000   0.00000000         0.00\n\
-    CEL1     CRL2     CTL2     5   112.200000   267.776000   0.00000000         0.00\n\
-    CEL1     CRL2     CTL3     5   112.200000   267.776000   0.00000000         0.00\n\
-    CEL1     CRL2     CEL1     5   114.000000   251.040000   0.00000000         0.00\n\
-    CTL1     CRL2     CEL1     5   112.200000   267.776000   0.00000000         0.00\n\
-    CRL1     CTL2     CEL1     5   112.200000   267.776000   0.00000000         0.00\n\
-    CTL1     CEL1     CRL2     5   113.000000   418.400000   0.00000000         0.00\n\
-    CRL1     CEL1     CTL2     5   113.000000   418.400000   0.00000000         0.00\n\
-    HGA2     CRL2     HGA2     5   109.000000   297.064000   0.18020000      4518.72\n\
-    HGA2     CRL2     CRL2     5   110.100000   221.752000   0.21790000     18853.10\n\
-    HGA1     CRL1     CTL3     5   110.100000   288.696000   0.21790000     18853.10\n\
-    CRL2     CRL2     CRL2     5   113.600000   488.272800   0.25610000      9338.69\n" ;
-
-} // End namespace charmm_constants
-
-#endif
@@ -0,0 +1,2747 @@
+// angle_bend_parameters.h --- Typed table of the parameters in angle_bend.itp
+// Generated by generate_parameter_tables.cmake from angle_bend.itp. Do not edit.
+// Copyright (C) 2026 agent
+// Copyright (c) 1991-2000, University of Groningen, The Netherlands.
+// Copyright (c) 2001-2004, The GROMACS development team,
+//
+// This file is part of Phaistos
+//
+// Phaistos is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Phaistos is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Phaistos.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+#ifndef TERM_CHARMM_ANGLE_BEND_PARAMETERS_H
+#define TERM_CHARMM_ANGLE_BEND_PARAMETERS_H
+
+#include "atom_types.h"
+
+namespace charmm_parameters {
+
+//! Angle-bend and Urey-Bradley parameters (from angle_bend.itp)
+struct AngleBendRecord {
+     AtomTypeId type1;
+     AtomTypeId type2;
+     AtomTypeId type3;
+     double theta0;
+     double k0;
+     double r13;
+     double kub;
+};
+
+//! Number of entries in angle_bend_parameters
+const unsigned int N_ANGLE_BEND_PARAMETERS = 2697;
+
+//! Angle-bend and Urey-Bradley parameters (from angle_bend.itp)
+const AngleBendRecord angle_bend_parameters[N_ANGLE_BEND_PARAMETERS] = {
+     {ATOM_TYPE_H, ATOM_TYPE_NH2, ATOM_TYPE_CT1, 111.000000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_NH2, ATOM_TYPE_CT1, ATOM_TYPE_CT1, 110.000000, 566.513600, 0.00000000, 0.00},
+     {ATOM_TYPE_NH2, ATOM_TYPE_CT1, ATOM_TYPE_CT2, 110.000000, 566.513600, 0.00000000, 0.00},
+     {ATOM_TYPE_NH2, ATOM_TYPE_CT1, ATOM_TYPE_CT3, 110.000000, 566.513600, 0.00000000, 0.00},
+     {ATOM_TYPE_CT1, ATOM_TYPE_CD, ATOM_TYPE_OH1, 110.500000, 460.240000, 0.00000000, 0.00},
+     {ATOM_TYPE_CT3, ATOM_TYPE_CT1, ATOM_TYPE_CD, 108.000000, 435.136000, 0.00000000, 0.00},
+     {ATOM_TYPE_NH2, ATOM_TYPE_CT1, ATOM_TYPE_HB1, 109.500000, 317.984000, 0.21400000, 41840.00},
+     {ATOM_TYPE_NH2, ATOM_TYPE_CT1, ATOM_TYPE_C, 107.000000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_CAI, ATOM_TYPE_CAI, ATOM_TYPE_CA, 120.000000, 334.720000, 0.24162000, 29288.00},
+     {ATOM_TYPE_CAI, ATOM_TYPE_CA, ATOM_TYPE_CA, 120.000000, 334.720000, 0.24162000, 29288.00},
+     {ATOM_TYPE_CPT, ATOM_TYPE_CA, ATOM_TYPE_CA, 113.200000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_CPT, ATOM_TYPE_CPT, ATOM_TYPE_CA, 110.000000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_CPT, ATOM_TYPE_CAI, ATOM_TYPE_CA, 113.200000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_CPT, ATOM_TYPE_CPT, ATOM_TYPE_CAI, 110.000000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_CPT, ATOM_TYPE_CY, ATOM_TYPE_CA, 106.400000, 711.280000, 0.22610000, 20920.00},
+     {ATOM_TYPE_CPT, ATOM_TYPE_NY, ATOM_TYPE_CA, 112.000000, 711.280000, 0.00000000, 0.00},
+     {ATOM_TYPE_CT2, ATOM_TYPE_CY, ATOM_TYPE_CA, 127.000000, 251.040000, 0.00000000, 0.00},
+     {ATOM_TYPE_CT2, ATOM_TYPE_CY, ATOM_TYPE_CPT, 126.700000, 251.040000, 0.00000000, 0.00},
+     {ATOM_TYPE_CT3, ATOM_TYPE_CY, ATOM_TYPE_CA, 127.000000, 251.040000, 0.00000000, 0.00},
+     {ATOM_TYPE_CT3, ATOM_TYPE_CY, ATOM_TYPE_CPT, 126.700000, 251.040000, 0.00000000, 0.00},
+     {ATOM_TYPE_CY, ATOM_TYPE_CPT, ATOM_TYPE_CA, 133.500000, 1087.840000, 0.00000000, 0.00},
+     {ATOM_TYPE_CY, ATOM_TYPE_CPT, ATOM_TYPE_CAI, 133.500000, 1087.840000, 0.00000000, 0.00},
+     {ATOM_TYPE_CY, ATOM_TYPE_CPT, ATOM_TYPE_CPT, 108.000000, 711.280000, 0.00000000, 0.00},
+     {ATOM_TYPE_CY, ATOM_TYPE_CT2, ATOM_TYPE_CT1, 114.000000, 488.272800, 0.00000000, 0.00},
+     {ATOM_TYPE_CY, ATOM_TYPE_CT2, ATOM_TYPE_CT3, 114.000000, 488.272800, 0.00000000, 0.00},
+     {ATOM_TYPE_H, ATOM_TYPE_NY, ATOM_TYPE_CA, 126.000000, 234.304000, 0.00000000, 0.00},
+     {ATOM_TYPE_H, ATOM_TYPE_NY, ATOM_TYPE_CAI, 126.000000, 234.304000, 0.00000000, 0.00},
+     {ATOM_TYPE_H, ATOM_TYPE_NY, ATOM_TYPE_CPT, 126.000000, 234.304000, 0.00000000, 0.00},
+     {ATOM_TYPE_HA2, ATOM_TYPE_CT2, ATOM_TYPE_CY, 109.500000, 460.240000, 0.00000000, 0.00},
+     {ATOM_TYPE_HA3, ATOM_TYPE_CT3, ATOM_TYPE_CY, 109.500000, 460.240000, 0.00000000, 0.00},
+     {ATOM_TYPE_HP, ATOM_TYPE_CA, ATOM_TYPE_CAI, 120.000000, 251.040000, 0.21525000, 18409.60},
+     {ATOM_TYPE_HP, ATOM_TYPE_CAI, ATOM_TYPE_CA, 120.000000, 251.040000, 0.21525000, 18409.60},
+     {ATOM_TYPE_HP, ATOM_TYPE_CA, ATOM_TYPE_CPT, 122.000000, 251.040000, 0.21460000, 18409.60},
+     {ATOM_TYPE_HP, ATOM_TYPE_CAI, ATOM_TYPE_CPT, 122.000000, 251.040000, 0.21460000, 18409.60},
+     {ATOM_TYPE_HP, ATOM_TYPE_CA, ATOM_TYPE_CY, 125.000000, 267.776000, 0.21730000, 20920.00},
+     {ATOM_TYPE_HP, ATOM_TYPE_CY, ATOM_TYPE_CA, 126.400000, 267.776000, 0.21860000, 20920.00},
+     {ATOM_TYPE_HP, ATOM_TYPE_CY, ATOM_TYPE_CPT, 126.400000, 267.776000, 0.22550000, 20920.00},
+     {ATOM_TYPE_NY, ATOM_TYPE_CA, ATOM_TYPE_CY, 110.500000, 711.280000, 0.22400000, 20920.00},
+     {ATOM_TYPE_NY, ATOM_TYPE_CA, ATOM_TYPE_HP, 125.000000, 267.776000, 0.21770000, 20920.00},
+     {ATOM_TYPE_NY, ATOM_TYPE_CPT, ATOM_TYPE_CA, 129.500000, 1087.840000, 0.00000000, 0.00},
+     {ATOM_TYPE_NY, ATOM_TYPE_CPT, ATOM_TYPE_CAI, 129.500000, 1087.840000, 0.00000000, 0.00},
+     {ATOM_TYPE_NY, ATOM_TYPE_CPT, ATOM_TYPE_CPT, 107.400000, 794.960000, 0.00000000, 0.00},
+     {ATOM_TYPE_CA, ATOM_TYPE_CA, ATOM_TYPE_CA, 120.000000, 334.720000, 0.24162000, 29288.00},
+     {ATOM_TYPE_CE1, ATOM_TYPE_CE1, ATOM_TYPE_CT2, 123.500000, 401.664000, 0.00000000, 0.00},
+     {ATOM_TYPE_CE1, ATOM_TYPE_CE1, ATOM_TYPE_CT3, 123.500000, 401.664000, 0.00000000, 0.00},
+     {ATOM_TYPE_CE1, ATOM_TYPE_CT2, ATOM_TYPE_CT3, 112.200000, 267.776000, 0.00000000, 0.00},
+     {ATOM_TYPE_CE2, ATOM_TYPE_CE1, ATOM_TYPE_CT2, 126.000000, 401.664000, 0.00000000, 0.00},
+     {ATOM_TYPE_CE2, ATOM_TYPE_CE1, ATOM_TYPE_CT3, 125.200000, 393.296000, 0.00000000, 0.00},
+     {ATOM_TYPE_CP1, ATOM_TYPE_N, ATOM_TYPE_C, 117.000000, 502.080000, 0.00000000, 0.00},
+     {ATOM_TYPE_CP2, ATOM_TYPE_CP1, ATOM_TYPE_C, 112.300000, 435.136000, 0.00000000, 0.00},
+     {ATOM_TYPE_CP2, ATOM_TYPE_CP1, ATOM_TYPE_CC, 112.300000, 435.136000, 0.00000000, 0.00},
+     {ATOM_TYPE_CP2, ATOM_TYPE_CP1, ATOM_TYPE_CD, 112.300000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_CP2, ATOM_TYPE_CP2, ATOM_TYPE_CP1, 108.500000, 585.760000, 0.00000000, 0.00},
+     {ATOM_TYPE_CP3, ATOM_TYPE_CP2, ATOM_TYPE_CP2, 108.500000, 585.760000, 0.00000000, 0.00},
+     {ATOM_TYPE_CP3, ATOM_TYPE_N, ATOM_TYPE_C, 117.000000, 502.080000, 0.00000000, 0.00},
+     {ATOM_TYPE_CP3, ATOM_TYPE_N, ATOM_TYPE_CP1, 114.200000, 836.800000, 0.00000000, 0.00},
+     {ATOM_TYPE_CP3, ATOM_TYPE_NP, ATOM_TYPE_CP1, 111.000000, 836.800000, 0.00000000, 0.00},
+     {ATOM_TYPE_CPH2, ATOM_TYPE_NR1, ATOM_TYPE_CPH1, 107.500000, 1087.840000, 0.00000000, 0.00},
+     {ATOM_TYPE_CPH2, ATOM_TYPE_NR2, ATOM_TYPE_CPH1, 104.000000, 1087.840000, 0.00000000, 0.00},
+     {ATOM_TYPE_CPH2, ATOM_TYPE_NR3, ATOM_TYPE_CPH1, 108.000000, 1213.360000, 0.00000000, 0.00},
+     {ATOM_TYPE_CT1, ATOM_TYPE_CT1, ATOM_TYPE_C, 108.000000, 435.136000, 0.00000000, 0.00},
+     {ATOM_TYPE_CT1, ATOM_TYPE_CT1, ATOM_TYPE_CC, 108.000000, 435.136000, 0.00000000, 0.00},
+     {ATOM_TYPE_CT1, ATOM_TYPE_CT1, ATOM_TYPE_CD, 108.000000, 435.136000, 0.00000000, 0.00},
+     {ATOM_TYPE_CT1, ATOM_TYPE_CT1, ATOM_TYPE_CT1, 111.000000, 446.432800, 0.25610000, 6694.40},
+     {ATOM_TYPE_CT1, ATOM_TYPE_CT2, ATOM_TYPE_CA, 107.500000, 433.462400, 0.00000000, 0.00},
+     {ATOM_TYPE_CT1, ATOM_TYPE_CT2, ATOM_TYPE_CC, 108.000000, 435.136000, 0.00000000, 0.00},
+     {ATOM_TYPE_CT1, ATOM_TYPE_CT2, ATOM_TYPE_CD, 108.000000, 435.136000, 0.00000000, 0.00},
+     {ATOM_TYPE_CT1, ATOM_TYPE_CT2, ATOM_TYPE_CPH1, 113.000000, 488.272800, 0.00000000, 0.00},
+     {ATOM_TYPE_CT1, ATOM_TYPE_CT2, ATOM_TYPE_CT1, 113.500000, 488.272800, 0.25610000, 9338.69},
+     {ATOM_TYPE_CT1, ATOM_TYPE_NH1, ATOM_TYPE_C, 120.000000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_CT2, ATOM_TYPE_CA, ATOM_TYPE_CA, 122.300000, 383.254400, 0.00000000, 0.00},
+     {ATOM_TYPE_CT2, ATOM_TYPE_CPH1, ATOM_TYPE_CPH1, 130.000000, 383.254400, 0.00000000, 0.00},
+     {ATOM_TYPE_CT2, ATOM_TYPE_CT1, ATOM_TYPE_C, 108.000000, 435.136000, 0.00000000, 0.00},
+     {ATOM_TYPE_CT2, ATOM_TYPE_CT1, ATOM_TYPE_CC, 108.000000, 435.136000, 0.00000000, 0.00},
+     {ATOM_TYPE_CT2A, ATOM_TYPE_CT1, ATOM_TYPE_CC, 108.000000, 435.136000, 0.00000000, 0.00},
+     {ATOM_TYPE_CT2, ATOM_TYPE_CT1, ATOM_TYPE_CD, 108.000000, 435.136000, 0.00000000, 0.00},
+     {ATOM_TYPE_CT2, ATOM_TYPE_CT1, ATOM_TYPE_CT1, 111.000000, 446.432800, 0.25610000, 6694.40},
+     {ATOM_TYPE_CT2, ATOM_TYPE_CT2, ATOM_TYPE_C, 108.000000, 435.136000, 0.00000000, 0.00},
+     {ATOM_TYPE_CT2, ATOM_TYPE_CT2, ATOM_TYPE_CC, 108.000000, 435.136000, 0.00000000, 0.00},
+     {ATOM_TYPE_CT3, ATOM_TYPE_CT2, ATOM_TYPE_CC, 108.000000, 435.136000, 0.00000000, 0.00},
+     {ATOM_TYPE_CT2, ATOM_TYPE_CT2, ATOM_TYPE_CD, 108.000000, 435.136000, 0.00000000, 0.00},
+     {ATOM_TYPE_CT2A, ATOM_TYPE_CT2, ATOM_TYPE_CD, 108.000000, 435.136000, 0.00000000, 0.00},
+     {ATOM_TYPE_CT2, ATOM_TYPE_CT2, ATOM_TYPE_CT1, 113.500000, 488.272800, 0.25610000, 9338.69},
+     {ATOM_TYPE_CT2, ATOM_TYPE_CT2, ATOM_TYPE_CT2, 113.600000, 488.272800, 0.25610000, 9338.69},
+     {ATOM_TYPE_CT2, ATOM_TYPE_CT3, ATOM_TYPE_CT1, 113.500000, 488.272800, 0.25610000, 9338.69},
+     {ATOM_TYPE_CT2, ATOM_TYPE_NC2, ATOM_TYPE_C, 120.000000, 521.326400, 0.00000000, 0.00},
+     {ATOM_TYPE_CT2, ATOM_TYPE_NH1, ATOM_TYPE_C, 120.000000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_CT2, ATOM_TYPE_OS, ATOM_TYPE_CD, 109.600000, 334.720000, 0.22651000, 25104.00},
+     {ATOM_TYPE_CT3, ATOM_TYPE_CA, ATOM_TYPE_CA, 122.300000, 383.254400, 0.00000000, 0.00},
+     {ATOM_TYPE_CT3, ATOM_TYPE_CPH1, ATOM_TYPE_CPH1, 130.000000, 383.254400, 0.00000000, 0.00},
+     {ATOM_TYPE_CT3, ATOM_TYPE_CT1, ATOM_TYPE_C, 108.000000, 435.136000, 0.00000000, 0.00},
+     {ATOM_TYPE_CT3, ATOM_TYPE_CT1, ATOM_TYPE_CC, 108.000000, 435.136000, 0.00000000, 0.00},
+     {ATOM_TYPE_CT3, ATOM_TYPE_CT1, ATOM_TYPE_CT1, 108.500000, 446.432800, 0.25610000, 6694.40},
+     {ATOM_TYPE_CT3, ATOM_TYPE_CT1, ATOM_TYPE_CT2, 114.000000, 446.432800, 0.25610000, 6694.40},
+     {ATOM_TYPE_CT3, ATOM_TYPE_CT1, ATOM_TYPE_CT3, 114.000000, 446.432800, 0.25610000, 6694.40},
+     {ATOM_TYPE_CT3, ATOM_TYPE_CT2, ATOM_TYPE_CA, 107.500000, 433.462400, 0.00000000, 0.00},
+     {ATOM_TYPE_CT3, ATOM_TYPE_CT2, ATOM_TYPE_CPH1, 113.000000, 488.272800, 0.00000000, 0.00},
+     {ATOM_TYPE_CT3, ATOM_TYPE_CT2, ATOM_TYPE_CT1, 113.500000, 488.272800, 0.25610000, 9338.69},
+     {ATOM_TYPE_CT3, ATOM_TYPE_CT2, ATOM_TYPE_CT2, 115.000000, 485.344000, 0.25610000, 6694.40},
+     {ATOM_TYPE_CT3, ATOM_TYPE_CT2, ATOM_TYPE_CT3, 114.000000, 446.432800, 0.25610000, 6694.40},
+     {ATOM_TYPE_CT3, ATOM_TYPE_NC2, ATOM_TYPE_C, 120.000000, 521.326400, 0.00000000, 0.00},
+     {ATOM_TYPE_CT3, ATOM_TYPE_NH1, ATOM_TYPE_C, 120.000000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_CT3, ATOM_TYPE_OS, ATOM_TYPE_CD, 109.600000, 334.720000, 0.22651000, 25104.00},
+     {ATOM_TYPE_CT3, ATOM_TYPE_S, ATOM_TYPE_CT2, 95.000000, 284.512000, 0.00000000, 0.00},
+     {ATOM_TYPE_H, ATOM_TYPE_NH1, ATOM_TYPE_C, 123.000000, 284.512000, 0.00000000, 0.00},
+     {ATOM_TYPE_H, ATOM_TYPE_NH1, ATOM_TYPE_CT1, 117.000000, 292.880000, 0.00000000, 0.00},
+     {ATOM_TYPE_H, ATOM_TYPE_NH1, ATOM_TYPE_CT2, 117.000000, 292.880000, 0.00000000, 0.00},
+     {ATOM_TYPE_H, ATOM_TYPE_NH1, ATOM_TYPE_CT3, 117.000000, 292.880000, 0.00000000, 0.00},
+     {ATOM_TYPE_H, ATOM_TYPE_NH2, ATOM_TYPE_CC, 120.000000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_H, ATOM_TYPE_NH2, ATOM_TYPE_H, 120.000000, 192.464000, 0.00000000, 0.00},
+     {ATOM_TYPE_H, ATOM_TYPE_NR1, ATOM_TYPE_CPH1, 125.500000, 251.040000, 0.21500000, 16736.00},
+     {ATOM_TYPE_H, ATOM_TYPE_NR1, ATOM_TYPE_CPH2, 127.000000, 251.040000, 0.21400000, 16736.00},
+     {ATOM_TYPE_H, ATOM_TYPE_NR3, ATOM_TYPE_CPH1, 126.000000, 209.200000, 0.21300000, 12552.00},
+     {ATOM_TYPE_H, ATOM_TYPE_NR3, ATOM_TYPE_CPH2, 126.000000, 209.200000, 0.20900000, 12552.00},
+     {ATOM_TYPE_H, ATOM_TYPE_OH1, ATOM_TYPE_CA, 108.000000, 543.920000, 0.00000000, 0.00},
+     {ATOM_TYPE_H, ATOM_TYPE_OH1, ATOM_TYPE_CD, 115.000000, 460.240000, 0.00000000, 0.00},
+     {ATOM_TYPE_H, ATOM_TYPE_OH1, ATOM_TYPE_CT1, 106.000000, 481.160000, 0.00000000, 0.00},
+     {ATOM_TYPE_H, ATOM_TYPE_OH1, ATOM_TYPE_CT2, 106.000000, 481.160000, 0.00000000, 0.00},
+     {ATOM_TYPE_H, ATOM_TYPE_OH1, ATOM_TYPE_CT3, 106.000000, 481.160000, 0.00000000, 0.00},
+     {ATOM_TYPE_HA2, ATOM_TYPE_CP2, ATOM_TYPE_CP1, 110.100000, 279.742240, 0.21790000, 18853.10},
+     {ATOM_TYPE_HA2, ATOM_TYPE_CP2, ATOM_TYPE_CP2, 110.100000, 221.752000, 0.21790000, 18853.10},
+     {ATOM_TYPE_HA2, ATOM_TYPE_CP2, ATOM_TYPE_CP3, 110.100000, 221.752000, 0.21790000, 18853.10},
+     {ATOM_TYPE_HA2, ATOM_TYPE_CP2, ATOM_TYPE_HA2, 109.000000, 297.064000, 0.18020000, 4518.72},
+     {ATOM_TYPE_HA2, ATOM_TYPE_CP3, ATOM_TYPE_CP2, 110.100000, 221.752000, 0.21790000, 18853.10},
+     {ATOM_TYPE_HA2, ATOM_TYPE_CP3, ATOM_TYPE_HA2, 109.000000, 297.064000, 0.18020000, 4518.72},
+     {ATOM_TYPE_HA2, ATOM_TYPE_CS, ATOM_TYPE_CT3, 110.100000, 289.532800, 0.21790000, 18853.10},
+     {ATOM_TYPE_HA2, ATOM_TYPE_CS, ATOM_TYPE_HA2, 108.400000, 297.064000, 0.17750000, 11715.20},
+     {ATOM_TYPE_HA3, ATOM_TYPE_CS, ATOM_TYPE_HA3, 108.400000, 297.064000, 0.17750000, 11715.20},
+     {ATOM_TYPE_HA1, ATOM_TYPE_CT1, ATOM_TYPE_C, 109.500000, 276.144000, 0.21630000, 25104.00},
+     {ATOM_TYPE_HA1, ATOM_TYPE_CT1, ATOM_TYPE_CD, 109.500000, 276.144000, 0.21630000, 25104.00},
+     {ATOM_TYPE_HA1, ATOM_TYPE_CT1, ATOM_TYPE_CT1, 110.100000, 288.696000, 0.21790000, 18853.10},
+     {ATOM_TYPE_HA1, ATOM_TYPE_CT1, ATOM_TYPE_CT2, 110.100000, 288.696000, 0.21790000, 18853.10},
+     {ATOM_TYPE_HA1, ATOM_TYPE_CT1, ATOM_TYPE_CT3, 110.100000, 288.696000, 0.21790000, 18853.10},
+     {ATOM_TYPE_HA1, ATOM_TYPE_CT1, ATOM_TYPE_HA1, 109.000000, 297.064000, 0.18020000, 4518.72},
+     {ATOM_TYPE_HA2, ATOM_TYPE_CT2, ATOM_TYPE_C, 109.500000, 276.144000, 0.21630000, 25104.00},
+     {ATOM_TYPE_HA2, ATOM_TYPE_CT2, ATOM_TYPE_CA, 107.500000, 412.542400, 0.00000000, 0.00},
+     {ATOM_TYPE_HA2, ATOM_TYPE_CT2, ATOM_TYPE_CC, 109.500000, 276.144000, 0.21630000, 25104.00},
+     {ATOM_TYPE_HA2, ATOM_TYPE_CT2, ATOM_TYPE_CD, 109.500000, 276.144000, 0.21630000, 25104.00},
+     {ATOM_TYPE_HA2, ATOM_TYPE_CT2, ATOM_TYPE_CE1, 111.500000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_HA2, ATOM_TYPE_CT2, ATOM_TYPE_CPH1, 109.500000, 279.742240, 0.00000000, 0.00},
+     {ATOM_TYPE_HA2, ATOM_TYPE_CT2, ATOM_TYPE_CT1, 110.100000, 221.752000, 0.21790000, 18853.10},
+     {ATOM_TYPE_HA2, ATOM_TYPE_CT2, ATOM_TYPE_CT2, 110.100000, 221.752000, 0.21790000, 18853.10},
+     {ATOM_TYPE_HA2, ATOM_TYPE_CT2, ATOM_TYPE_CT3, 110.100000, 289.532800, 0.21790000, 18853.10},
+     {ATOM_TYPE_HA2, ATOM_TYPE_CT2, ATOM_TYPE_HA2, 109.000000, 297.064000, 0.18020000, 4518.72},
+     {ATOM_TYPE_HA3, ATOM_TYPE_CT3, ATOM_TYPE_C, 109.500000, 276.144000, 0.21630000, 25104.00},
+     {ATOM_TYPE_HA3, ATOM_TYPE_CT3, ATOM_TYPE_CA, 107.500000, 412.542400, 0.00000000, 0.00},
+     {ATOM_TYPE_HA3, ATOM_TYPE_CT3, ATOM_TYPE_CC, 109.500000, 276.144000, 0.21630000, 25104.00},
+     {ATOM_TYPE_HA3, ATOM_TYPE_CT3, ATOM_TYPE_CD, 109.500000, 276.144000, 0.21630000, 25104.00},
+     {ATOM_TYPE_HA3, ATOM_TYPE_CT3, ATOM_TYPE_CE1, 111.500000, 351.456000, 0.00000000, 0.00},
+     {ATOM_TYPE_HA3, ATOM_TYPE_CT3, ATOM_TYPE_CPH1, 109.500000, 279.742240, 0.00000000, 0.00},
+     {ATOM_TYPE_HA3, ATOM_TYPE_CT3, ATOM_TYPE_CS, 110.100000, 289.532800, 0.21790000, 18853.10},
+     {ATOM_TYPE_HA3, ATOM_TYPE_CT3, ATOM_TYPE_CT1, 110.100000, 279.742240, 0.21790000, 18853.10},
+     {ATOM_TYPE_HA3, ATOM_TYPE_CT3, ATOM_TYPE_CT2, 110.100000, 289.532800, 0.21790000, 18853.10},
+     {ATOM_TYPE_HA3, ATOM_TYPE_CT3, ATOM_TYPE_CT3, 110.100000, 313.800000, 0.21790000, 18853.10},
+     {ATOM_TYPE_HA3, ATOM_TYPE_CT3, ATOM_TYPE_HA3, 108.400000, 297.064000, 0.18020000, 4518.72},
+     {ATOM_TYPE_HE1, ATOM_TYPE_CE1, ATOM_TYPE_CE1, 119.500000, 435.136000, 0.00000000, 0.00},
+     {ATOM_TYPE_HE1, ATOM_TYPE_CE1, ATOM_TYPE_CE2, 118.000000, 351.456000, 0.00000000, 0.00},
+     {ATOM_TYPE_HE1, ATOM_TYPE_CE1, ATOM_TYPE_CT2, 116.000000, 334.720000, 0.00000000, 0.00},
+     {ATOM_TYPE_HE1, ATOM_TYPE_CE1, ATOM_TYPE_CT3, 117.000000, 184.096000, 0.00000000, 0.00},
+     {ATOM_TYPE_HE2, ATOM_TYPE_CE2, ATOM_TYPE_CE1, 120.500000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_HE2, ATOM_TYPE_CE2, ATOM_TYPE_CE2, 120.500000, 464.424000, 0.00000000, 0.00},
+     {ATOM_TYPE_HE2, ATOM_TYPE_CE2, ATOM_TYPE_HE2, 119.000000, 158.992000, 0.00000000, 0.00},
+     {ATOM_TYPE_HB1, ATOM_TYPE_CP1, ATOM_TYPE_C, 112.000000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_HB1, ATOM_TYPE_CP1, ATOM_TYPE_CC, 112.000000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_HB1, ATOM_TYPE_CP1, ATOM_TYPE_CD, 112.000000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_HB1, ATOM_TYPE_CP1, ATOM_TYPE_CP2, 118.000000, 292.880000, 0.00000000, 0.00},
+     {ATOM_TYPE_HB1, ATOM_TYPE_CT1, ATOM_TYPE_C, 109.500000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_HB1, ATOM_TYPE_CT1, ATOM_TYPE_CC, 109.500000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_HB1, ATOM_TYPE_CT1, ATOM_TYPE_CD, 109.500000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_HB1, ATOM_TYPE_CT1, ATOM_TYPE_CT1, 111.000000, 292.880000, 0.00000000, 0.00},
+     {ATOM_TYPE_HB1, ATOM_TYPE_CT1, ATOM_TYPE_CT2, 111.000000, 292.880000, 0.00000000, 0.00},
+     {ATOM_TYPE_HB1, ATOM_TYPE_CT1, ATOM_TYPE_CT3, 111.000000, 292.880000, 0.00000000, 0.00},
+     {ATOM_TYPE_HB2, ATOM_TYPE_CT2, ATOM_TYPE_C, 109.500000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_HB2, ATOM_TYPE_CT2, ATOM_TYPE_CC, 109.500000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_HB2, ATOM_TYPE_CT2, ATOM_TYPE_CD, 109.500000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_HB2, ATOM_TYPE_CT2, ATOM_TYPE_HB2, 115.000000, 301.248000, 0.00000000, 0.00},
+     {ATOM_TYPE_HC, ATOM_TYPE_NC2, ATOM_TYPE_C, 120.000000, 410.032000, 0.00000000, 0.00},
+     {ATOM_TYPE_HC, ATOM_TYPE_NC2, ATOM_TYPE_CT2, 120.000000, 338.067200, 0.00000000, 0.00},
+     {ATOM_TYPE_HC, ATOM_TYPE_NC2, ATOM_TYPE_CT3, 120.000000, 338.067200, 0.00000000, 0.00},
+     {ATOM_TYPE_HC, ATOM_TYPE_NC2, ATOM_TYPE_HC, 120.000000, 209.200000, 0.00000000, 0.00},
+     {ATOM_TYPE_HC, ATOM_TYPE_NH2, ATOM_TYPE_CT2, 111.000000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_HC, ATOM_TYPE_NH2, ATOM_TYPE_CT3, 111.000000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_HC, ATOM_TYPE_NH2, ATOM_TYPE_HC, 106.500000, 326.352000, 0.00000000, 0.00},
+     {ATOM_TYPE_HC, ATOM_TYPE_NH3, ATOM_TYPE_CT1, 109.500000, 251.040000, 0.20740000, 16736.00},
+     {ATOM_TYPE_HC, ATOM_TYPE_NH3, ATOM_TYPE_CT2, 109.500000, 251.040000, 0.20740000, 16736.00},
+     {ATOM_TYPE_HC, ATOM_TYPE_NH3, ATOM_TYPE_CT3, 109.500000, 251.040000, 0.20740000, 16736.00},
+     {ATOM_TYPE_HC, ATOM_TYPE_NH3, ATOM_TYPE_HC, 109.500000, 368.192000, 0.00000000, 0.00},
+     {ATOM_TYPE_HC, ATOM_TYPE_NP, ATOM_TYPE_CP1, 109.500000, 276.144000, 0.20560000, 3347.20},
+     {ATOM_TYPE_HC, ATOM_TYPE_NP, ATOM_TYPE_CP3, 109.500000, 276.144000, 0.20560000, 3347.20},
+     {ATOM_TYPE_HC, ATOM_TYPE_NP, ATOM_TYPE_HC, 107.500000, 426.768000, 0.00000000, 0.00},
+     {ATOM_TYPE_HP, ATOM_TYPE_CA, ATOM_TYPE_CA, 120.000000, 251.040000, 0.21525000, 18409.60},
+     {ATOM_TYPE_HR1, ATOM_TYPE_CPH1, ATOM_TYPE_CPH1, 130.000000, 184.096000, 0.22150000, 12552.00},
+     {ATOM_TYPE_HR3, ATOM_TYPE_CPH1, ATOM_TYPE_CPH1, 130.000000, 209.200000, 0.22000000, 16736.00},
+     {ATOM_TYPE_HS, ATOM_TYPE_S, ATOM_TYPE_CT2, 95.000000, 324.678400, 0.00000000, 0.00},
+     {ATOM_TYPE_HS, ATOM_TYPE_S, ATOM_TYPE_CT3, 95.000000, 359.824000, 0.00000000, 0.00},
+     {ATOM_TYPE_N, ATOM_TYPE_C, ATOM_TYPE_CP1, 112.500000, 167.360000, 0.00000000, 0.00},
+     {ATOM_TYPE_N, ATOM_TYPE_C, ATOM_TYPE_CT1, 112.500000, 167.360000, 0.00000000, 0.00},
+     {ATOM_TYPE_N, ATOM_TYPE_C, ATOM_TYPE_CT2, 112.500000, 167.360000, 0.00000000, 0.00},
+     {ATOM_TYPE_N, ATOM_TYPE_C, ATOM_TYPE_CT3, 112.500000, 167.360000, 0.00000000, 0.00},
+     {ATOM_TYPE_N, ATOM_TYPE_CP1, ATOM_TYPE_C, 108.200000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_N, ATOM_TYPE_CP1, ATOM_TYPE_CC, 108.200000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_N, ATOM_TYPE_CP1, ATOM_TYPE_CD, 108.200000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_N, ATOM_TYPE_CP1, ATOM_TYPE_CP2, 110.800000, 585.760000, 0.00000000, 0.00},
+     {ATOM_TYPE_N, ATOM_TYPE_CP1, ATOM_TYPE_HB1, 112.000000, 401.664000, 0.00000000, 0.00},
+     {ATOM_TYPE_N, ATOM_TYPE_CP3, ATOM_TYPE_CP2, 110.500000, 585.760000, 0.00000000, 0.00},
+     {ATOM_TYPE_N, ATOM_TYPE_CP3, ATOM_TYPE_HA2, 108.000000, 401.664000, 0.00000000, 0.00},
+     {ATOM_TYPE_NC2, ATOM_TYPE_C, ATOM_TYPE_NC2, 120.000000, 334.720000, 0.23100000, 58576.00},
+     {ATOM_TYPE_NC2, ATOM_TYPE_CT2, ATOM_TYPE_CT2, 107.500000, 566.513600, 0.00000000, 0.00},
+     {ATOM_TYPE_NC2, ATOM_TYPE_CT2, ATOM_TYPE_HA2, 107.500000, 472.792000, 0.00000000, 0.00},
+     {ATOM_TYPE_NC2, ATOM_TYPE_CT3, ATOM_TYPE_HA3, 107.500000, 472.792000, 0.00000000, 0.00},
+     {ATOM_TYPE_NH1, ATOM_TYPE_C, ATOM_TYPE_CP1, 116.500000, 669.440000, 0.00000000, 0.00},
+     {ATOM_TYPE_NH1, ATOM_TYPE_C, ATOM_TYPE_CT1, 116.500000, 669.440000, 0.00000000, 0.00},
+     {ATOM_TYPE_NH1, ATOM_TYPE_C, ATOM_TYPE_CT2, 116.500000, 669.440000, 0.00000000, 0.00},
+     {ATOM_TYPE_NH1, ATOM_TYPE_C, ATOM_TYPE_CT3, 116.500000, 669.440000, 0.00000000, 0.00},
+     {ATOM_TYPE_NH1, ATOM_TYPE_CT1, ATOM_TYPE_C, 107.000000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_NH1, ATOM_TYPE_CT1, ATOM_TYPE_CC, 107.000000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_NH1, ATOM_TYPE_CT1, ATOM_TYPE_CD, 107.000000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_NH1, ATOM_TYPE_CT1, ATOM_TYPE_CT1, 113.500000, 585.760000, 0.00000000, 0.00},
+     {ATOM_TYPE_NH1, ATOM_TYPE_CT1, ATOM_TYPE_CT2, 113.500000, 585.760000, 0.00000000, 0.00},
+     {ATOM_TYPE_NH1, ATOM_TYPE_CT1, ATOM_TYPE_CT3, 113.500000, 585.760000, 0.00000000, 0.00},
+     {ATOM_TYPE_NH1, ATOM_TYPE_CT1, ATOM_TYPE_HB1, 108.000000, 401.664000, 0.00000000, 0.00},
+     {ATOM_TYPE_NH1, ATOM_TYPE_CT2, ATOM_TYPE_C, 107.000000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_NH1, ATOM_TYPE_CT2, ATOM_TYPE_CC, 107.000000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_NH1, ATOM_TYPE_CT2, ATOM_TYPE_CD, 107.000000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_NH1, ATOM_TYPE_CT2, ATOM_TYPE_CT2, 113.500000, 585.760000, 0.00000000, 0.00},
+     {ATOM_TYPE_NH1, ATOM_TYPE_CT2, ATOM_TYPE_HA2, 109.500000, 430.952000, 0.00000000, 0.00},
+     {ATOM_TYPE_NH1, ATOM_TYPE_CT2, ATOM_TYPE_HB2, 108.000000, 401.664000, 0.00000000, 0.00},
+     {ATOM_TYPE_NH1, ATOM_TYPE_CT3, ATOM_TYPE_HA3, 109.500000, 430.952000, 0.00000000, 0.00},
+     {ATOM_TYPE_NH2, ATOM_TYPE_CC, ATOM_TYPE_CP1, 112.500000, 669.440000, 0.00000000, 0.00},
+     {ATOM_TYPE_NH2, ATOM_TYPE_CC, ATOM_TYPE_CT1, 116.500000, 418.400000, 0.24500000, 41840.00},
+     {ATOM_TYPE_NH2, ATOM_TYPE_CC, ATOM_TYPE_CT2, 116.500000, 418.400000, 0.24500000, 41840.00},
+     {ATOM_TYPE_NH2, ATOM_TYPE_CC, ATOM_TYPE_CT3, 116.500000, 418.400000, 0.24500000, 41840.00},
+     {ATOM_TYPE_NH2, ATOM_TYPE_CC, ATOM_TYPE_HA1, 111.000000, 368.192000, 0.19800000, 41840.00},
+     {ATOM_TYPE_NH2, ATOM_TYPE_CT2, ATOM_TYPE_HB2, 109.500000, 317.984000, 0.21400000, 41840.00},
+     {ATOM_TYPE_NH2, ATOM_TYPE_CT2, ATOM_TYPE_CD, 108.000000, 435.136000, 0.00000000, 0.00},
+     {ATOM_TYPE_NH2, ATOM_TYPE_CT2, ATOM_TYPE_CT2, 110.000000, 566.513600, 0.00000000, 0.00},
+     {ATOM_TYPE_NH2, ATOM_TYPE_CT2, ATOM_TYPE_HA2, 109.500000, 317.984000, 0.21400000, 41840.00},
+     {ATOM_TYPE_NH2, ATOM_TYPE_CT3, ATOM_TYPE_HA3, 109.500000, 317.984000, 0.21400000, 41840.00},
+     {ATOM_TYPE_NH3, ATOM_TYPE_CT1, ATOM_TYPE_C, 110.000000, 365.681600, 0.00000000, 0.00},
+     {ATOM_TYPE_NH3, ATOM_TYPE_CT1, ATOM_TYPE_CC, 110.000000, 365.681600, 0.00000000, 0.00},
+     {ATOM_TYPE_NH3, ATOM_TYPE_CT1, ATOM_TYPE_CT1, 110.000000, 566.513600, 0.00000000, 0.00},
+     {ATOM_TYPE_NH3, ATOM_TYPE_CT1, ATOM_TYPE_CT2, 110.000000, 566.513600, 0.00000000, 0.00},
+     {ATOM_TYPE_NH3, ATOM_TYPE_CT1, ATOM_TYPE_CT3, 110.000000, 566.513600, 0.00000000, 0.00},
+     {ATOM_TYPE_NH3, ATOM_TYPE_CT1, ATOM_TYPE_HB1, 107.500000, 430.952000, 0.00000000, 0.00},
+     {ATOM_TYPE_NH3, ATOM_TYPE_CT2, ATOM_TYPE_C, 110.000000, 365.681600, 0.00000000, 0.00},
+     {ATOM_TYPE_NH3, ATOM_TYPE_CT2, ATOM_TYPE_CC, 110.000000, 365.681600, 0.00000000, 0.00},
+     {ATOM_TYPE_NH3, ATOM_TYPE_CT2, ATOM_TYPE_CD, 110.000000, 365.681600, 0.00000000, 0.00},
+     {ATOM_TYPE_NH3, ATOM_TYPE_CT2, ATOM_TYPE_CT2, 110.000000, 566.513600, 0.00000000, 0.00},
+     {ATOM_TYPE_NH3, ATOM_TYPE_CT2, ATOM_TYPE_CT3, 110.000000, 566.513600, 0.00000000, 0.00},
+     {ATOM_TYPE_NH3, ATOM_TYPE_CT2, ATOM_TYPE_HA2, 107.500000, 376.560000, 0.21010000, 29288.00},
+     {ATOM_TYPE_NH3, ATOM_TYPE_CT2, ATOM_TYPE_HB2, 107.500000, 430.952000, 0.00000000, 0.00},
+     {ATOM_TYPE_NH3, ATOM_TYPE_CT3, ATOM_TYPE_HA3, 107.500000, 376.560000, 0.21010000, 29288.00},
+     {ATOM_TYPE_NP, ATOM_TYPE_CP1, ATOM_TYPE_C, 106.000000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_NP, ATOM_TYPE_CP1, ATOM_TYPE_CC, 106.000000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_NP, ATOM_TYPE_CP1, ATOM_TYPE_CD, 106.000000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_NP, ATOM_TYPE_CP1, ATOM_TYPE_CP2, 108.500000, 585.760000, 0.00000000, 0.00},
+     {ATOM_TYPE_NP, ATOM_TYPE_CP1, ATOM_TYPE_HB1, 107.500000, 430.952000, 0.00000000, 0.00},
+     {ATOM_TYPE_NP, ATOM_TYPE_CP3, ATOM_TYPE_CP2, 108.500000, 585.760000, 0.00000000, 0.00},
+     {ATOM_TYPE_NP, ATOM_TYPE_CP3, ATOM_TYPE_HA2, 109.150000, 430.952000, 0.00000000, 0.00},
+     {ATOM_TYPE_NR1, ATOM_TYPE_CPH1, ATOM_TYPE_CPH1, 106.000000, 1087.840000, 0.00000000, 0.00},
+     {ATOM_TYPE_NR1, ATOM_TYPE_CPH1, ATOM_TYPE_CT2, 124.000000, 383.254400, 0.00000000, 0.00},
+     {ATOM_TYPE_NR1, ATOM_TYPE_CPH1, ATOM_TYPE_CT3, 124.000000, 383.254400, 0.00000000, 0.00},
+     {ATOM_TYPE_NR1, ATOM_TYPE_CPH1, ATOM_TYPE_HR3, 124.000000, 209.200000, 0.21400000, 16736.00},
+     {ATOM_TYPE_NR1, ATOM_TYPE_CPH2, ATOM_TYPE_HR1, 122.500000, 209.200000, 0.21400000, 16736.00},
+     {ATOM_TYPE_NR2, ATOM_TYPE_CPH1, ATOM_TYPE_CPH1, 110.000000, 1087.840000, 0.00000000, 0.00},
+     {ATOM_TYPE_NR2, ATOM_TYPE_CPH1, ATOM_TYPE_CT2, 120.000000, 383.254400, 0.00000000, 0.00},
+     {ATOM_TYPE_NR2, ATOM_TYPE_CPH1, ATOM_TYPE_HR3, 120.000000, 209.200000, 0.21400000, 16736.00},
+     {ATOM_TYPE_NR2, ATOM_TYPE_CPH2, ATOM_TYPE_HR1, 125.000000, 209.200000, 0.21200000, 16736.00},
+     {ATOM_TYPE_NR2, ATOM_TYPE_CPH2, ATOM_TYPE_NR1, 112.500000, 1087.840000, 0.00000000, 0.00},
+     {ATOM_TYPE_NR3, ATOM_TYPE_CPH1, ATOM_TYPE_CPH1, 108.000000, 1213.360000, 0.00000000, 0.00},
+     {ATOM_TYPE_NR3, ATOM_TYPE_CPH1, ATOM_TYPE_CT2, 122.000000, 383.254400, 0.00000000, 0.00},
+     {ATOM_TYPE_NR3, ATOM_TYPE_CPH1, ATOM_TYPE_HR1, 122.000000, 184.096000, 0.21800000, 12552.00},
+     {ATOM_TYPE_NR3, ATOM_TYPE_CPH2, ATOM_TYPE_HR2, 126.000000, 267.776000, 0.21400000, 20920.00},
+     {ATOM_TYPE_NR3, ATOM_TYPE_CPH2, ATOM_TYPE_NR3, 108.000000, 1213.360000, 0.00000000, 0.00},
+     {ATOM_TYPE_O, ATOM_TYPE_C, ATOM_TYPE_CP1, 118.000000, 669.440000, 0.00000000, 0.00},
+     {ATOM_TYPE_O, ATOM_TYPE_C, ATOM_TYPE_CT1, 121.000000, 669.440000, 0.00000000, 0.00},
+     {ATOM_TYPE_O, ATOM_TYPE_C, ATOM_TYPE_CT2, 121.000000, 669.440000, 0.00000000, 0.00},
+     {ATOM_TYPE_O, ATOM_TYPE_C, ATOM_TYPE_CT3, 121.000000, 669.440000, 0.00000000, 0.00},
+     {ATOM_TYPE_O, ATOM_TYPE_C, ATOM_TYPE_H, 121.700000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_O, ATOM_TYPE_C, ATOM_TYPE_N, 122.500000, 669.440000, 0.00000000, 0.00},
+     {ATOM_TYPE_O, ATOM_TYPE_C, ATOM_TYPE_NH1, 122.500000, 669.440000, 0.00000000, 0.00},
+     {ATOM_TYPE_O, ATOM_TYPE_CC, ATOM_TYPE_CP1, 118.000000, 669.440000, 0.00000000, 0.00},
+     {ATOM_TYPE_O, ATOM_TYPE_CC, ATOM_TYPE_CT1, 121.000000, 125.520000, 0.24400000, 41840.00},
+     {ATOM_TYPE_O, ATOM_TYPE_CC, ATOM_TYPE_CT2, 121.000000, 125.520000, 0.24400000, 41840.00},
+     {ATOM_TYPE_O, ATOM_TYPE_CC, ATOM_TYPE_CT3, 121.000000, 125.520000, 0.24400000, 41840.00},
+     {ATOM_TYPE_O, ATOM_TYPE_CC, ATOM_TYPE_HA1, 122.000000, 368.192000, 0.00000000, 0.00},
+     {ATOM_TYPE_O, ATOM_TYPE_CC, ATOM_TYPE_NH2, 122.500000, 627.600000, 0.23700000, 41840.00},
+     {ATOM_TYPE_OB, ATOM_TYPE_CD, ATOM_TYPE_CP1, 125.000000, 585.760000, 0.24420000, 16736.00},
+     {ATOM_TYPE_OB, ATOM_TYPE_CD, ATOM_TYPE_CT1, 125.000000, 585.760000, 0.24420000, 16736.00},
+     {ATOM_TYPE_OB, ATOM_TYPE_CD, ATOM_TYPE_CT2, 125.000000, 585.760000, 0.24420000, 16736.00},
+     {ATOM_TYPE_OB, ATOM_TYPE_CD, ATOM_TYPE_CT3, 125.000000, 585.760000, 0.24420000, 16736.00},
+     {ATOM_TYPE_OC, ATOM_TYPE_CA, ATOM_TYPE_CA, 120.000000, 334.720000, 0.00000000, 0.00},
+     {ATOM_TYPE_OC, ATOM_TYPE_CC, ATOM_TYPE_CP1, 118.000000, 334.720000, 0.23880000, 41840.00},
+     {ATOM_TYPE_OC, ATOM_TYPE_CC, ATOM_TYPE_CT1, 118.000000, 334.720000, 0.23880000, 41840.00},
+     {ATOM_TYPE_OC, ATOM_TYPE_CC, ATOM_TYPE_CT2, 118.000000, 334.720000, 0.23880000, 41840.00},
+     {ATOM_TYPE_OC, ATOM_TYPE_CC, ATOM_TYPE_CT3, 118.000000, 334.720000, 0.23880000, 41840.00},
+     {ATOM_TYPE_OC, ATOM_TYPE_CC, ATOM_TYPE_OC, 124.000000, 836.800000, 0.22250000, 58576.00},
+     {ATOM_TYPE_OC, ATOM_TYPE_CT2, ATOM_TYPE_CT3, 122.000000, 543.920000, 0.00000000, 0.00},
+     {ATOM_TYPE_OC, ATOM_TYPE_CT2, ATOM_TYPE_HA2, 118.300000, 543.920000, 0.00000000, 0.00},
+     {ATOM_TYPE_OC, ATOM_TYPE_CT3, ATOM_TYPE_HA3, 118.300000, 543.920000, 0.00000000, 0.00},
+     {ATOM_TYPE_OH1, ATOM_TYPE_CA, ATOM_TYPE_CA, 120.000000, 378.233600, 0.00000000, 0.00},
+     {ATOM_TYPE_OH1, ATOM_TYPE_CD, ATOM_TYPE_CT2, 110.500000, 460.240000, 0.00000000, 0.00},
+     {ATOM_TYPE_OH1, ATOM_TYPE_CD, ATOM_TYPE_CT3, 110.500000, 460.240000, 0.00000000, 0.00},
+     {ATOM_TYPE_OH1, ATOM_TYPE_CD, ATOM_TYPE_OB, 123.000000, 418.400000, 0.22620000, 175728.00},
+     {ATOM_TYPE_OH1, ATOM_TYPE_CT1, ATOM_TYPE_CT1, 110.100000, 633.457600, 0.00000000, 0.00},
+     {ATOM_TYPE_OH1, ATOM_TYPE_CT1, ATOM_TYPE_CT3, 110.100000, 633.457600, 0.00000000, 0.00},
+     {ATOM_TYPE_OH1, ATOM_TYPE_CT1, ATOM_TYPE_HA1, 108.890000, 384.091200, 0.00000000, 0.00},
+     {ATOM_TYPE_OH1, ATOM_TYPE_CT2, ATOM_TYPE_CT1, 110.100000, 633.457600, 0.00000000, 0.00},
+     {ATOM_TYPE_OH1, ATOM_TYPE_CT2, ATOM_TYPE_CT2, 110.100000, 633.457600, 0.00000000, 0.00},
+     {ATOM_TYPE_OH1, ATOM_TYPE_CT2, ATOM_TYPE_CT3, 110.100000, 633.457600, 0.00000000, 0.00},
+     {ATOM_TYPE_OH1, ATOM_TYPE_CT2, ATOM_TYPE_HA2, 108.890000, 384.091200, 0.00000000, 0.00},
+     {ATOM_TYPE_OH1, ATOM_TYPE_CT3, ATOM_TYPE_HA3, 108.890000, 384.091200, 0.00000000, 0.00},
+     {ATOM_TYPE_OS, ATOM_TYPE_CD, ATOM_TYPE_CP1, 109.000000, 460.240000, 0.23260000, 16736.00},
+     {ATOM_TYPE_OS, ATOM_TYPE_CD, ATOM_TYPE_CT1, 109.000000, 460.240000, 0.23260000, 16736.00},
+     {ATOM_TYPE_OS, ATOM_TYPE_CD, ATOM_TYPE_CT2, 109.000000, 460.240000, 0.23260000, 16736.00},
+     {ATOM_TYPE_OS, ATOM_TYPE_CD, ATOM_TYPE_CT3, 109.000000, 460.240000, 0.23260000, 16736.00},
+     {ATOM_TYPE_OS, ATOM_TYPE_CD, ATOM_TYPE_OB, 125.900000, 753.120000, 0.22576000, 133888.00},
+     {ATOM_TYPE_OS, ATOM_TYPE_CT2, ATOM_TYPE_HA2, 109.500000, 502.080000, 0.00000000, 0.00},
+     {ATOM_TYPE_OS, ATOM_TYPE_CT3, ATOM_TYPE_HA3, 109.500000, 502.080000, 0.00000000, 0.00},
+     {ATOM_TYPE_S, ATOM_TYPE_CT2, ATOM_TYPE_CT1, 112.500000, 485.344000, 0.00000000, 0.00},
+     {ATOM_TYPE_S, ATOM_TYPE_CT2, ATOM_TYPE_CT2, 114.500000, 485.344000, 0.00000000, 0.00},
+     {ATOM_TYPE_S, ATOM_TYPE_CT2, ATOM_TYPE_CT3, 114.500000, 485.344000, 0.00000000, 0.00},
+     {ATOM_TYPE_S, ATOM_TYPE_CT2, ATOM_TYPE_HA2, 111.300000, 385.764800, 0.00000000, 0.00},
+     {ATOM_TYPE_S, ATOM_TYPE_CT3, ATOM_TYPE_HA3, 111.300000, 385.764800, 0.00000000, 0.00},
+     {ATOM_TYPE_SM, ATOM_TYPE_CT2, ATOM_TYPE_CT1, 112.500000, 485.344000, 0.00000000, 0.00},
+     {ATOM_TYPE_SM, ATOM_TYPE_CT2, ATOM_TYPE_CT3, 112.500000, 485.344000, 0.00000000, 0.00},
+     {ATOM_TYPE_SM, ATOM_TYPE_CT2, ATOM_TYPE_HA2, 111.000000, 317.984000, 0.00000000, 0.00},
+     {ATOM_TYPE_SM, ATOM_TYPE_CT3, ATOM_TYPE_HA3, 111.000000, 317.984000, 0.00000000, 0.00},
+     {ATOM_TYPE_SM, ATOM_TYPE_SM, ATOM_TYPE_CT2, 103.300000, 606.680000, 0.00000000, 0.00},
+     {ATOM_TYPE_SM, ATOM_TYPE_SM, ATOM_TYPE_CT3, 103.300000, 606.680000, 0.00000000, 0.00},
+     {ATOM_TYPE_SS, ATOM_TYPE_CS, ATOM_TYPE_CT3, 118.000000, 460.240000, 0.00000000, 0.00},
+     {ATOM_TYPE_SS, ATOM_TYPE_CS, ATOM_TYPE_HA2, 112.300000, 334.720000, 0.00000000, 0.00},
+     {ATOM_TYPE_SS, ATOM_TYPE_CS, ATOM_TYPE_HA3, 112.300000, 334.720000, 0.00000000, 0.00},
+     {ATOM_TYPE_O, ATOM_TYPE_CD, ATOM_TYPE_HR1, 121.000000, 627.600000, 0.00000000, 0.00},
+     {ATOM_TYPE_NH1, ATOM_TYPE_CT1, ATOM_TYPE_CT2A, 113.500000, 585.760000, 0.00000000, 0.00},
+     {ATOM_TYPE_HB1, ATOM_TYPE_CT1, ATOM_TYPE_CT2A, 111.000000, 292.880000, 0.00000000, 0.00},
+     {ATOM_TYPE_CT2A, ATOM_TYPE_CT1, ATOM_TYPE_C, 108.000000, 435.136000, 0.00000000, 0.00},
+     {ATOM_TYPE_CT1, ATOM_TYPE_CT2A, ATOM_TYPE_HA2, 110.100000, 221.752000, 0.21790000, 18853.10},
+     {ATOM_TYPE_CT1, ATOM_TYPE_CT2A, ATOM_TYPE_CT2, 113.500000, 488.272800, 0.25610000, 9338.69},
+     {ATOM_TYPE_HA2, ATOM_TYPE_CT2A, ATOM_TYPE_HA2, 109.000000, 297.064000, 0.18020000, 4518.72},
+     {ATOM_TYPE_HA2, ATOM_TYPE_CT2A, ATOM_TYPE_CT2, 110.100000, 221.752000, 0.21790000, 18853.10},
+     {ATOM_TYPE_CT2A, ATOM_TYPE_CT2, ATOM_TYPE_HA2, 110.100000, 221.752000, 0.21790000, 18853.10},
+     {ATOM_TYPE_CT2A, ATOM_TYPE_CT2, ATOM_TYPE_CC, 108.000000, 435.136000, 0.00000000, 0.00},
+     {ATOM_TYPE_CT1, ATOM_TYPE_CT2A, ATOM_TYPE_CPH1, 113.000000, 488.272800, 0.00000000, 0.00},
+     {ATOM_TYPE_HA2, ATOM_TYPE_CT2A, ATOM_TYPE_CPH1, 109.500000, 279.742240, 0.00000000, 0.00},
+     {ATOM_TYPE_CT2A, ATOM_TYPE_CPH1, ATOM_TYPE_CPH1, 130.000000, 383.254400, 0.00000000, 0.00},
+     {ATOM_TYPE_CT2A, ATOM_TYPE_CPH1, ATOM_TYPE_NR3, 122.000000, 383.254400, 0.00000000, 0.00},
+     {ATOM_TYPE_CT1, ATOM_TYPE_CT2A, ATOM_TYPE_CC, 108.000000, 435.136000, 0.00000000, 0.00},
+     {ATOM_TYPE_HA2, ATOM_TYPE_CT2A, ATOM_TYPE_CC, 109.500000, 276.144000, 0.21630000, 25104.00},
+     {ATOM_TYPE_OC, ATOM_TYPE_CC, ATOM_TYPE_CT2A, 118.000000, 334.720000, 0.23880000, 41840.00},
+     {ATOM_TYPE_NH3, ATOM_TYPE_CT1, ATOM_TYPE_CT2A, 110.000000, 566.513600, 0.00000000, 0.00},
+     {ATOM_TYPE_CT2A, ATOM_TYPE_CT1, ATOM_TYPE_CD, 108.000000, 435.136000, 0.00000000, 0.00},
+     {ATOM_TYPE_HT, ATOM_TYPE_OT, ATOM_TYPE_HT, 104.520000, 460.240000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_CG1N1, ATOM_TYPE_NG1T1, 180.000000, 334.720000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG331, ATOM_TYPE_CG1N1, ATOM_TYPE_NG1T1, 180.000000, 177.401600, 0.00000000, 0.00},
+     {ATOM_TYPE_CG1T1, ATOM_TYPE_CG1T1, ATOM_TYPE_CG331, 180.000000, 158.992000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG25C1, ATOM_TYPE_CG251O, ATOM_TYPE_CG2R53, 125.000000, 334.720000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG25C1, ATOM_TYPE_CG251O, ATOM_TYPE_NG2R53, 124.000000, 334.720000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG25C1, ATOM_TYPE_CG251O, ATOM_TYPE_SG311, 124.000000, 334.720000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2DC3, ATOM_TYPE_CG251O, ATOM_TYPE_CG2R53, 119.000000, 334.720000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2DC3, ATOM_TYPE_CG251O, ATOM_TYPE_NG2R53, 130.000000, 334.720000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2DC3, ATOM_TYPE_CG251O, ATOM_TYPE_SG311, 130.000000, 334.720000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R53, ATOM_TYPE_CG251O, ATOM_TYPE_NG2R53, 111.000000, 970.688000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R53, ATOM_TYPE_CG251O, ATOM_TYPE_SG311, 111.000000, 920.480000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG25C2, ATOM_TYPE_CG252O, ATOM_TYPE_CG2R53, 125.000000, 334.720000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG25C2, ATOM_TYPE_CG252O, ATOM_TYPE_NG2R53, 124.000000, 334.720000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG25C2, ATOM_TYPE_CG252O, ATOM_TYPE_SG311, 124.000000, 334.720000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2DC3, ATOM_TYPE_CG252O, ATOM_TYPE_CG2R53, 119.000000, 334.720000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2DC3, ATOM_TYPE_CG252O, ATOM_TYPE_NG2R53, 130.000000, 334.720000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2DC3, ATOM_TYPE_CG252O, ATOM_TYPE_SG311, 130.000000, 334.720000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R53, ATOM_TYPE_CG252O, ATOM_TYPE_NG2R53, 111.000000, 970.688000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R53, ATOM_TYPE_CG252O, ATOM_TYPE_SG311, 111.000000, 920.480000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG251O, ATOM_TYPE_CG25C1, ATOM_TYPE_CG2R53, 113.000000, 276.144000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG251O, ATOM_TYPE_CG25C1, ATOM_TYPE_CG2RC0, 131.500000, 276.144000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2DC3, ATOM_TYPE_CG25C1, ATOM_TYPE_CG2R53, 115.500000, 276.144000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2DC3, ATOM_TYPE_CG25C1, ATOM_TYPE_CG2RC0, 130.000000, 276.144000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R53, ATOM_TYPE_CG25C1, ATOM_TYPE_CG2RC0, 114.500000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG252O, ATOM_TYPE_CG25C2, ATOM_TYPE_CG2R53, 113.000000, 276.144000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG252O, ATOM_TYPE_CG25C2, ATOM_TYPE_CG2RC0, 131.500000, 276.144000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2DC3, ATOM_TYPE_CG25C2, ATOM_TYPE_CG2R53, 115.500000, 276.144000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2DC3, ATOM_TYPE_CG25C2, ATOM_TYPE_CG2RC0, 130.000000, 276.144000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R53, ATOM_TYPE_CG25C2, ATOM_TYPE_CG2RC0, 114.500000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2D1, ATOM_TYPE_CG2D1, ATOM_TYPE_CG301, 123.500000, 401.664000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2D1, ATOM_TYPE_CG2D1, ATOM_TYPE_CG321, 123.500000, 401.664000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2D1, ATOM_TYPE_CG2D1, ATOM_TYPE_CG331, 123.500000, 401.664000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2D1, ATOM_TYPE_CG2D1, ATOM_TYPE_HGA4, 119.500000, 435.136000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2D1O, ATOM_TYPE_CG2D1, ATOM_TYPE_CG321, 127.500000, 334.720000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2D1O, ATOM_TYPE_CG2D1, ATOM_TYPE_HGA4, 119.500000, 435.136000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2D2, ATOM_TYPE_CG2D1, ATOM_TYPE_CG321, 126.000000, 401.664000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2D2, ATOM_TYPE_CG2D1, ATOM_TYPE_CG331, 125.200000, 393.296000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2D2, ATOM_TYPE_CG2D1, ATOM_TYPE_HGA4, 118.000000, 351.456000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2D2O, ATOM_TYPE_CG2D1, ATOM_TYPE_CG321, 127.500000, 334.720000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2D2O, ATOM_TYPE_CG2D1, ATOM_TYPE_HGA4, 119.500000, 435.136000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG301, ATOM_TYPE_CG2D1, ATOM_TYPE_CG321, 113.000000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG301, ATOM_TYPE_CG2D1, ATOM_TYPE_CG331, 123.500000, 401.664000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG321, ATOM_TYPE_CG2D1, ATOM_TYPE_CG331, 123.500000, 401.664000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG321, ATOM_TYPE_CG2D1, ATOM_TYPE_HGA4, 116.000000, 334.720000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG331, ATOM_TYPE_CG2D1, ATOM_TYPE_NG2D1, 123.000000, 669.440000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG331, ATOM_TYPE_CG2D1, ATOM_TYPE_NG2P1, 125.600000, 393.296000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG331, ATOM_TYPE_CG2D1, ATOM_TYPE_HGA4, 117.000000, 184.096000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG331, ATOM_TYPE_CG2D1, ATOM_TYPE_HGR52, 120.400000, 351.456000, 0.00000000, 0.00},
+     {ATOM_TYPE_NG2D1, ATOM_TYPE_CG2D1, ATOM_TYPE_HGA4, 119.500000, 410.032000, 0.00000000, 0.00},
+     {ATOM_TYPE_NG2P1, ATOM_TYPE_CG2D1, ATOM_TYPE_HGR52, 114.000000, 326.352000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2D1, ATOM_TYPE_CG2D1O, ATOM_TYPE_NG301, 122.000000, 502.080000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2D1, ATOM_TYPE_CG2D1O, ATOM_TYPE_NG311, 122.000000, 502.080000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2D1, ATOM_TYPE_CG2D1O, ATOM_TYPE_OG3R60, 126.000000, 334.720000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2D1, ATOM_TYPE_CG2D1O, ATOM_TYPE_HGA4, 122.000000, 435.136000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2D2, ATOM_TYPE_CG2D1O, ATOM_TYPE_NG321, 128.000000, 669.440000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2D2, ATOM_TYPE_CG2D1O, ATOM_TYPE_OG301, 123.500000, 543.920000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2D2, ATOM_TYPE_CG2D1O, ATOM_TYPE_HGA4, 121.000000, 368.192000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2DC1, ATOM_TYPE_CG2D1O, ATOM_TYPE_NG301, 122.000000, 502.080000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2DC1, ATOM_TYPE_CG2D1O, ATOM_TYPE_NG311, 122.000000, 502.080000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2DC1, ATOM_TYPE_CG2D1O, ATOM_TYPE_OG301, 124.500000, 468.608000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2DC1, ATOM_TYPE_CG2D1O, ATOM_TYPE_OG3R60, 128.000000, 334.720000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2DC1, ATOM_TYPE_CG2D1O, ATOM_TYPE_HGA4, 120.000000, 351.456000, 0.00000000, 0.00},
+     {ATOM_TYPE_NG301, ATOM_TYPE_CG2D1O, ATOM_TYPE_HGA4, 119.000000, 351.456000, 0.00000000, 0.00},
+     {ATOM_TYPE_NG311, ATOM_TYPE_CG2D1O, ATOM_TYPE_HGA4, 119.000000, 351.456000, 0.00000000, 0.00},
+     {ATOM_TYPE_NG321, ATOM_TYPE_CG2D1O, ATOM_TYPE_HGA4, 113.000000, 251.040000, 0.00000000, 0.00},
+     {ATOM_TYPE_OG301, ATOM_TYPE_CG2D1O, ATOM_TYPE_HGA4, 115.500000, 251.040000, 0.00000000, 0.00},
+     {ATOM_TYPE_OG3R60, ATOM_TYPE_CG2D1O, ATOM_TYPE_HGA4, 112.000000, 251.040000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2D1, ATOM_TYPE_CG2D2, ATOM_TYPE_HGA5, 120.500000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2D1O, ATOM_TYPE_CG2D2, ATOM_TYPE_HGA5, 120.500000, 292.880000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2D2, ATOM_TYPE_CG2D2, ATOM_TYPE_HGA5, 120.500000, 464.424000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2D2O, ATOM_TYPE_CG2D2, ATOM_TYPE_HGA5, 120.500000, 292.880000, 0.00000000, 0.00},
+     {ATOM_TYPE_HGA5, ATOM_TYPE_CG2D2, ATOM_TYPE_HGA5, 119.000000, 158.992000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2D1, ATOM_TYPE_CG2D2O, ATOM_TYPE_NG301, 122.000000, 502.080000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2D1, ATOM_TYPE_CG2D2O, ATOM_TYPE_NG311, 122.000000, 502.080000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2D1, ATOM_TYPE_CG2D2O, ATOM_TYPE_OG3R60, 126.000000, 334.720000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2D1, ATOM_TYPE_CG2D2O, ATOM_TYPE_HGA4, 122.000000, 435.136000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2D2, ATOM_TYPE_CG2D2O, ATOM_TYPE_NG321, 128.000000, 669.440000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2D2, ATOM_TYPE_CG2D2O, ATOM_TYPE_OG301, 123.500000, 543.920000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2D2, ATOM_TYPE_CG2D2O, ATOM_TYPE_HGA4, 121.000000, 368.192000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2DC2, ATOM_TYPE_CG2D2O, ATOM_TYPE_NG301, 122.000000, 502.080000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2DC2, ATOM_TYPE_CG2D2O, ATOM_TYPE_NG311, 122.000000, 502.080000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2DC2, ATOM_TYPE_CG2D2O, ATOM_TYPE_OG301, 124.500000, 468.608000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2DC2, ATOM_TYPE_CG2D2O, ATOM_TYPE_OG3R60, 128.000000, 334.720000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2DC2, ATOM_TYPE_CG2D2O, ATOM_TYPE_HGA4, 120.000000, 351.456000, 0.00000000, 0.00},
+     {ATOM_TYPE_NG301, ATOM_TYPE_CG2D2O, ATOM_TYPE_HGA4, 119.000000, 351.456000, 0.00000000, 0.00},
+     {ATOM_TYPE_NG311, ATOM_TYPE_CG2D2O, ATOM_TYPE_HGA4, 119.000000, 351.456000, 0.00000000, 0.00},
+     {ATOM_TYPE_NG321, ATOM_TYPE_CG2D2O, ATOM_TYPE_HGA4, 113.000000, 251.040000, 0.00000000, 0.00},
+     {ATOM_TYPE_OG301, ATOM_TYPE_CG2D2O, ATOM_TYPE_HGA4, 115.500000, 251.040000, 0.00000000, 0.00},
+     {ATOM_TYPE_OG3R60, ATOM_TYPE_CG2D2O, ATOM_TYPE_HGA4, 112.000000, 251.040000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2D1O, ATOM_TYPE_CG2DC1, ATOM_TYPE_CG2DC2, 120.000000, 401.664000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2D1O, ATOM_TYPE_CG2DC1, ATOM_TYPE_CG2O1, 113.000000, 543.920000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2D1O, ATOM_TYPE_CG2DC1, ATOM_TYPE_CG321, 126.500000, 364.008000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2D1O, ATOM_TYPE_CG2DC1, ATOM_TYPE_HGA4, 122.000000, 351.456000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2DC1, ATOM_TYPE_CG2DC1, ATOM_TYPE_CG2DC2, 123.000000, 401.664000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2DC1, ATOM_TYPE_CG2DC1, ATOM_TYPE_CG2O1, 123.500000, 401.664000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2DC1, ATOM_TYPE_CG2DC1, ATOM_TYPE_CG2O3, 123.500000, 401.664000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2DC1, ATOM_TYPE_CG2DC1, ATOM_TYPE_CG2O4, 120.000000, 502.080000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2DC1, ATOM_TYPE_CG2DC1, ATOM_TYPE_CG301, 123.500000, 401.664000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2DC1, ATOM_TYPE_CG2DC1, ATOM_TYPE_CG321, 123.500000, 401.664000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2DC1, ATOM_TYPE_CG2DC1, ATOM_TYPE_CG331, 123.500000, 401.664000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2DC1, ATOM_TYPE_CG2DC1, ATOM_TYPE_HGA4, 119.000000, 351.456000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2DC2, ATOM_TYPE_CG2DC1, ATOM_TYPE_CG2DC3, 123.500000, 401.664000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2DC2, ATOM_TYPE_CG2DC1, ATOM_TYPE_CG301, 123.500000, 401.664000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2DC2, ATOM_TYPE_CG2DC1, ATOM_TYPE_CG331, 113.000000, 401.664000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2DC2, ATOM_TYPE_CG2DC1, ATOM_TYPE_NG2P1, 125.600000, 334.720000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2DC2, ATOM_TYPE_CG2DC1, ATOM_TYPE_HGA4, 118.000000, 351.456000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2DC2, ATOM_TYPE_CG2DC1, ATOM_TYPE_HGR52, 120.400000, 351.456000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2DC3, ATOM_TYPE_CG2DC1, ATOM_TYPE_CG2O3, 119.000000, 334.720000, 0.25267000, 29288.00},
+     {ATOM_TYPE_CG2DC3, ATOM_TYPE_CG2DC1, ATOM_TYPE_CG2O4, 120.000000, 502.080000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2DC3, ATOM_TYPE_CG2DC1, ATOM_TYPE_CG2O5, 118.600000, 292.880000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2DC3, ATOM_TYPE_CG2DC1, ATOM_TYPE_CG2R61, 122.000000, 242.672000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2DC3, ATOM_TYPE_CG2DC1, ATOM_TYPE_CG331, 123.500000, 401.664000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2DC3, ATOM_TYPE_CG2DC1, ATOM_TYPE_HGA4, 118.000000, 351.456000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2O1, ATOM_TYPE_CG2DC1, ATOM_TYPE_CG321, 123.500000, 543.920000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2O1, ATOM_TYPE_CG2DC1, ATOM_TYPE_HGA4, 119.500000, 435.136000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2O3, ATOM_TYPE_CG2DC1, ATOM_TYPE_HGA4, 119.500000, 435.136000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2O4, ATOM_TYPE_CG2DC1, ATOM_TYPE_HGA4, 122.000000, 267.776000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2O5, ATOM_TYPE_CG2DC1, ATOM_TYPE_HGA4, 123.400000, 267.776000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_CG2DC1, ATOM_TYPE_NG2D1, 117.000000, 468.608000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_CG2DC1, ATOM_TYPE_HGA4, 120.000000, 267.776000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG321, ATOM_TYPE_CG2DC1, ATOM_TYPE_CG331, 123.500000, 401.664000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG321, ATOM_TYPE_CG2DC1, ATOM_TYPE_HGA4, 116.000000, 334.720000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG331, ATOM_TYPE_CG2DC1, ATOM_TYPE_CG331, 113.000000, 393.296000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG331, ATOM_TYPE_CG2DC1, ATOM_TYPE_HGA4, 117.500000, 351.456000, 0.00000000, 0.00},
+     {ATOM_TYPE_NG2D1, ATOM_TYPE_CG2DC1, ATOM_TYPE_HGA4, 123.000000, 317.984000, 0.00000000, 0.00},
+     {ATOM_TYPE_NG2P1, ATOM_TYPE_CG2DC1, ATOM_TYPE_HGR52, 114.000000, 317.984000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2D2O, ATOM_TYPE_CG2DC2, ATOM_TYPE_CG2DC1, 120.000000, 401.664000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2D2O, ATOM_TYPE_CG2DC2, ATOM_TYPE_CG2O1, 113.000000, 543.920000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2D2O, ATOM_TYPE_CG2DC2, ATOM_TYPE_CG321, 126.500000, 364.008000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2D2O, ATOM_TYPE_CG2DC2, ATOM_TYPE_HGA4, 122.000000, 351.456000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2DC1, ATOM_TYPE_CG2DC2, ATOM_TYPE_CG2DC2, 123.000000, 401.664000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2DC1, ATOM_TYPE_CG2DC2, ATOM_TYPE_CG2DC3, 123.500000, 401.664000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2DC1, ATOM_TYPE_CG2DC2, ATOM_TYPE_CG301, 123.500000, 401.664000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2DC1, ATOM_TYPE_CG2DC2, ATOM_TYPE_CG331, 113.000000, 401.664000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2DC1, ATOM_TYPE_CG2DC2, ATOM_TYPE_NG2P1, 125.600000, 334.720000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2DC1, ATOM_TYPE_CG2DC2, ATOM_TYPE_HGA4, 118.000000, 351.456000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2DC1, ATOM_TYPE_CG2DC2, ATOM_TYPE_HGR52, 120.400000, 351.456000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2DC2, ATOM_TYPE_CG2DC2, ATOM_TYPE_CG2O1, 123.500000, 401.664000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2DC2, ATOM_TYPE_CG2DC2, ATOM_TYPE_CG2O3, 123.500000, 401.664000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2DC2, ATOM_TYPE_CG2DC2, ATOM_TYPE_CG2O4, 120.000000, 502.080000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2DC2, ATOM_TYPE_CG2DC2, ATOM_TYPE_CG301, 123.500000, 401.664000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2DC2, ATOM_TYPE_CG2DC2, ATOM_TYPE_CG321, 123.500000, 401.664000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2DC2, ATOM_TYPE_CG2DC2, ATOM_TYPE_CG331, 123.500000, 401.664000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2DC2, ATOM_TYPE_CG2DC2, ATOM_TYPE_HGA4, 119.000000, 351.456000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2DC3, ATOM_TYPE_CG2DC2, ATOM_TYPE_CG2O3, 119.000000, 334.720000, 0.25267000, 29288.00},
+     {ATOM_TYPE_CG2DC3, ATOM_TYPE_CG2DC2, ATOM_TYPE_CG2O4, 120.000000, 502.080000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2DC3, ATOM_TYPE_CG2DC2, ATOM_TYPE_CG2O5, 118.600000, 292.880000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2DC3, ATOM_TYPE_CG2DC2, ATOM_TYPE_CG2R61, 122.000000, 242.672000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2DC3, ATOM_TYPE_CG2DC2, ATOM_TYPE_CG331, 123.500000, 401.664000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2DC3, ATOM_TYPE_CG2DC2, ATOM_TYPE_HGA4, 118.000000, 351.456000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2O1, ATOM_TYPE_CG2DC2, ATOM_TYPE_CG321, 123.500000, 543.920000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2O1, ATOM_TYPE_CG2DC2, ATOM_TYPE_HGA4, 119.500000, 435.136000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2O3, ATOM_TYPE_CG2DC2, ATOM_TYPE_HGA4, 119.500000, 435.136000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2O4, ATOM_TYPE_CG2DC2, ATOM_TYPE_HGA4, 122.000000, 267.776000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2O5, ATOM_TYPE_CG2DC2, ATOM_TYPE_HGA4, 123.400000, 267.776000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_CG2DC2, ATOM_TYPE_NG2D1, 117.000000, 468.608000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_CG2DC2, ATOM_TYPE_HGA4, 120.000000, 267.776000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG321, ATOM_TYPE_CG2DC2, ATOM_TYPE_CG331, 123.500000, 401.664000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG321, ATOM_TYPE_CG2DC2, ATOM_TYPE_HGA4, 116.000000, 334.720000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG331, ATOM_TYPE_CG2DC2, ATOM_TYPE_CG331, 113.000000, 393.296000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG331, ATOM_TYPE_CG2DC2, ATOM_TYPE_HGA4, 117.500000, 351.456000, 0.00000000, 0.00},
+     {ATOM_TYPE_NG2D1, ATOM_TYPE_CG2DC2, ATOM_TYPE_HGA4, 123.000000, 317.984000, 0.00000000, 0.00},
+     {ATOM_TYPE_NG2P1, ATOM_TYPE_CG2DC2, ATOM_TYPE_HGR52, 114.000000, 317.984000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG251O, ATOM_TYPE_CG2DC3, ATOM_TYPE_HGA5, 120.500000, 292.880000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG252O, ATOM_TYPE_CG2DC3, ATOM_TYPE_HGA5, 120.500000, 292.880000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG25C1, ATOM_TYPE_CG2DC3, ATOM_TYPE_HGA5, 120.500000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG25C2, ATOM_TYPE_CG2DC3, ATOM_TYPE_HGA5, 120.500000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2DC1, ATOM_TYPE_CG2DC3, ATOM_TYPE_HGA5, 120.500000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2DC2, ATOM_TYPE_CG2DC3, ATOM_TYPE_HGA5, 120.500000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_HGA5, ATOM_TYPE_CG2DC3, ATOM_TYPE_HGA5, 119.000000, 158.992000, 0.00000000, 0.00},
+     {ATOM_TYPE_NG2D1, ATOM_TYPE_CG2N1, ATOM_TYPE_NG311, 125.000000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_NG2D1, ATOM_TYPE_CG2N1, ATOM_TYPE_NG321, 125.000000, 836.800000, 0.00000000, 0.00},
+     {ATOM_TYPE_NG2P1, ATOM_TYPE_CG2N1, ATOM_TYPE_NG2P1, 120.000000, 435.136000, 0.23642000, 75312.00},
+     {ATOM_TYPE_NG311, ATOM_TYPE_CG2N1, ATOM_TYPE_NG321, 113.000000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_NG321, ATOM_TYPE_CG2N1, ATOM_TYPE_NG321, 113.000000, 627.600000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_CG2N2, ATOM_TYPE_NG2P1, 118.500000, 669.440000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG331, ATOM_TYPE_CG2N2, ATOM_TYPE_NG2P1, 118.500000, 435.136000, 0.00000000, 0.00},
+     {ATOM_TYPE_NG2P1, ATOM_TYPE_CG2N2, ATOM_TYPE_NG2P1, 123.000000, 435.136000, 0.23642000, 75312.00},
+     {ATOM_TYPE_CG2DC1, ATOM_TYPE_CG2O1, ATOM_TYPE_NG2S1, 116.500000, 669.440000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2DC1, ATOM_TYPE_CG2O1, ATOM_TYPE_NG2S2, 113.000000, 711.280000, 0.24600000, 66944.00},
+     {ATOM_TYPE_CG2DC1, ATOM_TYPE_CG2O1, ATOM_TYPE_OG2D1, 122.500000, 669.440000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2DC2, ATOM_TYPE_CG2O1, ATOM_TYPE_NG2S1, 116.500000, 669.440000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2DC2, ATOM_TYPE_CG2O1, ATOM_TYPE_NG2S2, 113.000000, 711.280000, 0.24600000, 66944.00},
+     {ATOM_TYPE_CG2DC2, ATOM_TYPE_CG2O1, ATOM_TYPE_OG2D1, 122.500000, 669.440000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_CG2O1, ATOM_TYPE_NG2S1, 116.500000, 669.440000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_CG2O1, ATOM_TYPE_NG2S2, 110.230000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_CG2O1, ATOM_TYPE_OG2D1, 121.000000, 251.040000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R62, ATOM_TYPE_CG2O1, ATOM_TYPE_NG2S2, 113.000000, 711.280000, 0.24600000, 66944.00},
+     {ATOM_TYPE_CG2R62, ATOM_TYPE_CG2O1, ATOM_TYPE_OG2D1, 118.500000, 711.280000, 0.24300000, 16736.00},
+     {ATOM_TYPE_CG311, ATOM_TYPE_CG2O1, ATOM_TYPE_NG2S0, 112.500000, 167.360000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG311, ATOM_TYPE_CG2O1, ATOM_TYPE_NG2S1, 116.500000, 669.440000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG311, ATOM_TYPE_CG2O1, ATOM_TYPE_NG2S2, 116.500000, 418.400000, 0.24500000, 41840.00},
+     {ATOM_TYPE_CG311, ATOM_TYPE_CG2O1, ATOM_TYPE_OG2D1, 121.000000, 669.440000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG314, ATOM_TYPE_CG2O1, ATOM_TYPE_NG2S0, 112.500000, 167.360000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG314, ATOM_TYPE_CG2O1, ATOM_TYPE_NG2S1, 116.500000, 669.440000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG314, ATOM_TYPE_CG2O1, ATOM_TYPE_NG2S2, 116.500000, 418.400000, 0.24500000, 41840.00},
+     {ATOM_TYPE_CG314, ATOM_TYPE_CG2O1, ATOM_TYPE_OG2D1, 121.000000, 669.440000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG321, ATOM_TYPE_CG2O1, ATOM_TYPE_NG2S0, 112.500000, 167.360000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG321, ATOM_TYPE_CG2O1, ATOM_TYPE_NG2S1, 116.500000, 669.440000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG321, ATOM_TYPE_CG2O1, ATOM_TYPE_NG2S2, 116.500000, 418.400000, 0.24500000, 41840.00},
+     {ATOM_TYPE_CG321, ATOM_TYPE_CG2O1, ATOM_TYPE_OG2D1, 121.000000, 669.440000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG324, ATOM_TYPE_CG2O1, ATOM_TYPE_NG2S0, 112.500000, 167.360000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG324, ATOM_TYPE_CG2O1, ATOM_TYPE_NG2S1, 116.500000, 669.440000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG324, ATOM_TYPE_CG2O1, ATOM_TYPE_NG2S2, 116.500000, 418.400000, 0.24500000, 41840.00},
+     {ATOM_TYPE_CG324, ATOM_TYPE_CG2O1, ATOM_TYPE_OG2D1, 121.000000, 669.440000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG331, ATOM_TYPE_CG2O1, ATOM_TYPE_NG2S0, 115.000000, 334.720000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG331, ATOM_TYPE_CG2O1, ATOM_TYPE_NG2S1, 116.500000, 669.440000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG331, ATOM_TYPE_CG2O1, ATOM_TYPE_NG2S2, 116.500000, 418.400000, 0.24500000, 41840.00},
+     {ATOM_TYPE_CG331, ATOM_TYPE_CG2O1, ATOM_TYPE_OG2D1, 121.000000, 669.440000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3C51, ATOM_TYPE_CG2O1, ATOM_TYPE_NG2S0, 112.500000, 167.360000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3C51, ATOM_TYPE_CG2O1, ATOM_TYPE_NG2S1, 116.500000, 669.440000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3C51, ATOM_TYPE_CG2O1, ATOM_TYPE_NG2S2, 112.500000, 669.440000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3C51, ATOM_TYPE_CG2O1, ATOM_TYPE_OG2D1, 118.000000, 669.440000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3C53, ATOM_TYPE_CG2O1, ATOM_TYPE_NG2S0, 112.500000, 167.360000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3C53, ATOM_TYPE_CG2O1, ATOM_TYPE_NG2S1, 116.500000, 669.440000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3C53, ATOM_TYPE_CG2O1, ATOM_TYPE_NG2S2, 112.500000, 669.440000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3C53, ATOM_TYPE_CG2O1, ATOM_TYPE_OG2D1, 118.000000, 669.440000, 0.00000000, 0.00},
+     {ATOM_TYPE_NG2S0, ATOM_TYPE_CG2O1, ATOM_TYPE_OG2D1, 124.000000, 669.440000, 0.00000000, 0.00},
+     {ATOM_TYPE_NG2S0, ATOM_TYPE_CG2O1, ATOM_TYPE_HGR52, 115.000000, 359.824000, 0.00000000, 0.00},
+     {ATOM_TYPE_NG2S1, ATOM_TYPE_CG2O1, ATOM_TYPE_OG2D1, 122.500000, 669.440000, 0.00000000, 0.00},
+     {ATOM_TYPE_NG2S2, ATOM_TYPE_CG2O1, ATOM_TYPE_OG2D1, 122.500000, 627.600000, 0.23700000, 41840.00},
+     {ATOM_TYPE_NG2S2, ATOM_TYPE_CG2O1, ATOM_TYPE_HGR52, 111.000000, 368.192000, 0.19800000, 41840.00},
+     {ATOM_TYPE_OG2D1, ATOM_TYPE_CG2O1, ATOM_TYPE_HGR52, 122.000000, 368.192000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_CG2O2, ATOM_TYPE_OG2D1, 123.100000, 585.760000, 0.24420000, 16736.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_CG2O2, ATOM_TYPE_OG302, 111.000000, 418.400000, 0.23600000, 16736.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_CG2O2, ATOM_TYPE_OG311, 113.900000, 334.720000, 0.23700000, 25104.00},
+     {ATOM_TYPE_CG311, ATOM_TYPE_CG2O2, ATOM_TYPE_OG2D1, 125.000000, 585.760000, 0.24420000, 16736.00},
+     {ATOM_TYPE_CG311, ATOM_TYPE_CG2O2, ATOM_TYPE_OG302, 109.000000, 460.240000, 0.23260000, 16736.00},
+     {ATOM_TYPE_CG311, ATOM_TYPE_CG2O2, ATOM_TYPE_OG311, 110.500000, 460.240000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG321, ATOM_TYPE_CG2O2, ATOM_TYPE_OG2D1, 125.000000, 585.760000, 0.24420000, 16736.00},
+     {ATOM_TYPE_CG321, ATOM_TYPE_CG2O2, ATOM_TYPE_OG302, 109.000000, 460.240000, 0.23260000, 16736.00},
+     {ATOM_TYPE_CG321, ATOM_TYPE_CG2O2, ATOM_TYPE_OG311, 110.500000, 460.240000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG331, ATOM_TYPE_CG2O2, ATOM_TYPE_OG2D1, 125.000000, 585.760000, 0.24420000, 16736.00},
+     {ATOM_TYPE_CG331, ATOM_TYPE_CG2O2, ATOM_TYPE_OG302, 109.000000, 460.240000, 0.23260000, 16736.00},
+     {ATOM_TYPE_CG331, ATOM_TYPE_CG2O2, ATOM_TYPE_OG311, 110.500000, 460.240000, 0.00000000, 0.00},
+     {ATOM_TYPE_OG2D1, ATOM_TYPE_CG2O2, ATOM_TYPE_OG302, 125.900000, 753.120000, 0.22576000, 133888.00},
+     {ATOM_TYPE_OG2D1, ATOM_TYPE_CG2O2, ATOM_TYPE_OG311, 123.000000, 418.400000, 0.22620000, 175728.00},
+     {ATOM_TYPE_OG2D1, ATOM_TYPE_CG2O2, ATOM_TYPE_HGR52, 119.000000, 326.352000, 0.00000000, 0.00},
+     {ATOM_TYPE_OG311, ATOM_TYPE_CG2O2, ATOM_TYPE_HGR52, 105.000000, 393.296000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2DC1, ATOM_TYPE_CG2O3, ATOM_TYPE_OG2D2, 116.000000, 334.720000, 0.23530000, 41840.00},
+     {ATOM_TYPE_CG2DC2, ATOM_TYPE_CG2O3, ATOM_TYPE_OG2D2, 116.000000, 334.720000, 0.23530000, 41840.00},
+     {ATOM_TYPE_CG2O5, ATOM_TYPE_CG2O3, ATOM_TYPE_OG2D2, 116.000000, 794.960000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_CG2O3, ATOM_TYPE_OG2D2, 116.000000, 334.720000, 0.23530000, 41840.00},
+     {ATOM_TYPE_CG301, ATOM_TYPE_CG2O3, ATOM_TYPE_OG2D2, 116.000000, 334.720000, 0.23530000, 41840.00},
+     {ATOM_TYPE_CG311, ATOM_TYPE_CG2O3, ATOM_TYPE_OG2D2, 116.000000, 334.720000, 0.23530000, 41840.00},
+     {ATOM_TYPE_CG314, ATOM_TYPE_CG2O3, ATOM_TYPE_OG2D2, 116.000000, 334.720000, 0.23530000, 41840.00},
+     {ATOM_TYPE_CG321, ATOM_TYPE_CG2O3, ATOM_TYPE_OG2D2, 116.000000, 334.720000, 0.23530000, 41840.00},
+     {ATOM_TYPE_CG324, ATOM_TYPE_CG2O3, ATOM_TYPE_OG2D2, 116.000000, 334.720000, 0.23530000, 41840.00},
+     {ATOM_TYPE_CG331, ATOM_TYPE_CG2O3, ATOM_TYPE_OG2D2, 116.000000, 334.720000, 0.23530000, 41840.00},
+     {ATOM_TYPE_CG3C51, ATOM_TYPE_CG2O3, ATOM_TYPE_OG2D2, 116.000000, 334.720000, 0.23530000, 41840.00},
+     {ATOM_TYPE_CG3C53, ATOM_TYPE_CG2O3, ATOM_TYPE_OG2D2, 116.000000, 334.720000, 0.23530000, 41840.00},
+     {ATOM_TYPE_OG2D2, ATOM_TYPE_CG2O3, ATOM_TYPE_OG2D2, 128.000000, 836.800000, 0.22587000, 58576.00},
+     {ATOM_TYPE_OG2D2, ATOM_TYPE_CG2O3, ATOM_TYPE_HGR52, 116.000000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2DC1, ATOM_TYPE_CG2O4, ATOM_TYPE_OG2D1, 126.000000, 627.600000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2DC1, ATOM_TYPE_CG2O4, ATOM_TYPE_HGR52, 116.000000, 125.520000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2DC2, ATOM_TYPE_CG2O4, ATOM_TYPE_OG2D1, 126.000000, 627.600000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2DC2, ATOM_TYPE_CG2O4, ATOM_TYPE_HGR52, 116.000000, 125.520000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_CG2O4, ATOM_TYPE_OG2D1, 126.000000, 627.600000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_CG2O4, ATOM_TYPE_HGR52, 116.000000, 125.520000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG321, ATOM_TYPE_CG2O4, ATOM_TYPE_OG2D1, 126.000000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG321, ATOM_TYPE_CG2O4, ATOM_TYPE_HGR52, 116.000000, 543.920000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG331, ATOM_TYPE_CG2O4, ATOM_TYPE_OG2D1, 126.000000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG331, ATOM_TYPE_CG2O4, ATOM_TYPE_HGR52, 116.000000, 543.920000, 0.00000000, 0.00},
+     {ATOM_TYPE_OG2D1, ATOM_TYPE_CG2O4, ATOM_TYPE_HGR52, 118.000000, 543.920000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2DC1, ATOM_TYPE_CG2O5, ATOM_TYPE_CG331, 116.000000, 292.880000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2DC1, ATOM_TYPE_CG2O5, ATOM_TYPE_OG2D3, 121.800000, 585.760000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2DC2, ATOM_TYPE_CG2O5, ATOM_TYPE_CG331, 116.000000, 292.880000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2DC2, ATOM_TYPE_CG2O5, ATOM_TYPE_OG2D3, 121.800000, 585.760000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2O3, ATOM_TYPE_CG2O5, ATOM_TYPE_CG2R61, 117.200000, 334.720000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2O3, ATOM_TYPE_CG2O5, ATOM_TYPE_OG2D3, 121.500000, 794.960000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_CG2O5, ATOM_TYPE_CG311, 117.200000, 334.720000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_CG2O5, ATOM_TYPE_CG321, 116.500000, 167.360000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_CG2O5, ATOM_TYPE_CG331, 116.500000, 502.080000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_CG2O5, ATOM_TYPE_OG2D3, 121.300000, 585.760000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG311, ATOM_TYPE_CG2O5, ATOM_TYPE_OG2D3, 121.500000, 794.960000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG321, ATOM_TYPE_CG2O5, ATOM_TYPE_CG321, 115.600000, 292.880000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG321, ATOM_TYPE_CG2O5, ATOM_TYPE_CG331, 115.600000, 292.880000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG321, ATOM_TYPE_CG2O5, ATOM_TYPE_OG2D3, 122.200000, 627.600000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG331, ATOM_TYPE_CG2O5, ATOM_TYPE_CG331, 115.600000, 292.880000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG331, ATOM_TYPE_CG2O5, ATOM_TYPE_OG2D3, 122.200000, 627.600000, 0.00000000, 0.00},
+     {ATOM_TYPE_NG2S1, ATOM_TYPE_CG2O6, ATOM_TYPE_OG2D1, 125.700000, 502.080000, 0.00000000, 0.00},
+     {ATOM_TYPE_NG2S1, ATOM_TYPE_CG2O6, ATOM_TYPE_OG302, 110.300000, 753.120000, 0.00000000, 0.00},
+     {ATOM_TYPE_NG2S2, ATOM_TYPE_CG2O6, ATOM_TYPE_NG2S2, 115.000000, 585.760000, 0.00000000, 0.00},
+     {ATOM_TYPE_NG2S2, ATOM_TYPE_CG2O6, ATOM_TYPE_OG2D1, 122.500000, 627.600000, 0.23700000, 41840.00},
+     {ATOM_TYPE_OG2D1, ATOM_TYPE_CG2O6, ATOM_TYPE_OG302, 123.500000, 585.760000, 0.00000000, 0.00},
+     {ATOM_TYPE_OG2D2, ATOM_TYPE_CG2O6, ATOM_TYPE_OG2D2, 120.000000, 334.720000, 0.22412700, 83261.60},
+     {ATOM_TYPE_OG302, ATOM_TYPE_CG2O6, ATOM_TYPE_OG302, 105.000000, 711.280000, 0.00000000, 0.00},
+     {ATOM_TYPE_SG2D1, ATOM_TYPE_CG2O6, ATOM_TYPE_SG311, 124.000000, 585.760000, 0.00000000, 0.00},
+     {ATOM_TYPE_SG311, ATOM_TYPE_CG2O6, ATOM_TYPE_SG311, 112.000000, 334.720000, 0.00000000, 0.00},
+     {ATOM_TYPE_OG2D5, ATOM_TYPE_CG2O7, ATOM_TYPE_OG2D5, 180.000000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R51, ATOM_TYPE_CG2R51, ATOM_TYPE_CG2R51, 107.200000, 753.120000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R51, ATOM_TYPE_CG2R51, ATOM_TYPE_CG2R52, 106.000000, 753.120000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R51, ATOM_TYPE_CG2R51, ATOM_TYPE_CG2RC0, 105.700000, 711.280000, 0.22610000, 20920.00},
+     {ATOM_TYPE_CG2R51, ATOM_TYPE_CG2R51, ATOM_TYPE_CG2RC7, 106.900000, 585.760000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R51, ATOM_TYPE_CG2R51, ATOM_TYPE_CG321, 130.000000, 383.254400, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R51, ATOM_TYPE_CG2R51, ATOM_TYPE_CG331, 130.000000, 383.254400, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R51, ATOM_TYPE_CG2R51, ATOM_TYPE_CG3C52, 109.000000, 962.320000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R51, ATOM_TYPE_CG2R51, ATOM_TYPE_CG3C54, 109.000000, 962.320000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R51, ATOM_TYPE_CG2R51, ATOM_TYPE_NG2R50, 110.000000, 1087.840000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R51, ATOM_TYPE_CG2R51, ATOM_TYPE_NG2R51, 106.000000, 1087.840000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R51, ATOM_TYPE_CG2R51, ATOM_TYPE_NG2R52, 108.000000, 1213.360000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R51, ATOM_TYPE_CG2R51, ATOM_TYPE_NG2RC0, 108.200000, 1087.840000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R51, ATOM_TYPE_CG2R51, ATOM_TYPE_NG3C51, 111.800000, 878.640000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R51, ATOM_TYPE_CG2R51, ATOM_TYPE_NG3P2, 111.000000, 1004.160000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R51, ATOM_TYPE_CG2R51, ATOM_TYPE_OG2R50, 111.700000, 1087.840000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R51, ATOM_TYPE_CG2R51, ATOM_TYPE_OG3C51, 113.200000, 1129.680000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R51, ATOM_TYPE_CG2R51, ATOM_TYPE_SG2R50, 109.000000, 878.640000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R51, ATOM_TYPE_CG2R51, ATOM_TYPE_HGR51, 126.400000, 267.776000, 0.21730000, 20920.00},
+     {ATOM_TYPE_CG2R51, ATOM_TYPE_CG2R51, ATOM_TYPE_HGR52, 130.000000, 184.096000, 0.22150000, 12552.00},
+     {ATOM_TYPE_CG2R52, ATOM_TYPE_CG2R51, ATOM_TYPE_HGR51, 127.600000, 125.520000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2RC0, ATOM_TYPE_CG2R51, ATOM_TYPE_CG321, 126.700000, 251.040000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2RC0, ATOM_TYPE_CG2R51, ATOM_TYPE_CG331, 126.700000, 251.040000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2RC0, ATOM_TYPE_CG2R51, ATOM_TYPE_NG2R51, 107.500000, 836.800000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2RC0, ATOM_TYPE_CG2R51, ATOM_TYPE_HGR51, 126.400000, 267.776000, 0.22550000, 20920.00},
+     {ATOM_TYPE_CG2RC0, ATOM_TYPE_CG2R51, ATOM_TYPE_HGR52, 128.500000, 259.408000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2RC7, ATOM_TYPE_CG2R51, ATOM_TYPE_HGR51, 126.700000, 267.776000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG321, ATOM_TYPE_CG2R51, ATOM_TYPE_NG2R50, 120.000000, 383.254400, 0.00000000, 0.00},
+     {ATOM_TYPE_CG321, ATOM_TYPE_CG2R51, ATOM_TYPE_NG2R51, 124.000000, 383.254400, 0.00000000, 0.00},
+     {ATOM_TYPE_CG321, ATOM_TYPE_CG2R51, ATOM_TYPE_NG2R52, 122.000000, 383.254400, 0.00000000, 0.00},
+     {ATOM_TYPE_CG331, ATOM_TYPE_CG2R51, ATOM_TYPE_NG2R51, 124.000000, 383.254400, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3C52, ATOM_TYPE_CG2R51, ATOM_TYPE_HGR51, 124.600000, 242.672000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3C54, ATOM_TYPE_CG2R51, ATOM_TYPE_HGR51, 124.600000, 108.784000, 0.00000000, 0.00},
+     {ATOM_TYPE_NG2R50, ATOM_TYPE_CG2R51, ATOM_TYPE_HGR52, 120.000000, 209.200000, 0.21400000, 16736.00},
+     {ATOM_TYPE_NG2R51, ATOM_TYPE_CG2R51, ATOM_TYPE_HGR52, 124.000000, 209.200000, 0.21400000, 16736.00},
+     {ATOM_TYPE_NG2R52, ATOM_TYPE_CG2R51, ATOM_TYPE_HGR52, 122.000000, 184.096000, 0.21800000, 12552.00},
+     {ATOM_TYPE_NG2RC0, ATOM_TYPE_CG2R51, ATOM_TYPE_HGR52, 121.800000, 259.408000, 0.00000000, 0.00},
+     {ATOM_TYPE_NG3C51, ATOM_TYPE_CG2R51, ATOM_TYPE_HGR52, 118.200000, 292.880000, 0.00000000, 0.00},
+     {ATOM_TYPE_NG3P2, ATOM_TYPE_CG2R51, ATOM_TYPE_HGR52, 119.000000, 292.880000, 0.00000000, 0.00},
+     {ATOM_TYPE_OG2R50, ATOM_TYPE_CG2R51, ATOM_TYPE_HGR52, 118.300000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_OG3C51, ATOM_TYPE_CG2R51, ATOM_TYPE_HGR52, 116.800000, 326.352000, 0.00000000, 0.00},
+     {ATOM_TYPE_SG2R50, ATOM_TYPE_CG2R51, ATOM_TYPE_HGR52, 121.000000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R51, ATOM_TYPE_CG2R52, ATOM_TYPE_NG2R50, 110.500000, 920.480000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R51, ATOM_TYPE_CG2R52, ATOM_TYPE_NG2R52, 110.000000, 1012.528000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R51, ATOM_TYPE_CG2R52, ATOM_TYPE_HGR52, 126.500000, 267.776000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2RC0, ATOM_TYPE_CG2R52, ATOM_TYPE_NG2R50, 110.400000, 1255.200000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2RC0, ATOM_TYPE_CG2R52, ATOM_TYPE_HGR52, 126.600000, 267.776000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3C52, ATOM_TYPE_CG2R52, ATOM_TYPE_NG2R50, 112.000000, 1422.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3C52, ATOM_TYPE_CG2R52, ATOM_TYPE_HGR52, 125.000000, 393.296000, 0.00000000, 0.00},
+     {ATOM_TYPE_NG2R50, ATOM_TYPE_CG2R52, ATOM_TYPE_HGR52, 123.000000, 267.776000, 0.00000000, 0.00},
+     {ATOM_TYPE_NG2R52, ATOM_TYPE_CG2R52, ATOM_TYPE_HGR52, 123.500000, 292.880000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG251O, ATOM_TYPE_CG2R53, ATOM_TYPE_NG2R53, 108.500000, 460.240000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG251O, ATOM_TYPE_CG2R53, ATOM_TYPE_OG2D1, 124.500000, 460.240000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG252O, ATOM_TYPE_CG2R53, ATOM_TYPE_NG2R53, 108.500000, 460.240000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG252O, ATOM_TYPE_CG2R53, ATOM_TYPE_OG2D1, 124.500000, 460.240000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG25C1, ATOM_TYPE_CG2R53, ATOM_TYPE_NG2R51, 107.000000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG25C1, ATOM_TYPE_CG2R53, ATOM_TYPE_OG2D1, 125.500000, 460.240000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG25C2, ATOM_TYPE_CG2R53, ATOM_TYPE_NG2R51, 107.000000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG25C2, ATOM_TYPE_CG2R53, ATOM_TYPE_OG2D1, 125.500000, 460.240000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3C41, ATOM_TYPE_CG2R53, ATOM_TYPE_NG2R43, 104.500000, 1004.160000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3C41, ATOM_TYPE_CG2R53, ATOM_TYPE_OG2D1, 135.700000, 502.080000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3C52, ATOM_TYPE_CG2R53, ATOM_TYPE_NG2R53, 105.500000, 1004.160000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3C52, ATOM_TYPE_CG2R53, ATOM_TYPE_OG2D1, 126.700000, 543.920000, 0.00000000, 0.00},
+     {ATOM_TYPE_NG2R43, ATOM_TYPE_CG2R53, ATOM_TYPE_OG2D1, 134.300000, 502.080000, 0.00000000, 0.00},
+     {ATOM_TYPE_NG2R50, ATOM_TYPE_CG2R53, ATOM_TYPE_NG2R50, 111.000000, 836.800000, 0.00000000, 0.00},
+     {ATOM_TYPE_NG2R50, ATOM_TYPE_CG2R53, ATOM_TYPE_NG2R51, 113.000000, 836.800000, 0.00000000, 0.00},
+     {ATOM_TYPE_NG2R50, ATOM_TYPE_CG2R53, ATOM_TYPE_NG3C51, 117.400000, 1338.880000, 0.00000000, 0.00},
+     {ATOM_TYPE_NG2R50, ATOM_TYPE_CG2R53, ATOM_TYPE_OG2R50, 115.700000, 1004.160000, 0.00000000, 0.00},
+     {ATOM_TYPE_NG2R50, ATOM_TYPE_CG2R53, ATOM_TYPE_SG2R50, 117.200000, 920.480000, 0.00000000, 0.00},
+     {ATOM_TYPE_NG2R50, ATOM_TYPE_CG2R53, ATOM_TYPE_HGR52, 124.800000, 326.352000, 0.00000000, 0.00},
+     {ATOM_TYPE_NG2R51, ATOM_TYPE_CG2R53, ATOM_TYPE_OG2D1, 127.500000, 585.760000, 0.00000000, 0.00},
+     {ATOM_TYPE_NG2R51, ATOM_TYPE_CG2R53, ATOM_TYPE_HGR52, 122.200000, 334.720000, 0.00000000, 0.00},
+     {ATOM_TYPE_NG2R52, ATOM_TYPE_CG2R53, ATOM_TYPE_NG2R52, 108.000000, 1213.360000, 0.00000000, 0.00},
+     {ATOM_TYPE_NG2R52, ATOM_TYPE_CG2R53, ATOM_TYPE_HGR53, 126.000000, 267.776000, 0.21400000, 20920.00},
+     {ATOM_TYPE_NG2R53, ATOM_TYPE_CG2R53, ATOM_TYPE_NG2R53, 104.400000, 627.600000, 0.00000000, 0.00},
+     {ATOM_TYPE_NG2R53, ATOM_TYPE_CG2R53, ATOM_TYPE_OG2D1, 127.800000, 543.920000, 0.00000000, 0.00},
+     {ATOM_TYPE_NG2R53, ATOM_TYPE_CG2R53, ATOM_TYPE_SG2D1, 127.000000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_NG2R53, ATOM_TYPE_CG2R53, ATOM_TYPE_SG311, 109.000000, 585.760000, 0.00000000, 0.00},
+     {ATOM_TYPE_NG3C51, ATOM_TYPE_CG2R53, ATOM_TYPE_HGR52, 117.800000, 267.776000, 0.00000000, 0.00},
+     {ATOM_TYPE_OG2D1, ATOM_TYPE_CG2R53, ATOM_TYPE_SG311, 125.000000, 460.240000, 0.00000000, 0.00},
+     {ATOM_TYPE_OG2R50, ATOM_TYPE_CG2R53, ATOM_TYPE_HGR52, 119.500000, 209.200000, 0.21400000, 16736.00},
+     {ATOM_TYPE_SG2D1, ATOM_TYPE_CG2R53, ATOM_TYPE_SG311, 124.000000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_SG2R50, ATOM_TYPE_CG2R53, ATOM_TYPE_HGR52, 118.000000, 251.040000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG1N1, ATOM_TYPE_CG2R61, ATOM_TYPE_CG2R61, 120.000000, 292.880000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2DC1, ATOM_TYPE_CG2R61, ATOM_TYPE_CG2R61, 120.000000, 301.248000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2DC2, ATOM_TYPE_CG2R61, ATOM_TYPE_CG2R61, 120.000000, 301.248000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2N2, ATOM_TYPE_CG2R61, ATOM_TYPE_CG2R61, 120.000000, 209.200000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2O1, ATOM_TYPE_CG2R61, ATOM_TYPE_CG2R61, 119.000000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2O1, ATOM_TYPE_CG2R61, ATOM_TYPE_CG2RC0, 120.000000, 502.080000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2O2, ATOM_TYPE_CG2R61, ATOM_TYPE_CG2R61, 120.000000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2O3, ATOM_TYPE_CG2R61, ATOM_TYPE_CG2R61, 119.000000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2O4, ATOM_TYPE_CG2R61, ATOM_TYPE_CG2R61, 119.800000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2O5, ATOM_TYPE_CG2R61, ATOM_TYPE_CG2R61, 120.000000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_CG2R61, ATOM_TYPE_CG2R61, 120.000000, 334.720000, 0.24162000, 29288.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_CG2R61, ATOM_TYPE_CG2R64, 115.500000, 334.720000, 0.24162000, 29288.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_CG2R61, ATOM_TYPE_CG2R66, 119.000000, 334.720000, 0.24162000, 29288.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_CG2R61, ATOM_TYPE_CG2R67, 120.000000, 334.720000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_CG2R61, ATOM_TYPE_CG2RC0, 120.000000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_CG2R61, ATOM_TYPE_CG311, 120.000000, 383.254400, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_CG2R61, ATOM_TYPE_CG312, 120.000000, 383.254400, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_CG2R61, ATOM_TYPE_CG321, 120.000000, 383.254400, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_CG2R61, ATOM_TYPE_CG324, 120.000000, 383.254400, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_CG2R61, ATOM_TYPE_CG331, 120.000000, 383.254400, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_CG2R61, ATOM_TYPE_NG2O1, 120.000000, 167.360000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_CG2R61, ATOM_TYPE_NG2R60, 124.000000, 167.360000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_CG2R61, ATOM_TYPE_NG2R62, 124.000000, 167.360000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_CG2R61, ATOM_TYPE_NG2RC0, 121.400000, 836.800000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_CG2R61, ATOM_TYPE_NG2S1, 120.000000, 334.720000, 0.24162000, 29288.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_CG2R61, ATOM_TYPE_NG2S3, 121.000000, 502.080000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_CG2R61, ATOM_TYPE_NG311, 120.000000, 334.720000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_CG2R61, ATOM_TYPE_NG3N1, 122.000000, 401.664000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_CG2R61, ATOM_TYPE_OG301, 120.000000, 920.480000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_CG2R61, ATOM_TYPE_OG303, 120.000000, 627.600000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_CG2R61, ATOM_TYPE_OG311, 120.000000, 378.233600, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_CG2R61, ATOM_TYPE_OG312, 120.000000, 334.720000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_CG2R61, ATOM_TYPE_OG3R60, 120.000000, 334.720000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_CG2R61, ATOM_TYPE_SG311, 120.000000, 334.720000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_CG2R61, ATOM_TYPE_SG3O1, 122.300000, 83.680000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_CG2R61, ATOM_TYPE_SG3O2, 119.000000, 292.880000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_CG2R61, ATOM_TYPE_CLGR1, 120.000000, 502.080000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_CG2R61, ATOM_TYPE_BRGR1, 120.000000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_CG2R61, ATOM_TYPE_IGR1, 120.000000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_CG2R61, ATOM_TYPE_HGR61, 120.000000, 251.040000, 0.21525000, 18409.60},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_CG2R61, ATOM_TYPE_HGR62, 120.000000, 251.040000, 0.21525000, 18409.60},
+     {ATOM_TYPE_CG2R64, ATOM_TYPE_CG2R61, ATOM_TYPE_NG2R60, 123.400000, 167.360000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R64, ATOM_TYPE_CG2R61, ATOM_TYPE_OG311, 120.000000, 378.233600, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R64, ATOM_TYPE_CG2R61, ATOM_TYPE_HGR61, 120.000000, 251.040000, 0.21525000, 18409.60},
+     {ATOM_TYPE_CG2R66, ATOM_TYPE_CG2R61, ATOM_TYPE_CG2R66, 117.000000, 334.720000, 0.24162000, 29288.00},
+     {ATOM_TYPE_CG2R66, ATOM_TYPE_CG2R61, ATOM_TYPE_CG331, 120.000000, 383.254400, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R66, ATOM_TYPE_CG2R61, ATOM_TYPE_NG2R60, 124.000000, 167.360000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R66, ATOM_TYPE_CG2R61, ATOM_TYPE_NG2S1, 120.000000, 334.720000, 0.24162000, 29288.00},
+     {ATOM_TYPE_CG2R66, ATOM_TYPE_CG2R61, ATOM_TYPE_HGR62, 121.500000, 251.040000, 0.21525000, 18409.60},
+     {ATOM_TYPE_CG2R67, ATOM_TYPE_CG2R61, ATOM_TYPE_NG2R60, 124.000000, 167.360000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R67, ATOM_TYPE_CG2R61, ATOM_TYPE_HGR61, 120.000000, 251.040000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R67, ATOM_TYPE_CG2R61, ATOM_TYPE_HGR62, 120.000000, 251.040000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2RC0, ATOM_TYPE_CG2R61, ATOM_TYPE_NG2R62, 119.000000, 167.360000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2RC0, ATOM_TYPE_CG2R61, ATOM_TYPE_HGR61, 120.000000, 251.040000, 0.21460000, 18409.60},
+     {ATOM_TYPE_CG2RC0, ATOM_TYPE_CG2R61, ATOM_TYPE_HGR62, 121.500000, 251.040000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG321, ATOM_TYPE_CG2R61, ATOM_TYPE_NG2R60, 122.300000, 383.254400, 0.00000000, 0.00},
+     {ATOM_TYPE_CG331, ATOM_TYPE_CG2R61, ATOM_TYPE_NG2R60, 122.300000, 383.254400, 0.00000000, 0.00},
+     {ATOM_TYPE_NG2R60, ATOM_TYPE_CG2R61, ATOM_TYPE_BRGR1, 120.000000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_NG2R60, ATOM_TYPE_CG2R61, ATOM_TYPE_HGR62, 116.000000, 251.040000, 0.21000000, 29288.00},
+     {ATOM_TYPE_NG2R62, ATOM_TYPE_CG2R61, ATOM_TYPE_HGR62, 116.000000, 251.040000, 0.21000000, 29288.00},
+     {ATOM_TYPE_NG2RC0, ATOM_TYPE_CG2R61, ATOM_TYPE_HGR62, 118.600000, 251.040000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2O1, ATOM_TYPE_CG2R62, ATOM_TYPE_CG2R62, 131.800000, 83.680000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R62, ATOM_TYPE_CG2R62, ATOM_TYPE_CG2R62, 118.000000, 334.720000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R62, ATOM_TYPE_CG2R62, ATOM_TYPE_CG2R63, 116.700000, 1004.160000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R62, ATOM_TYPE_CG2R62, ATOM_TYPE_CG2R64, 117.800000, 711.280000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R62, ATOM_TYPE_CG2R62, ATOM_TYPE_CG331, 124.200000, 334.720000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R62, ATOM_TYPE_CG2R62, ATOM_TYPE_NG2R61, 122.900000, 711.280000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R62, ATOM_TYPE_CG2R62, ATOM_TYPE_HGR62, 119.000000, 351.456000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R62, ATOM_TYPE_CG2R62, ATOM_TYPE_HGR63, 120.500000, 669.440000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R63, ATOM_TYPE_CG2R62, ATOM_TYPE_CG331, 118.700000, 317.984000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R63, ATOM_TYPE_CG2R62, ATOM_TYPE_HGR62, 120.300000, 251.040000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R64, ATOM_TYPE_CG2R62, ATOM_TYPE_HGR62, 120.100000, 317.984000, 0.00000000, 0.00},
+     {ATOM_TYPE_NG2R61, ATOM_TYPE_CG2R62, ATOM_TYPE_HGR62, 115.000000, 368.192000, 0.00000000, 0.00},
+     {ATOM_TYPE_NG2R61, ATOM_TYPE_CG2R62, ATOM_TYPE_HGR63, 117.500000, 669.440000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R62, ATOM_TYPE_CG2R63, ATOM_TYPE_NG2R61, 113.500000, 585.760000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R62, ATOM_TYPE_CG2R63, ATOM_TYPE_OG2D4, 124.600000, 836.800000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2RC0, ATOM_TYPE_CG2R63, ATOM_TYPE_NG2R61, 107.800000, 585.760000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2RC0, ATOM_TYPE_CG2R63, ATOM_TYPE_OG2D4, 124.700000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_NG2R61, ATOM_TYPE_CG2R63, ATOM_TYPE_NG2R61, 114.000000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_NG2R61, ATOM_TYPE_CG2R63, ATOM_TYPE_NG2R62, 116.800000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_NG2R61, ATOM_TYPE_CG2R63, ATOM_TYPE_OG2D4, 119.400000, 1087.840000, 0.00000000, 0.00},
+     {ATOM_TYPE_NG2R62, ATOM_TYPE_CG2R63, ATOM_TYPE_OG2D4, 123.800000, 1087.840000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_CG2R64, ATOM_TYPE_NG2R60, 124.000000, 167.360000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_CG2R64, ATOM_TYPE_NG2R62, 128.000000, 167.360000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_CG2R64, ATOM_TYPE_NG2S1, 120.000000, 334.720000, 0.24162000, 29288.00},
+     {ATOM_TYPE_CG2R62, ATOM_TYPE_CG2R64, ATOM_TYPE_NG2R62, 119.300000, 711.280000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R62, ATOM_TYPE_CG2R64, ATOM_TYPE_NG2S3, 118.400000, 677.808000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2RC0, ATOM_TYPE_CG2R64, ATOM_TYPE_NG2R62, 110.700000, 502.080000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2RC0, ATOM_TYPE_CG2R64, ATOM_TYPE_NG2S3, 118.600000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_NG2R60, ATOM_TYPE_CG2R64, ATOM_TYPE_NG2S1, 120.000000, 334.720000, 0.24162000, 29288.00},
+     {ATOM_TYPE_NG2R61, ATOM_TYPE_CG2R64, ATOM_TYPE_NG2R62, 122.200000, 585.760000, 0.00000000, 0.00},
+     {ATOM_TYPE_NG2R61, ATOM_TYPE_CG2R64, ATOM_TYPE_NG2S3, 115.400000, 794.960000, 0.00000000, 0.00},
+     {ATOM_TYPE_NG2R62, ATOM_TYPE_CG2R64, ATOM_TYPE_NG2R62, 128.000000, 502.080000, 0.00000000, 0.00},
+     {ATOM_TYPE_NG2R62, ATOM_TYPE_CG2R64, ATOM_TYPE_NG2S3, 122.400000, 794.960000, 0.00000000, 0.00},
+     {ATOM_TYPE_NG2R62, ATOM_TYPE_CG2R64, ATOM_TYPE_HGR62, 116.000000, 317.984000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_CG2R66, ATOM_TYPE_CG2R61, 122.500000, 334.720000, 0.24162000, 29288.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_CG2R66, ATOM_TYPE_FGR1, 118.750000, 502.080000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_CG2R67, ATOM_TYPE_CG2R61, 120.000000, 334.720000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_CG2R67, ATOM_TYPE_CG2R67, 120.000000, 334.720000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_CG2R67, ATOM_TYPE_CG2RC0, 120.000000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R67, ATOM_TYPE_CG2R67, ATOM_TYPE_CG2RC0, 110.000000, 460.240000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R71, ATOM_TYPE_CG2R71, ATOM_TYPE_CG2R71, 128.600000, 251.040000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R71, ATOM_TYPE_CG2R71, ATOM_TYPE_CG2RC7, 129.300000, 753.120000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R71, ATOM_TYPE_CG2R71, ATOM_TYPE_HGR71, 115.700000, 309.616000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2RC7, ATOM_TYPE_CG2R71, ATOM_TYPE_HGR71, 115.000000, 267.776000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG25C1, ATOM_TYPE_CG2RC0, ATOM_TYPE_CG2R61, 125.000000, 334.720000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG25C1, ATOM_TYPE_CG2RC0, ATOM_TYPE_CG2RC0, 107.000000, 167.360000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG25C2, ATOM_TYPE_CG2RC0, ATOM_TYPE_CG2R61, 125.000000, 334.720000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG25C2, ATOM_TYPE_CG2RC0, ATOM_TYPE_CG2RC0, 107.000000, 167.360000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R51, ATOM_TYPE_CG2RC0, ATOM_TYPE_CG2R61, 132.000000, 1087.840000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R51, ATOM_TYPE_CG2RC0, ATOM_TYPE_CG2RC0, 108.000000, 711.280000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R51, ATOM_TYPE_CG2RC0, ATOM_TYPE_NG2RC0, 109.200000, 753.120000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R52, ATOM_TYPE_CG2RC0, ATOM_TYPE_CG2R61, 134.100000, 502.080000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R52, ATOM_TYPE_CG2RC0, ATOM_TYPE_CG2RC0, 105.900000, 753.120000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_CG2RC0, ATOM_TYPE_CG2R67, 120.000000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_CG2RC0, ATOM_TYPE_CG2RC0, 120.000000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_CG2RC0, ATOM_TYPE_CG3C52, 130.000000, 502.080000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_CG2RC0, ATOM_TYPE_NG2R50, 130.000000, 1087.840000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_CG2RC0, ATOM_TYPE_NG2R51, 132.600000, 1087.840000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_CG2RC0, ATOM_TYPE_NG2RC0, 118.800000, 669.440000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_CG2RC0, ATOM_TYPE_NG3C51, 130.700000, 292.880000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_CG2RC0, ATOM_TYPE_OG2R50, 129.400000, 836.800000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_CG2RC0, ATOM_TYPE_OG3C51, 125.300000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_CG2RC0, ATOM_TYPE_SG2R50, 123.700000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R63, ATOM_TYPE_CG2RC0, ATOM_TYPE_CG2RC0, 119.600000, 585.760000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R63, ATOM_TYPE_CG2RC0, ATOM_TYPE_NG2R50, 129.000000, 1046.000000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R64, ATOM_TYPE_CG2RC0, ATOM_TYPE_CG2RC0, 121.000000, 502.080000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R64, ATOM_TYPE_CG2RC0, ATOM_TYPE_NG2R50, 129.000000, 836.800000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R67, ATOM_TYPE_CG2RC0, ATOM_TYPE_CG3C52, 110.000000, 920.480000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R67, ATOM_TYPE_CG2RC0, ATOM_TYPE_NG2R51, 105.700000, 836.800000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2RC0, ATOM_TYPE_CG2RC0, ATOM_TYPE_CG3C52, 110.000000, 920.480000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2RC0, ATOM_TYPE_CG2RC0, ATOM_TYPE_NG2R50, 110.000000, 836.800000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2RC0, ATOM_TYPE_CG2RC0, ATOM_TYPE_NG2R51, 105.700000, 836.800000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2RC0, ATOM_TYPE_CG2RC0, ATOM_TYPE_NG2R62, 127.400000, 502.080000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2RC0, ATOM_TYPE_CG2RC0, ATOM_TYPE_NG3C51, 109.300000, 836.800000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2RC0, ATOM_TYPE_CG2RC0, ATOM_TYPE_OG2R50, 110.600000, 920.480000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2RC0, ATOM_TYPE_CG2RC0, ATOM_TYPE_OG3C51, 114.700000, 669.440000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2RC0, ATOM_TYPE_CG2RC0, ATOM_TYPE_SG2R50, 116.300000, 585.760000, 0.00000000, 0.00},
+     {ATOM_TYPE_NG2R50, ATOM_TYPE_CG2RC0, ATOM_TYPE_NG2R62, 122.600000, 167.360000, 0.00000000, 0.00},
+     {ATOM_TYPE_NG2R51, ATOM_TYPE_CG2RC0, ATOM_TYPE_NG2R62, 126.900000, 836.800000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R51, ATOM_TYPE_CG2RC7, ATOM_TYPE_CG2R71, 122.700000, 251.040000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R51, ATOM_TYPE_CG2RC7, ATOM_TYPE_CG2RC7, 109.500000, 920.480000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R71, ATOM_TYPE_CG2RC7, ATOM_TYPE_CG2RC7, 127.800000, 251.040000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2D1, ATOM_TYPE_CG301, ATOM_TYPE_CG311, 112.200000, 267.776000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2D1, ATOM_TYPE_CG301, ATOM_TYPE_CG321, 112.200000, 267.776000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2D1, ATOM_TYPE_CG301, ATOM_TYPE_CG331, 112.200000, 267.776000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2DC1, ATOM_TYPE_CG301, ATOM_TYPE_CG321, 112.200000, 267.776000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2DC1, ATOM_TYPE_CG301, ATOM_TYPE_CG331, 112.200000, 267.776000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2DC2, ATOM_TYPE_CG301, ATOM_TYPE_CG321, 112.200000, 267.776000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2DC2, ATOM_TYPE_CG301, ATOM_TYPE_CG331, 112.200000, 267.776000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2O3, ATOM_TYPE_CG301, ATOM_TYPE_CG331, 108.000000, 435.136000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2O3, ATOM_TYPE_CG301, ATOM_TYPE_OG301, 109.000000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2O3, ATOM_TYPE_CG301, ATOM_TYPE_OG311, 110.100000, 633.457600, 0.00000000, 0.00},
+     {ATOM_TYPE_CG311, ATOM_TYPE_CG301, ATOM_TYPE_CG311, 113.500000, 488.272800, 0.25610000, 9338.69},
+     {ATOM_TYPE_CG311, ATOM_TYPE_CG301, ATOM_TYPE_CG321, 113.500000, 488.272800, 0.25610000, 9338.69},
+     {ATOM_TYPE_CG311, ATOM_TYPE_CG301, ATOM_TYPE_CG331, 113.500000, 488.272800, 0.25610000, 9338.69},
+     {ATOM_TYPE_CG321, ATOM_TYPE_CG301, ATOM_TYPE_CG321, 113.500000, 488.272800, 0.25610000, 9338.69},
+     {ATOM_TYPE_CG321, ATOM_TYPE_CG301, ATOM_TYPE_CG331, 113.500000, 488.272800, 0.25610000, 9338.69},
+     {ATOM_TYPE_CG321, ATOM_TYPE_CG301, ATOM_TYPE_OG301, 114.500000, 380.744000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG331, ATOM_TYPE_CG301, ATOM_TYPE_CG331, 113.500000, 488.272800, 0.25610000, 9338.69},
+     {ATOM_TYPE_CG331, ATOM_TYPE_CG301, ATOM_TYPE_OG301, 111.500000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG331, ATOM_TYPE_CG301, ATOM_TYPE_OG302, 110.100000, 633.457600, 0.00000000, 0.00},
+     {ATOM_TYPE_CG331, ATOM_TYPE_CG301, ATOM_TYPE_OG311, 110.100000, 633.457600, 0.00000000, 0.00},
+     {ATOM_TYPE_CG331, ATOM_TYPE_CG301, ATOM_TYPE_CLGA3, 111.200000, 811.696000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG331, ATOM_TYPE_CG301, ATOM_TYPE_BRGA3, 111.200000, 820.064000, 0.00000000, 0.00},
+     {ATOM_TYPE_OG301, ATOM_TYPE_CG301, ATOM_TYPE_OG301, 107.000000, 589.860320, 0.00000000, 0.00},
+     {ATOM_TYPE_OG301, ATOM_TYPE_CG301, ATOM_TYPE_OG311, 116.500000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_CLGA3, ATOM_TYPE_CG301, ATOM_TYPE_CLGA3, 109.000000, 794.960000, 0.00000000, 0.00},
+     {ATOM_TYPE_BRGA3, ATOM_TYPE_CG301, ATOM_TYPE_BRGA3, 110.500000, 753.120000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG321, ATOM_TYPE_CG302, ATOM_TYPE_FGA3, 112.000000, 351.456000, 0.23570000, 25104.00},
+     {ATOM_TYPE_CG331, ATOM_TYPE_CG302, ATOM_TYPE_FGA3, 112.000000, 351.456000, 0.23570000, 25104.00},
+     {ATOM_TYPE_FGA3, ATOM_TYPE_CG302, ATOM_TYPE_FGA3, 107.000000, 987.424000, 0.21550000, 25104.00},
+     {ATOM_TYPE_CG2O1, ATOM_TYPE_CG311, ATOM_TYPE_CG311, 108.000000, 435.136000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2O1, ATOM_TYPE_CG311, ATOM_TYPE_CG321, 108.000000, 435.136000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2O1, ATOM_TYPE_CG311, ATOM_TYPE_CG331, 108.000000, 435.136000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2O1, ATOM_TYPE_CG311, ATOM_TYPE_NG2S1, 107.000000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2O1, ATOM_TYPE_CG311, ATOM_TYPE_HGA1, 109.500000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2O2, ATOM_TYPE_CG311, ATOM_TYPE_CG321, 108.000000, 435.136000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2O2, ATOM_TYPE_CG311, ATOM_TYPE_NG2R53, 107.000000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2O2, ATOM_TYPE_CG311, ATOM_TYPE_NG2S1, 107.000000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2O2, ATOM_TYPE_CG311, ATOM_TYPE_HGA1, 109.500000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2O3, ATOM_TYPE_CG311, ATOM_TYPE_CG2R61, 107.500000, 433.462400, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2O3, ATOM_TYPE_CG311, ATOM_TYPE_CG311, 108.000000, 435.136000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2O3, ATOM_TYPE_CG311, ATOM_TYPE_CG321, 108.000000, 435.136000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2O3, ATOM_TYPE_CG311, ATOM_TYPE_CG331, 108.000000, 435.136000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2O3, ATOM_TYPE_CG311, ATOM_TYPE_NG2R53, 107.000000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2O3, ATOM_TYPE_CG311, ATOM_TYPE_NG2S1, 107.000000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2O3, ATOM_TYPE_CG311, ATOM_TYPE_OG301, 109.000000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2O3, ATOM_TYPE_CG311, ATOM_TYPE_HGA1, 109.500000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2O5, ATOM_TYPE_CG311, ATOM_TYPE_OG311, 111.000000, 937.216000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2O5, ATOM_TYPE_CG311, ATOM_TYPE_OG312, 111.000000, 1087.840000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2O5, ATOM_TYPE_CG311, ATOM_TYPE_HGA1, 109.500000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_CG311, ATOM_TYPE_CG321, 107.500000, 433.462400, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_CG311, ATOM_TYPE_CG331, 107.500000, 433.462400, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_CG311, ATOM_TYPE_HGA1, 111.000000, 359.824000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG301, ATOM_TYPE_CG311, ATOM_TYPE_CG311, 108.000000, 435.136000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG301, ATOM_TYPE_CG311, ATOM_TYPE_CG321, 113.500000, 488.272800, 0.25610000, 9338.69},
+     {ATOM_TYPE_CG301, ATOM_TYPE_CG311, ATOM_TYPE_HGA1, 110.100000, 289.532800, 0.21790000, 18853.10},
+     {ATOM_TYPE_CG311, ATOM_TYPE_CG311, ATOM_TYPE_CG311, 111.000000, 446.432800, 0.25610000, 6694.40},
+     {ATOM_TYPE_CG311, ATOM_TYPE_CG311, ATOM_TYPE_CG321, 111.000000, 446.432800, 0.25610000, 6694.40},
+     {ATOM_TYPE_CG311, ATOM_TYPE_CG311, ATOM_TYPE_CG331, 108.500000, 446.432800, 0.25610000, 6694.40},
+     {ATOM_TYPE_CG311, ATOM_TYPE_CG311, ATOM_TYPE_CG3RC1, 103.700000, 446.432800, 0.25610000, 6694.40},
+     {ATOM_TYPE_CG311, ATOM_TYPE_CG311, ATOM_TYPE_NG2S1, 113.500000, 585.760000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG311, ATOM_TYPE_CG311, ATOM_TYPE_OG311, 110.100000, 633.457600, 0.00000000, 0.00},
+     {ATOM_TYPE_CG311, ATOM_TYPE_CG311, ATOM_TYPE_HGA1, 110.100000, 288.696000, 0.21790000, 18853.10},
+     {ATOM_TYPE_CG314, ATOM_TYPE_CG311, ATOM_TYPE_CG321, 111.000000, 446.432800, 0.25610000, 6694.40},
+     {ATOM_TYPE_CG314, ATOM_TYPE_CG311, ATOM_TYPE_CG331, 108.500000, 446.432800, 0.25610000, 6694.40},
+     {ATOM_TYPE_CG314, ATOM_TYPE_CG311, ATOM_TYPE_HGA1, 110.100000, 288.696000, 0.21790000, 18853.10},
+     {ATOM_TYPE_CG321, ATOM_TYPE_CG311, ATOM_TYPE_CG321, 113.500000, 488.272800, 0.25610000, 9338.69},
+     {ATOM_TYPE_CG321, ATOM_TYPE_CG311, ATOM_TYPE_CG324, 110.500000, 488.272800, 0.25610000, 9338.69},
+     {ATOM_TYPE_CG321, ATOM_TYPE_CG311, ATOM_TYPE_CG331, 114.000000, 446.432800, 0.25610000, 6694.40},
+     {ATOM_TYPE_CG321, ATOM_TYPE_CG311, ATOM_TYPE_CG3C51, 111.000000, 446.432800, 0.25610000, 6694.40},
+     {ATOM_TYPE_CG321, ATOM_TYPE_CG311, ATOM_TYPE_CG3RC1, 103.700000, 446.432800, 0.25610000, 6694.40},
+     {ATOM_TYPE_CG321, ATOM_TYPE_CG311, ATOM_TYPE_NG2R53, 113.500000, 585.760000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG321, ATOM_TYPE_CG311, ATOM_TYPE_NG2S1, 113.500000, 585.760000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG321, ATOM_TYPE_CG311, ATOM_TYPE_OG302, 109.700000, 962.320000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG321, ATOM_TYPE_CG311, ATOM_TYPE_OG311, 110.000000, 633.457600, 0.00000000, 0.00},
+     {ATOM_TYPE_CG321, ATOM_TYPE_CG311, ATOM_TYPE_HGA1, 110.100000, 288.696000, 0.21790000, 18853.10},
+     {ATOM_TYPE_CG324, ATOM_TYPE_CG311, ATOM_TYPE_NG2S1, 113.500000, 585.760000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG324, ATOM_TYPE_CG311, ATOM_TYPE_OG311, 112.100000, 633.457600, 0.00000000, 0.00},
+     {ATOM_TYPE_CG324, ATOM_TYPE_CG311, ATOM_TYPE_HGA1, 111.800000, 221.752000, 0.21790000, 18853.10},
+     {ATOM_TYPE_CG331, ATOM_TYPE_CG311, ATOM_TYPE_CG331, 114.000000, 446.432800, 0.25610000, 6694.40},
+     {ATOM_TYPE_CG331, ATOM_TYPE_CG311, ATOM_TYPE_CG3C51, 108.500000, 446.432800, 0.25610000, 6694.40},
+     {ATOM_TYPE_CG331, ATOM_TYPE_CG311, ATOM_TYPE_NG2S1, 113.500000, 585.760000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG331, ATOM_TYPE_CG311, ATOM_TYPE_OG301, 111.500000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG331, ATOM_TYPE_CG311, ATOM_TYPE_OG302, 110.100000, 633.457600, 0.00000000, 0.00},
+     {ATOM_TYPE_CG331, ATOM_TYPE_CG311, ATOM_TYPE_OG303, 109.700000, 962.320000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG331, ATOM_TYPE_CG311, ATOM_TYPE_OG311, 110.100000, 633.457600, 0.00000000, 0.00},
+     {ATOM_TYPE_CG331, ATOM_TYPE_CG311, ATOM_TYPE_CLGA1, 111.200000, 736.384000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG331, ATOM_TYPE_CG311, ATOM_TYPE_BRGA2, 111.000000, 627.600000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG331, ATOM_TYPE_CG311, ATOM_TYPE_HGA1, 110.100000, 288.696000, 0.21790000, 18853.10},
+     {ATOM_TYPE_CG3C51, ATOM_TYPE_CG311, ATOM_TYPE_HGA1, 110.100000, 289.532800, 0.21790000, 18853.10},
+     {ATOM_TYPE_CG3RC1, ATOM_TYPE_CG311, ATOM_TYPE_OG311, 110.100000, 633.457600, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3RC1, ATOM_TYPE_CG311, ATOM_TYPE_HGA1, 110.100000, 288.696000, 0.21790000, 18853.10},
+     {ATOM_TYPE_NG2R53, ATOM_TYPE_CG311, ATOM_TYPE_HGA1, 108.000000, 401.664000, 0.00000000, 0.00},
+     {ATOM_TYPE_NG2S1, ATOM_TYPE_CG311, ATOM_TYPE_HGA1, 108.000000, 401.664000, 0.00000000, 0.00},
+     {ATOM_TYPE_OG301, ATOM_TYPE_CG311, ATOM_TYPE_HGA1, 109.500000, 502.080000, 0.00000000, 0.00},
+     {ATOM_TYPE_OG302, ATOM_TYPE_CG311, ATOM_TYPE_HGA1, 109.500000, 502.080000, 0.00000000, 0.00},
+     {ATOM_TYPE_OG303, ATOM_TYPE_CG311, ATOM_TYPE_HGA1, 109.500000, 502.080000, 0.00000000, 0.00},
+     {ATOM_TYPE_OG311, ATOM_TYPE_CG311, ATOM_TYPE_OG312, 111.000000, 936.379200, 0.23500000, 83680.00},
+     {ATOM_TYPE_OG311, ATOM_TYPE_CG311, ATOM_TYPE_HGA1, 108.890000, 384.091200, 0.00000000, 0.00},
+     {ATOM_TYPE_OG312, ATOM_TYPE_CG311, ATOM_TYPE_HGA1, 117.800000, 551.451200, 0.00000000, 0.00},
+     {ATOM_TYPE_CLGA1, ATOM_TYPE_CG311, ATOM_TYPE_CLGA1, 109.000000, 794.960000, 0.00000000, 0.00},
+     {ATOM_TYPE_CLGA1, ATOM_TYPE_CG311, ATOM_TYPE_HGA1, 108.500000, 368.192000, 0.00000000, 0.00},
+     {ATOM_TYPE_BRGA2, ATOM_TYPE_CG311, ATOM_TYPE_BRGA2, 110.000000, 794.960000, 0.00000000, 0.00},
+     {ATOM_TYPE_BRGA2, ATOM_TYPE_CG311, ATOM_TYPE_HGA1, 107.000000, 301.248000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_CG312, ATOM_TYPE_PG1, 117.000000, 753.120000, 0.23000000, 16736.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_CG312, ATOM_TYPE_PG2, 117.000000, 753.120000, 0.23000000, 16736.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_CG312, ATOM_TYPE_FGA2, 115.000000, 418.400000, 0.23570000, 25104.00},
+     {ATOM_TYPE_CG331, ATOM_TYPE_CG312, ATOM_TYPE_FGA2, 112.000000, 418.400000, 0.23570000, 25104.00},
+     {ATOM_TYPE_CG331, ATOM_TYPE_CG312, ATOM_TYPE_HGA7, 112.000000, 267.776000, 0.21680000, 2510.40},
+     {ATOM_TYPE_PG1, ATOM_TYPE_CG312, ATOM_TYPE_FGA2, 122.000000, 418.400000, 0.23570000, 25104.00},
+     {ATOM_TYPE_PG2, ATOM_TYPE_CG312, ATOM_TYPE_FGA2, 122.000000, 418.400000, 0.23570000, 25104.00},
+     {ATOM_TYPE_FGA2, ATOM_TYPE_CG312, ATOM_TYPE_FGA2, 107.000000, 1255.200000, 0.21700000, 8368.00},
+     {ATOM_TYPE_FGA2, ATOM_TYPE_CG312, ATOM_TYPE_HGA7, 108.890000, 350.619200, 0.19800000, 4184.00},
+     {ATOM_TYPE_CG2O1, ATOM_TYPE_CG314, ATOM_TYPE_CG311, 108.000000, 435.136000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2O1, ATOM_TYPE_CG314, ATOM_TYPE_CG321, 108.000000, 435.136000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2O1, ATOM_TYPE_CG314, ATOM_TYPE_CG331, 108.000000, 435.136000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2O1, ATOM_TYPE_CG314, ATOM_TYPE_NG3P3, 110.000000, 365.681600, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2O1, ATOM_TYPE_CG314, ATOM_TYPE_HGA1, 109.500000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2O3, ATOM_TYPE_CG314, ATOM_TYPE_CG311, 108.000000, 435.136000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2O3, ATOM_TYPE_CG314, ATOM_TYPE_CG321, 108.000000, 435.136000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2O3, ATOM_TYPE_CG314, ATOM_TYPE_CG331, 108.000000, 435.136000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2O3, ATOM_TYPE_CG314, ATOM_TYPE_NG3P3, 110.000000, 365.681600, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2O3, ATOM_TYPE_CG314, ATOM_TYPE_HGA1, 109.500000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG311, ATOM_TYPE_CG314, ATOM_TYPE_NG3P3, 110.000000, 566.513600, 0.00000000, 0.00},
+     {ATOM_TYPE_CG311, ATOM_TYPE_CG314, ATOM_TYPE_HGA1, 110.100000, 288.696000, 0.21790000, 18853.10},
+     {ATOM_TYPE_CG321, ATOM_TYPE_CG314, ATOM_TYPE_CG321, 113.500000, 488.272800, 0.25610000, 9338.69},
+     {ATOM_TYPE_CG321, ATOM_TYPE_CG314, ATOM_TYPE_NG3P2, 110.000000, 334.720000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG321, ATOM_TYPE_CG314, ATOM_TYPE_NG3P3, 110.000000, 566.513600, 0.00000000, 0.00},
+     {ATOM_TYPE_CG321, ATOM_TYPE_CG314, ATOM_TYPE_HGA1, 110.100000, 288.696000, 0.21790000, 18853.10},
+     {ATOM_TYPE_CG331, ATOM_TYPE_CG314, ATOM_TYPE_NG3P3, 110.000000, 566.513600, 0.00000000, 0.00},
+     {ATOM_TYPE_CG331, ATOM_TYPE_CG314, ATOM_TYPE_HGA1, 110.100000, 288.696000, 0.21790000, 18853.10},
+     {ATOM_TYPE_NG3P2, ATOM_TYPE_CG314, ATOM_TYPE_HGA1, 102.300000, 376.560000, 0.21010000, 29288.00},
+     {ATOM_TYPE_NG3P3, ATOM_TYPE_CG314, ATOM_TYPE_HGA1, 107.500000, 430.952000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2D1, ATOM_TYPE_CG321, ATOM_TYPE_CG2D1, 114.000000, 251.040000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2D1, ATOM_TYPE_CG321, ATOM_TYPE_CG2DC1, 108.000000, 1046.000000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2D1, ATOM_TYPE_CG321, ATOM_TYPE_CG2DC2, 108.000000, 1046.000000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2D1, ATOM_TYPE_CG321, ATOM_TYPE_CG311, 112.200000, 267.776000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2D1, ATOM_TYPE_CG321, ATOM_TYPE_CG321, 112.200000, 267.776000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2D1, ATOM_TYPE_CG321, ATOM_TYPE_CG331, 112.200000, 267.776000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2D1, ATOM_TYPE_CG321, ATOM_TYPE_OG311, 110.100000, 633.457600, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2D1, ATOM_TYPE_CG321, ATOM_TYPE_HGA2, 111.500000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2DC1, ATOM_TYPE_CG321, ATOM_TYPE_CG321, 112.200000, 267.776000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2DC1, ATOM_TYPE_CG321, ATOM_TYPE_OG311, 110.100000, 633.457600, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2DC1, ATOM_TYPE_CG321, ATOM_TYPE_OG3R60, 99.000000, 167.360000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2DC1, ATOM_TYPE_CG321, ATOM_TYPE_HGA2, 111.500000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2DC2, ATOM_TYPE_CG321, ATOM_TYPE_CG321, 112.200000, 267.776000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2DC2, ATOM_TYPE_CG321, ATOM_TYPE_OG311, 110.100000, 633.457600, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2DC2, ATOM_TYPE_CG321, ATOM_TYPE_OG3R60, 99.000000, 167.360000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2DC2, ATOM_TYPE_CG321, ATOM_TYPE_HGA2, 111.500000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2O1, ATOM_TYPE_CG321, ATOM_TYPE_CG311, 108.000000, 435.136000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2O1, ATOM_TYPE_CG321, ATOM_TYPE_CG314, 108.000000, 435.136000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2O1, ATOM_TYPE_CG321, ATOM_TYPE_CG321, 108.000000, 435.136000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2O1, ATOM_TYPE_CG321, ATOM_TYPE_CG331, 108.000000, 435.136000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2O1, ATOM_TYPE_CG321, ATOM_TYPE_NG2S1, 107.000000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2O1, ATOM_TYPE_CG321, ATOM_TYPE_HGA2, 109.500000, 276.144000, 0.21630000, 25104.00},
+     {ATOM_TYPE_CG2O2, ATOM_TYPE_CG321, ATOM_TYPE_CG311, 108.000000, 435.136000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2O2, ATOM_TYPE_CG321, ATOM_TYPE_CG314, 108.000000, 435.136000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2O2, ATOM_TYPE_CG321, ATOM_TYPE_CG321, 108.000000, 435.136000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2O2, ATOM_TYPE_CG321, ATOM_TYPE_CG331, 108.000000, 435.136000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2O2, ATOM_TYPE_CG321, ATOM_TYPE_NG2S1, 107.000000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2O2, ATOM_TYPE_CG321, ATOM_TYPE_NG321, 110.000000, 365.681600, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2O2, ATOM_TYPE_CG321, ATOM_TYPE_HGA2, 109.500000, 276.144000, 0.21630000, 25104.00},
+     {ATOM_TYPE_CG2O3, ATOM_TYPE_CG321, ATOM_TYPE_CG311, 108.000000, 435.136000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2O3, ATOM_TYPE_CG321, ATOM_TYPE_CG314, 108.000000, 435.136000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2O3, ATOM_TYPE_CG321, ATOM_TYPE_CG321, 108.000000, 435.136000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2O3, ATOM_TYPE_CG321, ATOM_TYPE_CG331, 108.000000, 435.136000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2O3, ATOM_TYPE_CG321, ATOM_TYPE_NG2S1, 107.000000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2O3, ATOM_TYPE_CG321, ATOM_TYPE_HGA1, 109.500000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2O3, ATOM_TYPE_CG321, ATOM_TYPE_HGA2, 109.500000, 276.144000, 0.21630000, 25104.00},
+     {ATOM_TYPE_CG2O4, ATOM_TYPE_CG321, ATOM_TYPE_CG331, 113.800000, 502.080000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2O4, ATOM_TYPE_CG321, ATOM_TYPE_CLGA1, 111.820000, 543.920000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2O4, ATOM_TYPE_CG321, ATOM_TYPE_HGA2, 109.500000, 276.144000, 0.21630000, 25104.00},
+     {ATOM_TYPE_CG2O5, ATOM_TYPE_CG321, ATOM_TYPE_CG321, 113.800000, 502.080000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2O5, ATOM_TYPE_CG321, ATOM_TYPE_CG331, 111.500000, 502.080000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2O5, ATOM_TYPE_CG321, ATOM_TYPE_HGA2, 109.500000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R51, ATOM_TYPE_CG321, ATOM_TYPE_CG311, 114.000000, 488.272800, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R51, ATOM_TYPE_CG321, ATOM_TYPE_CG314, 114.000000, 488.272800, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R51, ATOM_TYPE_CG321, ATOM_TYPE_CG331, 114.000000, 488.272800, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R51, ATOM_TYPE_CG321, ATOM_TYPE_HGA2, 109.500000, 460.240000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_CG321, ATOM_TYPE_CG2R61, 107.500000, 433.462400, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_CG321, ATOM_TYPE_CG311, 107.500000, 433.462400, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_CG321, ATOM_TYPE_CG314, 107.500000, 433.462400, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_CG321, ATOM_TYPE_CG321, 107.500000, 433.462400, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_CG321, ATOM_TYPE_CG331, 107.500000, 433.462400, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_CG321, ATOM_TYPE_OG302, 110.100000, 633.457600, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_CG321, ATOM_TYPE_OG311, 110.100000, 633.457600, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_CG321, ATOM_TYPE_PG1, 111.000000, 753.120000, 0.23000000, 16736.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_CG321, ATOM_TYPE_PG2, 111.000000, 753.120000, 0.23000000, 16736.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_CG321, ATOM_TYPE_HGA2, 107.500000, 412.542400, 0.00000000, 0.00},
+     {ATOM_TYPE_CG301, ATOM_TYPE_CG321, ATOM_TYPE_CG321, 113.500000, 488.272800, 0.25610000, 9338.69},
+     {ATOM_TYPE_CG301, ATOM_TYPE_CG321, ATOM_TYPE_CG331, 113.500000, 546.848800, 0.00000000, 0.00},
+     {ATOM_TYPE_CG301, ATOM_TYPE_CG321, ATOM_TYPE_HGA2, 110.100000, 221.752000, 0.21790000, 18853.10},
+     {ATOM_TYPE_CG302, ATOM_TYPE_CG321, ATOM_TYPE_OG311, 110.100000, 633.457600, 0.00000000, 0.00},
+     {ATOM_TYPE_CG302, ATOM_TYPE_CG321, ATOM_TYPE_HGA2, 110.100000, 289.532800, 0.21790000, 18853.10},
+     {ATOM_TYPE_CG311, ATOM_TYPE_CG321, ATOM_TYPE_CG311, 113.500000, 488.272800, 0.25610000, 9338.69},
+     {ATOM_TYPE_CG311, ATOM_TYPE_CG321, ATOM_TYPE_CG314, 113.500000, 488.272800, 0.25610000, 9338.69},
+     {ATOM_TYPE_CG311, ATOM_TYPE_CG321, ATOM_TYPE_CG321, 113.500000, 488.272800, 0.25610000, 9338.69},
+     {ATOM_TYPE_CG311, ATOM_TYPE_CG321, ATOM_TYPE_CG324, 110.500000, 488.272800, 0.25610000, 9338.69},
+     {ATOM_TYPE_CG311, ATOM_TYPE_CG321, ATOM_TYPE_CG331, 113.500000, 488.272800, 0.25610000, 9338.69},
+     {ATOM_TYPE_CG311, ATOM_TYPE_CG321, ATOM_TYPE_NG2S1, 113.500000, 585.760000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG311, ATOM_TYPE_CG321, ATOM_TYPE_OG302, 110.100000, 633.457600, 0.00000000, 0.00},
+     {ATOM_TYPE_CG311, ATOM_TYPE_CG321, ATOM_TYPE_OG303, 110.100000, 633.457600, 0.00000000, 0.00},
+     {ATOM_TYPE_CG311, ATOM_TYPE_CG321, ATOM_TYPE_OG311, 110.100000, 633.457600, 0.00000000, 0.00},
+     {ATOM_TYPE_CG311, ATOM_TYPE_CG321, ATOM_TYPE_SG311, 112.500000, 485.344000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG311, ATOM_TYPE_CG321, ATOM_TYPE_HGA2, 110.100000, 279.742240, 0.21790000, 18853.10},
+     {ATOM_TYPE_CG314, ATOM_TYPE_CG321, ATOM_TYPE_CG321, 113.500000, 488.272800, 0.25610000, 9338.69},
+     {ATOM_TYPE_CG314, ATOM_TYPE_CG321, ATOM_TYPE_NG2S1, 113.500000, 585.760000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG314, ATOM_TYPE_CG321, ATOM_TYPE_OG311, 110.100000, 633.457600, 0.00000000, 0.00},
+     {ATOM_TYPE_CG314, ATOM_TYPE_CG321, ATOM_TYPE_SG311, 112.500000, 485.344000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG314, ATOM_TYPE_CG321, ATOM_TYPE_HGA2, 110.100000, 279.742240, 0.21790000, 18853.10},
+     {ATOM_TYPE_CG321, ATOM_TYPE_CG321, ATOM_TYPE_CG321, 113.600000, 488.272800, 0.25610000, 9338.69},
+     {ATOM_TYPE_CG321, ATOM_TYPE_CG321, ATOM_TYPE_CG324, 110.500000, 488.272800, 0.25610000, 9338.69},
+     {ATOM_TYPE_CG321, ATOM_TYPE_CG321, ATOM_TYPE_CG331, 115.000000, 485.344000, 0.25610000, 6694.40},
+     {ATOM_TYPE_CG321, ATOM_TYPE_CG321, ATOM_TYPE_CG3RC1, 111.000000, 446.432800, 0.25610000, 6694.40},
+     {ATOM_TYPE_CG321, ATOM_TYPE_CG321, ATOM_TYPE_NG2S1, 113.500000, 585.760000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG321, ATOM_TYPE_CG321, ATOM_TYPE_OG301, 111.500000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG321, ATOM_TYPE_CG321, ATOM_TYPE_OG302, 110.100000, 633.457600, 0.00000000, 0.00},
+     {ATOM_TYPE_CG321, ATOM_TYPE_CG321, ATOM_TYPE_OG303, 110.100000, 633.457600, 0.00000000, 0.00},
+     {ATOM_TYPE_CG321, ATOM_TYPE_CG321, ATOM_TYPE_OG311, 110.100000, 633.457600, 0.00000000, 0.00},
+     {ATOM_TYPE_CG321, ATOM_TYPE_CG321, ATOM_TYPE_OG3C61, 111.500000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG321, ATOM_TYPE_CG321, ATOM_TYPE_SG311, 114.500000, 485.344000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG321, ATOM_TYPE_CG321, ATOM_TYPE_SG3O1, 105.500000, 359.824000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG321, ATOM_TYPE_CG321, ATOM_TYPE_HGA2, 110.100000, 221.752000, 0.21790000, 18853.10},
+     {ATOM_TYPE_CG324, ATOM_TYPE_CG321, ATOM_TYPE_CG331, 110.500000, 488.272800, 0.25610000, 9338.69},
+     {ATOM_TYPE_CG324, ATOM_TYPE_CG321, ATOM_TYPE_OG302, 110.100000, 633.457600, 0.00000000, 0.00},
+     {ATOM_TYPE_CG324, ATOM_TYPE_CG321, ATOM_TYPE_OG303, 110.100000, 633.457600, 0.00000000, 0.00},
+     {ATOM_TYPE_CG324, ATOM_TYPE_CG321, ATOM_TYPE_OG311, 112.100000, 633.457600, 0.00000000, 0.00},
+     {ATOM_TYPE_CG324, ATOM_TYPE_CG321, ATOM_TYPE_OG3C61, 106.500000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG324, ATOM_TYPE_CG321, ATOM_TYPE_SG311, 110.000000, 585.760000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG324, ATOM_TYPE_CG321, ATOM_TYPE_HGA2, 110.100000, 221.752000, 0.21790000, 18853.10},
+     {ATOM_TYPE_CG331, ATOM_TYPE_CG321, ATOM_TYPE_CG331, 114.000000, 446.432800, 0.25610000, 6694.40},
+     {ATOM_TYPE_CG331, ATOM_TYPE_CG321, ATOM_TYPE_CG3C31, 111.000000, 446.432800, 0.00000000, 0.00},
+     {ATOM_TYPE_CG331, ATOM_TYPE_CG321, ATOM_TYPE_NG2S1, 120.000000, 585.760000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG331, ATOM_TYPE_CG321, ATOM_TYPE_NG311, 112.200000, 365.681600, 0.00000000, 0.00},
+     {ATOM_TYPE_CG331, ATOM_TYPE_CG321, ATOM_TYPE_OG301, 111.500000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG331, ATOM_TYPE_CG321, ATOM_TYPE_OG302, 110.100000, 633.457600, 0.00000000, 0.00},
+     {ATOM_TYPE_CG331, ATOM_TYPE_CG321, ATOM_TYPE_OG303, 108.400000, 585.760000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG331, ATOM_TYPE_CG321, ATOM_TYPE_OG311, 110.100000, 633.457600, 0.00000000, 0.00},
+     {ATOM_TYPE_CG331, ATOM_TYPE_CG321, ATOM_TYPE_OG312, 122.000000, 543.920000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG331, ATOM_TYPE_CG321, ATOM_TYPE_SG301, 112.500000, 485.344000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG331, ATOM_TYPE_CG321, ATOM_TYPE_SG311, 114.500000, 485.344000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG331, ATOM_TYPE_CG321, ATOM_TYPE_SG3O1, 105.500000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG331, ATOM_TYPE_CG321, ATOM_TYPE_SG3O2, 105.000000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG331, ATOM_TYPE_CG321, ATOM_TYPE_SG3O3, 105.000000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG331, ATOM_TYPE_CG321, ATOM_TYPE_CLGA1, 112.200000, 594.128000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG331, ATOM_TYPE_CG321, ATOM_TYPE_BRGA1, 111.000000, 594.128000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG331, ATOM_TYPE_CG321, ATOM_TYPE_HGA2, 110.100000, 289.532800, 0.21790000, 18853.10},
+     {ATOM_TYPE_CG3C31, ATOM_TYPE_CG321, ATOM_TYPE_HGA2, 109.000000, 351.456000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3C51, ATOM_TYPE_CG321, ATOM_TYPE_OG301, 110.100000, 633.457600, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3C51, ATOM_TYPE_CG321, ATOM_TYPE_OG303, 110.100000, 633.457600, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3C51, ATOM_TYPE_CG321, ATOM_TYPE_OG311, 110.100000, 633.457600, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3C51, ATOM_TYPE_CG321, ATOM_TYPE_SG311, 112.500000, 485.344000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3C51, ATOM_TYPE_CG321, ATOM_TYPE_HGA2, 110.100000, 289.532800, 0.21790000, 18853.10},
+     {ATOM_TYPE_CG3RC1, ATOM_TYPE_CG321, ATOM_TYPE_OG303, 110.100000, 633.457600, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3RC1, ATOM_TYPE_CG321, ATOM_TYPE_HGA2, 110.100000, 288.696000, 0.21790000, 18853.10},
+     {ATOM_TYPE_NG2S1, ATOM_TYPE_CG321, ATOM_TYPE_HGA2, 109.500000, 430.952000, 0.00000000, 0.00},
+     {ATOM_TYPE_NG311, ATOM_TYPE_CG321, ATOM_TYPE_NG311, 113.000000, 753.120000, 0.00000000, 0.00},
+     {ATOM_TYPE_NG311, ATOM_TYPE_CG321, ATOM_TYPE_HGA2, 109.500000, 271.123200, 0.21300000, 41840.00},
+     {ATOM_TYPE_NG321, ATOM_TYPE_CG321, ATOM_TYPE_HGA2, 109.500000, 271.123200, 0.21400000, 41840.00},
+     {ATOM_TYPE_OG301, ATOM_TYPE_CG321, ATOM_TYPE_HGA2, 108.890000, 384.091200, 0.00000000, 0.00},
+     {ATOM_TYPE_OG302, ATOM_TYPE_CG321, ATOM_TYPE_HGA2, 109.500000, 502.080000, 0.00000000, 0.00},
+     {ATOM_TYPE_OG303, ATOM_TYPE_CG321, ATOM_TYPE_HGA2, 109.500000, 502.080000, 0.00000000, 0.00},
+     {ATOM_TYPE_OG311, ATOM_TYPE_CG321, ATOM_TYPE_HGA2, 108.890000, 384.091200, 0.00000000, 0.00},
+     {ATOM_TYPE_OG312, ATOM_TYPE_CG321, ATOM_TYPE_HGA2, 118.300000, 543.920000, 0.00000000, 0.00},
+     {ATOM_TYPE_OG3C61, ATOM_TYPE_CG321, ATOM_TYPE_OG3C61, 110.500000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_OG3C61, ATOM_TYPE_CG321, ATOM_TYPE_HGA2, 109.500000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_OG3R60, ATOM_TYPE_CG321, ATOM_TYPE_HGA2, 111.500000, 460.240000, 0.00000000, 0.00},
+     {ATOM_TYPE_PG1, ATOM_TYPE_CG321, ATOM_TYPE_HGA2, 110.000000, 753.120000, 0.18020000, 4518.72},
+     {ATOM_TYPE_PG2, ATOM_TYPE_CG321, ATOM_TYPE_HGA2, 110.000000, 753.120000, 0.18020000, 4518.72},
+     {ATOM_TYPE_SG301, ATOM_TYPE_CG321, ATOM_TYPE_HGA2, 111.000000, 317.984000, 0.00000000, 0.00},
+     {ATOM_TYPE_SG311, ATOM_TYPE_CG321, ATOM_TYPE_SG311, 117.000000, 836.800000, 0.00000000, 0.00},
+     {ATOM_TYPE_SG311, ATOM_TYPE_CG321, ATOM_TYPE_HGA2, 111.300000, 385.764800, 0.00000000, 0.00},
+     {ATOM_TYPE_SG3O1, ATOM_TYPE_CG321, ATOM_TYPE_HGA2, 109.000000, 410.032000, 0.00000000, 0.00},
+     {ATOM_TYPE_SG3O2, ATOM_TYPE_CG321, ATOM_TYPE_HGA2, 107.000000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_SG3O3, ATOM_TYPE_CG321, ATOM_TYPE_HGA2, 107.000000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_CLGA1, ATOM_TYPE_CG321, ATOM_TYPE_HGA2, 107.000000, 351.456000, 0.00000000, 0.00},
+     {ATOM_TYPE_BRGA1, ATOM_TYPE_CG321, ATOM_TYPE_HGA2, 106.000000, 301.248000, 0.00000000, 0.00},
+     {ATOM_TYPE_HGA2, ATOM_TYPE_CG321, ATOM_TYPE_HGA2, 109.000000, 297.064000, 0.18020000, 4518.72},
+     {ATOM_TYPE_CG331, ATOM_TYPE_CG322, ATOM_TYPE_FGA1, 112.000000, 368.192000, 0.23690000, 25104.00},
+     {ATOM_TYPE_CG331, ATOM_TYPE_CG322, ATOM_TYPE_HGA6, 112.000000, 259.408000, 0.21680000, 2510.40},
+     {ATOM_TYPE_FGA1, ATOM_TYPE_CG322, ATOM_TYPE_HGA6, 108.890000, 481.160000, 0.19970000, 4184.00},
+     {ATOM_TYPE_HGA6, ATOM_TYPE_CG322, ATOM_TYPE_HGA6, 108.400000, 297.064000, 0.17460000, 8702.72},
+     {ATOM_TYPE_CG331, ATOM_TYPE_CG323, ATOM_TYPE_SG302, 118.000000, 460.240000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG331, ATOM_TYPE_CG323, ATOM_TYPE_HGA2, 110.100000, 289.532800, 0.21790000, 18853.10},
+     {ATOM_TYPE_SG302, ATOM_TYPE_CG323, ATOM_TYPE_HGA2, 112.300000, 334.720000, 0.00000000, 0.00},
+     {ATOM_TYPE_SG302, ATOM_TYPE_CG323, ATOM_TYPE_HGA3, 112.300000, 334.720000, 0.00000000, 0.00},
+     {ATOM_TYPE_HGA2, ATOM_TYPE_CG323, ATOM_TYPE_HGA2, 108.400000, 297.064000, 0.17750000, 11715.20},
+     {ATOM_TYPE_HGA3, ATOM_TYPE_CG323, ATOM_TYPE_HGA3, 108.400000, 297.064000, 0.17750000, 11715.20},
+     {ATOM_TYPE_CG2O1, ATOM_TYPE_CG324, ATOM_TYPE_NG3P3, 110.000000, 365.681600, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2O1, ATOM_TYPE_CG324, ATOM_TYPE_HGA2, 109.500000, 276.144000, 0.21630000, 25104.00},
+     {ATOM_TYPE_CG2O3, ATOM_TYPE_CG324, ATOM_TYPE_NG3P3, 110.000000, 365.681600, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2O3, ATOM_TYPE_CG324, ATOM_TYPE_HGA2, 109.500000, 276.144000, 0.21630000, 25104.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_CG324, ATOM_TYPE_NG3P1, 102.300000, 376.560000, 0.21010000, 29288.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_CG324, ATOM_TYPE_HGA2, 107.500000, 412.542400, 0.00000000, 0.00},
+     {ATOM_TYPE_CG311, ATOM_TYPE_CG324, ATOM_TYPE_NG3P1, 110.000000, 836.800000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG311, ATOM_TYPE_CG324, ATOM_TYPE_NG3P2, 110.000000, 334.720000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG311, ATOM_TYPE_CG324, ATOM_TYPE_HGA2, 111.800000, 221.752000, 0.21790000, 18853.10},
+     {ATOM_TYPE_CG321, ATOM_TYPE_CG324, ATOM_TYPE_NG2O1, 109.000000, 475.302400, 0.00000000, 0.00},
+     {ATOM_TYPE_CG321, ATOM_TYPE_CG324, ATOM_TYPE_NG2P1, 110.000000, 566.513600, 0.00000000, 0.00},
+     {ATOM_TYPE_CG321, ATOM_TYPE_CG324, ATOM_TYPE_NG3P0, 115.000000, 566.513600, 0.00000000, 0.00},
+     {ATOM_TYPE_CG321, ATOM_TYPE_CG324, ATOM_TYPE_NG3P1, 110.000000, 836.800000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG321, ATOM_TYPE_CG324, ATOM_TYPE_NG3P2, 110.000000, 334.720000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG321, ATOM_TYPE_CG324, ATOM_TYPE_NG3P3, 110.000000, 566.513600, 0.00000000, 0.00},
+     {ATOM_TYPE_CG321, ATOM_TYPE_CG324, ATOM_TYPE_HGA2, 111.800000, 221.752000, 0.21790000, 18853.10},
+     {ATOM_TYPE_CG321, ATOM_TYPE_CG324, ATOM_TYPE_HGP5, 110.100000, 279.742240, 0.21790000, 18853.10},
+     {ATOM_TYPE_CG331, ATOM_TYPE_CG324, ATOM_TYPE_NG3P0, 115.000000, 566.513600, 0.00000000, 0.00},
+     {ATOM_TYPE_CG331, ATOM_TYPE_CG324, ATOM_TYPE_NG3P3, 110.000000, 566.513600, 0.00000000, 0.00},
+     {ATOM_TYPE_CG331, ATOM_TYPE_CG324, ATOM_TYPE_HGA2, 110.100000, 289.532800, 0.21790000, 18853.10},
+     {ATOM_TYPE_CG331, ATOM_TYPE_CG324, ATOM_TYPE_HGP5, 110.100000, 279.742240, 0.21790000, 18853.10},
+     {ATOM_TYPE_CG3C31, ATOM_TYPE_CG324, ATOM_TYPE_NG3P3, 110.000000, 566.513600, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3C31, ATOM_TYPE_CG324, ATOM_TYPE_HGA2, 110.100000, 289.532800, 0.00000000, 0.00},
+     {ATOM_TYPE_NG2O1, ATOM_TYPE_CG324, ATOM_TYPE_HGA2, 106.300000, 502.080000, 0.00000000, 0.00},
+     {ATOM_TYPE_NG2P1, ATOM_TYPE_CG324, ATOM_TYPE_HGA2, 110.100000, 351.456000, 0.00000000, 0.00},
+     {ATOM_TYPE_NG3P0, ATOM_TYPE_CG324, ATOM_TYPE_HGP5, 109.500000, 334.720000, 0.21300000, 22593.60},
+     {ATOM_TYPE_NG3P1, ATOM_TYPE_CG324, ATOM_TYPE_HGA2, 102.300000, 376.560000, 0.21010000, 29288.00},
+     {ATOM_TYPE_NG3P2, ATOM_TYPE_CG324, ATOM_TYPE_HGA2, 102.300000, 376.560000, 0.21010000, 29288.00},
+     {ATOM_TYPE_NG3P3, ATOM_TYPE_CG324, ATOM_TYPE_HGA2, 107.500000, 376.560000, 0.21010000, 29288.00},
+     {ATOM_TYPE_HGA2, ATOM_TYPE_CG324, ATOM_TYPE_HGA2, 109.000000, 297.064000, 0.18020000, 4518.72},
+     {ATOM_TYPE_HGP5, ATOM_TYPE_CG324, ATOM_TYPE_HGP5, 109.500000, 200.832000, 0.17670000, 23430.40},
+     {ATOM_TYPE_CG1N1, ATOM_TYPE_CG331, ATOM_TYPE_HGA3, 110.500000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG1T1, ATOM_TYPE_CG331, ATOM_TYPE_HGA3, 111.500000, 393.296000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2D1, ATOM_TYPE_CG331, ATOM_TYPE_HGA3, 111.500000, 351.456000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2DC1, ATOM_TYPE_CG331, ATOM_TYPE_HGA3, 111.500000, 351.456000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2DC2, ATOM_TYPE_CG331, ATOM_TYPE_HGA3, 111.500000, 351.456000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2N2, ATOM_TYPE_CG331, ATOM_TYPE_HGA3, 109.500000, 276.144000, 0.21300000, 25104.00},
+     {ATOM_TYPE_CG2O1, ATOM_TYPE_CG331, ATOM_TYPE_HGA3, 109.500000, 276.144000, 0.21630000, 25104.00},
+     {ATOM_TYPE_CG2O2, ATOM_TYPE_CG331, ATOM_TYPE_HGA3, 109.500000, 276.144000, 0.21630000, 25104.00},
+     {ATOM_TYPE_CG2O3, ATOM_TYPE_CG331, ATOM_TYPE_HGA3, 109.500000, 276.144000, 0.21630000, 25104.00},
+     {ATOM_TYPE_CG2O4, ATOM_TYPE_CG331, ATOM_TYPE_HGA3, 109.500000, 276.144000, 0.21630000, 25104.00},
+     {ATOM_TYPE_CG2O5, ATOM_TYPE_CG331, ATOM_TYPE_HGA3, 109.500000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R51, ATOM_TYPE_CG331, ATOM_TYPE_HGA3, 109.500000, 460.240000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_CG331, ATOM_TYPE_HGA3, 107.500000, 412.542400, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R62, ATOM_TYPE_CG331, ATOM_TYPE_HGA3, 110.100000, 279.742240, 0.21790000, 18853.10},
+     {ATOM_TYPE_CG301, ATOM_TYPE_CG331, ATOM_TYPE_HGA3, 110.100000, 279.742240, 0.21790000, 18853.10},
+     {ATOM_TYPE_CG302, ATOM_TYPE_CG331, ATOM_TYPE_HGA3, 110.500000, 276.144000, 0.21550000, 32635.20},
+     {ATOM_TYPE_CG311, ATOM_TYPE_CG331, ATOM_TYPE_HGA3, 110.100000, 279.742240, 0.21790000, 18853.10},
+     {ATOM_TYPE_CG312, ATOM_TYPE_CG331, ATOM_TYPE_HGA3, 110.500000, 276.144000, 0.21680000, 30961.60},
+     {ATOM_TYPE_CG314, ATOM_TYPE_CG331, ATOM_TYPE_HGA3, 110.100000, 279.742240, 0.21790000, 18853.10},
+     {ATOM_TYPE_CG321, ATOM_TYPE_CG331, ATOM_TYPE_HGA3, 110.100000, 289.532800, 0.21790000, 18853.10},
+     {ATOM_TYPE_CG322, ATOM_TYPE_CG331, ATOM_TYPE_HGA3, 110.500000, 276.144000, 0.21810000, 31798.40},
+     {ATOM_TYPE_CG323, ATOM_TYPE_CG331, ATOM_TYPE_HGA3, 110.100000, 289.532800, 0.21790000, 18853.10},
+     {ATOM_TYPE_CG324, ATOM_TYPE_CG331, ATOM_TYPE_HGA3, 110.100000, 289.532800, 0.21790000, 18853.10},
+     {ATOM_TYPE_CG331, ATOM_TYPE_CG331, ATOM_TYPE_HGA3, 110.100000, 313.800000, 0.21790000, 18853.10},
+     {ATOM_TYPE_CG3C51, ATOM_TYPE_CG331, ATOM_TYPE_HGA3, 110.100000, 289.532800, 0.21790000, 18853.10},
+     {ATOM_TYPE_CG3RC1, ATOM_TYPE_CG331, ATOM_TYPE_HGA3, 110.100000, 279.742240, 0.21790000, 18853.10},
+     {ATOM_TYPE_NG2D1, ATOM_TYPE_CG331, ATOM_TYPE_HGA3, 113.500000, 351.456000, 0.00000000, 0.00},
+     {ATOM_TYPE_NG2R51, ATOM_TYPE_CG331, ATOM_TYPE_HGA3, 110.100000, 279.742240, 0.00000000, 0.00},
+     {ATOM_TYPE_NG2R61, ATOM_TYPE_CG331, ATOM_TYPE_HGA3, 110.100000, 279.742240, 0.21790000, 18853.10},
+     {ATOM_TYPE_NG2S0, ATOM_TYPE_CG331, ATOM_TYPE_HGA3, 105.000000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_NG2S1, ATOM_TYPE_CG331, ATOM_TYPE_HGA3, 109.500000, 430.952000, 0.00000000, 0.00},
+     {ATOM_TYPE_NG2S3, ATOM_TYPE_CG331, ATOM_TYPE_HGA3, 107.500000, 430.952000, 0.00000000, 0.00},
+     {ATOM_TYPE_NG311, ATOM_TYPE_CG331, ATOM_TYPE_HGA3, 109.700000, 255.224000, 0.21400000, 41840.00},
+     {ATOM_TYPE_OG301, ATOM_TYPE_CG331, ATOM_TYPE_HGA3, 108.890000, 384.091200, 0.00000000, 0.00},
+     {ATOM_TYPE_OG302, ATOM_TYPE_CG331, ATOM_TYPE_HGA3, 109.500000, 502.080000, 0.00000000, 0.00},
+     {ATOM_TYPE_OG303, ATOM_TYPE_CG331, ATOM_TYPE_HGA3, 109.500000, 502.080000, 0.00000000, 0.00},
+     {ATOM_TYPE_OG311, ATOM_TYPE_CG331, ATOM_TYPE_HGA3, 108.890000, 384.091200, 0.00000000, 0.00},
+     {ATOM_TYPE_OG312, ATOM_TYPE_CG331, ATOM_TYPE_HGA3, 118.300000, 543.920000, 0.00000000, 0.00},
+     {ATOM_TYPE_SG301, ATOM_TYPE_CG331, ATOM_TYPE_HGA3, 111.000000, 317.984000, 0.00000000, 0.00},
+     {ATOM_TYPE_SG311, ATOM_TYPE_CG331, ATOM_TYPE_HGA3, 111.300000, 385.764800, 0.00000000, 0.00},
+     {ATOM_TYPE_SG3O1, ATOM_TYPE_CG331, ATOM_TYPE_HGA3, 110.600000, 351.456000, 0.00000000, 0.00},
+     {ATOM_TYPE_SG3O2, ATOM_TYPE_CG331, ATOM_TYPE_HGA3, 108.500000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_SG3O3, ATOM_TYPE_CG331, ATOM_TYPE_HGA3, 111.300000, 385.764800, 0.00000000, 0.00},
+     {ATOM_TYPE_HGA3, ATOM_TYPE_CG331, ATOM_TYPE_HGA3, 108.400000, 297.064000, 0.18020000, 4518.72},
+     {ATOM_TYPE_NG2O1, ATOM_TYPE_CG334, ATOM_TYPE_HGA3, 108.000000, 399.990400, 0.00000000, 0.00},
+     {ATOM_TYPE_NG2P1, ATOM_TYPE_CG334, ATOM_TYPE_HGA3, 110.100000, 351.456000, 0.00000000, 0.00},
+     {ATOM_TYPE_NG3P0, ATOM_TYPE_CG334, ATOM_TYPE_HGP5, 109.500000, 334.720000, 0.21300000, 22593.60},
+     {ATOM_TYPE_NG3P1, ATOM_TYPE_CG334, ATOM_TYPE_HGA3, 102.300000, 376.560000, 0.21010000, 29288.00},
+     {ATOM_TYPE_NG3P3, ATOM_TYPE_CG334, ATOM_TYPE_HGA3, 107.500000, 376.560000, 0.21010000, 29288.00},
+     {ATOM_TYPE_HGA3, ATOM_TYPE_CG334, ATOM_TYPE_HGA3, 108.400000, 297.064000, 0.18020000, 4518.72},
+     {ATOM_TYPE_HGP5, ATOM_TYPE_CG334, ATOM_TYPE_HGP5, 109.500000, 200.832000, 0.17670000, 23430.40},
+     {ATOM_TYPE_NG301, ATOM_TYPE_CG3AM0, ATOM_TYPE_HGAAM0, 109.500000, 292.880000, 0.21400000, 41840.00},
+     {ATOM_TYPE_HGAAM0, ATOM_TYPE_CG3AM0, ATOM_TYPE_HGAAM0, 108.400000, 297.064000, 0.18020000, 4518.72},
+     {ATOM_TYPE_NG311, ATOM_TYPE_CG3AM1, ATOM_TYPE_HGAAM1, 109.700000, 255.224000, 0.21400000, 41840.00},
+     {ATOM_TYPE_HGAAM1, ATOM_TYPE_CG3AM1, ATOM_TYPE_HGAAM1, 109.000000, 299.574400, 0.18020000, 4518.72},
+     {ATOM_TYPE_NG321, ATOM_TYPE_CG3AM2, ATOM_TYPE_HGAAM2, 109.500000, 271.123200, 0.21400000, 41840.00},
+     {ATOM_TYPE_HGAAM2, ATOM_TYPE_CG3AM2, ATOM_TYPE_HGAAM2, 109.470000, 292.880000, 0.18020000, 4518.72},
+     {ATOM_TYPE_CG321, ATOM_TYPE_CG3C31, ATOM_TYPE_CG3C31, 116.700000, 563.584800, 0.00000000, 0.00},
+     {ATOM_TYPE_CG321, ATOM_TYPE_CG3C31, ATOM_TYPE_OG3C31, 115.500000, 505.008800, 0.00000000, 0.00},
+     {ATOM_TYPE_CG321, ATOM_TYPE_CG3C31, ATOM_TYPE_HGA1, 115.400000, 251.040000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG324, ATOM_TYPE_CG3C31, ATOM_TYPE_CG3C31, 120.000000, 488.272800, 0.00000000, 0.00},
+     {ATOM_TYPE_CG324, ATOM_TYPE_CG3C31, ATOM_TYPE_HGA1, 110.100000, 289.532800, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3C31, ATOM_TYPE_CG3C31, ATOM_TYPE_CG3C31, 111.000000, 647.264800, 0.25610000, 6694.40},
+     {ATOM_TYPE_CG3C31, ATOM_TYPE_CG3C31, ATOM_TYPE_OG3C31, 103.000000, 251.040000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3C31, ATOM_TYPE_CG3C31, ATOM_TYPE_HGA1, 117.100000, 192.464000, 0.21790000, 18853.10},
+     {ATOM_TYPE_CG3C31, ATOM_TYPE_CG3C31, ATOM_TYPE_HGA2, 117.100000, 192.464000, 0.21790000, 18853.10},
+     {ATOM_TYPE_CG3RC1, ATOM_TYPE_CG3C31, ATOM_TYPE_CG3RC1, 58.500000, 446.432800, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3RC1, ATOM_TYPE_CG3C31, ATOM_TYPE_HGA2, 110.100000, 288.696000, 0.21790000, 18853.10},
+     {ATOM_TYPE_OG3C31, ATOM_TYPE_CG3C31, ATOM_TYPE_HGA1, 118.500000, 535.552000, 0.00000000, 0.00},
+     {ATOM_TYPE_OG3C31, ATOM_TYPE_CG3C31, ATOM_TYPE_HGA2, 115.000000, 573.208000, 0.00000000, 0.00},
+     {ATOM_TYPE_HGA2, ATOM_TYPE_CG3C31, ATOM_TYPE_HGA2, 117.000000, 192.464000, 0.18020000, 4518.72},
+     {ATOM_TYPE_CG2R53, ATOM_TYPE_CG3C41, ATOM_TYPE_CG3C41, 106.000000, 753.120000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R53, ATOM_TYPE_CG3C41, ATOM_TYPE_HGA2, 112.300000, 384.928000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3C41, ATOM_TYPE_CG3C41, ATOM_TYPE_CG3C41, 106.000000, 585.760000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3C41, ATOM_TYPE_CG3C41, ATOM_TYPE_NG2R43, 104.500000, 753.120000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3C41, ATOM_TYPE_CG3C41, ATOM_TYPE_HGA2, 110.500000, 384.928000, 0.00000000, 0.00},
+     {ATOM_TYPE_NG2R43, ATOM_TYPE_CG3C41, ATOM_TYPE_HGA2, 110.800000, 426.768000, 0.00000000, 0.00},
+     {ATOM_TYPE_HGA2, ATOM_TYPE_CG3C41, ATOM_TYPE_HGA2, 105.000000, 234.304000, 0.18067000, 4518.72},
+     {ATOM_TYPE_CG2O1, ATOM_TYPE_CG3C51, ATOM_TYPE_CG3C52, 112.300000, 435.136000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2O1, ATOM_TYPE_CG3C51, ATOM_TYPE_NG2S0, 108.200000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2O1, ATOM_TYPE_CG3C51, ATOM_TYPE_HGA1, 112.000000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2O3, ATOM_TYPE_CG3C51, ATOM_TYPE_CG3C52, 112.300000, 435.136000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2O3, ATOM_TYPE_CG3C51, ATOM_TYPE_NG2S0, 108.200000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2O3, ATOM_TYPE_CG3C51, ATOM_TYPE_HGA1, 112.000000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG311, ATOM_TYPE_CG3C51, ATOM_TYPE_CG3C52, 115.000000, 485.344000, 0.25610000, 6694.40},
+     {ATOM_TYPE_CG311, ATOM_TYPE_CG3C51, ATOM_TYPE_CG3RC1, 108.000000, 435.136000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG311, ATOM_TYPE_CG3C51, ATOM_TYPE_HGA1, 110.100000, 289.532800, 0.21790000, 18853.10},
+     {ATOM_TYPE_CG321, ATOM_TYPE_CG3C51, ATOM_TYPE_CG3C51, 115.000000, 485.344000, 0.25610000, 6694.40},
+     {ATOM_TYPE_CG321, ATOM_TYPE_CG3C51, ATOM_TYPE_CG3C52, 115.000000, 485.344000, 0.25610000, 6694.40},
+     {ATOM_TYPE_CG321, ATOM_TYPE_CG3C51, ATOM_TYPE_CG3RC1, 103.700000, 446.432800, 0.25610000, 6694.40},
+     {ATOM_TYPE_CG321, ATOM_TYPE_CG3C51, ATOM_TYPE_OG3C51, 111.500000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG321, ATOM_TYPE_CG3C51, ATOM_TYPE_HGA1, 110.100000, 289.532800, 0.21790000, 18853.10},
+     {ATOM_TYPE_CG331, ATOM_TYPE_CG3C51, ATOM_TYPE_CG3C51, 115.000000, 485.344000, 0.25610000, 6694.40},
+     {ATOM_TYPE_CG331, ATOM_TYPE_CG3C51, ATOM_TYPE_CG3C52, 115.000000, 485.344000, 0.25610000, 6694.40},
+     {ATOM_TYPE_CG331, ATOM_TYPE_CG3C51, ATOM_TYPE_CG3RC1, 108.500000, 446.432800, 0.25610000, 6694.40},
+     {ATOM_TYPE_CG331, ATOM_TYPE_CG3C51, ATOM_TYPE_OG3C51, 111.500000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG331, ATOM_TYPE_CG3C51, ATOM_TYPE_HGA1, 110.100000, 289.532800, 0.21790000, 18853.10},
+     {ATOM_TYPE_CG3C51, ATOM_TYPE_CG3C51, ATOM_TYPE_CG3C51, 109.500000, 485.344000, 0.25610000, 9338.69},
+     {ATOM_TYPE_CG3C51, ATOM_TYPE_CG3C51, ATOM_TYPE_CG3C52, 109.500000, 485.344000, 0.25610000, 9338.69},
+     {ATOM_TYPE_CG3C51, ATOM_TYPE_CG3C51, ATOM_TYPE_CG3C53, 111.000000, 446.432800, 0.25610000, 6694.40},
+     {ATOM_TYPE_CG3C51, ATOM_TYPE_CG3C51, ATOM_TYPE_CG3RC1, 103.700000, 446.432800, 0.25610000, 6694.40},
+     {ATOM_TYPE_CG3C51, ATOM_TYPE_CG3C51, ATOM_TYPE_NG2R51, 111.000000, 920.480000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3C51, ATOM_TYPE_CG3C51, ATOM_TYPE_NG2R61, 111.000000, 920.480000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3C51, ATOM_TYPE_CG3C51, ATOM_TYPE_NG2S3, 110.000000, 365.681600, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3C51, ATOM_TYPE_CG3C51, ATOM_TYPE_NG301, 111.000000, 920.480000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3C51, ATOM_TYPE_CG3C51, ATOM_TYPE_NG321, 107.500000, 566.513600, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3C51, ATOM_TYPE_CG3C51, ATOM_TYPE_OG303, 109.700000, 962.320000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3C51, ATOM_TYPE_CG3C51, ATOM_TYPE_OG311, 110.100000, 633.457600, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3C51, ATOM_TYPE_CG3C51, ATOM_TYPE_OG3C51, 111.100000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3C51, ATOM_TYPE_CG3C51, ATOM_TYPE_FGA1, 112.000000, 368.192000, 0.23690000, 25104.00},
+     {ATOM_TYPE_CG3C51, ATOM_TYPE_CG3C51, ATOM_TYPE_HGA1, 111.400000, 292.880000, 0.21790000, 18853.10},
+     {ATOM_TYPE_CG3C51, ATOM_TYPE_CG3C51, ATOM_TYPE_HGA6, 111.400000, 292.880000, 0.21790000, 18853.10},
+     {ATOM_TYPE_CG3C52, ATOM_TYPE_CG3C51, ATOM_TYPE_CG3C52, 109.500000, 485.344000, 0.25610000, 9338.69},
+     {ATOM_TYPE_CG3C52, ATOM_TYPE_CG3C51, ATOM_TYPE_CG3RC1, 103.700000, 446.432800, 0.25610000, 6694.40},
+     {ATOM_TYPE_CG3C52, ATOM_TYPE_CG3C51, ATOM_TYPE_NG2R51, 113.700000, 1171.520000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3C52, ATOM_TYPE_CG3C51, ATOM_TYPE_NG2R61, 113.700000, 920.480000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3C52, ATOM_TYPE_CG3C51, ATOM_TYPE_NG2S0, 110.800000, 585.760000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3C52, ATOM_TYPE_CG3C51, ATOM_TYPE_NG2S3, 110.000000, 365.681600, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3C52, ATOM_TYPE_CG3C51, ATOM_TYPE_NG321, 107.500000, 566.513600, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3C52, ATOM_TYPE_CG3C51, ATOM_TYPE_OG301, 106.500000, 485.344000, 0.25610000, 6694.40},
+     {ATOM_TYPE_CG3C52, ATOM_TYPE_CG3C51, ATOM_TYPE_OG303, 109.700000, 962.320000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3C52, ATOM_TYPE_CG3C51, ATOM_TYPE_OG311, 110.000000, 633.457600, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3C52, ATOM_TYPE_CG3C51, ATOM_TYPE_OG3C51, 111.100000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3C52, ATOM_TYPE_CG3C51, ATOM_TYPE_FGA1, 112.000000, 368.192000, 0.23690000, 25104.00},
+     {ATOM_TYPE_CG3C52, ATOM_TYPE_CG3C51, ATOM_TYPE_HGA1, 111.400000, 292.880000, 0.21790000, 18853.10},
+     {ATOM_TYPE_CG3C52, ATOM_TYPE_CG3C51, ATOM_TYPE_HGA6, 111.400000, 292.880000, 0.21790000, 18853.10},
+     {ATOM_TYPE_CG3C53, ATOM_TYPE_CG3C51, ATOM_TYPE_OG311, 110.100000, 633.457600, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3C53, ATOM_TYPE_CG3C51, ATOM_TYPE_HGA1, 110.100000, 288.696000, 0.21790000, 18853.10},
+     {ATOM_TYPE_CG3RC1, ATOM_TYPE_CG3C51, ATOM_TYPE_NG2R51, 108.000000, 920.480000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3RC1, ATOM_TYPE_CG3C51, ATOM_TYPE_NG2R61, 108.000000, 920.480000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3RC1, ATOM_TYPE_CG3C51, ATOM_TYPE_OG303, 110.100000, 633.457600, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3RC1, ATOM_TYPE_CG3C51, ATOM_TYPE_OG311, 110.100000, 633.457600, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3RC1, ATOM_TYPE_CG3C51, ATOM_TYPE_HGA1, 110.100000, 288.696000, 0.21790000, 18853.10},
+     {ATOM_TYPE_NG2R51, ATOM_TYPE_CG3C51, ATOM_TYPE_OG3C51, 108.000000, 1171.520000, 0.00000000, 0.00},
+     {ATOM_TYPE_NG2R51, ATOM_TYPE_CG3C51, ATOM_TYPE_HGA1, 111.000000, 359.824000, 0.00000000, 0.00},
+     {ATOM_TYPE_NG2R61, ATOM_TYPE_CG3C51, ATOM_TYPE_OG3C51, 108.000000, 920.480000, 0.00000000, 0.00},
+     {ATOM_TYPE_NG2R61, ATOM_TYPE_CG3C51, ATOM_TYPE_HGA1, 111.000000, 359.824000, 0.00000000, 0.00},
+     {ATOM_TYPE_NG2S0, ATOM_TYPE_CG3C51, ATOM_TYPE_HGA1, 112.000000, 401.664000, 0.00000000, 0.00},
+     {ATOM_TYPE_NG2S3, ATOM_TYPE_CG3C51, ATOM_TYPE_HGA1, 110.000000, 401.664000, 0.00000000, 0.00},
+     {ATOM_TYPE_NG301, ATOM_TYPE_CG3C51, ATOM_TYPE_OG3C51, 112.000000, 920.480000, 0.00000000, 0.00},
+     {ATOM_TYPE_NG301, ATOM_TYPE_CG3C51, ATOM_TYPE_HGA1, 111.000000, 359.824000, 0.00000000, 0.00},
+     {ATOM_TYPE_NG321, ATOM_TYPE_CG3C51, ATOM_TYPE_HGA1, 109.500000, 271.123200, 0.21400000, 41840.00},
+     {ATOM_TYPE_OG301, ATOM_TYPE_CG3C51, ATOM_TYPE_HGA1, 108.500000, 384.091200, 0.00000000, 0.00},
+     {ATOM_TYPE_OG303, ATOM_TYPE_CG3C51, ATOM_TYPE_HGA1, 109.500000, 502.080000, 0.00000000, 0.00},
+     {ATOM_TYPE_OG311, ATOM_TYPE_CG3C51, ATOM_TYPE_HGA1, 108.890000, 384.091200, 0.00000000, 0.00},
+     {ATOM_TYPE_OG3C51, ATOM_TYPE_CG3C51, ATOM_TYPE_HGA1, 107.300000, 585.760000, 0.00000000, 0.00},
+     {ATOM_TYPE_FGA1, ATOM_TYPE_CG3C51, ATOM_TYPE_HGA6, 108.890000, 481.160000, 0.19970000, 4184.00},
+     {ATOM_TYPE_CG2R51, ATOM_TYPE_CG3C52, ATOM_TYPE_CG2R51, 107.600000, 635.968000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R51, ATOM_TYPE_CG3C52, ATOM_TYPE_CG2R52, 106.000000, 702.912000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R51, ATOM_TYPE_CG3C52, ATOM_TYPE_CG2RC0, 107.300000, 334.720000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R51, ATOM_TYPE_CG3C52, ATOM_TYPE_CG3C52, 106.000000, 435.136000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R51, ATOM_TYPE_CG3C52, ATOM_TYPE_CG3C54, 103.300000, 435.136000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R51, ATOM_TYPE_CG3C52, ATOM_TYPE_NG2R50, 111.600000, 878.640000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R51, ATOM_TYPE_CG3C52, ATOM_TYPE_NG3C51, 105.100000, 585.760000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R51, ATOM_TYPE_CG3C52, ATOM_TYPE_HGA2, 112.600000, 435.136000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R52, ATOM_TYPE_CG3C52, ATOM_TYPE_CG2RC0, 105.000000, 585.760000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R52, ATOM_TYPE_CG3C52, ATOM_TYPE_CG3C52, 99.000000, 669.440000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R52, ATOM_TYPE_CG3C52, ATOM_TYPE_HGA2, 112.200000, 485.344000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R53, ATOM_TYPE_CG3C52, ATOM_TYPE_CG3C52, 106.500000, 585.760000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R53, ATOM_TYPE_CG3C52, ATOM_TYPE_HGA2, 111.000000, 485.344000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2RC0, ATOM_TYPE_CG3C52, ATOM_TYPE_CG2RC0, 95.000000, 334.720000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2RC0, ATOM_TYPE_CG3C52, ATOM_TYPE_CG3C52, 108.200000, 543.920000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2RC0, ATOM_TYPE_CG3C52, ATOM_TYPE_HGA2, 114.000000, 317.984000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3C51, ATOM_TYPE_CG3C52, ATOM_TYPE_CG3C51, 109.500000, 485.344000, 0.25610000, 9338.69},
+     {ATOM_TYPE_CG3C51, ATOM_TYPE_CG3C52, ATOM_TYPE_CG3C52, 109.500000, 485.344000, 0.25610000, 9338.69},
+     {ATOM_TYPE_CG3C51, ATOM_TYPE_CG3C52, ATOM_TYPE_CG3RC1, 105.500000, 669.440000, 0.25610000, 6694.40},
+     {ATOM_TYPE_CG3C51, ATOM_TYPE_CG3C52, ATOM_TYPE_NG3C51, 107.600000, 702.912000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3C51, ATOM_TYPE_CG3C52, ATOM_TYPE_OG3C51, 111.100000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3C51, ATOM_TYPE_CG3C52, ATOM_TYPE_HGA2, 111.400000, 292.880000, 0.21790000, 18853.10},
+     {ATOM_TYPE_CG3C52, ATOM_TYPE_CG3C52, ATOM_TYPE_CG3C52, 109.500000, 485.344000, 0.25610000, 9338.69},
+     {ATOM_TYPE_CG3C52, ATOM_TYPE_CG3C52, ATOM_TYPE_CG3C53, 108.500000, 585.760000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3C52, ATOM_TYPE_CG3C52, ATOM_TYPE_CG3C54, 108.500000, 585.760000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3C52, ATOM_TYPE_CG3C52, ATOM_TYPE_CG3RC1, 111.000000, 446.432800, 0.25610000, 6694.40},
+     {ATOM_TYPE_CG3C52, ATOM_TYPE_CG3C52, ATOM_TYPE_NG2R50, 107.100000, 334.720000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3C52, ATOM_TYPE_CG3C52, ATOM_TYPE_NG2R53, 104.500000, 753.120000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3C52, ATOM_TYPE_CG3C52, ATOM_TYPE_NG2S0, 110.500000, 585.760000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3C52, ATOM_TYPE_CG3C52, ATOM_TYPE_NG3C51, 107.600000, 702.912000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3C52, ATOM_TYPE_CG3C52, ATOM_TYPE_OG3C51, 111.100000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3C52, ATOM_TYPE_CG3C52, ATOM_TYPE_HGA2, 111.400000, 292.880000, 0.21790000, 18853.10},
+     {ATOM_TYPE_CG3C53, ATOM_TYPE_CG3C52, ATOM_TYPE_HGA2, 110.100000, 279.742240, 0.21790000, 18853.10},
+     {ATOM_TYPE_CG3C54, ATOM_TYPE_CG3C52, ATOM_TYPE_NG3C51, 110.400000, 728.016000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3C54, ATOM_TYPE_CG3C52, ATOM_TYPE_HGA2, 110.100000, 221.752000, 0.21790000, 18853.10},
+     {ATOM_TYPE_CG3RC1, ATOM_TYPE_CG3C52, ATOM_TYPE_CG3RC1, 105.300000, 485.344000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3RC1, ATOM_TYPE_CG3C52, ATOM_TYPE_HGA2, 110.100000, 288.696000, 0.21790000, 18853.10},
+     {ATOM_TYPE_NG2R50, ATOM_TYPE_CG3C52, ATOM_TYPE_HGA2, 109.800000, 368.192000, 0.00000000, 0.00},
+     {ATOM_TYPE_NG2R53, ATOM_TYPE_CG3C52, ATOM_TYPE_HGA2, 111.000000, 493.712000, 0.00000000, 0.00},
+     {ATOM_TYPE_NG2S0, ATOM_TYPE_CG3C52, ATOM_TYPE_HGA2, 108.000000, 401.664000, 0.00000000, 0.00},
+     {ATOM_TYPE_NG3C51, ATOM_TYPE_CG3C52, ATOM_TYPE_HGA2, 109.000000, 451.872000, 0.00000000, 0.00},
+     {ATOM_TYPE_OG3C51, ATOM_TYPE_CG3C52, ATOM_TYPE_OG3C51, 108.100000, 711.280000, 0.00000000, 0.00},
+     {ATOM_TYPE_OG3C51, ATOM_TYPE_CG3C52, ATOM_TYPE_HGA2, 107.300000, 585.760000, 0.00000000, 0.00},
+     {ATOM_TYPE_HGA2, ATOM_TYPE_CG3C52, ATOM_TYPE_HGA2, 106.800000, 322.168000, 0.18020000, 4518.72},
+     {ATOM_TYPE_CG2O1, ATOM_TYPE_CG3C53, ATOM_TYPE_CG3C52, 112.300000, 435.136000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2O1, ATOM_TYPE_CG3C53, ATOM_TYPE_NG3P2, 106.000000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2O1, ATOM_TYPE_CG3C53, ATOM_TYPE_HGA1, 112.000000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2O3, ATOM_TYPE_CG3C53, ATOM_TYPE_CG3C52, 112.300000, 435.136000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2O3, ATOM_TYPE_CG3C53, ATOM_TYPE_NG3P2, 106.000000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2O3, ATOM_TYPE_CG3C53, ATOM_TYPE_HGA1, 112.000000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3C51, ATOM_TYPE_CG3C53, ATOM_TYPE_NG2R61, 111.000000, 920.480000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3C51, ATOM_TYPE_CG3C53, ATOM_TYPE_OG3C51, 106.250000, 1004.160000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3C51, ATOM_TYPE_CG3C53, ATOM_TYPE_HGA1, 110.100000, 288.696000, 0.21790000, 18853.10},
+     {ATOM_TYPE_CG3C52, ATOM_TYPE_CG3C53, ATOM_TYPE_NG3P2, 108.500000, 585.760000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3C52, ATOM_TYPE_CG3C53, ATOM_TYPE_HGA1, 118.000000, 292.880000, 0.00000000, 0.00},
+     {ATOM_TYPE_NG2R61, ATOM_TYPE_CG3C53, ATOM_TYPE_OG3C51, 108.000000, 920.480000, 0.00000000, 0.00},
+     {ATOM_TYPE_NG2R61, ATOM_TYPE_CG3C53, ATOM_TYPE_HGA1, 111.000000, 359.824000, 0.00000000, 0.00},
+     {ATOM_TYPE_NG3P2, ATOM_TYPE_CG3C53, ATOM_TYPE_HGA1, 107.500000, 430.952000, 0.00000000, 0.00},
+     {ATOM_TYPE_OG3C51, ATOM_TYPE_CG3C53, ATOM_TYPE_HGA1, 107.240000, 378.233600, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R51, ATOM_TYPE_CG3C54, ATOM_TYPE_NG2R52, 103.100000, 1154.784000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R51, ATOM_TYPE_CG3C54, ATOM_TYPE_NG3P2, 103.000000, 518.816000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R51, ATOM_TYPE_CG3C54, ATOM_TYPE_HGA2, 114.800000, 343.088000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3C52, ATOM_TYPE_CG3C54, ATOM_TYPE_NG3P2, 108.500000, 585.760000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3C52, ATOM_TYPE_CG3C54, ATOM_TYPE_HGA2, 110.100000, 221.752000, 0.21790000, 18853.10},
+     {ATOM_TYPE_CG3C54, ATOM_TYPE_CG3C54, ATOM_TYPE_NG2R52, 106.000000, 569.024000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3C54, ATOM_TYPE_CG3C54, ATOM_TYPE_HGA2, 110.100000, 221.752000, 0.21790000, 18853.10},
+     {ATOM_TYPE_NG2R52, ATOM_TYPE_CG3C54, ATOM_TYPE_HGA2, 107.000000, 451.872000, 0.00000000, 0.00},
+     {ATOM_TYPE_NG3C51, ATOM_TYPE_CG3C54, ATOM_TYPE_NG3P2, 119.000000, 719.648000, 0.00000000, 0.00},
+     {ATOM_TYPE_NG3C51, ATOM_TYPE_CG3C54, ATOM_TYPE_HGA2, 114.600000, 443.504000, 0.00000000, 0.00},
+     {ATOM_TYPE_NG3P2, ATOM_TYPE_CG3C54, ATOM_TYPE_HGA2, 109.150000, 430.952000, 0.00000000, 0.00},
+     {ATOM_TYPE_HGA2, ATOM_TYPE_CG3C54, ATOM_TYPE_HGA2, 109.000000, 297.064000, 0.18020000, 4518.72},
+     {ATOM_TYPE_CG311, ATOM_TYPE_CG3RC1, ATOM_TYPE_CG331, 113.500000, 488.272800, 0.25610000, 9338.69},
+     {ATOM_TYPE_CG311, ATOM_TYPE_CG3RC1, ATOM_TYPE_CG3C51, 113.500000, 488.272800, 0.25610000, 9338.69},
+     {ATOM_TYPE_CG311, ATOM_TYPE_CG3RC1, ATOM_TYPE_CG3C52, 111.000000, 446.432800, 0.25610000, 6694.40},
+     {ATOM_TYPE_CG311, ATOM_TYPE_CG3RC1, ATOM_TYPE_CG3RC1, 108.000000, 446.432800, 0.25610000, 6694.40},
+     {ATOM_TYPE_CG311, ATOM_TYPE_CG3RC1, ATOM_TYPE_HGA1, 110.100000, 288.696000, 0.21790000, 18853.10},
+     {ATOM_TYPE_CG321, ATOM_TYPE_CG3RC1, ATOM_TYPE_CG331, 113.500000, 488.272800, 0.25610000, 9338.69},
+     {ATOM_TYPE_CG321, ATOM_TYPE_CG3RC1, ATOM_TYPE_CG3C31, 111.000000, 446.432800, 0.25610000, 6694.40},
+     {ATOM_TYPE_CG321, ATOM_TYPE_CG3RC1, ATOM_TYPE_CG3C51, 111.000000, 446.432800, 0.25610000, 6694.40},
+     {ATOM_TYPE_CG321, ATOM_TYPE_CG3RC1, ATOM_TYPE_CG3C52, 113.500000, 488.272800, 0.25610000, 9338.69},
+     {ATOM_TYPE_CG321, ATOM_TYPE_CG3RC1, ATOM_TYPE_CG3RC1, 111.000000, 446.432800, 0.25610000, 6694.40},
+     {ATOM_TYPE_CG321, ATOM_TYPE_CG3RC1, ATOM_TYPE_HGA1, 110.100000, 288.696000, 0.21790000, 18853.10},
+     {ATOM_TYPE_CG331, ATOM_TYPE_CG3RC1, ATOM_TYPE_CG3C51, 113.500000, 488.272800, 0.25610000, 9338.69},
+     {ATOM_TYPE_CG331, ATOM_TYPE_CG3RC1, ATOM_TYPE_CG3RC1, 113.500000, 488.272800, 0.25610000, 9338.69},
+     {ATOM_TYPE_CG3C31, ATOM_TYPE_CG3RC1, ATOM_TYPE_CG3C51, 111.000000, 446.432800, 0.25610000, 6694.40},
+     {ATOM_TYPE_CG3C31, ATOM_TYPE_CG3RC1, ATOM_TYPE_CG3C52, 111.000000, 446.432800, 0.25610000, 6694.40},
+     {ATOM_TYPE_CG3C31, ATOM_TYPE_CG3RC1, ATOM_TYPE_CG3RC1, 62.500000, 446.432800, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3C31, ATOM_TYPE_CG3RC1, ATOM_TYPE_NG2R51, 113.700000, 585.760000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3C31, ATOM_TYPE_CG3RC1, ATOM_TYPE_NG2R61, 113.700000, 585.760000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3C31, ATOM_TYPE_CG3RC1, ATOM_TYPE_HGA1, 110.100000, 288.696000, 0.21790000, 18853.10},
+     {ATOM_TYPE_CG3C51, ATOM_TYPE_CG3RC1, ATOM_TYPE_CG3C52, 109.000000, 585.760000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3C51, ATOM_TYPE_CG3RC1, ATOM_TYPE_CG3RC1, 108.000000, 446.432800, 0.25610000, 6694.40},
+     {ATOM_TYPE_CG3C51, ATOM_TYPE_CG3RC1, ATOM_TYPE_HGA1, 110.100000, 288.696000, 0.21790000, 18853.10},
+     {ATOM_TYPE_CG3C52, ATOM_TYPE_CG3RC1, ATOM_TYPE_CG3C52, 109.400000, 468.608000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3C52, ATOM_TYPE_CG3RC1, ATOM_TYPE_CG3RC1, 111.000000, 446.432800, 0.25610000, 6694.40},
+     {ATOM_TYPE_CG3C52, ATOM_TYPE_CG3RC1, ATOM_TYPE_NG2R51, 113.700000, 585.760000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3C52, ATOM_TYPE_CG3RC1, ATOM_TYPE_NG2R61, 113.700000, 585.760000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3C52, ATOM_TYPE_CG3RC1, ATOM_TYPE_HGA1, 110.100000, 288.696000, 0.21790000, 18853.10},
+     {ATOM_TYPE_CG3RC1, ATOM_TYPE_CG3RC1, ATOM_TYPE_NG2R51, 113.700000, 585.760000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3RC1, ATOM_TYPE_CG3RC1, ATOM_TYPE_NG2R61, 113.700000, 585.760000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3RC1, ATOM_TYPE_CG3RC1, ATOM_TYPE_OG3C51, 109.000000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3RC1, ATOM_TYPE_CG3RC1, ATOM_TYPE_HGA1, 110.100000, 288.696000, 0.21790000, 18853.10},
+     {ATOM_TYPE_OG3C51, ATOM_TYPE_CG3RC1, ATOM_TYPE_OG3C51, 105.000000, 585.760000, 0.00000000, 0.00},
+     {ATOM_TYPE_OG3C51, ATOM_TYPE_CG3RC1, ATOM_TYPE_HGA1, 106.000000, 460.240000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2D1, ATOM_TYPE_NG2D1, ATOM_TYPE_CG331, 111.000000, 560.656000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2D1, ATOM_TYPE_NG2D1, ATOM_TYPE_NG2S1, 115.000000, 836.800000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2DC1, ATOM_TYPE_NG2D1, ATOM_TYPE_NG2S1, 115.000000, 836.800000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2DC2, ATOM_TYPE_NG2D1, ATOM_TYPE_NG2S1, 115.000000, 836.800000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2N1, ATOM_TYPE_NG2D1, ATOM_TYPE_CG331, 108.000000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2N1, ATOM_TYPE_NG2D1, ATOM_TYPE_HGP1, 113.000000, 410.032000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_NG2O1, ATOM_TYPE_OG2N1, 116.000000, 543.920000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG324, ATOM_TYPE_NG2O1, ATOM_TYPE_OG2N1, 117.000000, 468.608000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG334, ATOM_TYPE_NG2O1, ATOM_TYPE_OG2N1, 120.000000, 502.080000, 0.00000000, 0.00},
+     {ATOM_TYPE_OG2N1, ATOM_TYPE_NG2O1, ATOM_TYPE_OG2N1, 128.000000, 878.640000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2D1, ATOM_TYPE_NG2P1, ATOM_TYPE_CG334, 123.600000, 560.656000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2D1, ATOM_TYPE_NG2P1, ATOM_TYPE_HGP2, 118.800000, 317.984000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2DC1, ATOM_TYPE_NG2P1, ATOM_TYPE_CG334, 123.600000, 560.656000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2DC1, ATOM_TYPE_NG2P1, ATOM_TYPE_HGP2, 118.800000, 317.984000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2DC2, ATOM_TYPE_NG2P1, ATOM_TYPE_CG334, 123.600000, 560.656000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2DC2, ATOM_TYPE_NG2P1, ATOM_TYPE_HGP2, 118.800000, 317.984000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2N1, ATOM_TYPE_NG2P1, ATOM_TYPE_CG324, 120.000000, 521.326400, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2N1, ATOM_TYPE_NG2P1, ATOM_TYPE_CG334, 120.000000, 521.326400, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2N1, ATOM_TYPE_NG2P1, ATOM_TYPE_HGP2, 120.000000, 410.032000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2N2, ATOM_TYPE_NG2P1, ATOM_TYPE_HGP2, 120.000000, 334.720000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG324, ATOM_TYPE_NG2P1, ATOM_TYPE_HGP2, 120.000000, 338.067200, 0.00000000, 0.00},
+     {ATOM_TYPE_CG334, ATOM_TYPE_NG2P1, ATOM_TYPE_HGP2, 120.000000, 338.067200, 0.00000000, 0.00},
+     {ATOM_TYPE_HGP2, ATOM_TYPE_NG2P1, ATOM_TYPE_HGP2, 120.000000, 209.200000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R53, ATOM_TYPE_NG2R43, ATOM_TYPE_CG3C41, 111.500000, 711.280000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R53, ATOM_TYPE_NG2R43, ATOM_TYPE_HGP1, 129.700000, 284.512000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3C41, ATOM_TYPE_NG2R43, ATOM_TYPE_HGP1, 125.300000, 284.512000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R51, ATOM_TYPE_NG2R50, ATOM_TYPE_CG2R52, 103.000000, 485.344000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R51, ATOM_TYPE_NG2R50, ATOM_TYPE_CG2R53, 103.500000, 1087.840000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R51, ATOM_TYPE_NG2R50, ATOM_TYPE_NG2R50, 106.800000, 920.480000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R52, ATOM_TYPE_NG2R50, ATOM_TYPE_CG2RC0, 103.000000, 502.080000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R52, ATOM_TYPE_NG2R50, ATOM_TYPE_CG3C52, 102.900000, 962.320000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R52, ATOM_TYPE_NG2R50, ATOM_TYPE_NG2R51, 103.500000, 1338.880000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R52, ATOM_TYPE_NG2R50, ATOM_TYPE_NG3C51, 105.500000, 1338.880000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R52, ATOM_TYPE_NG2R50, ATOM_TYPE_OG2R50, 103.300000, 1255.200000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R52, ATOM_TYPE_NG2R50, ATOM_TYPE_SG2R50, 111.000000, 1255.200000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R53, ATOM_TYPE_NG2R50, ATOM_TYPE_CG2R53, 101.000000, 836.800000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R53, ATOM_TYPE_NG2R50, ATOM_TYPE_CG2RC0, 103.800000, 1004.160000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R53, ATOM_TYPE_NG2R50, ATOM_TYPE_CG3C52, 101.900000, 1338.880000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R53, ATOM_TYPE_NG2R50, ATOM_TYPE_NG2R51, 101.000000, 836.800000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R53, ATOM_TYPE_NG2R50, ATOM_TYPE_OG2R50, 103.000000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_NG2R50, ATOM_TYPE_NG2R50, ATOM_TYPE_NG2R51, 102.200000, 1338.880000, 0.00000000, 0.00},
+     {ATOM_TYPE_NG2R50, ATOM_TYPE_NG2R50, ATOM_TYPE_OG2R50, 103.000000, 920.480000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R51, ATOM_TYPE_NG2R51, ATOM_TYPE_CG2R51, 109.000000, 836.800000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R51, ATOM_TYPE_NG2R51, ATOM_TYPE_CG2R53, 107.500000, 1087.840000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R51, ATOM_TYPE_NG2R51, ATOM_TYPE_CG2RC0, 110.000000, 711.280000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R51, ATOM_TYPE_NG2R51, ATOM_TYPE_CG3C51, 126.000000, 1087.840000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R51, ATOM_TYPE_NG2R51, ATOM_TYPE_NG2R50, 115.000000, 1338.880000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R51, ATOM_TYPE_NG2R51, ATOM_TYPE_HGP1, 125.500000, 251.040000, 0.21500000, 16736.00},
+     {ATOM_TYPE_CG2R53, ATOM_TYPE_NG2R51, ATOM_TYPE_CG2RC0, 107.200000, 836.800000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R53, ATOM_TYPE_NG2R51, ATOM_TYPE_CG331, 127.800000, 585.760000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R53, ATOM_TYPE_NG2R51, ATOM_TYPE_CG3C51, 126.300000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R53, ATOM_TYPE_NG2R51, ATOM_TYPE_CG3RC1, 127.600000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R53, ATOM_TYPE_NG2R51, ATOM_TYPE_NG2R50, 114.000000, 1087.840000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R53, ATOM_TYPE_NG2R51, ATOM_TYPE_HGP1, 127.000000, 251.040000, 0.21400000, 16736.00},
+     {ATOM_TYPE_CG2RC0, ATOM_TYPE_NG2R51, ATOM_TYPE_CG2RC0, 110.000000, 711.280000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2RC0, ATOM_TYPE_NG2R51, ATOM_TYPE_CG331, 125.900000, 585.760000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2RC0, ATOM_TYPE_NG2R51, ATOM_TYPE_CG3C51, 126.500000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2RC0, ATOM_TYPE_NG2R51, ATOM_TYPE_CG3RC1, 126.500000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2RC0, ATOM_TYPE_NG2R51, ATOM_TYPE_NG2R50, 114.500000, 1589.920000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2RC0, ATOM_TYPE_NG2R51, ATOM_TYPE_HGP1, 126.000000, 234.304000, 0.00000000, 0.00},
+     {ATOM_TYPE_NG2R50, ATOM_TYPE_NG2R51, ATOM_TYPE_HGP1, 119.500000, 267.776000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R51, ATOM_TYPE_NG2R52, ATOM_TYPE_CG2R53, 108.000000, 1213.360000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R51, ATOM_TYPE_NG2R52, ATOM_TYPE_HGP2, 124.900000, 209.200000, 0.21300000, 12552.00},
+     {ATOM_TYPE_CG2R52, ATOM_TYPE_NG2R52, ATOM_TYPE_CG3C54, 111.900000, 845.168000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R52, ATOM_TYPE_NG2R52, ATOM_TYPE_HGP2, 123.200000, 242.672000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R53, ATOM_TYPE_NG2R52, ATOM_TYPE_CG3C54, 108.000000, 1171.520000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R53, ATOM_TYPE_NG2R52, ATOM_TYPE_HGP2, 127.100000, 209.200000, 0.20900000, 12552.00},
+     {ATOM_TYPE_CG3C54, ATOM_TYPE_NG2R52, ATOM_TYPE_HGP2, 124.900000, 242.672000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG251O, ATOM_TYPE_NG2R53, ATOM_TYPE_CG2R53, 117.500000, 970.688000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG251O, ATOM_TYPE_NG2R53, ATOM_TYPE_HGP1, 123.000000, 317.984000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG252O, ATOM_TYPE_NG2R53, ATOM_TYPE_CG2R53, 117.500000, 970.688000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG252O, ATOM_TYPE_NG2R53, ATOM_TYPE_HGP1, 123.000000, 317.984000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R53, ATOM_TYPE_NG2R53, ATOM_TYPE_CG2R53, 120.500000, 460.240000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R53, ATOM_TYPE_NG2R53, ATOM_TYPE_CG311, 120.000000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R53, ATOM_TYPE_NG2R53, ATOM_TYPE_CG3C52, 111.000000, 627.600000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R53, ATOM_TYPE_NG2R53, ATOM_TYPE_HGP1, 119.500000, 317.984000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3C52, ATOM_TYPE_NG2R53, ATOM_TYPE_HGP1, 116.000000, 317.984000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_NG2R60, ATOM_TYPE_CG2R61, 112.000000, 167.360000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_NG2R60, ATOM_TYPE_CG2R64, 112.000000, 167.360000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R62, ATOM_TYPE_NG2R61, ATOM_TYPE_CG2R62, 120.000000, 251.040000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R62, ATOM_TYPE_NG2R61, ATOM_TYPE_CG2R63, 122.000000, 585.760000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R62, ATOM_TYPE_NG2R61, ATOM_TYPE_CG331, 120.500000, 585.760000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R62, ATOM_TYPE_NG2R61, ATOM_TYPE_CG3C51, 118.400000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R62, ATOM_TYPE_NG2R61, ATOM_TYPE_CG3C53, 118.400000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R62, ATOM_TYPE_NG2R61, ATOM_TYPE_CG3RC1, 115.900000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R62, ATOM_TYPE_NG2R61, ATOM_TYPE_HGP1, 117.400000, 267.776000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R62, ATOM_TYPE_NG2R61, ATOM_TYPE_HGP2, 117.400000, 267.776000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R63, ATOM_TYPE_NG2R61, ATOM_TYPE_CG2R63, 130.200000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R63, ATOM_TYPE_NG2R61, ATOM_TYPE_CG2R64, 131.100000, 585.760000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R63, ATOM_TYPE_NG2R61, ATOM_TYPE_CG331, 115.400000, 585.760000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R63, ATOM_TYPE_NG2R61, ATOM_TYPE_CG3C51, 118.400000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R63, ATOM_TYPE_NG2R61, ATOM_TYPE_CG3RC1, 120.000000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R63, ATOM_TYPE_NG2R61, ATOM_TYPE_HGP1, 115.400000, 338.904000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R64, ATOM_TYPE_NG2R61, ATOM_TYPE_HGP1, 115.600000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_NG2R62, ATOM_TYPE_CG2R64, 110.500000, 334.720000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_NG2R62, ATOM_TYPE_NG2R62, 120.000000, 83.680000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R63, ATOM_TYPE_NG2R62, ATOM_TYPE_CG2R64, 119.100000, 711.280000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R64, ATOM_TYPE_NG2R62, ATOM_TYPE_CG2R64, 117.800000, 753.120000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R64, ATOM_TYPE_NG2R62, ATOM_TYPE_CG2RC0, 115.100000, 753.120000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R64, ATOM_TYPE_NG2R62, ATOM_TYPE_NG2R62, 121.000000, 543.920000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R51, ATOM_TYPE_NG2RC0, ATOM_TYPE_CG2R61, 130.500000, 125.520000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R51, ATOM_TYPE_NG2RC0, ATOM_TYPE_CG2RC0, 109.700000, 836.800000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_NG2RC0, ATOM_TYPE_CG2RC0, 119.800000, 125.520000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2O1, ATOM_TYPE_NG2S0, ATOM_TYPE_CG331, 119.500000, 351.456000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2O1, ATOM_TYPE_NG2S0, ATOM_TYPE_CG3C51, 117.000000, 502.080000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2O1, ATOM_TYPE_NG2S0, ATOM_TYPE_CG3C52, 117.000000, 502.080000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG331, ATOM_TYPE_NG2S0, ATOM_TYPE_CG331, 121.000000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3C51, ATOM_TYPE_NG2S0, ATOM_TYPE_CG3C52, 114.200000, 836.800000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2O1, ATOM_TYPE_NG2S1, ATOM_TYPE_CG2R61, 120.000000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2O1, ATOM_TYPE_NG2S1, ATOM_TYPE_CG2R64, 120.000000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2O1, ATOM_TYPE_NG2S1, ATOM_TYPE_CG311, 120.000000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2O1, ATOM_TYPE_NG2S1, ATOM_TYPE_CG321, 120.000000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2O1, ATOM_TYPE_NG2S1, ATOM_TYPE_CG331, 120.000000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2O1, ATOM_TYPE_NG2S1, ATOM_TYPE_NG2D1, 115.000000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2O1, ATOM_TYPE_NG2S1, ATOM_TYPE_HGP1, 123.000000, 284.512000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2O6, ATOM_TYPE_NG2S1, ATOM_TYPE_CG321, 120.000000, 502.080000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2O6, ATOM_TYPE_NG2S1, ATOM_TYPE_CG331, 120.000000, 502.080000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2O6, ATOM_TYPE_NG2S1, ATOM_TYPE_HGP1, 121.500000, 334.720000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_NG2S1, ATOM_TYPE_HGP1, 117.000000, 284.512000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R64, ATOM_TYPE_NG2S1, ATOM_TYPE_HGP1, 117.000000, 284.512000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG311, ATOM_TYPE_NG2S1, ATOM_TYPE_HGP1, 117.000000, 292.880000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG321, ATOM_TYPE_NG2S1, ATOM_TYPE_HGP1, 117.000000, 292.880000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG331, ATOM_TYPE_NG2S1, ATOM_TYPE_HGP1, 117.000000, 292.880000, 0.00000000, 0.00},
+     {ATOM_TYPE_NG2D1, ATOM_TYPE_NG2S1, ATOM_TYPE_HGP1, 122.000000, 284.512000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2O1, ATOM_TYPE_NG2S2, ATOM_TYPE_HGP1, 120.000000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2O6, ATOM_TYPE_NG2S2, ATOM_TYPE_HGP1, 120.000000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_HGP1, ATOM_TYPE_NG2S2, ATOM_TYPE_HGP1, 120.000000, 192.464000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_NG2S3, ATOM_TYPE_HGP4, 111.600000, 502.080000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R64, ATOM_TYPE_NG2S3, ATOM_TYPE_HGP4, 121.500000, 334.720000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG331, ATOM_TYPE_NG2S3, ATOM_TYPE_PG1, 118.300000, 920.480000, 0.23300000, 29288.00},
+     {ATOM_TYPE_CG331, ATOM_TYPE_NG2S3, ATOM_TYPE_HGP1, 109.000000, 292.880000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3C51, ATOM_TYPE_NG2S3, ATOM_TYPE_PG1, 118.300000, 920.480000, 0.23300000, 29288.00},
+     {ATOM_TYPE_CG3C51, ATOM_TYPE_NG2S3, ATOM_TYPE_HGP1, 109.000000, 292.880000, 0.00000000, 0.00},
+     {ATOM_TYPE_PG1, ATOM_TYPE_NG2S3, ATOM_TYPE_HGP1, 123.600000, 251.040000, 0.23500000, 33472.00},
+     {ATOM_TYPE_HGP4, ATOM_TYPE_NG2S3, ATOM_TYPE_HGP4, 117.000000, 259.408000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2D1O, ATOM_TYPE_NG301, ATOM_TYPE_CG2D1O, 114.000000, 167.360000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2D1O, ATOM_TYPE_NG301, ATOM_TYPE_CG3C51, 121.700000, 585.760000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2D2O, ATOM_TYPE_NG301, ATOM_TYPE_CG2D2O, 114.000000, 167.360000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2D2O, ATOM_TYPE_NG301, ATOM_TYPE_CG3C51, 121.700000, 585.760000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3AM0, ATOM_TYPE_NG301, ATOM_TYPE_CG3AM0, 110.900000, 443.504000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2D1O, ATOM_TYPE_NG311, ATOM_TYPE_CG2D1O, 114.000000, 167.360000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2D1O, ATOM_TYPE_NG311, ATOM_TYPE_HGPAM1, 123.000000, 326.352000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2D2O, ATOM_TYPE_NG311, ATOM_TYPE_CG2D2O, 114.000000, 167.360000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2D2O, ATOM_TYPE_NG311, ATOM_TYPE_HGPAM1, 123.000000, 326.352000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2N1, ATOM_TYPE_NG311, ATOM_TYPE_CG331, 106.000000, 359.824000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2N1, ATOM_TYPE_NG311, ATOM_TYPE_HGPAM1, 106.000000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_NG311, ATOM_TYPE_CG2R61, 109.000000, 334.720000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_NG311, ATOM_TYPE_CG321, 113.000000, 460.240000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_NG311, ATOM_TYPE_SG3O2, 115.000000, 292.880000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_NG311, ATOM_TYPE_HGP1, 114.000000, 334.720000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_NG311, ATOM_TYPE_HGPAM1, 115.000000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG321, ATOM_TYPE_NG311, ATOM_TYPE_SG3O2, 115.000000, 502.080000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG321, ATOM_TYPE_NG311, ATOM_TYPE_HGP1, 111.000000, 384.928000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG321, ATOM_TYPE_NG311, ATOM_TYPE_HGPAM1, 111.000000, 292.880000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG331, ATOM_TYPE_NG311, ATOM_TYPE_SG3O2, 114.000000, 569.024000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG331, ATOM_TYPE_NG311, ATOM_TYPE_HGP1, 111.500000, 353.966400, 0.00000000, 0.00},
+     {ATOM_TYPE_CG331, ATOM_TYPE_NG311, ATOM_TYPE_HGPAM1, 104.000000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3AM1, ATOM_TYPE_NG311, ATOM_TYPE_CG3AM1, 112.200000, 338.904000, 0.24217000, 4184.00},
+     {ATOM_TYPE_CG3AM1, ATOM_TYPE_NG311, ATOM_TYPE_HGPAM1, 108.900000, 352.292800, 0.20292000, 4184.00},
+     {ATOM_TYPE_SG3O2, ATOM_TYPE_NG311, ATOM_TYPE_HGP1, 113.200000, 353.966400, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2D1O, ATOM_TYPE_NG321, ATOM_TYPE_HGPAM2, 113.000000, 460.240000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2D2O, ATOM_TYPE_NG321, ATOM_TYPE_HGPAM2, 113.000000, 460.240000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2N1, ATOM_TYPE_NG321, ATOM_TYPE_HGPAM2, 108.000000, 460.240000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG321, ATOM_TYPE_NG321, ATOM_TYPE_HGPAM2, 112.100000, 343.088000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3AM2, ATOM_TYPE_NG321, ATOM_TYPE_HGPAM2, 112.100000, 343.088000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3C51, ATOM_TYPE_NG321, ATOM_TYPE_HGPAM2, 112.100000, 343.088000, 0.00000000, 0.00},
+     {ATOM_TYPE_SG3O2, ATOM_TYPE_NG321, ATOM_TYPE_HGP1, 115.000000, 410.032000, 0.00000000, 0.00},
+     {ATOM_TYPE_HGP1, ATOM_TYPE_NG321, ATOM_TYPE_HGP1, 110.000000, 317.984000, 0.00000000, 0.00},
+     {ATOM_TYPE_HGPAM2, ATOM_TYPE_NG321, ATOM_TYPE_HGPAM2, 105.850000, 351.456000, 0.00000000, 0.00},
+     {ATOM_TYPE_HGPAM3, ATOM_TYPE_NG331, ATOM_TYPE_HGPAM3, 107.100000, 347.272000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R51, ATOM_TYPE_NG3C51, ATOM_TYPE_CG3C52, 104.800000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R51, ATOM_TYPE_NG3C51, ATOM_TYPE_HGP1, 113.900000, 359.824000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R53, ATOM_TYPE_NG3C51, ATOM_TYPE_CG3C52, 107.000000, 334.720000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R53, ATOM_TYPE_NG3C51, ATOM_TYPE_HGP1, 115.600000, 359.824000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2RC0, ATOM_TYPE_NG3C51, ATOM_TYPE_CG3C52, 106.900000, 502.080000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2RC0, ATOM_TYPE_NG3C51, ATOM_TYPE_HGP1, 114.500000, 343.088000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3C52, ATOM_TYPE_NG3C51, ATOM_TYPE_CG3C52, 103.700000, 1171.520000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3C52, ATOM_TYPE_NG3C51, ATOM_TYPE_CG3C54, 104.100000, 560.656000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3C52, ATOM_TYPE_NG3C51, ATOM_TYPE_NG2R50, 109.000000, 393.296000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3C52, ATOM_TYPE_NG3C51, ATOM_TYPE_NG3P2, 103.900000, 393.296000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3C52, ATOM_TYPE_NG3C51, ATOM_TYPE_HGP1, 112.000000, 359.824000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3C54, ATOM_TYPE_NG3C51, ATOM_TYPE_HGP1, 109.250000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_NG2R50, ATOM_TYPE_NG3C51, ATOM_TYPE_HGP1, 103.600000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_NG3P2, ATOM_TYPE_NG3C51, ATOM_TYPE_HGP1, 100.600000, 468.608000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_NG3N1, ATOM_TYPE_NG3N1, 112.000000, 502.080000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_NG3N1, ATOM_TYPE_HGP1, 115.000000, 435.136000, 0.00000000, 0.00},
+     {ATOM_TYPE_NG3N1, ATOM_TYPE_NG3N1, ATOM_TYPE_HGP1, 102.000000, 460.240000, 0.00000000, 0.00},
+     {ATOM_TYPE_HGP1, ATOM_TYPE_NG3N1, ATOM_TYPE_HGP1, 102.000000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG324, ATOM_TYPE_NG3P0, ATOM_TYPE_CG324, 109.500000, 502.080000, 0.24660000, 21756.80},
+     {ATOM_TYPE_CG324, ATOM_TYPE_NG3P0, ATOM_TYPE_CG334, 109.500000, 502.080000, 0.24660000, 21756.80},
+     {ATOM_TYPE_CG334, ATOM_TYPE_NG3P0, ATOM_TYPE_CG334, 109.500000, 502.080000, 0.24660000, 21756.80},
+     {ATOM_TYPE_CG334, ATOM_TYPE_NG3P0, ATOM_TYPE_OG311, 100.000000, 577.392000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG334, ATOM_TYPE_NG3P0, ATOM_TYPE_OG312, 112.000000, 669.440000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG324, ATOM_TYPE_NG3P1, ATOM_TYPE_CG324, 115.200000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG324, ATOM_TYPE_NG3P1, ATOM_TYPE_CG334, 109.500000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG324, ATOM_TYPE_NG3P1, ATOM_TYPE_HGP2, 110.800000, 251.040000, 0.20740000, 22593.60},
+     {ATOM_TYPE_CG334, ATOM_TYPE_NG3P1, ATOM_TYPE_HGP2, 110.800000, 251.040000, 0.20740000, 22593.60},
+     {ATOM_TYPE_CG2R51, ATOM_TYPE_NG3P2, ATOM_TYPE_CG3C54, 107.000000, 711.280000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R51, ATOM_TYPE_NG3P2, ATOM_TYPE_HGP2, 112.000000, 317.984000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG314, ATOM_TYPE_NG3P2, ATOM_TYPE_CG324, 115.200000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG314, ATOM_TYPE_NG3P2, ATOM_TYPE_HGP2, 110.800000, 251.040000, 0.20740000, 22593.60},
+     {ATOM_TYPE_CG324, ATOM_TYPE_NG3P2, ATOM_TYPE_CG324, 115.200000, 334.720000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG324, ATOM_TYPE_NG3P2, ATOM_TYPE_HGP2, 110.800000, 251.040000, 0.20740000, 22593.60},
+     {ATOM_TYPE_CG3C53, ATOM_TYPE_NG3P2, ATOM_TYPE_CG3C54, 111.000000, 836.800000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3C53, ATOM_TYPE_NG3P2, ATOM_TYPE_HGP2, 109.500000, 276.144000, 0.20560000, 3347.20},
+     {ATOM_TYPE_CG3C54, ATOM_TYPE_NG3P2, ATOM_TYPE_CG3C54, 113.000000, 870.272000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3C54, ATOM_TYPE_NG3P2, ATOM_TYPE_NG3C51, 114.200000, 1129.680000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3C54, ATOM_TYPE_NG3P2, ATOM_TYPE_HGP2, 109.500000, 276.144000, 0.20560000, 3347.20},
+     {ATOM_TYPE_NG3C51, ATOM_TYPE_NG3P2, ATOM_TYPE_HGP2, 106.300000, 351.456000, 0.00000000, 0.00},
+     {ATOM_TYPE_HGP2, ATOM_TYPE_NG3P2, ATOM_TYPE_HGP2, 107.500000, 426.768000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG314, ATOM_TYPE_NG3P3, ATOM_TYPE_HGP2, 109.500000, 251.040000, 0.20740000, 16736.00},
+     {ATOM_TYPE_CG324, ATOM_TYPE_NG3P3, ATOM_TYPE_HGP2, 109.500000, 251.040000, 0.20740000, 16736.00},
+     {ATOM_TYPE_CG334, ATOM_TYPE_NG3P3, ATOM_TYPE_HGP2, 109.500000, 251.040000, 0.20740000, 16736.00},
+     {ATOM_TYPE_HGP2, ATOM_TYPE_NG3P3, ATOM_TYPE_HGP2, 109.500000, 368.192000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R51, ATOM_TYPE_OG2R50, ATOM_TYPE_CG2R51, 106.000000, 836.800000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R51, ATOM_TYPE_OG2R50, ATOM_TYPE_CG2R53, 104.000000, 1171.520000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R51, ATOM_TYPE_OG2R50, ATOM_TYPE_CG2RC0, 104.000000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R51, ATOM_TYPE_OG2R50, ATOM_TYPE_NG2R50, 108.500000, 1255.200000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R53, ATOM_TYPE_OG2R50, ATOM_TYPE_NG2R50, 109.300000, 1380.720000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2D1O, ATOM_TYPE_OG301, ATOM_TYPE_CG331, 109.000000, 443.504000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2D2O, ATOM_TYPE_OG301, ATOM_TYPE_CG331, 109.000000, 443.504000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_OG301, ATOM_TYPE_CG2R61, 120.000000, 1548.080000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_OG301, ATOM_TYPE_CG321, 108.000000, 543.920000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_OG301, ATOM_TYPE_CG331, 108.000000, 543.920000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG301, ATOM_TYPE_OG301, ATOM_TYPE_CG331, 109.700000, 794.960000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG311, ATOM_TYPE_OG301, ATOM_TYPE_CG331, 109.700000, 794.960000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG321, ATOM_TYPE_OG301, ATOM_TYPE_CG321, 109.700000, 794.960000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG321, ATOM_TYPE_OG301, ATOM_TYPE_CG331, 109.700000, 794.960000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG331, ATOM_TYPE_OG301, ATOM_TYPE_CG331, 109.700000, 794.960000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG331, ATOM_TYPE_OG301, ATOM_TYPE_CG3C51, 107.000000, 543.920000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2O2, ATOM_TYPE_OG302, ATOM_TYPE_CG301, 109.600000, 334.720000, 0.22651000, 25104.00},
+     {ATOM_TYPE_CG2O2, ATOM_TYPE_OG302, ATOM_TYPE_CG311, 109.600000, 334.720000, 0.22651000, 25104.00},
+     {ATOM_TYPE_CG2O2, ATOM_TYPE_OG302, ATOM_TYPE_CG321, 109.600000, 334.720000, 0.22651000, 25104.00},
+     {ATOM_TYPE_CG2O2, ATOM_TYPE_OG302, ATOM_TYPE_CG331, 109.600000, 334.720000, 0.22651000, 25104.00},
+     {ATOM_TYPE_CG2O6, ATOM_TYPE_OG302, ATOM_TYPE_CG321, 111.000000, 334.720000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2O6, ATOM_TYPE_OG302, ATOM_TYPE_CG331, 111.000000, 334.720000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_OG303, ATOM_TYPE_PG1, 120.000000, 753.120000, 0.23000000, 16736.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_OG303, ATOM_TYPE_SG3O2, 108.000000, 276.144000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG311, ATOM_TYPE_OG303, ATOM_TYPE_PG2, 120.000000, 167.360000, 0.23300000, 29288.00},
+     {ATOM_TYPE_CG321, ATOM_TYPE_OG303, ATOM_TYPE_PG1, 120.000000, 167.360000, 0.23300000, 29288.00},
+     {ATOM_TYPE_CG321, ATOM_TYPE_OG303, ATOM_TYPE_PG2, 120.000000, 167.360000, 0.23300000, 29288.00},
+     {ATOM_TYPE_CG321, ATOM_TYPE_OG303, ATOM_TYPE_SG3O1, 109.000000, 125.520000, 0.19000000, 22593.60},
+     {ATOM_TYPE_CG331, ATOM_TYPE_OG303, ATOM_TYPE_PG0, 120.000000, 167.360000, 0.23300000, 29288.00},
+     {ATOM_TYPE_CG331, ATOM_TYPE_OG303, ATOM_TYPE_PG1, 120.000000, 167.360000, 0.23300000, 29288.00},
+     {ATOM_TYPE_CG331, ATOM_TYPE_OG303, ATOM_TYPE_PG2, 120.000000, 167.360000, 0.23300000, 29288.00},
+     {ATOM_TYPE_CG331, ATOM_TYPE_OG303, ATOM_TYPE_SG3O1, 109.000000, 125.520000, 0.19000000, 22593.60},
+     {ATOM_TYPE_CG331, ATOM_TYPE_OG303, ATOM_TYPE_SG3O2, 113.000000, 401.664000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3C51, ATOM_TYPE_OG303, ATOM_TYPE_PG1, 120.000000, 167.360000, 0.23300000, 29288.00},
+     {ATOM_TYPE_CG3C51, ATOM_TYPE_OG303, ATOM_TYPE_PG2, 120.000000, 167.360000, 0.23300000, 29288.00},
+     {ATOM_TYPE_PG1, ATOM_TYPE_OG304, ATOM_TYPE_PG1, 143.000000, 376.560000, 0.32500000, 33472.00},
+     {ATOM_TYPE_PG1, ATOM_TYPE_OG304, ATOM_TYPE_PG2, 139.500000, 376.560000, 0.30500000, 33472.00},
+     {ATOM_TYPE_CG2O2, ATOM_TYPE_OG311, ATOM_TYPE_HGP1, 115.000000, 460.240000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_OG311, ATOM_TYPE_HGP1, 108.000000, 543.920000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG301, ATOM_TYPE_OG311, ATOM_TYPE_HGP1, 106.000000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG311, ATOM_TYPE_OG311, ATOM_TYPE_HGP1, 106.000000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG321, ATOM_TYPE_OG311, ATOM_TYPE_HGP1, 106.000000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG331, ATOM_TYPE_OG311, ATOM_TYPE_HGP1, 106.000000, 481.160000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3C51, ATOM_TYPE_OG311, ATOM_TYPE_HGP1, 109.000000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_NG3P0, ATOM_TYPE_OG311, ATOM_TYPE_HGP1, 101.500000, 502.080000, 0.00000000, 0.00},
+     {ATOM_TYPE_PG0, ATOM_TYPE_OG311, ATOM_TYPE_HGP1, 115.000000, 251.040000, 0.23500000, 33472.00},
+     {ATOM_TYPE_PG1, ATOM_TYPE_OG311, ATOM_TYPE_HGP1, 115.000000, 251.040000, 0.23500000, 33472.00},
+     {ATOM_TYPE_CG3C31, ATOM_TYPE_OG3C31, ATOM_TYPE_CG3C31, 97.000000, 421.328800, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R51, ATOM_TYPE_OG3C51, ATOM_TYPE_CG3C52, 104.400000, 1046.000000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2RC0, ATOM_TYPE_OG3C51, ATOM_TYPE_CG3C52, 108.050000, 635.968000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3C51, ATOM_TYPE_OG3C51, ATOM_TYPE_CG3C51, 111.000000, 794.960000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3C51, ATOM_TYPE_OG3C51, ATOM_TYPE_CG3C52, 111.000000, 794.960000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3C51, ATOM_TYPE_OG3C51, ATOM_TYPE_CG3C53, 108.000000, 920.480000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3C52, ATOM_TYPE_OG3C51, ATOM_TYPE_CG3C52, 111.000000, 794.960000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG3C52, ATOM_TYPE_OG3C51, ATOM_TYPE_CG3RC1, 109.000000, 1422.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG321, ATOM_TYPE_OG3C61, ATOM_TYPE_CG321, 109.700000, 794.960000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2D1O, ATOM_TYPE_OG3R60, ATOM_TYPE_CG2D1O, 99.000000, 334.720000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2D1O, ATOM_TYPE_OG3R60, ATOM_TYPE_CG321, 99.000000, 167.360000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2D2O, ATOM_TYPE_OG3R60, ATOM_TYPE_CG2D2O, 99.000000, 334.720000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2D2O, ATOM_TYPE_OG3R60, ATOM_TYPE_CG321, 99.000000, 167.360000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_OG3R60, ATOM_TYPE_CG2R61, 115.000000, 334.720000, 0.00000000, 0.00},
+     {ATOM_TYPE_OG2P1, ATOM_TYPE_PG0, ATOM_TYPE_OG303, 111.600000, 827.595200, 0.00000000, 0.00},
+     {ATOM_TYPE_OG2P1, ATOM_TYPE_PG0, ATOM_TYPE_OG311, 108.230000, 827.595200, 0.00000000, 0.00},
+     {ATOM_TYPE_OG303, ATOM_TYPE_PG0, ATOM_TYPE_OG311, 108.000000, 402.500800, 0.00000000, 0.00},
+     {ATOM_TYPE_OG311, ATOM_TYPE_PG0, ATOM_TYPE_OG311, 104.000000, 827.595200, 0.00000000, 0.00},
+     {ATOM_TYPE_CG312, ATOM_TYPE_PG1, ATOM_TYPE_OG2P1, 94.000000, 827.595200, 0.00000000, 0.00},
+     {ATOM_TYPE_CG312, ATOM_TYPE_PG1, ATOM_TYPE_OG311, 90.000000, 753.956800, 0.00000000, 0.00},
+     {ATOM_TYPE_CG321, ATOM_TYPE_PG1, ATOM_TYPE_OG2P1, 103.000000, 827.595200, 0.00000000, 0.00},
+     {ATOM_TYPE_CG321, ATOM_TYPE_PG1, ATOM_TYPE_OG311, 94.000000, 753.956800, 0.00000000, 0.00},
+     {ATOM_TYPE_NG2S3, ATOM_TYPE_PG1, ATOM_TYPE_OG2P1, 110.600000, 1171.520000, 0.00000000, 0.00},
+     {ATOM_TYPE_NG2S3, ATOM_TYPE_PG1, ATOM_TYPE_OG303, 103.200000, 502.080000, 0.00000000, 0.00},
+     {ATOM_TYPE_OG2P1, ATOM_TYPE_PG1, ATOM_TYPE_OG2P1, 120.000000, 870.272000, 0.00000000, 0.00},
+     {ATOM_TYPE_OG2P1, ATOM_TYPE_PG1, ATOM_TYPE_OG303, 107.500000, 827.595200, 0.00000000, 0.00},
+     {ATOM_TYPE_OG2P1, ATOM_TYPE_PG1, ATOM_TYPE_OG304, 111.600000, 743.915200, 0.00000000, 0.00},
+     {ATOM_TYPE_OG2P1, ATOM_TYPE_PG1, ATOM_TYPE_OG311, 111.000000, 827.595200, 0.00000000, 0.00},
+     {ATOM_TYPE_OG303, ATOM_TYPE_PG1, ATOM_TYPE_OG303, 104.300000, 669.440000, 0.00000000, 0.00},
+     {ATOM_TYPE_OG303, ATOM_TYPE_PG1, ATOM_TYPE_OG304, 105.000000, 402.500800, 0.00000000, 0.00},
+     {ATOM_TYPE_OG303, ATOM_TYPE_PG1, ATOM_TYPE_OG311, 108.000000, 402.500800, 0.00000000, 0.00},
+     {ATOM_TYPE_OG304, ATOM_TYPE_PG1, ATOM_TYPE_OG304, 107.500000, 402.500800, 0.00000000, 0.00},
+     {ATOM_TYPE_OG304, ATOM_TYPE_PG1, ATOM_TYPE_OG311, 111.000000, 402.500800, 0.00000000, 0.00},
+     {ATOM_TYPE_CG312, ATOM_TYPE_PG2, ATOM_TYPE_OG2P1, 94.000000, 827.595200, 0.00000000, 0.00},
+     {ATOM_TYPE_CG321, ATOM_TYPE_PG2, ATOM_TYPE_OG2P1, 103.000000, 827.595200, 0.00000000, 0.00},
+     {ATOM_TYPE_OG2P1, ATOM_TYPE_PG2, ATOM_TYPE_OG2P1, 121.000000, 870.272000, 0.00000000, 0.00},
+     {ATOM_TYPE_OG2P1, ATOM_TYPE_PG2, ATOM_TYPE_OG303, 111.000000, 743.915200, 0.00000000, 0.00},
+     {ATOM_TYPE_OG2P1, ATOM_TYPE_PG2, ATOM_TYPE_OG304, 111.600000, 743.915200, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R51, ATOM_TYPE_SG2R50, ATOM_TYPE_CG2R51, 95.000000, 878.640000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R51, ATOM_TYPE_SG2R50, ATOM_TYPE_CG2R53, 97.000000, 920.480000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R51, ATOM_TYPE_SG2R50, ATOM_TYPE_CG2RC0, 99.500000, 585.760000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R51, ATOM_TYPE_SG2R50, ATOM_TYPE_NG2R50, 103.000000, 1255.200000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R53, ATOM_TYPE_SG2R50, ATOM_TYPE_CG2RC0, 97.000000, 920.480000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG321, ATOM_TYPE_SG301, ATOM_TYPE_SG301, 103.300000, 606.680000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG331, ATOM_TYPE_SG301, ATOM_TYPE_SG301, 103.300000, 606.680000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG251O, ATOM_TYPE_SG311, ATOM_TYPE_CG2R53, 92.000000, 627.600000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG252O, ATOM_TYPE_SG311, ATOM_TYPE_CG2R53, 92.000000, 627.600000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2O6, ATOM_TYPE_SG311, ATOM_TYPE_CG331, 96.000000, 502.080000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_SG311, ATOM_TYPE_CG2R61, 109.000000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG321, ATOM_TYPE_SG311, ATOM_TYPE_CG321, 95.000000, 284.512000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG321, ATOM_TYPE_SG311, ATOM_TYPE_CG331, 95.000000, 284.512000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG321, ATOM_TYPE_SG311, ATOM_TYPE_HGP3, 95.000000, 324.678400, 0.00000000, 0.00},
+     {ATOM_TYPE_CG331, ATOM_TYPE_SG311, ATOM_TYPE_HGP3, 95.000000, 359.824000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_SG3O1, ATOM_TYPE_OG2P1, 98.000000, 711.280000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG321, ATOM_TYPE_SG3O1, ATOM_TYPE_OG2P1, 99.000000, 669.440000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG331, ATOM_TYPE_SG3O1, ATOM_TYPE_OG2P1, 100.000000, 711.280000, 0.00000000, 0.00},
+     {ATOM_TYPE_OG2P1, ATOM_TYPE_SG3O1, ATOM_TYPE_OG2P1, 109.470000, 1087.840000, 0.24500000, 29288.00},
+     {ATOM_TYPE_OG2P1, ATOM_TYPE_SG3O1, ATOM_TYPE_OG303, 98.000000, 711.280000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_SG3O2, ATOM_TYPE_NG311, 97.000000, 585.760000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_SG3O2, ATOM_TYPE_NG321, 98.000000, 502.080000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_SG3O2, ATOM_TYPE_OG2P1, 101.000000, 502.080000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG321, ATOM_TYPE_SG3O2, ATOM_TYPE_CG331, 102.000000, 669.440000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG321, ATOM_TYPE_SG3O2, ATOM_TYPE_NG311, 101.000000, 518.816000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG321, ATOM_TYPE_SG3O2, ATOM_TYPE_OG2P1, 107.500000, 627.600000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG331, ATOM_TYPE_SG3O2, ATOM_TYPE_CG331, 102.000000, 669.440000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG331, ATOM_TYPE_SG3O2, ATOM_TYPE_NG311, 103.000000, 610.864000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG331, ATOM_TYPE_SG3O2, ATOM_TYPE_NG321, 101.000000, 694.544000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG331, ATOM_TYPE_SG3O2, ATOM_TYPE_OG2P1, 108.500000, 661.072000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG331, ATOM_TYPE_SG3O2, ATOM_TYPE_OG303, 96.000000, 778.224000, 0.00000000, 0.00},
+     {ATOM_TYPE_NG311, ATOM_TYPE_SG3O2, ATOM_TYPE_OG2P1, 110.500000, 627.600000, 0.00000000, 0.00},
+     {ATOM_TYPE_NG321, ATOM_TYPE_SG3O2, ATOM_TYPE_OG2P1, 111.000000, 669.440000, 0.00000000, 0.00},
+     {ATOM_TYPE_NG321, ATOM_TYPE_SG3O2, ATOM_TYPE_OG303, 102.000000, 836.800000, 0.00000000, 0.00},
+     {ATOM_TYPE_OG2P1, ATOM_TYPE_SG3O2, ATOM_TYPE_OG2P1, 121.000000, 711.280000, 0.00000000, 0.00},
+     {ATOM_TYPE_OG2P1, ATOM_TYPE_SG3O2, ATOM_TYPE_OG303, 109.000000, 753.120000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG321, ATOM_TYPE_SG3O3, ATOM_TYPE_CG331, 95.000000, 711.280000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG321, ATOM_TYPE_SG3O3, ATOM_TYPE_OG2P1, 106.500000, 543.920000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG331, ATOM_TYPE_SG3O3, ATOM_TYPE_CG331, 95.000000, 284.512000, 0.00000000, 0.00},
+     {ATOM_TYPE_CG331, ATOM_TYPE_SG3O3, ATOM_TYPE_OG2P1, 106.750000, 661.072000, 0.00000000, 0.00},
+     {ATOM_TYPE_FGP1, ATOM_TYPE_ALG1, ATOM_TYPE_FGP1, 109.470000, 192.464000, 0.28185500, 12552.00},
+     {ATOM_TYPE_CC311, ATOM_TYPE_CC311, ATOM_TYPE_CC321, 111.000000, 446.432800, 0.25610000, 6694.40},
+     {ATOM_TYPE_CC322, ATOM_TYPE_CC312, ATOM_TYPE_CC322, 111.000000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_CC312, ATOM_TYPE_CC312, ATOM_TYPE_CC322, 111.000000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_CC312, ATOM_TYPE_CC2O3, ATOM_TYPE_OC2D3, 121.500000, 627.600000, 0.00000000, 0.00},
+     {ATOM_TYPE_CC331, ATOM_TYPE_CC2O3, ATOM_TYPE_OC2D3, 121.500000, 627.600000, 0.00000000, 0.00},
+     {ATOM_TYPE_CC322, ATOM_TYPE_CC2O3, ATOM_TYPE_OC2D3, 121.500000, 627.600000, 0.00000000, 0.00},
+     {ATOM_TYPE_CC331, ATOM_TYPE_CC2O3, ATOM_TYPE_CC331, 116.000000, 292.880000, 0.00000000, 0.00},
+     {ATOM_TYPE_CC312, ATOM_TYPE_CC2O3, ATOM_TYPE_CC322, 116.000000, 292.880000, 0.00000000, 0.00},
+     {ATOM_TYPE_CC322, ATOM_TYPE_CC2O3, ATOM_TYPE_CC322, 116.000000, 292.880000, 0.00000000, 0.00},
+     {ATOM_TYPE_CC312, ATOM_TYPE_CC312, ATOM_TYPE_CC2O3, 113.800000, 502.080000, 0.00000000, 0.00},
+     {ATOM_TYPE_CC2O3, ATOM_TYPE_CC331, ATOM_TYPE_HCA3, 109.500000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_CC2O3, ATOM_TYPE_CC322, ATOM_TYPE_HCA2, 109.500000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_HCA1, ATOM_TYPE_CC312, ATOM_TYPE_CC2O3, 109.500000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_OC311, ATOM_TYPE_CC312, ATOM_TYPE_CC2O3, 108.890000, 460.240000, 0.00000000, 0.00},
+     {ATOM_TYPE_CC2O3, ATOM_TYPE_CC322, ATOM_TYPE_OC311, 108.890000, 460.240000, 0.00000000, 0.00},
+     {ATOM_TYPE_OC2D4, ATOM_TYPE_CC2O4, ATOM_TYPE_HCR1, 118.000000, 543.920000, 0.00000000, 0.00},
+     {ATOM_TYPE_HCR1, ATOM_TYPE_CC2O4, ATOM_TYPE_CC331, 116.000000, 543.920000, 0.00000000, 0.00},
+     {ATOM_TYPE_HCR1, ATOM_TYPE_CC2O4, ATOM_TYPE_CC312, 116.000000, 543.920000, 0.00000000, 0.00},
+     {ATOM_TYPE_CC312, ATOM_TYPE_CC2O4, ATOM_TYPE_OC2D4, 126.000000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_CC331, ATOM_TYPE_CC2O4, ATOM_TYPE_OC2D4, 126.000000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_CC312, ATOM_TYPE_CC312, ATOM_TYPE_CC2O4, 113.800000, 502.080000, 0.00000000, 0.00},
+     {ATOM_TYPE_OC311, ATOM_TYPE_CC312, ATOM_TYPE_CC2O4, 108.890000, 460.240000, 0.00000000, 0.00},
+     {ATOM_TYPE_CC2O4, ATOM_TYPE_CC312, ATOM_TYPE_HCA1, 109.500000, 276.144000, 0.21630000, 25104.00},
+     {ATOM_TYPE_CC2O4, ATOM_TYPE_CC331, ATOM_TYPE_HCA3, 109.500000, 276.144000, 0.21630000, 25104.00},
+     {ATOM_TYPE_CC3161, ATOM_TYPE_CC3161, ATOM_TYPE_CC3161, 111.000000, 446.432800, 0.25610000, 6694.40},
+     {ATOM_TYPE_CC3261, ATOM_TYPE_CC3161, ATOM_TYPE_CC3161, 111.000000, 446.432800, 0.25610000, 6694.40},
+     {ATOM_TYPE_CC3161, ATOM_TYPE_CC3161, ATOM_TYPE_CC3163, 111.000000, 446.432800, 0.25610000, 6694.40},
+     {ATOM_TYPE_CC3161, ATOM_TYPE_CC3161, ATOM_TYPE_CC3263, 111.000000, 446.432800, 0.25610000, 6694.40},
+     {ATOM_TYPE_CC312, ATOM_TYPE_CC312, ATOM_TYPE_CC312, 111.000000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_CC3162, ATOM_TYPE_CC3161, ATOM_TYPE_CC3161, 111.000000, 446.432800, 0.25610000, 6694.40},
+     {ATOM_TYPE_CC3163, ATOM_TYPE_CC312, ATOM_TYPE_CC312, 111.000000, 446.432800, 0.25610000, 6694.40},
+     {ATOM_TYPE_CC3062, ATOM_TYPE_CC3261, ATOM_TYPE_CC3161, 113.500000, 488.272800, 0.25610000, 9338.69},
+     {ATOM_TYPE_CC3161, ATOM_TYPE_CC3163, ATOM_TYPE_CC321, 113.500000, 488.272800, 0.25610000, 9338.69},
+     {ATOM_TYPE_CC3161, ATOM_TYPE_CC3163, ATOM_TYPE_CC312, 113.500000, 488.272800, 0.25610000, 9338.69},
+     {ATOM_TYPE_CC3161, ATOM_TYPE_CC3163, ATOM_TYPE_CC331, 113.500000, 488.272800, 0.25610000, 9338.69},
+     {ATOM_TYPE_CC2O2, ATOM_TYPE_CC311, ATOM_TYPE_CC331, 108.000000, 435.136000, 0.00000000, 0.00},
+     {ATOM_TYPE_CC2O2, ATOM_TYPE_CC3163, ATOM_TYPE_CC3161, 108.000000, 435.136000, 0.00000000, 0.00},
+     {ATOM_TYPE_CC2O2, ATOM_TYPE_CC301, ATOM_TYPE_CC331, 112.000000, 435.136000, 0.00000000, 0.00},
+     {ATOM_TYPE_CC2O2, ATOM_TYPE_CC3062, ATOM_TYPE_CC3261, 112.000000, 435.136000, 0.00000000, 0.00},
+     {ATOM_TYPE_CC321, ATOM_TYPE_CC321, ATOM_TYPE_CC321, 113.600000, 488.272800, 0.25610000, 9338.69},
+     {ATOM_TYPE_CC331, ATOM_TYPE_CC321, ATOM_TYPE_CC321, 115.000000, 485.344000, 0.25610000, 6694.40},
+     {ATOM_TYPE_CC331, ATOM_TYPE_CC311, ATOM_TYPE_CC331, 114.000000, 446.432800, 0.25610000, 6694.40},
+     {ATOM_TYPE_CC321C, ATOM_TYPE_CC321C, ATOM_TYPE_CC321C, 112.000000, 488.272800, 0.25610000, 9338.69},
+     {ATOM_TYPE_CC321C, ATOM_TYPE_CC311C, ATOM_TYPE_CC321C, 112.000000, 488.272800, 0.25610000, 9338.69},
+     {ATOM_TYPE_CC321D, ATOM_TYPE_CC321C, ATOM_TYPE_CC311C, 112.000000, 488.272800, 0.25610000, 9338.69},
+     {ATOM_TYPE_CC321D, ATOM_TYPE_CC311C, ATOM_TYPE_CC321C, 112.000000, 488.272800, 0.25610000, 9338.69},
+     {ATOM_TYPE_CC321D, ATOM_TYPE_CC321C, ATOM_TYPE_CC321C, 112.000000, 488.272800, 0.25610000, 9338.69},
+     {ATOM_TYPE_CC311D, ATOM_TYPE_CC321C, ATOM_TYPE_CC321C, 112.000000, 488.272800, 0.25610000, 9338.69},
+     {ATOM_TYPE_CC311C, ATOM_TYPE_CC321C, ATOM_TYPE_CC321C, 112.000000, 488.272800, 0.25610000, 9338.69},
+     {ATOM_TYPE_CC321C, ATOM_TYPE_CC321D, ATOM_TYPE_CC321C, 112.000000, 488.272800, 0.25610000, 9338.69},
+     {ATOM_TYPE_CC321, ATOM_TYPE_CC311C, ATOM_TYPE_CC321C, 113.500000, 488.272800, 0.25610000, 9338.69},
+     {ATOM_TYPE_CC2O2, ATOM_TYPE_CC321, ATOM_TYPE_CC331, 108.000000, 435.136000, 0.00000000, 0.00},
+     {ATOM_TYPE_CC312, ATOM_TYPE_CC312, ATOM_TYPE_HCA1, 110.100000, 288.696000, 0.21790000, 18853.10},
+     {ATOM_TYPE_CC312, ATOM_TYPE_CC3163, ATOM_TYPE_HCA1, 110.100000, 288.696000, 0.21790000, 18853.10},
+     {ATOM_TYPE_CC3161, ATOM_TYPE_CC3161, ATOM_TYPE_HCA1, 110.100000, 288.696000, 0.21790000, 18853.10},
+     {ATOM_TYPE_CC3161, ATOM_TYPE_CC3162, ATOM_TYPE_HCA1, 110.100000, 288.696000, 0.21790000, 18853.10},
+     {ATOM_TYPE_CC3261, ATOM_TYPE_CC3161, ATOM_TYPE_HCA1, 110.100000, 288.696000, 0.21790000, 18853.10},
+     {ATOM_TYPE_CC3162, ATOM_TYPE_CC3161, ATOM_TYPE_HCA1, 110.100000, 288.696000, 0.21790000, 18853.10},
+     {ATOM_TYPE_CC3163, ATOM_TYPE_CC3161, ATOM_TYPE_HCA1, 110.100000, 288.696000, 0.21790000, 18853.10},
+     {ATOM_TYPE_CC3161, ATOM_TYPE_CC3163, ATOM_TYPE_HCA1, 110.100000, 288.696000, 0.21790000, 18853.10},
+     {ATOM_TYPE_CC3163, ATOM_TYPE_CC312, ATOM_TYPE_HCA1, 110.100000, 288.696000, 0.21790000, 18853.10},
+     {ATOM_TYPE_CC322, ATOM_TYPE_CC312, ATOM_TYPE_HCA1, 110.100000, 288.696000, 0.21790000, 18853.10},
+     {ATOM_TYPE_CC321, ATOM_TYPE_CC3163, ATOM_TYPE_HCA1, 110.100000, 288.696000, 0.21790000, 18853.10},
+     {ATOM_TYPE_CC331, ATOM_TYPE_CC311, ATOM_TYPE_HCA1, 110.100000, 288.696000, 0.21790000, 18853.10},
+     {ATOM_TYPE_CC331, ATOM_TYPE_CC3163, ATOM_TYPE_HCA1, 110.100000, 288.696000, 0.21790000, 18853.10},
+     {ATOM_TYPE_CC3263, ATOM_TYPE_CC3161, ATOM_TYPE_HCA1, 110.100000, 288.696000, 0.21790000, 18853.10},
+     {ATOM_TYPE_CC321, ATOM_TYPE_CC311, ATOM_TYPE_HCA1, 110.100000, 288.696000, 0.21790000, 18853.10},
+     {ATOM_TYPE_CC312, ATOM_TYPE_CC322, ATOM_TYPE_HCA2, 110.100000, 279.742240, 0.21790000, 18853.10},
+     {ATOM_TYPE_CC3163, ATOM_TYPE_CC321, ATOM_TYPE_HCA2, 110.100000, 279.742240, 0.21790000, 18853.10},
+     {ATOM_TYPE_CC3062, ATOM_TYPE_CC3261, ATOM_TYPE_HCA2, 110.100000, 279.742240, 0.21790000, 18853.10},
+     {ATOM_TYPE_CC3161, ATOM_TYPE_CC3261, ATOM_TYPE_HCA2, 110.100000, 279.742240, 0.21790000, 18853.10},
+     {ATOM_TYPE_CC311, ATOM_TYPE_CC321, ATOM_TYPE_HCA2, 110.100000, 279.742240, 0.21790000, 18853.10},
+     {ATOM_TYPE_CC3161, ATOM_TYPE_CC3263, ATOM_TYPE_HCA2, 110.100000, 279.742240, 0.21790000, 18853.10},
+     {ATOM_TYPE_CC3163, ATOM_TYPE_CC331, ATOM_TYPE_HCA3, 110.100000, 279.742240, 0.21790000, 18853.10},
+     {ATOM_TYPE_CC311, ATOM_TYPE_CC331, ATOM_TYPE_HCA3, 110.100000, 279.742240, 0.21790000, 18853.10},
+     {ATOM_TYPE_CC301, ATOM_TYPE_CC331, ATOM_TYPE_HCA3, 110.100000, 279.742240, 0.21790000, 18853.10},
+     {ATOM_TYPE_CC2O2, ATOM_TYPE_CC3163, ATOM_TYPE_HCA1, 109.500000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_CC2O2, ATOM_TYPE_CC311, ATOM_TYPE_HCA1, 109.500000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_CC2O1, ATOM_TYPE_CC331, ATOM_TYPE_HCA3, 109.500000, 276.144000, 0.21630000, 25104.00},
+     {ATOM_TYPE_HCA1, ATOM_TYPE_CC311C, ATOM_TYPE_CC321, 110.100000, 288.696000, 0.21790000, 18853.10},
+     {ATOM_TYPE_HCA1, ATOM_TYPE_CC311D, ATOM_TYPE_CC321C, 110.100000, 288.696000, 0.21790000, 18853.10},
+     {ATOM_TYPE_HCA1, ATOM_TYPE_CC311C, ATOM_TYPE_CC321C, 110.100000, 288.696000, 0.21790000, 18853.10},
+     {ATOM_TYPE_HCA1, ATOM_TYPE_CC311C, ATOM_TYPE_CC321D, 110.100000, 288.696000, 0.21790000, 18853.10},
+     {ATOM_TYPE_HCA2, ATOM_TYPE_CC321, ATOM_TYPE_CC311C, 110.100000, 279.742240, 0.21790000, 18853.10},
+     {ATOM_TYPE_HCA2, ATOM_TYPE_CC321, ATOM_TYPE_CC321, 110.100000, 221.752000, 0.21790000, 18853.10},
+     {ATOM_TYPE_HCA2, ATOM_TYPE_CC321, ATOM_TYPE_CC331, 110.100000, 289.532800, 0.21790000, 18853.10},
+     {ATOM_TYPE_HCA3, ATOM_TYPE_CC331, ATOM_TYPE_CC321, 110.100000, 289.532800, 0.21790000, 18853.10},
+     {ATOM_TYPE_HCA2, ATOM_TYPE_CC321C, ATOM_TYPE_CC321C, 110.100000, 288.696000, 0.21790000, 18853.10},
+     {ATOM_TYPE_HCA2, ATOM_TYPE_CC321D, ATOM_TYPE_CC321C, 110.100000, 288.696000, 0.21790000, 18853.10},
+     {ATOM_TYPE_HCA2, ATOM_TYPE_CC321C, ATOM_TYPE_CC321D, 110.100000, 288.696000, 0.21790000, 18853.10},
+     {ATOM_TYPE_HCA2, ATOM_TYPE_CC321C, ATOM_TYPE_CC311D, 110.100000, 288.696000, 0.21790000, 18853.10},
+     {ATOM_TYPE_HCA2, ATOM_TYPE_CC321C, ATOM_TYPE_CC311C, 110.100000, 288.696000, 0.21790000, 18853.10},
+     {ATOM_TYPE_HCA2, ATOM_TYPE_CC321D, ATOM_TYPE_CC311C, 110.100000, 288.696000, 0.21790000, 18853.10},
+     {ATOM_TYPE_CC2O2, ATOM_TYPE_CC321, ATOM_TYPE_HCA2, 109.500000, 276.144000, 0.21630000, 25104.00},
+     {ATOM_TYPE_CC3161, ATOM_TYPE_CC3161, ATOM_TYPE_NC2D1, 113.500000, 585.760000, 0.00000000, 0.00},
+     {ATOM_TYPE_CC3162, ATOM_TYPE_CC3161, ATOM_TYPE_NC2D1, 113.500000, 585.760000, 0.00000000, 0.00},
+     {ATOM_TYPE_CC3163, ATOM_TYPE_CC3161, ATOM_TYPE_NC2D1, 113.500000, 585.760000, 0.00000000, 0.00},
+     {ATOM_TYPE_CC331, ATOM_TYPE_CC311, ATOM_TYPE_NC2D1, 113.500000, 585.760000, 0.00000000, 0.00},
+     {ATOM_TYPE_NC2D1, ATOM_TYPE_CC2O1, ATOM_TYPE_CC331, 116.500000, 669.440000, 0.00000000, 0.00},
+     {ATOM_TYPE_CC3161, ATOM_TYPE_NC2D1, ATOM_TYPE_CC2O1, 120.000000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_CC2O1, ATOM_TYPE_NC2D1, ATOM_TYPE_CC311, 120.000000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_CC2O1, ATOM_TYPE_NC2D1, ATOM_TYPE_CC331, 120.000000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_NC2D1, ATOM_TYPE_CC2O1, ATOM_TYPE_OC2D1, 122.500000, 669.440000, 0.00000000, 0.00},
+     {ATOM_TYPE_NC2D1, ATOM_TYPE_CC3161, ATOM_TYPE_HCA1, 108.000000, 401.664000, 0.00000000, 0.00},
+     {ATOM_TYPE_NC2D1, ATOM_TYPE_CC311, ATOM_TYPE_HCA1, 108.000000, 401.664000, 0.00000000, 0.00},
+     {ATOM_TYPE_NC2D1, ATOM_TYPE_CC331, ATOM_TYPE_HCA3, 109.500000, 430.952000, 0.00000000, 0.00},
+     {ATOM_TYPE_HCP1, ATOM_TYPE_NC2D1, ATOM_TYPE_CC2O1, 123.000000, 284.512000, 0.00000000, 0.00},
+     {ATOM_TYPE_CC3161, ATOM_TYPE_NC2D1, ATOM_TYPE_HCP1, 117.000000, 292.880000, 0.00000000, 0.00},
+     {ATOM_TYPE_HCP1, ATOM_TYPE_NC2D1, ATOM_TYPE_CC311, 117.000000, 292.880000, 0.00000000, 0.00},
+     {ATOM_TYPE_HCP1, ATOM_TYPE_NC2D1, ATOM_TYPE_CC331, 117.000000, 292.880000, 0.00000000, 0.00},
+     {ATOM_TYPE_HCA2, ATOM_TYPE_CC321, ATOM_TYPE_HCA2, 109.000000, 297.064000, 0.18020000, 4518.72},
+     {ATOM_TYPE_HCA2, ATOM_TYPE_CC322, ATOM_TYPE_HCA2, 109.000000, 297.064000, 0.18020000, 4518.72},
+     {ATOM_TYPE_HCA2, ATOM_TYPE_CC321C, ATOM_TYPE_HCA2, 109.000000, 297.064000, 0.18020000, 4518.72},
+     {ATOM_TYPE_HCA2, ATOM_TYPE_CC321D, ATOM_TYPE_HCA2, 109.000000, 297.064000, 0.18020000, 4518.72},
+     {ATOM_TYPE_HCA2, ATOM_TYPE_CC3261, ATOM_TYPE_HCA2, 109.000000, 297.064000, 0.18020000, 4518.72},
+     {ATOM_TYPE_HCA2, ATOM_TYPE_CC3263, ATOM_TYPE_HCA2, 109.000000, 297.064000, 0.18020000, 4518.72},
+     {ATOM_TYPE_HCA3, ATOM_TYPE_CC331, ATOM_TYPE_HCA3, 108.400000, 297.064000, 0.18020000, 4518.72},
+     {ATOM_TYPE_CC3161, ATOM_TYPE_CC3163, ATOM_TYPE_OC3C61, 110.000000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_CC3161, ATOM_TYPE_CC3263, ATOM_TYPE_OC3C61, 110.000000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_CC3161, ATOM_TYPE_CC3162, ATOM_TYPE_OC3C61, 106.000000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_OC3C61, ATOM_TYPE_CC3062, ATOM_TYPE_CC3261, 111.500000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_CC321, ATOM_TYPE_CC3163, ATOM_TYPE_OC3C61, 109.000000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_CC312, ATOM_TYPE_CC3163, ATOM_TYPE_OC3C61, 109.000000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_CC331, ATOM_TYPE_CC3163, ATOM_TYPE_OC3C61, 111.500000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_CC2O2, ATOM_TYPE_CC311, ATOM_TYPE_OC301, 103.000000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_CC2O2, ATOM_TYPE_CC3163, ATOM_TYPE_OC3C61, 103.000000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_CC2O2, ATOM_TYPE_CC301, ATOM_TYPE_OC301, 103.000000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_CC2O2, ATOM_TYPE_CC3062, ATOM_TYPE_OC301, 103.000000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_CC2O2, ATOM_TYPE_CC3062, ATOM_TYPE_OC3C61, 103.000000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_CC3161, ATOM_TYPE_CC3162, ATOM_TYPE_OC311, 107.000000, 633.457600, 0.00000000, 0.00},
+     {ATOM_TYPE_CC312, ATOM_TYPE_CC312, ATOM_TYPE_OC311, 108.000000, 633.457600, 0.00000000, 0.00},
+     {ATOM_TYPE_CC3161, ATOM_TYPE_CC3161, ATOM_TYPE_OC311, 110.100000, 633.457600, 0.00000000, 0.00},
+     {ATOM_TYPE_CC3261, ATOM_TYPE_CC3161, ATOM_TYPE_OC311, 110.100000, 633.457600, 0.00000000, 0.00},
+     {ATOM_TYPE_CC3162, ATOM_TYPE_CC3161, ATOM_TYPE_OC311, 110.100000, 633.457600, 0.00000000, 0.00},
+     {ATOM_TYPE_CC3163, ATOM_TYPE_CC3161, ATOM_TYPE_OC311, 110.100000, 633.457600, 0.00000000, 0.00},
+     {ATOM_TYPE_CC3163, ATOM_TYPE_CC312, ATOM_TYPE_OC311, 110.100000, 633.457600, 0.00000000, 0.00},
+     {ATOM_TYPE_CC3263, ATOM_TYPE_CC3161, ATOM_TYPE_OC311, 110.100000, 633.457600, 0.00000000, 0.00},
+     {ATOM_TYPE_CC312, ATOM_TYPE_CC322, ATOM_TYPE_OC311, 106.000000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_CC3163, ATOM_TYPE_CC321, ATOM_TYPE_OC311, 110.100000, 633.457600, 0.00000000, 0.00},
+     {ATOM_TYPE_CC311, ATOM_TYPE_CC321, ATOM_TYPE_OC311, 110.100000, 633.457600, 0.00000000, 0.00},
+     {ATOM_TYPE_CC321, ATOM_TYPE_CC311, ATOM_TYPE_OC311, 110.100000, 633.457600, 0.00000000, 0.00},
+     {ATOM_TYPE_CC322, ATOM_TYPE_CC312, ATOM_TYPE_OC311, 108.000000, 633.457600, 0.00000000, 0.00},
+     {ATOM_TYPE_CC331, ATOM_TYPE_CC301, ATOM_TYPE_OC311, 113.000000, 633.457600, 0.00000000, 0.00},
+     {ATOM_TYPE_CC3261, ATOM_TYPE_CC3062, ATOM_TYPE_OC311, 113.000000, 633.457600, 0.00000000, 0.00},
+     {ATOM_TYPE_CC2O2, ATOM_TYPE_CC301, ATOM_TYPE_OC311, 110.100000, 633.457600, 0.00000000, 0.00},
+     {ATOM_TYPE_CC2O2, ATOM_TYPE_CC3062, ATOM_TYPE_OC311, 110.100000, 633.457600, 0.00000000, 0.00},
+     {ATOM_TYPE_CC3163, ATOM_TYPE_CC2O2, ATOM_TYPE_OC2D2, 114.000000, 334.720000, 0.23880000, 41840.00},
+     {ATOM_TYPE_CC3062, ATOM_TYPE_CC2O2, ATOM_TYPE_OC2D2, 114.000000, 334.720000, 0.23880000, 41840.00},
+     {ATOM_TYPE_CC311, ATOM_TYPE_CC2O2, ATOM_TYPE_OC2D2, 114.000000, 334.720000, 0.23880000, 41840.00},
+     {ATOM_TYPE_CC301, ATOM_TYPE_CC2O2, ATOM_TYPE_OC2D2, 114.000000, 334.720000, 0.23880000, 41840.00},
+     {ATOM_TYPE_CC321, ATOM_TYPE_CC2O2, ATOM_TYPE_OC2D2, 114.000000, 334.720000, 0.23880000, 41840.00},
+     {ATOM_TYPE_OC2D1, ATOM_TYPE_CC2O1, ATOM_TYPE_CC331, 121.000000, 669.440000, 0.00000000, 0.00},
+     {ATOM_TYPE_OC301, ATOM_TYPE_CC311, ATOM_TYPE_CC331, 111.500000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_OC301, ATOM_TYPE_CC321, ATOM_TYPE_CC321, 111.500000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_OC301, ATOM_TYPE_CC301, ATOM_TYPE_CC331, 109.000000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_OC3C61, ATOM_TYPE_CC311C, ATOM_TYPE_CC321, 109.000000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_OC3C61, ATOM_TYPE_CC311C, ATOM_TYPE_CC321C, 111.500000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_OC3C61, ATOM_TYPE_CC321C, ATOM_TYPE_CC321C, 111.500000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_OC3C61, ATOM_TYPE_CC321C, ATOM_TYPE_CC311C, 111.500000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_OC3C61, ATOM_TYPE_CC321D, ATOM_TYPE_CC321C, 111.500000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_OC3C61, ATOM_TYPE_CC321D, ATOM_TYPE_CC311C, 111.500000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_OC3C61, ATOM_TYPE_CC311D, ATOM_TYPE_CC321C, 111.500000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_OC301, ATOM_TYPE_CC311D, ATOM_TYPE_CC321C, 109.000000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_OC301, ATOM_TYPE_CC3162, ATOM_TYPE_CC3161, 105.000000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_OC301, ATOM_TYPE_CC3062, ATOM_TYPE_CC3261, 105.000000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_OC302, ATOM_TYPE_CC311D, ATOM_TYPE_CC321C, 109.000000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_OC302, ATOM_TYPE_CC3162, ATOM_TYPE_CC3161, 105.000000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_OC301, ATOM_TYPE_CC311C, ATOM_TYPE_CC321C, 109.000000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_OC301, ATOM_TYPE_CC3161, ATOM_TYPE_CC3161, 109.000000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_OC301, ATOM_TYPE_CC3161, ATOM_TYPE_CC3163, 109.000000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_OC301, ATOM_TYPE_CC311C, ATOM_TYPE_CC321D, 109.000000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_OC301, ATOM_TYPE_CC3161, ATOM_TYPE_CC3162, 109.000000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_OC301, ATOM_TYPE_CC321, ATOM_TYPE_CC311C, 106.000000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_OC301, ATOM_TYPE_CC321, ATOM_TYPE_CC3163, 106.000000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_CC321, ATOM_TYPE_CC321, ATOM_TYPE_OC311M, 110.100000, 633.457600, 0.00000000, 0.00},
+     {ATOM_TYPE_CC331, ATOM_TYPE_CC321, ATOM_TYPE_OC311M, 110.100000, 633.457600, 0.00000000, 0.00},
+     {ATOM_TYPE_CC331, ATOM_TYPE_CC311, ATOM_TYPE_OC311M, 110.100000, 633.457600, 0.00000000, 0.00},
+     {ATOM_TYPE_CC3161, ATOM_TYPE_OC311, ATOM_TYPE_HCP1, 109.000000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_CC321, ATOM_TYPE_OC311, ATOM_TYPE_HCP1, 109.000000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_CC3162, ATOM_TYPE_OC311, ATOM_TYPE_HCP1, 109.000000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_CC3062, ATOM_TYPE_OC311, ATOM_TYPE_HCP1, 109.000000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_HCP1, ATOM_TYPE_OC311, ATOM_TYPE_CC311, 106.000000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_HCP1, ATOM_TYPE_OC311, ATOM_TYPE_CC312, 106.000000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_HCP1, ATOM_TYPE_OC311, ATOM_TYPE_CC301, 106.000000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_HCP1, ATOM_TYPE_OC311, ATOM_TYPE_CC322, 106.000000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_HCP1, ATOM_TYPE_OC311M, ATOM_TYPE_CC321, 106.000000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_HCP1M, ATOM_TYPE_OC311M, ATOM_TYPE_CC321, 106.000000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_HCP1, ATOM_TYPE_OC311M, ATOM_TYPE_CC311, 106.000000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_HCP1, ATOM_TYPE_OC311M, ATOM_TYPE_CC331, 106.000000, 481.160000, 0.00000000, 0.00},
+     {ATOM_TYPE_OC311, ATOM_TYPE_CC3162, ATOM_TYPE_OC3C61, 116.500000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_OC311, ATOM_TYPE_CC301, ATOM_TYPE_OC301, 116.500000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_OC311, ATOM_TYPE_CC3062, ATOM_TYPE_OC3C61, 113.000000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_OC2D2, ATOM_TYPE_CC2O2, ATOM_TYPE_OC2D2, 132.000000, 836.800000, 0.22250000, 58576.00},
+     {ATOM_TYPE_OC301, ATOM_TYPE_CC311D, ATOM_TYPE_OC3C61, 110.000000, 753.120000, 0.00000000, 0.00},
+     {ATOM_TYPE_OC301, ATOM_TYPE_CC3162, ATOM_TYPE_OC3C61, 112.000000, 753.120000, 0.00000000, 0.00},
+     {ATOM_TYPE_OC301, ATOM_TYPE_CC3062, ATOM_TYPE_OC3C61, 112.000000, 753.120000, 0.00000000, 0.00},
+     {ATOM_TYPE_OC302, ATOM_TYPE_CC311D, ATOM_TYPE_OC3C61, 110.000000, 753.120000, 0.00000000, 0.00},
+     {ATOM_TYPE_OC302, ATOM_TYPE_CC3162, ATOM_TYPE_OC3C61, 112.000000, 753.120000, 0.00000000, 0.00},
+     {ATOM_TYPE_CC3163, ATOM_TYPE_OC3C61, ATOM_TYPE_CC3162, 109.700000, 794.960000, 0.00000000, 0.00},
+     {ATOM_TYPE_CC3163, ATOM_TYPE_OC3C61, ATOM_TYPE_CC3062, 109.700000, 794.960000, 0.00000000, 0.00},
+     {ATOM_TYPE_CC3263, ATOM_TYPE_OC3C61, ATOM_TYPE_CC3162, 109.700000, 794.960000, 0.00000000, 0.00},
+     {ATOM_TYPE_CC311, ATOM_TYPE_OC301, ATOM_TYPE_CC331, 109.700000, 794.960000, 0.00000000, 0.00},
+     {ATOM_TYPE_CC301, ATOM_TYPE_OC301, ATOM_TYPE_CC331, 109.700000, 794.960000, 0.00000000, 0.00},
+     {ATOM_TYPE_CC321C, ATOM_TYPE_OC3C61, ATOM_TYPE_CC321C, 109.700000, 794.960000, 0.00000000, 0.00},
+     {ATOM_TYPE_CC321D, ATOM_TYPE_OC3C61, ATOM_TYPE_CC321C, 109.700000, 794.960000, 0.00000000, 0.00},
+     {ATOM_TYPE_CC321D, ATOM_TYPE_OC3C61, ATOM_TYPE_CC311C, 109.700000, 794.960000, 0.00000000, 0.00},
+     {ATOM_TYPE_CC311D, ATOM_TYPE_OC3C61, ATOM_TYPE_CC321C, 109.700000, 794.960000, 0.00000000, 0.00},
+     {ATOM_TYPE_CC311D, ATOM_TYPE_OC301, ATOM_TYPE_CC331, 109.700000, 794.960000, 0.00000000, 0.00},
+     {ATOM_TYPE_CC3162, ATOM_TYPE_OC301, ATOM_TYPE_CC331, 109.700000, 794.960000, 0.00000000, 0.00},
+     {ATOM_TYPE_CC3162, ATOM_TYPE_OC301, ATOM_TYPE_CC321, 109.700000, 794.960000, 0.00000000, 0.00},
+     {ATOM_TYPE_CC321, ATOM_TYPE_OC301, ATOM_TYPE_CC331, 109.700000, 794.960000, 0.00000000, 0.00},
+     {ATOM_TYPE_CC311D, ATOM_TYPE_OC302, ATOM_TYPE_CC311D, 111.500000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_CC3162, ATOM_TYPE_OC302, ATOM_TYPE_CC3162, 111.500000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_CC311C, ATOM_TYPE_OC301, ATOM_TYPE_CC311D, 109.200000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_CC3161, ATOM_TYPE_OC301, ATOM_TYPE_CC3162, 109.200000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_CC3161, ATOM_TYPE_OC301, ATOM_TYPE_CC3062, 109.200000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_HCA1, ATOM_TYPE_CC312, ATOM_TYPE_OC311, 108.890000, 460.240000, 0.00000000, 0.00},
+     {ATOM_TYPE_HCA1, ATOM_TYPE_CC3161, ATOM_TYPE_OC311, 108.890000, 460.240000, 0.00000000, 0.00},
+     {ATOM_TYPE_HCA1, ATOM_TYPE_CC3162, ATOM_TYPE_OC311, 108.890000, 460.240000, 0.00000000, 0.00},
+     {ATOM_TYPE_HCA1, ATOM_TYPE_CC3163, ATOM_TYPE_OC311, 108.890000, 460.240000, 0.00000000, 0.00},
+     {ATOM_TYPE_HCA2, ATOM_TYPE_CC321, ATOM_TYPE_OC311, 108.890000, 460.240000, 0.00000000, 0.00},
+     {ATOM_TYPE_HCA2, ATOM_TYPE_CC322, ATOM_TYPE_OC311, 108.890000, 460.240000, 0.00000000, 0.00},
+     {ATOM_TYPE_HCA1, ATOM_TYPE_CC3162, ATOM_TYPE_OC3C61, 109.500000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_HCA1, ATOM_TYPE_CC3163, ATOM_TYPE_OC3C61, 109.500000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_HCA2, ATOM_TYPE_CC3263, ATOM_TYPE_OC3C61, 109.500000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_HCA1, ATOM_TYPE_CC311, ATOM_TYPE_OC301, 109.500000, 502.080000, 0.00000000, 0.00},
+     {ATOM_TYPE_OC301, ATOM_TYPE_CC321, ATOM_TYPE_HCA2, 109.500000, 502.080000, 0.00000000, 0.00},
+     {ATOM_TYPE_OC301, ATOM_TYPE_CC331, ATOM_TYPE_HCA3, 109.500000, 502.080000, 0.00000000, 0.00},
+     {ATOM_TYPE_HCA3, ATOM_TYPE_CC331, ATOM_TYPE_OC311M, 108.890000, 460.240000, 0.00000000, 0.00},
+     {ATOM_TYPE_HCA2, ATOM_TYPE_CC321, ATOM_TYPE_OC311M, 108.890000, 460.240000, 0.00000000, 0.00},
+     {ATOM_TYPE_HCA1, ATOM_TYPE_CC311, ATOM_TYPE_OC311M, 108.890000, 460.240000, 0.00000000, 0.00},
+     {ATOM_TYPE_HCA2, ATOM_TYPE_CC321C, ATOM_TYPE_OC3C61, 109.500000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_HCA2, ATOM_TYPE_CC321D, ATOM_TYPE_OC3C61, 109.500000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_HCA1, ATOM_TYPE_CC311C, ATOM_TYPE_OC3C61, 109.500000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_HCA1, ATOM_TYPE_CC311D, ATOM_TYPE_OC3C61, 109.500000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_HCA1, ATOM_TYPE_CC311D, ATOM_TYPE_OC301, 109.500000, 502.080000, 0.00000000, 0.00},
+     {ATOM_TYPE_HCA1, ATOM_TYPE_CC3162, ATOM_TYPE_OC301, 109.500000, 502.080000, 0.00000000, 0.00},
+     {ATOM_TYPE_HCA1, ATOM_TYPE_CC311D, ATOM_TYPE_OC302, 109.500000, 502.080000, 0.00000000, 0.00},
+     {ATOM_TYPE_HCA1, ATOM_TYPE_CC3162, ATOM_TYPE_OC302, 109.500000, 502.080000, 0.00000000, 0.00},
+     {ATOM_TYPE_HCA1, ATOM_TYPE_CC311C, ATOM_TYPE_OC301, 109.500000, 502.080000, 0.00000000, 0.00},
+     {ATOM_TYPE_HCA1, ATOM_TYPE_CC3161, ATOM_TYPE_OC301, 109.500000, 502.080000, 0.00000000, 0.00},
+     {ATOM_TYPE_CC322C, ATOM_TYPE_CC322C, ATOM_TYPE_CC322C, 109.500000, 485.344000, 0.25610000, 9338.69},
+     {ATOM_TYPE_HCA2C2, ATOM_TYPE_CC322C, ATOM_TYPE_CC322C, 111.400000, 292.880000, 0.21790000, 18853.10},
+     {ATOM_TYPE_HCA2C2, ATOM_TYPE_CC322C, ATOM_TYPE_HCA2C2, 106.800000, 322.168000, 0.18020000, 4518.72},
+     {ATOM_TYPE_OC3C5M, ATOM_TYPE_CC322C, ATOM_TYPE_CC322C, 111.100000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_CC322C, ATOM_TYPE_OC3C5M, ATOM_TYPE_CC322C, 111.000000, 794.960000, 0.00000000, 0.00},
+     {ATOM_TYPE_HCA2C2, ATOM_TYPE_CC322C, ATOM_TYPE_OC3C5M, 107.300000, 585.760000, 0.00000000, 0.00},
+     {ATOM_TYPE_HCA3, ATOM_TYPE_CC331, ATOM_TYPE_CC312C, 110.100000, 279.742240, 0.21790000, 18853.10},
+     {ATOM_TYPE_CC322C, ATOM_TYPE_CC312C, ATOM_TYPE_CC331, 114.000000, 446.432800, 0.25610000, 6694.40},
+     {ATOM_TYPE_HCA1C2, ATOM_TYPE_CC312C, ATOM_TYPE_CC331, 110.100000, 288.696000, 0.21790000, 18853.10},
+     {ATOM_TYPE_OC3C5M, ATOM_TYPE_CC312C, ATOM_TYPE_CC331, 111.500000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_HCA1C2, ATOM_TYPE_CC312C, ATOM_TYPE_CC322C, 111.400000, 292.880000, 0.21790000, 18853.10},
+     {ATOM_TYPE_HCA2C2, ATOM_TYPE_CC322C, ATOM_TYPE_CC312C, 111.400000, 292.880000, 0.21790000, 18853.10},
+     {ATOM_TYPE_CC312C, ATOM_TYPE_CC322C, ATOM_TYPE_CC322C, 109.500000, 485.344000, 0.25610000, 9338.69},
+     {ATOM_TYPE_CC322C, ATOM_TYPE_CC312C, ATOM_TYPE_CC322C, 109.500000, 485.344000, 0.25610000, 9338.69},
+     {ATOM_TYPE_OC3C5M, ATOM_TYPE_CC312C, ATOM_TYPE_CC322C, 111.100000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_CC312C, ATOM_TYPE_OC3C5M, ATOM_TYPE_CC322C, 111.000000, 794.960000, 0.00000000, 0.00},
+     {ATOM_TYPE_HCA1C2, ATOM_TYPE_CC312C, ATOM_TYPE_OC3C5M, 107.300000, 585.760000, 0.00000000, 0.00},
+     {ATOM_TYPE_HCA1C2, ATOM_TYPE_CC312C, ATOM_TYPE_OC301, 109.500000, 502.080000, 0.00000000, 0.00},
+     {ATOM_TYPE_OC301, ATOM_TYPE_CC312C, ATOM_TYPE_CC322C, 106.500000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_CC312C, ATOM_TYPE_OC301, ATOM_TYPE_CC331, 109.700000, 794.960000, 0.00000000, 0.00},
+     {ATOM_TYPE_OC301, ATOM_TYPE_CC312C, ATOM_TYPE_OC3C5M, 112.000000, 753.120000, 0.00000000, 0.00},
+     {ATOM_TYPE_OC3C51, ATOM_TYPE_CC3152, ATOM_TYPE_CC3251, 111.100000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_OC3C51, ATOM_TYPE_CC3051, ATOM_TYPE_CC3251, 111.100000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_OC3C51, ATOM_TYPE_CC3152, ATOM_TYPE_CC3151, 111.100000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_OC3C51, ATOM_TYPE_CC3051, ATOM_TYPE_CC3151, 111.100000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_OC3C51, ATOM_TYPE_CC3153, ATOM_TYPE_CC3151, 111.100000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_OC3C51, ATOM_TYPE_CC3153, ATOM_TYPE_CC321, 108.000000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_OC3C51, ATOM_TYPE_CC3051, ATOM_TYPE_CC321, 108.000000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_OC311, ATOM_TYPE_CC3151, ATOM_TYPE_CC3251, 110.100000, 633.457600, 0.00000000, 0.00},
+     {ATOM_TYPE_OC311, ATOM_TYPE_CC3151, ATOM_TYPE_CC3153, 110.100000, 633.457600, 0.00000000, 0.00},
+     {ATOM_TYPE_OC311, ATOM_TYPE_CC3151, ATOM_TYPE_CC3152, 110.100000, 633.457600, 0.00000000, 0.00},
+     {ATOM_TYPE_OC311, ATOM_TYPE_CC3151, ATOM_TYPE_CC3051, 110.100000, 633.457600, 0.00000000, 0.00},
+     {ATOM_TYPE_OC311, ATOM_TYPE_CC3151, ATOM_TYPE_CC3151, 110.100000, 633.457600, 0.00000000, 0.00},
+     {ATOM_TYPE_OC311, ATOM_TYPE_CC321, ATOM_TYPE_CC3153, 110.100000, 633.457600, 0.00000000, 0.00},
+     {ATOM_TYPE_OC311, ATOM_TYPE_CC321, ATOM_TYPE_CC3152, 110.100000, 633.457600, 0.00000000, 0.00},
+     {ATOM_TYPE_OC311, ATOM_TYPE_CC321, ATOM_TYPE_CC3051, 110.100000, 633.457600, 0.00000000, 0.00},
+     {ATOM_TYPE_OC311, ATOM_TYPE_CC3152, ATOM_TYPE_CC3251, 110.100000, 633.457600, 0.00000000, 0.00},
+     {ATOM_TYPE_OC311, ATOM_TYPE_CC3051, ATOM_TYPE_CC3251, 110.100000, 633.457600, 0.00000000, 0.00},
+     {ATOM_TYPE_OC311, ATOM_TYPE_CC3152, ATOM_TYPE_CC321, 110.100000, 633.457600, 0.00000000, 0.00},
+     {ATOM_TYPE_OC311, ATOM_TYPE_CC3051, ATOM_TYPE_CC321, 110.100000, 633.457600, 0.00000000, 0.00},
+     {ATOM_TYPE_OC311, ATOM_TYPE_CC3152, ATOM_TYPE_CC3151, 110.100000, 633.457600, 0.00000000, 0.00},
+     {ATOM_TYPE_OC311, ATOM_TYPE_CC3051, ATOM_TYPE_CC3151, 110.100000, 633.457600, 0.00000000, 0.00},
+     {ATOM_TYPE_OC3C51, ATOM_TYPE_CC3152, ATOM_TYPE_OC311, 116.500000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_OC3C51, ATOM_TYPE_CC3051, ATOM_TYPE_OC311, 116.500000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_OC3C51, ATOM_TYPE_CC3152, ATOM_TYPE_HCA1, 107.300000, 585.760000, 0.00000000, 0.00},
+     {ATOM_TYPE_OC3C51, ATOM_TYPE_CC3153, ATOM_TYPE_HCA1, 107.300000, 585.760000, 0.00000000, 0.00},
+     {ATOM_TYPE_OC311, ATOM_TYPE_CC3152, ATOM_TYPE_HCA1, 108.890000, 460.240000, 0.00000000, 0.00},
+     {ATOM_TYPE_OC311, ATOM_TYPE_CC3151, ATOM_TYPE_HCA1, 108.890000, 460.240000, 0.00000000, 0.00},
+     {ATOM_TYPE_CC3152, ATOM_TYPE_OC311, ATOM_TYPE_HCP1, 109.000000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_CC3051, ATOM_TYPE_OC311, ATOM_TYPE_HCP1, 109.000000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_CC3151, ATOM_TYPE_OC311, ATOM_TYPE_HCP1, 109.000000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_CC3153, ATOM_TYPE_OC3C51, ATOM_TYPE_CC3152, 111.000000, 794.960000, 0.00000000, 0.00},
+     {ATOM_TYPE_CC3153, ATOM_TYPE_OC3C51, ATOM_TYPE_CC3051, 111.000000, 794.960000, 0.00000000, 0.00},
+     {ATOM_TYPE_CC3152, ATOM_TYPE_CC3251, ATOM_TYPE_CC3151, 109.500000, 485.344000, 0.25610000, 9338.69},
+     {ATOM_TYPE_CC3051, ATOM_TYPE_CC3251, ATOM_TYPE_CC3151, 109.500000, 485.344000, 0.25610000, 9338.69},
+     {ATOM_TYPE_CC3152, ATOM_TYPE_CC3151, ATOM_TYPE_CC3151, 109.500000, 485.344000, 0.25610000, 9338.69},
+     {ATOM_TYPE_CC3051, ATOM_TYPE_CC3151, ATOM_TYPE_CC3151, 109.500000, 485.344000, 0.25610000, 9338.69},
+     {ATOM_TYPE_CC3251, ATOM_TYPE_CC3151, ATOM_TYPE_CC3153, 109.500000, 485.344000, 0.25610000, 9338.69},
+     {ATOM_TYPE_CC3151, ATOM_TYPE_CC3151, ATOM_TYPE_CC3153, 109.500000, 485.344000, 0.25610000, 9338.69},
+     {ATOM_TYPE_CC3151, ATOM_TYPE_CC3153, ATOM_TYPE_CC321, 113.500000, 488.272800, 0.25610000, 9338.69},
+     {ATOM_TYPE_CC3151, ATOM_TYPE_CC3051, ATOM_TYPE_CC321, 113.500000, 488.272800, 0.25610000, 9338.69},
+     {ATOM_TYPE_CC3152, ATOM_TYPE_CC3251, ATOM_TYPE_HCA2, 111.400000, 292.880000, 0.21790000, 18853.10},
+     {ATOM_TYPE_CC3051, ATOM_TYPE_CC3251, ATOM_TYPE_HCA2, 111.400000, 292.880000, 0.21790000, 18853.10},
+     {ATOM_TYPE_CC3251, ATOM_TYPE_CC3152, ATOM_TYPE_HCA1, 111.400000, 292.880000, 0.21790000, 18853.10},
+     {ATOM_TYPE_CC3251, ATOM_TYPE_CC3151, ATOM_TYPE_HCA1, 111.400000, 292.880000, 0.21790000, 18853.10},
+     {ATOM_TYPE_CC3151, ATOM_TYPE_CC3251, ATOM_TYPE_HCA2, 111.400000, 292.880000, 0.21790000, 18853.10},
+     {ATOM_TYPE_CC3153, ATOM_TYPE_CC3151, ATOM_TYPE_HCA1, 111.400000, 292.880000, 0.21790000, 18853.10},
+     {ATOM_TYPE_CC3152, ATOM_TYPE_CC3151, ATOM_TYPE_HCA1, 111.400000, 292.880000, 0.21790000, 18853.10},
+     {ATOM_TYPE_CC3051, ATOM_TYPE_CC3151, ATOM_TYPE_HCA1, 111.400000, 292.880000, 0.21790000, 18853.10},
+     {ATOM_TYPE_CC3151, ATOM_TYPE_CC3151, ATOM_TYPE_HCA1, 111.400000, 292.880000, 0.21790000, 18853.10},
+     {ATOM_TYPE_CC3151, ATOM_TYPE_CC3152, ATOM_TYPE_HCA1, 111.400000, 292.880000, 0.21790000, 18853.10},
+     {ATOM_TYPE_CC3151, ATOM_TYPE_CC3153, ATOM_TYPE_HCA1, 111.400000, 292.880000, 0.21790000, 18853.10},
+     {ATOM_TYPE_CC3153, ATOM_TYPE_CC321, ATOM_TYPE_HCA2, 110.100000, 279.742240, 0.21790000, 18853.10},
+     {ATOM_TYPE_CC3152, ATOM_TYPE_CC321, ATOM_TYPE_HCA2, 110.100000, 279.742240, 0.21790000, 18853.10},
+     {ATOM_TYPE_CC3051, ATOM_TYPE_CC321, ATOM_TYPE_HCA2, 110.100000, 279.742240, 0.21790000, 18853.10},
+     {ATOM_TYPE_CC321, ATOM_TYPE_CC3153, ATOM_TYPE_HCA1, 110.100000, 288.696000, 0.21790000, 18853.10},
+     {ATOM_TYPE_HCA2, ATOM_TYPE_CC3251, ATOM_TYPE_HCA2, 106.800000, 322.168000, 0.18020000, 4518.72},
+     {ATOM_TYPE_HCA1, ATOM_TYPE_CC3152, ATOM_TYPE_OC301, 109.500000, 502.080000, 0.00000000, 0.00},
+     {ATOM_TYPE_OC301, ATOM_TYPE_CC3152, ATOM_TYPE_CC3151, 105.000000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_CC3152, ATOM_TYPE_OC301, ATOM_TYPE_CC331, 111.000000, 794.960000, 0.00000000, 0.00},
+     {ATOM_TYPE_OC301, ATOM_TYPE_CC3152, ATOM_TYPE_OC3C51, 112.000000, 753.120000, 0.00000000, 0.00},
+     {ATOM_TYPE_CC321C, ATOM_TYPE_CC311D, ATOM_TYPE_CC321C, 112.000000, 488.272800, 0.25610000, 9338.69},
+     {ATOM_TYPE_CC321D, ATOM_TYPE_CC311D, ATOM_TYPE_CC321C, 112.000000, 488.272800, 0.25610000, 9338.69},
+     {ATOM_TYPE_CC311D, ATOM_TYPE_CC311D, ATOM_TYPE_CC321C, 112.000000, 488.272800, 0.25610000, 9338.69},
+     {ATOM_TYPE_OC3C61, ATOM_TYPE_CC311D, ATOM_TYPE_CC311D, 111.500000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_OC3C61, ATOM_TYPE_CC321D, ATOM_TYPE_CC311D, 111.500000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_HCA1, ATOM_TYPE_CC311D, ATOM_TYPE_CC311D, 110.100000, 288.696000, 0.21790000, 18853.10},
+     {ATOM_TYPE_HCA2, ATOM_TYPE_CC321D, ATOM_TYPE_CC311D, 110.100000, 288.696000, 0.21790000, 18853.10},
+     {ATOM_TYPE_HCA1, ATOM_TYPE_CC311D, ATOM_TYPE_CC321D, 110.100000, 288.696000, 0.21790000, 18853.10},
+     {ATOM_TYPE_OC30P, ATOM_TYPE_CC311D, ATOM_TYPE_CC321C, 107.000000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_OC30P, ATOM_TYPE_CC311D, ATOM_TYPE_CC311D, 107.000000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_OC30P, ATOM_TYPE_CC3161, ATOM_TYPE_CC3161, 107.000000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_OC30P, ATOM_TYPE_CC3161, ATOM_TYPE_CC3163, 107.000000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_OC30P, ATOM_TYPE_CC311D, ATOM_TYPE_CC321D, 109.000000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_OC30P, ATOM_TYPE_CC3162, ATOM_TYPE_CC3161, 109.000000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_OC30P, ATOM_TYPE_CC3161, ATOM_TYPE_CC3162, 109.000000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_OC30P, ATOM_TYPE_CC321, ATOM_TYPE_CC311C, 107.500000, 633.457600, 0.00000000, 0.00},
+     {ATOM_TYPE_OC30P, ATOM_TYPE_CC321, ATOM_TYPE_CC3163, 107.500000, 633.457600, 0.00000000, 0.00},
+     {ATOM_TYPE_OC30P, ATOM_TYPE_CC311D, ATOM_TYPE_OC3C61, 110.000000, 753.120000, 0.00000000, 0.00},
+     {ATOM_TYPE_OC30P, ATOM_TYPE_CC3162, ATOM_TYPE_OC3C61, 110.000000, 753.120000, 0.00000000, 0.00},
+     {ATOM_TYPE_OC30P, ATOM_TYPE_CC321, ATOM_TYPE_HCA2, 109.500000, 502.080000, 0.00000000, 0.00},
+     {ATOM_TYPE_OC30P, ATOM_TYPE_CC3162, ATOM_TYPE_HCA1, 109.500000, 502.080000, 0.00000000, 0.00},
+     {ATOM_TYPE_OC30P, ATOM_TYPE_CC3161, ATOM_TYPE_HCA1, 109.500000, 502.080000, 0.00000000, 0.00},
+     {ATOM_TYPE_OC30P, ATOM_TYPE_CC311D, ATOM_TYPE_HCA1, 109.500000, 502.080000, 0.00000000, 0.00},
+     {ATOM_TYPE_OC30P, ATOM_TYPE_PC, ATOM_TYPE_OC2DP, 111.600000, 827.595200, 0.00000000, 0.00},
+     {ATOM_TYPE_OC2DP, ATOM_TYPE_PC, ATOM_TYPE_OC2DP, 120.000000, 1004.160000, 0.00000000, 0.00},
+     {ATOM_TYPE_OC2DP, ATOM_TYPE_PC, ATOM_TYPE_OC312, 113.230000, 827.595200, 0.00000000, 0.00},
+     {ATOM_TYPE_OC312, ATOM_TYPE_PC, ATOM_TYPE_OC312, 104.413000, 827.595200, 0.00000000, 0.00},
+     {ATOM_TYPE_OC30P, ATOM_TYPE_PC, ATOM_TYPE_OC312, 108.000000, 402.500800, 0.00000000, 0.00},
+     {ATOM_TYPE_HCP1, ATOM_TYPE_OC312, ATOM_TYPE_PC, 115.000000, 251.040000, 0.23500000, 33472.00},
+     {ATOM_TYPE_CC3161, ATOM_TYPE_OC30P, ATOM_TYPE_PC, 120.000000, 167.360000, 0.23300000, 29288.00},
+     {ATOM_TYPE_CC311D, ATOM_TYPE_OC30P, ATOM_TYPE_PC, 120.000000, 167.360000, 0.23300000, 29288.00},
+     {ATOM_TYPE_CC3162, ATOM_TYPE_OC30P, ATOM_TYPE_PC, 120.000000, 167.360000, 0.23300000, 29288.00},
+     {ATOM_TYPE_CC311D, ATOM_TYPE_OC30P, ATOM_TYPE_SC, 109.000000, 125.520000, 0.19000000, 22593.60},
+     {ATOM_TYPE_CC3161, ATOM_TYPE_OC30P, ATOM_TYPE_SC, 109.000000, 125.520000, 0.19000000, 22593.60},
+     {ATOM_TYPE_CC321, ATOM_TYPE_OC30P, ATOM_TYPE_SC, 110.100000, 125.520000, 0.19000000, 22593.60},
+     {ATOM_TYPE_OC2DP, ATOM_TYPE_SC, ATOM_TYPE_OC2DP, 109.470000, 1087.840000, 0.24500000, 29288.00},
+     {ATOM_TYPE_OC30P, ATOM_TYPE_SC, ATOM_TYPE_OC2DP, 98.000000, 711.280000, 0.00000000, 0.00},
+     {ATOM_TYPE_CC311D, ATOM_TYPE_OC301, ATOM_TYPE_CC321, 109.700000, 794.960000, 0.00000000, 0.00},
+     {ATOM_TYPE_OC301, ATOM_TYPE_CC321, ATOM_TYPE_CC331, 111.500000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_OC301, ATOM_TYPE_CC312D, ATOM_TYPE_OC3C5M, 112.000000, 753.120000, 0.00000000, 0.00},
+     {ATOM_TYPE_HCA1, ATOM_TYPE_CC312D, ATOM_TYPE_OC301, 109.500000, 502.080000, 0.00000000, 0.00},
+     {ATOM_TYPE_OC301, ATOM_TYPE_CC312D, ATOM_TYPE_CC322C, 106.500000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_CC312D, ATOM_TYPE_OC301, ATOM_TYPE_CC331, 109.700000, 794.960000, 0.00000000, 0.00},
+     {ATOM_TYPE_CC311D, ATOM_TYPE_OC302, ATOM_TYPE_CC312D, 111.500000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_CC312D, ATOM_TYPE_OC3C5M, ATOM_TYPE_CC322C, 111.000000, 794.960000, 0.00000000, 0.00},
+     {ATOM_TYPE_OC302, ATOM_TYPE_CC312D, ATOM_TYPE_OC3C5M, 112.000000, 753.120000, 0.00000000, 0.00},
+     {ATOM_TYPE_HCA2C2, ATOM_TYPE_CC322C, ATOM_TYPE_CC312D, 111.400000, 292.880000, 0.21790000, 18853.10},
+     {ATOM_TYPE_CC312D, ATOM_TYPE_CC322C, ATOM_TYPE_CC322C, 109.500000, 485.344000, 0.25610000, 9338.69},
+     {ATOM_TYPE_OC3C5M, ATOM_TYPE_CC312D, ATOM_TYPE_CC322C, 111.100000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_OC302, ATOM_TYPE_CC312D, ATOM_TYPE_CC322C, 106.500000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_HCA1, ATOM_TYPE_CC312D, ATOM_TYPE_OC302, 109.500000, 502.080000, 0.00000000, 0.00},
+     {ATOM_TYPE_HCA1, ATOM_TYPE_CC312D, ATOM_TYPE_OC3C5M, 107.300000, 585.760000, 0.00000000, 0.00},
+     {ATOM_TYPE_HCA1, ATOM_TYPE_CC312D, ATOM_TYPE_CC322C, 111.400000, 292.880000, 0.21790000, 18853.10},
+     {ATOM_TYPE_HCA1, ATOM_TYPE_CC312C, ATOM_TYPE_OC3C5M, 107.300000, 585.760000, 0.00000000, 0.00},
+     {ATOM_TYPE_HCA1, ATOM_TYPE_CC312C, ATOM_TYPE_CC322C, 111.400000, 292.880000, 0.21790000, 18853.10},
+     {ATOM_TYPE_CC321, ATOM_TYPE_CC312C, ATOM_TYPE_CC322C, 113.000000, 488.272800, 0.25610000, 9338.69},
+     {ATOM_TYPE_HCA1, ATOM_TYPE_CC312C, ATOM_TYPE_CC321, 110.100000, 288.696000, 0.21790000, 18853.10},
+     {ATOM_TYPE_HCA2, ATOM_TYPE_CC321, ATOM_TYPE_CC312C, 110.100000, 279.742240, 0.21790000, 18853.10},
+     {ATOM_TYPE_OC301, ATOM_TYPE_CC321, ATOM_TYPE_CC312C, 106.000000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_OC3C5M, ATOM_TYPE_CC312C, ATOM_TYPE_CC321, 109.000000, 502.080000, 0.00000000, 0.00},
+     {ATOM_TYPE_CC312C, ATOM_TYPE_OC303, ATOM_TYPE_CC331, 109.700000, 794.960000, 0.00000000, 0.00},
+     {ATOM_TYPE_OC303, ATOM_TYPE_CC331, ATOM_TYPE_HCA3, 109.500000, 502.080000, 0.00000000, 0.00},
+     {ATOM_TYPE_OC303, ATOM_TYPE_CC311D, ATOM_TYPE_CC321C, 109.000000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_OC303, ATOM_TYPE_CC311D, ATOM_TYPE_OC3C61, 110.000000, 753.120000, 0.00000000, 0.00},
+     {ATOM_TYPE_HCA1, ATOM_TYPE_CC311D, ATOM_TYPE_OC303, 109.500000, 502.080000, 0.00000000, 0.00},
+     {ATOM_TYPE_HCA1, ATOM_TYPE_CC312C, ATOM_TYPE_OC303, 109.500000, 502.080000, 0.00000000, 0.00},
+     {ATOM_TYPE_OC303, ATOM_TYPE_CC312C, ATOM_TYPE_CC322C, 110.500000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_CC311D, ATOM_TYPE_OC303, ATOM_TYPE_CC312C, 109.500000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_OC3C5M, ATOM_TYPE_CC322C, ATOM_TYPE_CC312C, 111.100000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_CC311C, ATOM_TYPE_OC301, ATOM_TYPE_CC312D, 109.200000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_CC3162, ATOM_TYPE_OC302, ATOM_TYPE_CC3051, 111.500000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_OC302, ATOM_TYPE_CC3051, ATOM_TYPE_OC3C51, 112.000000, 753.120000, 0.00000000, 0.00},
+     {ATOM_TYPE_OC302, ATOM_TYPE_CC3051, ATOM_TYPE_CC321, 110.100000, 633.457600, 0.00000000, 0.00},
+     {ATOM_TYPE_OC302, ATOM_TYPE_CC3051, ATOM_TYPE_CC3151, 105.000000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_HCA1, ATOM_TYPE_CC3162, ATOM_TYPE_OC303, 109.500000, 502.080000, 0.00000000, 0.00},
+     {ATOM_TYPE_OC303, ATOM_TYPE_CC3162, ATOM_TYPE_OC3C61, 112.000000, 753.120000, 0.00000000, 0.00},
+     {ATOM_TYPE_OC303, ATOM_TYPE_CC3162, ATOM_TYPE_CC3161, 105.000000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_CC3162, ATOM_TYPE_OC303, ATOM_TYPE_CC3151, 109.500000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_OC303, ATOM_TYPE_CC3151, ATOM_TYPE_CC3153, 110.500000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_OC303, ATOM_TYPE_CC3151, ATOM_TYPE_CC3151, 110.500000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_OC303, ATOM_TYPE_CC3151, ATOM_TYPE_HCA1, 109.500000, 502.080000, 0.00000000, 0.00},
+     {ATOM_TYPE_OC303, ATOM_TYPE_CC3151, ATOM_TYPE_CC3051, 110.500000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_CC3051, ATOM_TYPE_CC321, ATOM_TYPE_OC301, 106.000000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_CC321, ATOM_TYPE_OC301, ATOM_TYPE_CC3051, 112.200000, 794.960000, 0.00000000, 0.00},
+     {ATOM_TYPE_OC301, ATOM_TYPE_CC3051, ATOM_TYPE_OC3C51, 112.000000, 753.120000, 0.00000000, 0.00},
+     {ATOM_TYPE_OC301, ATOM_TYPE_CC3051, ATOM_TYPE_CC321, 110.100000, 633.457600, 0.00000000, 0.00},
+     {ATOM_TYPE_OC301, ATOM_TYPE_CC3051, ATOM_TYPE_CC3151, 106.500000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_CC3153, ATOM_TYPE_CC321, ATOM_TYPE_OC301, 106.000000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_CC3152, ATOM_TYPE_OC301, ATOM_TYPE_CC321, 111.000000, 794.960000, 0.00000000, 0.00},
+     {ATOM_TYPE_CC3161, ATOM_TYPE_OC301, ATOM_TYPE_CC3152, 109.200000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_OC301, ATOM_TYPE_CC3161, ATOM_TYPE_CC3263, 109.000000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_CC3162, ATOM_TYPE_OC30P, ATOM_TYPE_SC, 109.000000, 125.520000, 0.19000000, 22593.60},
+     {ATOM_TYPE_CN7, ATOM_TYPE_CN8, ATOM_TYPE_CN8, 113.600000, 488.272800, 0.25610000, 9338.69},
+     {ATOM_TYPE_CN8, ATOM_TYPE_CN7, ATOM_TYPE_CN8, 113.600000, 488.272800, 0.25610000, 9338.69},
+     {ATOM_TYPE_CN8, ATOM_TYPE_CN8, ATOM_TYPE_CN8, 113.600000, 488.272800, 0.25610000, 9338.69},
+     {ATOM_TYPE_HN1, ATOM_TYPE_NN6, ATOM_TYPE_CN8, 109.500000, 251.040000, 0.20740000, 16736.00},
+     {ATOM_TYPE_NN6, ATOM_TYPE_CN8, ATOM_TYPE_HN8, 107.500000, 376.560000, 0.21010000, 29288.00},
+     {ATOM_TYPE_CN7, ATOM_TYPE_CN8, ATOM_TYPE_ON2, 109.700000, 962.320000, 0.00000000, 0.00},
+     {ATOM_TYPE_NN6, ATOM_TYPE_CN8, ATOM_TYPE_CN8, 110.000000, 566.513600, 0.00000000, 0.00},
+     {ATOM_TYPE_HN1, ATOM_TYPE_NN6, ATOM_TYPE_HN1, 109.500000, 368.192000, 0.00000000, 0.00},
+     {ATOM_TYPE_ON2, ATOM_TYPE_CN8, ATOM_TYPE_CN8, 109.700000, 962.320000, 0.00000000, 0.00},
+     {ATOM_TYPE_CN7, ATOM_TYPE_ON6, ATOM_TYPE_CN8B, 109.000000, 920.480000, 0.00000000, 0.00},
+     {ATOM_TYPE_ON6, ATOM_TYPE_CN8B, ATOM_TYPE_CN8, 106.000000, 753.120000, 0.00000000, 0.00},
+     {ATOM_TYPE_CN8B, ATOM_TYPE_CN8, ATOM_TYPE_CN7, 106.000000, 669.440000, 0.00000000, 0.00},
+     {ATOM_TYPE_ON6, ATOM_TYPE_CN8B, ATOM_TYPE_HN8, 107.240000, 378.233600, 0.00000000, 0.00},
+     {ATOM_TYPE_HN8, ATOM_TYPE_CN8B, ATOM_TYPE_CN8, 110.100000, 288.947040, 0.21790000, 18853.10},
+     {ATOM_TYPE_HN8, ATOM_TYPE_CN8, ATOM_TYPE_CN8B, 110.100000, 288.947040, 0.21790000, 18853.10},
+     {ATOM_TYPE_CN2, ATOM_TYPE_NN3A, ATOM_TYPE_CN4, 117.800000, 753.120000, 0.00000000, 0.00},
+     {ATOM_TYPE_NN3A, ATOM_TYPE_CN4, ATOM_TYPE_NN3A, 133.000000, 502.080000, 0.00000000, 0.00},
+     {ATOM_TYPE_CN4, ATOM_TYPE_NN3A, ATOM_TYPE_CN5, 110.100000, 753.120000, 0.00000000, 0.00},
+     {ATOM_TYPE_CN5, ATOM_TYPE_CN5, ATOM_TYPE_NN3A, 127.400000, 502.080000, 0.00000000, 0.00},
+     {ATOM_TYPE_CN2, ATOM_TYPE_CN5, ATOM_TYPE_CN5, 121.000000, 502.080000, 0.00000000, 0.00},
+     {ATOM_TYPE_CN5, ATOM_TYPE_CN2, ATOM_TYPE_NN3A, 110.700000, 502.080000, 0.00000000, 0.00},
+     {ATOM_TYPE_CN5, ATOM_TYPE_CN5, ATOM_TYPE_NN2, 105.700000, 836.800000, 0.00000000, 0.00},
+     {ATOM_TYPE_CN5, ATOM_TYPE_CN5, ATOM_TYPE_NN4, 110.000000, 836.800000, 0.00000000, 0.00},
+     {ATOM_TYPE_CN4, ATOM_TYPE_NN4, ATOM_TYPE_CN5, 104.600000, 1004.160000, 0.00000000, 0.00},
+     {ATOM_TYPE_NN2, ATOM_TYPE_CN4, ATOM_TYPE_NN4, 113.400000, 836.800000, 0.00000000, 0.00},
+     {ATOM_TYPE_CN4, ATOM_TYPE_NN2, ATOM_TYPE_CN5, 106.300000, 836.800000, 0.00000000, 0.00},
+     {ATOM_TYPE_NN2, ATOM_TYPE_CN5, ATOM_TYPE_NN3A, 126.900000, 836.800000, 0.00000000, 0.00},
+     {ATOM_TYPE_CN2, ATOM_TYPE_CN5, ATOM_TYPE_NN4, 129.000000, 836.800000, 0.00000000, 0.00},
+     {ATOM_TYPE_HN3, ATOM_TYPE_CN4, ATOM_TYPE_NN3A, 113.500000, 317.984000, 0.00000000, 0.00},
+     {ATOM_TYPE_NN3A, ATOM_TYPE_CN2, ATOM_TYPE_NN1, 130.700000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_CN5, ATOM_TYPE_CN2, ATOM_TYPE_NN1, 118.600000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_CN2, ATOM_TYPE_NN1, ATOM_TYPE_HN1, 121.500000, 334.720000, 0.00000000, 0.00},
+     {ATOM_TYPE_HN1, ATOM_TYPE_NN1, ATOM_TYPE_HN1, 117.000000, 259.408000, 0.00000000, 0.00},
+     {ATOM_TYPE_NN4, ATOM_TYPE_CN4, ATOM_TYPE_HN3, 124.800000, 326.352000, 0.00000000, 0.00},
+     {ATOM_TYPE_NN2, ATOM_TYPE_CN4, ATOM_TYPE_HN3, 121.800000, 326.352000, 0.00000000, 0.00},
+     {ATOM_TYPE_CN5, ATOM_TYPE_NN2, ATOM_TYPE_HN2, 129.400000, 251.040000, 0.00000000, 0.00},
+     {ATOM_TYPE_CN4, ATOM_TYPE_NN2, ATOM_TYPE_HN2, 125.000000, 251.040000, 0.00000000, 0.00},
+     {ATOM_TYPE_CN1, ATOM_TYPE_NN2G, ATOM_TYPE_CN2, 131.100000, 585.760000, 0.00000000, 0.00},
+     {ATOM_TYPE_NN2G, ATOM_TYPE_CN2, ATOM_TYPE_NN3G, 122.200000, 585.760000, 0.00000000, 0.00},
+     {ATOM_TYPE_CN2, ATOM_TYPE_NN3G, ATOM_TYPE_CN5, 109.400000, 753.120000, 0.00000000, 0.00},
+     {ATOM_TYPE_CN5G, ATOM_TYPE_CN5, ATOM_TYPE_NN3G, 129.900000, 585.760000, 0.00000000, 0.00},
+     {ATOM_TYPE_CN1, ATOM_TYPE_CN5G, ATOM_TYPE_CN5, 119.600000, 585.760000, 0.00000000, 0.00},
+     {ATOM_TYPE_CN5G, ATOM_TYPE_CN1, ATOM_TYPE_NN2G, 107.800000, 585.760000, 0.00000000, 0.00},
+     {ATOM_TYPE_CN5G, ATOM_TYPE_CN5, ATOM_TYPE_NN2B, 104.600000, 836.800000, 0.00000000, 0.00},
+     {ATOM_TYPE_CN5, ATOM_TYPE_CN5G, ATOM_TYPE_NN4, 111.400000, 836.800000, 0.00000000, 0.00},
+     {ATOM_TYPE_CN4, ATOM_TYPE_NN4, ATOM_TYPE_CN5G, 103.800000, 1004.160000, 0.00000000, 0.00},
+     {ATOM_TYPE_NN2B, ATOM_TYPE_CN4, ATOM_TYPE_NN4, 113.000000, 836.800000, 0.00000000, 0.00},
+     {ATOM_TYPE_CN4, ATOM_TYPE_NN2B, ATOM_TYPE_CN5, 107.200000, 836.800000, 0.00000000, 0.00},
+     {ATOM_TYPE_NN2B, ATOM_TYPE_CN5, ATOM_TYPE_NN3G, 125.500000, 1171.520000, 0.00000000, 0.00},
+     {ATOM_TYPE_CN1, ATOM_TYPE_CN5G, ATOM_TYPE_NN4, 129.000000, 1046.000000, 0.00000000, 0.00},
+     {ATOM_TYPE_CN1, ATOM_TYPE_NN2G, ATOM_TYPE_HN2, 113.300000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_CN2, ATOM_TYPE_NN2G, ATOM_TYPE_HN2, 115.600000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_NN1, ATOM_TYPE_CN2, ATOM_TYPE_NN2G, 115.400000, 794.960000, 0.00000000, 0.00},
+     {ATOM_TYPE_NN1, ATOM_TYPE_CN2, ATOM_TYPE_NN3G, 122.400000, 794.960000, 0.00000000, 0.00},
+     {ATOM_TYPE_NN2G, ATOM_TYPE_CN1, ATOM_TYPE_ON1, 127.500000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_CN5G, ATOM_TYPE_CN1, ATOM_TYPE_ON1, 124.700000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_HN3, ATOM_TYPE_CN4, ATOM_TYPE_NN2B, 122.200000, 334.720000, 0.00000000, 0.00},
+     {ATOM_TYPE_CN4, ATOM_TYPE_NN2B, ATOM_TYPE_HN2, 124.600000, 251.040000, 0.00000000, 0.00},
+     {ATOM_TYPE_CN5, ATOM_TYPE_NN2B, ATOM_TYPE_HN2, 129.300000, 251.040000, 0.00000000, 0.00},
+     {ATOM_TYPE_CN1, ATOM_TYPE_NN2, ATOM_TYPE_CN3, 124.100000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_NN2, ATOM_TYPE_CN1, ATOM_TYPE_NN3, 116.800000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_CN1, ATOM_TYPE_NN3, ATOM_TYPE_CN2, 119.100000, 711.280000, 0.00000000, 0.00},
+     {ATOM_TYPE_CN3, ATOM_TYPE_CN2, ATOM_TYPE_NN3, 119.300000, 711.280000, 0.00000000, 0.00},
+     {ATOM_TYPE_CN2, ATOM_TYPE_CN3, ATOM_TYPE_CN3, 117.800000, 711.280000, 0.00000000, 0.00},
+     {ATOM_TYPE_CN3, ATOM_TYPE_CN3, ATOM_TYPE_NN2, 122.900000, 711.280000, 0.00000000, 0.00},
+     {ATOM_TYPE_CN1, ATOM_TYPE_NN2, ATOM_TYPE_HN2, 121.200000, 309.616000, 0.00000000, 0.00},
+     {ATOM_TYPE_CN3, ATOM_TYPE_NN2, ATOM_TYPE_HN2, 114.700000, 309.616000, 0.00000000, 0.00},
+     {ATOM_TYPE_NN2, ATOM_TYPE_CN1, ATOM_TYPE_ON1C, 119.400000, 1087.840000, 0.00000000, 0.00},
+     {ATOM_TYPE_NN3, ATOM_TYPE_CN1, ATOM_TYPE_ON1C, 123.800000, 1087.840000, 0.00000000, 0.00},
+     {ATOM_TYPE_NN3, ATOM_TYPE_CN2, ATOM_TYPE_NN1, 122.300000, 677.808000, 0.00000000, 0.00},
+     {ATOM_TYPE_CN3, ATOM_TYPE_CN2, ATOM_TYPE_NN1, 118.400000, 677.808000, 0.00000000, 0.00},
+     {ATOM_TYPE_CN2, ATOM_TYPE_CN3, ATOM_TYPE_HN3, 120.100000, 317.984000, 0.00000000, 0.00},
+     {ATOM_TYPE_CN3, ATOM_TYPE_CN3, ATOM_TYPE_HN3, 122.100000, 317.984000, 0.00000000, 0.00},
+     {ATOM_TYPE_HN3, ATOM_TYPE_CN3, ATOM_TYPE_NN2, 115.000000, 368.192000, 0.00000000, 0.00},
+     {ATOM_TYPE_CN1T, ATOM_TYPE_NN2B, ATOM_TYPE_CN3, 122.000000, 585.760000, 0.00000000, 0.00},
+     {ATOM_TYPE_NN2B, ATOM_TYPE_CN1T, ATOM_TYPE_NN2U, 114.000000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_CN1T, ATOM_TYPE_NN2U, ATOM_TYPE_CN1, 130.200000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_NN2U, ATOM_TYPE_CN1, ATOM_TYPE_CN3, 112.600000, 585.760000, 0.00000000, 0.00},
+     {ATOM_TYPE_CN1, ATOM_TYPE_CN3, ATOM_TYPE_CN3, 117.600000, 836.800000, 0.00000000, 0.00},
+     {ATOM_TYPE_CN3, ATOM_TYPE_CN3, ATOM_TYPE_NN2B, 123.600000, 836.800000, 0.00000000, 0.00},
+     {ATOM_TYPE_CN1T, ATOM_TYPE_NN2B, ATOM_TYPE_HN2, 122.000000, 338.904000, 0.00000000, 0.00},
+     {ATOM_TYPE_CN3, ATOM_TYPE_NN2B, ATOM_TYPE_HN2, 116.000000, 267.776000, 0.00000000, 0.00},
+     {ATOM_TYPE_NN2B, ATOM_TYPE_CN1T, ATOM_TYPE_ON1, 121.600000, 836.800000, 0.00000000, 0.00},
+     {ATOM_TYPE_NN2U, ATOM_TYPE_CN1T, ATOM_TYPE_ON1, 124.400000, 836.800000, 0.00000000, 0.00},
+     {ATOM_TYPE_CN1T, ATOM_TYPE_NN2U, ATOM_TYPE_HN2, 114.400000, 338.904000, 0.00000000, 0.00},
+     {ATOM_TYPE_CN1, ATOM_TYPE_NN2U, ATOM_TYPE_HN2, 115.400000, 338.904000, 0.00000000, 0.00},
+     {ATOM_TYPE_NN2U, ATOM_TYPE_CN1, ATOM_TYPE_ON1, 121.900000, 836.800000, 0.00000000, 0.00},
+     {ATOM_TYPE_CN3, ATOM_TYPE_CN1, ATOM_TYPE_ON1, 125.500000, 836.800000, 0.00000000, 0.00},
+     {ATOM_TYPE_CN1, ATOM_TYPE_CN3, ATOM_TYPE_HN3, 120.300000, 251.040000, 0.00000000, 0.00},
+     {ATOM_TYPE_HN3, ATOM_TYPE_CN3, ATOM_TYPE_NN2B, 114.300000, 251.040000, 0.00000000, 0.00},
+     {ATOM_TYPE_CN3T, ATOM_TYPE_CN1, ATOM_TYPE_NN2U, 113.500000, 585.760000, 0.00000000, 0.00},
+     {ATOM_TYPE_CN1, ATOM_TYPE_CN3T, ATOM_TYPE_CN3, 116.700000, 1004.160000, 0.00000000, 0.00},
+     {ATOM_TYPE_CN3T, ATOM_TYPE_CN3, ATOM_TYPE_NN2B, 123.600000, 1004.160000, 0.00000000, 0.00},
+     {ATOM_TYPE_CN3T, ATOM_TYPE_CN1, ATOM_TYPE_ON1, 124.600000, 836.800000, 0.00000000, 0.00},
+     {ATOM_TYPE_CN1, ATOM_TYPE_CN3T, ATOM_TYPE_CN9, 118.700000, 317.984000, 0.00000000, 0.00},
+     {ATOM_TYPE_CN3, ATOM_TYPE_CN3T, ATOM_TYPE_CN9, 124.600000, 317.984000, 0.00000000, 0.00},
+     {ATOM_TYPE_CN3T, ATOM_TYPE_CN3, ATOM_TYPE_HN3, 122.100000, 251.040000, 0.00000000, 0.00},
+     {ATOM_TYPE_CN1T, ATOM_TYPE_NN2B, ATOM_TYPE_CN9, 116.000000, 585.760000, 0.00000000, 0.00},
+     {ATOM_TYPE_CN3, ATOM_TYPE_NN2B, ATOM_TYPE_CN9, 122.000000, 585.760000, 0.00000000, 0.00},
+     {ATOM_TYPE_CN1, ATOM_TYPE_NN2, ATOM_TYPE_CN9, 115.400000, 585.760000, 0.00000000, 0.00},
+     {ATOM_TYPE_CN3, ATOM_TYPE_NN2, ATOM_TYPE_CN9, 120.500000, 585.760000, 0.00000000, 0.00},
+     {ATOM_TYPE_CN5, ATOM_TYPE_NN2, ATOM_TYPE_CN9, 125.900000, 585.760000, 0.00000000, 0.00},
+     {ATOM_TYPE_CN4, ATOM_TYPE_NN2, ATOM_TYPE_CN9, 127.800000, 585.760000, 0.00000000, 0.00},
+     {ATOM_TYPE_CN5, ATOM_TYPE_NN2B, ATOM_TYPE_CN9, 125.900000, 585.760000, 0.00000000, 0.00},
+     {ATOM_TYPE_CN4, ATOM_TYPE_NN2B, ATOM_TYPE_CN9, 126.900000, 585.760000, 0.00000000, 0.00},
+     {ATOM_TYPE_CN5, ATOM_TYPE_NN2B, ATOM_TYPE_CN8, 125.900000, 585.760000, 0.00000000, 0.00},
+     {ATOM_TYPE_CN4, ATOM_TYPE_NN2B, ATOM_TYPE_CN8, 126.900000, 585.760000, 0.00000000, 0.00},
+     {ATOM_TYPE_NN2B, ATOM_TYPE_CN8, ATOM_TYPE_CN9, 113.700000, 585.760000, 0.00000000, 0.00},
+     {ATOM_TYPE_CN1T, ATOM_TYPE_NN2B, ATOM_TYPE_CN7B, 118.400000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_CN3, ATOM_TYPE_NN2B, ATOM_TYPE_CN7B, 119.600000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_CN1, ATOM_TYPE_NN2, ATOM_TYPE_CN7B, 120.000000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_CN3, ATOM_TYPE_NN2, ATOM_TYPE_CN7B, 115.900000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_CN5, ATOM_TYPE_NN2, ATOM_TYPE_CN7B, 126.100000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_CN4, ATOM_TYPE_NN2, ATOM_TYPE_CN7B, 127.600000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_CN5, ATOM_TYPE_NN2B, ATOM_TYPE_CN7B, 126.500000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_CN4, ATOM_TYPE_NN2B, ATOM_TYPE_CN7B, 126.300000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_ON6, ATOM_TYPE_CN7B, ATOM_TYPE_NN2, 108.000000, 920.480000, 0.00000000, 0.00},
+     {ATOM_TYPE_ON6B, ATOM_TYPE_CN7B, ATOM_TYPE_NN2, 112.000000, 920.480000, 0.00000000, 0.00},
+     {ATOM_TYPE_CN8, ATOM_TYPE_CN7B, ATOM_TYPE_NN2, 113.700000, 920.480000, 0.00000000, 0.00},
+     {ATOM_TYPE_CN7B, ATOM_TYPE_CN7B, ATOM_TYPE_NN2, 111.000000, 920.480000, 0.00000000, 0.00},
+     {ATOM_TYPE_ON6, ATOM_TYPE_CN7B, ATOM_TYPE_NN2B, 108.000000, 920.480000, 0.00000000, 0.00},
+     {ATOM_TYPE_ON6B, ATOM_TYPE_CN7B, ATOM_TYPE_NN2B, 112.000000, 920.480000, 0.00000000, 0.00},
+     {ATOM_TYPE_CN8, ATOM_TYPE_CN7B, ATOM_TYPE_NN2B, 113.700000, 920.480000, 0.00000000, 0.00},
+     {ATOM_TYPE_CN7B, ATOM_TYPE_CN7B, ATOM_TYPE_NN2B, 111.000000, 920.480000, 0.00000000, 0.00},
+     {ATOM_TYPE_HN7, ATOM_TYPE_CN7B, ATOM_TYPE_NN2, 111.000000, 359.824000, 0.00000000, 0.00},
+     {ATOM_TYPE_HN7, ATOM_TYPE_CN7B, ATOM_TYPE_NN2B, 111.000000, 359.824000, 0.00000000, 0.00},
+     {ATOM_TYPE_CN9, ATOM_TYPE_CN8, ATOM_TYPE_HN8, 110.100000, 289.532800, 0.21790000, 18853.10},
+     {ATOM_TYPE_CN9, ATOM_TYPE_CN7, ATOM_TYPE_HN7, 110.100000, 289.532800, 0.21790000, 18853.10},
+     {ATOM_TYPE_HN8, ATOM_TYPE_CN8, ATOM_TYPE_NN2, 110.100000, 279.742240, 0.00000000, 0.00},
+     {ATOM_TYPE_HN8, ATOM_TYPE_CN8, ATOM_TYPE_ON5, 108.890000, 384.091200, 0.00000000, 0.00},
+     {ATOM_TYPE_CN3, ATOM_TYPE_CN9, ATOM_TYPE_HN9, 110.100000, 279.742240, 0.21790000, 18853.10},
+     {ATOM_TYPE_CN3T, ATOM_TYPE_CN9, ATOM_TYPE_HN9, 110.100000, 279.742240, 0.21790000, 18853.10},
+     {ATOM_TYPE_CN8, ATOM_TYPE_CN9, ATOM_TYPE_HN9, 110.100000, 289.532800, 0.21790000, 18853.10},
+     {ATOM_TYPE_HN9, ATOM_TYPE_CN9, ATOM_TYPE_CN7, 110.100000, 279.742240, 0.21790000, 18853.10},
+     {ATOM_TYPE_HN9, ATOM_TYPE_CN9, ATOM_TYPE_NN2, 110.100000, 279.742240, 0.00000000, 0.00},
+     {ATOM_TYPE_HN9, ATOM_TYPE_CN9, ATOM_TYPE_NN2B, 110.100000, 279.742240, 0.00000000, 0.00},
+     {ATOM_TYPE_HN8, ATOM_TYPE_CN8, ATOM_TYPE_NN2B, 110.100000, 279.742240, 0.00000000, 0.00},
+     {ATOM_TYPE_HN9, ATOM_TYPE_CN9, ATOM_TYPE_ON2, 109.500000, 502.080000, 0.00000000, 0.00},
+     {ATOM_TYPE_CN9, ATOM_TYPE_ON2, ATOM_TYPE_P, 120.000000, 167.360000, 0.23300000, 29288.00},
+     {ATOM_TYPE_HN4, ATOM_TYPE_ON4, ATOM_TYPE_P, 115.000000, 251.040000, 0.23500000, 33472.00},
+     {ATOM_TYPE_HN4, ATOM_TYPE_ON4, ATOM_TYPE_P2, 115.000000, 251.040000, 0.23500000, 33472.00},
+     {ATOM_TYPE_HN5, ATOM_TYPE_ON5, ATOM_TYPE_CN8, 106.000000, 481.160000, 0.00000000, 0.00},
+     {ATOM_TYPE_HN5, ATOM_TYPE_ON5, ATOM_TYPE_CN9, 106.000000, 481.160000, 0.00000000, 0.00},
+     {ATOM_TYPE_ON2, ATOM_TYPE_P, ATOM_TYPE_ON2, 104.300000, 669.440000, 0.00000000, 0.00},
+     {ATOM_TYPE_ON2, ATOM_TYPE_P2, ATOM_TYPE_ON2, 104.300000, 669.440000, 0.00000000, 0.00},
+     {ATOM_TYPE_ON2, ATOM_TYPE_P, ATOM_TYPE_ON4, 108.000000, 402.500800, 0.00000000, 0.00},
+     {ATOM_TYPE_ON2, ATOM_TYPE_P2, ATOM_TYPE_ON4, 108.000000, 402.500800, 0.00000000, 0.00},
+     {ATOM_TYPE_ON3, ATOM_TYPE_P, ATOM_TYPE_ON4, 108.230000, 827.595200, 0.00000000, 0.00},
+     {ATOM_TYPE_ON3, ATOM_TYPE_P2, ATOM_TYPE_ON4, 108.230000, 827.595200, 0.00000000, 0.00},
+     {ATOM_TYPE_ON4, ATOM_TYPE_P, ATOM_TYPE_ON4, 104.000000, 827.595200, 0.00000000, 0.00},
+     {ATOM_TYPE_ON4, ATOM_TYPE_P2, ATOM_TYPE_ON4, 104.000000, 827.595200, 0.00000000, 0.00},
+     {ATOM_TYPE_CN7, ATOM_TYPE_CN8, ATOM_TYPE_ON5, 110.100000, 633.457600, 0.00000000, 0.00},
+     {ATOM_TYPE_HN9, ATOM_TYPE_CN9, ATOM_TYPE_HN9, 108.400000, 297.064000, 0.18020000, 4518.72},
+     {ATOM_TYPE_CN7, ATOM_TYPE_ON6, ATOM_TYPE_CN7B, 108.000000, 920.480000, 0.00000000, 0.00},
+     {ATOM_TYPE_ON6, ATOM_TYPE_CN7B, ATOM_TYPE_CN8, 102.000000, 753.120000, 0.00000000, 0.00},
+     {ATOM_TYPE_CN7B, ATOM_TYPE_CN8, ATOM_TYPE_CN7, 100.000000, 669.440000, 0.00000000, 0.00},
+     {ATOM_TYPE_CN8, ATOM_TYPE_CN7, ATOM_TYPE_CN7, 102.000000, 502.080000, 0.25610000, 6694.40},
+     {ATOM_TYPE_CN9, ATOM_TYPE_CN7, ATOM_TYPE_CN7, 102.000000, 502.080000, 0.25610000, 6694.40},
+     {ATOM_TYPE_CN7, ATOM_TYPE_CN7, ATOM_TYPE_ON6, 104.000000, 836.800000, 0.00000000, 0.00},
+     {ATOM_TYPE_HN7, ATOM_TYPE_CN7, ATOM_TYPE_ON6, 107.240000, 378.233600, 0.00000000, 0.00},
+     {ATOM_TYPE_HN7, ATOM_TYPE_CN7B, ATOM_TYPE_ON6, 107.240000, 378.233600, 0.00000000, 0.00},
+     {ATOM_TYPE_HN7, ATOM_TYPE_CN7, ATOM_TYPE_CN7, 108.000000, 334.720000, 0.00000000, 0.00},
+     {ATOM_TYPE_CN7B, ATOM_TYPE_CN8, ATOM_TYPE_HN8, 110.100000, 279.491200, 0.21790000, 18853.10},
+     {ATOM_TYPE_CN8, ATOM_TYPE_CN7B, ATOM_TYPE_HN7, 110.100000, 279.491200, 0.21790000, 18853.10},
+     {ATOM_TYPE_HN7, ATOM_TYPE_CN7, ATOM_TYPE_CN8, 110.100000, 288.696000, 0.21790000, 18853.10},
+     {ATOM_TYPE_HN8, ATOM_TYPE_CN8, ATOM_TYPE_CN7, 110.100000, 288.947040, 0.21790000, 18853.10},
+     {ATOM_TYPE_HN8, ATOM_TYPE_CN8, ATOM_TYPE_CN8, 110.100000, 288.947040, 0.21790000, 18853.10},
+     {ATOM_TYPE_HN8, ATOM_TYPE_CN8, ATOM_TYPE_HN8, 109.000000, 297.064000, 0.18020000, 4518.72},
+     {ATOM_TYPE_HN7, ATOM_TYPE_CN7, ATOM_TYPE_HN7, 109.000000, 297.064000, 0.18020000, 4518.72},
+     {ATOM_TYPE_CN7, ATOM_TYPE_ON6B, ATOM_TYPE_CN7B, 115.000000, 920.480000, 0.00000000, 0.00},
+     {ATOM_TYPE_CN7, ATOM_TYPE_CN7, ATOM_TYPE_ON6B, 110.000000, 836.800000, 0.00000000, 0.00},
+     {ATOM_TYPE_ON6B, ATOM_TYPE_CN7B, ATOM_TYPE_CN7B, 106.000000, 753.120000, 0.00000000, 0.00},
+     {ATOM_TYPE_CN7B, ATOM_TYPE_CN7B, ATOM_TYPE_CN7, 96.000000, 920.480000, 0.00000000, 0.00},
+     {ATOM_TYPE_CN7B, ATOM_TYPE_CN7, ATOM_TYPE_CN7, 100.000000, 502.080000, 0.25610000, 6694.40},
+     {ATOM_TYPE_HN7, ATOM_TYPE_CN7, ATOM_TYPE_ON6B, 107.240000, 378.233600, 0.00000000, 0.00},
+     {ATOM_TYPE_HN7, ATOM_TYPE_CN7B, ATOM_TYPE_ON6B, 107.240000, 378.233600, 0.00000000, 0.00},
+     {ATOM_TYPE_CN7B, ATOM_TYPE_CN7B, ATOM_TYPE_HN7, 110.100000, 279.491200, 0.21790000, 18853.10},
+     {ATOM_TYPE_HN7, ATOM_TYPE_CN7B, ATOM_TYPE_HN7, 109.000000, 297.064000, 0.18020000, 4518.72},
+     {ATOM_TYPE_ON6, ATOM_TYPE_CN7, ATOM_TYPE_CN8B, 108.200000, 753.120000, 0.00000000, 0.00},
+     {ATOM_TYPE_ON6, ATOM_TYPE_CN7, ATOM_TYPE_CN9, 108.200000, 753.120000, 0.00000000, 0.00},
+     {ATOM_TYPE_CN7, ATOM_TYPE_CN7, ATOM_TYPE_CN8B, 110.000000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_CN8, ATOM_TYPE_CN7, ATOM_TYPE_CN8B, 113.600000, 488.272800, 0.25610000, 9338.69},
+     {ATOM_TYPE_CN7, ATOM_TYPE_CN8B, ATOM_TYPE_ON2, 108.400000, 585.760000, 0.00000000, 0.00},
+     {ATOM_TYPE_CN7, ATOM_TYPE_CN7, ATOM_TYPE_ON2, 109.700000, 962.320000, 0.00000000, 0.00},
+     {ATOM_TYPE_CN7B, ATOM_TYPE_CN7B, ATOM_TYPE_ON2, 109.700000, 962.320000, 0.00000000, 0.00},
+     {ATOM_TYPE_CN8, ATOM_TYPE_CN7, ATOM_TYPE_ON2, 109.700000, 962.320000, 0.00000000, 0.00},
+     {ATOM_TYPE_CN8B, ATOM_TYPE_ON2, ATOM_TYPE_P, 120.000000, 167.360000, 0.23300000, 29288.00},
+     {ATOM_TYPE_CN8B, ATOM_TYPE_ON2, ATOM_TYPE_P2, 120.000000, 167.360000, 0.23300000, 29288.00},
+     {ATOM_TYPE_CN7, ATOM_TYPE_ON2, ATOM_TYPE_P, 120.000000, 167.360000, 0.23300000, 29288.00},
+     {ATOM_TYPE_CN7, ATOM_TYPE_ON2, ATOM_TYPE_P2, 120.000000, 167.360000, 0.23300000, 29288.00},
+     {ATOM_TYPE_CN7B, ATOM_TYPE_ON2, ATOM_TYPE_P, 120.000000, 167.360000, 0.23300000, 29288.00},
+     {ATOM_TYPE_CN7B, ATOM_TYPE_ON2, ATOM_TYPE_P2, 120.000000, 167.360000, 0.23300000, 29288.00},
+     {ATOM_TYPE_HN7, ATOM_TYPE_CN7, ATOM_TYPE_CN8B, 110.100000, 288.696000, 0.21790000, 18853.10},
+     {ATOM_TYPE_HN8, ATOM_TYPE_CN8B, ATOM_TYPE_ON2, 109.500000, 502.080000, 0.00000000, 0.00},
+     {ATOM_TYPE_HN5, ATOM_TYPE_ON5, ATOM_TYPE_CN8B, 106.000000, 481.160000, 0.00000000, 0.00},
+     {ATOM_TYPE_HN8, ATOM_TYPE_CN8B, ATOM_TYPE_HN8, 109.000000, 297.064000, 0.18020000, 4518.72},
+     {ATOM_TYPE_HN8, ATOM_TYPE_CN8B, ATOM_TYPE_CN7, 110.100000, 288.947040, 0.21790000, 18853.10},
+     {ATOM_TYPE_HN7, ATOM_TYPE_CN7, ATOM_TYPE_ON2, 109.500000, 502.080000, 0.00000000, 0.00},
+     {ATOM_TYPE_HN7, ATOM_TYPE_CN7B, ATOM_TYPE_ON2, 109.500000, 502.080000, 0.00000000, 0.00},
+     {ATOM_TYPE_CN7, ATOM_TYPE_CN8B, ATOM_TYPE_ON5, 110.100000, 633.457600, 0.00000000, 0.00},
+     {ATOM_TYPE_CN8B, ATOM_TYPE_CN7, ATOM_TYPE_ON5, 108.200000, 753.120000, 0.00000000, 0.00},
+     {ATOM_TYPE_HN8, ATOM_TYPE_CN8B, ATOM_TYPE_ON5, 108.890000, 384.091200, 0.00000000, 0.00},
+     {ATOM_TYPE_ON5, ATOM_TYPE_CN7, ATOM_TYPE_CN8, 110.000000, 633.457600, 0.00000000, 0.00},
+     {ATOM_TYPE_ON5, ATOM_TYPE_CN7, ATOM_TYPE_CN7, 110.100000, 633.457600, 0.00000000, 0.00},
+     {ATOM_TYPE_HN7, ATOM_TYPE_CN7, ATOM_TYPE_ON5, 109.500000, 502.080000, 0.00000000, 0.00},
+     {ATOM_TYPE_HN5, ATOM_TYPE_ON5, ATOM_TYPE_CN7, 109.000000, 481.160000, 0.00000000, 0.00},
+     {ATOM_TYPE_ON6B, ATOM_TYPE_CN7, ATOM_TYPE_CN8B, 108.200000, 753.120000, 0.00000000, 0.00},
+     {ATOM_TYPE_ON6B, ATOM_TYPE_CN7, ATOM_TYPE_CN9, 108.200000, 753.120000, 0.00000000, 0.00},
+     {ATOM_TYPE_ON2, ATOM_TYPE_CN7, ATOM_TYPE_CN7B, 110.000000, 753.120000, 0.00000000, 0.00},
+     {ATOM_TYPE_ON5, ATOM_TYPE_CN7, ATOM_TYPE_CN7B, 110.000000, 753.120000, 0.00000000, 0.00},
+     {ATOM_TYPE_ON5, ATOM_TYPE_CN7B, ATOM_TYPE_CN7B, 108.400000, 669.440000, 0.00000000, 0.00},
+     {ATOM_TYPE_ON5, ATOM_TYPE_CN7B, ATOM_TYPE_CN7, 108.000000, 753.120000, 0.00000000, 0.00},
+     {ATOM_TYPE_HN7, ATOM_TYPE_CN7B, ATOM_TYPE_ON5, 109.500000, 502.080000, 0.00000000, 0.00},
+     {ATOM_TYPE_HN5, ATOM_TYPE_ON5, ATOM_TYPE_CN7B, 109.000000, 481.160000, 0.00000000, 0.00},
+     {ATOM_TYPE_HN7, ATOM_TYPE_CN7B, ATOM_TYPE_CN7, 110.100000, 288.947040, 0.21790000, 18853.10},
+     {ATOM_TYPE_HN7, ATOM_TYPE_CN7, ATOM_TYPE_CN7B, 110.100000, 288.947040, 0.21790000, 18853.10},
+     {ATOM_TYPE_CN8, ATOM_TYPE_ON2, ATOM_TYPE_P, 120.000000, 167.360000, 0.23300000, 29288.00},
+     {ATOM_TYPE_CN8, ATOM_TYPE_ON2, ATOM_TYPE_P2, 120.000000, 167.360000, 0.23300000, 29288.00},
+     {ATOM_TYPE_ON2, ATOM_TYPE_P, ATOM_TYPE_ON3, 111.600000, 827.595200, 0.00000000, 0.00},
+     {ATOM_TYPE_ON2, ATOM_TYPE_P2, ATOM_TYPE_ON3, 111.600000, 827.595200, 0.00000000, 0.00},
+     {ATOM_TYPE_ON3, ATOM_TYPE_P, ATOM_TYPE_ON3, 120.000000, 1004.160000, 0.00000000, 0.00},
+     {ATOM_TYPE_ON3, ATOM_TYPE_P2, ATOM_TYPE_ON3, 120.000000, 1004.160000, 0.00000000, 0.00},
+     {ATOM_TYPE_HN8, ATOM_TYPE_CN8, ATOM_TYPE_ON2, 109.500000, 502.080000, 0.00000000, 0.00},
+     {ATOM_TYPE_ON5, ATOM_TYPE_P, ATOM_TYPE_ON3, 111.600000, 827.595200, 0.00000000, 0.00},
+     {ATOM_TYPE_ON6, ATOM_TYPE_CN7B, ATOM_TYPE_CN7, 106.250000, 1004.160000, 0.00000000, 0.00},
+     {ATOM_TYPE_CN7B, ATOM_TYPE_CN7, ATOM_TYPE_CN8, 113.600000, 488.272800, 0.25610000, 9338.69},
+     {ATOM_TYPE_OBL, ATOM_TYPE_CL, ATOM_TYPE_CTL3, 125.000000, 585.760000, 0.24420000, 16736.00},
+     {ATOM_TYPE_OBL, ATOM_TYPE_CL, ATOM_TYPE_CTL2, 125.000000, 585.760000, 0.24420000, 16736.00},
+     {ATOM_TYPE_OBL, ATOM_TYPE_CL, ATOM_TYPE_CTL1, 125.000000, 585.760000, 0.24420000, 16736.00},
+     {ATOM_TYPE_OSL, ATOM_TYPE_CL, ATOM_TYPE_OBL, 125.900000, 753.120000, 0.22576000, 133888.00},
+     {ATOM_TYPE_CL, ATOM_TYPE_OSL, ATOM_TYPE_CTL1, 109.600000, 334.720000, 0.22651000, 25104.00},
+     {ATOM_TYPE_CL, ATOM_TYPE_OSL, ATOM_TYPE_CTL2, 109.600000, 334.720000, 0.22651000, 25104.00},
+     {ATOM_TYPE_CL, ATOM_TYPE_OSL, ATOM_TYPE_CTL3, 109.600000, 334.720000, 0.22651000, 25104.00},
+     {ATOM_TYPE_HAL2, ATOM_TYPE_CTL2, ATOM_TYPE_CL, 109.500000, 276.144000, 0.21630000, 25104.00},
+     {ATOM_TYPE_HAL3, ATOM_TYPE_CTL3, ATOM_TYPE_CL, 109.500000, 276.144000, 0.21630000, 25104.00},
+     {ATOM_TYPE_CTL2, ATOM_TYPE_CTL2, ATOM_TYPE_CL, 108.000000, 435.136000, 0.00000000, 0.00},
+     {ATOM_TYPE_CTL2, ATOM_TYPE_CTL1, ATOM_TYPE_CCL, 108.000000, 435.136000, 0.00000000, 0.00},
+     {ATOM_TYPE_CTL3, ATOM_TYPE_CTL2, ATOM_TYPE_CL, 108.000000, 435.136000, 0.00000000, 0.00},
+     {ATOM_TYPE_OSL, ATOM_TYPE_CL, ATOM_TYPE_CTL3, 109.000000, 460.240000, 0.23260000, 16736.00},
+     {ATOM_TYPE_OSL, ATOM_TYPE_CL, ATOM_TYPE_CTL2, 109.000000, 460.240000, 0.23260000, 16736.00},
+     {ATOM_TYPE_OSL, ATOM_TYPE_CL, ATOM_TYPE_CTL1, 109.000000, 460.240000, 0.23260000, 16736.00},
+     {ATOM_TYPE_OHL, ATOM_TYPE_CL, ATOM_TYPE_OBL, 123.000000, 418.400000, 0.22620000, 175728.00},
+     {ATOM_TYPE_OCL, ATOM_TYPE_CL, ATOM_TYPE_CTL2, 118.000000, 334.720000, 0.23880000, 41840.00},
+     {ATOM_TYPE_OCL, ATOM_TYPE_CL, ATOM_TYPE_CTL3, 118.000000, 334.720000, 0.23880000, 41840.00},
+     {ATOM_TYPE_OCL, ATOM_TYPE_CL, ATOM_TYPE_OCL, 124.000000, 836.800000, 0.22250000, 58576.00},
+     {ATOM_TYPE_OCL, ATOM_TYPE_CCL, ATOM_TYPE_OCL, 124.000000, 836.800000, 0.22250000, 58576.00},
+     {ATOM_TYPE_OCL, ATOM_TYPE_CCL, ATOM_TYPE_CTL1, 118.000000, 334.720000, 0.23880000, 41840.00},
+     {ATOM_TYPE_OHL, ATOM_TYPE_CL, ATOM_TYPE_CTL3, 110.500000, 460.240000, 0.00000000, 0.00},
+     {ATOM_TYPE_OHL, ATOM_TYPE_CL, ATOM_TYPE_CTL2, 110.500000, 460.240000, 0.00000000, 0.00},
+     {ATOM_TYPE_HOL, ATOM_TYPE_OHL, ATOM_TYPE_CL, 115.000000, 460.240000, 0.00000000, 0.00},
+     {ATOM_TYPE_OSL, ATOM_TYPE_CTL1, ATOM_TYPE_CTL1, 110.100000, 633.457600, 0.00000000, 0.00},
+     {ATOM_TYPE_OSL, ATOM_TYPE_CTL1, ATOM_TYPE_CTL2, 110.100000, 633.457600, 0.00000000, 0.00},
+     {ATOM_TYPE_OSL, ATOM_TYPE_CTL1, ATOM_TYPE_CTL3, 110.100000, 633.457600, 0.00000000, 0.00},
+     {ATOM_TYPE_OSL, ATOM_TYPE_CTL2, ATOM_TYPE_CTL1, 110.100000, 633.457600, 0.00000000, 0.00},
+     {ATOM_TYPE_OSL, ATOM_TYPE_CTL2, ATOM_TYPE_CTL2, 110.100000, 633.457600, 0.00000000, 0.00},
+     {ATOM_TYPE_OSL, ATOM_TYPE_CTL2, ATOM_TYPE_CTL3, 110.100000, 633.457600, 0.00000000, 0.00},
+     {ATOM_TYPE_OSLP, ATOM_TYPE_CTL1, ATOM_TYPE_CTL1, 110.100000, 633.457600, 0.00000000, 0.00},
+     {ATOM_TYPE_OSLP, ATOM_TYPE_CTL1, ATOM_TYPE_CTL2, 110.100000, 633.457600, 0.00000000, 0.00},
+     {ATOM_TYPE_OSLP, ATOM_TYPE_CTL1, ATOM_TYPE_CTL3, 110.100000, 633.457600, 0.00000000, 0.00},
+     {ATOM_TYPE_OSLP, ATOM_TYPE_CTL2, ATOM_TYPE_CTL1, 110.100000, 633.457600, 0.00000000, 0.00},
+     {ATOM_TYPE_OSLP, ATOM_TYPE_CTL2, ATOM_TYPE_CTL2, 110.100000, 633.457600, 0.00000000, 0.00},
+     {ATOM_TYPE_OSLP, ATOM_TYPE_CTL2, ATOM_TYPE_CTL3, 110.100000, 633.457600, 0.00000000, 0.00},
+     {ATOM_TYPE_HAL2, ATOM_TYPE_CTL2, ATOM_TYPE_HAL2, 109.000000, 297.064000, 0.18020000, 4518.72},
+     {ATOM_TYPE_HAL3, ATOM_TYPE_CTL3, ATOM_TYPE_HAL3, 108.400000, 297.064000, 0.18020000, 4518.72},
+     {ATOM_TYPE_HAL1, ATOM_TYPE_CTL1, ATOM_TYPE_OSL, 109.500000, 502.080000, 0.00000000, 0.00},
+     {ATOM_TYPE_HAL2, ATOM_TYPE_CTL2, ATOM_TYPE_OSL, 109.500000, 502.080000, 0.00000000, 0.00},
+     {ATOM_TYPE_HAL3, ATOM_TYPE_CTL3, ATOM_TYPE_OSL, 109.500000, 502.080000, 0.00000000, 0.00},
+     {ATOM_TYPE_HAL1, ATOM_TYPE_CTL1, ATOM_TYPE_OSLP, 109.500000, 502.080000, 0.00000000, 0.00},
+     {ATOM_TYPE_HAL2, ATOM_TYPE_CTL2, ATOM_TYPE_OSLP, 109.500000, 502.080000, 0.00000000, 0.00},
+     {ATOM_TYPE_HAL3, ATOM_TYPE_CTL3, ATOM_TYPE_OSLP, 109.500000, 502.080000, 0.00000000, 0.00},
+     {ATOM_TYPE_CTL1, ATOM_TYPE_OSL, ATOM_TYPE_PL, 120.000000, 167.360000, 0.23300000, 29288.00},
+     {ATOM_TYPE_CTL2, ATOM_TYPE_OSL, ATOM_TYPE_PL, 120.000000, 167.360000, 0.23300000, 29288.00},
+     {ATOM_TYPE_CTL3, ATOM_TYPE_OSL, ATOM_TYPE_PL, 120.000000, 167.360000, 0.23300000, 29288.00},
+     {ATOM_TYPE_CTL1, ATOM_TYPE_OSLP, ATOM_TYPE_PL, 120.000000, 167.360000, 0.23300000, 29288.00},
+     {ATOM_TYPE_CTL2, ATOM_TYPE_OSLP, ATOM_TYPE_PL, 120.000000, 167.360000, 0.23300000, 29288.00},
+     {ATOM_TYPE_CTL3, ATOM_TYPE_OSLP, ATOM_TYPE_PL, 120.000000, 167.360000, 0.23300000, 29288.00},
+     {ATOM_TYPE_HOL, ATOM_TYPE_OHL, ATOM_TYPE_PL, 115.000000, 251.040000, 0.23000000, 33472.00},
+     {ATOM_TYPE_OSL, ATOM_TYPE_PL, ATOM_TYPE_OSL, 104.300000, 669.440000, 0.00000000, 0.00},
+     {ATOM_TYPE_OSL, ATOM_TYPE_PL, ATOM_TYPE_O2L, 111.600000, 827.595200, 0.00000000, 0.00},
+     {ATOM_TYPE_OSL, ATOM_TYPE_PL, ATOM_TYPE_OHL, 108.000000, 402.500800, 0.00000000, 0.00},
+     {ATOM_TYPE_OSLP, ATOM_TYPE_PL, ATOM_TYPE_OSLP, 104.300000, 669.440000, 0.00000000, 0.00},
+     {ATOM_TYPE_OSLP, ATOM_TYPE_PL, ATOM_TYPE_O2L, 111.600000, 827.595200, 0.00000000, 0.00},
+     {ATOM_TYPE_OSLP, ATOM_TYPE_PL, ATOM_TYPE_OHL, 108.000000, 402.500800, 0.00000000, 0.00},
+     {ATOM_TYPE_O2L, ATOM_TYPE_PL, ATOM_TYPE_O2L, 120.000000, 1004.160000, 0.00000000, 0.00},
+     {ATOM_TYPE_O2L, ATOM_TYPE_PL, ATOM_TYPE_OHL, 108.230000, 827.595200, 0.00000000, 0.00},
+     {ATOM_TYPE_NTL, ATOM_TYPE_CTL2, ATOM_TYPE_HL, 109.500000, 334.720000, 0.21300000, 22593.60},
+     {ATOM_TYPE_NTL, ATOM_TYPE_CTL5, ATOM_TYPE_HL, 109.500000, 334.720000, 0.21300000, 22593.60},
+     {ATOM_TYPE_HL, ATOM_TYPE_CTL2, ATOM_TYPE_HL, 109.500000, 200.832000, 0.17670000, 23430.40},
+     {ATOM_TYPE_HL, ATOM_TYPE_CTL5, ATOM_TYPE_HL, 109.500000, 200.832000, 0.17670000, 23430.40},
+     {ATOM_TYPE_CTL2, ATOM_TYPE_NTL, ATOM_TYPE_CTL2, 109.500000, 502.080000, 0.24660000, 21756.80},
+     {ATOM_TYPE_CTL5, ATOM_TYPE_NTL, ATOM_TYPE_CTL2, 109.500000, 502.080000, 0.24660000, 21756.80},
+     {ATOM_TYPE_CTL5, ATOM_TYPE_NTL, ATOM_TYPE_CTL5, 109.500000, 502.080000, 0.24660000, 21756.80},
+     {ATOM_TYPE_HL, ATOM_TYPE_CTL2, ATOM_TYPE_CTL2, 110.100000, 279.742240, 0.21790000, 18853.10},
+     {ATOM_TYPE_HL, ATOM_TYPE_CTL2, ATOM_TYPE_CTL3, 110.100000, 279.742240, 0.21790000, 18853.10},
+     {ATOM_TYPE_HAL1, ATOM_TYPE_CTL1, ATOM_TYPE_CTL1, 110.100000, 288.696000, 0.21790000, 18853.10},
+     {ATOM_TYPE_HAL1, ATOM_TYPE_CTL1, ATOM_TYPE_CTL2, 110.100000, 288.696000, 0.21790000, 18853.10},
+     {ATOM_TYPE_HAL1, ATOM_TYPE_CTL1, ATOM_TYPE_CTL3, 110.100000, 288.696000, 0.21790000, 18853.10},
+     {ATOM_TYPE_HAL2, ATOM_TYPE_CTL2, ATOM_TYPE_CTL1, 110.100000, 221.752000, 0.21790000, 18853.10},
+     {ATOM_TYPE_HAL2, ATOM_TYPE_CTL2, ATOM_TYPE_CTL2, 110.100000, 221.752000, 0.21790000, 18853.10},
+     {ATOM_TYPE_HAL2, ATOM_TYPE_CTL2, ATOM_TYPE_CTL3, 110.100000, 289.532800, 0.21790000, 18853.10},
+     {ATOM_TYPE_HAL3, ATOM_TYPE_CTL3, ATOM_TYPE_CTL1, 110.100000, 279.742240, 0.21790000, 18853.10},
+     {ATOM_TYPE_HAL3, ATOM_TYPE_CTL3, ATOM_TYPE_CTL2, 110.100000, 289.532800, 0.21790000, 18853.10},
+     {ATOM_TYPE_HAL3, ATOM_TYPE_CTL3, ATOM_TYPE_CTL3, 110.100000, 313.800000, 0.21790000, 18853.10},
+     {ATOM_TYPE_HBL, ATOM_TYPE_CTL1, ATOM_TYPE_CCL, 109.500000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_HBL, ATOM_TYPE_CTL1, ATOM_TYPE_CTL2, 111.000000, 292.880000, 0.00000000, 0.00},
+     {ATOM_TYPE_NTL, ATOM_TYPE_CTL2, ATOM_TYPE_CTL2, 115.000000, 566.513600, 0.00000000, 0.00},
+     {ATOM_TYPE_NTL, ATOM_TYPE_CTL2, ATOM_TYPE_CTL3, 115.000000, 566.513600, 0.00000000, 0.00},
+     {ATOM_TYPE_HCL, ATOM_TYPE_NH3L, ATOM_TYPE_CTL2, 109.500000, 276.144000, 0.20560000, 3347.20},
+     {ATOM_TYPE_HCL, ATOM_TYPE_NH3L, ATOM_TYPE_CTL1, 109.500000, 251.040000, 0.20740000, 16736.00},
+     {ATOM_TYPE_HCL, ATOM_TYPE_NH3L, ATOM_TYPE_HCL, 109.500000, 343.088000, 0.00000000, 0.00},
+     {ATOM_TYPE_NH3L, ATOM_TYPE_CTL2, ATOM_TYPE_CTL2, 110.000000, 566.513600, 0.00000000, 0.00},
+     {ATOM_TYPE_NH3L, ATOM_TYPE_CTL2, ATOM_TYPE_HAL2, 107.500000, 376.560000, 0.20836000, 29288.00},
+     {ATOM_TYPE_CTL1, ATOM_TYPE_CTL1, ATOM_TYPE_CTL1, 111.000000, 446.432800, 0.25610000, 6694.40},
+     {ATOM_TYPE_NH3L, ATOM_TYPE_CTL1, ATOM_TYPE_CCL, 110.000000, 365.681600, 0.00000000, 0.00},
+     {ATOM_TYPE_NH3L, ATOM_TYPE_CTL1, ATOM_TYPE_CTL2, 110.000000, 566.513600, 0.00000000, 0.00},
+     {ATOM_TYPE_NH3L, ATOM_TYPE_CTL1, ATOM_TYPE_HBL, 107.500000, 430.952000, 0.00000000, 0.00},
+     {ATOM_TYPE_CTL1, ATOM_TYPE_CTL1, ATOM_TYPE_CTL2, 113.500000, 488.272800, 0.25610000, 9338.69},
+     {ATOM_TYPE_CTL1, ATOM_TYPE_CTL1, ATOM_TYPE_CTL3, 108.500000, 446.432800, 0.25610000, 6694.40},
+     {ATOM_TYPE_CTL1, ATOM_TYPE_CTL2, ATOM_TYPE_CTL1, 113.500000, 488.272800, 0.25610000, 9338.69},
+     {ATOM_TYPE_CTL1, ATOM_TYPE_CTL2, ATOM_TYPE_CTL2, 113.500000, 488.272800, 0.25610000, 9338.69},
+     {ATOM_TYPE_CTL1, ATOM_TYPE_CTL2, ATOM_TYPE_CTL3, 113.500000, 488.272800, 0.25610000, 9338.69},
+     {ATOM_TYPE_CTL2, ATOM_TYPE_CTL1, ATOM_TYPE_CTL2, 113.500000, 488.272800, 0.25610000, 9338.69},
+     {ATOM_TYPE_CTL2, ATOM_TYPE_CTL1, ATOM_TYPE_CTL3, 113.500000, 488.272800, 0.25610000, 9338.69},
+     {ATOM_TYPE_CTL2, ATOM_TYPE_CTL2, ATOM_TYPE_CTL2, 113.600000, 488.272800, 0.25610000, 9338.69},
+     {ATOM_TYPE_CTL2, ATOM_TYPE_CTL2, ATOM_TYPE_CTL3, 115.000000, 485.344000, 0.25610000, 6694.40},
+     {ATOM_TYPE_CTL3, ATOM_TYPE_CTL1, ATOM_TYPE_CTL3, 113.500000, 488.272800, 0.25610000, 9338.69},
+     {ATOM_TYPE_HOL, ATOM_TYPE_OHL, ATOM_TYPE_CTL1, 106.000000, 481.160000, 0.00000000, 0.00},
+     {ATOM_TYPE_HOL, ATOM_TYPE_OHL, ATOM_TYPE_CTL2, 106.000000, 481.160000, 0.00000000, 0.00},
+     {ATOM_TYPE_HOL, ATOM_TYPE_OHL, ATOM_TYPE_CTL3, 106.000000, 481.160000, 0.00000000, 0.00},
+     {ATOM_TYPE_OHL, ATOM_TYPE_CTL1, ATOM_TYPE_CTL1, 110.100000, 633.457600, 0.00000000, 0.00},
+     {ATOM_TYPE_OHL, ATOM_TYPE_CTL1, ATOM_TYPE_CTL2, 110.100000, 633.457600, 0.00000000, 0.00},
+     {ATOM_TYPE_OHL, ATOM_TYPE_CTL2, ATOM_TYPE_CTL1, 110.100000, 633.457600, 0.00000000, 0.00},
+     {ATOM_TYPE_OHL, ATOM_TYPE_CTL2, ATOM_TYPE_CTL2, 110.100000, 633.457600, 0.00000000, 0.00},
+     {ATOM_TYPE_OHL, ATOM_TYPE_CTL2, ATOM_TYPE_CTL3, 110.100000, 633.457600, 0.00000000, 0.00},
+     {ATOM_TYPE_OHL, ATOM_TYPE_CTL1, ATOM_TYPE_HAL1, 108.890000, 384.091200, 0.00000000, 0.00},
+     {ATOM_TYPE_OHL, ATOM_TYPE_CTL2, ATOM_TYPE_HAL2, 108.890000, 384.091200, 0.00000000, 0.00},
+     {ATOM_TYPE_OHL, ATOM_TYPE_CTL3, ATOM_TYPE_HAL3, 108.890000, 384.091200, 0.00000000, 0.00},
+     {ATOM_TYPE_O2L, ATOM_TYPE_SL, ATOM_TYPE_O2L, 109.470000, 1087.840000, 0.24500000, 29288.00},
+     {ATOM_TYPE_O2L, ATOM_TYPE_SL, ATOM_TYPE_OSL, 98.000000, 711.280000, 0.00000000, 0.00},
+     {ATOM_TYPE_CTL2, ATOM_TYPE_OSL, ATOM_TYPE_SL, 109.000000, 125.520000, 0.19000000, 22593.60},
+     {ATOM_TYPE_CTL3, ATOM_TYPE_OSL, ATOM_TYPE_SL, 109.000000, 125.520000, 0.19000000, 22593.60},
+     {ATOM_TYPE_CEL1, ATOM_TYPE_CEL1, ATOM_TYPE_CTL2, 123.500000, 401.664000, 0.00000000, 0.00},
+     {ATOM_TYPE_CEL1, ATOM_TYPE_CEL1, ATOM_TYPE_CTL3, 123.500000, 401.664000, 0.00000000, 0.00},
+     {ATOM_TYPE_CEL2, ATOM_TYPE_CEL1, ATOM_TYPE_CTL2, 126.000000, 401.664000, 0.00000000, 0.00},
+     {ATOM_TYPE_CEL2, ATOM_TYPE_CEL1, ATOM_TYPE_CTL3, 125.200000, 393.296000, 0.00000000, 0.00},
+     {ATOM_TYPE_HEL1, ATOM_TYPE_CEL1, ATOM_TYPE_CEL1, 119.500000, 435.136000, 0.00000000, 0.00},
+     {ATOM_TYPE_HEL1, ATOM_TYPE_CEL1, ATOM_TYPE_CEL2, 118.000000, 351.456000, 0.00000000, 0.00},
+     {ATOM_TYPE_HEL1, ATOM_TYPE_CEL1, ATOM_TYPE_CTL2, 116.000000, 334.720000, 0.00000000, 0.00},
+     {ATOM_TYPE_HEL1, ATOM_TYPE_CEL1, ATOM_TYPE_CTL3, 117.000000, 184.096000, 0.00000000, 0.00},
+     {ATOM_TYPE_HEL2, ATOM_TYPE_CEL2, ATOM_TYPE_CEL1, 120.500000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_HEL2, ATOM_TYPE_CEL2, ATOM_TYPE_CEL2, 120.500000, 464.424000, 0.00000000, 0.00},
+     {ATOM_TYPE_HEL2, ATOM_TYPE_CEL2, ATOM_TYPE_HEL2, 119.000000, 158.992000, 0.00000000, 0.00},
+     {ATOM_TYPE_CEL1, ATOM_TYPE_CTL2, ATOM_TYPE_CTL2, 112.200000, 267.776000, 0.00000000, 0.00},
+     {ATOM_TYPE_CEL1, ATOM_TYPE_CTL2, ATOM_TYPE_CTL3, 112.200000, 267.776000, 0.00000000, 0.00},
+     {ATOM_TYPE_HAL2, ATOM_TYPE_CTL2, ATOM_TYPE_CEL1, 111.500000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_HAL3, ATOM_TYPE_CTL3, ATOM_TYPE_CEL1, 111.500000, 351.456000, 0.00000000, 0.00},
+     {ATOM_TYPE_CEL1, ATOM_TYPE_CTL2, ATOM_TYPE_CEL1, 114.000000, 251.040000, 0.00000000, 0.00},
+     {ATOM_TYPE_HCA1A, ATOM_TYPE_CC31A, ATOM_TYPE_CC31A, 110.100000, 288.696000, 0.21790000, 18853.10},
+     {ATOM_TYPE_HCA1A, ATOM_TYPE_CC31A, ATOM_TYPE_CC32A, 110.100000, 288.696000, 0.21790000, 18853.10},
+     {ATOM_TYPE_HCA1A, ATOM_TYPE_CC31A, ATOM_TYPE_CC33A, 110.100000, 288.696000, 0.21790000, 18853.10},
+     {ATOM_TYPE_HCA2A, ATOM_TYPE_CC32A, ATOM_TYPE_CC30A, 110.100000, 221.752000, 0.21790000, 18853.10},
+     {ATOM_TYPE_HCA2A, ATOM_TYPE_CC32A, ATOM_TYPE_CC31A, 110.100000, 221.752000, 0.21790000, 18853.10},
+     {ATOM_TYPE_HCA2A, ATOM_TYPE_CC32A, ATOM_TYPE_CC32A, 110.100000, 221.752000, 0.21790000, 18853.10},
+     {ATOM_TYPE_HCA2A, ATOM_TYPE_CC32A, ATOM_TYPE_CC33A, 110.100000, 289.532800, 0.21790000, 18853.10},
+     {ATOM_TYPE_HCA3A, ATOM_TYPE_CC33A, ATOM_TYPE_CC30A, 110.100000, 279.742240, 0.21790000, 18853.10},
+     {ATOM_TYPE_HCA3A, ATOM_TYPE_CC33A, ATOM_TYPE_CC31A, 110.100000, 279.742240, 0.21790000, 18853.10},
+     {ATOM_TYPE_HCA3A, ATOM_TYPE_CC33A, ATOM_TYPE_CC32A, 110.100000, 289.532800, 0.21790000, 18853.10},
+     {ATOM_TYPE_HCA3A, ATOM_TYPE_CC33A, ATOM_TYPE_CC33A, 110.100000, 313.800000, 0.21790000, 18853.10},
+     {ATOM_TYPE_HCA2A, ATOM_TYPE_CC32A, ATOM_TYPE_HCA2A, 109.000000, 297.064000, 0.18020000, 4518.72},
+     {ATOM_TYPE_HCA3A, ATOM_TYPE_CC33A, ATOM_TYPE_HCA3A, 108.400000, 297.064000, 0.18020000, 4518.72},
+     {ATOM_TYPE_CC30A, ATOM_TYPE_CC32A, ATOM_TYPE_CC32A, 113.500000, 488.272800, 0.25610000, 9338.69},
+     {ATOM_TYPE_CC30A, ATOM_TYPE_CC32A, ATOM_TYPE_CC33A, 113.500000, 488.272800, 0.25610000, 9338.69},
+     {ATOM_TYPE_CC31A, ATOM_TYPE_CC31A, ATOM_TYPE_CC31A, 111.000000, 446.432800, 0.25610000, 6694.40},
+     {ATOM_TYPE_CC31A, ATOM_TYPE_CC31A, ATOM_TYPE_CC32A, 113.500000, 488.272800, 0.25610000, 9338.69},
+     {ATOM_TYPE_CC31A, ATOM_TYPE_CC31A, ATOM_TYPE_CC33A, 108.500000, 446.432800, 0.25610000, 6694.40},
+     {ATOM_TYPE_CC31A, ATOM_TYPE_CC32A, ATOM_TYPE_CC31A, 113.500000, 488.272800, 0.25610000, 9338.69},
+     {ATOM_TYPE_CC31A, ATOM_TYPE_CC32A, ATOM_TYPE_CC32A, 113.500000, 488.272800, 0.25610000, 9338.69},
+     {ATOM_TYPE_CC31A, ATOM_TYPE_CC32A, ATOM_TYPE_CC33A, 113.500000, 488.272800, 0.25610000, 9338.69},
+     {ATOM_TYPE_CC32A, ATOM_TYPE_CC30A, ATOM_TYPE_CC32A, 113.500000, 488.272800, 0.25610000, 9338.69},
+     {ATOM_TYPE_CC32A, ATOM_TYPE_CC31A, ATOM_TYPE_CC32A, 113.500000, 488.272800, 0.25610000, 9338.69},
+     {ATOM_TYPE_CC32A, ATOM_TYPE_CC32A, ATOM_TYPE_CC32A, 113.600000, 488.272800, 0.25610000, 9338.69},
+     {ATOM_TYPE_CC32A, ATOM_TYPE_CC32A, ATOM_TYPE_CC33A, 115.000000, 485.344000, 0.25610000, 6694.40},
+     {ATOM_TYPE_CC33A, ATOM_TYPE_CC30A, ATOM_TYPE_CC33A, 114.000000, 446.432800, 0.25610000, 6694.40},
+     {ATOM_TYPE_CC33A, ATOM_TYPE_CC31A, ATOM_TYPE_CC32A, 114.000000, 446.432800, 0.25610000, 6694.40},
+     {ATOM_TYPE_CC33A, ATOM_TYPE_CC31A, ATOM_TYPE_CC33A, 114.000000, 446.432800, 0.25610000, 6694.40},
+     {ATOM_TYPE_CC33A, ATOM_TYPE_CC32A, ATOM_TYPE_CC33A, 114.000000, 446.432800, 0.25610000, 6694.40},
+     {ATOM_TYPE_CC325A, ATOM_TYPE_CC325A, ATOM_TYPE_CC325A, 106.000000, 485.344000, 0.25610000, 9338.69},
+     {ATOM_TYPE_HCA25A, ATOM_TYPE_CC325A, ATOM_TYPE_CC325A, 111.400000, 292.880000, 0.21790000, 18853.10},
+     {ATOM_TYPE_HCA25A, ATOM_TYPE_CC325A, ATOM_TYPE_HCA25A, 106.800000, 322.168000, 0.18020000, 4518.72},
+     {ATOM_TYPE_HCA25A, ATOM_TYPE_CC325B, ATOM_TYPE_CC325B, 111.400000, 292.880000, 0.21790000, 18853.10},
+     {ATOM_TYPE_HCA25A, ATOM_TYPE_CC325B, ATOM_TYPE_HCA25A, 106.800000, 322.168000, 0.18020000, 4518.72},
+     {ATOM_TYPE_CC325B, ATOM_TYPE_CC325B, ATOM_TYPE_CC325B, 109.500000, 485.344000, 0.25610000, 9338.69},
+     {ATOM_TYPE_OC305A, ATOM_TYPE_CC325B, ATOM_TYPE_CC325B, 111.100000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_CC325B, ATOM_TYPE_OC305A, ATOM_TYPE_CC325B, 111.000000, 794.960000, 0.00000000, 0.00},
+     {ATOM_TYPE_HCA25A, ATOM_TYPE_CC325B, ATOM_TYPE_OC305A, 107.300000, 585.760000, 0.00000000, 0.00},
+     {ATOM_TYPE_HCA3A, ATOM_TYPE_CC33A, ATOM_TYPE_CC325B, 110.100000, 289.532800, 0.21790000, 18853.10},
+     {ATOM_TYPE_CC325B, ATOM_TYPE_CC325B, ATOM_TYPE_CC33A, 115.000000, 485.344000, 0.25610000, 6694.40},
+     {ATOM_TYPE_HCA25A, ATOM_TYPE_CC325B, ATOM_TYPE_CC33A, 110.100000, 289.532800, 0.21790000, 18853.10},
+     {ATOM_TYPE_OC305A, ATOM_TYPE_CC325B, ATOM_TYPE_CC33A, 111.500000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_CC32A, ATOM_TYPE_OC30A, ATOM_TYPE_CC32A, 109.700000, 794.960000, 0.00000000, 0.00},
+     {ATOM_TYPE_CC33A, ATOM_TYPE_OC30A, ATOM_TYPE_CC32A, 109.700000, 794.960000, 0.00000000, 0.00},
+     {ATOM_TYPE_CC33A, ATOM_TYPE_OC30A, ATOM_TYPE_CC33A, 109.700000, 794.960000, 0.00000000, 0.00},
+     {ATOM_TYPE_OC30A, ATOM_TYPE_CC32A, ATOM_TYPE_CC32A, 111.500000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_OC30A, ATOM_TYPE_CC32A, ATOM_TYPE_CC33A, 111.500000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_HCA3A, ATOM_TYPE_CC33A, ATOM_TYPE_OC30A, 109.500000, 502.080000, 0.00000000, 0.00},
+     {ATOM_TYPE_HCA2A, ATOM_TYPE_CC32A, ATOM_TYPE_OC30A, 109.500000, 502.080000, 0.00000000, 0.00},
+     {ATOM_TYPE_HCA2A, ATOM_TYPE_CC326A, ATOM_TYPE_CC326A, 110.100000, 288.696000, 0.21790000, 18853.10},
+     {ATOM_TYPE_HCA2A, ATOM_TYPE_CC326A, ATOM_TYPE_HCA2A, 109.000000, 297.064000, 0.18020000, 4518.72},
+     {ATOM_TYPE_CC326A, ATOM_TYPE_CC326A, ATOM_TYPE_CC326A, 112.000000, 488.272800, 0.25610000, 9338.69},
+     {ATOM_TYPE_OC30A, ATOM_TYPE_CC326A, ATOM_TYPE_CC326A, 111.500000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_CC326A, ATOM_TYPE_OC30A, ATOM_TYPE_CC326A, 109.700000, 794.960000, 0.00000000, 0.00},
+     {ATOM_TYPE_HCA2A, ATOM_TYPE_CC326A, ATOM_TYPE_OC30A, 109.500000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_OST, ATOM_TYPE_CST, ATOM_TYPE_OST, 180.000000, 25104.000000, 0.00000000, 0.00},
+     {ATOM_TYPE_CS, ATOM_TYPE_SS, ATOM_TYPE_FE, 100.600000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_SS, ATOM_TYPE_FE, ATOM_TYPE_NPH, 90.000000, 836.800000, 0.00000000, 0.00},
+     {ATOM_TYPE_CPA, ATOM_TYPE_CPB, ATOM_TYPE_CE1, 126.740000, 585.760000, 0.00000000, 0.00},
+     {ATOM_TYPE_CPA, ATOM_TYPE_CPM, ATOM_TYPE_CPA, 125.120000, 788.265600, 0.00000000, 0.00},
+     {ATOM_TYPE_CPA, ATOM_TYPE_NPH, ATOM_TYPE_CPA, 103.900000, 1165.662400, 0.00000000, 0.00},
+     {ATOM_TYPE_CPB, ATOM_TYPE_CE1, ATOM_TYPE_CE2, 121.500000, 585.760000, 0.00000000, 0.00},
+     {ATOM_TYPE_CPB, ATOM_TYPE_CPB, ATOM_TYPE_CE1, 126.750000, 585.760000, 0.00000000, 0.00},
+     {ATOM_TYPE_CPB, ATOM_TYPE_CPB, ATOM_TYPE_CPA, 106.510000, 257.734400, 0.00000000, 0.00},
+     {ATOM_TYPE_CPM, ATOM_TYPE_CPA, ATOM_TYPE_CPB, 124.070000, 515.468800, 0.00000000, 0.00},
+     {ATOM_TYPE_CT2, ATOM_TYPE_CPB, ATOM_TYPE_CPA, 126.740000, 543.920000, 0.00000000, 0.00},
+     {ATOM_TYPE_CT2, ATOM_TYPE_CPB, ATOM_TYPE_CPB, 126.750000, 543.920000, 0.00000000, 0.00},
+     {ATOM_TYPE_CT2, ATOM_TYPE_CT2, ATOM_TYPE_CPB, 113.000000, 585.760000, 0.00000000, 0.00},
+     {ATOM_TYPE_CT3, ATOM_TYPE_CPB, ATOM_TYPE_CPA, 126.740000, 543.920000, 0.00000000, 0.00},
+     {ATOM_TYPE_CT3, ATOM_TYPE_CPB, ATOM_TYPE_CPB, 126.750000, 543.920000, 0.00000000, 0.00},
+     {ATOM_TYPE_FE, ATOM_TYPE_NPH, ATOM_TYPE_CPA, 128.050000, 804.583200, 0.00000000, 0.00},
+     {ATOM_TYPE_FE, ATOM_TYPE_NR2, ATOM_TYPE_CPH1, 133.000000, 251.040000, 0.00000000, 0.00},
+     {ATOM_TYPE_FE, ATOM_TYPE_NR2, ATOM_TYPE_CPH2, 123.000000, 251.040000, 0.00000000, 0.00},
+     {ATOM_TYPE_HA, ATOM_TYPE_CPM, ATOM_TYPE_CPA, 117.440000, 106.273600, 0.00000000, 0.00},
+     {ATOM_TYPE_HA, ATOM_TYPE_CPM, ATOM_TYPE_FE, 180.000000, 0.000000, 0.00000000, 0.00},
+     {ATOM_TYPE_HA2, ATOM_TYPE_CT2, ATOM_TYPE_CPB, 109.500000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_HA3, ATOM_TYPE_CT3, ATOM_TYPE_CPB, 109.500000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_HE1, ATOM_TYPE_CE1, ATOM_TYPE_CPB, 120.000000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_NPH, ATOM_TYPE_CPA, ATOM_TYPE_CPB, 111.540000, 1020.896000, 0.00000000, 0.00},
+     {ATOM_TYPE_NPH, ATOM_TYPE_CPA, ATOM_TYPE_CPM, 124.390000, 736.384000, 0.00000000, 0.00},
+     {ATOM_TYPE_NPH, ATOM_TYPE_FE, ATOM_TYPE_CM, 90.000000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_NPH, ATOM_TYPE_FE, ATOM_TYPE_CPM, 45.000000, 0.000000, 0.00000000, 0.00},
+     {ATOM_TYPE_NPH, ATOM_TYPE_FE, ATOM_TYPE_NPH, 90.000000, 120.415520, 0.00000000, 0.00},
+     {ATOM_TYPE_NR2, ATOM_TYPE_FE, ATOM_TYPE_CM, 180.000000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_NR2, ATOM_TYPE_FE, ATOM_TYPE_NPH, 90.000000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_OM, ATOM_TYPE_CM, ATOM_TYPE_FE, 180.000000, 292.880000, 0.00000000, 0.00},
+     {ATOM_TYPE_OM, ATOM_TYPE_FE, ATOM_TYPE_NPH, 90.000000, 41.840000, 0.00000000, 0.00},
+     {ATOM_TYPE_OM, ATOM_TYPE_OM, ATOM_TYPE_FE, 180.000000, 0.000000, 0.00000000, 0.00},
+     {ATOM_TYPE_CTL1, ATOM_TYPE_CTL2, ATOM_TYPE_CEL1, 112.200000, 267.776000, 0.00000000, 0.00},
+     {ATOM_TYPE_CTL1, ATOM_TYPE_CEL1, ATOM_TYPE_CTL2, 113.000000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_CEL1, ATOM_TYPE_CEL1, ATOM_TYPE_CTL1, 123.500000, 401.664000, 0.00000000, 0.00},
+     {ATOM_TYPE_CTL1, ATOM_TYPE_CTL1, ATOM_TYPE_CEL1, 112.200000, 267.776000, 0.00000000, 0.00},
+     {ATOM_TYPE_CTL3, ATOM_TYPE_CTL1, ATOM_TYPE_CEL1, 112.200000, 267.776000, 0.00000000, 0.00},
+     {ATOM_TYPE_CTL2, ATOM_TYPE_CTL1, ATOM_TYPE_CEL1, 112.200000, 267.776000, 0.00000000, 0.00},
+     {ATOM_TYPE_OHL, ATOM_TYPE_CTL1, ATOM_TYPE_CTL3, 110.100000, 633.457600, 0.00000000, 0.00},
+     {ATOM_TYPE_HOL, ATOM_TYPE_OHL, ATOM_TYPE_CRL1, 106.000000, 481.160000, 0.00000000, 0.00},
+     {ATOM_TYPE_OHL, ATOM_TYPE_CRL1, ATOM_TYPE_CRL2, 110.100000, 633.457600, 0.00000000, 0.00},
+     {ATOM_TYPE_OHL, ATOM_TYPE_CRL1, ATOM_TYPE_HGA1, 108.890000, 384.091200, 0.00000000, 0.00},
+     {ATOM_TYPE_HAL3, ATOM_TYPE_CTL3, ATOM_TYPE_CRL1, 110.100000, 279.742240, 0.21790000, 18853.10},
+     {ATOM_TYPE_CRL1, ATOM_TYPE_CRL1, ATOM_TYPE_CTL3, 108.500000, 446.432800, 0.25610000, 6694.40},
+     {ATOM_TYPE_CRL2, ATOM_TYPE_CRL1, ATOM_TYPE_CTL3, 113.500000, 488.272800, 0.25610000, 9338.69},
+     {ATOM_TYPE_HEL1, ATOM_TYPE_CEL1, ATOM_TYPE_CRL2, 116.000000, 334.720000, 0.00000000, 0.00},
+     {ATOM_TYPE_HGA2, ATOM_TYPE_CRL2, ATOM_TYPE_CEL1, 111.500000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_HAL2, ATOM_TYPE_CRL2, ATOM_TYPE_CEL1, 111.500000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_HGA2, ATOM_TYPE_CTL2, ATOM_TYPE_CEL1, 111.500000, 376.560000, 0.00000000, 0.00},
+     {ATOM_TYPE_CRL1, ATOM_TYPE_CRL2, ATOM_TYPE_CEL1, 112.200000, 267.776000, 0.00000000, 0.00},
+     {ATOM_TYPE_CEL1, ATOM_TYPE_CEL1, ATOM_TYPE_CRL2, 123.500000, 401.664000, 0.00000000, 0.00},
+     {ATOM_TYPE_CEL1, ATOM_TYPE_CEL1, ATOM_TYPE_CRL1, 123.500000, 401.664000, 0.00000000, 0.00},
+     {ATOM_TYPE_CRL1, ATOM_TYPE_CRL1, ATOM_TYPE_CEL1, 112.200000, 267.776000, 0.00000000, 0.00},
+     {ATOM_TYPE_CTL1, ATOM_TYPE_CRL1, ATOM_TYPE_CEL1, 112.200000, 267.776000, 0.00000000, 0.00},
+     {ATOM_TYPE_CRL1, ATOM_TYPE_CTL1, ATOM_TYPE_CEL1, 112.200000, 267.776000, 0.00000000, 0.00},
+     {ATOM_TYPE_CTL3, ATOM_TYPE_CRL1, ATOM_TYPE_CEL1, 112.200000, 267.776000, 0.00000000, 0.00},
+     {ATOM_TYPE_CRL2, ATOM_TYPE_CRL1, ATOM_TYPE_CEL1, 112.200000, 267.776000, 0.00000000, 0.00},
+     {ATOM_TYPE_CTL2, ATOM_TYPE_CRL1, ATOM_TYPE_CEL1, 112.200000, 267.776000, 0.00000000, 0.00},
+     {ATOM_TYPE_CRL2, ATOM_TYPE_CTL1, ATOM_TYPE_CEL1, 112.200000, 267.776000, 0.00000000, 0.00},
+     {ATOM_TYPE_CRL2, ATOM_TYPE_CRL1, ATOM_TYPE_CTL2, 113.500000, 488.272800, 0.25610000, 9338.69},
+     {ATOM_TYPE_CRL2, ATOM_TYPE_CRL1, ATOM_TYPE_CRL2, 113.500000, 488.272800, 0.25610000, 9338.69},
+     {ATOM_TYPE_HGA1, ATOM_TYPE_CRL1, ATOM_TYPE_CTL2, 110.100000, 288.696000, 0.21790000, 18853.10},
+     {ATOM_TYPE_HGA1, ATOM_TYPE_CRL1, ATOM_TYPE_CRL2, 110.100000, 288.696000, 0.21790000, 18853.10},
+     {ATOM_TYPE_CRL1, ATOM_TYPE_CRL1, ATOM_TYPE_CTL2, 113.500000, 488.272800, 0.25610000, 9338.69},
+     {ATOM_TYPE_CRL1, ATOM_TYPE_CRL1, ATOM_TYPE_CRL2, 113.500000, 488.272800, 0.25610000, 9338.69},
+     {ATOM_TYPE_CRL1, ATOM_TYPE_CTL2, ATOM_TYPE_CTL3, 113.500000, 488.272800, 0.25610000, 9338.69},
+     {ATOM_TYPE_HAL2, ATOM_TYPE_CTL2, ATOM_TYPE_CRL1, 110.100000, 221.752000, 0.21790000, 18853.10},
+     {ATOM_TYPE_HGA2, ATOM_TYPE_CRL2, ATOM_TYPE_CRL1, 110.100000, 221.752000, 0.21790000, 18853.10},
+     {ATOM_TYPE_CRL1, ATOM_TYPE_CTL2, ATOM_TYPE_CTL2, 113.500000, 488.272800, 0.25610000, 9338.69},
+     {ATOM_TYPE_CRL1, ATOM_TYPE_CRL2, ATOM_TYPE_CRL2, 113.500000, 488.272800, 0.25610000, 9338.69},
+     {ATOM_TYPE_CRL1, ATOM_TYPE_CEL1, ATOM_TYPE_CRL2, 113.000000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_CRL1, ATOM_TYPE_CRL1, ATOM_TYPE_CRL1, 111.000000, 446.432800, 0.25610000, 6694.40},
+     {ATOM_TYPE_CTL1, ATOM_TYPE_CRL1, ATOM_TYPE_CRL2, 113.500000, 488.272800, 0.25610000, 9338.69},
+     {ATOM_TYPE_HGA1, ATOM_TYPE_CRL1, ATOM_TYPE_CTL1, 110.100000, 288.696000, 0.21790000, 18853.10},
+     {ATOM_TYPE_HGA1, ATOM_TYPE_CRL1, ATOM_TYPE_CRL1, 110.100000, 288.696000, 0.21790000, 18853.10},
+     {ATOM_TYPE_CTL1, ATOM_TYPE_CRL1, ATOM_TYPE_CRL1, 111.000000, 446.432800, 0.25610000, 6694.40},
+     {ATOM_TYPE_HAL1, ATOM_TYPE_CTL1, ATOM_TYPE_CRL1, 110.100000, 288.696000, 0.21790000, 18853.10},
+     {ATOM_TYPE_CRL1, ATOM_TYPE_CTL1, ATOM_TYPE_CTL3, 108.500000, 446.432800, 0.25610000, 6694.40},
+     {ATOM_TYPE_CRL1, ATOM_TYPE_CTL1, ATOM_TYPE_CTL2, 113.500000, 488.272800, 0.25610000, 9338.69},
+     {ATOM_TYPE_CEL2, ATOM_TYPE_CEL1, ATOM_TYPE_CRL2, 126.000000, 401.664000, 0.00000000, 0.00},
+     {ATOM_TYPE_CEL1, ATOM_TYPE_CRL2, ATOM_TYPE_CRL2, 112.200000, 267.776000, 0.00000000, 0.00},
+     {ATOM_TYPE_CEL1, ATOM_TYPE_CTL2, ATOM_TYPE_CRL2, 112.200000, 267.776000, 0.00000000, 0.00},
+     {ATOM_TYPE_CEL1, ATOM_TYPE_CRL2, ATOM_TYPE_CTL2, 112.200000, 267.776000, 0.00000000, 0.00},
+     {ATOM_TYPE_CEL1, ATOM_TYPE_CRL2, ATOM_TYPE_CTL3, 112.200000, 267.776000, 0.00000000, 0.00},
+     {ATOM_TYPE_CEL1, ATOM_TYPE_CRL2, ATOM_TYPE_CEL1, 114.000000, 251.040000, 0.00000000, 0.00},
+     {ATOM_TYPE_CTL1, ATOM_TYPE_CRL2, ATOM_TYPE_CEL1, 112.200000, 267.776000, 0.00000000, 0.00},
+     {ATOM_TYPE_CRL1, ATOM_TYPE_CTL2, ATOM_TYPE_CEL1, 112.200000, 267.776000, 0.00000000, 0.00},
+     {ATOM_TYPE_CTL1, ATOM_TYPE_CEL1, ATOM_TYPE_CRL2, 113.000000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_CRL1, ATOM_TYPE_CEL1, ATOM_TYPE_CTL2, 113.000000, 418.400000, 0.00000000, 0.00},
+     {ATOM_TYPE_HGA2, ATOM_TYPE_CRL2, ATOM_TYPE_HGA2, 109.000000, 297.064000, 0.18020000, 4518.72},
+     {ATOM_TYPE_HGA2, ATOM_TYPE_CRL2, ATOM_TYPE_CRL2, 110.100000, 221.752000, 0.21790000, 18853.10},
+     {ATOM_TYPE_HGA1, ATOM_TYPE_CRL1, ATOM_TYPE_CTL3, 110.100000, 288.696000, 0.21790000, 18853.10},
+     {ATOM_TYPE_CRL2, ATOM_TYPE_CRL2, ATOM_TYPE_CRL2, 113.600000, 488.272800, 0.25610000, 9338.69},
+};
+
+} // End namespace charmm_parameters
+
+#endif
@@ -0,0 +1,768 @@
+// atom_types.h --- IDs of the atom types in the CHARMM parameter files
+// Generated by generate_parameter_tables.cmake from the .itp files. Do not edit.
+// Copyright (C) 2026 agent
+//
+// This file is part of Phaistos
+//
+// Phaistos is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Phaistos is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Phaistos.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+#ifndef TERM_CHARMM_ATOM_TYPES_H
+#define TERM_CHARMM_ATOM_TYPES_H
+
+#include <string>
+#include <cstring>
+#include <algorithm>
+
+namespace charmm_parameters {
+
+//! IDs of the atom types. The IDs follow the sorted atom type names.
+//! ATOM_TYPE_X is the wildcard type.
+enum AtomTypeId {
+     ATOM_TYPE_ALG1 = 0,
+     ATOM_TYPE_BRGA1 = 1,
+     ATOM_TYPE_BRGA2 = 2,
+     ATOM_TYPE_BRGA3 = 3,
+     ATOM_TYPE_BRGR1 = 4,
+     ATOM_TYPE_C = 5,
+     ATOM_TYPE_CA = 6,
+     ATOM_TYPE_CAI = 7,
+     ATOM_TYPE_CC = 8,
+     ATOM_TYPE_CC2O1 = 9,
+     ATOM_TYPE_CC2O2 = 10,
+     ATOM_TYPE_CC2O3 = 11,
+     ATOM_TYPE_CC2O4 = 12,
+     ATOM_TYPE_CC301 = 13,
+     ATOM_TYPE_CC3051 = 14,
+     ATOM_TYPE_CC3062 = 15,
+     ATOM_TYPE_CC30A = 16,
+     ATOM_TYPE_CC311 = 17,
+     ATOM_TYPE_CC311C = 18,
+     ATOM_TYPE_CC311D = 19,
+     ATOM_TYPE_CC312 = 20,
+     ATOM_TYPE_CC312C = 21,
+     ATOM_TYPE_CC312D = 22,
+     ATOM_TYPE_CC3151 = 23,
+     ATOM_TYPE_CC3152 = 24,
+     ATOM_TYPE_CC3153 = 25,
+     ATOM_TYPE_CC3161 = 26,
+     ATOM_TYPE_CC3162 = 27,
+     ATOM_TYPE_CC3163 = 28,
+     ATOM_TYPE_CC31A = 29,
+     ATOM_TYPE_CC321 = 30,
+     ATOM_TYPE_CC321C = 31,
+     ATOM_TYPE_CC321D = 32,
+     ATOM_TYPE_CC322 = 33,
+     ATOM_TYPE_CC322C = 34,
+     ATOM_TYPE_CC3251 = 35,
+     ATOM_TYPE_CC325A = 36,
+     ATOM_TYPE_CC325B = 37,
+     ATOM_TYPE_CC3261 = 38,
+     ATOM_TYPE_CC3263 = 39,
+     ATOM_TYPE_CC326A = 40,
+     ATOM_TYPE_CC32A = 41,
+     ATOM_TYPE_CC331 = 42,
+     ATOM_TYPE_CC33A = 43,
+     ATOM_TYPE_CCL = 44,
+     ATOM_TYPE_CD = 45,
+     ATOM_TYPE_CE1 = 46,
+     ATOM_TYPE_CE2 = 47,
+     ATOM_TYPE_CEL1 = 48,
+     ATOM_TYPE_CEL2 = 49,
+     ATOM_TYPE_CG1N1 = 50,
+     ATOM_TYPE_CG1T1 = 51,
+     ATOM_TYPE_CG251O = 52,
+     ATOM_TYPE_CG252O = 53,
+     ATOM_TYPE_CG25C1 = 54,
+     ATOM_TYPE_CG25C2 = 55,
+     ATOM_TYPE_CG2D1 = 56,
+     ATOM_TYPE_CG2D1O = 57,
+     ATOM_TYPE_CG2D2 = 58,
+     ATOM_TYPE_CG2D2O = 59,
+     ATOM_TYPE_CG2DC1 = 60,
+     ATOM_TYPE_CG2DC2 = 61,
+     ATOM_TYPE_CG2DC3 = 62,
+     ATOM_TYPE_CG2N1 = 63,
+     ATOM_TYPE_CG2N2 = 64,
+     ATOM_TYPE_CG2O1 = 65,
+     ATOM_TYPE_CG2O2 = 66,
+     ATOM_TYPE_CG2O3 = 67,
+     ATOM_TYPE_CG2O4 = 68,
+     ATOM_TYPE_CG2O5 = 69,
+     ATOM_TYPE_CG2O6 = 70,
+     ATOM_TYPE_CG2O7 = 71,
+     ATOM_TYPE_CG2R51 = 72,
+     ATOM_TYPE_CG2R52 = 73,
+     ATOM_TYPE_CG2R53 = 74,
+     ATOM_TYPE_CG2R61 = 75,
+     ATOM_TYPE_CG2R62 = 76,
+     ATOM_TYPE_CG2R63 = 77,
+     ATOM_TYPE_CG2R64 = 78,
+     ATOM_TYPE_CG2R66 = 79,
+     ATOM_TYPE_CG2R67 = 80,
+     ATOM_TYPE_CG2R71 = 81,
+     ATOM_TYPE_CG2RC0 = 82,
+     ATOM_TYPE_CG2RC7 = 83,
+     ATOM_TYPE_CG301 = 84,
+     ATOM_TYPE_CG302 = 85,
+     ATOM_TYPE_CG311 = 86,
+     ATOM_TYPE_CG312 = 87,
+     ATOM_TYPE_CG314 = 88,
+     ATOM_TYPE_CG321 = 89,
+     ATOM_TYPE_CG322 = 90,
+     ATOM_TYPE_CG323 = 91,
+     ATOM_TYPE_CG324 = 92,
+     ATOM_TYPE_CG331 = 93,
+     ATOM_TYPE_CG334 = 94,
+     ATOM_TYPE_CG3AM0 = 95,
+     ATOM_TYPE_CG3AM1 = 96,
+     ATOM_TYPE_CG3AM2 = 97,
+     ATOM_TYPE_CG3C31 = 98,
+     ATOM_TYPE_CG3C41 = 99,
+     ATOM_TYPE_CG3C51 = 100,
+     ATOM_TYPE_CG3C52 = 101,
+     ATOM_TYPE_CG3C53 = 102,
+     ATOM_TYPE_CG3C54 = 103,
+     ATOM_TYPE_CG3RC1 = 104,
+     ATOM_TYPE_CL = 105,
+     ATOM_TYPE_CLGA1 = 106,
+     ATOM_TYPE_CLGA3 = 107,
+     ATOM_TYPE_CLGR1 = 108,
+     ATOM_TYPE_CM = 109,
+     ATOM_TYPE_CN1 = 110,
+     ATOM_TYPE_CN1T = 111,
+     ATOM_TYPE_CN2 = 112,
+     ATOM_TYPE_CN3 = 113,
+     ATOM_TYPE_CN3T = 114,
+     ATOM_TYPE_CN4 = 115,
+     ATOM_TYPE_CN5 = 116,
+     ATOM_TYPE_CN5G = 117,
+     ATOM_TYPE_CN7 = 118,
+     ATOM_TYPE_CN7B = 119,
+     ATOM_TYPE_CN8 = 120,
+     ATOM_TYPE_CN8B = 121,
+     ATOM_TYPE_CN9 = 122,
+     ATOM_TYPE_CP1 = 123,
+     ATOM_TYPE_CP2 = 124,
+     ATOM_TYPE_CP3 = 125,
+     ATOM_TYPE_CPA = 126,
+     ATOM_TYPE_CPB = 127,
+     ATOM_TYPE_CPH1 = 128,
+     ATOM_TYPE_CPH2 = 129,
+     ATOM_TYPE_CPM = 130,
+     ATOM_TYPE_CPT = 131,
+     ATOM_TYPE_CRL1 = 132,
+     ATOM_TYPE_CRL2 = 133,
+     ATOM_TYPE_CS = 134,
+     ATOM_TYPE_CST = 135,
+     ATOM_TYPE_CT = 136,
+     ATOM_TYPE_CT1 = 137,
+     ATOM_TYPE_CT2 = 138,
+     ATOM_TYPE_CT2A = 139,
+     ATOM_TYPE_CT3 = 140,
+     ATOM_TYPE_CTL1 = 141,
+     ATOM_TYPE_CTL2 = 142,
+     ATOM_TYPE_CTL3 = 143,
+     ATOM_TYPE_CTL5 = 144,
+     ATOM_TYPE_CY = 145,
+     ATOM_TYPE_FE = 146,
+     ATOM_TYPE_FGA1 = 147,
+     ATOM_TYPE_FGA2 = 148,
+     ATOM_TYPE_FGA3 = 149,
+     ATOM_TYPE_FGP1 = 150,
+     ATOM_TYPE_FGR1 = 151,
+     ATOM_TYPE_H = 152,
+     ATOM_TYPE_HA = 153,
+     ATOM_TYPE_HA1 = 154,
+     ATOM_TYPE_HA2 = 155,
+     ATOM_TYPE_HA3 = 156,
+     ATOM_TYPE_HAL1 = 157,
+     ATOM_TYPE_HAL2 = 158,
+     ATOM_TYPE_HAL3 = 159,
+     ATOM_TYPE_HB1 = 160,
+     ATOM_TYPE_HB2 = 161,
+     ATOM_TYPE_HBL = 162,
+     ATOM_TYPE_HC = 163,
+     ATOM_TYPE_HCA1 = 164,
+     ATOM_TYPE_HCA1A = 165,
+     ATOM_TYPE_HCA1C2 = 166,
+     ATOM_TYPE_HCA2 = 167,
+     ATOM_TYPE_HCA25A = 168,
+     ATOM_TYPE_HCA2A = 169,
+     ATOM_TYPE_HCA2C2 = 170,
+     ATOM_TYPE_HCA3 = 171,
+     ATOM_TYPE_HCA3A = 172,
+     ATOM_TYPE_HCL = 173,
+     ATOM_TYPE_HCP1 = 174,
+     ATOM_TYPE_HCP1M = 175,
+     ATOM_TYPE_HCR1 = 176,
+     ATOM_TYPE_HE1 = 177,
+     ATOM_TYPE_HE2 = 178,
+     ATOM_TYPE_HEL1 = 179,
+     ATOM_TYPE_HEL2 = 180,
+     ATOM_TYPE_HGA1 = 181,
+     ATOM_TYPE_HGA2 = 182,
+     ATOM_TYPE_HGA3 = 183,
+     ATOM_TYPE_HGA4 = 184,
+     ATOM_TYPE_HGA5 = 185,
+     ATOM_TYPE_HGA6 = 186,
+     ATOM_TYPE_HGA7 = 187,
+     ATOM_TYPE_HGAAM0 = 188,
+     ATOM_TYPE_HGAAM1 = 189,
+     ATOM_TYPE_HGAAM2 = 190,
+     ATOM_TYPE_HGP1 = 191,
+     ATOM_TYPE_HGP2 = 192,
+     ATOM_TYPE_HGP3 = 193,
+     ATOM_TYPE_HGP4 = 194,
+     ATOM_TYPE_HGP5 = 195,
+     ATOM_TYPE_HGPAM1 = 196,
+     ATOM_TYPE_HGPAM2 = 197,
+     ATOM_TYPE_HGPAM3 = 198,
+     ATOM_TYPE_HGR51 = 199,
+     ATOM_TYPE_HGR52 = 200,
+     ATOM_TYPE_HGR53 = 201,
+     ATOM_TYPE_HGR61 = 202,
+     ATOM_TYPE_HGR62 = 203,
+     ATOM_TYPE_HGR63 = 204,
+     ATOM_TYPE_HGR71 = 205,
+     ATOM_TYPE_HL = 206,
+     ATOM_TYPE_HN1 = 207,
+     ATOM_TYPE_HN2 = 208,
+     ATOM_TYPE_HN3 = 209,
+     ATOM_TYPE_HN4 = 210,
+     ATOM_TYPE_HN5 = 211,
+     ATOM_TYPE_HN7 = 212,
+     ATOM_TYPE_HN8 = 213,
+     ATOM_TYPE_HN9 = 214,
+     ATOM_TYPE_HOL = 215,
+     ATOM_TYPE_HP = 216,
+     ATOM_TYPE_HR1 = 217,
+     ATOM_TYPE_HR2 = 218,
+     ATOM_TYPE_HR3 = 219,
+     ATOM_TYPE_HS = 220,
+     ATOM_TYPE_HT = 221,
+     ATOM_TYPE_HX = 222,
+     ATOM_TYPE_IGR1 = 223,
+     ATOM_TYPE_N = 224,
+     ATOM_TYPE_NC2 = 225,
+     ATOM_TYPE_NC2D1 = 226,
+     ATOM_TYPE_NG1T1 = 227,
+     ATOM_TYPE_NG2D1 = 228,
+     ATOM_TYPE_NG2O1 = 229,
+     ATOM_TYPE_NG2P1 = 230,
+     ATOM_TYPE_NG2R43 = 231,
+     ATOM_TYPE_NG2R50 = 232,
+     ATOM_TYPE_NG2R51 = 233,
+     ATOM_TYPE_NG2R52 = 234,
+     ATOM_TYPE_NG2R53 = 235,
+     ATOM_TYPE_NG2R60 = 236,
+     ATOM_TYPE_NG2R61 = 237,
+     ATOM_TYPE_NG2R62 = 238,
+     ATOM_TYPE_NG2RC0 = 239,
+     ATOM_TYPE_NG2S0 = 240,
+     ATOM_TYPE_NG2S1 = 241,
+     ATOM_TYPE_NG2S2 = 242,
+     ATOM_TYPE_NG2S3 = 243,
+     ATOM_TYPE_NG301 = 244,
+     ATOM_TYPE_NG311 = 245,
+     ATOM_TYPE_NG321 = 246,
+     ATOM_TYPE_NG331 = 247,
+     ATOM_TYPE_NG3C51 = 248,
+     ATOM_TYPE_NG3N1 = 249,
+     ATOM_TYPE_NG3P0 = 250,
+     ATOM_TYPE_NG3P1 = 251,
+     ATOM_TYPE_NG3P2 = 252,
+     ATOM_TYPE_NG3P3 = 253,
+     ATOM_TYPE_NH1 = 254,
+     ATOM_TYPE_NH2 = 255,
+     ATOM_TYPE_NH3 = 256,
+     ATOM_TYPE_NH3L = 257,
+     ATOM_TYPE_NN1 = 258,
+     ATOM_TYPE_NN2 = 259,
+     ATOM_TYPE_NN2B = 260,
+     ATOM_TYPE_NN2G = 261,
+     ATOM_TYPE_NN2U = 262,
+     ATOM_TYPE_NN3 = 263,
+     ATOM_TYPE_NN3A = 264,
+     ATOM_TYPE_NN3G = 265,
+     ATOM_TYPE_NN4 = 266,
+     ATOM_TYPE_NN6 = 267,
+     ATOM_TYPE_NP = 268,
+     ATOM_TYPE_NPH = 269,
+     ATOM_TYPE_NR1 = 270,
+     ATOM_TYPE_NR2 = 271,
+     ATOM_TYPE_NR3 = 272,
+     ATOM_TYPE_NTL = 273,
+     ATOM_TYPE_NY = 274,
+     ATOM_TYPE_O = 275,
+     ATOM_TYPE_O2L = 276,
+     ATOM_TYPE_OB = 277,
+     ATOM_TYPE_OBL = 278,
+     ATOM_TYPE_OC = 279,
+     ATOM_TYPE_OC2D1 = 280,
+     ATOM_TYPE_OC2D2 = 281,
+     ATOM_TYPE_OC2D3 = 282,
+     ATOM_TYPE_OC2D4 = 283,
+     ATOM_TYPE_OC2DP = 284,
+     ATOM_TYPE_OC301 = 285,
+     ATOM_TYPE_OC302 = 286,
+     ATOM_TYPE_OC303 = 287,
+     ATOM_TYPE_OC305A = 288,
+     ATOM_TYPE_OC30A = 289,
+     ATOM_TYPE_OC30P = 290,
+     ATOM_TYPE_OC311 = 291,
+     ATOM_TYPE_OC311M = 292,
+     ATOM_TYPE_OC312 = 293,
+     ATOM_TYPE_OC3C51 = 294,
+     ATOM_TYPE_OC3C5M = 295,
+     ATOM_TYPE_OC3C61 = 296,
+     ATOM_TYPE_OCL = 297,
+     ATOM_TYPE_OG2D1 = 298,
+     ATOM_TYPE_OG2D2 = 299,
+     ATOM_TYPE_OG2D3 = 300,
+     ATOM_TYPE_OG2D4 = 301,
+     ATOM_TYPE_OG2D5 = 302,
+     ATOM_TYPE_OG2N1 = 303,
+     ATOM_TYPE_OG2P1 = 304,
+     ATOM_TYPE_OG2R50 = 305,
+     ATOM_TYPE_OG301 = 306,
+     ATOM_TYPE_OG302 = 307,
+     ATOM_TYPE_OG303 = 308,
+     ATOM_TYPE_OG304 = 309,
+     ATOM_TYPE_OG311 = 310,
+     ATOM_TYPE_OG312 = 311,
+     ATOM_TYPE_OG3C31 = 312,
+     ATOM_TYPE_OG3C51 = 313,
+     ATOM_TYPE_OG3C61 = 314,
+     ATOM_TYPE_OG3R60 = 315,
+     ATOM_TYPE_OH1 = 316,
+     ATOM_TYPE_OHL = 317,
+     ATOM_TYPE_OM = 318,
+     ATOM_TYPE_ON1 = 319,
+     ATOM_TYPE_ON1C = 320,
+     ATOM_TYPE_ON2 = 321,
+     ATOM_TYPE_ON3 = 322,
+     ATOM_TYPE_ON4 = 323,
+     ATOM_TYPE_ON5 = 324,
+     ATOM_TYPE_ON6 = 325,
+     ATOM_TYPE_ON6B = 326,
+     ATOM_TYPE_OS = 327,
+     ATOM_TYPE_OSL = 328,
+     ATOM_TYPE_OSLP = 329,
+     ATOM_TYPE_OST = 330,
+     ATOM_TYPE_OT = 331,
+     ATOM_TYPE_OX = 332,
+     ATOM_TYPE_P = 333,
+     ATOM_TYPE_P2 = 334,
+     ATOM_TYPE_PC = 335,
+     ATOM_TYPE_PG0 = 336,
+     ATOM_TYPE_PG1 = 337,
+     ATOM_TYPE_PG2 = 338,
+     ATOM_TYPE_PL = 339,
+     ATOM_TYPE_S = 340,
+     ATOM_TYPE_SC = 341,
+     ATOM_TYPE_SG2D1 = 342,
+     ATOM_TYPE_SG2R50 = 343,
+     ATOM_TYPE_SG301 = 344,
+     ATOM_TYPE_SG302 = 345,
+     ATOM_TYPE_SG311 = 346,
+     ATOM_TYPE_SG3O1 = 347,
+     ATOM_TYPE_SG3O2 = 348,
+     ATOM_TYPE_SG3O3 = 349,
+     ATOM_TYPE_SL = 350,
+     ATOM_TYPE_SM = 351,
+     ATOM_TYPE_SS = 352,
+     ATOM_TYPE_X = 353,
+     N_ATOM_TYPES = 354
+};
+
+//! Atom type names, indexed by ID
+const char *const atom_type_names[N_ATOM_TYPES] = {
+     "ALG1",
+     "BRGA1",
+     "BRGA2",
+     "BRGA3",
+     "BRGR1",
+     "C",
+     "CA",
+     "CAI",
+     "CC",
+     "CC2O1",
+     "CC2O2",
+     "CC2O3",
+     "CC2O4",
+     "CC301",
+     "CC3051",
+     "CC3062",
+     "CC30A",
+     "CC311",
+     "CC311C",
+     "CC311D",
+     "CC312",
+     "CC312C",
+     "CC312D",
+     "CC3151",
+     "CC3152",
+     "CC3153",
+     "CC3161",
+     "CC3162",
+     "CC3163",
+     "CC31A",
+     "CC321",
+     "CC321C",
+     "CC321D",
+     "CC322",
+     "CC322C",
+     "CC3251",
+     "CC325A",
+     "CC325B",
+     "CC3261",
+     "CC3263",
+     "CC326A",
+     "CC32A",
+     "CC331",
+     "CC33A",
+     "CCL",
+     "CD",
+     "CE1",
+     "CE2",
+     "CEL1",
+     "CEL2",
+     "CG1N1",
+     "CG1T1",
+     "CG251O",
+     "CG252O",
+     "CG25C1",
+     "CG25C2",
+     "CG2D1",
+     "CG2D1O",
+     "CG2D2",
+     "CG2D2O",
+     "CG2DC1",
+     "CG2DC2",
+     "CG2DC3",
+     "CG2N1",
+     "CG2N2",
+     "CG2O1",
+     "CG2O2",
+     "CG2O3",
+     "CG2O4",
+     "CG2O5",
+     "CG2O6",
+     "CG2O7",
+     "CG2R51",
+     "CG2R52",
+     "CG2R53",
+     "CG2R61",
+     "CG2R62",
+     "CG2R63",
+     "CG2R64",
+     "CG2R66",
+     "CG2R67",
+     "CG2R71",
+     "CG2RC0",
+     "CG2RC7",
+     "CG301",
+     "CG302",
+     "CG311",
+     "CG312",
+     "CG314",
+     "CG321",
+     "CG322",
+     "CG323",
+     "CG324",
+     "CG331",
+     "CG334",
+     "CG3AM0",
+     "CG3AM1",
+     "CG3AM2",
+     "CG3C31",
+     "CG3C41",
+     "CG3C51",
+     "CG3C52",
+     "CG3C53",
+     "CG3C54",
+     "CG3RC1",
+     "CL",
+     "CLGA1",
+     "CLGA3",
+     "CLGR1",
+     "CM",
+     "CN1",
+     "CN1T",
+     "CN2",
+     "CN3",
+     "CN3T",
+     "CN4",
+     "CN5",
+     "CN5G",
+     "CN7",
+     "CN7B",
+     "CN8",
+     "CN8B",
+     "CN9",
+     "CP1",
+     "CP2",
+     "CP3",
+     "CPA",
+     "CPB",
+     "CPH1",
+     "CPH2",
+     "CPM",
+     "CPT",
+     "CRL1",
+     "CRL2",
+     "CS",
+     "CST",
+     "CT",
+     "CT1",
+     "CT2",
+     "CT2A",
+     "CT3",
+     "CTL1",
+     "CTL2",
+     "CTL3",
+     "CTL5",
+     "CY",
+     "FE",
+     "FGA1",
+     "FGA2",
+     "FGA3",
+     "FGP1",
+     "FGR1",
+     "H",
+     "HA",
+     "HA1",
+     "HA2",
+     "HA3",
+     "HAL1",
+     "HAL2",
+     "HAL3",
+     "HB1",
+     "HB2",
+     "HBL",
+     "HC",
+     "HCA1",
+     "HCA1A",
+     "HCA1C2",
+     "HCA2",
+     "HCA25A",
+     "HCA2A",
+     "HCA2C2",
+     "HCA3",
+     "HCA3A",
+     "HCL",
+     "HCP1",
+     "HCP1M",
+     "HCR1",
+     "HE1",
+     "HE2",
+     "HEL1",
+     "HEL2",
+     "HGA1",
+     "HGA2",
+     "HGA3",
+     "HGA4",
+     "HGA5",
+     "HGA6",
+     "HGA7",
+     "HGAAM0",
+     "HGAAM1",
+     "HGAAM2",
+     "HGP1",
+     "HGP2",
+     "HGP3",
+     "HGP4",
+     "HGP5",
+     "HGPAM1",
+     "HGPAM2",
+     "HGPAM3",
+     "HGR51",
+     "HGR52",
+     "HGR53",
+     "HGR61",
+     "HGR62",
+     "HGR63",
+     "HGR71",
+     "HL",
+     "HN1",
+     "HN2",
+     "HN3",
+     "HN4",
+     "HN5",
+     "HN7",
+     "HN8",
+     "HN9",
+     "HOL",
+     "HP",
+     "HR1",
+     "HR2",
+     "HR3",
+     "HS",
+     "HT",
+     "HX",
+     "IGR1",
+     "N",
+     "NC2",
+     "NC2D1",
+     "NG1T1",
+     "NG2D1",
+     "NG2O1",
+     "NG2P1",
+     "NG2R43",
+     "NG2R50",
+     "NG2R51",
+     "NG2R52",
+     "NG2R53",
+     "NG2R60",
+     "NG2R61",
+     "NG2R62",
+     "NG2RC0",
+     "NG2S0",
+     "NG2S1",
+     "NG2S2",
+     "NG2S3",
+     "NG301",
+     "NG311",
+     "NG321",
+     "NG331",
+     "NG3C51",
+     "NG3N1",
+     "NG3P0",
+     "NG3P1",
+     "NG3P2",
+     "NG3P3",
+     "NH1",
+     "NH2",
+     "NH3",
+     "NH3L",
+     "NN1",
+     "NN2",
+     "NN2B",
+     "NN2G",
+     "NN2U",
+     "NN3",
+     "NN3A",
+     "NN3G",
+     "NN4",
+     "NN6",
+     "NP",
+     "NPH",
+     "NR1",
+     "NR2",
+     "NR3",
+     "NTL",
+     "NY",
+     "O",
+     "O2L",
+     "OB",
+     "OBL",
+     "OC",
+     "OC2D1",
+     "OC2D2",
+     "OC2D3",
+     "OC2D4",
+     "OC2DP",
+     "OC301",
+     "OC302",
+     "OC303",
+     "OC305A",
+     "OC30A",
+     "OC30P",
+     "OC311",
+     "OC311M",
+     "OC312",
+     "OC3C51",
+     "OC3C5M",
+     "OC3C61",
+     "OCL",
+     "OG2D1",
+     "OG2D2",
+     "OG2D3",
+     "OG2D4",
+     "OG2D5",
+     "OG2N1",
+     "OG2P1",
+     "OG2R50",
+     "OG301",
+     "OG302",
+     "OG303",
+     "OG304",
+     "OG311",
+     "OG312",
+     "OG3C31",
+     "OG3C51",
+     "OG3C61",
+     "OG3R60",
+     "OH1",
+     "OHL",
+     "OM",
+     "ON1",
+     "ON1C",
+     "ON2",
+     "ON3",
+     "ON4",
+     "ON5",
+     "ON6",
+     "ON6B",
+     "OS",
+     "OSL",
+     "OSLP",
+     "OST",
+     "OT",
+     "OX",
+     "P",
+     "P2",
+     "PC",
+     "PG0",
+     "PG1",
+     "PG2",
+     "PL",
+     "S",
+     "SC",
+     "SG2D1",
+     "SG2R50",
+     "SG301",
+     "SG302",
+     "SG311",
+     "SG3O1",
+     "SG3O2",
+     "SG3O3",
+     "SL",
+     "SM",
+     "SS",
+     "X",
+};
+
+//! Order of atom type names
+inline bool atom_type_name_less(const char *name1, const char *name2) {
+     return std::strcmp(name1, name2) < 0;
+}
+
+//! ID of an atom type name
+//! \param name Atom type name
+//! \return ID of the atom type (N_ATOM_TYPES if the type does not occur in the parameter files)
+inline unsigned int get_atom_type_id(const std::string &name) {
+
+     const char *const *end = atom_type_names + N_ATOM_TYPES;
+     const char *const *it = std::lower_bound(atom_type_names, end, name.c_str(), atom_type_name_less);
+
+     if (it == end || name != *it)
+          return N_ATOM_TYPES;
+     return it - atom_type_names;
+}
+
+} // End namespace charmm_parameters
+
+#endif
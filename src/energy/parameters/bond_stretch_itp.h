@@ -1,966 +0,0 @@
-// bond_stretch_itp.h.h --- std::string'ed version of bond_stretch.itp
-// Copyright (C) 2014 Anders S. Christensen
-// Copyright (c) 1991-2000, University of Groningen, The Netherlands.
-// Copyright (c) 2001-2004, The GROMACS development team,
-//
-// This file is part of Phaistos
-//
-// Phaistos is free software: you can redistribute it and/or modify
-// it under the terms of the GNU General Public License as published by
-// the Free Software Foundation, either version 3 of the License, or
-// (at your option) any later version.
-//
-// Phaistos is distributed in the hope that it will be useful,
-// but WITHOUT ANY WARRANTY; without even the implied warranty of
-// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
-// GNU General Public License for more details.
-//
-// You should have received a copy of the GNU General Public License
-// along with Phaistos.  If not, see <http://www.gnu.org/licenses/>.
-//
-
-#ifndef TERM_CHARMM_BOND_STRETCH_ITP_H
-#define TERM_CHARMM_BOND_STRETCH_ITP_H
-
-namespace charmm_constants {
-
-const static std::string bond_stretch_itp = "     NH2      CT1     1   0.14550000    200832.00\n\
-      CA      CAI     1   0.13750000    255224.00\n\
-     CAI      CAI     1   0.13750000    255224.00\n\
-     CPT       CA     1   0.13600000    251040.00\n\
-     CPT      CAI     1   0.13600000    251040.00\n\
-     CPT      CPT     1   0.13850000    301248.00\n\
-      CY       CA     1   0.13650000    292880.00\n\
-      CY      CAI     1   0.13650000    292880.00\n\
-      CY      CPT     1   0.14300000    292880.00\n\
-      CY      CT3     1   0.14920000    313800.00\n\
-      CY      CT2     1   0.14920000    313800.00\n\
-      HP      CAI     1   0.10800000    284512.00\n\
-      HP       CY     1   0.10800000    292880.00\n\
-      NY       CA     1   0.13700000    225936.00\n\
-      NY      CPT     1   0.13700000    225936.00\n\
-      NY        H     1   0.09760000    449780.00\n\
-      CA       CA     1   0.13750000    255224.00\n\
-     CE1      CE1     1   0.13400000    368192.00\n\
-     CE1      CE2     1   0.13420000    418400.00\n\
-     CE1      CT2     1   0.15020000    305432.00\n\
-     CE1      CT3     1   0.15040000    320494.40\n\
-     CE2      CE2     1   0.13300000    426768.00\n\
-     CP1        C     1   0.14900000    209200.00\n\
-     CP1       CC     1   0.14900000    209200.00\n\
-     CP1       CD     1   0.14900000    167360.00\n\
-     CP2      CP1     1   0.15270000    186188.00\n\
-     CP2      CP2     1   0.15370000    186188.00\n\
-     CP3      CP2     1   0.15370000    186188.00\n\
-    CPH1     CPH1     1   0.13600000    343088.00\n\
-     CT1        C     1   0.14900000    209200.00\n\
-     CT1       CC     1   0.15220000    167360.00\n\
-     CT1       CD     1   0.15220000    167360.00\n\
-     CT1      CT1     1   0.15000000    186188.00\n\
-     CT2        C     1   0.14900000    209200.00\n\
-     CT2       CA     1   0.14900000    192464.00\n\
-     CT2       CC     1   0.15220000    167360.00\n\
-     CT2       CD     1   0.15220000    167360.00\n\
-     CT2     CPH1     1   0.15000000    192154.38\n\
-     CT2      CT1     1   0.15380000    186188.00\n\
-     CT2      CT2     1   0.15300000    186188.00\n\
-     CT3        C     1   0.14900000    209200.00\n\
-     CT3       CA     1   0.14900000    192464.00\n\
-     CT3       CC     1   0.15220000    167360.00\n\
-     CT3       CD     1   0.15220000    167360.00\n\
-     CT3     CPH1     1   0.15000000    192154.38\n\
-     CT3       CS     1   0.15310000    158992.00\n\
-     CT3      CT1     1   0.15380000    186188.00\n\
-     CT3      CT2     1   0.15280000    186188.00\n\
-     CT3      CT3     1   0.15300000    186188.00\n\
-       H       CD     1   0.11100000    276144.00\n\
-     HA1       CC     1   0.11000000    265374.38\n\
-     HA2      CP2     1   0.11110000    258571.20\n\
-     HA2      CP3     1   0.11110000    258571.20\n\
-     HA2       CS     1   0.11110000    251040.00\n\
-     HA3       CS     1   0.11110000    251040.00\n\
-     HA1      CT1     1   0.11110000    258571.20\n\
-     HA2      CT2     1   0.11110000    258571.20\n\
-     HA3      CT3     1   0.11110000    269449.60\n\
-     HE1      CE1     1   0.11000000    301666.40\n\
-     HE2      CE2     1   0.11000000    305432.00\n\
-     HB1      CP1     1   0.10800000    276144.00\n\
-     HB1      CT1     1   0.10800000    276144.00\n\
-     HB2      CT2     1   0.10800000    276144.00\n\
-      HP       CA     1   0.10800000    284512.00\n\
-     HR1     CPH1     1   0.10830000    313800.00\n\
-     HR1     CPH2     1   0.10900000    284512.00\n\
-     HR2     CPH2     1   0.10700000    278654.40\n\
-     HR3     CPH1     1   0.10830000    305432.00\n\
-       N        C     1   0.13000000    217568.00\n\
-       N      CP1     1   0.14340000    267776.00\n\
-       N      CP3     1   0.14550000    267776.00\n\
-     NC2        C     1   0.13650000    376560.00\n\
-     NC2      CT2     1   0.14900000    326352.00\n\
-     NC2      CT3     1   0.14900000    326352.00\n\
-     NC2       HC     1   0.10000000    380744.00\n\
-     NH1        C     1   0.13450000    309616.00\n\
-     NH1      CT1     1   0.14300000    267776.00\n\
-     NH1      CT2     1   0.14300000    267776.00\n\
-     NH1      CT3     1   0.14300000    267776.00\n\
-     NH1        H     1   0.09970000    368192.00\n\
-     NH1       HC     1   0.09800000    338904.00\n\
-     NH2       CC     1   0.13600000    359824.00\n\
-     NH2      CT2     1   0.14550000    200832.00\n\
-     NH2      CT3     1   0.14550000    200832.00\n\
-     NH2        H     1   0.10000000    401664.00\n\
-     NH2       HC     1   0.10000000    384928.00\n\
-     NH3      CT1     1   0.14800000    167360.00\n\
-     NH3      CT2     1   0.14800000    167360.00\n\
-     NH3      CT3     1   0.14800000    167360.00\n\
-     NH3       HC     1   0.10400000    337230.40\n\
-      NP      CP1     1   0.14850000    267776.00\n\
-      NP      CP3     1   0.15020000    267776.00\n\
-      NP       HC     1   0.10060000    384928.00\n\
-     NR1     CPH1     1   0.13800000    334720.00\n\
-     NR1     CPH2     1   0.13600000    334720.00\n\
-     NR1        H     1   0.10000000    389948.80\n\
-     NR2     CPH1     1   0.13800000    334720.00\n\
-     NR2     CPH2     1   0.13200000    334720.00\n\
-     NR3     CPH1     1   0.13700000    317984.00\n\
-     NR3     CPH2     1   0.13200000    317984.00\n\
-     NR3        H     1   0.10000000    379070.40\n\
-       O        C     1   0.12300000    518816.00\n\
-       O       CC     1   0.12300000    543920.00\n\
-      OB       CC     1   0.12200000    627600.00\n\
-      OB       CD     1   0.12200000    627600.00\n\
-      OC       CA     1   0.12600000    439320.00\n\
-      OC       CC     1   0.12600000    439320.00\n\
-      OC      CT2     1   0.13300000    376560.00\n\
-      OC      CT3     1   0.13300000    376560.00\n\
-     OH1       CA     1   0.14110000    279742.24\n\
-     OH1       CD     1   0.14000000    192464.00\n\
-     OH1      CT1     1   0.14200000    358150.40\n\
-     OH1      CT2     1   0.14200000    358150.40\n\
-     OH1      CT3     1   0.14200000    358150.40\n\
-     OH1        H     1   0.09600000    456056.00\n\
-      OS       CD     1   0.13340000    125520.00\n\
-      OS      CT3     1   0.14300000    284512.00\n\
-       S      CT2     1   0.18180000    165686.40\n\
-       S      CT3     1   0.18160000    200832.00\n\
-       S       HS     1   0.13250000    230120.00\n\
-      SM      CT2     1   0.18160000    179075.20\n\
-      SM      CT3     1   0.18160000    179075.20\n\
-      SM       SM     1   0.20290000    144766.40\n\
-      SS       CS     1   0.18360000    171544.00\n\
-     HR1       CD     1   0.11100000    276144.00\n\
-       O       CD     1   0.12050000    602496.00\n\
-    CT2A      CT1     1   0.15380000    186188.00\n\
-     CT2     CT2A     1   0.15300000    186188.00\n\
-    CT2A      HA2     1   0.11110000    258571.20\n\
-    CT2A     CPH1     1   0.15000000    192154.38\n\
-    CT2A       CC     1   0.15220000    167360.00\n\
-      HT       HT     1   0.15139000         0.00\n\
-      HT       OT     1   0.09572000    376560.00\n\
-      OX       HX     1   0.09700000    456056.00\n\
-   CG1N1   CG2R61     1   0.14350000    288696.00\n\
-   CG1N1    CG331     1   0.14700000    334720.00\n\
-   CG1N1    NG1T1     1   0.11800000    881150.40\n\
-   CG1T1    CG1T1     1   0.12200000    803328.00\n\
-   CG1T1    CG331     1   0.14650000    343088.00\n\
-  CG251O   CG25C1     1   0.13400000    368192.00\n\
-  CG251O   CG2DC3     1   0.13400000    476976.00\n\
-  CG251O   CG2R53     1   0.14800000    213384.00\n\
-  CG251O   NG2R53     1   0.14100000    167360.00\n\
-  CG251O    SG311     1   0.17700000    167360.00\n\
-  CG252O   CG25C2     1   0.13400000    368192.00\n\
-  CG252O   CG2DC3     1   0.13400000    476976.00\n\
-  CG252O   CG2R53     1   0.14800000    213384.00\n\
-  CG252O   NG2R53     1   0.14100000    167360.00\n\
-  CG252O    SG311     1   0.17700000    167360.00\n\
-  CG25C1   CG2DC3     1   0.13420000    418400.00\n\
-  CG25C1   CG2R53     1   0.14900000    206689.60\n\
-  CG25C1   CG2RC0     1   0.14800000    242672.00\n\
-  CG25C2   CG2DC3     1   0.13420000    418400.00\n\
-  CG25C2   CG2R53     1   0.14900000    206689.60\n\
-  CG25C2   CG2RC0     1   0.14800000    242672.00\n\
-   CG2D1    CG2D1     1   0.13400000    368192.00\n\
-   CG2D1   CG2D1O     1   0.13180000    368192.00\n\
-   CG2D1    CG2D2     1   0.13420000    418400.00\n\
-   CG2D1   CG2D2O     1   0.13180000    368192.00\n\
-   CG2D1    CG301     1   0.15020000    200832.00\n\
-   CG2D1    CG321     1   0.15020000    305432.00\n\
-   CG2D1    CG331     1   0.15040000    320494.40\n\
-   CG2D1    NG2D1     1   0.12760000    418400.00\n\
-   CG2D1    NG2P1     1   0.12830000    393296.00\n\
-   CG2D1     HGA4     1   0.11000000    301666.40\n\
-   CG2D1    HGR52     1   0.11000000    301666.40\n\
-  CG2D1O    CG2D2     1   0.13400000    502080.00\n\
-  CG2D1O   CG2DC1     1   0.13400000    368192.00\n\
-  CG2D1O    NG301     1   0.13550000    351456.00\n\
-  CG2D1O    NG311     1   0.13550000    351456.00\n\
-  CG2D1O    NG321     1   0.14000000    351456.00\n\
-  CG2D1O    OG301     1   0.13600000    322168.00\n\
-  CG2D1O   OG3R60     1   0.13470000    418400.00\n\
-  CG2D1O     HGA4     1   0.11000000    301666.40\n\
-   CG2D2    CG2D2     1   0.13300000    426768.00\n\
-   CG2D2   CG2D2O     1   0.13400000    502080.00\n\
-   CG2D2     HGA5     1   0.11000000    305432.00\n\
-  CG2D2O   CG2DC2     1   0.13400000    368192.00\n\
-  CG2D2O    NG301     1   0.13550000    351456.00\n\
-  CG2D2O    NG311     1   0.13550000    351456.00\n\
-  CG2D2O    NG321     1   0.14000000    351456.00\n\
-  CG2D2O    OG301     1   0.13600000    322168.00\n\
-  CG2D2O   OG3R60     1   0.13470000    418400.00\n\
-  CG2D2O     HGA4     1   0.11000000    301666.40\n\
-  CG2DC1   CG2DC1     1   0.13400000    368192.00\n\
-  CG2DC1   CG2DC2     1   0.14500000    251040.00\n\
-  CG2DC1   CG2DC3     1   0.13420000    418400.00\n\
-  CG2DC1    CG2O1     1   0.14890000    368192.00\n\
-  CG2DC1    CG2O3     1   0.14890000    368192.00\n\
-  CG2DC1    CG2O4     1   0.14798000    251040.00\n\
-  CG2DC1    CG2O5     1   0.14800000    251040.00\n\
-  CG2DC1   CG2R61     1   0.14500000    305432.00\n\
-  CG2DC1    CG301     1   0.15020000    305432.00\n\
-  CG2DC1    CG321     1   0.15020000    305432.00\n\
-  CG2DC1    CG331     1   0.15040000    320494.40\n\
-  CG2DC1    NG2D1     1   0.12760000    418400.00\n\
-  CG2DC1    NG2P1     1   0.12830000    393296.00\n\
-  CG2DC1     HGA4     1   0.11000000    301666.40\n\
-  CG2DC1    HGR52     1   0.11000000    301666.40\n\
-  CG2DC2   CG2DC2     1   0.13400000    368192.00\n\
-  CG2DC2   CG2DC3     1   0.13420000    418400.00\n\
-  CG2DC2    CG2O1     1   0.14890000    368192.00\n\
-  CG2DC2    CG2O3     1   0.14890000    368192.00\n\
-  CG2DC2    CG2O4     1   0.14798000    251040.00\n\
-  CG2DC2    CG2O5     1   0.14800000    251040.00\n\
-  CG2DC2   CG2R61     1   0.14500000    305432.00\n\
-  CG2DC2    CG301     1   0.15020000    305432.00\n\
-  CG2DC2    CG321     1   0.15020000    305432.00\n\
-  CG2DC2    CG331     1   0.15040000    320494.40\n\
-  CG2DC2    NG2D1     1   0.12760000    418400.00\n\
-  CG2DC2    NG2P1     1   0.12830000    393296.00\n\
-  CG2DC2     HGA4     1   0.11000000    301666.40\n\
-  CG2DC2    HGR52     1   0.11000000    301666.40\n\
-  CG2DC3     HGA5     1   0.11000000    305432.00\n\
-   CG2N1    NG2D1     1   0.13100000    418400.00\n\
-   CG2N1    NG2P1     1   0.13650000    387438.40\n\
-   CG2N1    NG311     1   0.14400000    418400.00\n\
-   CG2N1    NG321     1   0.14400000    376560.00\n\
-   CG2N2   CG2R61     1   0.14400000    251040.00\n\
-   CG2N2    CG331     1   0.15000000    234304.00\n\
-   CG2N2    NG2P1     1   0.13200000    397480.00\n\
-   CG2O1   CG2R61     1   0.14750000    251040.00\n\
-   CG2O1   CG2R62     1   0.14800000    252713.60\n\
-   CG2O1    CG311     1   0.14900000    209200.00\n\
-   CG2O1    CG314     1   0.14900000    209200.00\n\
-   CG2O1    CG321     1   0.14900000    209200.00\n\
-   CG2O1    CG324     1   0.14900000    209200.00\n\
-   CG2O1    CG331     1   0.14900000    209200.00\n\
-   CG2O1   CG3C51     1   0.14900000    209200.00\n\
-   CG2O1   CG3C53     1   0.14900000    209200.00\n\
-   CG2O1    NG2S0     1   0.13500000    359824.00\n\
-   CG2O1    NG2S1     1   0.13450000    309616.00\n\
-   CG2O1    NG2S2     1   0.13600000    359824.00\n\
-   CG2O1    OG2D1     1   0.12300000    518816.00\n\
-   CG2O1    HGR52     1   0.11000000    265374.38\n\
-   CG2O2   CG2R61     1   0.14800000    212547.20\n\
-   CG2O2    CG311     1   0.15220000    167360.00\n\
-   CG2O2    CG321     1   0.15220000    167360.00\n\
-   CG2O2    CG331     1   0.15220000    167360.00\n\
-   CG2O2    OG2D1     1   0.12200000    627600.00\n\
-   CG2O2    OG302     1   0.13340000    125520.00\n\
-   CG2O2    OG311     1   0.14000000    192464.00\n\
-   CG2O2    HGR52     1   0.10960000    291206.40\n\
-   CG2O3    CG2O5     1   0.15200000    209200.00\n\
-   CG2O3   CG2R61     1   0.15000000    167360.00\n\
-   CG2O3    CG301     1   0.15220000    167360.00\n\
-   CG2O3    CG311     1   0.15220000    167360.00\n\
-   CG2O3    CG314     1   0.15220000    167360.00\n\
-   CG2O3    CG321     1   0.15220000    167360.00\n\
-   CG2O3    CG324     1   0.15220000    167360.00\n\
-   CG2O3    CG331     1   0.15220000    167360.00\n\
-   CG2O3   CG3C51     1   0.14900000    209200.00\n\
-   CG2O3   CG3C53     1   0.14900000    209200.00\n\
-   CG2O3    OG2D2     1   0.12600000    439320.00\n\
-   CG2O3    HGR52     1   0.11422000    199158.40\n\
-   CG2O4   CG2R61     1   0.14798000    251040.00\n\
-   CG2O4    CG321     1   0.15000000    209200.00\n\
-   CG2O4    CG331     1   0.15000000    209200.00\n\
-   CG2O4    OG2D1     1   0.12150000    585760.00\n\
-   CG2O4    HGR52     1   0.11100000    276144.00\n\
-   CG2O5   CG2R61     1   0.14600000    212547.20\n\
-   CG2O5    CG311     1   0.15000000    276144.00\n\
-   CG2O5    CG321     1   0.15000000    276144.00\n\
-   CG2O5    CG331     1   0.15000000    276144.00\n\
-   CG2O5    OG2D3     1   0.12300000    585760.00\n\
-   CG2O6    NG2S1     1   0.13700000    426768.00\n\
-   CG2O6    NG2S2     1   0.13600000    359824.00\n\
-   CG2O6    OG2D1     1   0.12300000    543920.00\n\
-   CG2O6    OG2D2     1   0.12940000    263173.60\n\
-   CG2O6    OG302     1   0.13500000    292880.00\n\
-   CG2O6    SG2D1     1   0.16300000    251040.00\n\
-   CG2O6    SG311     1   0.17500000    158992.00\n\
-   CG2O7    OG2D5     1   0.11600000    825084.80\n\
-  CG2R51   CG2R51     1   0.13600000    343088.00\n\
-  CG2R51   CG2R52     1   0.14000000    301248.00\n\
-  CG2R51   CG2RC0     1   0.14300000    292880.00\n\
-  CG2R51   CG2RC7     1   0.14050000    284512.00\n\
-  CG2R51    CG321     1   0.15000000    192154.38\n\
-  CG2R51    CG331     1   0.15000000    192154.38\n\
-  CG2R51   CG3C52     1   0.15100000    292880.00\n\
-  CG2R51   CG3C54     1   0.14960000    271960.00\n\
-  CG2R51   NG2R50     1   0.13800000    334720.00\n\
-  CG2R51   NG2R51     1   0.13800000    334720.00\n\
-  CG2R51   NG2R52     1   0.13700000    317984.00\n\
-  CG2R51   NG2RC0     1   0.13710000    334720.00\n\
-  CG2R51   NG3C51     1   0.14120000    301248.00\n\
-  CG2R51    NG3P2     1   0.14800000    276144.00\n\
-  CG2R51   OG2R50     1   0.13710000    376560.00\n\
-  CG2R51   OG3C51     1   0.13700000    301248.00\n\
-  CG2R51   SG2R50     1   0.17300000    251040.00\n\
-  CG2R51    HGR51     1   0.10800000    292880.00\n\
-  CG2R51    HGR52     1   0.10830000    313800.00\n\
-  CG2R52   CG2RC0     1   0.14200000    301248.00\n\
-  CG2R52   CG3C52     1   0.15050000    292880.00\n\
-  CG2R52   NG2R50     1   0.13150000    334720.00\n\
-  CG2R52   NG2R52     1   0.13000000    410032.00\n\
-  CG2R52    HGR52     1   0.10830000    313800.00\n\
-  CG2R53   CG3C41     1   0.15600000    167360.00\n\
-  CG2R53   CG3C52     1   0.15300000    251040.00\n\
-  CG2R53   NG2R43     1   0.13800000    309616.00\n\
-  CG2R53   NG2R50     1   0.13200000    334720.00\n\
-  CG2R53   NG2R51     1   0.13740000    267776.00\n\
-  CG2R53   NG2R52     1   0.13200000    317984.00\n\
-  CG2R53   NG2R53     1   0.13800000    384928.00\n\
-  CG2R53   NG3C51     1   0.14000000    317984.00\n\
-  CG2R53    OG2D1     1   0.12350000    476976.00\n\
-  CG2R53   OG2R50     1   0.13710000    376560.00\n\
-  CG2R53    SG2D1     1   0.16300000    334720.00\n\
-  CG2R53   SG2R50     1   0.17300000    251040.00\n\
-  CG2R53    SG311     1   0.17700000    142256.00\n\
-  CG2R53    HGR52     1   0.10900000    284512.00\n\
-  CG2R53    HGR53     1   0.10700000    278654.40\n\
-  CG2R61   CG2R61     1   0.13750000    255224.00\n\
-  CG2R61   CG2R64     1   0.13550000    209200.00\n\
-  CG2R61   CG2R66     1   0.13700000    255224.00\n\
-  CG2R61   CG2R67     1   0.13750000    255224.00\n\
-  CG2R61   CG2RC0     1   0.13600000    251040.00\n\
-  CG2R61    CG311     1   0.14900000    192464.00\n\
-  CG2R61    CG312     1   0.14500000    165686.40\n\
-  CG2R61    CG321     1   0.14900000    192464.00\n\
-  CG2R61    CG324     1   0.14900000    192464.00\n\
-  CG2R61    CG331     1   0.14900000    192464.00\n\
-  CG2R61    NG2O1     1   0.14020000    192464.00\n\
-  CG2R61   NG2R60     1   0.13050000    376560.00\n\
-  CG2R61   NG2R62     1   0.13050000    376560.00\n\
-  CG2R61   NG2RC0     1   0.13790000    309616.00\n\
-  CG2R61    NG2S1     1   0.14140000    255224.00\n\
-  CG2R61    NG2S3     1   0.13900000    334720.00\n\
-  CG2R61    NG311     1   0.14000000    276144.00\n\
-  CG2R61    NG3N1     1   0.14100000    569024.00\n\
-  CG2R61    OG301     1   0.13820000    192464.00\n\
-  CG2R61    OG303     1   0.13800000    284512.00\n\
-  CG2R61    OG311     1   0.14110000    279742.24\n\
-  CG2R61    OG312     1   0.12600000    439320.00\n\
-  CG2R61   OG3R60     1   0.13500000    234304.00\n\
-  CG2R61    SG311     1   0.17500000    234304.00\n\
-  CG2R61    SG3O1     1   0.17800000    192464.00\n\
-  CG2R61    SG3O2     1   0.17300000    158992.00\n\
-  CG2R61    CLGR1     1   0.17400000    292880.00\n\
-  CG2R61    BRGR1     1   0.19030000    192464.00\n\
-  CG2R61     IGR1     1   0.21150000    158992.00\n\
-  CG2R61    HGR61     1   0.10800000    284512.00\n\
-  CG2R61    HGR62     1   0.10800000    284512.00\n\
-  CG2R62   CG2R62     1   0.13500000    351456.00\n\
-  CG2R62   CG2R63     1   0.14030000    252713.60\n\
-  CG2R62   CG2R64     1   0.14060000    267776.00\n\
-  CG2R62    CG331     1   0.14780000    192464.00\n\
-  CG2R62   NG2R61     1   0.13430000    252713.60\n\
-  CG2R62    HGR62     1   0.10900000    292880.00\n\
-  CG2R62    HGR63     1   0.10900000    292880.00\n\
-  CG2R63   CG2RC0     1   0.13600000    252713.60\n\
-  CG2R63   NG2R61     1   0.13830000    284512.00\n\
-  CG2R63   NG2R62     1   0.13350000    292880.00\n\
-  CG2R63    OG2D4     1   0.12340000    552288.00\n\
-  CG2R64   CG2RC0     1   0.13580000    301248.00\n\
-  CG2R64   NG2R60     1   0.13050000    376560.00\n\
-  CG2R64   NG2R61     1   0.13920000    334720.00\n\
-  CG2R64   NG2R62     1   0.13420000    334720.00\n\
-  CG2R64    NG2S1     1   0.14140000    255224.00\n\
-  CG2R64    NG2S3     1   0.13660000    301248.00\n\
-  CG2R64    HGR62     1   0.10900000    317984.00\n\
-  CG2R66     FGR1     1   0.13580000    334720.00\n\
-  CG2R67   CG2R67     1   0.14900000    251040.00\n\
-  CG2R67   CG2RC0     1   0.14200000    251040.00\n\
-  CG2R71   CG2R71     1   0.13850000    301248.00\n\
-  CG2R71   CG2RC7     1   0.13800000    334720.00\n\
-  CG2R71    HGR71     1   0.10900000    297064.00\n\
-  CG2RC0   CG2RC0     1   0.13850000    301248.00\n\
-  CG2RC0   CG3C52     1   0.15200000    255224.00\n\
-  CG2RC0   NG2R50     1   0.13650000    259408.00\n\
-  CG2RC0   NG2R51     1   0.13750000    251040.00\n\
-  CG2RC0   NG2R62     1   0.13150000    292880.00\n\
-  CG2RC0   NG2RC0     1   0.14170000    205016.00\n\
-  CG2RC0   NG3C51     1   0.14000000    276144.00\n\
-  CG2RC0   OG2R50     1   0.13700000    376560.00\n\
-  CG2RC0   OG3C51     1   0.13890000    276144.00\n\
-  CG2RC0   SG2R50     1   0.17600000    251040.00\n\
-  CG2RC7   CG2RC7     1   0.15200000    192464.00\n\
-   CG301    CG311     1   0.15000000    186188.00\n\
-   CG301    CG321     1   0.15380000    186188.00\n\
-   CG301    CG331     1   0.15380000    186188.00\n\
-   CG301    OG301     1   0.14150000    301248.00\n\
-   CG301    OG302     1   0.14300000    284512.00\n\
-   CG301    OG311     1   0.14200000    358150.40\n\
-   CG301    CLGA3     1   0.17700000    158992.00\n\
-   CG301    BRGA3     1   0.19540000    100416.00\n\
-   CG302    CG321     1   0.15200000    209200.00\n\
-   CG302    CG331     1   0.15200000    209200.00\n\
-   CG302     FGA3     1   0.13400000    221752.00\n\
-   CG311    CG311     1   0.15000000    186188.00\n\
-   CG311    CG314     1   0.15000000    186188.00\n\
-   CG311    CG321     1   0.15380000    186188.00\n\
-   CG311    CG324     1   0.15300000    186188.00\n\
-   CG311    CG331     1   0.15380000    186188.00\n\
-   CG311   CG3C51     1   0.15280000    186188.00\n\
-   CG311   CG3RC1     1   0.15240000    186188.00\n\
-   CG311   NG2R53     1   0.14300000    267776.00\n\
-   CG311    NG2S1     1   0.14300000    267776.00\n\
-   CG311    OG301     1   0.14150000    301248.00\n\
-   CG311    OG302     1   0.14300000    284512.00\n\
-   CG311    OG303     1   0.14300000    284512.00\n\
-   CG311    OG311     1   0.14200000    358150.40\n\
-   CG311    OG312     1   0.13130000    299574.40\n\
-   CG311    CLGA1     1   0.17768000    158992.00\n\
-   CG311    BRGA2     1   0.19560000    117152.00\n\
-   CG311     HGA1     1   0.11110000    258571.20\n\
-   CG312    CG331     1   0.15200000    165686.40\n\
-   CG312      PG1     1   0.18800000    225936.00\n\
-   CG312      PG2     1   0.18800000    225936.00\n\
-   CG312     FGA2     1   0.13530000    292043.20\n\
-   CG312     HGA7     1   0.10828000    289532.80\n\
-   CG314    CG321     1   0.15380000    186188.00\n\
-   CG314    CG331     1   0.15380000    186188.00\n\
-   CG314    NG3P2     1   0.14900000    167360.00\n\
-   CG314    NG3P3     1   0.14800000    167360.00\n\
-   CG314     HGA1     1   0.11110000    258571.20\n\
-   CG321    CG321     1   0.15300000    186188.00\n\
-   CG321    CG324     1   0.15300000    186188.00\n\
-   CG321    CG331     1   0.15280000    186188.00\n\
-   CG321   CG3C31     1   0.15000000    230120.00\n\
-   CG321   CG3C51     1   0.15280000    186188.00\n\
-   CG321   CG3RC1     1   0.15240000    186188.00\n\
-   CG321    NG2S1     1   0.14300000    267776.00\n\
-   CG321    NG311     1   0.14740000    220078.40\n\
-   CG321    NG321     1   0.14740000    220078.40\n\
-   CG321    OG301     1   0.14150000    301248.00\n\
-   CG321    OG302     1   0.14400000    267776.00\n\
-   CG321    OG303     1   0.14400000    267776.00\n\
-   CG321    OG311     1   0.14200000    358150.40\n\
-   CG321    OG312     1   0.13300000    376560.00\n\
-   CG321   OG3C61     1   0.14150000    301248.00\n\
-   CG321   OG3R60     1   0.14000000    234304.00\n\
-   CG321      PG1     1   0.18900000    225936.00\n\
-   CG321      PG2     1   0.18900000    225936.00\n\
-   CG321    SG301     1   0.18160000    179075.20\n\
-   CG321    SG311     1   0.18180000    165686.40\n\
-   CG321    SG3O1     1   0.18070000    154808.00\n\
-   CG321    SG3O2     1   0.17900000    154808.00\n\
-   CG321    SG3O3     1   0.18100000    154808.00\n\
-   CG321    CLGA1     1   0.17880000    184096.00\n\
-   CG321    BRGA1     1   0.19660000    133888.00\n\
-   CG321     HGA2     1   0.11110000    258571.20\n\
-   CG322    CG331     1   0.15200000    142256.00\n\
-   CG322     FGA1     1   0.13740000    351456.00\n\
-   CG322     HGA6     1   0.10828000    286185.60\n\
-   CG323    CG331     1   0.15310000    158992.00\n\
-   CG323    SG302     1   0.18360000    171544.00\n\
-   CG323     HGA2     1   0.11110000    251040.00\n\
-   CG323     HGA3     1   0.11110000    251040.00\n\
-   CG324    CG331     1   0.15280000    186188.00\n\
-   CG324   CG3C31     1   0.15280000    186188.00\n\
-   CG324    NG2O1     1   0.14900000    189116.80\n\
-   CG324    NG2P1     1   0.14530000    251040.00\n\
-   CG324    NG3P0     1   0.15100000    179912.00\n\
-   CG324    NG3P1     1   0.14800000    167360.00\n\
-   CG324    NG3P2     1   0.14900000    167360.00\n\
-   CG324    NG3P3     1   0.14900000    167360.00\n\
-   CG324     HGA2     1   0.11000000    238069.60\n\
-   CG324     HGP5     1   0.10800000    251040.00\n\
-   CG331    CG331     1   0.15300000    186188.00\n\
-   CG331   CG3C51     1   0.15280000    186188.00\n\
-   CG331   CG3RC1     1   0.15380000    186188.00\n\
-   CG331    NG2D1     1   0.14400000    259408.00\n\
-   CG331   NG2R51     1   0.14580000    334720.00\n\
-   CG331   NG2R61     1   0.14560000    334720.00\n\
-   CG331    NG2S0     1   0.14340000    263592.00\n\
-   CG331    NG2S1     1   0.14300000    267776.00\n\
-   CG331    NG2S3     1   0.14900000    218404.80\n\
-   CG331    NG311     1   0.14630000    213384.00\n\
-   CG331    OG301     1   0.14150000    301248.00\n\
-   CG331    OG302     1   0.14300000    284512.00\n\
-   CG331    OG303     1   0.14300000    284512.00\n\
-   CG331    OG311     1   0.14200000    358150.40\n\
-   CG331    OG312     1   0.13300000    376560.00\n\
-   CG331    SG301     1   0.18160000    179075.20\n\
-   CG331    SG311     1   0.18160000    200832.00\n\
-   CG331    SG3O1     1   0.18370000    163176.00\n\
-   CG331    SG3O2     1   0.17900000    175728.00\n\
-   CG331    SG3O3     1   0.18000000    200832.00\n\
-   CG331     HGA3     1   0.11110000    269449.60\n\
-   CG334    NG2O1     1   0.14800000    209200.00\n\
-   CG334    NG2P1     1   0.14530000    251040.00\n\
-   CG334    NG3P0     1   0.15100000    179912.00\n\
-   CG334    NG3P1     1   0.14800000    167360.00\n\
-   CG334    NG3P3     1   0.14800000    167360.00\n\
-   CG334     HGA3     1   0.11110000    269449.60\n\
-   CG334     HGP5     1   0.10800000    251040.00\n\
-  CG3AM0    NG301     1   0.14540000    196648.00\n\
-  CG3AM0   HGAAM0     1   0.11110000    260244.80\n\
-  CG3AM1    NG311     1   0.14630000    213384.00\n\
-  CG3AM1   HGAAM1     1   0.10980000    262587.84\n\
-  CG3AM2    NG321     1   0.14740000    220078.40\n\
-  CG3AM2   HGAAM2     1   0.10856000    263173.60\n\
-  CG3C31   CG3C31     1   0.15010000    200832.00\n\
-  CG3C31   CG3RC1     1   0.15240000    186188.00\n\
-  CG3C31   OG3C31     1   0.14500000    184096.00\n\
-  CG3C31     HGA1     1   0.10830000    284512.00\n\
-  CG3C31     HGA2     1   0.10830000    284512.00\n\
-  CG3C41   CG3C41     1   0.15400000    225936.00\n\
-  CG3C41   NG2R43     1   0.14500000    205016.00\n\
-  CG3C41     HGA2     1   0.10930000    291206.40\n\
-  CG3C51   CG3C51     1   0.15180000    163176.00\n\
-  CG3C51   CG3C52     1   0.15180000    163176.00\n\
-  CG3C51   CG3C53     1   0.15000000    186188.00\n\
-  CG3C51   CG3RC1     1   0.15240000    186188.00\n\
-  CG3C51   NG2R51     1   0.14580000    184096.00\n\
-  CG3C51   NG2R61     1   0.14560000    184096.00\n\
-  CG3C51    NG2S0     1   0.14340000    267776.00\n\
-  CG3C51    NG2S3     1   0.14620000    301248.00\n\
-  CG3C51    NG301     1   0.14560000    184096.00\n\
-  CG3C51    NG321     1   0.14740000    220078.40\n\
-  CG3C51    OG301     1   0.14110000    279742.24\n\
-  CG3C51    OG303     1   0.14300000    284512.00\n\
-  CG3C51    OG311     1   0.14200000    358150.40\n\
-  CG3C51   OG3C51     1   0.14250000    292880.00\n\
-  CG3C51     FGA1     1   0.13740000    351456.00\n\
-  CG3C51     HGA1     1   0.11000000    256897.60\n\
-  CG3C51     HGA6     1   0.10828000    286185.60\n\
-  CG3C52   CG3C52     1   0.15300000    163176.00\n\
-  CG3C52   CG3C53     1   0.15270000    186188.00\n\
-  CG3C52   CG3C54     1   0.15370000    186188.00\n\
-  CG3C52   CG3RC1     1   0.15240000    186188.00\n\
-  CG3C52   NG2R50     1   0.14700000    334720.00\n\
-  CG3C52   NG2R53     1   0.14500000    309616.00\n\
-  CG3C52    NG2S0     1   0.14550000    267776.00\n\
-  CG3C52   NG3C51     1   0.14780000    334720.00\n\
-  CG3C52   OG3C51     1   0.14250000    292880.00\n\
-  CG3C52     HGA2     1   0.11000000    256897.60\n\
-  CG3C53   NG2R61     1   0.14560000    184096.00\n\
-  CG3C53    NG3P2     1   0.14850000    267776.00\n\
-  CG3C53   OG3C51     1   0.14460000    200832.00\n\
-  CG3C53     HGA1     1   0.10800000    276144.00\n\
-  CG3C54   CG3C54     1   0.15600000    175728.00\n\
-  CG3C54   NG2R52     1   0.14600000    267776.00\n\
-  CG3C54   NG3C51     1   0.14300000    196648.00\n\
-  CG3C54    NG3P2     1   0.15150000    267776.00\n\
-  CG3C54     HGA2     1   0.11110000    258571.20\n\
-  CG3RC1   CG3RC1     1   0.15230000    186188.00\n\
-  CG3RC1   NG2R51     1   0.14580000    184096.00\n\
-  CG3RC1   NG2R61     1   0.14560000    184096.00\n\
-  CG3RC1   OG3C51     1   0.14200000    217568.00\n\
-  CG3RC1     HGA1     1   0.11110000    258571.20\n\
-   NG2D1    NG2S1     1   0.13600000    460240.00\n\
-   NG2D1     HGP1     1   0.10000000    380744.00\n\
-   NG2O1    OG2N1     1   0.12250000    485344.00\n\
-   NG2P1     HGP2     1   0.10000000    380744.00\n\
-  NG2R43     HGP1     1   0.10150000    337230.40\n\
-  NG2R50   NG2R50     1   0.12900000    284512.00\n\
-  NG2R50   NG2R51     1   0.13550000    301248.00\n\
-  NG2R50   NG3C51     1   0.14110000    351456.00\n\
-  NG2R50   OG2R50     1   0.13950000    234304.00\n\
-  NG2R50   SG2R50     1   0.17000000    225936.00\n\
-  NG2R51     HGP1     1   0.10100000    396643.20\n\
-  NG2R52     HGP2     1   0.10000000    379070.40\n\
-  NG2R53     HGP1     1   0.10150000    393296.00\n\
-  NG2R61     HGP1     1   0.10100000    396643.20\n\
-  NG2R61     HGP2     1   0.10100000    396643.20\n\
-  NG2R62   NG2R62     1   0.13200000    351456.00\n\
-   NG2S1     HGP1     1   0.09970000    368192.00\n\
-   NG2S2     HGP1     1   0.10000000    401664.00\n\
-   NG2S3      PG1     1   0.17920000    150624.00\n\
-   NG2S3     HGP1     1   0.10250000    361916.00\n\
-   NG2S3     HGP4     1   0.10000000    408358.40\n\
-   NG311    SG3O2     1   0.16500000    196648.00\n\
-   NG311     HGP1     1   0.10210000    369865.60\n\
-   NG311   HGPAM1     1   0.10190000    374719.04\n\
-   NG321    SG3O2     1   0.16800000    200832.00\n\
-   NG321     HGP1     1   0.10200000    379907.20\n\
-   NG321   HGPAM2     1   0.10140000    379154.08\n\
-   NG331   HGPAM3     1   0.10140000    381162.40\n\
-  NG3C51    NG3P2     1   0.14400000    225936.00\n\
-  NG3C51     HGP1     1   0.10180000    376560.00\n\
-   NG3N1    NG3N1     1   0.14000000    297064.00\n\
-   NG3N1     HGP1     1   0.10100000    365681.60\n\
-   NG3P0    OG311     1   0.14000000    205016.00\n\
-   NG3P0    OG312     1   0.14000000    259408.00\n\
-   NG3P1     HGP2     1   0.10400000    337230.40\n\
-   NG3P2     HGP2     1   0.10060000    384928.00\n\
-   NG3P3     HGP2     1   0.10400000    337230.40\n\
-   OG2P1      PG0     1   0.14800000    485344.00\n\
-   OG2P1      PG1     1   0.15100000    418400.00\n\
-   OG2P1      PG2     1   0.15200000    334720.00\n\
-   OG2P1    SG3O1     1   0.14480000    451872.00\n\
-   OG2P1    SG3O2     1   0.14400000    527184.00\n\
-   OG2P1    SG3O3     1   0.15300000    451872.00\n\
-   OG303      PG0     1   0.16100000    192464.00\n\
-   OG303      PG1     1   0.16500000    158992.00\n\
-   OG303      PG2     1   0.16550000    125520.00\n\
-   OG303    SG3O1     1   0.15750000    209200.00\n\
-   OG303    SG3O2     1   0.16000000    196648.00\n\
-   OG304      PG1     1   0.16750000    276144.00\n\
-   OG304      PG2     1   0.17150000    251040.00\n\
-   OG311      PG0     1   0.15800000    198321.60\n\
-   OG311      PG1     1   0.16100000    198321.60\n\
-   OG311     HGP1     1   0.09600000    456056.00\n\
-   SG301    SG301     1   0.20290000    144766.40\n\
-   SG311     HGP3     1   0.13250000    230120.00\n\
-    FGP1     ALG1     1   0.17260000    171544.00\n\
-   OC2D3    CC2O3     1   0.12150000    585760.00\n\
-   CC2O3    CC331     1   0.15000000    276144.00\n\
-   CC2O3    CC312     1   0.15000000    276144.00\n\
-   CC2O3    CC322     1   0.15000000    276144.00\n\
-   OC2D4    CC2O4     1   0.12150000    585760.00\n\
-    HCR1    CC2O4     1   0.11100000    276144.00\n\
-   CC2O4    CC331     1   0.15000000    209200.00\n\
-   CC2O4    CC312     1   0.15000000    209200.00\n\
-   CC311    CC311     1   0.15000000    186188.00\n\
-   CC312    CC312     1   0.14850000    186188.00\n\
-  CC3161   CC3163     1   0.15000000    186188.00\n\
-  CC3161   CC3263     1   0.15000000    186188.00\n\
-   CC312    CC322     1   0.14850000    186188.00\n\
-   CC301    CC331     1   0.15380000    186188.00\n\
-   CC311    CC321     1   0.15380000    186188.00\n\
-   CC311    CC331     1   0.15380000    186188.00\n\
-   CC331   CC3163     1   0.15380000    186188.00\n\
-  CC3161   CC3161     1   0.14800000    186188.00\n\
-  CC3261   CC3161     1   0.14800000    186188.00\n\
-  CC3161   CC3162     1   0.14800000    186188.00\n\
-  CC3261   CC3062     1   0.15150000    186188.00\n\
-   CC321   CC3163     1   0.14900000    186188.00\n\
-   CC312   CC3163     1   0.14900000    186188.00\n\
-   CC301    CC2O2     1   0.15220000    167360.00\n\
-   CC311    CC2O2     1   0.15220000    167360.00\n\
-  CC3163    CC2O2     1   0.14800000    167360.00\n\
-  CC3062    CC2O2     1   0.14800000    167360.00\n\
-   CC2O1    CC331     1   0.15200000    209200.00\n\
-   CC321    CC331     1   0.15280000    186188.00\n\
-   CC321    CC321     1   0.15300000    186188.00\n\
-  CC321C   CC321C     1   0.15300000    186188.00\n\
-  CC321C   CC321D     1   0.15300000    186188.00\n\
-  CC321C   CC311C     1   0.15380000    186188.00\n\
-   CC321   CC311C     1   0.14900000    186188.00\n\
-  CC321C   CC311D     1   0.15380000    186188.00\n\
-  CC321D   CC311C     1   0.15380000    186188.00\n\
-   CC321    CC2O2     1   0.15220000    167360.00\n\
-  CC3161    OC311     1   0.14100000    343088.00\n\
-  CC3162    OC311     1   0.14000000    358150.40\n\
-  CC3062    OC311     1   0.14000000    358150.40\n\
-   CC301    OC311     1   0.14200000    358150.40\n\
-   CC311    OC311     1   0.14200000    358150.40\n\
-   CC312    OC311     1   0.14200000    334720.00\n\
-   CC311   OC311M     1   0.14200000    358150.40\n\
-   CC321    OC311     1   0.14200000    358150.40\n\
-   CC321   OC311M     1   0.14200000    358150.40\n\
-   CC331   OC311M     1   0.14200000    358150.40\n\
-   CC322    OC311     1   0.14200000    334720.00\n\
-   CC2O1    OC2D1     1   0.12300000    518816.00\n\
-   CC2O2    OC2D2     1   0.12600000    439320.00\n\
-   CC301    OC301     1   0.14150000    301248.00\n\
-   CC311    OC301     1   0.14150000    301248.00\n\
-   CC321    OC301     1   0.14150000    301248.00\n\
-   CC331    OC301     1   0.14150000    301248.00\n\
-  CC311D    OC301     1   0.13950000    301248.00\n\
-  CC3162    OC301     1   0.13950000    301248.00\n\
-  CC3062    OC301     1   0.13950000    301248.00\n\
-  CC311D    OC302     1   0.14150000    301248.00\n\
-  CC3162    OC302     1   0.14150000    301248.00\n\
-  CC311C    OC301     1   0.14350000    301248.00\n\
-  CC3161    OC301     1   0.14150000    301248.00\n\
-  CC321D   OC3C61     1   0.14150000    301248.00\n\
-  CC311D   OC3C61     1   0.14150000    301248.00\n\
-  CC3162   OC3C61     1   0.14250000    301248.00\n\
-  CC3062   OC3C61     1   0.14250000    301248.00\n\
-  CC321C   OC3C61     1   0.14150000    301248.00\n\
-  CC311C   OC3C61     1   0.14150000    301248.00\n\
-  CC3163   OC3C61     1   0.14250000    301248.00\n\
-  CC3263   OC3C61     1   0.14250000    301248.00\n\
-   NC2D1    CC311     1   0.14300000    267776.00\n\
-   NC2D1   CC3161     1   0.14300000    267776.00\n\
-   NC2D1    CC331     1   0.14300000    267776.00\n\
-   NC2D1    CC2O1     1   0.13450000    309616.00\n\
-   CC311     HCA1     1   0.11110000    258571.20\n\
-   CC312     HCA1     1   0.11110000    258571.20\n\
-  CC3161     HCA1     1   0.11110000    258571.20\n\
-  CC3162     HCA1     1   0.11110000    258571.20\n\
-  CC3163     HCA1     1   0.11110000    258571.20\n\
-  CC311C     HCA1     1   0.11110000    258571.20\n\
-  CC311D     HCA1     1   0.11110000    258571.20\n\
-   CC321     HCA2     1   0.11110000    258571.20\n\
-   CC322     HCA2     1   0.11110000    258571.20\n\
-  CC3263     HCA2     1   0.11110000    258571.20\n\
-   CC331     HCA3     1   0.11110000    269449.60\n\
-  CC321C     HCA2     1   0.11110000    258571.20\n\
-  CC321D     HCA2     1   0.11110000    258571.20\n\
-  CC3261     HCA2     1   0.11110000    258571.20\n\
-   OC311     HCP1     1   0.09600000    456056.00\n\
-  OC311M     HCP1     1   0.09600000    456056.00\n\
-  OC311M    HCP1M     1   0.09600000    456056.00\n\
-   NC2D1     HCP1     1   0.09970000    368192.00\n\
-  CC322C   OC3C5M     1   0.14250000    292880.00\n\
-  CC322C   CC322C     1   0.15180000    163176.00\n\
-  CC322C   HCA2C2     1   0.11000000    256897.60\n\
-  CC312C    CC331     1   0.15280000    186188.00\n\
-  CC312C   OC3C5M     1   0.14250000    292880.00\n\
-  CC312C   CC322C     1   0.15180000    163176.00\n\
-  CC312C   HCA1C2     1   0.11000000    256897.60\n\
-  CC312C    OC301     1   0.13950000    301248.00\n\
-  OC3C51   CC3152     1   0.14250000    292880.00\n\
-  OC3C51   CC3051     1   0.14250000    292880.00\n\
-  OC3C51   CC3153     1   0.14250000    292880.00\n\
-   OC311   CC3152     1   0.13950000    358150.40\n\
-   OC311   CC3051     1   0.13950000    358150.40\n\
-   OC311   CC3151     1   0.13950000    343088.00\n\
-  CC3152     HCA1     1   0.11110000    258571.20\n\
-  CC3251     HCA2     1   0.11000000    256897.60\n\
-  CC3151     HCA1     1   0.11110000    258571.20\n\
-  CC3153     HCA1     1   0.11110000    258571.20\n\
-  CC3152   CC3251     1   0.15080000    163176.00\n\
-  CC3051   CC3251     1   0.15080000    163176.00\n\
-  CC3251   CC3151     1   0.15080000    163176.00\n\
-  CC3151   CC3153     1   0.15080000    163176.00\n\
-  CC3151   CC3152     1   0.15080000    163176.00\n\
-  CC3151   CC3051     1   0.15080000    163176.00\n\
-  CC3151   CC3151     1   0.15080000    163176.00\n\
-  CC3153    CC321     1   0.14900000    186188.00\n\
-  CC3051    CC321     1   0.14900000    186188.00\n\
-  CC3152    OC301     1   0.13950000    301248.00\n\
-  CC321D   CC311D     1   0.15380000    186188.00\n\
-  CC311D   CC311D     1   0.15380000    186188.00\n\
-  CC3161    OC30P     1   0.14250000    301248.00\n\
-  CC311D    OC30P     1   0.14250000    301248.00\n\
-  CC3162    OC30P     1   0.14250000    301248.00\n\
-   CC321    OC30P     1   0.14520000    301248.00\n\
-   OC30P       PC     1   0.16750000    225936.00\n\
-   OC2DP       PC     1   0.15250000    485344.00\n\
-   OC312       PC     1   0.16100000    198321.60\n\
-   OC312     HCP1     1   0.09600000    456056.00\n\
-      SC    OC2DP     1   0.14480000    451872.00\n\
-      SC    OC30P     1   0.16100000    209200.00\n\
-  CC312D    OC301     1   0.13950000    301248.00\n\
-  CC312D   OC3C5M     1   0.14250000    292880.00\n\
-  CC312D   CC322C     1   0.15180000    163176.00\n\
-  CC312D     HCA1     1   0.11000000    256897.60\n\
-  CC312D    OC302     1   0.14250000    301248.00\n\
-  CC312C     HCA1     1   0.11000000    256897.60\n\
-  CC312C    CC321     1   0.15000000    186188.00\n\
-   CC331    OC303     1   0.14150000    301248.00\n\
-  CC312C    OC303     1   0.14250000    301248.00\n\
-  CC311D    OC303     1   0.13950000    301248.00\n\
-  CC3051    OC302     1   0.14250000    301248.00\n\
-  CC3162    OC303     1   0.13950000    301248.00\n\
-   OC303   CC3151     1   0.14250000    301248.00\n\
-   OC301   CC3051     1   0.13950000    301248.00\n\
-     CN8      NN6     1   0.14800000    167360.00\n\
-     NN6      HN1     1   0.10400000    337230.40\n\
-     ON6     CN8B     1   0.14200000    217568.00\n\
-     CN8     CN8B     1   0.15280000    186188.00\n\
-     CN1      CN3     1   0.14090000    252713.60\n\
-     CN1     CN3T     1   0.14030000    252713.60\n\
-     CN1     CN5G     1   0.13600000    252713.60\n\
-     CN1      NN2     1   0.13670000    317984.00\n\
-    CN1T     NN2B     1   0.13480000    252713.60\n\
-     CN1     NN2G     1   0.13960000    284512.00\n\
-     CN1     NN2U     1   0.13890000    284512.00\n\
-    CN1T     NN2U     1   0.13830000    284512.00\n\
-     CN1      NN3     1   0.13350000    292880.00\n\
-    CN1T      ON1     1   0.12300000    719648.00\n\
-     CN1      ON1     1   0.12340000    552288.00\n\
-     CN1     ON1C     1   0.12450000    518816.00\n\
-     CN2      CN3     1   0.14060000    267776.00\n\
-     CN2      CN5     1   0.13580000    301248.00\n\
-     CN2      NN1     1   0.13660000    301248.00\n\
-     CN2     NN2G     1   0.13920000    334720.00\n\
-     CN2      NN3     1   0.13430000    376560.00\n\
-     CN2     NN3A     1   0.13420000    334720.00\n\
-     CN2     NN3G     1   0.13260000    267776.00\n\
-     CN3      CN3     1   0.13260000    418400.00\n\
-     CN3     CN3T     1   0.13200000    468608.00\n\
-    CN3T      CN9     1   0.14780000    192464.00\n\
-     CN3      HN3     1   0.10900000    292880.00\n\
-    CN3T      HN3     1   0.10900000    292880.00\n\
-     CN3      NN2     1   0.13430000    252713.60\n\
-     CN3     NN2B     1   0.13430000    267776.00\n\
-     CN4      HN3     1   0.10900000    317984.00\n\
-     CN4      NN2     1   0.13740000    267776.00\n\
-     CN4     NN2B     1   0.13780000    251040.00\n\
-     CN4     NN3A     1   0.13220000    351456.00\n\
-     CN4      NN4     1   0.13050000    334720.00\n\
-     CN5      CN5     1   0.13610000    259408.00\n\
-     CN5     CN5G     1   0.13500000    267776.00\n\
-     CN5      NN2     1   0.13750000    251040.00\n\
-     CN5     NN2B     1   0.13750000    252713.60\n\
-     CN5     NN3A     1   0.13120000    292880.00\n\
-     CN5     NN3G     1   0.13150000    292880.00\n\
-     CN5      NN4     1   0.13550000    259408.00\n\
-    CN5G      NN4     1   0.13650000    259408.00\n\
-     CN8      CN8     1   0.15280000    186188.00\n\
-     CN8      CN9     1   0.15280000    186188.00\n\
-     CN8      NN2     1   0.14600000    334720.00\n\
-     CN8      ON5     1   0.14200000    358150.40\n\
-     CN9      HN9     1   0.11110000    269449.60\n\
-     CN9      ON2     1   0.14300000    284512.00\n\
-     HN1      NN1     1   0.10000000    408358.40\n\
-     HN2      NN2     1   0.10100000    396643.20\n\
-     HN2     NN2B     1   0.10100000    396643.20\n\
-     HN2     NN2G     1   0.10100000    394132.80\n\
-     HN2     NN2U     1   0.10100000    396643.20\n\
-     HN4      ON4     1   0.09600000    456056.00\n\
-     ON2        P     1   0.16000000    225936.00\n\
-     ON2       P2     1   0.16000000    225936.00\n\
-     ON3        P     1   0.14800000    485344.00\n\
-     ON3       P2     1   0.14800000    485344.00\n\
-     ON4        P     1   0.15800000    198321.60\n\
-     ON4       P2     1   0.15800000    198321.60\n\
-    CN7B      ON6     1   0.14200000    217568.00\n\
-    CN7B      CN8     1   0.15180000    167360.00\n\
-     CN7      ON6     1   0.14460000    200832.00\n\
-     CN7      CN7     1   0.15290000    186188.00\n\
-     CN7      CN8     1   0.15160000    186188.00\n\
-     CN7      CN9     1   0.15160000    186188.00\n\
-     CN7      HN7     1   0.11110000    258571.20\n\
-     CN8      HN8     1   0.11110000    258571.20\n\
-    CN7B      HN7     1   0.11110000    258571.20\n\
-    CN7B     ON6B     1   0.14200000    217568.00\n\
-     CN7     ON6B     1   0.14800000    200832.00\n\
-    CN7B     CN7B     1   0.14500000    167360.00\n\
-     CN7     CN7B     1   0.14600000    186188.00\n\
-     CN7     CN8B     1   0.15120000    186188.00\n\
-    CN8B      ON2     1   0.14400000    267776.00\n\
-    CN8B      ON5     1   0.14200000    358150.40\n\
-     CN7      ON2     1   0.14330000    259408.00\n\
-    CN7B      ON2     1   0.14330000    259408.00\n\
-     CN7      ON5     1   0.14200000    358150.40\n\
-     CN9      NN2     1   0.14560000    334720.00\n\
-     CN8     NN2B     1   0.14580000    334720.00\n\
-     CN9     NN2B     1   0.14580000    334720.00\n\
-    CN7B      NN2     1   0.14560000    184096.00\n\
-    CN7B     NN2B     1   0.14580000    184096.00\n\
-    CN8B      HN8     1   0.11110000    258571.20\n\
-     ON5      HN5     1   0.09600000    456056.00\n\
-    CN7B      ON5     1   0.14000000    358150.40\n\
-     CN8      ON2     1   0.14400000    284512.00\n\
-    CTL3       CL     1   0.15220000    167360.00\n\
-    CTL2       CL     1   0.15220000    167360.00\n\
-    CTL1       CL     1   0.15220000    167360.00\n\
-    CTL1      CCL     1   0.15220000    167360.00\n\
-     OBL       CL     1   0.12200000    627600.00\n\
-     OCL       CL     1   0.12600000    439320.00\n\
-     OCL      CCL     1   0.12600000    439320.00\n\
-     OSL       CL     1   0.13340000    125520.00\n\
-    OSLP       CL     1   0.13340000    125520.00\n\
-     OHL       CL     1   0.14000000    192464.00\n\
-     HOL      OHL     1   0.09600000    456056.00\n\
-    CTL1     HAL1     1   0.11110000    258571.20\n\
-    CTL1      HBL     1   0.10800000    276144.00\n\
-    CTL2     HAL2     1   0.11110000    258571.20\n\
-    CTL3     HAL3     1   0.11110000    269449.60\n\
-    CTL3      OSL     1   0.14300000    284512.00\n\
-    CTL2      OSL     1   0.14300000    284512.00\n\
-    CTL1      OSL     1   0.14300000    284512.00\n\
-    CTL3     OSLP     1   0.14300000    284512.00\n\
-    CTL2     OSLP     1   0.14300000    284512.00\n\
-    CTL1     OSLP     1   0.14300000    284512.00\n\
-     OSL       PL     1   0.16000000    225936.00\n\
-    OSLP       PL     1   0.16000000    225936.00\n\
-     O2L       PL     1   0.14800000    485344.00\n\
-     OHL       PL     1   0.15900000    198321.60\n\
-    NH3L      HCL     1   0.10400000    343088.00\n\
-    NH3L     CTL1     1   0.14800000    167360.00\n\
-    NH3L     CTL2     1   0.15100000    218404.80\n\
-     NTL     CTL2     1   0.15100000    179912.00\n\
-     NTL     CTL5     1   0.15100000    179912.00\n\
-    CTL5       HL     1   0.10800000    251040.00\n\
-    CTL2       HL     1   0.10800000    251040.00\n\
-    CTL1     CTL1     1   0.15000000    186188.00\n\
-    CTL1     CTL2     1   0.15380000    186188.00\n\
-    CTL1     CTL3     1   0.15380000    186188.00\n\
-    CTL2     CTL2     1   0.15300000    186188.00\n\
-    CTL2     CTL3     1   0.15280000    186188.00\n\
-    CTL3     CTL3     1   0.15300000    186188.00\n\
-     OHL     CTL1     1   0.14200000    358150.40\n\
-     OHL     CTL2     1   0.14200000    358150.40\n\
-     OHL     CTL3     1   0.14200000    358150.40\n\
-      SL      O2L     1   0.14480000    451872.00\n\
-      SL      OSL     1   0.15750000    209200.00\n\
-    CEL2     CEL2     1   0.13300000    426768.00\n\
-    HEL2     CEL2     1   0.11000000    305432.00\n\
-    CEL1     CTL3     1   0.15040000    320494.40\n\
-    CEL1     CEL2     1   0.13420000    418400.00\n\
-    HEL1     CEL1     1   0.11000000    301666.40\n\
-    CEL1     CTL2     1   0.15020000    305432.00\n\
-    CEL1     CEL1     1   0.13400000    368192.00\n\
-   CC31A    HCA1A     1   0.11110000    258571.20\n\
-   CC32A    HCA2A     1   0.11110000    258571.20\n\
-   CC33A    HCA3A     1   0.11110000    269449.60\n\
-   CC30A    CC32A     1   0.15380000    186188.00\n\
-   CC30A    CC33A     1   0.15380000    186188.00\n\
-   CC31A    CC31A     1   0.15000000    186188.00\n\
-   CC31A    CC32A     1   0.15380000    186188.00\n\
-   CC31A    CC33A     1   0.15380000    186188.00\n\
-   CC32A    CC32A     1   0.15300000    186188.00\n\
-   CC32A    CC33A     1   0.15280000    186188.00\n\
-   CC33A    CC33A     1   0.15300000    186188.00\n\
-  CC325A   CC325A     1   0.15480000    163176.00\n\
-  CC325A   HCA25A     1   0.11160000    256897.60\n\
-  CC325B   OC305A     1   0.14250000    292880.00\n\
-  CC325B   CC325B     1   0.15180000    163176.00\n\
-  CC325B   HCA25A     1   0.11000000    256897.60\n\
-  CC325B    CC33A     1   0.15280000    186188.00\n\
-   CC32A    OC30A     1   0.14150000    301248.00\n\
-   CC33A    OC30A     1   0.14150000    301248.00\n\
-  CC326A    HCA2A     1   0.11110000    258571.20\n\
-  CC326A   CC326A     1   0.15300000    186188.00\n\
-  CC326A    OC30A     1   0.14150000    301248.00\n\
-       C        C     1   0.13350000    502080.00\n\
-     CST      OST     1   0.11600000    784884.93\n\
-      SS       FE     1   0.23200000    209200.00\n\
-     CPB      CE1     1   0.13800000    376560.00\n\
-     CPB      CPA     1   0.14432000    250872.64\n\
-     CPB      CPB     1   0.13464000    285097.76\n\
-     CPM      CPA     1   0.13716000    301248.00\n\
-     CT2      CPB     1   0.14900000    192464.00\n\
-     CT3      CPB     1   0.14900000    192464.00\n\
-      FE       CM     1   0.19000000    215894.40\n\
-      FE      CPM     1   0.33814000         0.00\n\
-      HA      CPM     1   0.10900000    307607.68\n\
-     NPH      CPA     1   0.13757000    315640.96\n\
-     NPH       FE     1   0.19580000    226103.36\n\
-     NR2       FE     1   0.22000000     54392.00\n\
-      OM       CM     1   0.11280000    933032.00\n\
-      OM       FE     1   0.18000000    209200.00\n\
-      OM       OM     1   0.12300000    502080.00\n\
-    CEL1     CTL1     1   0.15020000    200832.00\n\
-    CTL1     CRL1     1   0.15000000    186188.00\n\
-    CRL1     CRL1     1   0.15000000    186188.00\n\
-    CRL1     CTL2     1   0.15380000    186188.00\n\
-    CRL1     CRL2     1   0.15380000    186188.00\n\
-    CTL1     CRL2     1   0.15380000    186188.00\n\
-    CRL2     CRL2     1   0.15300000    186188.00\n\
-    CTL2     CRL2     1   0.15300000    186188.00\n\
-    CRL1     HGA1     1   0.11110000    258571.20\n\
-    CRL2     HGA2     1   0.11110000    258571.20\n\
-     OHL     CRL1     1   0.14200000    358150.40\n\
-    CRL1     CTL3     1   0.15380000    186188.00\n\
-    CEL1     CRL2     1   0.15020000    305432.00\n\
-    CEL1     CRL1     1   0.15020000    200832.00\n";
-
-} // End namespace charmm_constants
-
-#endif
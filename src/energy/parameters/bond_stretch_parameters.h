@@ -0,0 +1,983 @@
+// bond_stretch_parameters.h --- Typed table of the parameters in bond_stretch.itp
+// Generated by generate_parameter_tables.cmake from bond_stretch.itp. Do not edit.
+// Copyright (C) 2026 agent
+// Copyright (c) 1991-2000, University of Groningen, The Netherlands.
+// Copyright (c) 2001-2004, The GROMACS development team,
+//
+// This file is part of Phaistos
+//
+// Phaistos is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Phaistos is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Phaistos.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+#ifndef TERM_CHARMM_BOND_STRETCH_PARAMETERS_H
+#define TERM_CHARMM_BOND_STRETCH_PARAMETERS_H
+
+#include "atom_types.h"
+
+namespace charmm_parameters {
+
+//! Bond-stretch parameters (from bond_stretch.itp)
+struct BondStretchRecord {
+     AtomTypeId type1;
+     AtomTypeId type2;
+     double r0;
+     double kb;
+};
+
+//! Number of entries in bond_stretch_parameters
+const unsigned int N_BOND_STRETCH_PARAMETERS = 936;
+
+//! Bond-stretch parameters (from bond_stretch.itp)
+const BondStretchRecord bond_stretch_parameters[N_BOND_STRETCH_PARAMETERS] = {
+     {ATOM_TYPE_NH2, ATOM_TYPE_CT1, 0.14550000, 200832.00},
+     {ATOM_TYPE_CA, ATOM_TYPE_CAI, 0.13750000, 255224.00},
+     {ATOM_TYPE_CAI, ATOM_TYPE_CAI, 0.13750000, 255224.00},
+     {ATOM_TYPE_CPT, ATOM_TYPE_CA, 0.13600000, 251040.00},
+     {ATOM_TYPE_CPT, ATOM_TYPE_CAI, 0.13600000, 251040.00},
+     {ATOM_TYPE_CPT, ATOM_TYPE_CPT, 0.13850000, 301248.00},
+     {ATOM_TYPE_CY, ATOM_TYPE_CA, 0.13650000, 292880.00},
+     {ATOM_TYPE_CY, ATOM_TYPE_CAI, 0.13650000, 292880.00},
+     {ATOM_TYPE_CY, ATOM_TYPE_CPT, 0.14300000, 292880.00},
+     {ATOM_TYPE_CY, ATOM_TYPE_CT3, 0.14920000, 313800.00},
+     {ATOM_TYPE_CY, ATOM_TYPE_CT2, 0.14920000, 313800.00},
+     {ATOM_TYPE_HP, ATOM_TYPE_CAI, 0.10800000, 284512.00},
+     {ATOM_TYPE_HP, ATOM_TYPE_CY, 0.10800000, 292880.00},
+     {ATOM_TYPE_NY, ATOM_TYPE_CA, 0.13700000, 225936.00},
+     {ATOM_TYPE_NY, ATOM_TYPE_CPT, 0.13700000, 225936.00},
+     {ATOM_TYPE_NY, ATOM_TYPE_H, 0.09760000, 449780.00},
+     {ATOM_TYPE_CA, ATOM_TYPE_CA, 0.13750000, 255224.00},
+     {ATOM_TYPE_CE1, ATOM_TYPE_CE1, 0.13400000, 368192.00},
+     {ATOM_TYPE_CE1, ATOM_TYPE_CE2, 0.13420000, 418400.00},
+     {ATOM_TYPE_CE1, ATOM_TYPE_CT2, 0.15020000, 305432.00},
+     {ATOM_TYPE_CE1, ATOM_TYPE_CT3, 0.15040000, 320494.40},
+     {ATOM_TYPE_CE2, ATOM_TYPE_CE2, 0.13300000, 426768.00},
+     {ATOM_TYPE_CP1, ATOM_TYPE_C, 0.14900000, 209200.00},
+     {ATOM_TYPE_CP1, ATOM_TYPE_CC, 0.14900000, 209200.00},
+     {ATOM_TYPE_CP1, ATOM_TYPE_CD, 0.14900000, 167360.00},
+     {ATOM_TYPE_CP2, ATOM_TYPE_CP1, 0.15270000, 186188.00},
+     {ATOM_TYPE_CP2, ATOM_TYPE_CP2, 0.15370000, 186188.00},
+     {ATOM_TYPE_CP3, ATOM_TYPE_CP2, 0.15370000, 186188.00},
+     {ATOM_TYPE_CPH1, ATOM_TYPE_CPH1, 0.13600000, 343088.00},
+     {ATOM_TYPE_CT1, ATOM_TYPE_C, 0.14900000, 209200.00},
+     {ATOM_TYPE_CT1, ATOM_TYPE_CC, 0.15220000, 167360.00},
+     {ATOM_TYPE_CT1, ATOM_TYPE_CD, 0.15220000, 167360.00},
+     {ATOM_TYPE_CT1, ATOM_TYPE_CT1, 0.15000000, 186188.00},
+     {ATOM_TYPE_CT2, ATOM_TYPE_C, 0.14900000, 209200.00},
+     {ATOM_TYPE_CT2, ATOM_TYPE_CA, 0.14900000, 192464.00},
+     {ATOM_TYPE_CT2, ATOM_TYPE_CC, 0.15220000, 167360.00},
+     {ATOM_TYPE_CT2, ATOM_TYPE_CD, 0.15220000, 167360.00},
+     {ATOM_TYPE_CT2, ATOM_TYPE_CPH1, 0.15000000, 192154.38},
+     {ATOM_TYPE_CT2, ATOM_TYPE_CT1, 0.15380000, 186188.00},
+     {ATOM_TYPE_CT2, ATOM_TYPE_CT2, 0.15300000, 186188.00},
+     {ATOM_TYPE_CT3, ATOM_TYPE_C, 0.14900000, 209200.00},
+     {ATOM_TYPE_CT3, ATOM_TYPE_CA, 0.14900000, 192464.00},
+     {ATOM_TYPE_CT3, ATOM_TYPE_CC, 0.15220000, 167360.00},
+     {ATOM_TYPE_CT3, ATOM_TYPE_CD, 0.15220000, 167360.00},
+     {ATOM_TYPE_CT3, ATOM_TYPE_CPH1, 0.15000000, 192154.38},
+     {ATOM_TYPE_CT3, ATOM_TYPE_CS, 0.15310000, 158992.00},
+     {ATOM_TYPE_CT3, ATOM_TYPE_CT1, 0.15380000, 186188.00},
+     {ATOM_TYPE_CT3, ATOM_TYPE_CT2, 0.15280000, 186188.00},
+     {ATOM_TYPE_CT3, ATOM_TYPE_CT3, 0.15300000, 186188.00},
+     {ATOM_TYPE_H, ATOM_TYPE_CD, 0.11100000, 276144.00},
+     {ATOM_TYPE_HA1, ATOM_TYPE_CC, 0.11000000, 265374.38},
+     {ATOM_TYPE_HA2, ATOM_TYPE_CP2, 0.11110000, 258571.20},
+     {ATOM_TYPE_HA2, ATOM_TYPE_CP3, 0.11110000, 258571.20},
+     {ATOM_TYPE_HA2, ATOM_TYPE_CS, 0.11110000, 251040.00},
+     {ATOM_TYPE_HA3, ATOM_TYPE_CS, 0.11110000, 251040.00},
+     {ATOM_TYPE_HA1, ATOM_TYPE_CT1, 0.11110000, 258571.20},
+     {ATOM_TYPE_HA2, ATOM_TYPE_CT2, 0.11110000, 258571.20},
+     {ATOM_TYPE_HA3, ATOM_TYPE_CT3, 0.11110000, 269449.60},
+     {ATOM_TYPE_HE1, ATOM_TYPE_CE1, 0.11000000, 301666.40},
+     {ATOM_TYPE_HE2, ATOM_TYPE_CE2, 0.11000000, 305432.00},
+     {ATOM_TYPE_HB1, ATOM_TYPE_CP1, 0.10800000, 276144.00},
+     {ATOM_TYPE_HB1, ATOM_TYPE_CT1, 0.10800000, 276144.00},
+     {ATOM_TYPE_HB2, ATOM_TYPE_CT2, 0.10800000, 276144.00},
+     {ATOM_TYPE_HP, ATOM_TYPE_CA, 0.10800000, 284512.00},
+     {ATOM_TYPE_HR1, ATOM_TYPE_CPH1, 0.10830000, 313800.00},
+     {ATOM_TYPE_HR1, ATOM_TYPE_CPH2, 0.10900000, 284512.00},
+     {ATOM_TYPE_HR2, ATOM_TYPE_CPH2, 0.10700000, 278654.40},
+     {ATOM_TYPE_HR3, ATOM_TYPE_CPH1, 0.10830000, 305432.00},
+     {ATOM_TYPE_N, ATOM_TYPE_C, 0.13000000, 217568.00},
+     {ATOM_TYPE_N, ATOM_TYPE_CP1, 0.14340000, 267776.00},
+     {ATOM_TYPE_N, ATOM_TYPE_CP3, 0.14550000, 267776.00},
+     {ATOM_TYPE_NC2, ATOM_TYPE_C, 0.13650000, 376560.00},
+     {ATOM_TYPE_NC2, ATOM_TYPE_CT2, 0.14900000, 326352.00},
+     {ATOM_TYPE_NC2, ATOM_TYPE_CT3, 0.14900000, 326352.00},
+     {ATOM_TYPE_NC2, ATOM_TYPE_HC, 0.10000000, 380744.00},
+     {ATOM_TYPE_NH1, ATOM_TYPE_C, 0.13450000, 309616.00},
+     {ATOM_TYPE_NH1, ATOM_TYPE_CT1, 0.14300000, 267776.00},
+     {ATOM_TYPE_NH1, ATOM_TYPE_CT2, 0.14300000, 267776.00},
+     {ATOM_TYPE_NH1, ATOM_TYPE_CT3, 0.14300000, 267776.00},
+     {ATOM_TYPE_NH1, ATOM_TYPE_H, 0.09970000, 368192.00},
+     {ATOM_TYPE_NH1, ATOM_TYPE_HC, 0.09800000, 338904.00},
+     {ATOM_TYPE_NH2, ATOM_TYPE_CC, 0.13600000, 359824.00},
+     {ATOM_TYPE_NH2, ATOM_TYPE_CT2, 0.14550000, 200832.00},
+     {ATOM_TYPE_NH2, ATOM_TYPE_CT3, 0.14550000, 200832.00},
+     {ATOM_TYPE_NH2, ATOM_TYPE_H, 0.10000000, 401664.00},
+     {ATOM_TYPE_NH2, ATOM_TYPE_HC, 0.10000000, 384928.00},
+     {ATOM_TYPE_NH3, ATOM_TYPE_CT1, 0.14800000, 167360.00},
+     {ATOM_TYPE_NH3, ATOM_TYPE_CT2, 0.14800000, 167360.00},
+     {ATOM_TYPE_NH3, ATOM_TYPE_CT3, 0.14800000, 167360.00},
+     {ATOM_TYPE_NH3, ATOM_TYPE_HC, 0.10400000, 337230.40},
+     {ATOM_TYPE_NP, ATOM_TYPE_CP1, 0.14850000, 267776.00},
+     {ATOM_TYPE_NP, ATOM_TYPE_CP3, 0.15020000, 267776.00},
+     {ATOM_TYPE_NP, ATOM_TYPE_HC, 0.10060000, 384928.00},
+     {ATOM_TYPE_NR1, ATOM_TYPE_CPH1, 0.13800000, 334720.00},
+     {ATOM_TYPE_NR1, ATOM_TYPE_CPH2, 0.13600000, 334720.00},
+     {ATOM_TYPE_NR1, ATOM_TYPE_H, 0.10000000, 389948.80},
+     {ATOM_TYPE_NR2, ATOM_TYPE_CPH1, 0.13800000, 334720.00},
+     {ATOM_TYPE_NR2, ATOM_TYPE_CPH2, 0.13200000, 334720.00},
+     {ATOM_TYPE_NR3, ATOM_TYPE_CPH1, 0.13700000, 317984.00},
+     {ATOM_TYPE_NR3, ATOM_TYPE_CPH2, 0.13200000, 317984.00},
+     {ATOM_TYPE_NR3, ATOM_TYPE_H, 0.10000000, 379070.40},
+     {ATOM_TYPE_O, ATOM_TYPE_C, 0.12300000, 518816.00},
+     {ATOM_TYPE_O, ATOM_TYPE_CC, 0.12300000, 543920.00},
+     {ATOM_TYPE_OB, ATOM_TYPE_CC, 0.12200000, 627600.00},
+     {ATOM_TYPE_OB, ATOM_TYPE_CD, 0.12200000, 627600.00},
+     {ATOM_TYPE_OC, ATOM_TYPE_CA, 0.12600000, 439320.00},
+     {ATOM_TYPE_OC, ATOM_TYPE_CC, 0.12600000, 439320.00},
+     {ATOM_TYPE_OC, ATOM_TYPE_CT2, 0.13300000, 376560.00},
+     {ATOM_TYPE_OC, ATOM_TYPE_CT3, 0.13300000, 376560.00},
+     {ATOM_TYPE_OH1, ATOM_TYPE_CA, 0.14110000, 279742.24},
+     {ATOM_TYPE_OH1, ATOM_TYPE_CD, 0.14000000, 192464.00},
+     {ATOM_TYPE_OH1, ATOM_TYPE_CT1, 0.14200000, 358150.40},
+     {ATOM_TYPE_OH1, ATOM_TYPE_CT2, 0.14200000, 358150.40},
+     {ATOM_TYPE_OH1, ATOM_TYPE_CT3, 0.14200000, 358150.40},
+     {ATOM_TYPE_OH1, ATOM_TYPE_H, 0.09600000, 456056.00},
+     {ATOM_TYPE_OS, ATOM_TYPE_CD, 0.13340000, 125520.00},
+     {ATOM_TYPE_OS, ATOM_TYPE_CT3, 0.14300000, 284512.00},
+     {ATOM_TYPE_S, ATOM_TYPE_CT2, 0.18180000, 165686.40},
+     {ATOM_TYPE_S, ATOM_TYPE_CT3, 0.18160000, 200832.00},
+     {ATOM_TYPE_S, ATOM_TYPE_HS, 0.13250000, 230120.00},
+     {ATOM_TYPE_SM, ATOM_TYPE_CT2, 0.18160000, 179075.20},
+     {ATOM_TYPE_SM, ATOM_TYPE_CT3, 0.18160000, 179075.20},
+     {ATOM_TYPE_SM, ATOM_TYPE_SM, 0.20290000, 144766.40},
+     {ATOM_TYPE_SS, ATOM_TYPE_CS, 0.18360000, 171544.00},
+     {ATOM_TYPE_HR1, ATOM_TYPE_CD, 0.11100000, 276144.00},
+     {ATOM_TYPE_O, ATOM_TYPE_CD, 0.12050000, 602496.00},
+     {ATOM_TYPE_CT2A, ATOM_TYPE_CT1, 0.15380000, 186188.00},
+     {ATOM_TYPE_CT2, ATOM_TYPE_CT2A, 0.15300000, 186188.00},
+     {ATOM_TYPE_CT2A, ATOM_TYPE_HA2, 0.11110000, 258571.20},
+     {ATOM_TYPE_CT2A, ATOM_TYPE_CPH1, 0.15000000, 192154.38},
+     {ATOM_TYPE_CT2A, ATOM_TYPE_CC, 0.15220000, 167360.00},
+     {ATOM_TYPE_HT, ATOM_TYPE_HT, 0.15139000, 0.00},
+     {ATOM_TYPE_HT, ATOM_TYPE_OT, 0.09572000, 376560.00},
+     {ATOM_TYPE_OX, ATOM_TYPE_HX, 0.09700000, 456056.00},
+     {ATOM_TYPE_CG1N1, ATOM_TYPE_CG2R61, 0.14350000, 288696.00},
+     {ATOM_TYPE_CG1N1, ATOM_TYPE_CG331, 0.14700000, 334720.00},
+     {ATOM_TYPE_CG1N1, ATOM_TYPE_NG1T1, 0.11800000, 881150.40},
+     {ATOM_TYPE_CG1T1, ATOM_TYPE_CG1T1, 0.12200000, 803328.00},
+     {ATOM_TYPE_CG1T1, ATOM_TYPE_CG331, 0.14650000, 343088.00},
+     {ATOM_TYPE_CG251O, ATOM_TYPE_CG25C1, 0.13400000, 368192.00},
+     {ATOM_TYPE_CG251O, ATOM_TYPE_CG2DC3, 0.13400000, 476976.00},
+     {ATOM_TYPE_CG251O, ATOM_TYPE_CG2R53, 0.14800000, 213384.00},
+     {ATOM_TYPE_CG251O, ATOM_TYPE_NG2R53, 0.14100000, 167360.00},
+     {ATOM_TYPE_CG251O, ATOM_TYPE_SG311, 0.17700000, 167360.00},
+     {ATOM_TYPE_CG252O, ATOM_TYPE_CG25C2, 0.13400000, 368192.00},
+     {ATOM_TYPE_CG252O, ATOM_TYPE_CG2DC3, 0.13400000, 476976.00},
+     {ATOM_TYPE_CG252O, ATOM_TYPE_CG2R53, 0.14800000, 213384.00},
+     {ATOM_TYPE_CG252O, ATOM_TYPE_NG2R53, 0.14100000, 167360.00},
+     {ATOM_TYPE_CG252O, ATOM_TYPE_SG311, 0.17700000, 167360.00},
+     {ATOM_TYPE_CG25C1, ATOM_TYPE_CG2DC3, 0.13420000, 418400.00},
+     {ATOM_TYPE_CG25C1, ATOM_TYPE_CG2R53, 0.14900000, 206689.60},
+     {ATOM_TYPE_CG25C1, ATOM_TYPE_CG2RC0, 0.14800000, 242672.00},
+     {ATOM_TYPE_CG25C2, ATOM_TYPE_CG2DC3, 0.13420000, 418400.00},
+     {ATOM_TYPE_CG25C2, ATOM_TYPE_CG2R53, 0.14900000, 206689.60},
+     {ATOM_TYPE_CG25C2, ATOM_TYPE_CG2RC0, 0.14800000, 242672.00},
+     {ATOM_TYPE_CG2D1, ATOM_TYPE_CG2D1, 0.13400000, 368192.00},
+     {ATOM_TYPE_CG2D1, ATOM_TYPE_CG2D1O, 0.13180000, 368192.00},
+     {ATOM_TYPE_CG2D1, ATOM_TYPE_CG2D2, 0.13420000, 418400.00},
+     {ATOM_TYPE_CG2D1, ATOM_TYPE_CG2D2O, 0.13180000, 368192.00},
+     {ATOM_TYPE_CG2D1, ATOM_TYPE_CG301, 0.15020000, 200832.00},
+     {ATOM_TYPE_CG2D1, ATOM_TYPE_CG321, 0.15020000, 305432.00},
+     {ATOM_TYPE_CG2D1, ATOM_TYPE_CG331, 0.15040000, 320494.40},
+     {ATOM_TYPE_CG2D1, ATOM_TYPE_NG2D1, 0.12760000, 418400.00},
+     {ATOM_TYPE_CG2D1, ATOM_TYPE_NG2P1, 0.12830000, 393296.00},
+     {ATOM_TYPE_CG2D1, ATOM_TYPE_HGA4, 0.11000000, 301666.40},
+     {ATOM_TYPE_CG2D1, ATOM_TYPE_HGR52, 0.11000000, 301666.40},
+     {ATOM_TYPE_CG2D1O, ATOM_TYPE_CG2D2, 0.13400000, 502080.00},
+     {ATOM_TYPE_CG2D1O, ATOM_TYPE_CG2DC1, 0.13400000, 368192.00},
+     {ATOM_TYPE_CG2D1O, ATOM_TYPE_NG301, 0.13550000, 351456.00},
+     {ATOM_TYPE_CG2D1O, ATOM_TYPE_NG311, 0.13550000, 351456.00},
+     {ATOM_TYPE_CG2D1O, ATOM_TYPE_NG321, 0.14000000, 351456.00},
+     {ATOM_TYPE_CG2D1O, ATOM_TYPE_OG301, 0.13600000, 322168.00},
+     {ATOM_TYPE_CG2D1O, ATOM_TYPE_OG3R60, 0.13470000, 418400.00},
+     {ATOM_TYPE_CG2D1O, ATOM_TYPE_HGA4, 0.11000000, 301666.40},
+     {ATOM_TYPE_CG2D2, ATOM_TYPE_CG2D2, 0.13300000, 426768.00},
+     {ATOM_TYPE_CG2D2, ATOM_TYPE_CG2D2O, 0.13400000, 502080.00},
+     {ATOM_TYPE_CG2D2, ATOM_TYPE_HGA5, 0.11000000, 305432.00},
+     {ATOM_TYPE_CG2D2O, ATOM_TYPE_CG2DC2, 0.13400000, 368192.00},
+     {ATOM_TYPE_CG2D2O, ATOM_TYPE_NG301, 0.13550000, 351456.00},
+     {ATOM_TYPE_CG2D2O, ATOM_TYPE_NG311, 0.13550000, 351456.00},
+     {ATOM_TYPE_CG2D2O, ATOM_TYPE_NG321, 0.14000000, 351456.00},
+     {ATOM_TYPE_CG2D2O, ATOM_TYPE_OG301, 0.13600000, 322168.00},
+     {ATOM_TYPE_CG2D2O, ATOM_TYPE_OG3R60, 0.13470000, 418400.00},
+     {ATOM_TYPE_CG2D2O, ATOM_TYPE_HGA4, 0.11000000, 301666.40},
+     {ATOM_TYPE_CG2DC1, ATOM_TYPE_CG2DC1, 0.13400000, 368192.00},
+     {ATOM_TYPE_CG2DC1, ATOM_TYPE_CG2DC2, 0.14500000, 251040.00},
+     {ATOM_TYPE_CG2DC1, ATOM_TYPE_CG2DC3, 0.13420000, 418400.00},
+     {ATOM_TYPE_CG2DC1, ATOM_TYPE_CG2O1, 0.14890000, 368192.00},
+     {ATOM_TYPE_CG2DC1, ATOM_TYPE_CG2O3, 0.14890000, 368192.00},
+     {ATOM_TYPE_CG2DC1, ATOM_TYPE_CG2O4, 0.14798000, 251040.00},
+     {ATOM_TYPE_CG2DC1, ATOM_TYPE_CG2O5, 0.14800000, 251040.00},
+     {ATOM_TYPE_CG2DC1, ATOM_TYPE_CG2R61, 0.14500000, 305432.00},
+     {ATOM_TYPE_CG2DC1, ATOM_TYPE_CG301, 0.15020000, 305432.00},
+     {ATOM_TYPE_CG2DC1, ATOM_TYPE_CG321, 0.15020000, 305432.00},
+     {ATOM_TYPE_CG2DC1, ATOM_TYPE_CG331, 0.15040000, 320494.40},
+     {ATOM_TYPE_CG2DC1, ATOM_TYPE_NG2D1, 0.12760000, 418400.00},
+     {ATOM_TYPE_CG2DC1, ATOM_TYPE_NG2P1, 0.12830000, 393296.00},
+     {ATOM_TYPE_CG2DC1, ATOM_TYPE_HGA4, 0.11000000, 301666.40},
+     {ATOM_TYPE_CG2DC1, ATOM_TYPE_HGR52, 0.11000000, 301666.40},
+     {ATOM_TYPE_CG2DC2, ATOM_TYPE_CG2DC2, 0.13400000, 368192.00},
+     {ATOM_TYPE_CG2DC2, ATOM_TYPE_CG2DC3, 0.13420000, 418400.00},
+     {ATOM_TYPE_CG2DC2, ATOM_TYPE_CG2O1, 0.14890000, 368192.00},
+     {ATOM_TYPE_CG2DC2, ATOM_TYPE_CG2O3, 0.14890000, 368192.00},
+     {ATOM_TYPE_CG2DC2, ATOM_TYPE_CG2O4, 0.14798000, 251040.00},
+     {ATOM_TYPE_CG2DC2, ATOM_TYPE_CG2O5, 0.14800000, 251040.00},
+     {ATOM_TYPE_CG2DC2, ATOM_TYPE_CG2R61, 0.14500000, 305432.00},
+     {ATOM_TYPE_CG2DC2, ATOM_TYPE_CG301, 0.15020000, 305432.00},
+     {ATOM_TYPE_CG2DC2, ATOM_TYPE_CG321, 0.15020000, 305432.00},
+     {ATOM_TYPE_CG2DC2, ATOM_TYPE_CG331, 0.15040000, 320494.40},
+     {ATOM_TYPE_CG2DC2, ATOM_TYPE_NG2D1, 0.12760000, 418400.00},
+     {ATOM_TYPE_CG2DC2, ATOM_TYPE_NG2P1, 0.12830000, 393296.00},
+     {ATOM_TYPE_CG2DC2, ATOM_TYPE_HGA4, 0.11000000, 301666.40},
+     {ATOM_TYPE_CG2DC2, ATOM_TYPE_HGR52, 0.11000000, 301666.40},
+     {ATOM_TYPE_CG2DC3, ATOM_TYPE_HGA5, 0.11000000, 305432.00},
+     {ATOM_TYPE_CG2N1, ATOM_TYPE_NG2D1, 0.13100000, 418400.00},
+     {ATOM_TYPE_CG2N1, ATOM_TYPE_NG2P1, 0.13650000, 387438.40},
+     {ATOM_TYPE_CG2N1, ATOM_TYPE_NG311, 0.14400000, 418400.00},
+     {ATOM_TYPE_CG2N1, ATOM_TYPE_NG321, 0.14400000, 376560.00},
+     {ATOM_TYPE_CG2N2, ATOM_TYPE_CG2R61, 0.14400000, 251040.00},
+     {ATOM_TYPE_CG2N2, ATOM_TYPE_CG331, 0.15000000, 234304.00},
+     {ATOM_TYPE_CG2N2, ATOM_TYPE_NG2P1, 0.13200000, 397480.00},
+     {ATOM_TYPE_CG2O1, ATOM_TYPE_CG2R61, 0.14750000, 251040.00},
+     {ATOM_TYPE_CG2O1, ATOM_TYPE_CG2R62, 0.14800000, 252713.60},
+     {ATOM_TYPE_CG2O1, ATOM_TYPE_CG311, 0.14900000, 209200.00},
+     {ATOM_TYPE_CG2O1, ATOM_TYPE_CG314, 0.14900000, 209200.00},
+     {ATOM_TYPE_CG2O1, ATOM_TYPE_CG321, 0.14900000, 209200.00},
+     {ATOM_TYPE_CG2O1, ATOM_TYPE_CG324, 0.14900000, 209200.00},
+     {ATOM_TYPE_CG2O1, ATOM_TYPE_CG331, 0.14900000, 209200.00},
+     {ATOM_TYPE_CG2O1, ATOM_TYPE_CG3C51, 0.14900000, 209200.00},
+     {ATOM_TYPE_CG2O1, ATOM_TYPE_CG3C53, 0.14900000, 209200.00},
+     {ATOM_TYPE_CG2O1, ATOM_TYPE_NG2S0, 0.13500000, 359824.00},
+     {ATOM_TYPE_CG2O1, ATOM_TYPE_NG2S1, 0.13450000, 309616.00},
+     {ATOM_TYPE_CG2O1, ATOM_TYPE_NG2S2, 0.13600000, 359824.00},
+     {ATOM_TYPE_CG2O1, ATOM_TYPE_OG2D1, 0.12300000, 518816.00},
+     {ATOM_TYPE_CG2O1, ATOM_TYPE_HGR52, 0.11000000, 265374.38},
+     {ATOM_TYPE_CG2O2, ATOM_TYPE_CG2R61, 0.14800000, 212547.20},
+     {ATOM_TYPE_CG2O2, ATOM_TYPE_CG311, 0.15220000, 167360.00},
+     {ATOM_TYPE_CG2O2, ATOM_TYPE_CG321, 0.15220000, 167360.00},
+     {ATOM_TYPE_CG2O2, ATOM_TYPE_CG331, 0.15220000, 167360.00},
+     {ATOM_TYPE_CG2O2, ATOM_TYPE_OG2D1, 0.12200000, 627600.00},
+     {ATOM_TYPE_CG2O2, ATOM_TYPE_OG302, 0.13340000, 125520.00},
+     {ATOM_TYPE_CG2O2, ATOM_TYPE_OG311, 0.14000000, 192464.00},
+     {ATOM_TYPE_CG2O2, ATOM_TYPE_HGR52, 0.10960000, 291206.40},
+     {ATOM_TYPE_CG2O3, ATOM_TYPE_CG2O5, 0.15200000, 209200.00},
+     {ATOM_TYPE_CG2O3, ATOM_TYPE_CG2R61, 0.15000000, 167360.00},
+     {ATOM_TYPE_CG2O3, ATOM_TYPE_CG301, 0.15220000, 167360.00},
+     {ATOM_TYPE_CG2O3, ATOM_TYPE_CG311, 0.15220000, 167360.00},
+     {ATOM_TYPE_CG2O3, ATOM_TYPE_CG314, 0.15220000, 167360.00},
+     {ATOM_TYPE_CG2O3, ATOM_TYPE_CG321, 0.15220000, 167360.00},
+     {ATOM_TYPE_CG2O3, ATOM_TYPE_CG324, 0.15220000, 167360.00},
+     {ATOM_TYPE_CG2O3, ATOM_TYPE_CG331, 0.15220000, 167360.00},
+     {ATOM_TYPE_CG2O3, ATOM_TYPE_CG3C51, 0.14900000, 209200.00},
+     {ATOM_TYPE_CG2O3, ATOM_TYPE_CG3C53, 0.14900000, 209200.00},
+     {ATOM_TYPE_CG2O3, ATOM_TYPE_OG2D2, 0.12600000, 439320.00},
+     {ATOM_TYPE_CG2O3, ATOM_TYPE_HGR52, 0.11422000, 199158.40},
+     {ATOM_TYPE_CG2O4, ATOM_TYPE_CG2R61, 0.14798000, 251040.00},
+     {ATOM_TYPE_CG2O4, ATOM_TYPE_CG321, 0.15000000, 209200.00},
+     {ATOM_TYPE_CG2O4, ATOM_TYPE_CG331, 0.15000000, 209200.00},
+     {ATOM_TYPE_CG2O4, ATOM_TYPE_OG2D1, 0.12150000, 585760.00},
+     {ATOM_TYPE_CG2O4, ATOM_TYPE_HGR52, 0.11100000, 276144.00},
+     {ATOM_TYPE_CG2O5, ATOM_TYPE_CG2R61, 0.14600000, 212547.20},
+     {ATOM_TYPE_CG2O5, ATOM_TYPE_CG311, 0.15000000, 276144.00},
+     {ATOM_TYPE_CG2O5, ATOM_TYPE_CG321, 0.15000000, 276144.00},
+     {ATOM_TYPE_CG2O5, ATOM_TYPE_CG331, 0.15000000, 276144.00},
+     {ATOM_TYPE_CG2O5, ATOM_TYPE_OG2D3, 0.12300000, 585760.00},
+     {ATOM_TYPE_CG2O6, ATOM_TYPE_NG2S1, 0.13700000, 426768.00},
+     {ATOM_TYPE_CG2O6, ATOM_TYPE_NG2S2, 0.13600000, 359824.00},
+     {ATOM_TYPE_CG2O6, ATOM_TYPE_OG2D1, 0.12300000, 543920.00},
+     {ATOM_TYPE_CG2O6, ATOM_TYPE_OG2D2, 0.12940000, 263173.60},
+     {ATOM_TYPE_CG2O6, ATOM_TYPE_OG302, 0.13500000, 292880.00},
+     {ATOM_TYPE_CG2O6, ATOM_TYPE_SG2D1, 0.16300000, 251040.00},
+     {ATOM_TYPE_CG2O6, ATOM_TYPE_SG311, 0.17500000, 158992.00},
+     {ATOM_TYPE_CG2O7, ATOM_TYPE_OG2D5, 0.11600000, 825084.80},
+     {ATOM_TYPE_CG2R51, ATOM_TYPE_CG2R51, 0.13600000, 343088.00},
+     {ATOM_TYPE_CG2R51, ATOM_TYPE_CG2R52, 0.14000000, 301248.00},
+     {ATOM_TYPE_CG2R51, ATOM_TYPE_CG2RC0, 0.14300000, 292880.00},
+     {ATOM_TYPE_CG2R51, ATOM_TYPE_CG2RC7, 0.14050000, 284512.00},
+     {ATOM_TYPE_CG2R51, ATOM_TYPE_CG321, 0.15000000, 192154.38},
+     {ATOM_TYPE_CG2R51, ATOM_TYPE_CG331, 0.15000000, 192154.38},
+     {ATOM_TYPE_CG2R51, ATOM_TYPE_CG3C52, 0.15100000, 292880.00},
+     {ATOM_TYPE_CG2R51, ATOM_TYPE_CG3C54, 0.14960000, 271960.00},
+     {ATOM_TYPE_CG2R51, ATOM_TYPE_NG2R50, 0.13800000, 334720.00},
+     {ATOM_TYPE_CG2R51, ATOM_TYPE_NG2R51, 0.13800000, 334720.00},
+     {ATOM_TYPE_CG2R51, ATOM_TYPE_NG2R52, 0.13700000, 317984.00},
+     {ATOM_TYPE_CG2R51, ATOM_TYPE_NG2RC0, 0.13710000, 334720.00},
+     {ATOM_TYPE_CG2R51, ATOM_TYPE_NG3C51, 0.14120000, 301248.00},
+     {ATOM_TYPE_CG2R51, ATOM_TYPE_NG3P2, 0.14800000, 276144.00},
+     {ATOM_TYPE_CG2R51, ATOM_TYPE_OG2R50, 0.13710000, 376560.00},
+     {ATOM_TYPE_CG2R51, ATOM_TYPE_OG3C51, 0.13700000, 301248.00},
+     {ATOM_TYPE_CG2R51, ATOM_TYPE_SG2R50, 0.17300000, 251040.00},
+     {ATOM_TYPE_CG2R51, ATOM_TYPE_HGR51, 0.10800000, 292880.00},
+     {ATOM_TYPE_CG2R51, ATOM_TYPE_HGR52, 0.10830000, 313800.00},
+     {ATOM_TYPE_CG2R52, ATOM_TYPE_CG2RC0, 0.14200000, 301248.00},
+     {ATOM_TYPE_CG2R52, ATOM_TYPE_CG3C52, 0.15050000, 292880.00},
+     {ATOM_TYPE_CG2R52, ATOM_TYPE_NG2R50, 0.13150000, 334720.00},
+     {ATOM_TYPE_CG2R52, ATOM_TYPE_NG2R52, 0.13000000, 410032.00},
+     {ATOM_TYPE_CG2R52, ATOM_TYPE_HGR52, 0.10830000, 313800.00},
+     {ATOM_TYPE_CG2R53, ATOM_TYPE_CG3C41, 0.15600000, 167360.00},
+     {ATOM_TYPE_CG2R53, ATOM_TYPE_CG3C52, 0.15300000, 251040.00},
+     {ATOM_TYPE_CG2R53, ATOM_TYPE_NG2R43, 0.13800000, 309616.00},
+     {ATOM_TYPE_CG2R53, ATOM_TYPE_NG2R50, 0.13200000, 334720.00},
+     {ATOM_TYPE_CG2R53, ATOM_TYPE_NG2R51, 0.13740000, 267776.00},
+     {ATOM_TYPE_CG2R53, ATOM_TYPE_NG2R52, 0.13200000, 317984.00},
+     {ATOM_TYPE_CG2R53, ATOM_TYPE_NG2R53, 0.13800000, 384928.00},
+     {ATOM_TYPE_CG2R53, ATOM_TYPE_NG3C51, 0.14000000, 317984.00},
+     {ATOM_TYPE_CG2R53, ATOM_TYPE_OG2D1, 0.12350000, 476976.00},
+     {ATOM_TYPE_CG2R53, ATOM_TYPE_OG2R50, 0.13710000, 376560.00},
+     {ATOM_TYPE_CG2R53, ATOM_TYPE_SG2D1, 0.16300000, 334720.00},
+     {ATOM_TYPE_CG2R53, ATOM_TYPE_SG2R50, 0.17300000, 251040.00},
+     {ATOM_TYPE_CG2R53, ATOM_TYPE_SG311, 0.17700000, 142256.00},
+     {ATOM_TYPE_CG2R53, ATOM_TYPE_HGR52, 0.10900000, 284512.00},
+     {ATOM_TYPE_CG2R53, ATOM_TYPE_HGR53, 0.10700000, 278654.40},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_CG2R61, 0.13750000, 255224.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_CG2R64, 0.13550000, 209200.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_CG2R66, 0.13700000, 255224.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_CG2R67, 0.13750000, 255224.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_CG2RC0, 0.13600000, 251040.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_CG311, 0.14900000, 192464.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_CG312, 0.14500000, 165686.40},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_CG321, 0.14900000, 192464.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_CG324, 0.14900000, 192464.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_CG331, 0.14900000, 192464.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_NG2O1, 0.14020000, 192464.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_NG2R60, 0.13050000, 376560.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_NG2R62, 0.13050000, 376560.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_NG2RC0, 0.13790000, 309616.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_NG2S1, 0.14140000, 255224.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_NG2S3, 0.13900000, 334720.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_NG311, 0.14000000, 276144.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_NG3N1, 0.14100000, 569024.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_OG301, 0.13820000, 192464.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_OG303, 0.13800000, 284512.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_OG311, 0.14110000, 279742.24},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_OG312, 0.12600000, 439320.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_OG3R60, 0.13500000, 234304.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_SG311, 0.17500000, 234304.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_SG3O1, 0.17800000, 192464.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_SG3O2, 0.17300000, 158992.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_CLGR1, 0.17400000, 292880.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_BRGR1, 0.19030000, 192464.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_IGR1, 0.21150000, 158992.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_HGR61, 0.10800000, 284512.00},
+     {ATOM_TYPE_CG2R61, ATOM_TYPE_HGR62, 0.10800000, 284512.00},
+     {ATOM_TYPE_CG2R62, ATOM_TYPE_CG2R62, 0.13500000, 351456.00},
+     {ATOM_TYPE_CG2R62, ATOM_TYPE_CG2R63, 0.14030000, 252713.60},
+     {ATOM_TYPE_CG2R62, ATOM_TYPE_CG2R64, 0.14060000, 267776.00},
+     {ATOM_TYPE_CG2R62, ATOM_TYPE_CG331, 0.14780000, 192464.00},
+     {ATOM_TYPE_CG2R62, ATOM_TYPE_NG2R61, 0.13430000, 252713.60},
+     {ATOM_TYPE_CG2R62, ATOM_TYPE_HGR62, 0.10900000, 292880.00},
+     {ATOM_TYPE_CG2R62, ATOM_TYPE_HGR63, 0.10900000, 292880.00},
+     {ATOM_TYPE_CG2R63, ATOM_TYPE_CG2RC0, 0.13600000, 252713.60},
+     {ATOM_TYPE_CG2R63, ATOM_TYPE_NG2R61, 0.13830000, 284512.00},
+     {ATOM_TYPE_CG2R63, ATOM_TYPE_NG2R62, 0.13350000, 292880.00},
+     {ATOM_TYPE_CG2R63, ATOM_TYPE_OG2D4, 0.12340000, 552288.00},
+     {ATOM_TYPE_CG2R64, ATOM_TYPE_CG2RC0, 0.13580000, 301248.00},
+     {ATOM_TYPE_CG2R64, ATOM_TYPE_NG2R60, 0.13050000, 376560.00},
+     {ATOM_TYPE_CG2R64, ATOM_TYPE_NG2R61, 0.13920000, 334720.00},
+     {ATOM_TYPE_CG2R64, ATOM_TYPE_NG2R62, 0.13420000, 334720.00},
+     {ATOM_TYPE_CG2R64, ATOM_TYPE_NG2S1, 0.14140000, 255224.00},
+     {ATOM_TYPE_CG2R64, ATOM_TYPE_NG2S3, 0.13660000, 301248.00},
+     {ATOM_TYPE_CG2R64, ATOM_TYPE_HGR62, 0.10900000, 317984.00},
+     {ATOM_TYPE_CG2R66, ATOM_TYPE_FGR1, 0.13580000, 334720.00},
+     {ATOM_TYPE_CG2R67, ATOM_TYPE_CG2R67, 0.14900000, 251040.00},
+     {ATOM_TYPE_CG2R67, ATOM_TYPE_CG2RC0, 0.14200000, 251040.00},
+     {ATOM_TYPE_CG2R71, ATOM_TYPE_CG2R71, 0.13850000, 301248.00},
+     {ATOM_TYPE_CG2R71, ATOM_TYPE_CG2RC7, 0.13800000, 334720.00},
+     {ATOM_TYPE_CG2R71, ATOM_TYPE_HGR71, 0.10900000, 297064.00},
+     {ATOM_TYPE_CG2RC0, ATOM_TYPE_CG2RC0, 0.13850000, 301248.00},
+     {ATOM_TYPE_CG2RC0, ATOM_TYPE_CG3C52, 0.15200000, 255224.00},
+     {ATOM_TYPE_CG2RC0, ATOM_TYPE_NG2R50, 0.13650000, 259408.00},
+     {ATOM_TYPE_CG2RC0, ATOM_TYPE_NG2R51, 0.13750000, 251040.00},
+     {ATOM_TYPE_CG2RC0, ATOM_TYPE_NG2R62, 0.13150000, 292880.00},
+     {ATOM_TYPE_CG2RC0, ATOM_TYPE_NG2RC0, 0.14170000, 205016.00},
+     {ATOM_TYPE_CG2RC0, ATOM_TYPE_NG3C51, 0.14000000, 276144.00},
+     {ATOM_TYPE_CG2RC0, ATOM_TYPE_OG2R50, 0.13700000, 376560.00},
+     {ATOM_TYPE_CG2RC0, ATOM_TYPE_OG3C51, 0.13890000, 276144.00},
+     {ATOM_TYPE_CG2RC0, ATOM_TYPE_SG2R50, 0.17600000, 251040.00},
+     {ATOM_TYPE_CG2RC7, ATOM_TYPE_CG2RC7, 0.15200000, 192464.00},
+     {ATOM_TYPE_CG301, ATOM_TYPE_CG311, 0.15000000, 186188.00},
+     {ATOM_TYPE_CG301, ATOM_TYPE_CG321, 0.15380000, 186188.00},
+     {ATOM_TYPE_CG301, ATOM_TYPE_CG331, 0.15380000, 186188.00},
+     {ATOM_TYPE_CG301, ATOM_TYPE_OG301, 0.14150000, 301248.00},
+     {ATOM_TYPE_CG301, ATOM_TYPE_OG302, 0.14300000, 284512.00},
+     {ATOM_TYPE_CG301, ATOM_TYPE_OG311, 0.14200000, 358150.40},
+     {ATOM_TYPE_CG301, ATOM_TYPE_CLGA3, 0.17700000, 158992.00},
+     {ATOM_TYPE_CG301, ATOM_TYPE_BRGA3, 0.19540000, 100416.00},
+     {ATOM_TYPE_CG302, ATOM_TYPE_CG321, 0.15200000, 209200.00},
+     {ATOM_TYPE_CG302, ATOM_TYPE_CG331, 0.15200000, 209200.00},
+     {ATOM_TYPE_CG302, ATOM_TYPE_FGA3, 0.13400000, 221752.00},
+     {ATOM_TYPE_CG311, ATOM_TYPE_CG311, 0.15000000, 186188.00},
+     {ATOM_TYPE_CG311, ATOM_TYPE_CG314, 0.15000000, 186188.00},
+     {ATOM_TYPE_CG311, ATOM_TYPE_CG321, 0.15380000, 186188.00},
+     {ATOM_TYPE_CG311, ATOM_TYPE_CG324, 0.15300000, 186188.00},
+     {ATOM_TYPE_CG311, ATOM_TYPE_CG331, 0.15380000, 186188.00},
+     {ATOM_TYPE_CG311, ATOM_TYPE_CG3C51, 0.15280000, 186188.00},
+     {ATOM_TYPE_CG311, ATOM_TYPE_CG3RC1, 0.15240000, 186188.00},
+     {ATOM_TYPE_CG311, ATOM_TYPE_NG2R53, 0.14300000, 267776.00},
+     {ATOM_TYPE_CG311, ATOM_TYPE_NG2S1, 0.14300000, 267776.00},
+     {ATOM_TYPE_CG311, ATOM_TYPE_OG301, 0.14150000, 301248.00},
+     {ATOM_TYPE_CG311, ATOM_TYPE_OG302, 0.14300000, 284512.00},
+     {ATOM_TYPE_CG311, ATOM_TYPE_OG303, 0.14300000, 284512.00},
+     {ATOM_TYPE_CG311, ATOM_TYPE_OG311, 0.14200000, 358150.40},
+     {ATOM_TYPE_CG311, ATOM_TYPE_OG312, 0.13130000, 299574.40},
+     {ATOM_TYPE_CG311, ATOM_TYPE_CLGA1, 0.17768000, 158992.00},
+     {ATOM_TYPE_CG311, ATOM_TYPE_BRGA2, 0.19560000, 117152.00},
+     {ATOM_TYPE_CG311, ATOM_TYPE_HGA1, 0.11110000, 258571.20},
+     {ATOM_TYPE_CG312, ATOM_TYPE_CG331, 0.15200000, 165686.40},
+     {ATOM_TYPE_CG312, ATOM_TYPE_PG1, 0.18800000, 225936.00},
+     {ATOM_TYPE_CG312, ATOM_TYPE_PG2, 0.18800000, 225936.00},
+     {ATOM_TYPE_CG312, ATOM_TYPE_FGA2, 0.13530000, 292043.20},
+     {ATOM_TYPE_CG312, ATOM_TYPE_HGA7, 0.10828000, 289532.80},
+     {ATOM_TYPE_CG314, ATOM_TYPE_CG321, 0.15380000, 186188.00},
+     {ATOM_TYPE_CG314, ATOM_TYPE_CG331, 0.15380000, 186188.00},
+     {ATOM_TYPE_CG314, ATOM_TYPE_NG3P2, 0.14900000, 167360.00},
+     {ATOM_TYPE_CG314, ATOM_TYPE_NG3P3, 0.14800000, 167360.00},
+     {ATOM_TYPE_CG314, ATOM_TYPE_HGA1, 0.11110000, 258571.20},
+     {ATOM_TYPE_CG321, ATOM_TYPE_CG321, 0.15300000, 186188.00},
+     {ATOM_TYPE_CG321, ATOM_TYPE_CG324, 0.15300000, 186188.00},
+     {ATOM_TYPE_CG321, ATOM_TYPE_CG331, 0.15280000, 186188.00},
+     {ATOM_TYPE_CG321, ATOM_TYPE_CG3C31, 0.15000000, 230120.00},
+     {ATOM_TYPE_CG321, ATOM_TYPE_CG3C51, 0.15280000, 186188.00},
+     {ATOM_TYPE_CG321, ATOM_TYPE_CG3RC1, 0.15240000, 186188.00},
+     {ATOM_TYPE_CG321, ATOM_TYPE_NG2S1, 0.14300000, 267776.00},
+     {ATOM_TYPE_CG321, ATOM_TYPE_NG311, 0.14740000, 220078.40},
+     {ATOM_TYPE_CG321, ATOM_TYPE_NG321, 0.14740000, 220078.40},
+     {ATOM_TYPE_CG321, ATOM_TYPE_OG301, 0.14150000, 301248.00},
+     {ATOM_TYPE_CG321, ATOM_TYPE_OG302, 0.14400000, 267776.00},
+     {ATOM_TYPE_CG321, ATOM_TYPE_OG303, 0.14400000, 267776.00},
+     {ATOM_TYPE_CG321, ATOM_TYPE_OG311, 0.14200000, 358150.40},
+     {ATOM_TYPE_CG321, ATOM_TYPE_OG312, 0.13300000, 376560.00},
+     {ATOM_TYPE_CG321, ATOM_TYPE_OG3C61, 0.14150000, 301248.00},
+     {ATOM_TYPE_CG321, ATOM_TYPE_OG3R60, 0.14000000, 234304.00},
+     {ATOM_TYPE_CG321, ATOM_TYPE_PG1, 0.18900000, 225936.00},
+     {ATOM_TYPE_CG321, ATOM_TYPE_PG2, 0.18900000, 225936.00},
+     {ATOM_TYPE_CG321, ATOM_TYPE_SG301, 0.18160000, 179075.20},
+     {ATOM_TYPE_CG321, ATOM_TYPE_SG311, 0.18180000, 165686.40},
+     {ATOM_TYPE_CG321, ATOM_TYPE_SG3O1, 0.18070000, 154808.00},
+     {ATOM_TYPE_CG321, ATOM_TYPE_SG3O2, 0.17900000, 154808.00},
+     {ATOM_TYPE_CG321, ATOM_TYPE_SG3O3, 0.18100000, 154808.00},
+     {ATOM_TYPE_CG321, ATOM_TYPE_CLGA1, 0.17880000, 184096.00},
+     {ATOM_TYPE_CG321, ATOM_TYPE_BRGA1, 0.19660000, 133888.00},
+     {ATOM_TYPE_CG321, ATOM_TYPE_HGA2, 0.11110000, 258571.20},
+     {ATOM_TYPE_CG322, ATOM_TYPE_CG331, 0.15200000, 142256.00},
+     {ATOM_TYPE_CG322, ATOM_TYPE_FGA1, 0.13740000, 351456.00},
+     {ATOM_TYPE_CG322, ATOM_TYPE_HGA6, 0.10828000, 286185.60},
+     {ATOM_TYPE_CG323, ATOM_TYPE_CG331, 0.15310000, 158992.00},
+     {ATOM_TYPE_CG323, ATOM_TYPE_SG302, 0.18360000, 171544.00},
+     {ATOM_TYPE_CG323, ATOM_TYPE_HGA2, 0.11110000, 251040.00},
+     {ATOM_TYPE_CG323, ATOM_TYPE_HGA3, 0.11110000, 251040.00},
+     {ATOM_TYPE_CG324, ATOM_TYPE_CG331, 0.15280000, 186188.00},
+     {ATOM_TYPE_CG324, ATOM_TYPE_CG3C31, 0.15280000, 186188.00},
+     {ATOM_TYPE_CG324, ATOM_TYPE_NG2O1, 0.14900000, 189116.80},
+     {ATOM_TYPE_CG324, ATOM_TYPE_NG2P1, 0.14530000, 251040.00},
+     {ATOM_TYPE_CG324, ATOM_TYPE_NG3P0, 0.15100000, 179912.00},
+     {ATOM_TYPE_CG324, ATOM_TYPE_NG3P1, 0.14800000, 167360.00},
+     {ATOM_TYPE_CG324, ATOM_TYPE_NG3P2, 0.14900000, 167360.00},
+     {ATOM_TYPE_CG324, ATOM_TYPE_NG3P3, 0.14900000, 167360.00},
+     {ATOM_TYPE_CG324, ATOM_TYPE_HGA2, 0.11000000, 238069.60},
+     {ATOM_TYPE_CG324, ATOM_TYPE_HGP5, 0.10800000, 251040.00},
+     {ATOM_TYPE_CG331, ATOM_TYPE_CG331, 0.15300000, 186188.00},
+     {ATOM_TYPE_CG331, ATOM_TYPE_CG3C51, 0.15280000, 186188.00},
+     {ATOM_TYPE_CG331, ATOM_TYPE_CG3RC1, 0.15380000, 186188.00},
+     {ATOM_TYPE_CG331, ATOM_TYPE_NG2D1, 0.14400000, 259408.00},
+     {ATOM_TYPE_CG331, ATOM_TYPE_NG2R51, 0.14580000, 334720.00},
+     {ATOM_TYPE_CG331, ATOM_TYPE_NG2R61, 0.14560000, 334720.00},
+     {ATOM_TYPE_CG331, ATOM_TYPE_NG2S0, 0.14340000, 263592.00},
+     {ATOM_TYPE_CG331, ATOM_TYPE_NG2S1, 0.14300000, 267776.00},
+     {ATOM_TYPE_CG331, ATOM_TYPE_NG2S3, 0.14900000, 218404.80},
+     {ATOM_TYPE_CG331, ATOM_TYPE_NG311, 0.14630000, 213384.00},
+     {ATOM_TYPE_CG331, ATOM_TYPE_OG301, 0.14150000, 301248.00},
+     {ATOM_TYPE_CG331, ATOM_TYPE_OG302, 0.14300000, 284512.00},
+     {ATOM_TYPE_CG331, ATOM_TYPE_OG303, 0.14300000, 284512.00},
+     {ATOM_TYPE_CG331, ATOM_TYPE_OG311, 0.14200000, 358150.40},
+     {ATOM_TYPE_CG331, ATOM_TYPE_OG312, 0.13300000, 376560.00},
+     {ATOM_TYPE_CG331, ATOM_TYPE_SG301, 0.18160000, 179075.20},
+     {ATOM_TYPE_CG331, ATOM_TYPE_SG311, 0.18160000, 200832.00},
+     {ATOM_TYPE_CG331, ATOM_TYPE_SG3O1, 0.18370000, 163176.00},
+     {ATOM_TYPE_CG331, ATOM_TYPE_SG3O2, 0.17900000, 175728.00},
+     {ATOM_TYPE_CG331, ATOM_TYPE_SG3O3, 0.18000000, 200832.00},
+     {ATOM_TYPE_CG331, ATOM_TYPE_HGA3, 0.11110000, 269449.60},
+     {ATOM_TYPE_CG334, ATOM_TYPE_NG2O1, 0.14800000, 209200.00},
+     {ATOM_TYPE_CG334, ATOM_TYPE_NG2P1, 0.14530000, 251040.00},
+     {ATOM_TYPE_CG334, ATOM_TYPE_NG3P0, 0.15100000, 179912.00},
+     {ATOM_TYPE_CG334, ATOM_TYPE_NG3P1, 0.14800000, 167360.00},
+     {ATOM_TYPE_CG334, ATOM_TYPE_NG3P3, 0.14800000, 167360.00},
+     {ATOM_TYPE_CG334, ATOM_TYPE_HGA3, 0.11110000, 269449.60},
+     {ATOM_TYPE_CG334, ATOM_TYPE_HGP5, 0.10800000, 251040.00},
+     {ATOM_TYPE_CG3AM0, ATOM_TYPE_NG301, 0.14540000, 196648.00},
+     {ATOM_TYPE_CG3AM0, ATOM_TYPE_HGAAM0, 0.11110000, 260244.80},
+     {ATOM_TYPE_CG3AM1, ATOM_TYPE_NG311, 0.14630000, 213384.00},
+     {ATOM_TYPE_CG3AM1, ATOM_TYPE_HGAAM1, 0.10980000, 262587.84},
+     {ATOM_TYPE_CG3AM2, ATOM_TYPE_NG321, 0.14740000, 220078.40},
+     {ATOM_TYPE_CG3AM2, ATOM_TYPE_HGAAM2, 0.10856000, 263173.60},
+     {ATOM_TYPE_CG3C31, ATOM_TYPE_CG3C31, 0.15010000, 200832.00},
+     {ATOM_TYPE_CG3C31, ATOM_TYPE_CG3RC1, 0.15240000, 186188.00},
+     {ATOM_TYPE_CG3C31, ATOM_TYPE_OG3C31, 0.14500000, 184096.00},
+     {ATOM_TYPE_CG3C31, ATOM_TYPE_HGA1, 0.10830000, 284512.00},
+     {ATOM_TYPE_CG3C31, ATOM_TYPE_HGA2, 0.10830000, 284512.00},
+     {ATOM_TYPE_CG3C41, ATOM_TYPE_CG3C41, 0.15400000, 225936.00},
+     {ATOM_TYPE_CG3C41, ATOM_TYPE_NG2R43, 0.14500000, 205016.00},
+     {ATOM_TYPE_CG3C41, ATOM_TYPE_HGA2, 0.10930000, 291206.40},
+     {ATOM_TYPE_CG3C51, ATOM_TYPE_CG3C51, 0.15180000, 163176.00},
+     {ATOM_TYPE_CG3C51, ATOM_TYPE_CG3C52, 0.15180000, 163176.00},
+     {ATOM_TYPE_CG3C51, ATOM_TYPE_CG3C53, 0.15000000, 186188.00},
+     {ATOM_TYPE_CG3C51, ATOM_TYPE_CG3RC1, 0.15240000, 186188.00},
+     {ATOM_TYPE_CG3C51, ATOM_TYPE_NG2R51, 0.14580000, 184096.00},
+     {ATOM_TYPE_CG3C51, ATOM_TYPE_NG2R61, 0.14560000, 184096.00},
+     {ATOM_TYPE_CG3C51, ATOM_TYPE_NG2S0, 0.14340000, 267776.00},
+     {ATOM_TYPE_CG3C51, ATOM_TYPE_NG2S3, 0.14620000, 301248.00},
+     {ATOM_TYPE_CG3C51, ATOM_TYPE_NG301, 0.14560000, 184096.00},
+     {ATOM_TYPE_CG3C51, ATOM_TYPE_NG321, 0.14740000, 220078.40},
+     {ATOM_TYPE_CG3C51, ATOM_TYPE_OG301, 0.14110000, 279742.24},
+     {ATOM_TYPE_CG3C51, ATOM_TYPE_OG303, 0.14300000, 284512.00},
+     {ATOM_TYPE_CG3C51, ATOM_TYPE_OG311, 0.14200000, 358150.40},
+     {ATOM_TYPE_CG3C51, ATOM_TYPE_OG3C51, 0.14250000, 292880.00},
+     {ATOM_TYPE_CG3C51, ATOM_TYPE_FGA1, 0.13740000, 351456.00},
+     {ATOM_TYPE_CG3C51, ATOM_TYPE_HGA1, 0.11000000, 256897.60},
+     {ATOM_TYPE_CG3C51, ATOM_TYPE_HGA6, 0.10828000, 286185.60},
+     {ATOM_TYPE_CG3C52, ATOM_TYPE_CG3C52, 0.15300000, 163176.00},
+     {ATOM_TYPE_CG3C52, ATOM_TYPE_CG3C53, 0.15270000, 186188.00},
+     {ATOM_TYPE_CG3C52, ATOM_TYPE_CG3C54, 0.15370000, 186188.00},
+     {ATOM_TYPE_CG3C52, ATOM_TYPE_CG3RC1, 0.15240000, 186188.00},
+     {ATOM_TYPE_CG3C52, ATOM_TYPE_NG2R50, 0.14700000, 334720.00},
+     {ATOM_TYPE_CG3C52, ATOM_TYPE_NG2R53, 0.14500000, 309616.00},
+     {ATOM_TYPE_CG3C52, ATOM_TYPE_NG2S0, 0.14550000, 267776.00},
+     {ATOM_TYPE_CG3C52, ATOM_TYPE_NG3C51, 0.14780000, 334720.00},
+     {ATOM_TYPE_CG3C52, ATOM_TYPE_OG3C51, 0.14250000, 292880.00},
+     {ATOM_TYPE_CG3C52, ATOM_TYPE_HGA2, 0.11000000, 256897.60},
+     {ATOM_TYPE_CG3C53, ATOM_TYPE_NG2R61, 0.14560000, 184096.00},
+     {ATOM_TYPE_CG3C53, ATOM_TYPE_NG3P2, 0.14850000, 267776.00},
+     {ATOM_TYPE_CG3C53, ATOM_TYPE_OG3C51, 0.14460000, 200832.00},
+     {ATOM_TYPE_CG3C53, ATOM_TYPE_HGA1, 0.10800000, 276144.00},
+     {ATOM_TYPE_CG3C54, ATOM_TYPE_CG3C54, 0.15600000, 175728.00},
+     {ATOM_TYPE_CG3C54, ATOM_TYPE_NG2R52, 0.14600000, 267776.00},
+     {ATOM_TYPE_CG3C54, ATOM_TYPE_NG3C51, 0.14300000, 196648.00},
+     {ATOM_TYPE_CG3C54, ATOM_TYPE_NG3P2, 0.15150000, 267776.00},
+     {ATOM_TYPE_CG3C54, ATOM_TYPE_HGA2, 0.11110000, 258571.20},
+     {ATOM_TYPE_CG3RC1, ATOM_TYPE_CG3RC1, 0.15230000, 186188.00},
+     {ATOM_TYPE_CG3RC1, ATOM_TYPE_NG2R51, 0.14580000, 184096.00},
+     {ATOM_TYPE_CG3RC1, ATOM_TYPE_NG2R61, 0.14560000, 184096.00},
+     {ATOM_TYPE_CG3RC1, ATOM_TYPE_OG3C51, 0.14200000, 217568.00},
+     {ATOM_TYPE_CG3RC1, ATOM_TYPE_HGA1, 0.11110000, 258571.20},
+     {ATOM_TYPE_NG2D1, ATOM_TYPE_NG2S1, 0.13600000, 460240.00},
+     {ATOM_TYPE_NG2D1, ATOM_TYPE_HGP1, 0.10000000, 380744.00},
+     {ATOM_TYPE_NG2O1, ATOM_TYPE_OG2N1, 0.12250000, 485344.00},
+     {ATOM_TYPE_NG2P1, ATOM_TYPE_HGP2, 0.10000000, 380744.00},
+     {ATOM_TYPE_NG2R43, ATOM_TYPE_HGP1, 0.10150000, 337230.40},
+     {ATOM_TYPE_NG2R50, ATOM_TYPE_NG2R50, 0.12900000, 284512.00},
+     {ATOM_TYPE_NG2R50, ATOM_TYPE_NG2R51, 0.13550000, 301248.00},
+     {ATOM_TYPE_NG2R50, ATOM_TYPE_NG3C51, 0.14110000, 351456.00},
+     {ATOM_TYPE_NG2R50, ATOM_TYPE_OG2R50, 0.13950000, 234304.00},
+     {ATOM_TYPE_NG2R50, ATOM_TYPE_SG2R50, 0.17000000, 225936.00},
+     {ATOM_TYPE_NG2R51, ATOM_TYPE_HGP1, 0.10100000, 396643.20},
+     {ATOM_TYPE_NG2R52, ATOM_TYPE_HGP2, 0.10000000, 379070.40},
+     {ATOM_TYPE_NG2R53, ATOM_TYPE_HGP1, 0.10150000, 393296.00},
+     {ATOM_TYPE_NG2R61, ATOM_TYPE_HGP1, 0.10100000, 396643.20},
+     {ATOM_TYPE_NG2R61, ATOM_TYPE_HGP2, 0.10100000, 396643.20},
+     {ATOM_TYPE_NG2R62, ATOM_TYPE_NG2R62, 0.13200000, 351456.00},
+     {ATOM_TYPE_NG2S1, ATOM_TYPE_HGP1, 0.09970000, 368192.00},
+     {ATOM_TYPE_NG2S2, ATOM_TYPE_HGP1, 0.10000000, 401664.00},
+     {ATOM_TYPE_NG2S3, ATOM_TYPE_PG1, 0.17920000, 150624.00},
+     {ATOM_TYPE_NG2S3, ATOM_TYPE_HGP1, 0.10250000, 361916.00},
+     {ATOM_TYPE_NG2S3, ATOM_TYPE_HGP4, 0.10000000, 408358.40},
+     {ATOM_TYPE_NG311, ATOM_TYPE_SG3O2, 0.16500000, 196648.00},
+     {ATOM_TYPE_NG311, ATOM_TYPE_HGP1, 0.10210000, 369865.60},
+     {ATOM_TYPE_NG311, ATOM_TYPE_HGPAM1, 0.10190000, 374719.04},
+     {ATOM_TYPE_NG321, ATOM_TYPE_SG3O2, 0.16800000, 200832.00},
+     {ATOM_TYPE_NG321, ATOM_TYPE_HGP1, 0.10200000, 379907.20},
+     {ATOM_TYPE_NG321, ATOM_TYPE_HGPAM2, 0.10140000, 379154.08},
+     {ATOM_TYPE_NG331, ATOM_TYPE_HGPAM3, 0.10140000, 381162.40},
+     {ATOM_TYPE_NG3C51, ATOM_TYPE_NG3P2, 0.14400000, 225936.00},
+     {ATOM_TYPE_NG3C51, ATOM_TYPE_HGP1, 0.10180000, 376560.00},
+     {ATOM_TYPE_NG3N1, ATOM_TYPE_NG3N1, 0.14000000, 297064.00},
+     {ATOM_TYPE_NG3N1, ATOM_TYPE_HGP1, 0.10100000, 365681.60},
+     {ATOM_TYPE_NG3P0, ATOM_TYPE_OG311, 0.14000000, 205016.00},
+     {ATOM_TYPE_NG3P0, ATOM_TYPE_OG312, 0.14000000, 259408.00},
+     {ATOM_TYPE_NG3P1, ATOM_TYPE_HGP2, 0.10400000, 337230.40},
+     {ATOM_TYPE_NG3P2, ATOM_TYPE_HGP2, 0.10060000, 384928.00},
+     {ATOM_TYPE_NG3P3, ATOM_TYPE_HGP2, 0.10400000, 337230.40},
+     {ATOM_TYPE_OG2P1, ATOM_TYPE_PG0, 0.14800000, 485344.00},
+     {ATOM_TYPE_OG2P1, ATOM_TYPE_PG1, 0.15100000, 418400.00},
+     {ATOM_TYPE_OG2P1, ATOM_TYPE_PG2, 0.15200000, 334720.00},
+     {ATOM_TYPE_OG2P1, ATOM_TYPE_SG3O1, 0.14480000, 451872.00},
+     {ATOM_TYPE_OG2P1, ATOM_TYPE_SG3O2, 0.14400000, 527184.00},
+     {ATOM_TYPE_OG2P1, ATOM_TYPE_SG3O3, 0.15300000, 451872.00},
+     {ATOM_TYPE_OG303, ATOM_TYPE_PG0, 0.16100000, 192464.00},
+     {ATOM_TYPE_OG303, ATOM_TYPE_PG1, 0.16500000, 158992.00},
+     {ATOM_TYPE_OG303, ATOM_TYPE_PG2, 0.16550000, 125520.00},
+     {ATOM_TYPE_OG303, ATOM_TYPE_SG3O1, 0.15750000, 209200.00},
+     {ATOM_TYPE_OG303, ATOM_TYPE_SG3O2, 0.16000000, 196648.00},
+     {ATOM_TYPE_OG304, ATOM_TYPE_PG1, 0.16750000, 276144.00},
+     {ATOM_TYPE_OG304, ATOM_TYPE_PG2, 0.17150000, 251040.00},
+     {ATOM_TYPE_OG311, ATOM_TYPE_PG0, 0.15800000, 198321.60},
+     {ATOM_TYPE_OG311, ATOM_TYPE_PG1, 0.16100000, 198321.60},
+     {ATOM_TYPE_OG311, ATOM_TYPE_HGP1, 0.09600000, 456056.00},
+     {ATOM_TYPE_SG301, ATOM_TYPE_SG301, 0.20290000, 144766.40},
+     {ATOM_TYPE_SG311, ATOM_TYPE_HGP3, 0.13250000, 230120.00},
+     {ATOM_TYPE_FGP1, ATOM_TYPE_ALG1, 0.17260000, 171544.00},
+     {ATOM_TYPE_OC2D3, ATOM_TYPE_CC2O3, 0.12150000, 585760.00},
+     {ATOM_TYPE_CC2O3, ATOM_TYPE_CC331, 0.15000000, 276144.00},
+     {ATOM_TYPE_CC2O3, ATOM_TYPE_CC312, 0.15000000, 276144.00},
+     {ATOM_TYPE_CC2O3, ATOM_TYPE_CC322, 0.15000000, 276144.00},
+     {ATOM_TYPE_OC2D4, ATOM_TYPE_CC2O4, 0.12150000, 585760.00},
+     {ATOM_TYPE_HCR1, ATOM_TYPE_CC2O4, 0.11100000, 276144.00},
+     {ATOM_TYPE_CC2O4, ATOM_TYPE_CC331, 0.15000000, 209200.00},
+     {ATOM_TYPE_CC2O4, ATOM_TYPE_CC312, 0.15000000, 209200.00},
+     {ATOM_TYPE_CC311, ATOM_TYPE_CC311, 0.15000000, 186188.00},
+     {ATOM_TYPE_CC312, ATOM_TYPE_CC312, 0.14850000, 186188.00},
+     {ATOM_TYPE_CC3161, ATOM_TYPE_CC3163, 0.15000000, 186188.00},
+     {ATOM_TYPE_CC3161, ATOM_TYPE_CC3263, 0.15000000, 186188.00},
+     {ATOM_TYPE_CC312, ATOM_TYPE_CC322, 0.14850000, 186188.00},
+     {ATOM_TYPE_CC301, ATOM_TYPE_CC331, 0.15380000, 186188.00},
+     {ATOM_TYPE_CC311, ATOM_TYPE_CC321, 0.15380000, 186188.00},
+     {ATOM_TYPE_CC311, ATOM_TYPE_CC331, 0.15380000, 186188.00},
+     {ATOM_TYPE_CC331, ATOM_TYPE_CC3163, 0.15380000, 186188.00},
+     {ATOM_TYPE_CC3161, ATOM_TYPE_CC3161, 0.14800000, 186188.00},
+     {ATOM_TYPE_CC3261, ATOM_TYPE_CC3161, 0.14800000, 186188.00},
+     {ATOM_TYPE_CC3161, ATOM_TYPE_CC3162, 0.14800000, 186188.00},
+     {ATOM_TYPE_CC3261, ATOM_TYPE_CC3062, 0.15150000, 186188.00},
+     {ATOM_TYPE_CC321, ATOM_TYPE_CC3163, 0.14900000, 186188.00},
+     {ATOM_TYPE_CC312, ATOM_TYPE_CC3163, 0.14900000, 186188.00},
+     {ATOM_TYPE_CC301, ATOM_TYPE_CC2O2, 0.15220000, 167360.00},
+     {ATOM_TYPE_CC311, ATOM_TYPE_CC2O2, 0.15220000, 167360.00},
+     {ATOM_TYPE_CC3163, ATOM_TYPE_CC2O2, 0.14800000, 167360.00},
+     {ATOM_TYPE_CC3062, ATOM_TYPE_CC2O2, 0.14800000, 167360.00},
+     {ATOM_TYPE_CC2O1, ATOM_TYPE_CC331, 0.15200000, 209200.00},
+     {ATOM_TYPE_CC321, ATOM_TYPE_CC331, 0.15280000, 186188.00},
+     {ATOM_TYPE_CC321, ATOM_TYPE_CC321, 0.15300000, 186188.00},
+     {ATOM_TYPE_CC321C, ATOM_TYPE_CC321C, 0.15300000, 186188.00},
+     {ATOM_TYPE_CC321C, ATOM_TYPE_CC321D, 0.15300000, 186188.00},
+     {ATOM_TYPE_CC321C, ATOM_TYPE_CC311C, 0.15380000, 186188.00},
+     {ATOM_TYPE_CC321, ATOM_TYPE_CC311C, 0.14900000, 186188.00},
+     {ATOM_TYPE_CC321C, ATOM_TYPE_CC311D, 0.15380000, 186188.00},
+     {ATOM_TYPE_CC321D, ATOM_TYPE_CC311C, 0.15380000, 186188.00},
+     {ATOM_TYPE_CC321, ATOM_TYPE_CC2O2, 0.15220000, 167360.00},
+     {ATOM_TYPE_CC3161, ATOM_TYPE_OC311, 0.14100000, 343088.00},
+     {ATOM_TYPE_CC3162, ATOM_TYPE_OC311, 0.14000000, 358150.40},
+     {ATOM_TYPE_CC3062, ATOM_TYPE_OC311, 0.14000000, 358150.40},
+     {ATOM_TYPE_CC301, ATOM_TYPE_OC311, 0.14200000, 358150.40},
+     {ATOM_TYPE_CC311, ATOM_TYPE_OC311, 0.14200000, 358150.40},
+     {ATOM_TYPE_CC312, ATOM_TYPE_OC311, 0.14200000, 334720.00},
+     {ATOM_TYPE_CC311, ATOM_TYPE_OC311M, 0.14200000, 358150.40},
+     {ATOM_TYPE_CC321, ATOM_TYPE_OC311, 0.14200000, 358150.40},
+     {ATOM_TYPE_CC321, ATOM_TYPE_OC311M, 0.14200000, 358150.40},
+     {ATOM_TYPE_CC331, ATOM_TYPE_OC311M, 0.14200000, 358150.40},
+     {ATOM_TYPE_CC322, ATOM_TYPE_OC311, 0.14200000, 334720.00},
+     {ATOM_TYPE_CC2O1, ATOM_TYPE_OC2D1, 0.12300000, 518816.00},
+     {ATOM_TYPE_CC2O2, ATOM_TYPE_OC2D2, 0.12600000, 439320.00},
+     {ATOM_TYPE_CC301, ATOM_TYPE_OC301, 0.14150000, 301248.00},
+     {ATOM_TYPE_CC311, ATOM_TYPE_OC301, 0.14150000, 301248.00},
+     {ATOM_TYPE_CC321, ATOM_TYPE_OC301, 0.14150000, 301248.00},
+     {ATOM_TYPE_CC331, ATOM_TYPE_OC301, 0.14150000, 301248.00},
+     {ATOM_TYPE_CC311D, ATOM_TYPE_OC301, 0.13950000, 301248.00},
+     {ATOM_TYPE_CC3162, ATOM_TYPE_OC301, 0.13950000, 301248.00},
+     {ATOM_TYPE_CC3062, ATOM_TYPE_OC301, 0.13950000, 301248.00},
+     {ATOM_TYPE_CC311D, ATOM_TYPE_OC302, 0.14150000, 301248.00},
+     {ATOM_TYPE_CC3162, ATOM_TYPE_OC302, 0.14150000, 301248.00},
+     {ATOM_TYPE_CC311C, ATOM_TYPE_OC301, 0.14350000, 301248.00},
+     {ATOM_TYPE_CC3161, ATOM_TYPE_OC301, 0.14150000, 301248.00},
+     {ATOM_TYPE_CC321D, ATOM_TYPE_OC3C61, 0.14150000, 301248.00},
+     {ATOM_TYPE_CC311D, ATOM_TYPE_OC3C61, 0.14150000, 301248.00},
+     {ATOM_TYPE_CC3162, ATOM_TYPE_OC3C61, 0.14250000, 301248.00},
+     {ATOM_TYPE_CC3062, ATOM_TYPE_OC3C61, 0.14250000, 301248.00},
+     {ATOM_TYPE_CC321C, ATOM_TYPE_OC3C61, 0.14150000, 301248.00},
+     {ATOM_TYPE_CC311C, ATOM_TYPE_OC3C61, 0.14150000, 301248.00},
+     {ATOM_TYPE_CC3163, ATOM_TYPE_OC3C61, 0.14250000, 301248.00},
+     {ATOM_TYPE_CC3263, ATOM_TYPE_OC3C61, 0.14250000, 301248.00},
+     {ATOM_TYPE_NC2D1, ATOM_TYPE_CC311, 0.14300000, 267776.00},
+     {ATOM_TYPE_NC2D1, ATOM_TYPE_CC3161, 0.14300000, 267776.00},
+     {ATOM_TYPE_NC2D1, ATOM_TYPE_CC331, 0.14300000, 267776.00},
+     {ATOM_TYPE_NC2D1, ATOM_TYPE_CC2O1, 0.13450000, 309616.00},
+     {ATOM_TYPE_CC311, ATOM_TYPE_HCA1, 0.11110000, 258571.20},
+     {ATOM_TYPE_CC312, ATOM_TYPE_HCA1, 0.11110000, 258571.20},
+     {ATOM_TYPE_CC3161, ATOM_TYPE_HCA1, 0.11110000, 258571.20},
+     {ATOM_TYPE_CC3162, ATOM_TYPE_HCA1, 0.11110000, 258571.20},
+     {ATOM_TYPE_CC3163, ATOM_TYPE_HCA1, 0.11110000, 258571.20},
+     {ATOM_TYPE_CC311C, ATOM_TYPE_HCA1, 0.11110000, 258571.20},
+     {ATOM_TYPE_CC311D, ATOM_TYPE_HCA1, 0.11110000, 258571.20},
+     {ATOM_TYPE_CC321, ATOM_TYPE_HCA2, 0.11110000, 258571.20},
+     {ATOM_TYPE_CC322, ATOM_TYPE_HCA2, 0.11110000, 258571.20},
+     {ATOM_TYPE_CC3263, ATOM_TYPE_HCA2, 0.11110000, 258571.20},
+     {ATOM_TYPE_CC331, ATOM_TYPE_HCA3, 0.11110000, 269449.60},
+     {ATOM_TYPE_CC321C, ATOM_TYPE_HCA2, 0.11110000, 258571.20},
+     {ATOM_TYPE_CC321D, ATOM_TYPE_HCA2, 0.11110000, 258571.20},
+     {ATOM_TYPE_CC3261, ATOM_TYPE_HCA2, 0.11110000, 258571.20},
+     {ATOM_TYPE_OC311, ATOM_TYPE_HCP1, 0.09600000, 456056.00},
+     {ATOM_TYPE_OC311M, ATOM_TYPE_HCP1, 0.09600000, 456056.00},
+     {ATOM_TYPE_OC311M, ATOM_TYPE_HCP1M, 0.09600000, 456056.00},
+     {ATOM_TYPE_NC2D1, ATOM_TYPE_HCP1, 0.09970000, 368192.00},
+     {ATOM_TYPE_CC322C, ATOM_TYPE_OC3C5M, 0.14250000, 292880.00},
+     {ATOM_TYPE_CC322C, ATOM_TYPE_CC322C, 0.15180000, 163176.00},
+     {ATOM_TYPE_CC322C, ATOM_TYPE_HCA2C2, 0.11000000, 256897.60},
+     {ATOM_TYPE_CC312C, ATOM_TYPE_CC331, 0.15280000, 186188.00},
+     {ATOM_TYPE_CC312C, ATOM_TYPE_OC3C5M, 0.14250000, 292880.00},
+     {ATOM_TYPE_CC312C, ATOM_TYPE_CC322C, 0.15180000, 163176.00},
+     {ATOM_TYPE_CC312C, ATOM_TYPE_HCA1C2, 0.11000000, 256897.60},
+     {ATOM_TYPE_CC312C, ATOM_TYPE_OC301, 0.13950000, 301248.00},
+     {ATOM_TYPE_OC3C51, ATOM_TYPE_CC3152, 0.14250000, 292880.00},
+     {ATOM_TYPE_OC3C51, ATOM_TYPE_CC3051, 0.14250000, 292880.00},
+     {ATOM_TYPE_OC3C51, ATOM_TYPE_CC3153, 0.14250000, 292880.00},
+     {ATOM_TYPE_OC311, ATOM_TYPE_CC3152, 0.13950000, 358150.40},
+     {ATOM_TYPE_OC311, ATOM_TYPE_CC3051, 0.13950000, 358150.40},
+     {ATOM_TYPE_OC311, ATOM_TYPE_CC3151, 0.13950000, 343088.00},
+     {ATOM_TYPE_CC3152, ATOM_TYPE_HCA1, 0.11110000, 258571.20},
+     {ATOM_TYPE_CC3251, ATOM_TYPE_HCA2, 0.11000000, 256897.60},
+     {ATOM_TYPE_CC3151, ATOM_TYPE_HCA1, 0.11110000, 258571.20},
+     {ATOM_TYPE_CC3153, ATOM_TYPE_HCA1, 0.11110000, 258571.20},
+     {ATOM_TYPE_CC3152, ATOM_TYPE_CC3251, 0.15080000, 163176.00},
+     {ATOM_TYPE_CC3051, ATOM_TYPE_CC3251, 0.15080000, 163176.00},
+     {ATOM_TYPE_CC3251, ATOM_TYPE_CC3151, 0.15080000, 163176.00},
+     {ATOM_TYPE_CC3151, ATOM_TYPE_CC3153, 0.15080000, 163176.00},
+     {ATOM_TYPE_CC3151, ATOM_TYPE_CC3152, 0.15080000, 163176.00},
+     {ATOM_TYPE_CC3151, ATOM_TYPE_CC3051, 0.15080000, 163176.00},
+     {ATOM_TYPE_CC3151, ATOM_TYPE_CC3151, 0.15080000, 163176.00},
+     {ATOM_TYPE_CC3153, ATOM_TYPE_CC321, 0.14900000, 186188.00},
+     {ATOM_TYPE_CC3051, ATOM_TYPE_CC321, 0.14900000, 186188.00},
+     {ATOM_TYPE_CC3152, ATOM_TYPE_OC301, 0.13950000, 301248.00},
+     {ATOM_TYPE_CC321D, ATOM_TYPE_CC311D, 0.15380000, 186188.00},
+     {ATOM_TYPE_CC311D, ATOM_TYPE_CC311D, 0.15380000, 186188.00},
+     {ATOM_TYPE_CC3161, ATOM_TYPE_OC30P, 0.14250000, 301248.00},
+     {ATOM_TYPE_CC311D, ATOM_TYPE_OC30P, 0.14250000, 301248.00},
+     {ATOM_TYPE_CC3162, ATOM_TYPE_OC30P, 0.14250000, 301248.00},
+     {ATOM_TYPE_CC321, ATOM_TYPE_OC30P, 0.14520000, 301248.00},
+     {ATOM_TYPE_OC30P, ATOM_TYPE_PC, 0.16750000, 225936.00},
+     {ATOM_TYPE_OC2DP, ATOM_TYPE_PC, 0.15250000, 485344.00},
+     {ATOM_TYPE_OC312, ATOM_TYPE_PC, 0.16100000, 198321.60},
+     {ATOM_TYPE_OC312, ATOM_TYPE_HCP1, 0.09600000, 456056.00},
+     {ATOM_TYPE_SC, ATOM_TYPE_OC2DP, 0.14480000, 451872.00},
+     {ATOM_TYPE_SC, ATOM_TYPE_OC30P, 0.16100000, 209200.00},
+     {ATOM_TYPE_CC312D, ATOM_TYPE_OC301, 0.13950000, 301248.00},
+     {ATOM_TYPE_CC312D, ATOM_TYPE_OC3C5M, 0.14250000, 292880.00},
+     {ATOM_TYPE_CC312D, ATOM_TYPE_CC322C, 0.15180000, 163176.00},
+     {ATOM_TYPE_CC312D, ATOM_TYPE_HCA1, 0.11000000, 256897.60},
+     {ATOM_TYPE_CC312D, ATOM_TYPE_OC302, 0.14250000, 301248.00},
+     {ATOM_TYPE_CC312C, ATOM_TYPE_HCA1, 0.11000000, 256897.60},
+     {ATOM_TYPE_CC312C, ATOM_TYPE_CC321, 0.15000000, 186188.00},
+     {ATOM_TYPE_CC331, ATOM_TYPE_OC303, 0.14150000, 301248.00},
+     {ATOM_TYPE_CC312C, ATOM_TYPE_OC303, 0.14250000, 301248.00},
+     {ATOM_TYPE_CC311D, ATOM_TYPE_OC303, 0.13950000, 301248.00},
+     {ATOM_TYPE_CC3051, ATOM_TYPE_OC302, 0.14250000, 301248.00},
+     {ATOM_TYPE_CC3162, ATOM_TYPE_OC303, 0.13950000, 301248.00},
+     {ATOM_TYPE_OC303, ATOM_TYPE_CC3151, 0.14250000, 301248.00},
+     {ATOM_TYPE_OC301, ATOM_TYPE_CC3051, 0.13950000, 301248.00},
+     {ATOM_TYPE_CN8, ATOM_TYPE_NN6, 0.14800000, 167360.00},
+     {ATOM_TYPE_NN6, ATOM_TYPE_HN1, 0.10400000, 337230.40},
+     {ATOM_TYPE_ON6, ATOM_TYPE_CN8B, 0.14200000, 217568.00},
+     {ATOM_TYPE_CN8, ATOM_TYPE_CN8B, 0.15280000, 186188.00},
+     {ATOM_TYPE_CN1, ATOM_TYPE_CN3, 0.14090000, 252713.60},
+     {ATOM_TYPE_CN1, ATOM_TYPE_CN3T, 0.14030000, 252713.60},
+     {ATOM_TYPE_CN1, ATOM_TYPE_CN5G, 0.13600000, 252713.60},
+     {ATOM_TYPE_CN1, ATOM_TYPE_NN2, 0.13670000, 317984.00},
+     {ATOM_TYPE_CN1T, ATOM_TYPE_NN2B, 0.13480000, 252713.60},
+     {ATOM_TYPE_CN1, ATOM_TYPE_NN2G, 0.13960000, 284512.00},
+     {ATOM_TYPE_CN1, ATOM_TYPE_NN2U, 0.13890000, 284512.00},
+     {ATOM_TYPE_CN1T, ATOM_TYPE_NN2U, 0.13830000, 284512.00},
+     {ATOM_TYPE_CN1, ATOM_TYPE_NN3, 0.13350000, 292880.00},
+     {ATOM_TYPE_CN1T, ATOM_TYPE_ON1, 0.12300000, 719648.00},
+     {ATOM_TYPE_CN1, ATOM_TYPE_ON1, 0.12340000, 552288.00},
+     {ATOM_TYPE_CN1, ATOM_TYPE_ON1C, 0.12450000, 518816.00},
+     {ATOM_TYPE_CN2, ATOM_TYPE_CN3, 0.14060000, 267776.00},
+     {ATOM_TYPE_CN2, ATOM_TYPE_CN5, 0.13580000, 301248.00},
+     {ATOM_TYPE_CN2, ATOM_TYPE_NN1, 0.13660000, 301248.00},
+     {ATOM_TYPE_CN2, ATOM_TYPE_NN2G, 0.13920000, 334720.00},
+     {ATOM_TYPE_CN2, ATOM_TYPE_NN3, 0.13430000, 376560.00},
+     {ATOM_TYPE_CN2, ATOM_TYPE_NN3A, 0.13420000, 334720.00},
+     {ATOM_TYPE_CN2, ATOM_TYPE_NN3G, 0.13260000, 267776.00},
+     {ATOM_TYPE_CN3, ATOM_TYPE_CN3, 0.13260000, 418400.00},
+     {ATOM_TYPE_CN3, ATOM_TYPE_CN3T, 0.13200000, 468608.00},
+     {ATOM_TYPE_CN3T, ATOM_TYPE_CN9, 0.14780000, 192464.00},
+     {ATOM_TYPE_CN3, ATOM_TYPE_HN3, 0.10900000, 292880.00},
+     {ATOM_TYPE_CN3T, ATOM_TYPE_HN3, 0.10900000, 292880.00},
+     {ATOM_TYPE_CN3, ATOM_TYPE_NN2, 0.13430000, 252713.60},
+     {ATOM_TYPE_CN3, ATOM_TYPE_NN2B, 0.13430000, 267776.00},
+     {ATOM_TYPE_CN4, ATOM_TYPE_HN3, 0.10900000, 317984.00},
+     {ATOM_TYPE_CN4, ATOM_TYPE_NN2, 0.13740000, 267776.00},
+     {ATOM_TYPE_CN4, ATOM_TYPE_NN2B, 0.13780000, 251040.00},
+     {ATOM_TYPE_CN4, ATOM_TYPE_NN3A, 0.13220000, 351456.00},
+     {ATOM_TYPE_CN4, ATOM_TYPE_NN4, 0.13050000, 334720.00},
+     {ATOM_TYPE_CN5, ATOM_TYPE_CN5, 0.13610000, 259408.00},
+     {ATOM_TYPE_CN5, ATOM_TYPE_CN5G, 0.13500000, 267776.00},
+     {ATOM_TYPE_CN5, ATOM_TYPE_NN2, 0.13750000, 251040.00},
+     {ATOM_TYPE_CN5, ATOM_TYPE_NN2B, 0.13750000, 252713.60},
+     {ATOM_TYPE_CN5, ATOM_TYPE_NN3A, 0.13120000, 292880.00},
+     {ATOM_TYPE_CN5, ATOM_TYPE_NN3G, 0.13150000, 292880.00},
+     {ATOM_TYPE_CN5, ATOM_TYPE_NN4, 0.13550000, 259408.00},
+     {ATOM_TYPE_CN5G, ATOM_TYPE_NN4, 0.13650000, 259408.00},
+     {ATOM_TYPE_CN8, ATOM_TYPE_CN8, 0.15280000, 186188.00},
+     {ATOM_TYPE_CN8, ATOM_TYPE_CN9, 0.15280000, 186188.00},
+     {ATOM_TYPE_CN8, ATOM_TYPE_NN2, 0.14600000, 334720.00},
+     {ATOM_TYPE_CN8, ATOM_TYPE_ON5, 0.14200000, 358150.40},
+     {ATOM_TYPE_CN9, ATOM_TYPE_HN9, 0.11110000, 269449.60},
+     {ATOM_TYPE_CN9, ATOM_TYPE_ON2, 0.14300000, 284512.00},
+     {ATOM_TYPE_HN1, ATOM_TYPE_NN1, 0.10000000, 408358.40},
+     {ATOM_TYPE_HN2, ATOM_TYPE_NN2, 0.10100000, 396643.20},
+     {ATOM_TYPE_HN2, ATOM_TYPE_NN2B, 0.10100000, 396643.20},
+     {ATOM_TYPE_HN2, ATOM_TYPE_NN2G, 0.10100000, 394132.80},
+     {ATOM_TYPE_HN2, ATOM_TYPE_NN2U, 0.10100000, 396643.20},
+     {ATOM_TYPE_HN4, ATOM_TYPE_ON4, 0.09600000, 456056.00},
+     {ATOM_TYPE_ON2, ATOM_TYPE_P, 0.16000000, 225936.00},
+     {ATOM_TYPE_ON2, ATOM_TYPE_P2, 0.16000000, 225936.00},
+     {ATOM_TYPE_ON3, ATOM_TYPE_P, 0.14800000, 485344.00},
+     {ATOM_TYPE_ON3, ATOM_TYPE_P2, 0.14800000, 485344.00},
+     {ATOM_TYPE_ON4, ATOM_TYPE_P, 0.15800000, 198321.60},
+     {ATOM_TYPE_ON4, ATOM_TYPE_P2, 0.15800000, 198321.60},
+     {ATOM_TYPE_CN7B, ATOM_TYPE_ON6, 0.14200000, 217568.00},
+     {ATOM_TYPE_CN7B, ATOM_TYPE_CN8, 0.15180000, 167360.00},
+     {ATOM_TYPE_CN7, ATOM_TYPE_ON6, 0.14460000, 200832.00},
+     {ATOM_TYPE_CN7, ATOM_TYPE_CN7, 0.15290000, 186188.00},
+     {ATOM_TYPE_CN7, ATOM_TYPE_CN8, 0.15160000, 186188.00},
+     {ATOM_TYPE_CN7, ATOM_TYPE_CN9, 0.15160000, 186188.00},
+     {ATOM_TYPE_CN7, ATOM_TYPE_HN7, 0.11110000, 258571.20},
+     {ATOM_TYPE_CN8, ATOM_TYPE_HN8, 0.11110000, 258571.20},
+     {ATOM_TYPE_CN7B, ATOM_TYPE_HN7, 0.11110000, 258571.20},
+     {ATOM_TYPE_CN7B, ATOM_TYPE_ON6B, 0.14200000, 217568.00},
+     {ATOM_TYPE_CN7, ATOM_TYPE_ON6B, 0.14800000, 200832.00},
+     {ATOM_TYPE_CN7B, ATOM_TYPE_CN7B, 0.14500000, 167360.00},
+     {ATOM_TYPE_CN7, ATOM_TYPE_CN7B, 0.14600000, 186188.00},
+     {ATOM_TYPE_CN7, ATOM_TYPE_CN8B, 0.15120000, 186188.00},
+     {ATOM_TYPE_CN8B, ATOM_TYPE_ON2, 0.14400000, 267776.00},
+     {ATOM_TYPE_CN8B, ATOM_TYPE_ON5, 0.14200000, 358150.40},
+     {ATOM_TYPE_CN7, ATOM_TYPE_ON2, 0.14330000, 259408.00},
+     {ATOM_TYPE_CN7B, ATOM_TYPE_ON2, 0.14330000, 259408.00},
+     {ATOM_TYPE_CN7, ATOM_TYPE_ON5, 0.14200000, 358150.40},
+     {ATOM_TYPE_CN9, ATOM_TYPE_NN2, 0.14560000, 334720.00},
+     {ATOM_TYPE_CN8, ATOM_TYPE_NN2B, 0.14580000, 334720.00},
+     {ATOM_TYPE_CN9, ATOM_TYPE_NN2B, 0.14580000, 334720.00},
+     {ATOM_TYPE_CN7B, ATOM_TYPE_NN2, 0.14560000, 184096.00},
+     {ATOM_TYPE_CN7B, ATOM_TYPE_NN2B, 0.14580000, 184096.00},
+     {ATOM_TYPE_CN8B, ATOM_TYPE_HN8, 0.11110000, 258571.20},
+     {ATOM_TYPE_ON5, ATOM_TYPE_HN5, 0.09600000, 456056.00},
+     {ATOM_TYPE_CN7B, ATOM_TYPE_ON5, 0.14000000, 358150.40},
+     {ATOM_TYPE_CN8, ATOM_TYPE_ON2, 0.14400000, 284512.00},
+     {ATOM_TYPE_CTL3, ATOM_TYPE_CL, 0.15220000, 167360.00},
+     {ATOM_TYPE_CTL2, ATOM_TYPE_CL, 0.15220000, 167360.00},
+     {ATOM_TYPE_CTL1, ATOM_TYPE_CL, 0.15220000, 167360.00},
+     {ATOM_TYPE_CTL1, ATOM_TYPE_CCL, 0.15220000, 167360.00},
+     {ATOM_TYPE_OBL, ATOM_TYPE_CL, 0.12200000, 627600.00},
+     {ATOM_TYPE_OCL, ATOM_TYPE_CL, 0.12600000, 439320.00},
+     {ATOM_TYPE_OCL, ATOM_TYPE_CCL, 0.12600000, 439320.00},
+     {ATOM_TYPE_OSL, ATOM_TYPE_CL, 0.13340000, 125520.00},
+     {ATOM_TYPE_OSLP, ATOM_TYPE_CL, 0.13340000, 125520.00},
+     {ATOM_TYPE_OHL, ATOM_TYPE_CL, 0.14000000, 192464.00},
+     {ATOM_TYPE_HOL, ATOM_TYPE_OHL, 0.09600000, 456056.00},
+     {ATOM_TYPE_CTL1, ATOM_TYPE_HAL1, 0.11110000, 258571.20},
+     {ATOM_TYPE_CTL1, ATOM_TYPE_HBL, 0.10800000, 276144.00},
+     {ATOM_TYPE_CTL2, ATOM_TYPE_HAL2, 0.11110000, 258571.20},
+     {ATOM_TYPE_CTL3, ATOM_TYPE_HAL3, 0.11110000, 269449.60},
+     {ATOM_TYPE_CTL3, ATOM_TYPE_OSL, 0.14300000, 284512.00},
+     {ATOM_TYPE_CTL2, ATOM_TYPE_OSL, 0.14300000, 284512.00},
+     {ATOM_TYPE_CTL1, ATOM_TYPE_OSL, 0.14300000, 284512.00},
+     {ATOM_TYPE_CTL3, ATOM_TYPE_OSLP, 0.14300000, 284512.00},
+     {ATOM_TYPE_CTL2, ATOM_TYPE_OSLP, 0.14300000, 284512.00},
+     {ATOM_TYPE_CTL1, ATOM_TYPE_OSLP, 0.14300000, 284512.00},
+     {ATOM_TYPE_OSL, ATOM_TYPE_PL, 0.16000000, 225936.00},
+     {ATOM_TYPE_OSLP, ATOM_TYPE_PL, 0.16000000, 225936.00},
+     {ATOM_TYPE_O2L, ATOM_TYPE_PL, 0.14800000, 485344.00},
+     {ATOM_TYPE_OHL, ATOM_TYPE_PL, 0.15900000, 198321.60},
+     {ATOM_TYPE_NH3L, ATOM_TYPE_HCL, 0.10400000, 343088.00},
+     {ATOM_TYPE_NH3L, ATOM_TYPE_CTL1, 0.14800000, 167360.00},
+     {ATOM_TYPE_NH3L, ATOM_TYPE_CTL2, 0.15100000, 218404.80},
+     {ATOM_TYPE_NTL, ATOM_TYPE_CTL2, 0.15100000, 179912.00},
+     {ATOM_TYPE_NTL, ATOM_TYPE_CTL5, 0.15100000, 179912.00},
+     {ATOM_TYPE_CTL5, ATOM_TYPE_HL, 0.10800000, 251040.00},
+     {ATOM_TYPE_CTL2, ATOM_TYPE_HL, 0.10800000, 251040.00},
+     {ATOM_TYPE_CTL1, ATOM_TYPE_CTL1, 0.15000000, 186188.00},
+     {ATOM_TYPE_CTL1, ATOM_TYPE_CTL2, 0.15380000, 186188.00},
+     {ATOM_TYPE_CTL1, ATOM_TYPE_CTL3, 0.15380000, 186188.00},
+     {ATOM_TYPE_CTL2, ATOM_TYPE_CTL2, 0.15300000, 186188.00},
+     {ATOM_TYPE_CTL2, ATOM_TYPE_CTL3, 0.15280000, 186188.00},
+     {ATOM_TYPE_CTL3, ATOM_TYPE_CTL3, 0.15300000, 186188.00},
+     {ATOM_TYPE_OHL, ATOM_TYPE_CTL1, 0.14200000, 358150.40},
+     {ATOM_TYPE_OHL, ATOM_TYPE_CTL2, 0.14200000, 358150.40},
+     {ATOM_TYPE_OHL, ATOM_TYPE_CTL3, 0.14200000, 358150.40},
+     {ATOM_TYPE_SL, ATOM_TYPE_O2L, 0.14480000, 451872.00},
+     {ATOM_TYPE_SL, ATOM_TYPE_OSL, 0.15750000, 209200.00},
+     {ATOM_TYPE_CEL2, ATOM_TYPE_CEL2, 0.13300000, 426768.00},
+     {ATOM_TYPE_HEL2, ATOM_TYPE_CEL2, 0.11000000, 305432.00},
+     {ATOM_TYPE_CEL1, ATOM_TYPE_CTL3, 0.15040000, 320494.40},
+     {ATOM_TYPE_CEL1, ATOM_TYPE_CEL2, 0.13420000, 418400.00},
+     {ATOM_TYPE_HEL1, ATOM_TYPE_CEL1, 0.11000000, 301666.40},
+     {ATOM_TYPE_CEL1, ATOM_TYPE_CTL2, 0.15020000, 305432.00},
+     {ATOM_TYPE_CEL1, ATOM_TYPE_CEL1, 0.13400000, 368192.00},
+     {ATOM_TYPE_CC31A, ATOM_TYPE_HCA1A, 0.11110000, 258571.20},
+     {ATOM_TYPE_CC32A, ATOM_TYPE_HCA2A, 0.11110000, 258571.20},
+     {ATOM_TYPE_CC33A, ATOM_TYPE_HCA3A, 0.11110000, 269449.60},
+     {ATOM_TYPE_CC30A, ATOM_TYPE_CC32A, 0.15380000, 186188.00},
+     {ATOM_TYPE_CC30A, ATOM_TYPE_CC33A, 0.15380000, 186188.00},
+     {ATOM_TYPE_CC31A, ATOM_TYPE_CC31A, 0.15000000, 186188.00},
+     {ATOM_TYPE_CC31A, ATOM_TYPE_CC32A, 0.15380000, 186188.00},
+     {ATOM_TYPE_CC31A, ATOM_TYPE_CC33A, 0.15380000, 186188.00},
+     {ATOM_TYPE_CC32A, ATOM_TYPE_CC32A, 0.15300000, 186188.00},
+     {ATOM_TYPE_CC32A, ATOM_TYPE_CC33A, 0.15280000, 186188.00},
+     {ATOM_TYPE_CC33A, ATOM_TYPE_CC33A, 0.15300000, 186188.00},
+     {ATOM_TYPE_CC325A, ATOM_TYPE_CC325A, 0.15480000, 163176.00},
+     {ATOM_TYPE_CC325A, ATOM_TYPE_HCA25A, 0.11160000, 256897.60},
+     {ATOM_TYPE_CC325B, ATOM_TYPE_OC305A, 0.14250000, 292880.00},
+     {ATOM_TYPE_CC325B, ATOM_TYPE_CC325B, 0.15180000, 163176.00},
+     {ATOM_TYPE_CC325B, ATOM_TYPE_HCA25A, 0.11000000, 256897.60},
+     {ATOM_TYPE_CC325B, ATOM_TYPE_CC33A, 0.15280000, 186188.00},
+     {ATOM_TYPE_CC32A, ATOM_TYPE_OC30A, 0.14150000, 301248.00},
+     {ATOM_TYPE_CC33A, ATOM_TYPE_OC30A, 0.14150000, 301248.00},
+     {ATOM_TYPE_CC326A, ATOM_TYPE_HCA2A, 0.11110000, 258571.20},
+     {ATOM_TYPE_CC326A, ATOM_TYPE_CC326A, 0.15300000, 186188.00},
+     {ATOM_TYPE_CC326A, ATOM_TYPE_OC30A, 0.14150000, 301248.00},
+     {ATOM_TYPE_C, ATOM_TYPE_C, 0.13350000, 502080.00},
+     {ATOM_TYPE_CST, ATOM_TYPE_OST, 0.11600000, 784884.93},
+     {ATOM_TYPE_SS, ATOM_TYPE_FE, 0.23200000, 209200.00},
+     {ATOM_TYPE_CPB, ATOM_TYPE_CE1, 0.13800000, 376560.00},
+     {ATOM_TYPE_CPB, ATOM_TYPE_CPA, 0.14432000, 250872.64},
+     {ATOM_TYPE_CPB, ATOM_TYPE_CPB, 0.13464000, 285097.76},
+     {ATOM_TYPE_CPM, ATOM_TYPE_CPA, 0.13716000, 301248.00},
+     {ATOM_TYPE_CT2, ATOM_TYPE_CPB, 0.14900000, 192464.00},
+     {ATOM_TYPE_CT3, ATOM_TYPE_CPB, 0.14900000, 192464.00},
+     {ATOM_TYPE_FE, ATOM_TYPE_CM, 0.19000000, 215894.40},
+     {ATOM_TYPE_FE, ATOM_TYPE_CPM, 0.33814000, 0.00},
+     {ATOM_TYPE_HA, ATOM_TYPE_CPM, 0.10900000, 307607.68},
+     {ATOM_TYPE_NPH, ATOM_TYPE_CPA, 0.13757000, 315640.96},
+     {ATOM_TYPE_NPH, ATOM_TYPE_FE, 0.19580000, 226103.36},
+     {ATOM_TYPE_NR2, ATOM_TYPE_FE, 0.22000000, 54392.00},
+     {ATOM_TYPE_OM, ATOM_TYPE_CM, 0.11280000, 933032.00},
+     {ATOM_TYPE_OM, ATOM_TYPE_FE, 0.18000000, 209200.00},
+     {ATOM_TYPE_OM, ATOM_TYPE_OM, 0.12300000, 502080.00},
+     {ATOM_TYPE_CEL1, ATOM_TYPE_CTL1, 0.15020000, 200832.00},
+     {ATOM_TYPE_CTL1, ATOM_TYPE_CRL1, 0.15000000, 186188.00},
+     {ATOM_TYPE_CRL1, ATOM_TYPE_CRL1, 0.15000000, 186188.00},
+     {ATOM_TYPE_CRL1, ATOM_TYPE_CTL2, 0.15380000, 186188.00},
+     {ATOM_TYPE_CRL1, ATOM_TYPE_CRL2, 0.15380000, 186188.00},
+     {ATOM_TYPE_CTL1, ATOM_TYPE_CRL2, 0.15380000, 186188.00},
+     {ATOM_TYPE_CRL2, ATOM_TYPE_CRL2, 0.15300000, 186188.00},
+     {ATOM_TYPE_CTL2, ATOM_TYPE_CRL2, 0.15300000, 186188.00},
+     {ATOM_TYPE_CRL1, ATOM_TYPE_HGA1, 0.11110000, 258571.20},
+     {ATOM_TYPE_CRL2, ATOM_TYPE_HGA2, 0.11110000, 258571.20},
+     {ATOM_TYPE_OHL, ATOM_TYPE_CRL1, 0.14200000, 358150.40},
+     {ATOM_TYPE_CRL1, ATOM_TYPE_CTL3, 0.15380000, 186188.00},
+     {ATOM_TYPE_CEL1, ATOM_TYPE_CRL2, 0.15020000, 305432.00},
+     {ATOM_TYPE_CEL1, ATOM_TYPE_CRL1, 0.15020000, 200832.00},
+};
+
+} // End namespace charmm_parameters
+
+#endif
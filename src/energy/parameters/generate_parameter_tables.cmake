@@ -0,0 +1,292 @@
+# generate_parameter_tables.cmake --- Generate typed C++ parameter tables from the .itp files
+# Copyright (C) 2026 agent
+#
+# This file is part of Phaistos
+#
+# Phaistos is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# Phaistos is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with Phaistos.  If not, see <http://www.gnu.org/licenses/>.
+#
+# Usage: cmake -Doutput_dir=<dir> -P generate_parameter_tables.cmake
+#
+# Writes <dir>/parameters/atom_types.h, with an ID for every atom type name
+# occurring in the parameter files, and one <dir>/parameters/*_parameters.h
+# header per .itp file, with the parameters as a static array of records in
+# which atom types are IDs. The tables in src/energy/parameters are generated
+# with output_dir=src/energy and committed. The charmm_parameter_tables target
+# generates them in the build directory and checks that they are identical.
+
+cmake_minimum_required(VERSION 3.4)
+
+set(parameter_dir ${CMAKE_CURRENT_LIST_DIR})
+
+if (NOT output_dir)
+  message(FATAL_ERROR "generate_parameter_tables.cmake: output_dir is not set")
+endif()
+set(table_dir ${output_dir}/parameters)
+
+set(license_header
+"//
+// This file is part of Phaistos
+//
+// Phaistos is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Phaistos is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Phaistos.  If not, see <http://www.gnu.org/licenses/>.
+//
+")
+
+
+# Read the non-comment lines of an .itp file.
+# Fields are separated by '|' in the returned list of lines.
+function(read_itp itp_file result)
+
+  file(READ ${parameter_dir}/${itp_file} content)
+
+  # Remove comments (this also removes all ';', which separate CMake list elements)
+  string(REGEX REPLACE ";[^\n]*" "" content "${content}")
+
+  string(REPLACE "\n" ";" lines "${content}")
+
+  set(rows "")
+  foreach(line ${lines})
+    string(STRIP "${line}" line)
+    if (NOT line STREQUAL "")
+      string(REGEX REPLACE "[ \t]+" "|" line "${line}")
+      list(APPEND rows "${line}")
+    endif()
+  endforeach()
+
+  set(${result} "${rows}" PARENT_SCOPE)
+endfunction()
+
+
+# Field specifications are "c++-type:name:column" where column is the column
+# of the .itp file the field is read from. The type "atom_type" denotes an
+# atom type ID, "string" a string constant.
+#
+# Each table is given as: itp file, header, record struct, array name,
+# name of the size constant, description, field specifications.
+
+set(table_torsion
+  torsion.itp torsion_parameters.h TorsionRecord torsion_parameters N_TORSION_PARAMETERS
+  "Torsion parameters (from torsion.itp)"
+  atom_type:type1:0 atom_type:type2:1 atom_type:type3:2 atom_type:type4:3
+  double:phi0:5 double:cp:6 "unsigned int:mult:7")
+
+set(table_improper_torsion
+  imptor.itp imptor_parameters.h ImproperTorsionRecord improper_torsion_parameters N_IMPROPER_TORSION_PARAMETERS
+  "Improper torsion parameters (from imptor.itp)"
+  atom_type:type1:0 atom_type:type2:1 atom_type:type3:2 atom_type:type4:3
+  double:phi0:5 double:cp:6)
+
+set(table_bond_stretch
+  bond_stretch.itp bond_stretch_parameters.h BondStretchRecord bond_stretch_parameters N_BOND_STRETCH_PARAMETERS
+  "Bond-stretch parameters (from bond_stretch.itp)"
+  atom_type:type1:0 atom_type:type2:1 double:r0:3 double:kb:4)
+
+set(table_angle_bend
+  angle_bend.itp angle_bend_parameters.h AngleBendRecord angle_bend_parameters N_ANGLE_BEND_PARAMETERS
+  "Angle-bend and Urey-Bradley parameters (from angle_bend.itp)"
+  atom_type:type1:0 atom_type:type2:1 atom_type:type3:2
+  double:theta0:4 double:k0:5 double:r13:6 double:kub:7)
+
+set(table_non_bonded
+  vdw.itp vdw_parameters.h NonBondedRecord non_bonded_parameters N_NON_BONDED_PARAMETERS
+  "Non-bonded parameters (from vdw.itp)"
+  atom_type:atom_type:0 "unsigned int:atom_number:1" double:atom_mass:2
+  string:atom_ptype:4 double:sigma:5 double:epsilon:6)
+
+set(table_non_bonded_14
+  vdw14.itp vdw14_parameters.h NonBonded14Record non_bonded_14_parameters N_NON_BONDED_14_PARAMETERS
+  "Non-bonded 1-4 parameters (from vdw14.itp)"
+  atom_type:atom_type1:0 atom_type:atom_type2:1 "unsigned int:pair_function:2"
+  double:sigma:3 double:epsilon:4)
+
+set(tables table_torsion table_improper_torsion table_bond_stretch
+           table_angle_bend table_non_bonded table_non_bonded_14)
+
+
+# Collect all atom type names
+set(atom_type_names "")
+foreach(table ${tables})
+  set(spec ${${table}})
+  list(GET spec 0 itp_file)
+  list(REMOVE_AT spec 0 1 2 3 4 5)
+  read_itp(${itp_file} rows)
+  foreach(row ${rows})
+    string(REPLACE "|" ";" fields "${row}")
+    foreach(field_spec ${spec})
+      string(REPLACE ":" ";" field_spec "${field_spec}")
+      list(GET field_spec 0 field_type)
+      list(GET field_spec 2 column)
+      if (field_type STREQUAL "atom_type")
+        list(GET fields ${column} value)
+        list(APPEND atom_type_names ${value})
+      endif()
+    endforeach()
+  endforeach()
+endforeach()
+list(REMOVE_DUPLICATES atom_type_names)
+list(SORT atom_type_names)
+list(LENGTH atom_type_names n_atom_types)
+
+
+# Write atom_types.h
+set(out "// atom_types.h --- IDs of the atom types in the CHARMM parameter files
+// Generated by generate_parameter_tables.cmake from the .itp files. Do not edit.
+// Copyright (C) 2026 agent
+${license_header}
+#ifndef TERM_CHARMM_ATOM_TYPES_H
+#define TERM_CHARMM_ATOM_TYPES_H
+
+#include <string>
+#include <cstring>
+#include <algorithm>
+
+namespace charmm_parameters {
+
+//! IDs of the atom types. The IDs follow the sorted atom type names.
+//! ATOM_TYPE_X is the wildcard type.
+enum AtomTypeId {
+")
+set(id 0)
+foreach(name ${atom_type_names})
+  string(APPEND out "     ATOM_TYPE_${name} = ${id},\n")
+  math(EXPR id "${id} + 1")
+endforeach()
+string(APPEND out "     N_ATOM_TYPES = ${n_atom_types}
+};
+
+//! Atom type names, indexed by ID
+const char *const atom_type_names[N_ATOM_TYPES] = {
+")
+foreach(name ${atom_type_names})
+  string(APPEND out "     \"${name}\",\n")
+endforeach()
+string(APPEND out "};
+
+//! Order of atom type names
+inline bool atom_type_name_less(const char *name1, const char *name2) {
+     return std::strcmp(name1, name2) < 0;
+}
+
+//! ID of an atom type name
+//! \\param name Atom type name
+//! \\return ID of the atom type (N_ATOM_TYPES if the type does not occur in the parameter files)
+inline unsigned int get_atom_type_id(const std::string &name) {
+
+     const char *const *end = atom_type_names + N_ATOM_TYPES;
+     const char *const *it = std::lower_bound(atom_type_names, end, name.c_str(), atom_type_name_less);
+
+     if (it == end || name != *it)
+          return N_ATOM_TYPES;
+     return it - atom_type_names;
+}
+
+} // End namespace charmm_parameters
+
+#endif
+")
+file(WRITE ${table_dir}/atom_types.h "${out}")
+
+
+# Write one header per table
+foreach(table ${tables})
+
+  set(spec ${${table}})
+  list(GET spec 0 itp_file)
+  list(GET spec 1 header)
+  list(GET spec 2 record)
+  list(GET spec 3 array)
+  list(GET spec 4 size_constant)
+  list(GET spec 5 description)
+  list(REMOVE_AT spec 0 1 2 3 4 5)
+
+  read_itp(${itp_file} rows)
+  list(LENGTH rows n_rows)
+
+  string(TOUPPER ${header} guard)
+  string(REPLACE "." "_" guard ${guard})
+
+  set(out "// ${header} --- Typed table of the parameters in ${itp_file}
+// Generated by generate_parameter_tables.cmake from ${itp_file}. Do not edit.
+// Copyright (C) 2026 agent
+// Copyright (c) 1991-2000, University of Groningen, The Netherlands.
+// Copyright (c) 2001-2004, The GROMACS development team,
+${license_header}
+#ifndef TERM_CHARMM_${guard}
+#define TERM_CHARMM_${guard}
+
+#include \"atom_types.h\"
+
+namespace charmm_parameters {
+
+//! ${description}
+struct ${record} {
+")
+  foreach(field_spec ${spec})
+    string(REPLACE ":" ";" field_spec "${field_spec}")
+    list(GET field_spec 0 field_type)
+    list(GET field_spec 1 field_name)
+    if (field_type STREQUAL "atom_type")
+      set(field_type "AtomTypeId")
+    elseif (field_type STREQUAL "string")
+      set(field_type "const char *")
+    endif()
+    string(APPEND out "     ${field_type} ${field_name};\n")
+  endforeach()
+  string(APPEND out "};
+
+//! Number of entries in ${array}
+const unsigned int ${size_constant} = ${n_rows};
+
+//! ${description}
+const ${record} ${array}[${size_constant}] = {
+")
+
+  foreach(row ${rows})
+    string(REPLACE "|" ";" fields "${row}")
+    set(values "")
+    foreach(field_spec ${spec})
+      string(REPLACE ":" ";" field_spec "${field_spec}")
+      list(GET field_spec 0 field_type)
+      list(GET field_spec 2 column)
+      list(GET fields ${column} value)
+      if (field_type STREQUAL "atom_type")
+        set(value "ATOM_TYPE_${value}")
+      elseif (field_type STREQUAL "string")
+        set(value "\"${value}\"")
+      endif()
+      list(APPEND values "${value}")
+    endforeach()
+    string(REPLACE ";" ", " values "${values}")
+    string(APPEND out "     {${values}},\n")
+  endforeach()
+
+  string(APPEND out "};
+
+} // End namespace charmm_parameters
+
+#endif
+")
+  file(WRITE ${table_dir}/${header} "${out}")
+
+endforeach()
@@ -0,0 +1,234 @@
+// imptor_parameters.h --- Typed table of the parameters in imptor.itp
+// Generated by generate_parameter_tables.cmake from imptor.itp. Do not edit.
+// Copyright (C) 2026 agent
+// Copyright (c) 1991-2000, University of Groningen, The Netherlands.
+// Copyright (c) 2001-2004, The GROMACS development team,
+//
+// This file is part of Phaistos
+//
+// Phaistos is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Phaistos is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Phaistos.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+#ifndef TERM_CHARMM_IMPTOR_PARAMETERS_H
+#define TERM_CHARMM_IMPTOR_PARAMETERS_H
+
+#include "atom_types.h"
+
+namespace charmm_parameters {
+
+//! Improper torsion parameters (from imptor.itp)
+struct ImproperTorsionRecord {
+     AtomTypeId type1;
+     AtomTypeId type2;
+     AtomTypeId type3;
+     AtomTypeId type4;
+     double phi0;
+     double cp;
+};
+
+//! Number of entries in improper_torsion_parameters
+const unsigned int N_IMPROPER_TORSION_PARAMETERS = 185;
+
+//! Improper torsion parameters (from imptor.itp)
+const ImproperTorsionRecord improper_torsion_parameters[N_IMPROPER_TORSION_PARAMETERS] = {
+     {ATOM_TYPE_HE2, ATOM_TYPE_HE2, ATOM_TYPE_CE2, ATOM_TYPE_CE2, 0.000000, 25.104000},
+     {ATOM_TYPE_HR1, ATOM_TYPE_NR1, ATOM_TYPE_NR2, ATOM_TYPE_CPH2, 0.000000, 4.184000},
+     {ATOM_TYPE_HR1, ATOM_TYPE_NR2, ATOM_TYPE_NR1, ATOM_TYPE_CPH2, 0.000000, 4.184000},
+     {ATOM_TYPE_HR3, ATOM_TYPE_CPH1, ATOM_TYPE_NR1, ATOM_TYPE_CPH1, 0.000000, 4.184000},
+     {ATOM_TYPE_HR3, ATOM_TYPE_CPH1, ATOM_TYPE_NR2, ATOM_TYPE_CPH1, 0.000000, 4.184000},
+     {ATOM_TYPE_HR3, ATOM_TYPE_CPH1, ATOM_TYPE_NR3, ATOM_TYPE_CPH1, 0.000000, 8.368000},
+     {ATOM_TYPE_HR3, ATOM_TYPE_NR1, ATOM_TYPE_CPH1, ATOM_TYPE_CPH1, 0.000000, 4.184000},
+     {ATOM_TYPE_HR3, ATOM_TYPE_NR2, ATOM_TYPE_CPH1, ATOM_TYPE_CPH1, 0.000000, 4.184000},
+     {ATOM_TYPE_N, ATOM_TYPE_C, ATOM_TYPE_CP1, ATOM_TYPE_CP3, 0.000000, 0.000000},
+     {ATOM_TYPE_C, ATOM_TYPE_HC, ATOM_TYPE_HC, ATOM_TYPE_NC2, 0.000000, 0.000000},
+     {ATOM_TYPE_NR1, ATOM_TYPE_CPH1, ATOM_TYPE_CPH2, ATOM_TYPE_H, 0.000000, 3.765600},
+     {ATOM_TYPE_NR1, ATOM_TYPE_CPH2, ATOM_TYPE_CPH1, ATOM_TYPE_H, 0.000000, 3.765600},
+     {ATOM_TYPE_NR3, ATOM_TYPE_CPH1, ATOM_TYPE_CPH2, ATOM_TYPE_H, 0.000000, 10.041600},
+     {ATOM_TYPE_NR3, ATOM_TYPE_CPH2, ATOM_TYPE_CPH1, ATOM_TYPE_H, 0.000000, 10.041600},
+     {ATOM_TYPE_O, ATOM_TYPE_CP1, ATOM_TYPE_NH2, ATOM_TYPE_CC, 0.000000, 376.560000},
+     {ATOM_TYPE_O, ATOM_TYPE_CT1, ATOM_TYPE_NH2, ATOM_TYPE_CC, 0.000000, 376.560000},
+     {ATOM_TYPE_O, ATOM_TYPE_CT2, ATOM_TYPE_NH2, ATOM_TYPE_CC, 0.000000, 376.560000},
+     {ATOM_TYPE_O, ATOM_TYPE_CT3, ATOM_TYPE_NH2, ATOM_TYPE_CC, 0.000000, 376.560000},
+     {ATOM_TYPE_O, ATOM_TYPE_HA1, ATOM_TYPE_NH2, ATOM_TYPE_CC, 0.000000, 376.560000},
+     {ATOM_TYPE_O, ATOM_TYPE_N, ATOM_TYPE_CT2, ATOM_TYPE_CC, 0.000000, 1004.160000},
+     {ATOM_TYPE_O, ATOM_TYPE_NH2, ATOM_TYPE_CP1, ATOM_TYPE_CC, 0.000000, 376.560000},
+     {ATOM_TYPE_O, ATOM_TYPE_NH2, ATOM_TYPE_CT1, ATOM_TYPE_CC, 0.000000, 376.560000},
+     {ATOM_TYPE_O, ATOM_TYPE_NH2, ATOM_TYPE_CT2, ATOM_TYPE_CC, 0.000000, 376.560000},
+     {ATOM_TYPE_O, ATOM_TYPE_NH2, ATOM_TYPE_CT3, ATOM_TYPE_CC, 0.000000, 376.560000},
+     {ATOM_TYPE_O, ATOM_TYPE_NH2, ATOM_TYPE_HA1, ATOM_TYPE_CC, 0.000000, 376.560000},
+     {ATOM_TYPE_CG2D1, ATOM_TYPE_CG331, ATOM_TYPE_NG2D1, ATOM_TYPE_HGA4, 0.000000, 209.200000},
+     {ATOM_TYPE_CG2D1, ATOM_TYPE_CG331, ATOM_TYPE_NG2P1, ATOM_TYPE_HGR52, 0.000000, 150.624000},
+     {ATOM_TYPE_CG2D1O, ATOM_TYPE_CG2D1, ATOM_TYPE_NG301, ATOM_TYPE_HGA4, 0.000000, 443.504000},
+     {ATOM_TYPE_CG2D1O, ATOM_TYPE_CG2D1, ATOM_TYPE_NG311, ATOM_TYPE_HGA4, 0.000000, 443.504000},
+     {ATOM_TYPE_CG2D1O, ATOM_TYPE_CG2D2, ATOM_TYPE_NG321, ATOM_TYPE_HGA4, 0.000000, 443.504000},
+     {ATOM_TYPE_CG2D1O, ATOM_TYPE_CG2D2, ATOM_TYPE_OG301, ATOM_TYPE_HGA4, 0.000000, 192.464000},
+     {ATOM_TYPE_CG2D1O, ATOM_TYPE_CG2DC1, ATOM_TYPE_NG301, ATOM_TYPE_HGA4, 0.000000, 443.504000},
+     {ATOM_TYPE_CG2D1O, ATOM_TYPE_CG2DC1, ATOM_TYPE_NG311, ATOM_TYPE_HGA4, 0.000000, 443.504000},
+     {ATOM_TYPE_CG2D1O, ATOM_TYPE_CG2DC1, ATOM_TYPE_OG301, ATOM_TYPE_HGA4, 0.000000, 83.680000},
+     {ATOM_TYPE_CG2D2O, ATOM_TYPE_CG2D1, ATOM_TYPE_NG301, ATOM_TYPE_HGA4, 0.000000, 443.504000},
+     {ATOM_TYPE_CG2D2O, ATOM_TYPE_CG2D1, ATOM_TYPE_NG311, ATOM_TYPE_HGA4, 0.000000, 443.504000},
+     {ATOM_TYPE_CG2D2O, ATOM_TYPE_CG2D2, ATOM_TYPE_NG321, ATOM_TYPE_HGA4, 0.000000, 443.504000},
+     {ATOM_TYPE_CG2D2O, ATOM_TYPE_CG2D2, ATOM_TYPE_OG301, ATOM_TYPE_HGA4, 0.000000, 192.464000},
+     {ATOM_TYPE_CG2D2O, ATOM_TYPE_CG2DC2, ATOM_TYPE_NG301, ATOM_TYPE_HGA4, 0.000000, 443.504000},
+     {ATOM_TYPE_CG2D2O, ATOM_TYPE_CG2DC2, ATOM_TYPE_NG311, ATOM_TYPE_HGA4, 0.000000, 443.504000},
+     {ATOM_TYPE_CG2D2O, ATOM_TYPE_CG2DC2, ATOM_TYPE_OG301, ATOM_TYPE_HGA4, 0.000000, 83.680000},
+     {ATOM_TYPE_CG2DC1, ATOM_TYPE_CG2R61, ATOM_TYPE_NG2D1, ATOM_TYPE_HGA4, 0.000000, 251.040000},
+     {ATOM_TYPE_CG2DC1, ATOM_TYPE_CG2DC2, ATOM_TYPE_NG2P1, ATOM_TYPE_HGR52, 0.000000, 108.784000},
+     {ATOM_TYPE_CG2DC2, ATOM_TYPE_CG2R61, ATOM_TYPE_NG2D1, ATOM_TYPE_HGA4, 0.000000, 251.040000},
+     {ATOM_TYPE_CG2DC2, ATOM_TYPE_CG2DC1, ATOM_TYPE_NG2P1, ATOM_TYPE_HGR52, 0.000000, 108.784000},
+     {ATOM_TYPE_CG2N1, ATOM_TYPE_NG321, ATOM_TYPE_NG321, ATOM_TYPE_NG2D1, 0.000000, 711.280000},
+     {ATOM_TYPE_CG2N1, ATOM_TYPE_NG2P1, ATOM_TYPE_NG2P1, ATOM_TYPE_NG2P1, 0.000000, 334.720000},
+     {ATOM_TYPE_CG2N1, ATOM_TYPE_NG2D1, ATOM_TYPE_NG311, ATOM_TYPE_NG321, 0.000000, 711.280000},
+     {ATOM_TYPE_CG2N2, ATOM_TYPE_NG2P1, ATOM_TYPE_NG2P1, ATOM_TYPE_CG2R61, 0.000000, 251.040000},
+     {ATOM_TYPE_CG2N2, ATOM_TYPE_NG2P1, ATOM_TYPE_NG2P1, ATOM_TYPE_CG331, 0.000000, 251.040000},
+     {ATOM_TYPE_CG2O1, ATOM_TYPE_CG2DC1, ATOM_TYPE_NG2S1, ATOM_TYPE_OG2D1, 0.000000, 1004.160000},
+     {ATOM_TYPE_CG2O1, ATOM_TYPE_CG2DC1, ATOM_TYPE_NG2S2, ATOM_TYPE_OG2D1, 0.000000, 1004.160000},
+     {ATOM_TYPE_CG2O1, ATOM_TYPE_CG2DC2, ATOM_TYPE_NG2S1, ATOM_TYPE_OG2D1, 0.000000, 1004.160000},
+     {ATOM_TYPE_CG2O1, ATOM_TYPE_CG2DC2, ATOM_TYPE_NG2S2, ATOM_TYPE_OG2D1, 0.000000, 1004.160000},
+     {ATOM_TYPE_CG2O1, ATOM_TYPE_CG2R61, ATOM_TYPE_NG2S1, ATOM_TYPE_OG2D1, 0.000000, 1004.160000},
+     {ATOM_TYPE_CG2O1, ATOM_TYPE_CG2R61, ATOM_TYPE_NG2S2, ATOM_TYPE_OG2D1, 0.000000, 1004.160000},
+     {ATOM_TYPE_CG2O1, ATOM_TYPE_CG2R62, ATOM_TYPE_NG2S2, ATOM_TYPE_OG2D1, 0.000000, 1004.160000},
+     {ATOM_TYPE_CG2O1, ATOM_TYPE_CG311, ATOM_TYPE_NG2S0, ATOM_TYPE_OG2D1, 0.000000, 1004.160000},
+     {ATOM_TYPE_CG2O1, ATOM_TYPE_CG311, ATOM_TYPE_NG2S1, ATOM_TYPE_OG2D1, 0.000000, 1004.160000},
+     {ATOM_TYPE_CG2O1, ATOM_TYPE_CG311, ATOM_TYPE_NG2S2, ATOM_TYPE_OG2D1, 0.000000, 1004.160000},
+     {ATOM_TYPE_CG2O1, ATOM_TYPE_CG311, ATOM_TYPE_NG311, ATOM_TYPE_OG2D1, 0.000000, 1004.160000},
+     {ATOM_TYPE_CG2O1, ATOM_TYPE_CG321, ATOM_TYPE_NG2S0, ATOM_TYPE_OG2D1, 0.000000, 1004.160000},
+     {ATOM_TYPE_CG2O1, ATOM_TYPE_CG321, ATOM_TYPE_NG2S1, ATOM_TYPE_OG2D1, 0.000000, 1004.160000},
+     {ATOM_TYPE_CG2O1, ATOM_TYPE_CG321, ATOM_TYPE_NG2S2, ATOM_TYPE_OG2D1, 0.000000, 1004.160000},
+     {ATOM_TYPE_CG2O1, ATOM_TYPE_CG331, ATOM_TYPE_NG2S0, ATOM_TYPE_OG2D1, 0.000000, 594.128000},
+     {ATOM_TYPE_CG2O1, ATOM_TYPE_CG331, ATOM_TYPE_NG2S1, ATOM_TYPE_OG2D1, 0.000000, 1004.160000},
+     {ATOM_TYPE_CG2O1, ATOM_TYPE_CG331, ATOM_TYPE_NG2S2, ATOM_TYPE_OG2D1, 0.000000, 1004.160000},
+     {ATOM_TYPE_CG2O1, ATOM_TYPE_CG3C51, ATOM_TYPE_NG2S0, ATOM_TYPE_OG2D1, 0.000000, 1004.160000},
+     {ATOM_TYPE_CG2O1, ATOM_TYPE_CG3C51, ATOM_TYPE_NG2S1, ATOM_TYPE_OG2D1, 0.000000, 1004.160000},
+     {ATOM_TYPE_CG2O1, ATOM_TYPE_CG3C51, ATOM_TYPE_NG2S2, ATOM_TYPE_OG2D1, 0.000000, 1004.160000},
+     {ATOM_TYPE_CG2O1, ATOM_TYPE_CG3C53, ATOM_TYPE_NG2S0, ATOM_TYPE_OG2D1, 0.000000, 1004.160000},
+     {ATOM_TYPE_CG2O1, ATOM_TYPE_CG3C53, ATOM_TYPE_NG2S1, ATOM_TYPE_OG2D1, 0.000000, 1004.160000},
+     {ATOM_TYPE_CG2O1, ATOM_TYPE_CG3C53, ATOM_TYPE_NG2S2, ATOM_TYPE_OG2D1, 0.000000, 1004.160000},
+     {ATOM_TYPE_CG2O1, ATOM_TYPE_NG2S0, ATOM_TYPE_OG2D1, ATOM_TYPE_HGR52, 0.000000, 418.400000},
+     {ATOM_TYPE_CG2O1, ATOM_TYPE_NG2S2, ATOM_TYPE_OG2D1, ATOM_TYPE_HGR52, 0.000000, 552.288000},
+     {ATOM_TYPE_CG2O2, ATOM_TYPE_CG2R61, ATOM_TYPE_OG2D1, ATOM_TYPE_OG302, 0.000000, 602.496000},
+     {ATOM_TYPE_CG2O2, ATOM_TYPE_CG311, ATOM_TYPE_OG2D1, ATOM_TYPE_OG302, 0.000000, 518.816000},
+     {ATOM_TYPE_CG2O2, ATOM_TYPE_CG321, ATOM_TYPE_OG2D1, ATOM_TYPE_OG302, 0.000000, 518.816000},
+     {ATOM_TYPE_CG2O2, ATOM_TYPE_CG331, ATOM_TYPE_OG2D1, ATOM_TYPE_OG302, 0.000000, 518.816000},
+     {ATOM_TYPE_CG2O2, ATOM_TYPE_CG2R61, ATOM_TYPE_OG2D1, ATOM_TYPE_OG311, 0.000000, 443.504000},
+     {ATOM_TYPE_CG2O2, ATOM_TYPE_CG311, ATOM_TYPE_OG2D1, ATOM_TYPE_OG311, 0.000000, 543.920000},
+     {ATOM_TYPE_CG2O2, ATOM_TYPE_CG321, ATOM_TYPE_OG2D1, ATOM_TYPE_OG311, 0.000000, 543.920000},
+     {ATOM_TYPE_CG2O2, ATOM_TYPE_CG331, ATOM_TYPE_OG2D1, ATOM_TYPE_OG311, 0.000000, 543.920000},
+     {ATOM_TYPE_CG2O2, ATOM_TYPE_OG2D1, ATOM_TYPE_OG311, ATOM_TYPE_HGR52, 0.000000, 627.600000},
+     {ATOM_TYPE_CG2O3, ATOM_TYPE_OG2D2, ATOM_TYPE_OG2D2, ATOM_TYPE_CG2DC1, 0.000000, 803.328000},
+     {ATOM_TYPE_CG2O3, ATOM_TYPE_OG2D2, ATOM_TYPE_OG2D2, ATOM_TYPE_CG2DC2, 0.000000, 803.328000},
+     {ATOM_TYPE_CG2O3, ATOM_TYPE_OG2D2, ATOM_TYPE_OG2D2, ATOM_TYPE_CG2O5, 0.000000, 803.328000},
+     {ATOM_TYPE_CG2O3, ATOM_TYPE_OG2D2, ATOM_TYPE_OG2D2, ATOM_TYPE_CG2R61, 0.000000, 803.328000},
+     {ATOM_TYPE_CG2O3, ATOM_TYPE_OG2D2, ATOM_TYPE_OG2D2, ATOM_TYPE_CG301, 0.000000, 803.328000},
+     {ATOM_TYPE_CG2O3, ATOM_TYPE_OG2D2, ATOM_TYPE_OG2D2, ATOM_TYPE_CG311, 0.000000, 803.328000},
+     {ATOM_TYPE_CG2O3, ATOM_TYPE_OG2D2, ATOM_TYPE_OG2D2, ATOM_TYPE_CG314, 0.000000, 803.328000},
+     {ATOM_TYPE_CG2O3, ATOM_TYPE_OG2D2, ATOM_TYPE_OG2D2, ATOM_TYPE_CG321, 0.000000, 803.328000},
+     {ATOM_TYPE_CG2O3, ATOM_TYPE_OG2D2, ATOM_TYPE_OG2D2, ATOM_TYPE_CG331, 0.000000, 803.328000},
+     {ATOM_TYPE_CG2O3, ATOM_TYPE_OG2D2, ATOM_TYPE_OG2D2, ATOM_TYPE_HGR52, 0.000000, 560.656000},
+     {ATOM_TYPE_CG2O4, ATOM_TYPE_CG2DC1, ATOM_TYPE_OG2D1, ATOM_TYPE_HGR52, 0.000000, 117.152000},
+     {ATOM_TYPE_CG2O4, ATOM_TYPE_CG2DC2, ATOM_TYPE_OG2D1, ATOM_TYPE_HGR52, 0.000000, 117.152000},
+     {ATOM_TYPE_CG2O4, ATOM_TYPE_CG2R61, ATOM_TYPE_OG2D1, ATOM_TYPE_HGR52, 0.000000, 443.504000},
+     {ATOM_TYPE_CG2O4, ATOM_TYPE_CG321, ATOM_TYPE_OG2D1, ATOM_TYPE_HGR52, 0.000000, 418.400000},
+     {ATOM_TYPE_CG2O4, ATOM_TYPE_CG331, ATOM_TYPE_OG2D1, ATOM_TYPE_HGR52, 0.000000, 418.400000},
+     {ATOM_TYPE_CG2O5, ATOM_TYPE_CG2DC1, ATOM_TYPE_CG331, ATOM_TYPE_OG2D3, 0.000000, 736.384000},
+     {ATOM_TYPE_CG2O5, ATOM_TYPE_CG2DC2, ATOM_TYPE_CG331, ATOM_TYPE_OG2D3, 0.000000, 736.384000},
+     {ATOM_TYPE_CG2O5, ATOM_TYPE_CG2O3, ATOM_TYPE_CG2R61, ATOM_TYPE_OG2D3, 0.000000, 602.496000},
+     {ATOM_TYPE_CG2O5, ATOM_TYPE_CG2R61, ATOM_TYPE_CG311, ATOM_TYPE_OG2D3, 0.000000, 602.496000},
+     {ATOM_TYPE_CG2O5, ATOM_TYPE_CG2R61, ATOM_TYPE_CG321, ATOM_TYPE_OG2D3, 0.000000, 602.496000},
+     {ATOM_TYPE_CG2O5, ATOM_TYPE_CG2R61, ATOM_TYPE_CG331, ATOM_TYPE_OG2D3, 0.000000, 502.080000},
+     {ATOM_TYPE_CG2O5, ATOM_TYPE_CG321, ATOM_TYPE_CG321, ATOM_TYPE_OG2D3, 0.000000, 585.760000},
+     {ATOM_TYPE_CG2O5, ATOM_TYPE_CG321, ATOM_TYPE_CG331, ATOM_TYPE_OG2D3, 0.000000, 585.760000},
+     {ATOM_TYPE_CG2O5, ATOM_TYPE_CG331, ATOM_TYPE_CG331, ATOM_TYPE_OG2D3, 0.000000, 585.760000},
+     {ATOM_TYPE_CG2O6, ATOM_TYPE_NG2S2, ATOM_TYPE_NG2S2, ATOM_TYPE_OG2D1, 0.000000, 669.440000},
+     {ATOM_TYPE_CG2O6, ATOM_TYPE_OG302, ATOM_TYPE_OG302, ATOM_TYPE_OG2D1, 0.000000, 1213.360000},
+     {ATOM_TYPE_CG2O6, ATOM_TYPE_OG2D2, ATOM_TYPE_OG2D2, ATOM_TYPE_OG2D2, 0.000000, 895.376000},
+     {ATOM_TYPE_CG2O6, ATOM_TYPE_NG2S1, ATOM_TYPE_OG2D1, ATOM_TYPE_OG302, 0.000000, 518.816000},
+     {ATOM_TYPE_CG2O6, ATOM_TYPE_SG311, ATOM_TYPE_SG311, ATOM_TYPE_SG2D1, 0.000000, 669.440000},
+     {ATOM_TYPE_CG2R53, ATOM_TYPE_CG251O, ATOM_TYPE_NG2R53, ATOM_TYPE_OG2D1, 0.000000, 753.120000},
+     {ATOM_TYPE_CG2R53, ATOM_TYPE_CG252O, ATOM_TYPE_NG2R53, ATOM_TYPE_OG2D1, 0.000000, 753.120000},
+     {ATOM_TYPE_CG2R53, ATOM_TYPE_CG25C1, ATOM_TYPE_NG2R51, ATOM_TYPE_OG2D1, 0.000000, 753.120000},
+     {ATOM_TYPE_CG2R53, ATOM_TYPE_CG25C2, ATOM_TYPE_NG2R51, ATOM_TYPE_OG2D1, 0.000000, 753.120000},
+     {ATOM_TYPE_CG2R53, ATOM_TYPE_CG3C41, ATOM_TYPE_NG2R43, ATOM_TYPE_OG2D1, 0.000000, 1004.160000},
+     {ATOM_TYPE_CG2R53, ATOM_TYPE_CG3C52, ATOM_TYPE_NG2R53, ATOM_TYPE_OG2D1, 0.000000, 753.120000},
+     {ATOM_TYPE_CG2R53, ATOM_TYPE_NG2R53, ATOM_TYPE_NG2R53, ATOM_TYPE_OG2D1, 0.000000, 753.120000},
+     {ATOM_TYPE_CG2R53, ATOM_TYPE_NG2R53, ATOM_TYPE_OG2D1, ATOM_TYPE_SG311, 0.000000, 359.824000},
+     {ATOM_TYPE_CG2R53, ATOM_TYPE_NG2R53, ATOM_TYPE_SG2D1, ATOM_TYPE_SG311, 0.000000, 359.824000},
+     {ATOM_TYPE_CG2R63, ATOM_TYPE_CG2R62, ATOM_TYPE_NG2R61, ATOM_TYPE_OG2D4, 0.000000, 753.120000},
+     {ATOM_TYPE_CG2R63, ATOM_TYPE_CG2RC0, ATOM_TYPE_NG2R61, ATOM_TYPE_OG2D4, 0.000000, 753.120000},
+     {ATOM_TYPE_CG2R63, ATOM_TYPE_NG2R61, ATOM_TYPE_NG2R61, ATOM_TYPE_OG2D4, 0.000000, 753.120000},
+     {ATOM_TYPE_CG2R63, ATOM_TYPE_NG2R61, ATOM_TYPE_NG2R62, ATOM_TYPE_OG2D4, 0.000000, 753.120000},
+     {ATOM_TYPE_CG2R64, ATOM_TYPE_CG2R61, ATOM_TYPE_NG2R60, ATOM_TYPE_NG2S1, 0.000000, 158.992000},
+     {ATOM_TYPE_CG2R64, ATOM_TYPE_CG2R62, ATOM_TYPE_NG2R62, ATOM_TYPE_NG2S3, 0.000000, 502.080000},
+     {ATOM_TYPE_CG2R64, ATOM_TYPE_CG2RC0, ATOM_TYPE_NG2R62, ATOM_TYPE_NG2S3, 0.000000, 334.720000},
+     {ATOM_TYPE_CG2R64, ATOM_TYPE_NG2R61, ATOM_TYPE_NG2R62, ATOM_TYPE_NG2S3, 0.000000, 334.720000},
+     {ATOM_TYPE_NG2O1, ATOM_TYPE_OG2N1, ATOM_TYPE_OG2N1, ATOM_TYPE_CG324, 0.000000, 448.524800},
+     {ATOM_TYPE_NG2O1, ATOM_TYPE_OG2N1, ATOM_TYPE_OG2N1, ATOM_TYPE_CG334, 0.000000, 425.094400},
+     {ATOM_TYPE_NG2S3, ATOM_TYPE_HGP4, ATOM_TYPE_HGP4, ATOM_TYPE_CG2R61, 0.000000, -20.920000},
+     {ATOM_TYPE_NG2S3, ATOM_TYPE_HGP4, ATOM_TYPE_HGP4, ATOM_TYPE_CG2R64, 0.000000, 75.312000},
+     {ATOM_TYPE_CC2O1, ATOM_TYPE_CC331, ATOM_TYPE_NC2D1, ATOM_TYPE_OC2D1, 0.000000, 1004.160000},
+     {ATOM_TYPE_NC2D1, ATOM_TYPE_CC2O1, ATOM_TYPE_CC3161, ATOM_TYPE_HCP1, 0.000000, 167.360000},
+     {ATOM_TYPE_NC2D1, ATOM_TYPE_CC2O1, ATOM_TYPE_CC3062, ATOM_TYPE_HCP1, 0.000000, 167.360000},
+     {ATOM_TYPE_CC2O2, ATOM_TYPE_CC311, ATOM_TYPE_OC2D2, ATOM_TYPE_OC2D2, 0.000000, 803.328000},
+     {ATOM_TYPE_CC2O2, ATOM_TYPE_CC301, ATOM_TYPE_OC2D2, ATOM_TYPE_OC2D2, 0.000000, 803.328000},
+     {ATOM_TYPE_CC2O2, ATOM_TYPE_CC3163, ATOM_TYPE_OC2D2, ATOM_TYPE_OC2D2, 0.000000, 803.328000},
+     {ATOM_TYPE_NC2D1, ATOM_TYPE_CC2O1, ATOM_TYPE_CC331, ATOM_TYPE_HCP1, 0.000000, 167.360000},
+     {ATOM_TYPE_NC2D1, ATOM_TYPE_CC2O1, ATOM_TYPE_CC311, ATOM_TYPE_HCP1, 0.000000, 167.360000},
+     {ATOM_TYPE_CC2O2, ATOM_TYPE_CC321, ATOM_TYPE_OC2D2, ATOM_TYPE_OC2D2, 0.000000, 803.328000},
+     {ATOM_TYPE_CC2O4, ATOM_TYPE_CC331, ATOM_TYPE_OC2D4, ATOM_TYPE_HCR1, 0.000000, 418.400000},
+     {ATOM_TYPE_CC2O4, ATOM_TYPE_CC312, ATOM_TYPE_OC2D4, ATOM_TYPE_HCR1, 0.000000, 418.400000},
+     {ATOM_TYPE_OC2D3, ATOM_TYPE_CC331, ATOM_TYPE_CC331, ATOM_TYPE_CC2O3, 0.000000, 585.760000},
+     {ATOM_TYPE_OC2D3, ATOM_TYPE_CC312, ATOM_TYPE_CC322, ATOM_TYPE_CC2O3, 0.000000, 585.760000},
+     {ATOM_TYPE_NN2B, ATOM_TYPE_CN4, ATOM_TYPE_CN5, ATOM_TYPE_HN2, 0.000000, 58.576000},
+     {ATOM_TYPE_NN1, ATOM_TYPE_CN2, ATOM_TYPE_HN1, ATOM_TYPE_HN1, 0.000000, 50.208000},
+     {ATOM_TYPE_CN1, ATOM_TYPE_NN2G, ATOM_TYPE_CN5G, ATOM_TYPE_ON1, 0.000000, 753.120000},
+     {ATOM_TYPE_CN1T, ATOM_TYPE_NN2B, ATOM_TYPE_NN2U, ATOM_TYPE_ON1, 0.000000, 920.480000},
+     {ATOM_TYPE_CN1, ATOM_TYPE_NN2U, ATOM_TYPE_CN3T, ATOM_TYPE_ON1, 0.000000, 753.120000},
+     {ATOM_TYPE_CN2, ATOM_TYPE_NN3G, ATOM_TYPE_NN2G, ATOM_TYPE_NN1, 0.000000, 334.720000},
+     {ATOM_TYPE_CN2, ATOM_TYPE_NN3A, ATOM_TYPE_CN5, ATOM_TYPE_NN1, 0.000000, 334.720000},
+     {ATOM_TYPE_CN2, ATOM_TYPE_NN3, ATOM_TYPE_CN3, ATOM_TYPE_NN1, 0.000000, 502.080000},
+     {ATOM_TYPE_HEL2, ATOM_TYPE_HEL2, ATOM_TYPE_CEL2, ATOM_TYPE_CEL2, 0.000000, 25.104000},
+     {ATOM_TYPE_CPB, ATOM_TYPE_CPA, ATOM_TYPE_NPH, ATOM_TYPE_CPA, 0.000000, 174.054400},
+     {ATOM_TYPE_HA, ATOM_TYPE_CPA, ATOM_TYPE_CPA, ATOM_TYPE_CPM, 0.000000, 246.019200},
+     {ATOM_TYPE_NPH, ATOM_TYPE_CPA, ATOM_TYPE_CPA, ATOM_TYPE_FE, 0.000000, 1149.763200},
+     {ATOM_TYPE_NPH, ATOM_TYPE_CPA, ATOM_TYPE_CPB, ATOM_TYPE_CPB, 0.000000, 339.740800},
+     {ATOM_TYPE_NPH, ATOM_TYPE_CPA, ATOM_TYPE_CPM, ATOM_TYPE_CPA, 0.000000, 153.134400},
+     {ATOM_TYPE_NPH, ATOM_TYPE_CPM, ATOM_TYPE_CPB, ATOM_TYPE_CPA, 0.000000, 273.633600},
+     {ATOM_TYPE_NC2, ATOM_TYPE_X, ATOM_TYPE_X, ATOM_TYPE_C, 0.000000, 376.560000},
+     {ATOM_TYPE_NC2, ATOM_TYPE_X, ATOM_TYPE_X, ATOM_TYPE_HC, 0.000000, -16.736000},
+     {ATOM_TYPE_NH1, ATOM_TYPE_X, ATOM_TYPE_X, ATOM_TYPE_H, 0.000000, 167.360000},
+     {ATOM_TYPE_NH2, ATOM_TYPE_X, ATOM_TYPE_X, ATOM_TYPE_H, 0.000000, 33.472000},
+     {ATOM_TYPE_O, ATOM_TYPE_X, ATOM_TYPE_X, ATOM_TYPE_C, 0.000000, 1004.160000},
+     {ATOM_TYPE_OB, ATOM_TYPE_X, ATOM_TYPE_X, ATOM_TYPE_CD, 0.000000, 836.800000},
+     {ATOM_TYPE_OC, ATOM_TYPE_X, ATOM_TYPE_X, ATOM_TYPE_CC, 0.000000, 803.328000},
+     {ATOM_TYPE_CC, ATOM_TYPE_X, ATOM_TYPE_X, ATOM_TYPE_CT1, 0.000000, 803.328000},
+     {ATOM_TYPE_CC, ATOM_TYPE_X, ATOM_TYPE_X, ATOM_TYPE_CT2, 0.000000, 803.328000},
+     {ATOM_TYPE_CC, ATOM_TYPE_X, ATOM_TYPE_X, ATOM_TYPE_CT3, 0.000000, 803.328000},
+     {ATOM_TYPE_HN2, ATOM_TYPE_X, ATOM_TYPE_X, ATOM_TYPE_NN2, 0.000000, 8.368000},
+     {ATOM_TYPE_HN1, ATOM_TYPE_X, ATOM_TYPE_X, ATOM_TYPE_NN1, 0.000000, 33.472000},
+     {ATOM_TYPE_CN1, ATOM_TYPE_X, ATOM_TYPE_X, ATOM_TYPE_ON1, 0.000000, 753.120000},
+     {ATOM_TYPE_CN1T, ATOM_TYPE_X, ATOM_TYPE_X, ATOM_TYPE_ON1, 0.000000, 753.120000},
+     {ATOM_TYPE_CN1, ATOM_TYPE_X, ATOM_TYPE_X, ATOM_TYPE_ON1C, 0.000000, 669.440000},
+     {ATOM_TYPE_CN2, ATOM_TYPE_X, ATOM_TYPE_X, ATOM_TYPE_NN1, 0.000000, 753.120000},
+     {ATOM_TYPE_CN9, ATOM_TYPE_X, ATOM_TYPE_X, ATOM_TYPE_CN3T, 0.000000, 117.152000},
+     {ATOM_TYPE_OBL, ATOM_TYPE_X, ATOM_TYPE_X, ATOM_TYPE_CL, 0.000000, 836.800000},
+     {ATOM_TYPE_OCL, ATOM_TYPE_X, ATOM_TYPE_X, ATOM_TYPE_CL, 0.000000, 803.328000},
+     {ATOM_TYPE_OCL, ATOM_TYPE_X, ATOM_TYPE_X, ATOM_TYPE_CCL, 0.000000, 803.328000},
+     {ATOM_TYPE_CPB, ATOM_TYPE_X, ATOM_TYPE_X, ATOM_TYPE_CE1, 0.000000, 753.120000},
+     {ATOM_TYPE_CT2, ATOM_TYPE_X, ATOM_TYPE_X, ATOM_TYPE_CPB, 0.000000, 753.120000},
+     {ATOM_TYPE_CT3, ATOM_TYPE_X, ATOM_TYPE_X, ATOM_TYPE_CPB, 0.000000, 753.120000},
+};
+
+} // End namespace charmm_parameters
+
+#endif
@@ -1,702 +0,0 @@
-// torsion_itp.h --- std::string'ed version of torsion.itp
-// Copyright (C) 2014 Anders S. Christensen
-// Copyright (c) 1991-2000, University of Groningen, The Netherlands.
-// Copyright (c) 2001-2004, The GROMACS development team,
-//
-// This file is part of Phaistos
-//
-// Phaistos is free software: you can redistribute it and/or modify
-// it under the terms of the GNU General Public License as published by
-// the Free Software Foundation, either version 3 of the License, or
-// (at your option) any later version.
-//
-// Phaistos is distributed in the hope that it will be useful,
-// but WITHOUT ANY WARRANTY; without even the implied warranty of
-// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
-// GNU General Public License for more details.
-//
-// You should have received a copy of the GNU General Public License
-// along with Phaistos.  If not, see <http://www.gnu.org/licenses/>.
-//
-
-#ifndef TERM_CHARMM_TORSION_ITP_H
-#define TERM_CHARMM_TORSION_ITP_H
-
-namespace charmm_constants {
-
-const static std::string torsion_itp ="CT1	CT2	CC	OC	9	0.00	3.51456	1 ; FIX FOR ASP IN EEF1SB\n\
-CT1	CT2	CC	OC	9	180.00	4.10032	2 ; FIX FOR ASP IN EEF1SB\n\
-CT1	CT2	CC	OC	9	0.00	6.10864	3 ; FIX FOR ASP IN EEF1SB\n\
-NH2	CT1	C	O	9	0.00	0.0	1\n\
-NH2	CT1	C	NH1	9	0.00	0.0	1\n\
-H	NH2	CT1	CT1	9	0.00	0.0	1\n\
-H	NH2	CT1	C	9	0.00	0.0	1\n\
-H	NH2	CT1	HB1	9	0.00	0.46024	3\n\
-H	NH2	CT1	CT2	9	0.00	0.46024	3\n\
-H	NH2	CT1	CT3	9	0.00	0.46024	3\n\
-CAI	CA	CA	CAI	9	180.00	12.9704	2\n\
-CA	CPT	CPT	CA	9	180.00	12.552	2\n\
-CAI	CPT	CPT	CAI	9	180.00	12.552	2\n\
-CA	CY	CPT	CA	9	180.00	12.552	2\n\
-CA	CY	CPT	CAI	9	180.00	12.552	2\n\
-CA	NY	CPT	CA	9	180.00	12.552	2\n\
-CPT	CA	CA	CA	9	180.00	12.552	2\n\
-CPT	CPT	CA	CA	9	180.00	12.552	2\n\
-CA	NY	CPT	CAI	9	180.00	12.552	2\n\
-CPT	CAI	CA	CA	9	180.00	12.552	2\n\
-CPT	CPT	CAI	CA	9	180.00	12.552	2\n\
-CPT	CPT	CY	CA	9	180.00	20.92	2\n\
-CPT	CPT	NY	CA	9	180.00	27.196	2\n\
-CT3	CY	CPT	CA	9	180.00	10.46	2\n\
-CT3	CY	CPT	CAI	9	180.00	10.46	2\n\
-CT3	CY	CPT	CPT	9	180.00	12.552	2\n\
-CT2	CY	CPT	CA	9	180.00	10.46	2\n\
-CT2	CY	CPT	CAI	9	180.00	10.46	2\n\
-CT2	CY	CPT	CPT	9	180.00	12.552	2\n\
-CY	CA	NY	CPT	9	180.00	25.104	2\n\
-CY	CPT	CA	CA	9	180.00	16.736	2\n\
-CY	CPT	CPT	CA	9	180.00	16.736	2\n\
-CY	CPT	CAI	CA	9	180.00	16.736	2\n\
-CY	CPT	CPT	CAI	9	180.00	16.736	2\n\
-H	NY	CA	CY	9	180.00	0.2092	2\n\
-H	NY	CPT	CA	9	180.00	0.8368	2\n\
-H	NY	CPT	CAI	9	180.00	0.8368	2\n\
-H	NY	CPT	CPT	9	180.00	3.5564	2\n\
-HP	CAI	CA	CA	9	180.00	17.5728	2\n\
-HP	CA	CA	CPT	9	180.00	12.552	2\n\
-HP	CA	CPT	CPT	9	180.00	12.552	2\n\
-HP	CA	CPT	CY	9	180.00	16.736	2\n\
-HP	CA	CA	CAI	9	180.00	17.5728	2\n\
-HP	CA	CAI	CPT	9	180.00	12.552	2\n\
-HP	CAI	CA	HP	9	180.00	10.0416	2\n\
-HP	CAI	CPT	CPT	9	180.00	12.552	2\n\
-HP	CAI	CPT	CY	9	180.00	16.736	2\n\
-HP	CA	CY	CPT	9	180.00	11.7152	2\n\
-HP	CA	CY	CT3	9	180.00	5.0208	2\n\
-HP	CA	CY	CT2	9	180.00	5.0208	2\n\
-HP	CA	NY	CPT	9	180.00	10.8784	2\n\
-HP	CA	NY	H	9	180.00	1.6736	2\n\
-HP	CY	CA	HP	9	180.00	4.184	2\n\
-HP	CY	CPT	CA	9	180.00	11.7152	2\n\
-HP	CY	CPT	CAI	9	180.00	11.7152	2\n\
-HP	CY	CPT	CPT	9	180.00	10.8784	2\n\
-NY	CA	CY	CPT	9	180.00	20.92	2\n\
-NY	CA	CY	CT3	9	180.00	10.46	2\n\
-NY	CA	CY	CT2	9	180.00	10.46	2\n\
-NY	CA	CY	HP	9	180.00	14.644	2\n\
-NY	CPT	CA	CA	9	180.00	12.552	2\n\
-NY	CPT	CA	HP	9	180.00	12.552	2\n\
-NY	CPT	CPT	CA	9	180.00	16.736	2\n\
-NY	CPT	CAI	CA	9	180.00	12.552	2\n\
-NY	CPT	CAI	HP	9	180.00	12.552	2\n\
-NY	CPT	CPT	CAI	9	180.00	16.736	2\n\
-NY	CPT	CPT	CY	9	180.00	27.196	2\n\
-CT3	CT2	CY	CA	9	0.00	1.58992	2\n\
-CT3	CT2	CY	CPT	9	180.00	1.046	2\n\
-CT3	CT2	CY	CPT	9	0.00	1.2552	3\n\
-HA3	CT3	CY	CA	9	0.00	0.04184	3\n\
-HA3	CT3	CY	CPT	9	0.00	0.8368	3\n\
-HA2	CT2	CY	CA	9	0.00	0.04184	3\n\
-HA2	CT2	CY	CPT	9	0.00	0.8368	3\n\
-C	CT1	NH1	C	9	180.00	0.8368	1\n\
-C	CT2	NH1	C	9	180.00	0.8368	1\n\
-C	N	CP1	C	9	0.00	3.3472	3\n\
-CA	CA	CA	CA	9	180.00	12.9704	2\n\
-CC	CP1	N	C	9	0.00	3.3472	3\n\
-CC	CT1	CT2	CA	9	0.00	0.16736	3\n\
-CC	CT1	NH1	C	9	180.00	0.8368	1\n\
-CC	CT2	NH1	C	9	180.00	8.368	1\n\
-CD	CP1	N	C	9	180.00	0.0	1\n\
-CD	CT1	NH1	C	9	180.00	0.8368	1\n\
-CD	CT2	NH1	C	9	180.00	8.368	1\n\
-CE1	CE1	CT3	HA3	9	0.00	0.12552	3\n\
-CE2	CE1	CT2	CT3	9	180.00	2.092	1\n\
-CE2	CE1	CT2	CT3	9	180.00	5.4392	3\n\
-CE2	CE1	CT2	HA2	9	0.00	0.50208	3\n\
-CE2	CE1	CT3	HA3	9	180.00	0.2092	3\n\
-CP1	C	N	CP1	9	180.00	11.506	2\n\
-CP1	C	N	CP1	9	0.00	1.2552	4\n\
-CP2	CP1	N	C	9	0.00	3.3472	3\n\
-CP2	CP3	N	C	9	180.00	0.0	3\n\
-CP2	CP3	N	CP1	9	0.00	0.4184	3\n\
-CP2	CP3	NP	CP1	9	0.00	0.33472	3\n\
-CP3	N	C	CP1	9	180.00	11.506	2\n\
-CP3	N	C	CP1	9	0.00	1.2552	4\n\
-CP3	N	CP1	C	9	0.00	0.4184	3\n\
-CP3	N	CP1	CC	9	0.00	0.4184	3\n\
-CP3	N	CP1	CP2	9	0.00	0.4184	3\n\
-CP3	NP	CP1	C	9	0.00	0.33472	3\n\
-CP3	NP	CP1	CC	9	0.00	0.33472	3\n\
-CP3	NP	CP1	CD	9	0.00	0.33472	3\n\
-CP3	NP	CP1	CP2	9	0.00	0.33472	3\n\
-CPH2	NR1	CPH1	CPH1	9	180.00	58.576	2\n\
-CPH2	NR2	CPH1	CPH1	9	180.00	58.576	2\n\
-CPH2	NR3	CPH1	CPH1	9	180.00	50.208	2\n\
-CT1	C	N	CP1	9	180.00	11.506	2\n\
-CT1	C	N	CP1	9	0.00	1.2552	4\n\
-CT1	C	N	CP3	9	180.00	11.506	2\n\
-CT1	C	N	CP3	9	0.00	1.2552	4\n\
-CT1	C	NH1	CT1	9	0.00	6.6944	1\n\
-CT1	C	NH1	CT1	9	180.00	10.46	2\n\
-CT1	CT1	NH1	C	9	0.00	7.5312	1\n\
-CT1	NH1	C	CP1	9	0.00	6.6944	1\n\
-CT1	NH1	C	CP1	9	180.00	10.46	2\n\
-CT2	C	N	CP1	9	180.00	11.506	2\n\
-CT2	C	N	CP1	9	0.00	1.2552	4\n\
-CT2	C	N	CP3	9	180.00	11.506	2\n\
-CT2	C	N	CP3	9	0.00	1.2552	4\n\
-CT2	C	NH1	CT1	9	0.00	6.6944	1\n\
-CT2	C	NH1	CT1	9	180.00	10.46	2\n\
-CT2	C	NH1	CT2	9	0.00	6.6944	1\n\
-CT2	C	NH1	CT2	9	180.00	10.46	2\n\
-CT2	C	NH1	CT3	9	0.00	6.6944	1\n\
-CT2	C	NH1	CT3	9	180.00	10.46	2\n\
-CT2	CA	CA	CA	9	180.00	12.9704	2\n\
-CT2	CPH1	NR1	CPH2	9	180.00	12.552	2\n\
-CT2	CPH1	NR2	CPH2	9	180.00	12.552	2\n\
-CT2	CPH1	NR3	CPH2	9	180.00	10.46	2\n\
-CT2	CT1	NH1	C	9	0.00	7.5312	1\n\
-CT2	CT2	CPH1	CPH1	9	0.00	1.6736	1\n\
-CT2	CT2	CT2	CT2	9	180.00	0.4184	2\n\
-CT2	CT2	CT2	CT2	9	0.00	0.6276	4\n\
-CT2	CT2	CT2	CT2	9	180.00	0.4184	6\n\
-CT2	CT2	CT2	CT3	9	180.00	0.4184	2\n\
-CT2	CT2	CT2	CT3	9	0.00	0.6276	4\n\
-CT2	CT2	CT2	CT3	9	180.00	0.4184	6\n\
-CT2	CT2	NH1	C	9	0.00	7.5312	1\n\
-CT2	NH1	C	CP1	9	0.00	6.6944	1\n\
-CT2	NH1	C	CP1	9	180.00	10.46	2\n\
-CT2	NH1	C	CT1	9	0.00	6.6944	1\n\
-CT2	NH1	C	CT1	9	180.00	10.46	2\n\
-CT2	SM	SM	CT2	9	0.00	4.184	1\n\
-CT2	SM	SM	CT2	9	0.00	17.1544	2\n\
-CT2	SM	SM	CT2	9	0.00	3.7656	3\n\
-CT3	C	N	CP1	9	180.00	11.506	2\n\
-CT3	C	N	CP1	9	0.00	1.2552	4\n\
-CT3	C	N	CP3	9	180.00	11.506	2\n\
-CT3	C	N	CP3	9	0.00	1.2552	4\n\
-CT3	C	NH1	CT1	9	0.00	6.6944	1\n\
-CT3	C	NH1	CT1	9	180.00	10.46	2\n\
-CT3	C	NH1	CT2	9	0.00	6.6944	1\n\
-CT3	C	NH1	CT2	9	180.00	10.46	2\n\
-CT3	C	NH1	CT3	9	0.00	6.6944	1\n\
-CT3	C	NH1	CT3	9	180.00	10.46	2\n\
-CT3	CA	CA	CA	9	180.00	12.9704	2\n\
-CT3	CE1	CE2	HE2	9	180.00	21.7568	2\n\
-CT3	CPH1	NR1	CPH2	9	180.00	12.552	2\n\
-CT3	CT1	NH1	C	9	0.00	7.5312	1\n\
-CT3	CT2	CA	CA	9	180.00	0.96232	2\n\
-CT3	CT2	CPH1	CPH1	9	0.00	0.8368	1\n\
-CT3	CT2	CPH1	CPH1	9	0.00	1.12968	2\n\
-CT3	CT2	CPH1	CPH1	9	0.00	0.0	3\n\
-CT1	CT2	S	CT3	9	180.00	1.00416	1\n\
-CT3	CT2	S	CT3	9	180.00	1.00416	1\n\
-CT3	CT2	S	CT3	9	0.00	1.54808	3\n\
-CT3	NH1	C	CP1	9	0.00	6.6944	1\n\
-CT3	NH1	C	CP1	9	180.00	10.46	2\n\
-CT3	NH1	C	CT1	9	0.00	6.6944	1\n\
-CT3	NH1	C	CT1	9	180.00	10.46	2\n\
-CT3	S	CT2	CT2	9	180.00	1.00416	1\n\
-CT3	S	CT2	CT2	9	0.00	1.54808	3\n\
-CT3	SM	SM	CT3	9	0.00	4.184	1\n\
-CT3	SM	SM	CT3	9	0.00	17.1544	2\n\
-CT3	SM	SM	CT3	9	0.00	3.7656	3\n\
-H	NH1	C	CP1	9	180.00	10.46	2\n\
-H	NH1	C	CT1	9	180.00	10.46	2\n\
-H	NH1	C	CT2	9	180.00	10.46	2\n\
-H	NH1	C	CT3	9	180.00	10.46	2\n\
-H	NH1	CT1	C	9	0.00	0.0	1\n\
-H	NH1	CT1	CC	9	0.00	0.0	1\n\
-H	NH1	CT1	CD	9	0.00	0.0	1\n\
-H	NH1	CT1	CT1	9	0.00	0.0	1\n\
-H	NH1	CT1	CT2	9	0.00	0.0	1\n\
-H	NH1	CT1	CT3	9	0.00	0.0	1\n\
-H	NH1	CT2	C	9	0.00	0.0	1\n\
-H	NH1	CT2	CC	9	0.00	0.0	1\n\
-H	NH1	CT2	CD	9	0.00	0.0	1\n\
-H	NH1	CT2	CT2	9	0.00	0.0	1\n\
-H	NH1	CT2	CT3	9	0.00	0.0	1\n\
-H	NH2	CC	CT1	9	180.00	5.8576	2\n\
-H	NH2	CC	CT2	9	180.00	5.8576	2\n\
-H	NH2	CC	CT3	9	180.00	5.8576	2\n\
-H	NH2	CC	CP1	9	180.00	10.46	2\n\
-H	NR1	CPH1	CPH1	9	180.00	4.184	2\n\
-H	NR1	CPH1	CT2	9	180.00	4.184	2\n\
-H	NR1	CPH1	CT3	9	180.00	4.184	2\n\
-H	NR3	CPH1	CPH1	9	180.00	5.8576	2\n\
-H	NR3	CPH1	CT2	9	180.00	12.552	2\n\
-H	NR3	CPH1	CT3	9	180.00	12.552	2\n\
-H	OH1	CA	CA	9	180.00	4.14216	2\n\
-H	OH1	CT1	CT3	9	0.00	5.56472	1\n\
-H	OH1	CT1	CT3	9	0.00	0.75312	2\n\
-H	OH1	CT1	CT3	9	0.00	1.33888	3\n\
-H	OH1	CT2	CT2	9	0.00	5.4392	1\n\
-H	OH1	CT2	CT2	9	0.00	1.2552	2\n\
-H	OH1	CT2	CT2	9	0.00	1.75728	3\n\
-H	OH1	CT2	CT3	9	0.00	5.4392	1\n\
-H	OH1	CT2	CT3	9	0.00	1.2552	2\n\
-H	OH1	CT2	CT3	9	0.00	1.75728	3\n\
-HA1	CC	NH2	H	9	180.00	5.8576	2\n\
-HA2	CP3	N	C	9	180.00	0.0	3\n\
-HA2	CP3	N	CP1	9	0.00	0.4184	3\n\
-HA2	CP3	NP	CP1	9	0.00	0.33472	3\n\
-HA1	CT1	CT2	CA	9	0.00	0.16736	3\n\
-HA2	CT2	CPH1	CPH1	9	0.00	0.0	3\n\
-HA2	CT2	NH1	C	9	0.00	0.0	3\n\
-HA2	CT2	NH1	H	9	0.00	0.0	3\n\
-HA2	CT2	S	CT3	9	0.00	1.17152	3\n\
-HA3	CT3	CPH1	CPH1	9	0.00	0.0	3\n\
-HA3	CT3	CS	HA2	9	0.00	0.66944	3\n\
-HA3	CT3	CS	HA3	9	0.00	0.66944	3\n\
-HA3	CT3	CT2	CA	9	0.00	0.16736	3\n\
-HA3	CT3	NH1	C	9	0.00	0.0	3\n\
-HA3	CT3	NH1	H	9	0.00	0.0	3\n\
-HA3	CT3	S	CT2	9	0.00	1.17152	3\n\
-HE1	CE1	CE1	HE1	9	180.00	4.184	2\n\
-CT3	CE1	CE1	HE1	9	180.00	4.184	2\n\
-HE1	CE1	CE2	HE2	9	180.00	21.7568	2\n\
-HE1	CE1	CT2	HA2	9	0.00	0.0	3\n\
-HE1	CE1	CT2	CT3	9	0.00	0.50208	3\n\
-HE1	CE1	CT3	HA3	9	0.00	0.0	3\n\
-HE2	CE2	CE1	CT2	9	180.00	21.7568	2\n\
-HB1	CP1	N	C	9	0.00	3.3472	3\n\
-HB1	CP1	N	CP3	9	0.00	0.4184	3\n\
-HB1	CP1	NP	CP3	9	0.00	0.33472	3\n\
-HB1	CT1	NH1	C	9	0.00	0.0	1\n\
-HB1	CT1	NH1	H	9	0.00	0.0	1\n\
-HB2	CT2	NH1	C	9	0.00	0.0	1\n\
-HB2	CT2	NH1	H	9	0.00	0.0	1\n\
-HC	NH2	CT2	HB2	9	0.00	0.46024	3\n\
-HC	NH2	CT2	CD	9	0.00	0.46024	3\n\
-HC	NH2	CT2	CT2	9	0.00	0.46024	3\n\
-HC	NH2	CT2	HA2	9	0.00	0.46024	3\n\
-HC	NP	CP1	C	9	0.00	0.33472	3\n\
-HC	NP	CP1	CC	9	0.00	0.33472	3\n\
-HC	NP	CP1	CD	9	0.00	0.33472	3\n\
-HC	NP	CP1	CP2	9	0.00	0.33472	3\n\
-HC	NP	CP1	HB1	9	0.00	0.33472	3\n\
-HC	NP	CP3	CP2	9	0.00	0.33472	3\n\
-HC	NP	CP3	HA2	9	0.00	0.33472	3\n\
-HP	CA	CA	CA	9	180.00	17.5728	2\n\
-HP	CA	CA	CT2	9	180.00	17.5728	2\n\
-HP	CA	CA	CT3	9	180.00	17.5728	2\n\
-HP	CA	CA	HP	9	180.00	10.0416	2\n\
-HR1	CPH1	CPH1	CT2	9	180.00	4.184	2\n\
-HR1	CPH1	CPH1	CT3	9	180.00	4.184	2\n\
-HR1	CPH1	CPH1	HR1	9	180.00	4.184	2\n\
-HR1	CPH1	NR3	CPH2	9	180.00	10.46	2\n\
-HR1	CPH1	NR3	H	9	180.00	12.552	2\n\
-HR1	CPH2	NR1	CPH1	9	180.00	12.552	2\n\
-HR1	CPH2	NR1	H	9	180.00	4.184	2\n\
-HR1	CPH2	NR2	CPH1	9	180.00	12.552	2\n\
-HR2	CPH2	NR3	CPH1	9	180.00	12.552	2\n\
-HR2	CPH2	NR3	H	9	180.00	0.0	2\n\
-HR3	CPH1	CPH1	CT2	9	180.00	8.368	2\n\
-HR3	CPH1	CPH1	CT3	9	180.00	8.368	2\n\
-HR3	CPH1	CPH1	HR3	9	180.00	8.368	2\n\
-HR3	CPH1	NR1	CPH2	9	180.00	12.552	2\n\
-HR3	CPH1	NR1	H	9	180.00	4.184	2\n\
-HR3	CPH1	NR2	CPH2	9	180.00	12.552	2\n\
-HS	S	CT2	CT3	9	0.00	1.00416	1\n\
-HS	S	CT2	CT3	9	0.00	0.6276	2\n\
-HS	S	CT2	CT3	9	0.00	1.12968	3\n\
-HS	S	CT2	HA2	9	0.00	0.8368	3\n\
-HS	S	CT3	HA3	9	0.00	0.8368	3\n\
-N	C	CP1	CP2	9	0.00	1.6736	1\n\
-N	C	CP1	CP2	9	0.00	2.5104	2\n\
-N	C	CP1	HB1	9	180.00	1.6736	1\n\
-N	C	CP1	HB1	9	0.00	2.5104	2\n\
-N	C	CP1	N	9	0.00	1.2552	1\n\
-N	C	CP1	N	9	0.00	-1.2552	4\n\
-N	C	CT1	CT1	9	-103.0	2.092	1\n\
-N	C	CT1	CT2	9	-103.0	2.092	1\n\
-N	C	CT1	CT3	9	-103.0	2.092	1\n\
-N	C	CT1	HB1	9	0.00	0.0	1\n\
-N	C	CT2	HB2	9	0.00	0.0	1\n\
-N	C	CT3	HA3	9	0.00	0.0	1\n\
-N	CT1	CT2	CA	9	0.00	0.16736	3\n\
-NH1	C	CP1	CP2	9	0.00	1.6736	1\n\
-NH1	C	CP1	CP2	9	0.00	2.5104	2\n\
-NH1	C	CP1	HB1	9	180.00	1.6736	1\n\
-NH1	C	CP1	HB1	9	0.00	2.5104	2\n\
-NH1	C	CP1	N	9	0.00	1.2552	1\n\
-NH1	C	CP1	N	9	0.00	-1.2552	4\n\
-NH1	C	CT1	CT1	9	-103.0	2.092	1\n\
-NH1	C	CT1	CT2	9	-103.0	2.092	1\n\
-NH1	C	CT1	CT3	9	-103.0	2.092	1\n\
-NH1	C	CT1	HB1	9	0.00	0.0	1\n\
-NH1	C	CT1	NH1	9	0.00	2.5104	1\n\
-NH1	C	CT2	CT2	9	0.00	0.0	1\n\
-NH1	C	CT2	HA2	9	0.00	0.0	3\n\
-NH1	C	CT2	HB2	9	0.00	0.0	1\n\
-NH1	C	CT2	NH1	9	0.00	2.5104	1\n\
-NH1	C	CT3	HA3	9	0.00	0.0	3\n\
-NH1	CT1	C	N	9	0.00	1.6736	1\n\
-NH1	CT2	C	N	9	0.00	1.6736	1\n\
-NH2	CC	CP1	CP2	9	0.00	1.6736	1\n\
-NH2	CC	CP1	CP2	9	0.00	2.5104	2\n\
-NH2	CC	CP1	HB1	9	180.00	1.6736	1\n\
-NH2	CC	CP1	HB1	9	0.00	2.5104	2\n\
-NH2	CC	CP1	N	9	0.00	1.2552	1\n\
-NH2	CC	CP1	N	9	0.00	-1.2552	4\n\
-NH2	CC	CT2	HA2	9	180.00	0.0	3\n\
-NH3	CT1	C	N	9	0.00	1.6736	1\n\
-NH3	CT1	C	NH1	9	0.00	2.5104	1\n\
-NH3	CT1	CC	NH2	9	0.00	1.6736	1\n\
-NH3	CT2	C	N	9	0.00	1.6736	1\n\
-NH3	CT2	C	NH1	9	0.00	4.184	1\n\
-NH3	CT2	CC	NH2	9	0.00	1.6736	1\n\
-NP	CP1	C	N	9	0.00	1.2552	1\n\
-NP	CP1	C	NH1	9	0.00	1.2552	1\n\
-NP	CP1	CC	NH2	9	0.00	1.2552	1\n\
-NR1	CPH1	CPH1	CT2	9	180.00	12.552	2\n\
-NR1	CPH1	CPH1	CT3	9	180.00	12.552	2\n\
-NR1	CPH1	CPH1	HR3	9	180.00	12.552	2\n\
-NR1	CPH1	CT2	CT2	9	0.00	0.79496	3\n\
-NR1	CPH1	CT2	CT3	9	0.00	0.79496	3\n\
-NR1	CPH1	CT2	HA2	9	0.00	0.79496	3\n\
-NR1	CPH1	CT3	HA3	9	0.00	0.79496	3\n\
-NR1	CPH2	NR2	CPH1	9	180.00	58.576	2\n\
-NR2	CPH1	CPH1	CT2	9	180.00	12.552	2\n\
-NR2	CPH1	CPH1	CT3	9	180.00	12.552	2\n\
-NR2	CPH1	CPH1	HR3	9	180.00	12.552	2\n\
-NR2	CPH1	CPH1	NR1	9	180.00	58.576	2\n\
-NR2	CPH1	CT2	CT2	9	0.00	0.79496	3\n\
-NR2	CPH1	CT2	CT3	9	0.00	0.79496	3\n\
-NR2	CPH1	CT2	HA2	9	0.00	0.79496	3\n\
-NR2	CPH1	CT3	HA3	9	0.00	0.79496	3\n\
-NR2	CPH2	NR1	CPH1	9	180.00	58.576	2\n\
-NR2	CPH2	NR1	H	9	180.00	4.184	2\n\
-NR3	CPH1	CPH1	CT2	9	180.00	10.46	2\n\
-NR3	CPH1	CPH1	CT3	9	180.00	10.46	2\n\
-NR3	CPH1	CPH1	HR1	9	180.00	10.46	2\n\
-NR3	CPH1	CPH1	NR3	9	180.00	50.208	2\n\
-NR3	CPH1	CT2	CT2	9	0.00	0.79496	3\n\
-NR3	CPH1	CT2	CT3	9	0.00	0.79496	3\n\
-NR3	CPH1	CT2	HA2	9	0.00	0.79496	3\n\
-NR3	CPH1	CT3	HA3	9	0.00	0.79496	3\n\
-NR3	CPH2	NR3	CPH1	9	180.00	50.208	2\n\
-NR3	CPH2	NR3	H	9	180.00	5.8576	2\n\
-O	C	CP1	CP2	9	180.00	1.6736	1\n\
-O	C	CP1	CP2	9	0.00	2.5104	2\n\
-O	C	CP1	HB1	9	0.00	1.6736	1\n\
-O	C	CP1	HB1	9	0.00	2.5104	2\n\
-O	C	CP1	N	9	0.00	-1.2552	4\n\
-O	C	CT1	CT1	9	0.00	5.8576	1\n\
-O	C	CT1	CT2	9	0.00	5.8576	1\n\
-O	C	CT1	CT3	9	0.00	5.8576	1\n\
-O	C	CT1	HB1	9	0.00	0.0	1\n\
-O	C	CT1	NH1	9	0.00	0.0	1\n\
-O	C	CT1	NH3	9	0.00	0.0	1\n\
-O	C	CT2	CT2	9	0.00	5.8576	1\n\
-O	C	CT2	HA2	9	180.00	0.0	3\n\
-O	C	CT2	HB2	9	0.00	0.0	1\n\
-O	C	CT2	NH1	9	0.00	0.0	1\n\
-O	C	CT2	NH3	9	0.00	0.0	1\n\
-O	C	CT3	HA3	9	180.00	0.0	3\n\
-O	C	N	CP1	9	180.00	11.506	2\n\
-O	C	N	CP1	9	0.00	1.2552	4\n\
-O	C	N	CP3	9	180.00	11.506	2\n\
-O	C	N	CP3	9	0.00	1.2552	4\n\
-O	C	NH1	CT1	9	180.00	10.46	2\n\
-O	C	NH1	CT2	9	180.00	10.46	2\n\
-O	C	NH1	CT3	9	180.00	10.46	2\n\
-O	C	NH1	H	9	180.00	10.46	2\n\
-O	CC	CP1	CP2	9	180.00	1.6736	1\n\
-O	CC	CP1	CP2	9	0.00	2.5104	2\n\
-O	CC	CP1	HB1	9	0.00	1.6736	1\n\
-O	CC	CP1	HB1	9	0.00	2.5104	2\n\
-O	CC	CP1	N	9	0.00	-1.2552	4\n\
-O	CC	CT2	HA2	9	180.00	0.0	3\n\
-O	CC	NH2	H	9	180.00	5.8576	2\n\
-OB	CD	OS	CT2	9	180.00	4.03756	1\n\
-OB	CD	OS	CT2	9	180.00	16.1084	2\n\
-OB	CD	OS	CT3	9	180.00	4.03756	1\n\
-OB	CD	OS	CT3	9	180.00	16.1084	2\n\
-OC	CA	CA	CA	9	180.00	12.9704	2\n\
-OC	CA	CA	HP	9	180.00	17.5728	2\n\
-OC	CC	CP1	CP2	9	0.00	0.66944	3\n\
-OC	CC	CP1	HB1	9	0.00	0.66944	3\n\
-OC	CC	CP1	N	9	0.00	0.66944	3\n\
-OC	CC	CP1	NP	9	0.00	0.66944	3\n\
-OC	CC	CT1	NH3	9	180.00	13.3888	2\n\
-OC	CC	CT2	NH3	9	180.00	13.3888	2\n\
-OH1	CA	CA	CA	9	180.00	12.9704	2\n\
-OH1	CA	CA	HP	9	180.00	17.5728	2\n\
-S	CT2	CT2	HA2	9	0.00	0.04184	3\n\
-SM	CT2	CT2	HA2	9	0.00	0.04184	3\n\
-SM	SM	CT2	CT1	9	0.00	1.29704	3\n\
-SM	SM	CT2	CT2	9	0.00	1.29704	3\n\
-SM	SM	CT2	CT3	9	0.00	1.29704	3\n\
-SM	SM	CT2	HA2	9	0.00	0.661072	3\n\
-SM	SM	CT3	HA3	9	0.00	0.661072	3\n\
-SS	CS	CT3	HA3	9	0.00	0.6276	3\n\
-NH1	CT1	CT1	HA1	9	0.00	0.8368	3\n\
-HB1	CT1	CT1	HA1	9	0.00	0.8368	3\n\
-HB1	CT1	CT1	CT3	9	0.00	0.8368	3\n\
-HA1	CT1	CT1	C	9	0.00	0.8368	3\n\
-NH1	CT1	CT2	HA2	9	0.00	0.8368	3\n\
-HB1	CT1	CT2	HA2	9	0.00	0.8368	3\n\
-HB1	CT1	CT2	OH1	9	0.00	0.8368	3\n\
-HB1	CT1	CT2	CT2	9	0.00	0.8368	3\n\
-HA2	CT2	CT1	C	9	0.00	0.8368	3\n\
-HA2	CT2	OH1	H	9	0.00	0.58576	3\n\
-CT1	CT2	CT2	HA2	9	0.00	0.79496	3\n\
-HA2	CT2	CT2	HA2	9	0.00	0.79496	3\n\
-HA2	CT2	CT2	CC	9	0.00	0.79496	3\n\
-HB1	CT1	CT2	S	9	0.00	0.8368	3\n\
-CT2	CT2	CT2	HA2	9	0.00	0.79496	3\n\
-CT2	CT2	CT2	NC2	9	0.00	0.79496	3\n\
-CT2	CT2	NC2	HC	9	180.00	0.0	6\n\
-CT2	CT2	NC2	C	9	180.00	0.0	6\n\
-HA2	CT2	CT2	NC2	9	0.00	0.79496	3\n\
-CT2	NC2	C	NC2	9	180.00	9.414	2\n\
-HA2	CT2	NC2	HC	9	180.00	0.0	6\n\
-HA2	CT2	NC2	C	9	180.00	0.0	6\n\
-NC2	C	NC2	HC	9	180.00	9.414	2\n\
-HB1	CT1	CT2	CC	9	0.00	0.8368	3\n\
-HB1	CT1	CT2	CY	9	0.00	0.8368	3\n\
-HA2	CT2	CC	OC	9	180.00	0.2092	6\n\
-HB1	CT1	CT2	CPH1	9	0.00	0.8368	3\n\
-CT1	CT1	CT3	HA3	9	0.00	0.8368	3\n\
-CT1	CT1	CT2	HA2	9	0.00	0.8368	3\n\
-HB1	CT1	CT1	CT2	9	0.00	0.8368	3\n\
-CT1	CT2	CT3	HA3	9	0.00	0.66944	3\n\
-HA1	CT1	CT3	HA3	9	0.00	0.8368	3\n\
-HA1	CT1	CT2	HA2	9	0.00	0.8368	3\n\
-HA1	CT1	CT2	CT3	9	0.00	0.8368	3\n\
-CT3	CT1	CT2	HA2	9	0.00	0.8368	3\n\
-CT3	CT1	CT2	CT3	9	0.00	0.8368	3\n\
-HA3	CT3	CT1	CT2	9	0.00	0.8368	3\n\
-HA2	CT2	CT3	HA3	9	0.00	0.66944	3\n\
-CT1	CT2	CT1	HA1	9	0.00	0.8368	3\n\
-HB1	CT1	CT2	CT1	9	0.00	0.8368	3\n\
-CT3	CT1	CT3	HA3	9	0.00	0.8368	3\n\
-CT2	CT2	CT2	NH3	9	0.00	0.79496	3\n\
-CT2	CT2	NH3	HC	9	0.00	0.4184	3\n\
-HA2	CT2	CT2	NH3	9	0.00	0.79496	3\n\
-HA2	CT2	NH3	HC	9	0.00	0.4184	3\n\
-HB1	CT1	CT2	CA	9	0.00	0.8368	3\n\
-HA2	CT2	CA	CA	9	0.00	0.0	6\n\
-HB1	CT1	CT1	OH1	9	0.00	0.8368	3\n\
-HA1	CT1	OH1	H	9	0.00	0.58576	3\n\
-OH1	CT1	CT3	HA3	9	0.00	0.8368	3\n\
-CT2	CT2	CC	O	9	180.00	0.2092	6\n\
-CT2	CT2	CC	NH2	9	180.00	0.2092	6\n\
-CT2	CT2	CC	OC	9	180.00	0.2092	6\n\
-NH1	CT1	CT2A	HA2	9	0.00	0.8368	3\n\
-CT1	CT2A	CT2	HA2	9	0.00	0.79496	3\n\
-HB1	CT1	CT2A	HA2	9	0.00	0.8368	3\n\
-HB1	CT1	CT2A	CT2	9	0.00	0.8368	3\n\
-HA2	CT2A	CT1	C	9	0.00	0.8368	3\n\
-HA2	CT2A	CT1	CC	9	0.00	0.8368	3\n\
-HA2	CT2A	CT2	HA2	9	0.00	0.79496	3\n\
-HA2	CT2A	CT2	CC	9	0.00	0.79496	3\n\
-HB1	CT1	CT2A	CPH1	9	0.00	0.8368	3\n\
-C	NH1	CT1	CT2A	9	0.00	7.5312	1\n\
-H	NH1	CT1	CT2A	9	0.00	0.0	1\n\
-CT2A	CT1	C	O	9	0.00	5.8576	1\n\
-CT2A	CT1	C	NH1	9	0.00	0.0	1\n\
-CT2A	CT1	C	N	9	0.00	0.0	1\n\
-CT1	CT2A	CT2	CD	9	0.00	0.79496	3\n\
-HA2	CT2A	CT2	CD	9	0.00	0.79496	3\n\
-CT2A	CPH1	CPH1	HR1	9	180.00	4.184	2\n\
-CT2A	CPH1	CPH1	NR3	9	180.00	10.46	2\n\
-CT2A	CPH1	NR3	H	9	180.00	12.552	2\n\
-CT2A	CPH1	NR3	CPH2	9	180.00	10.46	2\n\
-HA2	CT2A	CPH1	CPH1	9	0.00	0.0	3\n\
-HA2	CT2A	CPH1	NR3	9	0.00	0.79496	3\n\
-C	CT1	CT2	CT2	9	180.00	1.4644	1\n\
-C	CT1	CT2	CT2	9	180.00	1.75728	2\n\
-C	CT1	CT2	CT2	9	180.00	7.99144	3\n\
-CT2	CT2	CT1	NH1	9	180.00	3.68192	1\n\
-CT2	CT2	CT1	NH1	9	180.00	0.0	2\n\
-CT2	CT2	CT1	NH1	9	0.00	7.9496	3\n\
-CC	CT2	CT2	CT1	9	180.00	7.69856	1\n\
-CC	CT2	CT2	CT1	9	180.00	3.51456	2\n\
-CC	CT2	CT2	CT1	9	180.00	1.63176	3\n\
-CT1	CT2	CT2	CT2	9	180.00	2.63592	1\n\
-CT1	CT2	CT2	CT2	9	0.00	0.04184	2\n\
-CT1	CT2	CT2	CT2	9	0.00	0.6276	3\n\
-CT1	CT2	CT2	S	9	180.00	0.58576	1\n\
-CT1	CT2	CT2	S	9	0.00	2.25936	2\n\
-CT1	CT2	CT2	S	9	0.00	2.88696	3\n\
-C	CT1	CT2	CC	9	180.00	5.89944	1\n\
-C	CT1	CT2	CC	9	180.00	5.39736	2\n\
-C	CT1	CT2	CC	9	180.00	2.46856	3\n\
-CC	CT2	CT1	NH1	9	180.00	1.17152	1\n\
-CC	CT2	CT1	NH1	9	180.00	2.092	2\n\
-CC	CT2	CT1	NH1	9	0.00	1.58992	3\n\
-CT1	CT2	CC	NH2	9	180.00	2.59408	1\n\
-CT1	CT2	CC	NH2	9	180.00	2.76144	2\n\
-CT1	CT2	CC	NH2	9	180.00	3.01248	3\n\
-CT1	CT2	CC	O	9	180.00	1.75728	1\n\
-CT1	CT2	CC	O	9	180.00	0.6276	2\n\
-CT1	CT2	CC	O	9	180.00	3.9748	3\n\
-C	CT1	CT2A	CC	9	180.00	6.73624	1\n\
-C	CT1	CT2A	CC	9	180.00	5.39736	2\n\
-C	CT1	CT2A	CC	9	180.00	2.46856	3\n\
-CC	CT2A	CT1	NH1	9	180.00	2.84512	1\n\
-CC	CT2A	CT1	NH1	9	180.00	0.4184	2\n\
-CC	CT2A	CT1	NH1	9	0.00	1.58992	3\n\
-CT1	CT2A	CC	OC	9	0.00	3.51456	1\n\
-CT1	CT2A	CC	OC	9	180.00	4.10032	2\n\
-CT1	CT2A	CC	OC	9	0.00	6.10864	3\n\
-CT1	CT2	S	HS	9	0.00	0.8368	1\n\
-CT1	CT2	S	HS	9	0.00	2.7196	2\n\
-CT1	CT2	S	HS	9	0.00	0.92048	3\n\
-C	CT1	CT2	S	9	180.00	1.00416	1\n\
-C	CT1	CT2	S	9	180.00	3.138	2\n\
-C	CT1	CT2	S	9	180.00	5.6484	3\n\
-NH1	CT1	CT2	S	9	0.00	1.42256	1\n\
-NH1	CT1	CT2	S	9	180.00	2.092	2\n\
-NH1	CT1	CT2	S	9	0.00	5.98312	3\n\
-CC	CT2	CT2A	CT1	9	180.00	0.0	1\n\
-CC	CT2	CT2A	CT1	9	180.00	1.58992	2\n\
-CC	CT2	CT2A	CT1	9	180.00	2.46856	3\n\
-C	CT1	CT2A	CT2	9	0.00	0.46024	1\n\
-C	CT1	CT2A	CT2	9	180.00	4.10032	2\n\
-C	CT1	CT2A	CT2	9	180.00	6.6944	3\n\
-CC	CT1	CT2A	CT2	9	180.00	6.6944	3\n\
-CT2	CT2A	CT1	NH1	9	0.00	1.2552	1\n\
-CT2	CT2A	CT1	NH1	9	0.00	1.4644	2\n\
-CT2	CT2A	CT1	NH1	9	0.00	7.36384	3\n\
-CPH1	CPH1	CT2	CT1	9	0.00	7.28016	1\n\
-CPH1	CPH1	CT2	CT1	9	0.00	0.6276	2\n\
-CPH1	CPH1	CT2	CT1	9	180.00	3.22168	3\n\
-CT1	CT2	CPH1	NR1	9	0.00	6.23416	1\n\
-CT1	CT2	CPH1	NR1	9	180.00	0.37656	2\n\
-CT1	CT2	CPH1	NR1	9	180.00	3.30536	3\n\
-CT1	CT2	CPH1	NR2	9	0.00	4.56056	1\n\
-CT1	CT2	CPH1	NR2	9	0.00	0.37656	2\n\
-CT1	CT2	CPH1	NR2	9	180.00	2.80328	3\n\
-C	CT1	CT2	CPH1	9	180.00	0.75312	1\n\
-C	CT1	CT2	CPH1	9	180.00	2.67776	2\n\
-C	CT1	CT2	CPH1	9	180.00	3.64008	3\n\
-CPH1	CT2	CT1	NH1	9	0.00	0.0	1\n\
-CPH1	CT2	CT1	NH1	9	180.00	0.0	2\n\
-CPH1	CT2	CT1	NH1	9	0.00	3.7656	3\n\
-CPH1	CPH1	CT2A	CT1	9	0.00	8.53536	1\n\
-CPH1	CPH1	CT2A	CT1	9	0.00	1.84096	2\n\
-CPH1	CPH1	CT2A	CT1	9	180.00	0.54392	3\n\
-CT1	CT2A	CPH1	NR3	9	180.00	2.21752	1\n\
-CT1	CT2A	CPH1	NR3	9	180.00	1.75728	2\n\
-CT1	CT2A	CPH1	NR3	9	180.00	1.2552	3\n\
-C	CT1	CT2A	CPH1	9	180.00	7.322	1\n\
-C	CT1	CT2A	CPH1	9	0.00	0.54392	2\n\
-C	CT1	CT2A	CPH1	9	180.00	7.78224	3\n\
-CPH1	CT2A	CT1	NH1	9	180.00	4.56056	1\n\
-CPH1	CT2A	CT1	NH1	9	180.00	0.92048	2\n\
-CPH1	CT2A	CT1	NH1	9	0.00	9.70688	3\n\
-CT1	CT1	CT2	CT3	9	180.00	1.58992	1\n\
-CT1	CT1	CT2	CT3	9	180.00	0.54392	2\n\
-CT1	CT1	CT2	CT3	9	180.00	1.21336	3\n\
-C	CT1	CT1	CT2	9	180.00	0.4184	1\n\
-C	CT1	CT1	CT2	9	180.00	2.17568	2\n\
-C	CT1	CT1	CT2	9	180.00	1.21336	3\n\
-CT2	CT1	CT1	NH1	9	180.00	0.50208	1\n\
-CT2	CT1	CT1	NH1	9	180.00	1.50624	2\n\
-CT2	CT1	CT1	NH1	9	0.00	1.71544	3\n\
-CT1	CT2	CT1	CT3	9	0.00	0.2092	1\n\
-CT1	CT2	CT1	CT3	9	180.00	0.4184	2\n\
-CT1	CT2	CT1	CT3	9	180.00	0.04184	3\n\
-C	CT1	CT2	CT1	9	180.00	1.33888	1\n\
-C	CT1	CT2	CT1	9	180.00	2.55224	2\n\
-C	CT1	CT2	CT1	9	180.00	3.01248	3\n\
-CT1	CT2	CT1	NH1	9	180.00	2.00832	1\n\
-CT1	CT2	CT1	NH1	9	180.00	1.75728	2\n\
-CT1	CT2	CT1	NH1	9	0.00	2.7196	3\n\
-CA	CA	CT2	CT1	9	0.00	4.47688	1\n\
-CA	CA	CT2	CT1	9	180.00	1.00416	2\n\
-CA	CA	CT2	CT1	9	180.00	0.71128	3\n\
-C	CT1	CT2	CA	9	180.00	5.35552	1\n\
-C	CT1	CT2	CA	9	180.00	3.93296	2\n\
-C	CT1	CT2	CA	9	180.00	6.56888	3\n\
-CA	CT2	CT1	NH1	9	180.00	2.17568	1\n\
-CA	CT2	CT1	NH1	9	180.00	2.59408	2\n\
-CA	CT2	CT1	NH1	9	0.00	6.61072	3\n\
-CT1	CT2	OH1	H	9	0.00	0.08368	1\n\
-CT1	CT2	OH1	H	9	0.00	2.34304	2\n\
-CT1	CT2	OH1	H	9	0.00	2.05016	3\n\
-C	CT1	CT2	OH1	9	180.00	2.7196	1\n\
-C	CT1	CT2	OH1	9	180.00	1.046	2\n\
-C	CT1	CT2	OH1	9	180.00	4.89528	3\n\
-NH1	CT1	CT2	OH1	9	180.00	0.75312	1\n\
-NH1	CT1	CT2	OH1	9	180.00	0.79496	2\n\
-NH1	CT1	CT2	OH1	9	0.00	6.10864	3\n\
-CT1	CT1	OH1	H	9	0.00	0.75312	1\n\
-CT1	CT1	OH1	H	9	0.00	0.25104	2\n\
-CT1	CT1	OH1	H	9	0.00	1.046	3\n\
-C	CT1	CT1	OH1	9	180.00	3.30536	1\n\
-C	CT1	CT1	OH1	9	180.00	1.63176	2\n\
-C	CT1	CT1	OH1	9	180.00	4.14216	3\n\
-NH1	CT1	CT1	OH1	9	0.00	0.37656	1\n\
-NH1	CT1	CT1	OH1	9	180.00	0.79496	2\n\
-NH1	CT1	CT1	OH1	9	0.00	0.71128	3\n\
-CA	CY	CT2	CT1	9	0.00	0.12552	1\n\
-CA	CY	CT2	CT1	9	0.00	2.3012	2\n\
-CA	CY	CT2	CT1	9	180.00	1.63176	3\n\
-CPT	CY	CT2	CT1	9	180.00	1.50624	1\n\
-CPT	CY	CT2	CT1	9	0.00	0.2092	2\n\
-CPT	CY	CT2	CT1	9	180.00	0.79496	3\n\
-C	CT1	CT2	CY	9	180.00	4.56056	1\n\
-C	CT1	CT2	CY	9	180.00	2.092	2\n\
-C	CT1	CT2	CY	9	180.00	4.89528	3\n\
-CY	CT2	CT1	NH1	9	180.00	1.21336	1\n\
-CY	CT2	CT1	NH1	9	180.00	2.76144	2\n\
-CY	CT2	CT1	NH1	9	0.00	4.89528	3\n\
-C	CT1	CT1	CT3	9	180.00	0.58576	1\n\
-C	CT1	CT1	CT3	9	180.00	1.08784	2\n\
-C	CT1	CT1	CT3	9	180.00	1.38072	3\n\
-CT3	CT1	CT1	NH1	9	0.00	0.75312	1\n\
-CT3	CT1	CT1	NH1	9	0.00	0.25104	2\n\
-CT3	CT1	CT1	NH1	9	0.00	2.46856	3\n\
-H	NH1	CT2A	CC	9	0.00	0.0	1\n\
-HB1	CT1	CT2A	CC	9	0.00	0.8368	3\n\
-HA2	CT2A	CC	OC	9	180.00	0.2092	6\n\
-NH3	CT1	CT2A	HA2	9	0.00	0.8368	3\n\
-NH3	CT1	CT2A	CC	9	0.00	0.8368	3\n\
-CC	CT2A	CT1	CC	9	0.00	0.8368	3\n\
-X	CS	SS	X	9	0.20	0.0	3\n\
-X	C	NC2	X	9	180.00	9.414	2\n\
-X	CD	OH1	X	9	180.00	8.5772	2\n\
-X	CD	OS	X	9	180.00	8.5772	2\n\
-X	CE1	CE1	X	9	0.00	0.6276	1\n\
-X	CE1	CE1	X	9	180.00	35.564	2\n\
-X	CE2	CE2	X	9	180.00	20.5016	2\n\
-X	CP1	C	X	9	180.00	0.0	6\n\
-X	CP1	CC	X	9	180.00	0.0	6\n\
-X	CP1	CD	X	9	180.00	0.0	6\n\
-X	CP1	CP2	X	9	0.00	0.58576	3\n\
-X	CP2	CP2	X	9	0.00	0.66944	3\n\
-X	CP3	CP2	X	9	0.00	0.58576	3\n\
-X	CT1	CC	X	9	180.00	0.2092	6\n\
-X	CT1	CD	X	9	180.00	0.0	6\n\
-X	CT1	CT1	X	9	0.00	0.8368	3\n\
-X	CT1	CT2	X	9	0.00	0.8368	3\n\
-X	CT1	CT3	X	9	0.00	0.8368	3\n\
-X	CT1	NH3	X	9	0.00	0.4184	3\n\
-X	CT1	OH1	X	9	0.00	0.58576	3\n\
-X	CT1	OS	X	9	0.00	-0.4184	3\n\
-X	CT2	CA	X	9	0.00	0.0	6\n\
-X	CT2	CC	X	9	180.00	0.2092	6\n\
-X	CT2	CD	X	9	180.00	0.0	6\n\
-X	CT2	CT2	X	9	0.00	0.79496	3\n\
-X	CT2	CT3	X	9	0.00	0.66944	3\n\
-X	CT2	NC2	X	9	180.00	0.0	6\n\
-X	CT2	NH3	X	9	0.00	0.4184	3\n\
-X	CT2	OH1	X	9	0.00	0.58576	3\n\
-X	CT2	OS	X	9	0.00	-0.4184	3\n\
-X	CT3	CA	X	9	0.00	0.0	6\n\
-X	CT3	CC	X	9	180.00	0.2092	6\n\
-X	CT3	CD	X	9	180.00	0.0	6\n\
-X	CT3	CT3	X	9	0.00	0.63806	3\n\
-X	CT3	NC2	X	9	180.00	0.0	6\n\
-X	CT3	NH2	X	9	0.00	0.46024	3\n\
-X	CT3	NH3	X	9	0.00	0.37656	3\n\
-X	CT3	OH1	X	9	0.00	0.58576	3\n\
-X	CT3	OS	X	9	0.00	-0.4184	3\n\
-X	CT2A	CC	X	9	180.00	0.2092	6\n";
-
-}
-#endif
@@ -0,0 +1,723 @@
+// torsion_parameters.h --- Typed table of the parameters in torsion.itp
+// Generated by generate_parameter_tables.cmake from torsion.itp. Do not edit.
+// Copyright (C) 2026 agent
+// Copyright (c) 1991-2000, University of Groningen, The Netherlands.
+// Copyright (c) 2001-2004, The GROMACS development team,
+//
+// This file is part of Phaistos
+//
+// Phaistos is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Phaistos is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Phaistos.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+#ifndef TERM_CHARMM_TORSION_PARAMETERS_H
+#define TERM_CHARMM_TORSION_PARAMETERS_H
+
+#include "atom_types.h"
+
+namespace charmm_parameters {
+
+//! Torsion parameters (from torsion.itp)
+struct TorsionRecord {
+     AtomTypeId type1;
+     AtomTypeId type2;
+     AtomTypeId type3;
+     AtomTypeId type4;
+     double phi0;
+     double cp;
+     unsigned int mult;
+};
+
+//! Number of entries in torsion_parameters
+const unsigned int N_TORSION_PARAMETERS = 673;
+
+//! Torsion parameters (from torsion.itp)
+const TorsionRecord torsion_parameters[N_TORSION_PARAMETERS] = {
+     {ATOM_TYPE_CT1, ATOM_TYPE_CT2, ATOM_TYPE_CC, ATOM_TYPE_OC, 0.00, 3.51456, 1},
+     {ATOM_TYPE_CT1, ATOM_TYPE_CT2, ATOM_TYPE_CC, ATOM_TYPE_OC, 180.00, 4.10032, 2},
+     {ATOM_TYPE_CT1, ATOM_TYPE_CT2, ATOM_TYPE_CC, ATOM_TYPE_OC, 0.00, 6.10864, 3},
+     {ATOM_TYPE_NH2, ATOM_TYPE_CT1, ATOM_TYPE_C, ATOM_TYPE_O, 0.00, 0.0, 1},
+     {ATOM_TYPE_NH2, ATOM_TYPE_CT1, ATOM_TYPE_C, ATOM_TYPE_NH1, 0.00, 0.0, 1},
+     {ATOM_TYPE_H, ATOM_TYPE_NH2, ATOM_TYPE_CT1, ATOM_TYPE_CT1, 0.00, 0.0, 1},
+     {ATOM_TYPE_H, ATOM_TYPE_NH2, ATOM_TYPE_CT1, ATOM_TYPE_C, 0.00, 0.0, 1},
+     {ATOM_TYPE_H, ATOM_TYPE_NH2, ATOM_TYPE_CT1, ATOM_TYPE_HB1, 0.00, 0.46024, 3},
+     {ATOM_TYPE_H, ATOM_TYPE_NH2, ATOM_TYPE_CT1, ATOM_TYPE_CT2, 0.00, 0.46024, 3},
+     {ATOM_TYPE_H, ATOM_TYPE_NH2, ATOM_TYPE_CT1, ATOM_TYPE_CT3, 0.00, 0.46024, 3},
+     {ATOM_TYPE_CAI, ATOM_TYPE_CA, ATOM_TYPE_CA, ATOM_TYPE_CAI, 180.00, 12.9704, 2},
+     {ATOM_TYPE_CA, ATOM_TYPE_CPT, ATOM_TYPE_CPT, ATOM_TYPE_CA, 180.00, 12.552, 2},
+     {ATOM_TYPE_CAI, ATOM_TYPE_CPT, ATOM_TYPE_CPT, ATOM_TYPE_CAI, 180.00, 12.552, 2},
+     {ATOM_TYPE_CA, ATOM_TYPE_CY, ATOM_TYPE_CPT, ATOM_TYPE_CA, 180.00, 12.552, 2},
+     {ATOM_TYPE_CA, ATOM_TYPE_CY, ATOM_TYPE_CPT, ATOM_TYPE_CAI, 180.00, 12.552, 2},
+     {ATOM_TYPE_CA, ATOM_TYPE_NY, ATOM_TYPE_CPT, ATOM_TYPE_CA, 180.00, 12.552, 2},
+     {ATOM_TYPE_CPT, ATOM_TYPE_CA, ATOM_TYPE_CA, ATOM_TYPE_CA, 180.00, 12.552, 2},
+     {ATOM_TYPE_CPT, ATOM_TYPE_CPT, ATOM_TYPE_CA, ATOM_TYPE_CA, 180.00, 12.552, 2},
+     {ATOM_TYPE_CA, ATOM_TYPE_NY, ATOM_TYPE_CPT, ATOM_TYPE_CAI, 180.00, 12.552, 2},
+     {ATOM_TYPE_CPT, ATOM_TYPE_CAI, ATOM_TYPE_CA, ATOM_TYPE_CA, 180.00, 12.552, 2},
+     {ATOM_TYPE_CPT, ATOM_TYPE_CPT, ATOM_TYPE_CAI, ATOM_TYPE_CA, 180.00, 12.552, 2},
+     {ATOM_TYPE_CPT, ATOM_TYPE_CPT, ATOM_TYPE_CY, ATOM_TYPE_CA, 180.00, 20.92, 2},
+     {ATOM_TYPE_CPT, ATOM_TYPE_CPT, ATOM_TYPE_NY, ATOM_TYPE_CA, 180.00, 27.196, 2},
+     {ATOM_TYPE_CT3, ATOM_TYPE_CY, ATOM_TYPE_CPT, ATOM_TYPE_CA, 180.00, 10.46, 2},
+     {ATOM_TYPE_CT3, ATOM_TYPE_CY, ATOM_TYPE_CPT, ATOM_TYPE_CAI, 180.00, 10.46, 2},
+     {ATOM_TYPE_CT3, ATOM_TYPE_CY, ATOM_TYPE_CPT, ATOM_TYPE_CPT, 180.00, 12.552, 2},
+     {ATOM_TYPE_CT2, ATOM_TYPE_CY, ATOM_TYPE_CPT, ATOM_TYPE_CA, 180.00, 10.46, 2},
+     {ATOM_TYPE_CT2, ATOM_TYPE_CY, ATOM_TYPE_CPT, ATOM_TYPE_CAI, 180.00, 10.46, 2},
+     {ATOM_TYPE_CT2, ATOM_TYPE_CY, ATOM_TYPE_CPT, ATOM_TYPE_CPT, 180.00, 12.552, 2},
+     {ATOM_TYPE_CY, ATOM_TYPE_CA, ATOM_TYPE_NY, ATOM_TYPE_CPT, 180.00, 25.104, 2},
+     {ATOM_TYPE_CY, ATOM_TYPE_CPT, ATOM_TYPE_CA, ATOM_TYPE_CA, 180.00, 16.736, 2},
+     {ATOM_TYPE_CY, ATOM_TYPE_CPT, ATOM_TYPE_CPT, ATOM_TYPE_CA, 180.00, 16.736, 2},
+     {ATOM_TYPE_CY, ATOM_TYPE_CPT, ATOM_TYPE_CAI, ATOM_TYPE_CA, 180.00, 16.736, 2},
+     {ATOM_TYPE_CY, ATOM_TYPE_CPT, ATOM_TYPE_CPT, ATOM_TYPE_CAI, 180.00, 16.736, 2},
+     {ATOM_TYPE_H, ATOM_TYPE_NY, ATOM_TYPE_CA, ATOM_TYPE_CY, 180.00, 0.2092, 2},
+     {ATOM_TYPE_H, ATOM_TYPE_NY, ATOM_TYPE_CPT, ATOM_TYPE_CA, 180.00, 0.8368, 2},
+     {ATOM_TYPE_H, ATOM_TYPE_NY, ATOM_TYPE_CPT, ATOM_TYPE_CAI, 180.00, 0.8368, 2},
+     {ATOM_TYPE_H, ATOM_TYPE_NY, ATOM_TYPE_CPT, ATOM_TYPE_CPT, 180.00, 3.5564, 2},
+     {ATOM_TYPE_HP, ATOM_TYPE_CAI, ATOM_TYPE_CA, ATOM_TYPE_CA, 180.00, 17.5728, 2},
+     {ATOM_TYPE_HP, ATOM_TYPE_CA, ATOM_TYPE_CA, ATOM_TYPE_CPT, 180.00, 12.552, 2},
+     {ATOM_TYPE_HP, ATOM_TYPE_CA, ATOM_TYPE_CPT, ATOM_TYPE_CPT, 180.00, 12.552, 2},
+     {ATOM_TYPE_HP, ATOM_TYPE_CA, ATOM_TYPE_CPT, ATOM_TYPE_CY, 180.00, 16.736, 2},
+     {ATOM_TYPE_HP, ATOM_TYPE_CA, ATOM_TYPE_CA, ATOM_TYPE_CAI, 180.00, 17.5728, 2},
+     {ATOM_TYPE_HP, ATOM_TYPE_CA, ATOM_TYPE_CAI, ATOM_TYPE_CPT, 180.00, 12.552, 2},
+     {ATOM_TYPE_HP, ATOM_TYPE_CAI, ATOM_TYPE_CA, ATOM_TYPE_HP, 180.00, 10.0416, 2},
+     {ATOM_TYPE_HP, ATOM_TYPE_CAI, ATOM_TYPE_CPT, ATOM_TYPE_CPT, 180.00, 12.552, 2},
+     {ATOM_TYPE_HP, ATOM_TYPE_CAI, ATOM_TYPE_CPT, ATOM_TYPE_CY, 180.00, 16.736, 2},
+     {ATOM_TYPE_HP, ATOM_TYPE_CA, ATOM_TYPE_CY, ATOM_TYPE_CPT, 180.00, 11.7152, 2},
+     {ATOM_TYPE_HP, ATOM_TYPE_CA, ATOM_TYPE_CY, ATOM_TYPE_CT3, 180.00, 5.0208, 2},
+     {ATOM_TYPE_HP, ATOM_TYPE_CA, ATOM_TYPE_CY, ATOM_TYPE_CT2, 180.00, 5.0208, 2},
+     {ATOM_TYPE_HP, ATOM_TYPE_CA, ATOM_TYPE_NY, ATOM_TYPE_CPT, 180.00, 10.8784, 2},
+     {ATOM_TYPE_HP, ATOM_TYPE_CA, ATOM_TYPE_NY, ATOM_TYPE_H, 180.00, 1.6736, 2},
+     {ATOM_TYPE_HP, ATOM_TYPE_CY, ATOM_TYPE_CA, ATOM_TYPE_HP, 180.00, 4.184, 2},
+     {ATOM_TYPE_HP, ATOM_TYPE_CY, ATOM_TYPE_CPT, ATOM_TYPE_CA, 180.00, 11.7152, 2},
+     {ATOM_TYPE_HP, ATOM_TYPE_CY, ATOM_TYPE_CPT, ATOM_TYPE_CAI, 180.00, 11.7152, 2},
+     {ATOM_TYPE_HP, ATOM_TYPE_CY, ATOM_TYPE_CPT, ATOM_TYPE_CPT, 180.00, 10.8784, 2},
+     {ATOM_TYPE_NY, ATOM_TYPE_CA, ATOM_TYPE_CY, ATOM_TYPE_CPT, 180.00, 20.92, 2},
+     {ATOM_TYPE_NY, ATOM_TYPE_CA, ATOM_TYPE_CY, ATOM_TYPE_CT3, 180.00, 10.46, 2},
+     {ATOM_TYPE_NY, ATOM_TYPE_CA, ATOM_TYPE_CY, ATOM_TYPE_CT2, 180.00, 10.46, 2},
+     {ATOM_TYPE_NY, ATOM_TYPE_CA, ATOM_TYPE_CY, ATOM_TYPE_HP, 180.00, 14.644, 2},
+     {ATOM_TYPE_NY, ATOM_TYPE_CPT, ATOM_TYPE_CA, ATOM_TYPE_CA, 180.00, 12.552, 2},
+     {ATOM_TYPE_NY, ATOM_TYPE_CPT, ATOM_TYPE_CA, ATOM_TYPE_HP, 180.00, 12.552, 2},
+     {ATOM_TYPE_NY, ATOM_TYPE_CPT, ATOM_TYPE_CPT, ATOM_TYPE_CA, 180.00, 16.736, 2},
+     {ATOM_TYPE_NY, ATOM_TYPE_CPT, ATOM_TYPE_CAI, ATOM_TYPE_CA, 180.00, 12.552, 2},
+     {ATOM_TYPE_NY, ATOM_TYPE_CPT, ATOM_TYPE_CAI, ATOM_TYPE_HP, 180.00, 12.552, 2},
+     {ATOM_TYPE_NY, ATOM_TYPE_CPT, ATOM_TYPE_CPT, ATOM_TYPE_CAI, 180.00, 16.736, 2},
+     {ATOM_TYPE_NY, ATOM_TYPE_CPT, ATOM_TYPE_CPT, ATOM_TYPE_CY, 180.00, 27.196, 2},
+     {ATOM_TYPE_CT3, ATOM_TYPE_CT2, ATOM_TYPE_CY, ATOM_TYPE_CA, 0.00, 1.58992, 2},
+     {ATOM_TYPE_CT3, ATOM_TYPE_CT2, ATOM_TYPE_CY, ATOM_TYPE_CPT, 180.00, 1.046, 2},
+     {ATOM_TYPE_CT3, ATOM_TYPE_CT2, ATOM_TYPE_CY, ATOM_TYPE_CPT, 0.00, 1.2552, 3},
+     {ATOM_TYPE_HA3, ATOM_TYPE_CT3, ATOM_TYPE_CY, ATOM_TYPE_CA, 0.00, 0.04184, 3},
+     {ATOM_TYPE_HA3, ATOM_TYPE_CT3, ATOM_TYPE_CY, ATOM_TYPE_CPT, 0.00, 0.8368, 3},
+     {ATOM_TYPE_HA2, ATOM_TYPE_CT2, ATOM_TYPE_CY, ATOM_TYPE_CA, 0.00, 0.04184, 3},
+     {ATOM_TYPE_HA2, ATOM_TYPE_CT2, ATOM_TYPE_CY, ATOM_TYPE_CPT, 0.00, 0.8368, 3},
+     {ATOM_TYPE_C, ATOM_TYPE_CT1, ATOM_TYPE_NH1, ATOM_TYPE_C, 180.00, 0.8368, 1},
+     {ATOM_TYPE_C, ATOM_TYPE_CT2, ATOM_TYPE_NH1, ATOM_TYPE_C, 180.00, 0.8368, 1},
+     {ATOM_TYPE_C, ATOM_TYPE_N, ATOM_TYPE_CP1, ATOM_TYPE_C, 0.00, 3.3472, 3},
+     {ATOM_TYPE_CA, ATOM_TYPE_CA, ATOM_TYPE_CA, ATOM_TYPE_CA, 180.00, 12.9704, 2},
+     {ATOM_TYPE_CC, ATOM_TYPE_CP1, ATOM_TYPE_N, ATOM_TYPE_C, 0.00, 3.3472, 3},
+     {ATOM_TYPE_CC, ATOM_TYPE_CT1, ATOM_TYPE_CT2, ATOM_TYPE_CA, 0.00, 0.16736, 3},
+     {ATOM_TYPE_CC, ATOM_TYPE_CT1, ATOM_TYPE_NH1, ATOM_TYPE_C, 180.00, 0.8368, 1},
+     {ATOM_TYPE_CC, ATOM_TYPE_CT2, ATOM_TYPE_NH1, ATOM_TYPE_C, 180.00, 8.368, 1},
+     {ATOM_TYPE_CD, ATOM_TYPE_CP1, ATOM_TYPE_N, ATOM_TYPE_C, 180.00, 0.0, 1},
+     {ATOM_TYPE_CD, ATOM_TYPE_CT1, ATOM_TYPE_NH1, ATOM_TYPE_C, 180.00, 0.8368, 1},
+     {ATOM_TYPE_CD, ATOM_TYPE_CT2, ATOM_TYPE_NH1, ATOM_TYPE_C, 180.00, 8.368, 1},
+     {ATOM_TYPE_CE1, ATOM_TYPE_CE1, ATOM_TYPE_CT3, ATOM_TYPE_HA3, 0.00, 0.12552, 3},
+     {ATOM_TYPE_CE2, ATOM_TYPE_CE1, ATOM_TYPE_CT2, ATOM_TYPE_CT3, 180.00, 2.092, 1},
+     {ATOM_TYPE_CE2, ATOM_TYPE_CE1, ATOM_TYPE_CT2, ATOM_TYPE_CT3, 180.00, 5.4392, 3},
+     {ATOM_TYPE_CE2, ATOM_TYPE_CE1, ATOM_TYPE_CT2, ATOM_TYPE_HA2, 0.00, 0.50208, 3},
+     {ATOM_TYPE_CE2, ATOM_TYPE_CE1, ATOM_TYPE_CT3, ATOM_TYPE_HA3, 180.00, 0.2092, 3},
+     {ATOM_TYPE_CP1, ATOM_TYPE_C, ATOM_TYPE_N, ATOM_TYPE_CP1, 180.00, 11.506, 2},
+     {ATOM_TYPE_CP1, ATOM_TYPE_C, ATOM_TYPE_N, ATOM_TYPE_CP1, 0.00, 1.2552, 4},
+     {ATOM_TYPE_CP2, ATOM_TYPE_CP1, ATOM_TYPE_N, ATOM_TYPE_C, 0.00, 3.3472, 3},
+     {ATOM_TYPE_CP2, ATOM_TYPE_CP3, ATOM_TYPE_N, ATOM_TYPE_C, 180.00, 0.0, 3},
+     {ATOM_TYPE_CP2, ATOM_TYPE_CP3, ATOM_TYPE_N, ATOM_TYPE_CP1, 0.00, 0.4184, 3},
+     {ATOM_TYPE_CP2, ATOM_TYPE_CP3, ATOM_TYPE_NP, ATOM_TYPE_CP1, 0.00, 0.33472, 3},
+     {ATOM_TYPE_CP3, ATOM_TYPE_N, ATOM_TYPE_C, ATOM_TYPE_CP1, 180.00, 11.506, 2},
+     {ATOM_TYPE_CP3, ATOM_TYPE_N, ATOM_TYPE_C, ATOM_TYPE_CP1, 0.00, 1.2552, 4},
+     {ATOM_TYPE_CP3, ATOM_TYPE_N, ATOM_TYPE_CP1, ATOM_TYPE_C, 0.00, 0.4184, 3},
+     {ATOM_TYPE_CP3, ATOM_TYPE_N, ATOM_TYPE_CP1, ATOM_TYPE_CC, 0.00, 0.4184, 3},
+     {ATOM_TYPE_CP3, ATOM_TYPE_N, ATOM_TYPE_CP1, ATOM_TYPE_CP2, 0.00, 0.4184, 3},
+     {ATOM_TYPE_CP3, ATOM_TYPE_NP, ATOM_TYPE_CP1, ATOM_TYPE_C, 0.00, 0.33472, 3},
+     {ATOM_TYPE_CP3, ATOM_TYPE_NP, ATOM_TYPE_CP1, ATOM_TYPE_CC, 0.00, 0.33472, 3},
+     {ATOM_TYPE_CP3, ATOM_TYPE_NP, ATOM_TYPE_CP1, ATOM_TYPE_CD, 0.00, 0.33472, 3},
+     {ATOM_TYPE_CP3, ATOM_TYPE_NP, ATOM_TYPE_CP1, ATOM_TYPE_CP2, 0.00, 0.33472, 3},
+     {ATOM_TYPE_CPH2, ATOM_TYPE_NR1, ATOM_TYPE_CPH1, ATOM_TYPE_CPH1, 180.00, 58.576, 2},
+     {ATOM_TYPE_CPH2, ATOM_TYPE_NR2, ATOM_TYPE_CPH1, ATOM_TYPE_CPH1, 180.00, 58.576, 2},
+     {ATOM_TYPE_CPH2, ATOM_TYPE_NR3, ATOM_TYPE_CPH1, ATOM_TYPE_CPH1, 180.00, 50.208, 2},
+     {ATOM_TYPE_CT1, ATOM_TYPE_C, ATOM_TYPE_N, ATOM_TYPE_CP1, 180.00, 11.506, 2},
+     {ATOM_TYPE_CT1, ATOM_TYPE_C, ATOM_TYPE_N, ATOM_TYPE_CP1, 0.00, 1.2552, 4},
+     {ATOM_TYPE_CT1, ATOM_TYPE_C, ATOM_TYPE_N, ATOM_TYPE_CP3, 180.00, 11.506, 2},
+     {ATOM_TYPE_CT1, ATOM_TYPE_C, ATOM_TYPE_N, ATOM_TYPE_CP3, 0.00, 1.2552, 4},
+     {ATOM_TYPE_CT1, ATOM_TYPE_C, ATOM_TYPE_NH1, ATOM_TYPE_CT1, 0.00, 6.6944, 1},
+     {ATOM_TYPE_CT1, ATOM_TYPE_C, ATOM_TYPE_NH1, ATOM_TYPE_CT1, 180.00, 10.46, 2},
+     {ATOM_TYPE_CT1, ATOM_TYPE_CT1, ATOM_TYPE_NH1, ATOM_TYPE_C, 0.00, 7.5312, 1},
+     {ATOM_TYPE_CT1, ATOM_TYPE_NH1, ATOM_TYPE_C, ATOM_TYPE_CP1, 0.00, 6.6944, 1},
+     {ATOM_TYPE_CT1, ATOM_TYPE_NH1, ATOM_TYPE_C, ATOM_TYPE_CP1, 180.00, 10.46, 2},
+     {ATOM_TYPE_CT2, ATOM_TYPE_C, ATOM_TYPE_N, ATOM_TYPE_CP1, 180.00, 11.506, 2},
+     {ATOM_TYPE_CT2, ATOM_TYPE_C, ATOM_TYPE_N, ATOM_TYPE_CP1, 0.00, 1.2552, 4},
+     {ATOM_TYPE_CT2, ATOM_TYPE_C, ATOM_TYPE_N, ATOM_TYPE_CP3, 180.00, 11.506, 2},
+     {ATOM_TYPE_CT2, ATOM_TYPE_C, ATOM_TYPE_N, ATOM_TYPE_CP3, 0.00, 1.2552, 4},
+     {ATOM_TYPE_CT2, ATOM_TYPE_C, ATOM_TYPE_NH1, ATOM_TYPE_CT1, 0.00, 6.6944, 1},
+     {ATOM_TYPE_CT2, ATOM_TYPE_C, ATOM_TYPE_NH1, ATOM_TYPE_CT1, 180.00, 10.46, 2},
+     {ATOM_TYPE_CT2, ATOM_TYPE_C, ATOM_TYPE_NH1, ATOM_TYPE_CT2, 0.00, 6.6944, 1},
+     {ATOM_TYPE_CT2, ATOM_TYPE_C, ATOM_TYPE_NH1, ATOM_TYPE_CT2, 180.00, 10.46, 2},
+     {ATOM_TYPE_CT2, ATOM_TYPE_C, ATOM_TYPE_NH1, ATOM_TYPE_CT3, 0.00, 6.6944, 1},
+     {ATOM_TYPE_CT2, ATOM_TYPE_C, ATOM_TYPE_NH1, ATOM_TYPE_CT3, 180.00, 10.46, 2},
+     {ATOM_TYPE_CT2, ATOM_TYPE_CA, ATOM_TYPE_CA, ATOM_TYPE_CA, 180.00, 12.9704, 2},
+     {ATOM_TYPE_CT2, ATOM_TYPE_CPH1, ATOM_TYPE_NR1, ATOM_TYPE_CPH2, 180.00, 12.552, 2},
+     {ATOM_TYPE_CT2, ATOM_TYPE_CPH1, ATOM_TYPE_NR2, ATOM_TYPE_CPH2, 180.00, 12.552, 2},
+     {ATOM_TYPE_CT2, ATOM_TYPE_CPH1, ATOM_TYPE_NR3, ATOM_TYPE_CPH2, 180.00, 10.46, 2},
+     {ATOM_TYPE_CT2, ATOM_TYPE_CT1, ATOM_TYPE_NH1, ATOM_TYPE_C, 0.00, 7.5312, 1},
+     {ATOM_TYPE_CT2, ATOM_TYPE_CT2, ATOM_TYPE_CPH1, ATOM_TYPE_CPH1, 0.00, 1.6736, 1},
+     {ATOM_TYPE_CT2, ATOM_TYPE_CT2, ATOM_TYPE_CT2, ATOM_TYPE_CT2, 180.00, 0.4184, 2},
+     {ATOM_TYPE_CT2, ATOM_TYPE_CT2, ATOM_TYPE_CT2, ATOM_TYPE_CT2, 0.00, 0.6276, 4},
+     {ATOM_TYPE_CT2, ATOM_TYPE_CT2, ATOM_TYPE_CT2, ATOM_TYPE_CT2, 180.00, 0.4184, 6},
+     {ATOM_TYPE_CT2, ATOM_TYPE_CT2, ATOM_TYPE_CT2, ATOM_TYPE_CT3, 180.00, 0.4184, 2},
+     {ATOM_TYPE_CT2, ATOM_TYPE_CT2, ATOM_TYPE_CT2, ATOM_TYPE_CT3, 0.00, 0.6276, 4},
+     {ATOM_TYPE_CT2, ATOM_TYPE_CT2, ATOM_TYPE_CT2, ATOM_TYPE_CT3, 180.00, 0.4184, 6},
+     {ATOM_TYPE_CT2, ATOM_TYPE_CT2, ATOM_TYPE_NH1, ATOM_TYPE_C, 0.00, 7.5312, 1},
+     {ATOM_TYPE_CT2, ATOM_TYPE_NH1, ATOM_TYPE_C, ATOM_TYPE_CP1, 0.00, 6.6944, 1},
+     {ATOM_TYPE_CT2, ATOM_TYPE_NH1, ATOM_TYPE_C, ATOM_TYPE_CP1, 180.00, 10.46, 2},
+     {ATOM_TYPE_CT2, ATOM_TYPE_NH1, ATOM_TYPE_C, ATOM_TYPE_CT1, 0.00, 6.6944, 1},
+     {ATOM_TYPE_CT2, ATOM_TYPE_NH1, ATOM_TYPE_C, ATOM_TYPE_CT1, 180.00, 10.46, 2},
+     {ATOM_TYPE_CT2, ATOM_TYPE_SM, ATOM_TYPE_SM, ATOM_TYPE_CT2, 0.00, 4.184, 1},
+     {ATOM_TYPE_CT2, ATOM_TYPE_SM, ATOM_TYPE_SM, ATOM_TYPE_CT2, 0.00, 17.1544, 2},
+     {ATOM_TYPE_CT2, ATOM_TYPE_SM, ATOM_TYPE_SM, ATOM_TYPE_CT2, 0.00, 3.7656, 3},
+     {ATOM_TYPE_CT3, ATOM_TYPE_C, ATOM_TYPE_N, ATOM_TYPE_CP1, 180.00, 11.506, 2},
+     {ATOM_TYPE_CT3, ATOM_TYPE_C, ATOM_TYPE_N, ATOM_TYPE_CP1, 0.00, 1.2552, 4},
+     {ATOM_TYPE_CT3, ATOM_TYPE_C, ATOM_TYPE_N, ATOM_TYPE_CP3, 180.00, 11.506, 2},
+     {ATOM_TYPE_CT3, ATOM_TYPE_C, ATOM_TYPE_N, ATOM_TYPE_CP3, 0.00, 1.2552, 4},
+     {ATOM_TYPE_CT3, ATOM_TYPE_C, ATOM_TYPE_NH1, ATOM_TYPE_CT1, 0.00, 6.6944, 1},
+     {ATOM_TYPE_CT3, ATOM_TYPE_C, ATOM_TYPE_NH1, ATOM_TYPE_CT1, 180.00, 10.46, 2},
+     {ATOM_TYPE_CT3, ATOM_TYPE_C, ATOM_TYPE_NH1, ATOM_TYPE_CT2, 0.00, 6.6944, 1},
+     {ATOM_TYPE_CT3, ATOM_TYPE_C, ATOM_TYPE_NH1, ATOM_TYPE_CT2, 180.00, 10.46, 2},
+     {ATOM_TYPE_CT3, ATOM_TYPE_C, ATOM_TYPE_NH1, ATOM_TYPE_CT3, 0.00, 6.6944, 1},
+     {ATOM_TYPE_CT3, ATOM_TYPE_C, ATOM_TYPE_NH1, ATOM_TYPE_CT3, 180.00, 10.46, 2},
+     {ATOM_TYPE_CT3, ATOM_TYPE_CA, ATOM_TYPE_CA, ATOM_TYPE_CA, 180.00, 12.9704, 2},
+     {ATOM_TYPE_CT3, ATOM_TYPE_CE1, ATOM_TYPE_CE2, ATOM_TYPE_HE2, 180.00, 21.7568, 2},
+     {ATOM_TYPE_CT3, ATOM_TYPE_CPH1, ATOM_TYPE_NR1, ATOM_TYPE_CPH2, 180.00, 12.552, 2},
+     {ATOM_TYPE_CT3, ATOM_TYPE_CT1, ATOM_TYPE_NH1, ATOM_TYPE_C, 0.00, 7.5312, 1},
+     {ATOM_TYPE_CT3, ATOM_TYPE_CT2, ATOM_TYPE_CA, ATOM_TYPE_CA, 180.00, 0.96232, 2},
+     {ATOM_TYPE_CT3, ATOM_TYPE_CT2, ATOM_TYPE_CPH1, ATOM_TYPE_CPH1, 0.00, 0.8368, 1},
+     {ATOM_TYPE_CT3, ATOM_TYPE_CT2, ATOM_TYPE_CPH1, ATOM_TYPE_CPH1, 0.00, 1.12968, 2},
+     {ATOM_TYPE_CT3, ATOM_TYPE_CT2, ATOM_TYPE_CPH1, ATOM_TYPE_CPH1, 0.00, 0.0, 3},
+     {ATOM_TYPE_CT1, ATOM_TYPE_CT2, ATOM_TYPE_S, ATOM_TYPE_CT3, 180.00, 1.00416, 1},
+     {ATOM_TYPE_CT3, ATOM_TYPE_CT2, ATOM_TYPE_S, ATOM_TYPE_CT3, 180.00, 1.00416, 1},
+     {ATOM_TYPE_CT3, ATOM_TYPE_CT2, ATOM_TYPE_S, ATOM_TYPE_CT3, 0.00, 1.54808, 3},
+     {ATOM_TYPE_CT3, ATOM_TYPE_NH1, ATOM_TYPE_C, ATOM_TYPE_CP1, 0.00, 6.6944, 1},
+     {ATOM_TYPE_CT3, ATOM_TYPE_NH1, ATOM_TYPE_C, ATOM_TYPE_CP1, 180.00, 10.46, 2},
+     {ATOM_TYPE_CT3, ATOM_TYPE_NH1, ATOM_TYPE_C, ATOM_TYPE_CT1, 0.00, 6.6944, 1},
+     {ATOM_TYPE_CT3, ATOM_TYPE_NH1, ATOM_TYPE_C, ATOM_TYPE_CT1, 180.00, 10.46, 2},
+     {ATOM_TYPE_CT3, ATOM_TYPE_S, ATOM_TYPE_CT2, ATOM_TYPE_CT2, 180.00, 1.00416, 1},
+     {ATOM_TYPE_CT3, ATOM_TYPE_S, ATOM_TYPE_CT2, ATOM_TYPE_CT2, 0.00, 1.54808, 3},
+     {ATOM_TYPE_CT3, ATOM_TYPE_SM, ATOM_TYPE_SM, ATOM_TYPE_CT3, 0.00, 4.184, 1},
+     {ATOM_TYPE_CT3, ATOM_TYPE_SM, ATOM_TYPE_SM, ATOM_TYPE_CT3, 0.00, 17.1544, 2},
+     {ATOM_TYPE_CT3, ATOM_TYPE_SM, ATOM_TYPE_SM, ATOM_TYPE_CT3, 0.00, 3.7656, 3},
+     {ATOM_TYPE_H, ATOM_TYPE_NH1, ATOM_TYPE_C, ATOM_TYPE_CP1, 180.00, 10.46, 2},
+     {ATOM_TYPE_H, ATOM_TYPE_NH1, ATOM_TYPE_C, ATOM_TYPE_CT1, 180.00, 10.46, 2},
+     {ATOM_TYPE_H, ATOM_TYPE_NH1, ATOM_TYPE_C, ATOM_TYPE_CT2, 180.00, 10.46, 2},
+     {ATOM_TYPE_H, ATOM_TYPE_NH1, ATOM_TYPE_C, ATOM_TYPE_CT3, 180.00, 10.46, 2},
+     {ATOM_TYPE_H, ATOM_TYPE_NH1, ATOM_TYPE_CT1, ATOM_TYPE_C, 0.00, 0.0, 1},
+     {ATOM_TYPE_H, ATOM_TYPE_NH1, ATOM_TYPE_CT1, ATOM_TYPE_CC, 0.00, 0.0, 1},
+     {ATOM_TYPE_H, ATOM_TYPE_NH1, ATOM_TYPE_CT1, ATOM_TYPE_CD, 0.00, 0.0, 1},
+     {ATOM_TYPE_H, ATOM_TYPE_NH1, ATOM_TYPE_CT1, ATOM_TYPE_CT1, 0.00, 0.0, 1},
+     {ATOM_TYPE_H, ATOM_TYPE_NH1, ATOM_TYPE_CT1, ATOM_TYPE_CT2, 0.00, 0.0, 1},
+     {ATOM_TYPE_H, ATOM_TYPE_NH1, ATOM_TYPE_CT1, ATOM_TYPE_CT3, 0.00, 0.0, 1},
+     {ATOM_TYPE_H, ATOM_TYPE_NH1, ATOM_TYPE_CT2, ATOM_TYPE_C, 0.00, 0.0, 1},
+     {ATOM_TYPE_H, ATOM_TYPE_NH1, ATOM_TYPE_CT2, ATOM_TYPE_CC, 0.00, 0.0, 1},
+     {ATOM_TYPE_H, ATOM_TYPE_NH1, ATOM_TYPE_CT2, ATOM_TYPE_CD, 0.00, 0.0, 1},
+     {ATOM_TYPE_H, ATOM_TYPE_NH1, ATOM_TYPE_CT2, ATOM_TYPE_CT2, 0.00, 0.0, 1},
+     {ATOM_TYPE_H, ATOM_TYPE_NH1, ATOM_TYPE_CT2, ATOM_TYPE_CT3, 0.00, 0.0, 1},
+     {ATOM_TYPE_H, ATOM_TYPE_NH2, ATOM_TYPE_CC, ATOM_TYPE_CT1, 180.00, 5.8576, 2},
+     {ATOM_TYPE_H, ATOM_TYPE_NH2, ATOM_TYPE_CC, ATOM_TYPE_CT2, 180.00, 5.8576, 2},
+     {ATOM_TYPE_H, ATOM_TYPE_NH2, ATOM_TYPE_CC, ATOM_TYPE_CT3, 180.00, 5.8576, 2},
+     {ATOM_TYPE_H, ATOM_TYPE_NH2, ATOM_TYPE_CC, ATOM_TYPE_CP1, 180.00, 10.46, 2},
+     {ATOM_TYPE_H, ATOM_TYPE_NR1, ATOM_TYPE_CPH1, ATOM_TYPE_CPH1, 180.00, 4.184, 2},
+     {ATOM_TYPE_H, ATOM_TYPE_NR1, ATOM_TYPE_CPH1, ATOM_TYPE_CT2, 180.00, 4.184, 2},
+     {ATOM_TYPE_H, ATOM_TYPE_NR1, ATOM_TYPE_CPH1, ATOM_TYPE_CT3, 180.00, 4.184, 2},
+     {ATOM_TYPE_H, ATOM_TYPE_NR3, ATOM_TYPE_CPH1, ATOM_TYPE_CPH1, 180.00, 5.8576, 2},
+     {ATOM_TYPE_H, ATOM_TYPE_NR3, ATOM_TYPE_CPH1, ATOM_TYPE_CT2, 180.00, 12.552, 2},
+     {ATOM_TYPE_H, ATOM_TYPE_NR3, ATOM_TYPE_CPH1, ATOM_TYPE_CT3, 180.00, 12.552, 2},
+     {ATOM_TYPE_H, ATOM_TYPE_OH1, ATOM_TYPE_CA, ATOM_TYPE_CA, 180.00, 4.14216, 2},
+     {ATOM_TYPE_H, ATOM_TYPE_OH1, ATOM_TYPE_CT1, ATOM_TYPE_CT3, 0.00, 5.56472, 1},
+     {ATOM_TYPE_H, ATOM_TYPE_OH1, ATOM_TYPE_CT1, ATOM_TYPE_CT3, 0.00, 0.75312, 2},
+     {ATOM_TYPE_H, ATOM_TYPE_OH1, ATOM_TYPE_CT1, ATOM_TYPE_CT3, 0.00, 1.33888, 3},
+     {ATOM_TYPE_H, ATOM_TYPE_OH1, ATOM_TYPE_CT2, ATOM_TYPE_CT2, 0.00, 5.4392, 1},
+     {ATOM_TYPE_H, ATOM_TYPE_OH1, ATOM_TYPE_CT2, ATOM_TYPE_CT2, 0.00, 1.2552, 2},
+     {ATOM_TYPE_H, ATOM_TYPE_OH1, ATOM_TYPE_CT2, ATOM_TYPE_CT2, 0.00, 1.75728, 3},
+     {ATOM_TYPE_H, ATOM_TYPE_OH1, ATOM_TYPE_CT2, ATOM_TYPE_CT3, 0.00, 5.4392, 1},
+     {ATOM_TYPE_H, ATOM_TYPE_OH1, ATOM_TYPE_CT2, ATOM_TYPE_CT3, 0.00, 1.2552, 2},
+     {ATOM_TYPE_H, ATOM_TYPE_OH1, ATOM_TYPE_CT2, ATOM_TYPE_CT3, 0.00, 1.75728, 3},
+     {ATOM_TYPE_HA1, ATOM_TYPE_CC, ATOM_TYPE_NH2, ATOM_TYPE_H, 180.00, 5.8576, 2},
+     {ATOM_TYPE_HA2, ATOM_TYPE_CP3, ATOM_TYPE_N, ATOM_TYPE_C, 180.00, 0.0, 3},
+     {ATOM_TYPE_HA2, ATOM_TYPE_CP3, ATOM_TYPE_N, ATOM_TYPE_CP1, 0.00, 0.4184, 3},
+     {ATOM_TYPE_HA2, ATOM_TYPE_CP3, ATOM_TYPE_NP, ATOM_TYPE_CP1, 0.00, 0.33472, 3},
+     {ATOM_TYPE_HA1, ATOM_TYPE_CT1, ATOM_TYPE_CT2, ATOM_TYPE_CA, 0.00, 0.16736, 3},
+     {ATOM_TYPE_HA2, ATOM_TYPE_CT2, ATOM_TYPE_CPH1, ATOM_TYPE_CPH1, 0.00, 0.0, 3},
+     {ATOM_TYPE_HA2, ATOM_TYPE_CT2, ATOM_TYPE_NH1, ATOM_TYPE_C, 0.00, 0.0, 3},
+     {ATOM_TYPE_HA2, ATOM_TYPE_CT2, ATOM_TYPE_NH1, ATOM_TYPE_H, 0.00, 0.0, 3},
+     {ATOM_TYPE_HA2, ATOM_TYPE_CT2, ATOM_TYPE_S, ATOM_TYPE_CT3, 0.00, 1.17152, 3},
+     {ATOM_TYPE_HA3, ATOM_TYPE_CT3, ATOM_TYPE_CPH1, ATOM_TYPE_CPH1, 0.00, 0.0, 3},
+     {ATOM_TYPE_HA3, ATOM_TYPE_CT3, ATOM_TYPE_CS, ATOM_TYPE_HA2, 0.00, 0.66944, 3},
+     {ATOM_TYPE_HA3, ATOM_TYPE_CT3, ATOM_TYPE_CS, ATOM_TYPE_HA3, 0.00, 0.66944, 3},
+     {ATOM_TYPE_HA3, ATOM_TYPE_CT3, ATOM_TYPE_CT2, ATOM_TYPE_CA, 0.00, 0.16736, 3},
+     {ATOM_TYPE_HA3, ATOM_TYPE_CT3, ATOM_TYPE_NH1, ATOM_TYPE_C, 0.00, 0.0, 3},
+     {ATOM_TYPE_HA3, ATOM_TYPE_CT3, ATOM_TYPE_NH1, ATOM_TYPE_H, 0.00, 0.0, 3},
+     {ATOM_TYPE_HA3, ATOM_TYPE_CT3, ATOM_TYPE_S, ATOM_TYPE_CT2, 0.00, 1.17152, 3},
+     {ATOM_TYPE_HE1, ATOM_TYPE_CE1, ATOM_TYPE_CE1, ATOM_TYPE_HE1, 180.00, 4.184, 2},
+     {ATOM_TYPE_CT3, ATOM_TYPE_CE1, ATOM_TYPE_CE1, ATOM_TYPE_HE1, 180.00, 4.184, 2},
+     {ATOM_TYPE_HE1, ATOM_TYPE_CE1, ATOM_TYPE_CE2, ATOM_TYPE_HE2, 180.00, 21.7568, 2},
+     {ATOM_TYPE_HE1, ATOM_TYPE_CE1, ATOM_TYPE_CT2, ATOM_TYPE_HA2, 0.00, 0.0, 3},
+     {ATOM_TYPE_HE1, ATOM_TYPE_CE1, ATOM_TYPE_CT2, ATOM_TYPE_CT3, 0.00, 0.50208, 3},
+     {ATOM_TYPE_HE1, ATOM_TYPE_CE1, ATOM_TYPE_CT3, ATOM_TYPE_HA3, 0.00, 0.0, 3},
+     {ATOM_TYPE_HE2, ATOM_TYPE_CE2, ATOM_TYPE_CE1, ATOM_TYPE_CT2, 180.00, 21.7568, 2},
+     {ATOM_TYPE_HB1, ATOM_TYPE_CP1, ATOM_TYPE_N, ATOM_TYPE_C, 0.00, 3.3472, 3},
+     {ATOM_TYPE_HB1, ATOM_TYPE_CP1, ATOM_TYPE_N, ATOM_TYPE_CP3, 0.00, 0.4184, 3},
+     {ATOM_TYPE_HB1, ATOM_TYPE_CP1, ATOM_TYPE_NP, ATOM_TYPE_CP3, 0.00, 0.33472, 3},
+     {ATOM_TYPE_HB1, ATOM_TYPE_CT1, ATOM_TYPE_NH1, ATOM_TYPE_C, 0.00, 0.0, 1},
+     {ATOM_TYPE_HB1, ATOM_TYPE_CT1, ATOM_TYPE_NH1, ATOM_TYPE_H, 0.00, 0.0, 1},
+     {ATOM_TYPE_HB2, ATOM_TYPE_CT2, ATOM_TYPE_NH1, ATOM_TYPE_C, 0.00, 0.0, 1},
+     {ATOM_TYPE_HB2, ATOM_TYPE_CT2, ATOM_TYPE_NH1, ATOM_TYPE_H, 0.00, 0.0, 1},
+     {ATOM_TYPE_HC, ATOM_TYPE_NH2, ATOM_TYPE_CT2, ATOM_TYPE_HB2, 0.00, 0.46024, 3},
+     {ATOM_TYPE_HC, ATOM_TYPE_NH2, ATOM_TYPE_CT2, ATOM_TYPE_CD, 0.00, 0.46024, 3},
+     {ATOM_TYPE_HC, ATOM_TYPE_NH2, ATOM_TYPE_CT2, ATOM_TYPE_CT2, 0.00, 0.46024, 3},
+     {ATOM_TYPE_HC, ATOM_TYPE_NH2, ATOM_TYPE_CT2, ATOM_TYPE_HA2, 0.00, 0.46024, 3},
+     {ATOM_TYPE_HC, ATOM_TYPE_NP, ATOM_TYPE_CP1, ATOM_TYPE_C, 0.00, 0.33472, 3},
+     {ATOM_TYPE_HC, ATOM_TYPE_NP, ATOM_TYPE_CP1, ATOM_TYPE_CC, 0.00, 0.33472, 3},
+     {ATOM_TYPE_HC, ATOM_TYPE_NP, ATOM_TYPE_CP1, ATOM_TYPE_CD, 0.00, 0.33472, 3},
+     {ATOM_TYPE_HC, ATOM_TYPE_NP, ATOM_TYPE_CP1, ATOM_TYPE_CP2, 0.00, 0.33472, 3},
+     {ATOM_TYPE_HC, ATOM_TYPE_NP, ATOM_TYPE_CP1, ATOM_TYPE_HB1, 0.00, 0.33472, 3},
+     {ATOM_TYPE_HC, ATOM_TYPE_NP, ATOM_TYPE_CP3, ATOM_TYPE_CP2, 0.00, 0.33472, 3},
+     {ATOM_TYPE_HC, ATOM_TYPE_NP, ATOM_TYPE_CP3, ATOM_TYPE_HA2, 0.00, 0.33472, 3},
+     {ATOM_TYPE_HP, ATOM_TYPE_CA, ATOM_TYPE_CA, ATOM_TYPE_CA, 180.00, 17.5728, 2},
+     {ATOM_TYPE_HP, ATOM_TYPE_CA, ATOM_TYPE_CA, ATOM_TYPE_CT2, 180.00, 17.5728, 2},
+     {ATOM_TYPE_HP, ATOM_TYPE_CA, ATOM_TYPE_CA, ATOM_TYPE_CT3, 180.00, 17.5728, 2},
+     {ATOM_TYPE_HP, ATOM_TYPE_CA, ATOM_TYPE_CA, ATOM_TYPE_HP, 180.00, 10.0416, 2},
+     {ATOM_TYPE_HR1, ATOM_TYPE_CPH1, ATOM_TYPE_CPH1, ATOM_TYPE_CT2, 180.00, 4.184, 2},
+     {ATOM_TYPE_HR1, ATOM_TYPE_CPH1, ATOM_TYPE_CPH1, ATOM_TYPE_CT3, 180.00, 4.184, 2},
+     {ATOM_TYPE_HR1, ATOM_TYPE_CPH1, ATOM_TYPE_CPH1, ATOM_TYPE_HR1, 180.00, 4.184, 2},
+     {ATOM_TYPE_HR1, ATOM_TYPE_CPH1, ATOM_TYPE_NR3, ATOM_TYPE_CPH2, 180.00, 10.46, 2},
+     {ATOM_TYPE_HR1, ATOM_TYPE_CPH1, ATOM_TYPE_NR3, ATOM_TYPE_H, 180.00, 12.552, 2},
+     {ATOM_TYPE_HR1, ATOM_TYPE_CPH2, ATOM_TYPE_NR1, ATOM_TYPE_CPH1, 180.00, 12.552, 2},
+     {ATOM_TYPE_HR1, ATOM_TYPE_CPH2, ATOM_TYPE_NR1, ATOM_TYPE_H, 180.00, 4.184, 2},
+     {ATOM_TYPE_HR1, ATOM_TYPE_CPH2, ATOM_TYPE_NR2, ATOM_TYPE_CPH1, 180.00, 12.552, 2},
+     {ATOM_TYPE_HR2, ATOM_TYPE_CPH2, ATOM_TYPE_NR3, ATOM_TYPE_CPH1, 180.00, 12.552, 2},
+     {ATOM_TYPE_HR2, ATOM_TYPE_CPH2, ATOM_TYPE_NR3, ATOM_TYPE_H, 180.00, 0.0, 2},
+     {ATOM_TYPE_HR3, ATOM_TYPE_CPH1, ATOM_TYPE_CPH1, ATOM_TYPE_CT2, 180.00, 8.368, 2},
+     {ATOM_TYPE_HR3, ATOM_TYPE_CPH1, ATOM_TYPE_CPH1, ATOM_TYPE_CT3, 180.00, 8.368, 2},
+     {ATOM_TYPE_HR3, ATOM_TYPE_CPH1, ATOM_TYPE_CPH1, ATOM_TYPE_HR3, 180.00, 8.368, 2},
+     {ATOM_TYPE_HR3, ATOM_TYPE_CPH1, ATOM_TYPE_NR1, ATOM_TYPE_CPH2, 180.00, 12.552, 2},
+     {ATOM_TYPE_HR3, ATOM_TYPE_CPH1, ATOM_TYPE_NR1, ATOM_TYPE_H, 180.00, 4.184, 2},
+     {ATOM_TYPE_HR3, ATOM_TYPE_CPH1, ATOM_TYPE_NR2, ATOM_TYPE_CPH2, 180.00, 12.552, 2},
+     {ATOM_TYPE_HS, ATOM_TYPE_S, ATOM_TYPE_CT2, ATOM_TYPE_CT3, 0.00, 1.00416, 1},
+     {ATOM_TYPE_HS, ATOM_TYPE_S, ATOM_TYPE_CT2, ATOM_TYPE_CT3, 0.00, 0.6276, 2},
+     {ATOM_TYPE_HS, ATOM_TYPE_S, ATOM_TYPE_CT2, ATOM_TYPE_CT3, 0.00, 1.12968, 3},
+     {ATOM_TYPE_HS, ATOM_TYPE_S, ATOM_TYPE_CT2, ATOM_TYPE_HA2, 0.00, 0.8368, 3},
+     {ATOM_TYPE_HS, ATOM_TYPE_S, ATOM_TYPE_CT3, ATOM_TYPE_HA3, 0.00, 0.8368, 3},
+     {ATOM_TYPE_N, ATOM_TYPE_C, ATOM_TYPE_CP1, ATOM_TYPE_CP2, 0.00, 1.6736, 1},
+     {ATOM_TYPE_N, ATOM_TYPE_C, ATOM_TYPE_CP1, ATOM_TYPE_CP2, 0.00, 2.5104, 2},
+     {ATOM_TYPE_N, ATOM_TYPE_C, ATOM_TYPE_CP1, ATOM_TYPE_HB1, 180.00, 1.6736, 1},
+     {ATOM_TYPE_N, ATOM_TYPE_C, ATOM_TYPE_CP1, ATOM_TYPE_HB1, 0.00, 2.5104, 2},
+     {ATOM_TYPE_N, ATOM_TYPE_C, ATOM_TYPE_CP1, ATOM_TYPE_N, 0.00, 1.2552, 1},
+     {ATOM_TYPE_N, ATOM_TYPE_C, ATOM_TYPE_CP1, ATOM_TYPE_N, 0.00, -1.2552, 4},
+     {ATOM_TYPE_N, ATOM_TYPE_C, ATOM_TYPE_CT1, ATOM_TYPE_CT1, -103.0, 2.092, 1},
+     {ATOM_TYPE_N, ATOM_TYPE_C, ATOM_TYPE_CT1, ATOM_TYPE_CT2, -103.0, 2.092, 1},
+     {ATOM_TYPE_N, ATOM_TYPE_C, ATOM_TYPE_CT1, ATOM_TYPE_CT3, -103.0, 2.092, 1},
+     {ATOM_TYPE_N, ATOM_TYPE_C, ATOM_TYPE_CT1, ATOM_TYPE_HB1, 0.00, 0.0, 1},
+     {ATOM_TYPE_N, ATOM_TYPE_C, ATOM_TYPE_CT2, ATOM_TYPE_HB2, 0.00, 0.0, 1},
+     {ATOM_TYPE_N, ATOM_TYPE_C, ATOM_TYPE_CT3, ATOM_TYPE_HA3, 0.00, 0.0, 1},
+     {ATOM_TYPE_N, ATOM_TYPE_CT1, ATOM_TYPE_CT2, ATOM_TYPE_CA, 0.00, 0.16736, 3},
+     {ATOM_TYPE_NH1, ATOM_TYPE_C, ATOM_TYPE_CP1, ATOM_TYPE_CP2, 0.00, 1.6736, 1},
+     {ATOM_TYPE_NH1, ATOM_TYPE_C, ATOM_TYPE_CP1, ATOM_TYPE_CP2, 0.00, 2.5104, 2},
+     {ATOM_TYPE_NH1, ATOM_TYPE_C, ATOM_TYPE_CP1, ATOM_TYPE_HB1, 180.00, 1.6736, 1},
+     {ATOM_TYPE_NH1, ATOM_TYPE_C, ATOM_TYPE_CP1, ATOM_TYPE_HB1, 0.00, 2.5104, 2},
+     {ATOM_TYPE_NH1, ATOM_TYPE_C, ATOM_TYPE_CP1, ATOM_TYPE_N, 0.00, 1.2552, 1},
+     {ATOM_TYPE_NH1, ATOM_TYPE_C, ATOM_TYPE_CP1, ATOM_TYPE_N, 0.00, -1.2552, 4},
+     {ATOM_TYPE_NH1, ATOM_TYPE_C, ATOM_TYPE_CT1, ATOM_TYPE_CT1, -103.0, 2.092, 1},
+     {ATOM_TYPE_NH1, ATOM_TYPE_C, ATOM_TYPE_CT1, ATOM_TYPE_CT2, -103.0, 2.092, 1},
+     {ATOM_TYPE_NH1, ATOM_TYPE_C, ATOM_TYPE_CT1, ATOM_TYPE_CT3, -103.0, 2.092, 1},
+     {ATOM_TYPE_NH1, ATOM_TYPE_C, ATOM_TYPE_CT1, ATOM_TYPE_HB1, 0.00, 0.0, 1},
+     {ATOM_TYPE_NH1, ATOM_TYPE_C, ATOM_TYPE_CT1, ATOM_TYPE_NH1, 0.00, 2.5104, 1},
+     {ATOM_TYPE_NH1, ATOM_TYPE_C, ATOM_TYPE_CT2, ATOM_TYPE_CT2, 0.00, 0.0, 1},
+     {ATOM_TYPE_NH1, ATOM_TYPE_C, ATOM_TYPE_CT2, ATOM_TYPE_HA2, 0.00, 0.0, 3},
+     {ATOM_TYPE_NH1, ATOM_TYPE_C, ATOM_TYPE_CT2, ATOM_TYPE_HB2, 0.00, 0.0, 1},
+     {ATOM_TYPE_NH1, ATOM_TYPE_C, ATOM_TYPE_CT2, ATOM_TYPE_NH1, 0.00, 2.5104, 1},
+     {ATOM_TYPE_NH1, ATOM_TYPE_C, ATOM_TYPE_CT3, ATOM_TYPE_HA3, 0.00, 0.0, 3},
+     {ATOM_TYPE_NH1, ATOM_TYPE_CT1, ATOM_TYPE_C, ATOM_TYPE_N, 0.00, 1.6736, 1},
+     {ATOM_TYPE_NH1, ATOM_TYPE_CT2, ATOM_TYPE_C, ATOM_TYPE_N, 0.00, 1.6736, 1},
+     {ATOM_TYPE_NH2, ATOM_TYPE_CC, ATOM_TYPE_CP1, ATOM_TYPE_CP2, 0.00, 1.6736, 1},
+     {ATOM_TYPE_NH2, ATOM_TYPE_CC, ATOM_TYPE_CP1, ATOM_TYPE_CP2, 0.00, 2.5104, 2},
+     {ATOM_TYPE_NH2, ATOM_TYPE_CC, ATOM_TYPE_CP1, ATOM_TYPE_HB1, 180.00, 1.6736, 1},
+     {ATOM_TYPE_NH2, ATOM_TYPE_CC, ATOM_TYPE_CP1, ATOM_TYPE_HB1, 0.00, 2.5104, 2},
+     {ATOM_TYPE_NH2, ATOM_TYPE_CC, ATOM_TYPE_CP1, ATOM_TYPE_N, 0.00, 1.2552, 1},
+     {ATOM_TYPE_NH2, ATOM_TYPE_CC, ATOM_TYPE_CP1, ATOM_TYPE_N, 0.00, -1.2552, 4},
+     {ATOM_TYPE_NH2, ATOM_TYPE_CC, ATOM_TYPE_CT2, ATOM_TYPE_HA2, 180.00, 0.0, 3},
+     {ATOM_TYPE_NH3, ATOM_TYPE_CT1, ATOM_TYPE_C, ATOM_TYPE_N, 0.00, 1.6736, 1},
+     {ATOM_TYPE_NH3, ATOM_TYPE_CT1, ATOM_TYPE_C, ATOM_TYPE_NH1, 0.00, 2.5104, 1},
+     {ATOM_TYPE_NH3, ATOM_TYPE_CT1, ATOM_TYPE_CC, ATOM_TYPE_NH2, 0.00, 1.6736, 1},
+     {ATOM_TYPE_NH3, ATOM_TYPE_CT2, ATOM_TYPE_C, ATOM_TYPE_N, 0.00, 1.6736, 1},
+     {ATOM_TYPE_NH3, ATOM_TYPE_CT2, ATOM_TYPE_C, ATOM_TYPE_NH1, 0.00, 4.184, 1},
+     {ATOM_TYPE_NH3, ATOM_TYPE_CT2, ATOM_TYPE_CC, ATOM_TYPE_NH2, 0.00, 1.6736, 1},
+     {ATOM_TYPE_NP, ATOM_TYPE_CP1, ATOM_TYPE_C, ATOM_TYPE_N, 0.00, 1.2552, 1},
+     {ATOM_TYPE_NP, ATOM_TYPE_CP1, ATOM_TYPE_C, ATOM_TYPE_NH1, 0.00, 1.2552, 1},
+     {ATOM_TYPE_NP, ATOM_TYPE_CP1, ATOM_TYPE_CC, ATOM_TYPE_NH2, 0.00, 1.2552, 1},
+     {ATOM_TYPE_NR1, ATOM_TYPE_CPH1, ATOM_TYPE_CPH1, ATOM_TYPE_CT2, 180.00, 12.552, 2},
+     {ATOM_TYPE_NR1, ATOM_TYPE_CPH1, ATOM_TYPE_CPH1, ATOM_TYPE_CT3, 180.00, 12.552, 2},
+     {ATOM_TYPE_NR1, ATOM_TYPE_CPH1, ATOM_TYPE_CPH1, ATOM_TYPE_HR3, 180.00, 12.552, 2},
+     {ATOM_TYPE_NR1, ATOM_TYPE_CPH1, ATOM_TYPE_CT2, ATOM_TYPE_CT2, 0.00, 0.79496, 3},
+     {ATOM_TYPE_NR1, ATOM_TYPE_CPH1, ATOM_TYPE_CT2, ATOM_TYPE_CT3, 0.00, 0.79496, 3},
+     {ATOM_TYPE_NR1, ATOM_TYPE_CPH1, ATOM_TYPE_CT2, ATOM_TYPE_HA2, 0.00, 0.79496, 3},
+     {ATOM_TYPE_NR1, ATOM_TYPE_CPH1, ATOM_TYPE_CT3, ATOM_TYPE_HA3, 0.00, 0.79496, 3},
+     {ATOM_TYPE_NR1, ATOM_TYPE_CPH2, ATOM_TYPE_NR2, ATOM_TYPE_CPH1, 180.00, 58.576, 2},
+     {ATOM_TYPE_NR2, ATOM_TYPE_CPH1, ATOM_TYPE_CPH1, ATOM_TYPE_CT2, 180.00, 12.552, 2},
+     {ATOM_TYPE_NR2, ATOM_TYPE_CPH1, ATOM_TYPE_CPH1, ATOM_TYPE_CT3, 180.00, 12.552, 2},
+     {ATOM_TYPE_NR2, ATOM_TYPE_CPH1, ATOM_TYPE_CPH1, ATOM_TYPE_HR3, 180.00, 12.552, 2},
+     {ATOM_TYPE_NR2, ATOM_TYPE_CPH1, ATOM_TYPE_CPH1, ATOM_TYPE_NR1, 180.00, 58.576, 2},
+     {ATOM_TYPE_NR2, ATOM_TYPE_CPH1, ATOM_TYPE_CT2, ATOM_TYPE_CT2, 0.00, 0.79496, 3},
+     {ATOM_TYPE_NR2, ATOM_TYPE_CPH1, ATOM_TYPE_CT2, ATOM_TYPE_CT3, 0.00, 0.79496, 3},
+     {ATOM_TYPE_NR2, ATOM_TYPE_CPH1, ATOM_TYPE_CT2, ATOM_TYPE_HA2, 0.00, 0.79496, 3},
+     {ATOM_TYPE_NR2, ATOM_TYPE_CPH1, ATOM_TYPE_CT3, ATOM_TYPE_HA3, 0.00, 0.79496, 3},
+     {ATOM_TYPE_NR2, ATOM_TYPE_CPH2, ATOM_TYPE_NR1, ATOM_TYPE_CPH1, 180.00, 58.576, 2},
+     {ATOM_TYPE_NR2, ATOM_TYPE_CPH2, ATOM_TYPE_NR1, ATOM_TYPE_H, 180.00, 4.184, 2},
+     {ATOM_TYPE_NR3, ATOM_TYPE_CPH1, ATOM_TYPE_CPH1, ATOM_TYPE_CT2, 180.00, 10.46, 2},
+     {ATOM_TYPE_NR3, ATOM_TYPE_CPH1, ATOM_TYPE_CPH1, ATOM_TYPE_CT3, 180.00, 10.46, 2},
+     {ATOM_TYPE_NR3, ATOM_TYPE_CPH1, ATOM_TYPE_CPH1, ATOM_TYPE_HR1, 180.00, 10.46, 2},
+     {ATOM_TYPE_NR3, ATOM_TYPE_CPH1, ATOM_TYPE_CPH1, ATOM_TYPE_NR3, 180.00, 50.208, 2},
+     {ATOM_TYPE_NR3, ATOM_TYPE_CPH1, ATOM_TYPE_CT2, ATOM_TYPE_CT2, 0.00, 0.79496, 3},
+     {ATOM_TYPE_NR3, ATOM_TYPE_CPH1, ATOM_TYPE_CT2, ATOM_TYPE_CT3, 0.00, 0.79496, 3},
+     {ATOM_TYPE_NR3, ATOM_TYPE_CPH1, ATOM_TYPE_CT2, ATOM_TYPE_HA2, 0.00, 0.79496, 3},
+     {ATOM_TYPE_NR3, ATOM_TYPE_CPH1, ATOM_TYPE_CT3, ATOM_TYPE_HA3, 0.00, 0.79496, 3},
+     {ATOM_TYPE_NR3, ATOM_TYPE_CPH2, ATOM_TYPE_NR3, ATOM_TYPE_CPH1, 180.00, 50.208, 2},
+     {ATOM_TYPE_NR3, ATOM_TYPE_CPH2, ATOM_TYPE_NR3, ATOM_TYPE_H, 180.00, 5.8576, 2},
+     {ATOM_TYPE_O, ATOM_TYPE_C, ATOM_TYPE_CP1, ATOM_TYPE_CP2, 180.00, 1.6736, 1},
+     {ATOM_TYPE_O, ATOM_TYPE_C, ATOM_TYPE_CP1, ATOM_TYPE_CP2, 0.00, 2.5104, 2},
+     {ATOM_TYPE_O, ATOM_TYPE_C, ATOM_TYPE_CP1, ATOM_TYPE_HB1, 0.00, 1.6736, 1},
+     {ATOM_TYPE_O, ATOM_TYPE_C, ATOM_TYPE_CP1, ATOM_TYPE_HB1, 0.00, 2.5104, 2},
+     {ATOM_TYPE_O, ATOM_TYPE_C, ATOM_TYPE_CP1, ATOM_TYPE_N, 0.00, -1.2552, 4},
+     {ATOM_TYPE_O, ATOM_TYPE_C, ATOM_TYPE_CT1, ATOM_TYPE_CT1, 0.00, 5.8576, 1},
+     {ATOM_TYPE_O, ATOM_TYPE_C, ATOM_TYPE_CT1, ATOM_TYPE_CT2, 0.00, 5.8576, 1},
+     {ATOM_TYPE_O, ATOM_TYPE_C, ATOM_TYPE_CT1, ATOM_TYPE_CT3, 0.00, 5.8576, 1},
+     {ATOM_TYPE_O, ATOM_TYPE_C, ATOM_TYPE_CT1, ATOM_TYPE_HB1, 0.00, 0.0, 1},
+     {ATOM_TYPE_O, ATOM_TYPE_C, ATOM_TYPE_CT1, ATOM_TYPE_NH1, 0.00, 0.0, 1},
+     {ATOM_TYPE_O, ATOM_TYPE_C, ATOM_TYPE_CT1, ATOM_TYPE_NH3, 0.00, 0.0, 1},
+     {ATOM_TYPE_O, ATOM_TYPE_C, ATOM_TYPE_CT2, ATOM_TYPE_CT2, 0.00, 5.8576, 1},
+     {ATOM_TYPE_O, ATOM_TYPE_C, ATOM_TYPE_CT2, ATOM_TYPE_HA2, 180.00, 0.0, 3},
+     {ATOM_TYPE_O, ATOM_TYPE_C, ATOM_TYPE_CT2, ATOM_TYPE_HB2, 0.00, 0.0, 1},
+     {ATOM_TYPE_O, ATOM_TYPE_C, ATOM_TYPE_CT2, ATOM_TYPE_NH1, 0.00, 0.0, 1},
+     {ATOM_TYPE_O, ATOM_TYPE_C, ATOM_TYPE_CT2, ATOM_TYPE_NH3, 0.00, 0.0, 1},
+     {ATOM_TYPE_O, ATOM_TYPE_C, ATOM_TYPE_CT3, ATOM_TYPE_HA3, 180.00, 0.0, 3},
+     {ATOM_TYPE_O, ATOM_TYPE_C, ATOM_TYPE_N, ATOM_TYPE_CP1, 180.00, 11.506, 2},
+     {ATOM_TYPE_O, ATOM_TYPE_C, ATOM_TYPE_N, ATOM_TYPE_CP1, 0.00, 1.2552, 4},
+     {ATOM_TYPE_O, ATOM_TYPE_C, ATOM_TYPE_N, ATOM_TYPE_CP3, 180.00, 11.506, 2},
+     {ATOM_TYPE_O, ATOM_TYPE_C, ATOM_TYPE_N, ATOM_TYPE_CP3, 0.00, 1.2552, 4},
+     {ATOM_TYPE_O, ATOM_TYPE_C, ATOM_TYPE_NH1, ATOM_TYPE_CT1, 180.00, 10.46, 2},
+     {ATOM_TYPE_O, ATOM_TYPE_C, ATOM_TYPE_NH1, ATOM_TYPE_CT2, 180.00, 10.46, 2},
+     {ATOM_TYPE_O, ATOM_TYPE_C, ATOM_TYPE_NH1, ATOM_TYPE_CT3, 180.00, 10.46, 2},
+     {ATOM_TYPE_O, ATOM_TYPE_C, ATOM_TYPE_NH1, ATOM_TYPE_H, 180.00, 10.46, 2},
+     {ATOM_TYPE_O, ATOM_TYPE_CC, ATOM_TYPE_CP1, ATOM_TYPE_CP2, 180.00, 1.6736, 1},
+     {ATOM_TYPE_O, ATOM_TYPE_CC, ATOM_TYPE_CP1, ATOM_TYPE_CP2, 0.00, 2.5104, 2},
+     {ATOM_TYPE_O, ATOM_TYPE_CC, ATOM_TYPE_CP1, ATOM_TYPE_HB1, 0.00, 1.6736, 1},
+     {ATOM_TYPE_O, ATOM_TYPE_CC, ATOM_TYPE_CP1, ATOM_TYPE_HB1, 0.00, 2.5104, 2},
+     {ATOM_TYPE_O, ATOM_TYPE_CC, ATOM_TYPE_CP1, ATOM_TYPE_N, 0.00, -1.2552, 4},
+     {ATOM_TYPE_O, ATOM_TYPE_CC, ATOM_TYPE_CT2, ATOM_TYPE_HA2, 180.00, 0.0, 3},
+     {ATOM_TYPE_O, ATOM_TYPE_CC, ATOM_TYPE_NH2, ATOM_TYPE_H, 180.00, 5.8576, 2},
+     {ATOM_TYPE_OB, ATOM_TYPE_CD, ATOM_TYPE_OS, ATOM_TYPE_CT2, 180.00, 4.03756, 1},
+     {ATOM_TYPE_OB, ATOM_TYPE_CD, ATOM_TYPE_OS, ATOM_TYPE_CT2, 180.00, 16.1084, 2},
+     {ATOM_TYPE_OB, ATOM_TYPE_CD, ATOM_TYPE_OS, ATOM_TYPE_CT3, 180.00, 4.03756, 1},
+     {ATOM_TYPE_OB, ATOM_TYPE_CD, ATOM_TYPE_OS, ATOM_TYPE_CT3, 180.00, 16.1084, 2},
+     {ATOM_TYPE_OC, ATOM_TYPE_CA, ATOM_TYPE_CA, ATOM_TYPE_CA, 180.00, 12.9704, 2},
+     {ATOM_TYPE_OC, ATOM_TYPE_CA, ATOM_TYPE_CA, ATOM_TYPE_HP, 180.00, 17.5728, 2},
+     {ATOM_TYPE_OC, ATOM_TYPE_CC, ATOM_TYPE_CP1, ATOM_TYPE_CP2, 0.00, 0.66944, 3},
+     {ATOM_TYPE_OC, ATOM_TYPE_CC, ATOM_TYPE_CP1, ATOM_TYPE_HB1, 0.00, 0.66944, 3},
+     {ATOM_TYPE_OC, ATOM_TYPE_CC, ATOM_TYPE_CP1, ATOM_TYPE_N, 0.00, 0.66944, 3},
+     {ATOM_TYPE_OC, ATOM_TYPE_CC, ATOM_TYPE_CP1, ATOM_TYPE_NP, 0.00, 0.66944, 3},
+     {ATOM_TYPE_OC, ATOM_TYPE_CC, ATOM_TYPE_CT1, ATOM_TYPE_NH3, 180.00, 13.3888, 2},
+     {ATOM_TYPE_OC, ATOM_TYPE_CC, ATOM_TYPE_CT2, ATOM_TYPE_NH3, 180.00, 13.3888, 2},
+     {ATOM_TYPE_OH1, ATOM_TYPE_CA, ATOM_TYPE_CA, ATOM_TYPE_CA, 180.00, 12.9704, 2},
+     {ATOM_TYPE_OH1, ATOM_TYPE_CA, ATOM_TYPE_CA, ATOM_TYPE_HP, 180.00, 17.5728, 2},
+     {ATOM_TYPE_S, ATOM_TYPE_CT2, ATOM_TYPE_CT2, ATOM_TYPE_HA2, 0.00, 0.04184, 3},
+     {ATOM_TYPE_SM, ATOM_TYPE_CT2, ATOM_TYPE_CT2, ATOM_TYPE_HA2, 0.00, 0.04184, 3},
+     {ATOM_TYPE_SM, ATOM_TYPE_SM, ATOM_TYPE_CT2, ATOM_TYPE_CT1, 0.00, 1.29704, 3},
+     {ATOM_TYPE_SM, ATOM_TYPE_SM, ATOM_TYPE_CT2, ATOM_TYPE_CT2, 0.00, 1.29704, 3},
+     {ATOM_TYPE_SM, ATOM_TYPE_SM, ATOM_TYPE_CT2, ATOM_TYPE_CT3, 0.00, 1.29704, 3},
+     {ATOM_TYPE_SM, ATOM_TYPE_SM, ATOM_TYPE_CT2, ATOM_TYPE_HA2, 0.00, 0.661072, 3},
+     {ATOM_TYPE_SM, ATOM_TYPE_SM, ATOM_TYPE_CT3, ATOM_TYPE_HA3, 0.00, 0.661072, 3},
+     {ATOM_TYPE_SS, ATOM_TYPE_CS, ATOM_TYPE_CT3, ATOM_TYPE_HA3, 0.00, 0.6276, 3},
+     {ATOM_TYPE_NH1, ATOM_TYPE_CT1, ATOM_TYPE_CT1, ATOM_TYPE_HA1, 0.00, 0.8368, 3},
+     {ATOM_TYPE_HB1, ATOM_TYPE_CT1, ATOM_TYPE_CT1, ATOM_TYPE_HA1, 0.00, 0.8368, 3},
+     {ATOM_TYPE_HB1, ATOM_TYPE_CT1, ATOM_TYPE_CT1, ATOM_TYPE_CT3, 0.00, 0.8368, 3},
+     {ATOM_TYPE_HA1, ATOM_TYPE_CT1, ATOM_TYPE_CT1, ATOM_TYPE_C, 0.00, 0.8368, 3},
+     {ATOM_TYPE_NH1, ATOM_TYPE_CT1, ATOM_TYPE_CT2, ATOM_TYPE_HA2, 0.00, 0.8368, 3},
+     {ATOM_TYPE_HB1, ATOM_TYPE_CT1, ATOM_TYPE_CT2, ATOM_TYPE_HA2, 0.00, 0.8368, 3},
+     {ATOM_TYPE_HB1, ATOM_TYPE_CT1, ATOM_TYPE_CT2, ATOM_TYPE_OH1, 0.00, 0.8368, 3},
+     {ATOM_TYPE_HB1, ATOM_TYPE_CT1, ATOM_TYPE_CT2, ATOM_TYPE_CT2, 0.00, 0.8368, 3},
+     {ATOM_TYPE_HA2, ATOM_TYPE_CT2, ATOM_TYPE_CT1, ATOM_TYPE_C, 0.00, 0.8368, 3},
+     {ATOM_TYPE_HA2, ATOM_TYPE_CT2, ATOM_TYPE_OH1, ATOM_TYPE_H, 0.00, 0.58576, 3},
+     {ATOM_TYPE_CT1, ATOM_TYPE_CT2, ATOM_TYPE_CT2, ATOM_TYPE_HA2, 0.00, 0.79496, 3},
+     {ATOM_TYPE_HA2, ATOM_TYPE_CT2, ATOM_TYPE_CT2, ATOM_TYPE_HA2, 0.00, 0.79496, 3},
+     {ATOM_TYPE_HA2, ATOM_TYPE_CT2, ATOM_TYPE_CT2, ATOM_TYPE_CC, 0.00, 0.79496, 3},
+     {ATOM_TYPE_HB1, ATOM_TYPE_CT1, ATOM_TYPE_CT2, ATOM_TYPE_S, 0.00, 0.8368, 3},
+     {ATOM_TYPE_CT2, ATOM_TYPE_CT2, ATOM_TYPE_CT2, ATOM_TYPE_HA2, 0.00, 0.79496, 3},
+     {ATOM_TYPE_CT2, ATOM_TYPE_CT2, ATOM_TYPE_CT2, ATOM_TYPE_NC2, 0.00, 0.79496, 3},
+     {ATOM_TYPE_CT2, ATOM_TYPE_CT2, ATOM_TYPE_NC2, ATOM_TYPE_HC, 180.00, 0.0, 6},
+     {ATOM_TYPE_CT2, ATOM_TYPE_CT2, ATOM_TYPE_NC2, ATOM_TYPE_C, 180.00, 0.0, 6},
+     {ATOM_TYPE_HA2, ATOM_TYPE_CT2, ATOM_TYPE_CT2, ATOM_TYPE_NC2, 0.00, 0.79496, 3},
+     {ATOM_TYPE_CT2, ATOM_TYPE_NC2, ATOM_TYPE_C, ATOM_TYPE_NC2, 180.00, 9.414, 2},
+     {ATOM_TYPE_HA2, ATOM_TYPE_CT2, ATOM_TYPE_NC2, ATOM_TYPE_HC, 180.00, 0.0, 6},
+     {ATOM_TYPE_HA2, ATOM_TYPE_CT2, ATOM_TYPE_NC2, ATOM_TYPE_C, 180.00, 0.0, 6},
+     {ATOM_TYPE_NC2, ATOM_TYPE_C, ATOM_TYPE_NC2, ATOM_TYPE_HC, 180.00, 9.414, 2},
+     {ATOM_TYPE_HB1, ATOM_TYPE_CT1, ATOM_TYPE_CT2, ATOM_TYPE_CC, 0.00, 0.8368, 3},
+     {ATOM_TYPE_HB1, ATOM_TYPE_CT1, ATOM_TYPE_CT2, ATOM_TYPE_CY, 0.00, 0.8368, 3},
+     {ATOM_TYPE_HA2, ATOM_TYPE_CT2, ATOM_TYPE_CC, ATOM_TYPE_OC, 180.00, 0.2092, 6},
+     {ATOM_TYPE_HB1, ATOM_TYPE_CT1, ATOM_TYPE_CT2, ATOM_TYPE_CPH1, 0.00, 0.8368, 3},
+     {ATOM_TYPE_CT1, ATOM_TYPE_CT1, ATOM_TYPE_CT3, ATOM_TYPE_HA3, 0.00, 0.8368, 3},
+     {ATOM_TYPE_CT1, ATOM_TYPE_CT1, ATOM_TYPE_CT2, ATOM_TYPE_HA2, 0.00, 0.8368, 3},
+     {ATOM_TYPE_HB1, ATOM_TYPE_CT1, ATOM_TYPE_CT1, ATOM_TYPE_CT2, 0.00, 0.8368, 3},
+     {ATOM_TYPE_CT1, ATOM_TYPE_CT2, ATOM_TYPE_CT3, ATOM_TYPE_HA3, 0.00, 0.66944, 3},
+     {ATOM_TYPE_HA1, ATOM_TYPE_CT1, ATOM_TYPE_CT3, ATOM_TYPE_HA3, 0.00, 0.8368, 3},
+     {ATOM_TYPE_HA1, ATOM_TYPE_CT1, ATOM_TYPE_CT2, ATOM_TYPE_HA2, 0.00, 0.8368, 3},
+     {ATOM_TYPE_HA1, ATOM_TYPE_CT1, ATOM_TYPE_CT2, ATOM_TYPE_CT3, 0.00, 0.8368, 3},
+     {ATOM_TYPE_CT3, ATOM_TYPE_CT1, ATOM_TYPE_CT2, ATOM_TYPE_HA2, 0.00, 0.8368, 3},
+     {ATOM_TYPE_CT3, ATOM_TYPE_CT1, ATOM_TYPE_CT2, ATOM_TYPE_CT3, 0.00, 0.8368, 3},
+     {ATOM_TYPE_HA3, ATOM_TYPE_CT3, ATOM_TYPE_CT1, ATOM_TYPE_CT2, 0.00, 0.8368, 3},
+     {ATOM_TYPE_HA2, ATOM_TYPE_CT2, ATOM_TYPE_CT3, ATOM_TYPE_HA3, 0.00, 0.66944, 3},
+     {ATOM_TYPE_CT1, ATOM_TYPE_CT2, ATOM_TYPE_CT1, ATOM_TYPE_HA1, 0.00, 0.8368, 3},
+     {ATOM_TYPE_HB1, ATOM_TYPE_CT1, ATOM_TYPE_CT2, ATOM_TYPE_CT1, 0.00, 0.8368, 3},
+     {ATOM_TYPE_CT3, ATOM_TYPE_CT1, ATOM_TYPE_CT3, ATOM_TYPE_HA3, 0.00, 0.8368, 3},
+     {ATOM_TYPE_CT2, ATOM_TYPE_CT2, ATOM_TYPE_CT2, ATOM_TYPE_NH3, 0.00, 0.79496, 3},
+     {ATOM_TYPE_CT2, ATOM_TYPE_CT2, ATOM_TYPE_NH3, ATOM_TYPE_HC, 0.00, 0.4184, 3},
+     {ATOM_TYPE_HA2, ATOM_TYPE_CT2, ATOM_TYPE_CT2, ATOM_TYPE_NH3, 0.00, 0.79496, 3},
+     {ATOM_TYPE_HA2, ATOM_TYPE_CT2, ATOM_TYPE_NH3, ATOM_TYPE_HC, 0.00, 0.4184, 3},
+     {ATOM_TYPE_HB1, ATOM_TYPE_CT1, ATOM_TYPE_CT2, ATOM_TYPE_CA, 0.00, 0.8368, 3},
+     {ATOM_TYPE_HA2, ATOM_TYPE_CT2, ATOM_TYPE_CA, ATOM_TYPE_CA, 0.00, 0.0, 6},
+     {ATOM_TYPE_HB1, ATOM_TYPE_CT1, ATOM_TYPE_CT1, ATOM_TYPE_OH1, 0.00, 0.8368, 3},
+     {ATOM_TYPE_HA1, ATOM_TYPE_CT1, ATOM_TYPE_OH1, ATOM_TYPE_H, 0.00, 0.58576, 3},
+     {ATOM_TYPE_OH1, ATOM_TYPE_CT1, ATOM_TYPE_CT3, ATOM_TYPE_HA3, 0.00, 0.8368, 3},
+     {ATOM_TYPE_CT2, ATOM_TYPE_CT2, ATOM_TYPE_CC, ATOM_TYPE_O, 180.00, 0.2092, 6},
+     {ATOM_TYPE_CT2, ATOM_TYPE_CT2, ATOM_TYPE_CC, ATOM_TYPE_NH2, 180.00, 0.2092, 6},
+     {ATOM_TYPE_CT2, ATOM_TYPE_CT2, ATOM_TYPE_CC, ATOM_TYPE_OC, 180.00, 0.2092, 6},
+     {ATOM_TYPE_NH1, ATOM_TYPE_CT1, ATOM_TYPE_CT2A, ATOM_TYPE_HA2, 0.00, 0.8368, 3},
+     {ATOM_TYPE_CT1, ATOM_TYPE_CT2A, ATOM_TYPE_CT2, ATOM_TYPE_HA2, 0.00, 0.79496, 3},
+     {ATOM_TYPE_HB1, ATOM_TYPE_CT1, ATOM_TYPE_CT2A, ATOM_TYPE_HA2, 0.00, 0.8368, 3},
+     {ATOM_TYPE_HB1, ATOM_TYPE_CT1, ATOM_TYPE_CT2A, ATOM_TYPE_CT2, 0.00, 0.8368, 3},
+     {ATOM_TYPE_HA2, ATOM_TYPE_CT2A, ATOM_TYPE_CT1, ATOM_TYPE_C, 0.00, 0.8368, 3},
+     {ATOM_TYPE_HA2, ATOM_TYPE_CT2A, ATOM_TYPE_CT1, ATOM_TYPE_CC, 0.00, 0.8368, 3},
+     {ATOM_TYPE_HA2, ATOM_TYPE_CT2A, ATOM_TYPE_CT2, ATOM_TYPE_HA2, 0.00, 0.79496, 3},
+     {ATOM_TYPE_HA2, ATOM_TYPE_CT2A, ATOM_TYPE_CT2, ATOM_TYPE_CC, 0.00, 0.79496, 3},
+     {ATOM_TYPE_HB1, ATOM_TYPE_CT1, ATOM_TYPE_CT2A, ATOM_TYPE_CPH1, 0.00, 0.8368, 3},
+     {ATOM_TYPE_C, ATOM_TYPE_NH1, ATOM_TYPE_CT1, ATOM_TYPE_CT2A, 0.00, 7.5312, 1},
+     {ATOM_TYPE_H, ATOM_TYPE_NH1, ATOM_TYPE_CT1, ATOM_TYPE_CT2A, 0.00, 0.0, 1},
+     {ATOM_TYPE_CT2A, ATOM_TYPE_CT1, ATOM_TYPE_C, ATOM_TYPE_O, 0.00, 5.8576, 1},
+     {ATOM_TYPE_CT2A, ATOM_TYPE_CT1, ATOM_TYPE_C, ATOM_TYPE_NH1, 0.00, 0.0, 1},
+     {ATOM_TYPE_CT2A, ATOM_TYPE_CT1, ATOM_TYPE_C, ATOM_TYPE_N, 0.00, 0.0, 1},
+     {ATOM_TYPE_CT1, ATOM_TYPE_CT2A, ATOM_TYPE_CT2, ATOM_TYPE_CD, 0.00, 0.79496, 3},
+     {ATOM_TYPE_HA2, ATOM_TYPE_CT2A, ATOM_TYPE_CT2, ATOM_TYPE_CD, 0.00, 0.79496, 3},
+     {ATOM_TYPE_CT2A, ATOM_TYPE_CPH1, ATOM_TYPE_CPH1, ATOM_TYPE_HR1, 180.00, 4.184, 2},
+     {ATOM_TYPE_CT2A, ATOM_TYPE_CPH1, ATOM_TYPE_CPH1, ATOM_TYPE_NR3, 180.00, 10.46, 2},
+     {ATOM_TYPE_CT2A, ATOM_TYPE_CPH1, ATOM_TYPE_NR3, ATOM_TYPE_H, 180.00, 12.552, 2},
+     {ATOM_TYPE_CT2A, ATOM_TYPE_CPH1, ATOM_TYPE_NR3, ATOM_TYPE_CPH2, 180.00, 10.46, 2},
+     {ATOM_TYPE_HA2, ATOM_TYPE_CT2A, ATOM_TYPE_CPH1, ATOM_TYPE_CPH1, 0.00, 0.0, 3},
+     {ATOM_TYPE_HA2, ATOM_TYPE_CT2A, ATOM_TYPE_CPH1, ATOM_TYPE_NR3, 0.00, 0.79496, 3},
+     {ATOM_TYPE_C, ATOM_TYPE_CT1, ATOM_TYPE_CT2, ATOM_TYPE_CT2, 180.00, 1.4644, 1},
+     {ATOM_TYPE_C, ATOM_TYPE_CT1, ATOM_TYPE_CT2, ATOM_TYPE_CT2, 180.00, 1.75728, 2},
+     {ATOM_TYPE_C, ATOM_TYPE_CT1, ATOM_TYPE_CT2, ATOM_TYPE_CT2, 180.00, 7.99144, 3},
+     {ATOM_TYPE_CT2, ATOM_TYPE_CT2, ATOM_TYPE_CT1, ATOM_TYPE_NH1, 180.00, 3.68192, 1},
+     {ATOM_TYPE_CT2, ATOM_TYPE_CT2, ATOM_TYPE_CT1, ATOM_TYPE_NH1, 180.00, 0.0, 2},
+     {ATOM_TYPE_CT2, ATOM_TYPE_CT2, ATOM_TYPE_CT1, ATOM_TYPE_NH1, 0.00, 7.9496, 3},
+     {ATOM_TYPE_CC, ATOM_TYPE_CT2, ATOM_TYPE_CT2, ATOM_TYPE_CT1, 180.00, 7.69856, 1},
+     {ATOM_TYPE_CC, ATOM_TYPE_CT2, ATOM_TYPE_CT2, ATOM_TYPE_CT1, 180.00, 3.51456, 2},
+     {ATOM_TYPE_CC, ATOM_TYPE_CT2, ATOM_TYPE_CT2, ATOM_TYPE_CT1, 180.00, 1.63176, 3},
+     {ATOM_TYPE_CT1, ATOM_TYPE_CT2, ATOM_TYPE_CT2, ATOM_TYPE_CT2, 180.00, 2.63592, 1},
+     {ATOM_TYPE_CT1, ATOM_TYPE_CT2, ATOM_TYPE_CT2, ATOM_TYPE_CT2, 0.00, 0.04184, 2},
+     {ATOM_TYPE_CT1, ATOM_TYPE_CT2, ATOM_TYPE_CT2, ATOM_TYPE_CT2, 0.00, 0.6276, 3},
+     {ATOM_TYPE_CT1, ATOM_TYPE_CT2, ATOM_TYPE_CT2, ATOM_TYPE_S, 180.00, 0.58576, 1},
+     {ATOM_TYPE_CT1, ATOM_TYPE_CT2, ATOM_TYPE_CT2, ATOM_TYPE_S, 0.00, 2.25936, 2},
+     {ATOM_TYPE_CT1, ATOM_TYPE_CT2, ATOM_TYPE_CT2, ATOM_TYPE_S, 0.00, 2.88696, 3},
+     {ATOM_TYPE_C, ATOM_TYPE_CT1, ATOM_TYPE_CT2, ATOM_TYPE_CC, 180.00, 5.89944, 1},
+     {ATOM_TYPE_C, ATOM_TYPE_CT1, ATOM_TYPE_CT2, ATOM_TYPE_CC, 180.00, 5.39736, 2},
+     {ATOM_TYPE_C, ATOM_TYPE_CT1, ATOM_TYPE_CT2, ATOM_TYPE_CC, 180.00, 2.46856, 3},
+     {ATOM_TYPE_CC, ATOM_TYPE_CT2, ATOM_TYPE_CT1, ATOM_TYPE_NH1, 180.00, 1.17152, 1},
+     {ATOM_TYPE_CC, ATOM_TYPE_CT2, ATOM_TYPE_CT1, ATOM_TYPE_NH1, 180.00, 2.092, 2},
+     {ATOM_TYPE_CC, ATOM_TYPE_CT2, ATOM_TYPE_CT1, ATOM_TYPE_NH1, 0.00, 1.58992, 3},
+     {ATOM_TYPE_CT1, ATOM_TYPE_CT2, ATOM_TYPE_CC, ATOM_TYPE_NH2, 180.00, 2.59408, 1},
+     {ATOM_TYPE_CT1, ATOM_TYPE_CT2, ATOM_TYPE_CC, ATOM_TYPE_NH2, 180.00, 2.76144, 2},
+     {ATOM_TYPE_CT1, ATOM_TYPE_CT2, ATOM_TYPE_CC, ATOM_TYPE_NH2, 180.00, 3.01248, 3},
+     {ATOM_TYPE_CT1, ATOM_TYPE_CT2, ATOM_TYPE_CC, ATOM_TYPE_O, 180.00, 1.75728, 1},
+     {ATOM_TYPE_CT1, ATOM_TYPE_CT2, ATOM_TYPE_CC, ATOM_TYPE_O, 180.00, 0.6276, 2},
+     {ATOM_TYPE_CT1, ATOM_TYPE_CT2, ATOM_TYPE_CC, ATOM_TYPE_O, 180.00, 3.9748, 3},
+     {ATOM_TYPE_C, ATOM_TYPE_CT1, ATOM_TYPE_CT2A, ATOM_TYPE_CC, 180.00, 6.73624, 1},
+     {ATOM_TYPE_C, ATOM_TYPE_CT1, ATOM_TYPE_CT2A, ATOM_TYPE_CC, 180.00, 5.39736, 2},
+     {ATOM_TYPE_C, ATOM_TYPE_CT1, ATOM_TYPE_CT2A, ATOM_TYPE_CC, 180.00, 2.46856, 3},
+     {ATOM_TYPE_CC, ATOM_TYPE_CT2A, ATOM_TYPE_CT1, ATOM_TYPE_NH1, 180.00, 2.84512, 1},
+     {ATOM_TYPE_CC, ATOM_TYPE_CT2A, ATOM_TYPE_CT1, ATOM_TYPE_NH1, 180.00, 0.4184, 2},
+     {ATOM_TYPE_CC, ATOM_TYPE_CT2A, ATOM_TYPE_CT1, ATOM_TYPE_NH1, 0.00, 1.58992, 3},
+     {ATOM_TYPE_CT1, ATOM_TYPE_CT2A, ATOM_TYPE_CC, ATOM_TYPE_OC, 0.00, 3.51456, 1},
+     {ATOM_TYPE_CT1, ATOM_TYPE_CT2A, ATOM_TYPE_CC, ATOM_TYPE_OC, 180.00, 4.10032, 2},
+     {ATOM_TYPE_CT1, ATOM_TYPE_CT2A, ATOM_TYPE_CC, ATOM_TYPE_OC, 0.00, 6.10864, 3},
+     {ATOM_TYPE_CT1, ATOM_TYPE_CT2, ATOM_TYPE_S, ATOM_TYPE_HS, 0.00, 0.8368, 1},
+     {ATOM_TYPE_CT1, ATOM_TYPE_CT2, ATOM_TYPE_S, ATOM_TYPE_HS, 0.00, 2.7196, 2},
+     {ATOM_TYPE_CT1, ATOM_TYPE_CT2, ATOM_TYPE_S, ATOM_TYPE_HS, 0.00, 0.92048, 3},
+     {ATOM_TYPE_C, ATOM_TYPE_CT1, ATOM_TYPE_CT2, ATOM_TYPE_S, 180.00, 1.00416, 1},
+     {ATOM_TYPE_C, ATOM_TYPE_CT1, ATOM_TYPE_CT2, ATOM_TYPE_S, 180.00, 3.138, 2},
+     {ATOM_TYPE_C, ATOM_TYPE_CT1, ATOM_TYPE_CT2, ATOM_TYPE_S, 180.00, 5.6484, 3},
+     {ATOM_TYPE_NH1, ATOM_TYPE_CT1, ATOM_TYPE_CT2, ATOM_TYPE_S, 0.00, 1.42256, 1},
+     {ATOM_TYPE_NH1, ATOM_TYPE_CT1, ATOM_TYPE_CT2, ATOM_TYPE_S, 180.00, 2.092, 2},
+     {ATOM_TYPE_NH1, ATOM_TYPE_CT1, ATOM_TYPE_CT2, ATOM_TYPE_S, 0.00, 5.98312, 3},
+     {ATOM_TYPE_CC, ATOM_TYPE_CT2, ATOM_TYPE_CT2A, ATOM_TYPE_CT1, 180.00, 0.0, 1},
+     {ATOM_TYPE_CC, ATOM_TYPE_CT2, ATOM_TYPE_CT2A, ATOM_TYPE_CT1, 180.00, 1.58992, 2},
+     {ATOM_TYPE_CC, ATOM_TYPE_CT2, ATOM_TYPE_CT2A, ATOM_TYPE_CT1, 180.00, 2.46856, 3},
+     {ATOM_TYPE_C, ATOM_TYPE_CT1, ATOM_TYPE_CT2A, ATOM_TYPE_CT2, 0.00, 0.46024, 1},
+     {ATOM_TYPE_C, ATOM_TYPE_CT1, ATOM_TYPE_CT2A, ATOM_TYPE_CT2, 180.00, 4.10032, 2},
+     {ATOM_TYPE_C, ATOM_TYPE_CT1, ATOM_TYPE_CT2A, ATOM_TYPE_CT2, 180.00, 6.6944, 3},
+     {ATOM_TYPE_CC, ATOM_TYPE_CT1, ATOM_TYPE_CT2A, ATOM_TYPE_CT2, 180.00, 6.6944, 3},
+     {ATOM_TYPE_CT2, ATOM_TYPE_CT2A, ATOM_TYPE_CT1, ATOM_TYPE_NH1, 0.00, 1.2552, 1},
+     {ATOM_TYPE_CT2, ATOM_TYPE_CT2A, ATOM_TYPE_CT1, ATOM_TYPE_NH1, 0.00, 1.4644, 2},
+     {ATOM_TYPE_CT2, ATOM_TYPE_CT2A, ATOM_TYPE_CT1, ATOM_TYPE_NH1, 0.00, 7.36384, 3},
+     {ATOM_TYPE_CPH1, ATOM_TYPE_CPH1, ATOM_TYPE_CT2, ATOM_TYPE_CT1, 0.00, 7.28016, 1},
+     {ATOM_TYPE_CPH1, ATOM_TYPE_CPH1, ATOM_TYPE_CT2, ATOM_TYPE_CT1, 0.00, 0.6276, 2},
+     {ATOM_TYPE_CPH1, ATOM_TYPE_CPH1, ATOM_TYPE_CT2, ATOM_TYPE_CT1, 180.00, 3.22168, 3},
+     {ATOM_TYPE_CT1, ATOM_TYPE_CT2, ATOM_TYPE_CPH1, ATOM_TYPE_NR1, 0.00, 6.23416, 1},
+     {ATOM_TYPE_CT1, ATOM_TYPE_CT2, ATOM_TYPE_CPH1, ATOM_TYPE_NR1, 180.00, 0.37656, 2},
+     {ATOM_TYPE_CT1, ATOM_TYPE_CT2, ATOM_TYPE_CPH1, ATOM_TYPE_NR1, 180.00, 3.30536, 3},
+     {ATOM_TYPE_CT1, ATOM_TYPE_CT2, ATOM_TYPE_CPH1, ATOM_TYPE_NR2, 0.00, 4.56056, 1},
+     {ATOM_TYPE_CT1, ATOM_TYPE_CT2, ATOM_TYPE_CPH1, ATOM_TYPE_NR2, 0.00, 0.37656, 2},
+     {ATOM_TYPE_CT1, ATOM_TYPE_CT2, ATOM_TYPE_CPH1, ATOM_TYPE_NR2, 180.00, 2.80328, 3},
+     {ATOM_TYPE_C, ATOM_TYPE_CT1, ATOM_TYPE_CT2, ATOM_TYPE_CPH1, 180.00, 0.75312, 1},
+     {ATOM_TYPE_C, ATOM_TYPE_CT1, ATOM_TYPE_CT2, ATOM_TYPE_CPH1, 180.00, 2.67776, 2},
+     {ATOM_TYPE_C, ATOM_TYPE_CT1, ATOM_TYPE_CT2, ATOM_TYPE_CPH1, 180.00, 3.64008, 3},
+     {ATOM_TYPE_CPH1, ATOM_TYPE_CT2, ATOM_TYPE_CT1, ATOM_TYPE_NH1, 0.00, 0.0, 1},
+     {ATOM_TYPE_CPH1, ATOM_TYPE_CT2, ATOM_TYPE_CT1, ATOM_TYPE_NH1, 180.00, 0.0, 2},
+     {ATOM_TYPE_CPH1, ATOM_TYPE_CT2, ATOM_TYPE_CT1, ATOM_TYPE_NH1, 0.00, 3.7656, 3},
+     {ATOM_TYPE_CPH1, ATOM_TYPE_CPH1, ATOM_TYPE_CT2A, ATOM_TYPE_CT1, 0.00, 8.53536, 1},
+     {ATOM_TYPE_CPH1, ATOM_TYPE_CPH1, ATOM_TYPE_CT2A, ATOM_TYPE_CT1, 0.00, 1.84096, 2},
+     {ATOM_TYPE_CPH1, ATOM_TYPE_CPH1, ATOM_TYPE_CT2A, ATOM_TYPE_CT1, 180.00, 0.54392, 3},
+     {ATOM_TYPE_CT1, ATOM_TYPE_CT2A, ATOM_TYPE_CPH1, ATOM_TYPE_NR3, 180.00, 2.21752, 1},
+     {ATOM_TYPE_CT1, ATOM_TYPE_CT2A, ATOM_TYPE_CPH1, ATOM_TYPE_NR3, 180.00, 1.75728, 2},
+     {ATOM_TYPE_CT1, ATOM_TYPE_CT2A, ATOM_TYPE_CPH1, ATOM_TYPE_NR3, 180.00, 1.2552, 3},
+     {ATOM_TYPE_C, ATOM_TYPE_CT1, ATOM_TYPE_CT2A, ATOM_TYPE_CPH1, 180.00, 7.322, 1},
+     {ATOM_TYPE_C, ATOM_TYPE_CT1, ATOM_TYPE_CT2A, ATOM_TYPE_CPH1, 0.00, 0.54392, 2},
+     {ATOM_TYPE_C, ATOM_TYPE_CT1, ATOM_TYPE_CT2A, ATOM_TYPE_CPH1, 180.00, 7.78224, 3},
+     {ATOM_TYPE_CPH1, ATOM_TYPE_CT2A, ATOM_TYPE_CT1, ATOM_TYPE_NH1, 180.00, 4.56056, 1},
+     {ATOM_TYPE_CPH1, ATOM_TYPE_CT2A, ATOM_TYPE_CT1, ATOM_TYPE_NH1, 180.00, 0.92048, 2},
+     {ATOM_TYPE_CPH1, ATOM_TYPE_CT2A, ATOM_TYPE_CT1, ATOM_TYPE_NH1, 0.00, 9.70688, 3},
+     {ATOM_TYPE_CT1, ATOM_TYPE_CT1, ATOM_TYPE_CT2, ATOM_TYPE_CT3, 180.00, 1.58992, 1},
+     {ATOM_TYPE_CT1, ATOM_TYPE_CT1, ATOM_TYPE_CT2, ATOM_TYPE_CT3, 180.00, 0.54392, 2},
+     {ATOM_TYPE_CT1, ATOM_TYPE_CT1, ATOM_TYPE_CT2, ATOM_TYPE_CT3, 180.00, 1.21336, 3},
+     {ATOM_TYPE_C, ATOM_TYPE_CT1, ATOM_TYPE_CT1, ATOM_TYPE_CT2, 180.00, 0.4184, 1},
+     {ATOM_TYPE_C, ATOM_TYPE_CT1, ATOM_TYPE_CT1, ATOM_TYPE_CT2, 180.00, 2.17568, 2},
+     {ATOM_TYPE_C, ATOM_TYPE_CT1, ATOM_TYPE_CT1, ATOM_TYPE_CT2, 180.00, 1.21336, 3},
+     {ATOM_TYPE_CT2, ATOM_TYPE_CT1, ATOM_TYPE_CT1, ATOM_TYPE_NH1, 180.00, 0.50208, 1},
+     {ATOM_TYPE_CT2, ATOM_TYPE_CT1, ATOM_TYPE_CT1, ATOM_TYPE_NH1, 180.00, 1.50624, 2},
+     {ATOM_TYPE_CT2, ATOM_TYPE_CT1, ATOM_TYPE_CT1, ATOM_TYPE_NH1, 0.00, 1.71544, 3},
+     {ATOM_TYPE_CT1, ATOM_TYPE_CT2, ATOM_TYPE_CT1, ATOM_TYPE_CT3, 0.00, 0.2092, 1},
+     {ATOM_TYPE_CT1, ATOM_TYPE_CT2, ATOM_TYPE_CT1, ATOM_TYPE_CT3, 180.00, 0.4184, 2},
+     {ATOM_TYPE_CT1, ATOM_TYPE_CT2, ATOM_TYPE_CT1, ATOM_TYPE_CT3, 180.00, 0.04184, 3},
+     {ATOM_TYPE_C, ATOM_TYPE_CT1, ATOM_TYPE_CT2, ATOM_TYPE_CT1, 180.00, 1.33888, 1},
+     {ATOM_TYPE_C, ATOM_TYPE_CT1, ATOM_TYPE_CT2, ATOM_TYPE_CT1, 180.00, 2.55224, 2},
+     {ATOM_TYPE_C, ATOM_TYPE_CT1, ATOM_TYPE_CT2, ATOM_TYPE_CT1, 180.00, 3.01248, 3},
+     {ATOM_TYPE_CT1, ATOM_TYPE_CT2, ATOM_TYPE_CT1, ATOM_TYPE_NH1, 180.00, 2.00832, 1},
+     {ATOM_TYPE_CT1, ATOM_TYPE_CT2, ATOM_TYPE_CT1, ATOM_TYPE_NH1, 180.00, 1.75728, 2},
+     {ATOM_TYPE_CT1, ATOM_TYPE_CT2, ATOM_TYPE_CT1, ATOM_TYPE_NH1, 0.00, 2.7196, 3},
+     {ATOM_TYPE_CA, ATOM_TYPE_CA, ATOM_TYPE_CT2, ATOM_TYPE_CT1, 0.00, 4.47688, 1},
+     {ATOM_TYPE_CA, ATOM_TYPE_CA, ATOM_TYPE_CT2, ATOM_TYPE_CT1, 180.00, 1.00416, 2},
+     {ATOM_TYPE_CA, ATOM_TYPE_CA, ATOM_TYPE_CT2, ATOM_TYPE_CT1, 180.00, 0.71128, 3},
+     {ATOM_TYPE_C, ATOM_TYPE_CT1, ATOM_TYPE_CT2, ATOM_TYPE_CA, 180.00, 5.35552, 1},
+     {ATOM_TYPE_C, ATOM_TYPE_CT1, ATOM_TYPE_CT2, ATOM_TYPE_CA, 180.00, 3.93296, 2},
+     {ATOM_TYPE_C, ATOM_TYPE_CT1, ATOM_TYPE_CT2, ATOM_TYPE_CA, 180.00, 6.56888, 3},
+     {ATOM_TYPE_CA, ATOM_TYPE_CT2, ATOM_TYPE_CT1, ATOM_TYPE_NH1, 180.00, 2.17568, 1},
+     {ATOM_TYPE_CA, ATOM_TYPE_CT2, ATOM_TYPE_CT1, ATOM_TYPE_NH1, 180.00, 2.59408, 2},
+     {ATOM_TYPE_CA, ATOM_TYPE_CT2, ATOM_TYPE_CT1, ATOM_TYPE_NH1, 0.00, 6.61072, 3},
+     {ATOM_TYPE_CT1, ATOM_TYPE_CT2, ATOM_TYPE_OH1, ATOM_TYPE_H, 0.00, 0.08368, 1},
+     {ATOM_TYPE_CT1, ATOM_TYPE_CT2, ATOM_TYPE_OH1, ATOM_TYPE_H, 0.00, 2.34304, 2},
+     {ATOM_TYPE_CT1, ATOM_TYPE_CT2, ATOM_TYPE_OH1, ATOM_TYPE_H, 0.00, 2.05016, 3},
+     {ATOM_TYPE_C, ATOM_TYPE_CT1, ATOM_TYPE_CT2, ATOM_TYPE_OH1, 180.00, 2.7196, 1},
+     {ATOM_TYPE_C, ATOM_TYPE_CT1, ATOM_TYPE_CT2, ATOM_TYPE_OH1, 180.00, 1.046, 2},
+     {ATOM_TYPE_C, ATOM_TYPE_CT1, ATOM_TYPE_CT2, ATOM_TYPE_OH1, 180.00, 4.89528, 3},
+     {ATOM_TYPE_NH1, ATOM_TYPE_CT1, ATOM_TYPE_CT2, ATOM_TYPE_OH1, 180.00, 0.75312, 1},
+     {ATOM_TYPE_NH1, ATOM_TYPE_CT1, ATOM_TYPE_CT2, ATOM_TYPE_OH1, 180.00, 0.79496, 2},
+     {ATOM_TYPE_NH1, ATOM_TYPE_CT1, ATOM_TYPE_CT2, ATOM_TYPE_OH1, 0.00, 6.10864, 3},
+     {ATOM_TYPE_CT1, ATOM_TYPE_CT1, ATOM_TYPE_OH1, ATOM_TYPE_H, 0.00, 0.75312, 1},
+     {ATOM_TYPE_CT1, ATOM_TYPE_CT1, ATOM_TYPE_OH1, ATOM_TYPE_H, 0.00, 0.25104, 2},
+     {ATOM_TYPE_CT1, ATOM_TYPE_CT1, ATOM_TYPE_OH1, ATOM_TYPE_H, 0.00, 1.046, 3},
+     {ATOM_TYPE_C, ATOM_TYPE_CT1, ATOM_TYPE_CT1, ATOM_TYPE_OH1, 180.00, 3.30536, 1},
+     {ATOM_TYPE_C, ATOM_TYPE_CT1, ATOM_TYPE_CT1, ATOM_TYPE_OH1, 180.00, 1.63176, 2},
+     {ATOM_TYPE_C, ATOM_TYPE_CT1, ATOM_TYPE_CT1, ATOM_TYPE_OH1, 180.00, 4.14216, 3},
+     {ATOM_TYPE_NH1, ATOM_TYPE_CT1, ATOM_TYPE_CT1, ATOM_TYPE_OH1, 0.00, 0.37656, 1},
+     {ATOM_TYPE_NH1, ATOM_TYPE_CT1, ATOM_TYPE_CT1, ATOM_TYPE_OH1, 180.00, 0.79496, 2},
+     {ATOM_TYPE_NH1, ATOM_TYPE_CT1, ATOM_TYPE_CT1, ATOM_TYPE_OH1, 0.00, 0.71128, 3},
+     {ATOM_TYPE_CA, ATOM_TYPE_CY, ATOM_TYPE_CT2, ATOM_TYPE_CT1, 0.00, 0.12552, 1},
+     {ATOM_TYPE_CA, ATOM_TYPE_CY, ATOM_TYPE_CT2, ATOM_TYPE_CT1, 0.00, 2.3012, 2},
+     {ATOM_TYPE_CA, ATOM_TYPE_CY, ATOM_TYPE_CT2, ATOM_TYPE_CT1, 180.00, 1.63176, 3},
+     {ATOM_TYPE_CPT, ATOM_TYPE_CY, ATOM_TYPE_CT2, ATOM_TYPE_CT1, 180.00, 1.50624, 1},
+     {ATOM_TYPE_CPT, ATOM_TYPE_CY, ATOM_TYPE_CT2, ATOM_TYPE_CT1, 0.00, 0.2092, 2},
+     {ATOM_TYPE_CPT, ATOM_TYPE_CY, ATOM_TYPE_CT2, ATOM_TYPE_CT1, 180.00, 0.79496, 3},
+     {ATOM_TYPE_C, ATOM_TYPE_CT1, ATOM_TYPE_CT2, ATOM_TYPE_CY, 180.00, 4.56056, 1},
+     {ATOM_TYPE_C, ATOM_TYPE_CT1, ATOM_TYPE_CT2, ATOM_TYPE_CY, 180.00, 2.092, 2},
+     {ATOM_TYPE_C, ATOM_TYPE_CT1, ATOM_TYPE_CT2, ATOM_TYPE_CY, 180.00, 4.89528, 3},
+     {ATOM_TYPE_CY, ATOM_TYPE_CT2, ATOM_TYPE_CT1, ATOM_TYPE_NH1, 180.00, 1.21336, 1},
+     {ATOM_TYPE_CY, ATOM_TYPE_CT2, ATOM_TYPE_CT1, ATOM_TYPE_NH1, 180.00, 2.76144, 2},
+     {ATOM_TYPE_CY, ATOM_TYPE_CT2, ATOM_TYPE_CT1, ATOM_TYPE_NH1, 0.00, 4.89528, 3},
+     {ATOM_TYPE_C, ATOM_TYPE_CT1, ATOM_TYPE_CT1, ATOM_TYPE_CT3, 180.00, 0.58576, 1},
+     {ATOM_TYPE_C, ATOM_TYPE_CT1, ATOM_TYPE_CT1, ATOM_TYPE_CT3, 180.00, 1.08784, 2},
+     {ATOM_TYPE_C, ATOM_TYPE_CT1, ATOM_TYPE_CT1, ATOM_TYPE_CT3, 180.00, 1.38072, 3},
+     {ATOM_TYPE_CT3, ATOM_TYPE_CT1, ATOM_TYPE_CT1, ATOM_TYPE_NH1, 0.00, 0.75312, 1},
+     {ATOM_TYPE_CT3, ATOM_TYPE_CT1, ATOM_TYPE_CT1, ATOM_TYPE_NH1, 0.00, 0.25104, 2},
+     {ATOM_TYPE_CT3, ATOM_TYPE_CT1, ATOM_TYPE_CT1, ATOM_TYPE_NH1, 0.00, 2.46856, 3},
+     {ATOM_TYPE_H, ATOM_TYPE_NH1, ATOM_TYPE_CT2A, ATOM_TYPE_CC, 0.00, 0.0, 1},
+     {ATOM_TYPE_HB1, ATOM_TYPE_CT1, ATOM_TYPE_CT2A, ATOM_TYPE_CC, 0.00, 0.8368, 3},
+     {ATOM_TYPE_HA2, ATOM_TYPE_CT2A, ATOM_TYPE_CC, ATOM_TYPE_OC, 180.00, 0.2092, 6},
+     {ATOM_TYPE_NH3, ATOM_TYPE_CT1, ATOM_TYPE_CT2A, ATOM_TYPE_HA2, 0.00, 0.8368, 3},
+     {ATOM_TYPE_NH3, ATOM_TYPE_CT1, ATOM_TYPE_CT2A, ATOM_TYPE_CC, 0.00, 0.8368, 3},
+     {ATOM_TYPE_CC, ATOM_TYPE_CT2A, ATOM_TYPE_CT1, ATOM_TYPE_CC, 0.00, 0.8368, 3},
+     {ATOM_TYPE_X, ATOM_TYPE_CS, ATOM_TYPE_SS, ATOM_TYPE_X, 0.20, 0.0, 3},
+     {ATOM_TYPE_X, ATOM_TYPE_C, ATOM_TYPE_NC2, ATOM_TYPE_X, 180.00, 9.414, 2},
+     {ATOM_TYPE_X, ATOM_TYPE_CD, ATOM_TYPE_OH1, ATOM_TYPE_X, 180.00, 8.5772, 2},
+     {ATOM_TYPE_X, ATOM_TYPE_CD, ATOM_TYPE_OS, ATOM_TYPE_X, 180.00, 8.5772, 2},
+     {ATOM_TYPE_X, ATOM_TYPE_CE1, ATOM_TYPE_CE1, ATOM_TYPE_X, 0.00, 0.6276, 1},
+     {ATOM_TYPE_X, ATOM_TYPE_CE1, ATOM_TYPE_CE1, ATOM_TYPE_X, 180.00, 35.564, 2},
+     {ATOM_TYPE_X, ATOM_TYPE_CE2, ATOM_TYPE_CE2, ATOM_TYPE_X, 180.00, 20.5016, 2},
+     {ATOM_TYPE_X, ATOM_TYPE_CP1, ATOM_TYPE_C, ATOM_TYPE_X, 180.00, 0.0, 6},
+     {ATOM_TYPE_X, ATOM_TYPE_CP1, ATOM_TYPE_CC, ATOM_TYPE_X, 180.00, 0.0, 6},
+     {ATOM_TYPE_X, ATOM_TYPE_CP1, ATOM_TYPE_CD, ATOM_TYPE_X, 180.00, 0.0, 6},
+     {ATOM_TYPE_X, ATOM_TYPE_CP1, ATOM_TYPE_CP2, ATOM_TYPE_X, 0.00, 0.58576, 3},
+     {ATOM_TYPE_X, ATOM_TYPE_CP2, ATOM_TYPE_CP2, ATOM_TYPE_X, 0.00, 0.66944, 3},
+     {ATOM_TYPE_X, ATOM_TYPE_CP3, ATOM_TYPE_CP2, ATOM_TYPE_X, 0.00, 0.58576, 3},
+     {ATOM_TYPE_X, ATOM_TYPE_CT1, ATOM_TYPE_CC, ATOM_TYPE_X, 180.00, 0.2092, 6},
+     {ATOM_TYPE_X, ATOM_TYPE_CT1, ATOM_TYPE_CD, ATOM_TYPE_X, 180.00, 0.0, 6},
+     {ATOM_TYPE_X, ATOM_TYPE_CT1, ATOM_TYPE_CT1, ATOM_TYPE_X, 0.00, 0.8368, 3},
+     {ATOM_TYPE_X, ATOM_TYPE_CT1, ATOM_TYPE_CT2, ATOM_TYPE_X, 0.00, 0.8368, 3},
+     {ATOM_TYPE_X, ATOM_TYPE_CT1, ATOM_TYPE_CT3, ATOM_TYPE_X, 0.00, 0.8368, 3},
+     {ATOM_TYPE_X, ATOM_TYPE_CT1, ATOM_TYPE_NH3, ATOM_TYPE_X, 0.00, 0.4184, 3},
+     {ATOM_TYPE_X, ATOM_TYPE_CT1, ATOM_TYPE_OH1, ATOM_TYPE_X, 0.00, 0.58576, 3},
+     {ATOM_TYPE_X, ATOM_TYPE_CT1, ATOM_TYPE_OS, ATOM_TYPE_X, 0.00, -0.4184, 3},
+     {ATOM_TYPE_X, ATOM_TYPE_CT2, ATOM_TYPE_CA, ATOM_TYPE_X, 0.00, 0.0, 6},
+     {ATOM_TYPE_X, ATOM_TYPE_CT2, ATOM_TYPE_CC, ATOM_TYPE_X, 180.00, 0.2092, 6},
+     {ATOM_TYPE_X, ATOM_TYPE_CT2, ATOM_TYPE_CD, ATOM_TYPE_X, 180.00, 0.0, 6},
+     {ATOM_TYPE_X, ATOM_TYPE_CT2, ATOM_TYPE_CT2, ATOM_TYPE_X, 0.00, 0.79496, 3},
+     {ATOM_TYPE_X, ATOM_TYPE_CT2, ATOM_TYPE_CT3, ATOM_TYPE_X, 0.00, 0.66944, 3},
+     {ATOM_TYPE_X, ATOM_TYPE_CT2, ATOM_TYPE_NC2, ATOM_TYPE_X, 180.00, 0.0, 6},
+     {ATOM_TYPE_X, ATOM_TYPE_CT2, ATOM_TYPE_NH3, ATOM_TYPE_X, 0.00, 0.4184, 3},
+     {ATOM_TYPE_X, ATOM_TYPE_CT2, ATOM_TYPE_OH1, ATOM_TYPE_X, 0.00, 0.58576, 3},
+     {ATOM_TYPE_X, ATOM_TYPE_CT2, ATOM_TYPE_OS, ATOM_TYPE_X, 0.00, -0.4184, 3},
+     {ATOM_TYPE_X, ATOM_TYPE_CT3, ATOM_TYPE_CA, ATOM_TYPE_X, 0.00, 0.0, 6},
+     {ATOM_TYPE_X, ATOM_TYPE_CT3, ATOM_TYPE_CC, ATOM_TYPE_X, 180.00, 0.2092, 6},
+     {ATOM_TYPE_X, ATOM_TYPE_CT3, ATOM_TYPE_CD, ATOM_TYPE_X, 180.00, 0.0, 6},
+     {ATOM_TYPE_X, ATOM_TYPE_CT3, ATOM_TYPE_CT3, ATOM_TYPE_X, 0.00, 0.63806, 3},
+     {ATOM_TYPE_X, ATOM_TYPE_CT3, ATOM_TYPE_NC2, ATOM_TYPE_X, 180.00, 0.0, 6},
+     {ATOM_TYPE_X, ATOM_TYPE_CT3, ATOM_TYPE_NH2, ATOM_TYPE_X, 0.00, 0.46024, 3},
+     {ATOM_TYPE_X, ATOM_TYPE_CT3, ATOM_TYPE_NH3, ATOM_TYPE_X, 0.00, 0.37656, 3},
+     {ATOM_TYPE_X, ATOM_TYPE_CT3, ATOM_TYPE_OH1, ATOM_TYPE_X, 0.00, 0.58576, 3},
+     {ATOM_TYPE_X, ATOM_TYPE_CT3, ATOM_TYPE_OS, ATOM_TYPE_X, 0.00, -0.4184, 3},
+     {ATOM_TYPE_X, ATOM_TYPE_CT2A, ATOM_TYPE_CC, ATOM_TYPE_X, 180.00, 0.2092, 6},
+};
+
+} // End namespace charmm_parameters
+
+#endif
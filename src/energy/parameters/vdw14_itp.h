@@ -1,640 +0,0 @@
-// vdw14_itp.h --- std::string'ed version of vdw14.itp
-// Copyright (C) 2014 Anders S. Christensen
-// Copyright (c) 1991-2000, University of Groningen, The Netherlands.
-// Copyright (c) 2001-2004, The GROMACS development team,
-//
-// This file is part of Phaistos
-//
-// Phaistos is free software: you can redistribute it and/or modify
-// it under the terms of the GNU General Public License as published by
-// the Free Software Foundation, either version 3 of the License, or
-// (at your option) any later version.
-//
-// Phaistos is distributed in the hope that it will be useful,
-// but WITHOUT ANY WARRANTY; without even the implied warranty of
-// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
-// GNU General Public License for more details.
-//
-// You should have received a copy of the GNU General Public License
-// along with Phaistos.  If not, see <http://www.gnu.org/licenses/>.
-//
-
-#ifndef TERM_CHARMM_VDW14_ITP_H
-#define TERM_CHARMM_VDW14_ITP_H
-
-namespace charmm_constants {
-
-const static std::string vdw14_itp = "CP1	CP1	1	0.338541512893	0.04184\n\
-CP1	CP2	1	0.338541512893	0.04184\n\
-CP1	CP3	1	0.338541512893	0.04184\n\
-CP1	CT	1	0.338541512893	0.04184\n\
-CP1	CT1	1	0.338541512893	0.04184\n\
-CP1	CT2	1	0.338541512893	0.04184\n\
-CP1	CT2A	1	0.338541512893	0.04184\n\
-CP1	CT3	1	0.338541512893	0.04184\n\
-CP1	HP	1	0.290272620344	0.0724690057887\n\
-CP1	N	1	0.334087019303	0.004184\n\
-CP1	NH1	1	0.307360057759	0.187114168357\n\
-CP1	O	1	0.293996576986	0.144938011577\n\
-CP1	OB	1	0.293996576986	0.144938011577\n\
-CP1	C	1	0.347450500074	0.138767581228\n\
-CP1	CA	1	0.346773417049	0.110698234855\n\
-CP1	CC	1	0.347450500074	0.110698234855\n\
-CP1	CD	1	0.347450500074	0.110698234855\n\
-CP1	CE1	1	0.355468588538	0.109105371453\n\
-CP1	CE2	1	0.354577689819	0.105847757841\n\
-CP1	CPH1	1	0.329632525712	0.0935570841786\n\
-CP1	CPH2	1	0.329632525712	0.0935570841786\n\
-CP1	CS	1	0.365268474437	0.138767581228\n\
-CP1	CPT	1	0.334977918021	0.131646486622\n\
-CP1	CY	1	0.346559601356	0.113045454929\n\
-CP1	CAI	1	0.346559601356	0.113045454929\n\
-CP1	H	1	0.189271432669	0.0897368027066\n\
-CP1	HA	1	0.286869387241	0.06205874894\n\
-CP1	HB1	1	0.286869387241	0.06205874894\n\
-CP1	HB2	1	0.288651184678	0.0700117110204\n\
-CP1	HE1	1	0.280633096214	0.0736669217492\n\
-CP1	HE2	1	0.281523994932	0.0674649728378\n\
-CP1	HC	1	0.189271432669	0.0897368027066\n\
-CP1	HR1	1	0.249451641079	0.0897368027066\n\
-CP1	HR2	1	0.231633666716	0.0897368027066\n\
-CP1	HR3	1	0.300054688269	0.0369520874647\n\
-CP1	HS	1	0.209361198763	0.132309697301\n\
-CP1	HA1	1	0.288651184678	0.0887560431745\n\
-CP1	HA2	1	0.288651184678	0.0771491480186\n\
-CP1	HA3	1	0.288651184678	0.0648182492821\n\
-CP1	NC2	1	0.334087019303	0.187114168357\n\
-CP1	NH2	1	0.334087019303	0.187114168357\n\
-CP1	NH3	1	0.334087019303	0.187114168357\n\
-CP1	NP	1	0.334087019303	0.187114168357\n\
-CP1	NR1	1	0.334087019303	0.187114168357\n\
-CP1	NR2	1	0.334087019303	0.187114168357\n\
-CP1	NR3	1	0.334087019303	0.187114168357\n\
-CP1	NY	1	0.334087019303	0.187114168357\n\
-CP1	OC	1	0.320723538531	0.144938011577\n\
-CP1	OH1	1	0.326959829558	0.163176\n\
-CP1	OS	1	0.326959829558	0.163176\n\
-CP1	S	1	0.347450500074	0.280671252536\n\
-CP1	SM	1	0.345223253279	0.257919081884\n\
-CP1	SS	1	0.365268474437	0.286840588481\n\
-CP2	CP2	1	0.338541512893	0.04184\n\
-CP2	CP3	1	0.338541512893	0.04184\n\
-CP2	CT	1	0.338541512893	0.04184\n\
-CP2	CT1	1	0.338541512893	0.04184\n\
-CP2	CT2	1	0.338541512893	0.04184\n\
-CP2	CT2A	1	0.338541512893	0.04184\n\
-CP2	CT3	1	0.338541512893	0.04184\n\
-CP2	HP	1	0.290272620344	0.0724690057887\n\
-CP2	N	1	0.334087019303	0.004184\n\
-CP2	NH1	1	0.307360057759	0.187114168357\n\
-CP2	O	1	0.293996576986	0.144938011577\n\
-CP2	OB	1	0.293996576986	0.144938011577\n\
-CP2	C	1	0.347450500074	0.138767581228\n\
-CP2	CA	1	0.346773417049	0.110698234855\n\
-CP2	CC	1	0.347450500074	0.110698234855\n\
-CP2	CD	1	0.347450500074	0.110698234855\n\
-CP2	CE1	1	0.355468588538	0.109105371453\n\
-CP2	CE2	1	0.354577689819	0.105847757841\n\
-CP2	CPH1	1	0.329632525712	0.0935570841786\n\
-CP2	CPH2	1	0.329632525712	0.0935570841786\n\
-CP2	CS	1	0.365268474437	0.138767581228\n\
-CP2	CPT	1	0.334977918021	0.131646486622\n\
-CP2	CY	1	0.346559601356	0.113045454929\n\
-CP2	CAI	1	0.346559601356	0.113045454929\n\
-CP2	H	1	0.189271432669	0.0897368027066\n\
-CP2	HA	1	0.286869387241	0.06205874894\n\
-CP2	HB1	1	0.286869387241	0.06205874894\n\
-CP2	HB2	1	0.288651184678	0.0700117110204\n\
-CP2	HE1	1	0.280633096214	0.0736669217492\n\
-CP2	HE2	1	0.281523994932	0.0674649728378\n\
-CP2	HC	1	0.189271432669	0.0897368027066\n\
-CP2	HR1	1	0.249451641079	0.0897368027066\n\
-CP2	HR2	1	0.231633666716	0.0897368027066\n\
-CP2	HR3	1	0.300054688269	0.0369520874647\n\
-CP2	HS	1	0.209361198763	0.132309697301\n\
-CP2	HA1	1	0.288651184678	0.0887560431745\n\
-CP2	HA2	1	0.288651184678	0.0771491480186\n\
-CP2	HA3	1	0.288651184678	0.0648182492821\n\
-CP2	NC2	1	0.334087019303	0.187114168357\n\
-CP2	NH2	1	0.334087019303	0.187114168357\n\
-CP2	NH3	1	0.334087019303	0.187114168357\n\
-CP2	NP	1	0.334087019303	0.187114168357\n\
-CP2	NR1	1	0.334087019303	0.187114168357\n\
-CP2	NR2	1	0.334087019303	0.187114168357\n\
-CP2	NR3	1	0.334087019303	0.187114168357\n\
-CP2	NY	1	0.334087019303	0.187114168357\n\
-CP2	OC	1	0.320723538531	0.144938011577\n\
-CP2	OH1	1	0.326959829558	0.163176\n\
-CP2	OS	1	0.326959829558	0.163176\n\
-CP2	S	1	0.347450500074	0.280671252536\n\
-CP2	SM	1	0.345223253279	0.257919081884\n\
-CP2	SS	1	0.365268474437	0.286840588481\n\
-CP3	CP3	1	0.338541512893	0.04184\n\
-CP3	CT	1	0.338541512893	0.04184\n\
-CP3	CT1	1	0.338541512893	0.04184\n\
-CP3	CT2	1	0.338541512893	0.04184\n\
-CP3	CT2A	1	0.338541512893	0.04184\n\
-CP3	CT3	1	0.338541512893	0.04184\n\
-CP3	HP	1	0.290272620344	0.0724690057887\n\
-CP3	N	1	0.334087019303	0.004184\n\
-CP3	NH1	1	0.307360057759	0.187114168357\n\
-CP3	O	1	0.293996576986	0.144938011577\n\
-CP3	OB	1	0.293996576986	0.144938011577\n\
-CP3	C	1	0.347450500074	0.138767581228\n\
-CP3	CA	1	0.346773417049	0.110698234855\n\
-CP3	CC	1	0.347450500074	0.110698234855\n\
-CP3	CD	1	0.347450500074	0.110698234855\n\
-CP3	CE1	1	0.355468588538	0.109105371453\n\
-CP3	CE2	1	0.354577689819	0.105847757841\n\
-CP3	CPH1	1	0.329632525712	0.0935570841786\n\
-CP3	CPH2	1	0.329632525712	0.0935570841786\n\
-CP3	CS	1	0.365268474437	0.138767581228\n\
-CP3	CPT	1	0.334977918021	0.131646486622\n\
-CP3	CY	1	0.346559601356	0.113045454929\n\
-CP3	CAI	1	0.346559601356	0.113045454929\n\
-CP3	H	1	0.189271432669	0.0897368027066\n\
-CP3	HA	1	0.286869387241	0.06205874894\n\
-CP3	HB1	1	0.286869387241	0.06205874894\n\
-CP3	HB2	1	0.288651184678	0.0700117110204\n\
-CP3	HE1	1	0.280633096214	0.0736669217492\n\
-CP3	HE2	1	0.281523994932	0.0674649728378\n\
-CP3	HC	1	0.189271432669	0.0897368027066\n\
-CP3	HR1	1	0.249451641079	0.0897368027066\n\
-CP3	HR2	1	0.231633666716	0.0897368027066\n\
-CP3	HR3	1	0.300054688269	0.0369520874647\n\
-CP3	HS	1	0.209361198763	0.132309697301\n\
-CP3	HA1	1	0.288651184678	0.0887560431745\n\
-CP3	HA2	1	0.288651184678	0.0771491480186\n\
-CP3	HA3	1	0.288651184678	0.0648182492821\n\
-CP3	NC2	1	0.334087019303	0.187114168357\n\
-CP3	NH2	1	0.334087019303	0.187114168357\n\
-CP3	NH3	1	0.334087019303	0.187114168357\n\
-CP3	NP	1	0.334087019303	0.187114168357\n\
-CP3	NR1	1	0.334087019303	0.187114168357\n\
-CP3	NR2	1	0.334087019303	0.187114168357\n\
-CP3	NR3	1	0.334087019303	0.187114168357\n\
-CP3	NY	1	0.334087019303	0.187114168357\n\
-CP3	OC	1	0.320723538531	0.144938011577\n\
-CP3	OH1	1	0.326959829558	0.163176\n\
-CP3	OS	1	0.326959829558	0.163176\n\
-CP3	S	1	0.347450500074	0.280671252536\n\
-CP3	SM	1	0.345223253279	0.257919081884\n\
-CP3	SS	1	0.365268474437	0.286840588481\n\
-CT	CT	1	0.338541512893	0.04184\n\
-CT	CT1	1	0.338541512893	0.04184\n\
-CT	CT2	1	0.338541512893	0.04184\n\
-CT	CT2A	1	0.338541512893	0.04184\n\
-CT	CT3	1	0.338541512893	0.04184\n\
-CT	HP	1	0.290272620344	0.0724690057887\n\
-CT	N	1	0.334087019303	0.004184\n\
-CT	NH1	1	0.307360057759	0.187114168357\n\
-CT	O	1	0.293996576986	0.144938011577\n\
-CT	OB	1	0.293996576986	0.144938011577\n\
-CT	C	1	0.347450500074	0.138767581228\n\
-CT	CA	1	0.346773417049	0.110698234855\n\
-CT	CC	1	0.347450500074	0.110698234855\n\
-CT	CD	1	0.347450500074	0.110698234855\n\
-CT	CE1	1	0.355468588538	0.109105371453\n\
-CT	CE2	1	0.354577689819	0.105847757841\n\
-CT	CPH1	1	0.329632525712	0.0935570841786\n\
-CT	CPH2	1	0.329632525712	0.0935570841786\n\
-CT	CS	1	0.365268474437	0.138767581228\n\
-CT	CPT	1	0.334977918021	0.131646486622\n\
-CT	CY	1	0.346559601356	0.113045454929\n\
-CT	CAI	1	0.346559601356	0.113045454929\n\
-CT	H	1	0.189271432669	0.0897368027066\n\
-CT	HA	1	0.286869387241	0.06205874894\n\
-CT	HB1	1	0.286869387241	0.06205874894\n\
-CT	HB2	1	0.288651184678	0.0700117110204\n\
-CT	HE1	1	0.280633096214	0.0736669217492\n\
-CT	HE2	1	0.281523994932	0.0674649728378\n\
-CT	HC	1	0.189271432669	0.0897368027066\n\
-CT	HR1	1	0.249451641079	0.0897368027066\n\
-CT	HR2	1	0.231633666716	0.0897368027066\n\
-CT	HR3	1	0.300054688269	0.0369520874647\n\
-CT	HS	1	0.209361198763	0.132309697301\n\
-CT	HA1	1	0.288651184678	0.0887560431745\n\
-CT	HA2	1	0.288651184678	0.0771491480186\n\
-CT	HA3	1	0.288651184678	0.0648182492821\n\
-CT	NC2	1	0.334087019303	0.187114168357\n\
-CT	NH2	1	0.334087019303	0.187114168357\n\
-CT	NH3	1	0.334087019303	0.187114168357\n\
-CT	NP	1	0.334087019303	0.187114168357\n\
-CT	NR1	1	0.334087019303	0.187114168357\n\
-CT	NR2	1	0.334087019303	0.187114168357\n\
-CT	NR3	1	0.334087019303	0.187114168357\n\
-CT	NY	1	0.334087019303	0.187114168357\n\
-CT	OC	1	0.320723538531	0.144938011577\n\
-CT	OH1	1	0.326959829558	0.163176\n\
-CT	OS	1	0.326959829558	0.163176\n\
-CT	S	1	0.347450500074	0.280671252536\n\
-CT	SM	1	0.345223253279	0.257919081884\n\
-CT	SS	1	0.365268474437	0.286840588481\n\
-CT1	CT1	1	0.338541512893	0.04184\n\
-CT1	CT2	1	0.338541512893	0.04184\n\
-CT1	CT2A	1	0.338541512893	0.04184\n\
-CT1	CT3	1	0.338541512893	0.04184\n\
-CT1	HP	1	0.290272620344	0.0724690057887\n\
-CT1	N	1	0.334087019303	0.004184\n\
-CT1	NH1	1	0.307360057759	0.187114168357\n\
-CT1	O	1	0.293996576986	0.144938011577\n\
-CT1	OB	1	0.293996576986	0.144938011577\n\
-CT1	C	1	0.347450500074	0.138767581228\n\
-CT1	CA	1	0.346773417049	0.110698234855\n\
-CT1	CC	1	0.347450500074	0.110698234855\n\
-CT1	CD	1	0.347450500074	0.110698234855\n\
-CT1	CE1	1	0.355468588538	0.109105371453\n\
-CT1	CE2	1	0.354577689819	0.105847757841\n\
-CT1	CPH1	1	0.329632525712	0.0935570841786\n\
-CT1	CPH2	1	0.329632525712	0.0935570841786\n\
-CT1	CS	1	0.365268474437	0.138767581228\n\
-CT1	CPT	1	0.334977918021	0.131646486622\n\
-CT1	CY	1	0.346559601356	0.113045454929\n\
-CT1	CAI	1	0.346559601356	0.113045454929\n\
-CT1	H	1	0.189271432669	0.0897368027066\n\
-CT1	HA	1	0.286869387241	0.06205874894\n\
-CT1	HB1	1	0.286869387241	0.06205874894\n\
-CT1	HB2	1	0.288651184678	0.0700117110204\n\
-CT1	HE1	1	0.280633096214	0.0736669217492\n\
-CT1	HE2	1	0.281523994932	0.0674649728378\n\
-CT1	HC	1	0.189271432669	0.0897368027066\n\
-CT1	HR1	1	0.249451641079	0.0897368027066\n\
-CT1	HR2	1	0.231633666716	0.0897368027066\n\
-CT1	HR3	1	0.300054688269	0.0369520874647\n\
-CT1	HS	1	0.209361198763	0.132309697301\n\
-CT1	HA1	1	0.288651184678	0.0887560431745\n\
-CT1	HA2	1	0.288651184678	0.0771491480186\n\
-CT1	HA3	1	0.288651184678	0.0648182492821\n\
-CT1	NC2	1	0.334087019303	0.187114168357\n\
-CT1	NH2	1	0.334087019303	0.187114168357\n\
-CT1	NH3	1	0.334087019303	0.187114168357\n\
-CT1	NP	1	0.334087019303	0.187114168357\n\
-CT1	NR1	1	0.334087019303	0.187114168357\n\
-CT1	NR2	1	0.334087019303	0.187114168357\n\
-CT1	NR3	1	0.334087019303	0.187114168357\n\
-CT1	NY	1	0.334087019303	0.187114168357\n\
-CT1	OC	1	0.320723538531	0.144938011577\n\
-CT1	OH1	1	0.326959829558	0.163176\n\
-CT1	OS	1	0.326959829558	0.163176\n\
-CT1	S	1	0.347450500074	0.280671252536\n\
-CT1	SM	1	0.345223253279	0.257919081884\n\
-CT1	SS	1	0.365268474437	0.286840588481\n\
-CT2	CT2	1	0.338541512893	0.04184\n\
-CT2	CT2A	1	0.338541512893	0.04184\n\
-CT2	CT3	1	0.338541512893	0.04184\n\
-CT2	HP	1	0.290272620344	0.0724690057887\n\
-CT2	N	1	0.334087019303	0.004184\n\
-CT2	NH1	1	0.307360057759	0.187114168357\n\
-CT2	O	1	0.293996576986	0.144938011577\n\
-CT2	OB	1	0.293996576986	0.144938011577\n\
-CT2	C	1	0.347450500074	0.138767581228\n\
-CT2	CA	1	0.346773417049	0.110698234855\n\
-CT2	CC	1	0.347450500074	0.110698234855\n\
-CT2	CD	1	0.347450500074	0.110698234855\n\
-CT2	CE1	1	0.355468588538	0.109105371453\n\
-CT2	CE2	1	0.354577689819	0.105847757841\n\
-CT2	CPH1	1	0.329632525712	0.0935570841786\n\
-CT2	CPH2	1	0.329632525712	0.0935570841786\n\
-CT2	CS	1	0.365268474437	0.138767581228\n\
-CT2	CPT	1	0.334977918021	0.131646486622\n\
-CT2	CY	1	0.346559601356	0.113045454929\n\
-CT2	CAI	1	0.346559601356	0.113045454929\n\
-CT2	H	1	0.189271432669	0.0897368027066\n\
-CT2	HA	1	0.286869387241	0.06205874894\n\
-CT2	HB1	1	0.286869387241	0.06205874894\n\
-CT2	HB2	1	0.288651184678	0.0700117110204\n\
-CT2	HE1	1	0.280633096214	0.0736669217492\n\
-CT2	HE2	1	0.281523994932	0.0674649728378\n\
-CT2	HC	1	0.189271432669	0.0897368027066\n\
-CT2	HR1	1	0.249451641079	0.0897368027066\n\
-CT2	HR2	1	0.231633666716	0.0897368027066\n\
-CT2	HR3	1	0.300054688269	0.0369520874647\n\
-CT2	HS	1	0.209361198763	0.132309697301\n\
-CT2	HA1	1	0.288651184678	0.0887560431745\n\
-CT2	HA2	1	0.288651184678	0.0771491480186\n\
-CT2	HA3	1	0.288651184678	0.0648182492821\n\
-CT2	NC2	1	0.334087019303	0.187114168357\n\
-CT2	NH2	1	0.334087019303	0.187114168357\n\
-CT2	NH3	1	0.334087019303	0.187114168357\n\
-CT2	NP	1	0.334087019303	0.187114168357\n\
-CT2	NR1	1	0.334087019303	0.187114168357\n\
-CT2	NR2	1	0.334087019303	0.187114168357\n\
-CT2	NR3	1	0.334087019303	0.187114168357\n\
-CT2	NY	1	0.334087019303	0.187114168357\n\
-CT2	OC	1	0.320723538531	0.144938011577\n\
-CT2	OH1	1	0.326959829558	0.163176\n\
-CT2	OS	1	0.326959829558	0.163176\n\
-CT2	S	1	0.347450500074	0.280671252536\n\
-CT2	SM	1	0.345223253279	0.257919081884\n\
-CT2	SS	1	0.365268474437	0.286840588481\n\
-CT2A	CT2A	1	0.338541512893	0.04184\n\
-CT2A	CT3	1	0.338541512893	0.04184\n\
-CT2A	HP	1	0.290272620344	0.0724690057887\n\
-CT2A	N	1	0.334087019303	0.004184\n\
-CT2A	NH1	1	0.307360057759	0.187114168357\n\
-CT2A	O	1	0.293996576986	0.144938011577\n\
-CT2A	OB	1	0.293996576986	0.144938011577\n\
-CT2A	C	1	0.347450500074	0.138767581228\n\
-CT2A	CA	1	0.346773417049	0.110698234855\n\
-CT2A	CC	1	0.347450500074	0.110698234855\n\
-CT2A	CD	1	0.347450500074	0.110698234855\n\
-CT2A	CE1	1	0.355468588538	0.109105371453\n\
-CT2A	CE2	1	0.354577689819	0.105847757841\n\
-CT2A	CPH1	1	0.329632525712	0.0935570841786\n\
-CT2A	CPH2	1	0.329632525712	0.0935570841786\n\
-CT2A	CS	1	0.365268474437	0.138767581228\n\
-CT2A	CPT	1	0.334977918021	0.131646486622\n\
-CT2A	CY	1	0.346559601356	0.113045454929\n\
-CT2A	CAI	1	0.346559601356	0.113045454929\n\
-CT2A	H	1	0.189271432669	0.0897368027066\n\
-CT2A	HA	1	0.286869387241	0.06205874894\n\
-CT2A	HB1	1	0.286869387241	0.06205874894\n\
-CT2A	HB2	1	0.288651184678	0.0700117110204\n\
-CT2A	HE1	1	0.280633096214	0.0736669217492\n\
-CT2A	HE2	1	0.281523994932	0.0674649728378\n\
-CT2A	HC	1	0.189271432669	0.0897368027066\n\
-CT2A	HR1	1	0.249451641079	0.0897368027066\n\
-CT2A	HR2	1	0.231633666716	0.0897368027066\n\
-CT2A	HR3	1	0.300054688269	0.0369520874647\n\
-CT2A	HS	1	0.209361198763	0.132309697301\n\
-CT2A	HA1	1	0.288651184678	0.0887560431745\n\
-CT2A	HA2	1	0.288651184678	0.0771491480186\n\
-CT2A	HA3	1	0.288651184678	0.0648182492821\n\
-CT2A	NC2	1	0.334087019303	0.187114168357\n\
-CT2A	NH2	1	0.334087019303	0.187114168357\n\
-CT2A	NH3	1	0.334087019303	0.187114168357\n\
-CT2A	NP	1	0.334087019303	0.187114168357\n\
-CT2A	NR1	1	0.334087019303	0.187114168357\n\
-CT2A	NR2	1	0.334087019303	0.187114168357\n\
-CT2A	NR3	1	0.334087019303	0.187114168357\n\
-CT2A	NY	1	0.334087019303	0.187114168357\n\
-CT2A	OC	1	0.320723538531	0.144938011577\n\
-CT2A	OH1	1	0.326959829558	0.163176\n\
-CT2A	OS	1	0.326959829558	0.163176\n\
-CT2A	S	1	0.347450500074	0.280671252536\n\
-CT2A	SM	1	0.345223253279	0.257919081884\n\
-CT2A	SS	1	0.365268474437	0.286840588481\n\
-CT3	CT3	1	0.338541512893	0.04184\n\
-CT3	HP	1	0.290272620344	0.0724690057887\n\
-CT3	N	1	0.334087019303	0.004184\n\
-CT3	NH1	1	0.307360057759	0.187114168357\n\
-CT3	O	1	0.293996576986	0.144938011577\n\
-CT3	OB	1	0.293996576986	0.144938011577\n\
-CT3	C	1	0.347450500074	0.138767581228\n\
-CT3	CA	1	0.346773417049	0.110698234855\n\
-CT3	CC	1	0.347450500074	0.110698234855\n\
-CT3	CD	1	0.347450500074	0.110698234855\n\
-CT3	CE1	1	0.355468588538	0.109105371453\n\
-CT3	CE2	1	0.354577689819	0.105847757841\n\
-CT3	CPH1	1	0.329632525712	0.0935570841786\n\
-CT3	CPH2	1	0.329632525712	0.0935570841786\n\
-CT3	CS	1	0.365268474437	0.138767581228\n\
-CT3	CPT	1	0.334977918021	0.131646486622\n\
-CT3	CY	1	0.346559601356	0.113045454929\n\
-CT3	CAI	1	0.346559601356	0.113045454929\n\
-CT3	H	1	0.189271432669	0.0897368027066\n\
-CT3	HA	1	0.286869387241	0.06205874894\n\
-CT3	HB1	1	0.286869387241	0.06205874894\n\
-CT3	HB2	1	0.288651184678	0.0700117110204\n\
-CT3	HE1	1	0.280633096214	0.0736669217492\n\
-CT3	HE2	1	0.281523994932	0.0674649728378\n\
-CT3	HC	1	0.189271432669	0.0897368027066\n\
-CT3	HR1	1	0.249451641079	0.0897368027066\n\
-CT3	HR2	1	0.231633666716	0.0897368027066\n\
-CT3	HR3	1	0.300054688269	0.0369520874647\n\
-CT3	HS	1	0.209361198763	0.132309697301\n\
-CT3	HA1	1	0.288651184678	0.0887560431745\n\
-CT3	HA2	1	0.288651184678	0.0771491480186\n\
-CT3	HA3	1	0.288651184678	0.0648182492821\n\
-CT3	NC2	1	0.334087019303	0.187114168357\n\
-CT3	NH2	1	0.334087019303	0.187114168357\n\
-CT3	NH3	1	0.334087019303	0.187114168357\n\
-CT3	NP	1	0.334087019303	0.187114168357\n\
-CT3	NR1	1	0.334087019303	0.187114168357\n\
-CT3	NR2	1	0.334087019303	0.187114168357\n\
-CT3	NR3	1	0.334087019303	0.187114168357\n\
-CT3	NY	1	0.334087019303	0.187114168357\n\
-CT3	OC	1	0.320723538531	0.144938011577\n\
-CT3	OH1	1	0.326959829558	0.163176\n\
-CT3	OS	1	0.326959829558	0.163176\n\
-CT3	S	1	0.347450500074	0.280671252536\n\
-CT3	SM	1	0.345223253279	0.257919081884\n\
-CT3	SS	1	0.365268474437	0.286840588481\n\
-HP	HP	1	0.242003727796	0.12552\n\
-HP	N	1	0.285818126754	0.00724690057887\n\
-HP	NH1	1	0.25909116521	0.324091246411\n\
-HP	O	1	0.245727684437	0.25104\n\
-HP	OB	1	0.245727684437	0.25104\n\
-HP	C	1	0.299181607526	0.240352501131\n\
-HP	CA	1	0.298504524501	0.191734967077\n\
-HP	CC	1	0.299181607526	0.191734967077\n\
-HP	CD	1	0.299181607526	0.191734967077\n\
-HP	CE1	1	0.30719969599	0.188976046736\n\
-HP	CE2	1	0.306308797271	0.183333694448\n\
-HP	CPH1	1	0.281363633163	0.162045623205\n\
-HP	CPH2	1	0.281363633163	0.162045623205\n\
-HP	CS	1	0.316999581889	0.240352501131\n\
-HP	CPT	1	0.286709025472	0.228018403468\n\
-HP	CY	1	0.298290708808	0.195800471501\n\
-HP	CAI	1	0.298290708808	0.195800471501\n\
-HP	H	1	0.14100254012	0.155428701597\n\
-HP	HA	1	0.238600494692	0.107488906218\n\
-HP	HB1	1	0.238600494692	0.107488906218\n\
-HP	HB2	1	0.240382292129	0.121263840612\n\
-HP	HE1	1	0.232364203665	0.127594851307\n\
-HP	HE2	1	0.233255102384	0.116852760686\n\
-HP	HC	1	0.14100254012	0.155428701597\n\
-HP	HR1	1	0.20118274853	0.155428701597\n\
-HP	HR2	1	0.183364774168	0.155428701597\n\
-HP	HR3	1	0.251785795721	0.0640028929346\n\
-HP	HS	1	0.161092306214	0.22916711806\n\
-HP	HA1	1	0.240382292129	0.153729976257\n\
-HP	HA2	1	0.240382292129	0.133626244129\n\
-HP	HA3	1	0.240382292129	0.112268501014\n\
-HP	NC2	1	0.285818126754	0.324091246411\n\
-HP	NH2	1	0.285818126754	0.324091246411\n\
-HP	NH3	1	0.285818126754	0.324091246411\n\
-HP	NP	1	0.285818126754	0.324091246411\n\
-HP	NR1	1	0.285818126754	0.324091246411\n\
-HP	NR2	1	0.285818126754	0.324091246411\n\
-HP	NR3	1	0.285818126754	0.324091246411\n\
-HP	NY	1	0.285818126754	0.324091246411\n\
-HP	OC	1	0.272454645982	0.25104\n\
-HP	OH1	1	0.278690937009	0.282629122576\n\
-HP	OS	1	0.278690937009	0.282629122576\n\
-HP	S	1	0.299181607526	0.486136869616\n\
-HP	SM	1	0.29695436073	0.446728954065\n\
-HP	SS	1	0.316999581889	0.496822472922\n\
-N	N	1	0.329632525712	0.0004184\n\
-N	NH1	1	0.302905564168	0.0187114168357\n\
-N	O	1	0.289542083396	0.0144938011577\n\
-N	OB	1	0.289542083396	0.0144938011577\n\
-N	C	1	0.342996006484	0.0138767581228\n\
-N	CA	1	0.342318923459	0.0110698234855\n\
-N	CC	1	0.342996006484	0.0110698234855\n\
-N	CD	1	0.342996006484	0.0110698234855\n\
-N	CE1	1	0.351014094948	0.0109105371453\n\
-N	CE2	1	0.350123196229	0.0105847757841\n\
-N	CPH1	1	0.325178032121	0.00935570841786\n\
-N	CPH2	1	0.325178032121	0.00935570841786\n\
-N	CS	1	0.360813980847	0.0138767581228\n\
-N	CPT	1	0.33052342443	0.0131646486622\n\
-N	CY	1	0.342105107766	0.0113045454929\n\
-N	CAI	1	0.342105107766	0.0113045454929\n\
-N	H	1	0.184816939078	0.00897368027066\n\
-N	HA	1	0.28241489365	0.006205874894\n\
-N	HB1	1	0.28241489365	0.006205874894\n\
-N	HB2	1	0.284196691087	0.00700117110204\n\
-N	HE1	1	0.276178602624	0.00736669217492\n\
-N	HE2	1	0.277069501341	0.00674649728378\n\
-N	HC	1	0.184816939078	0.00897368027066\n\
-N	HR1	1	0.244997147489	0.00897368027066\n\
-N	HR2	1	0.227179173126	0.00897368027066\n\
-N	HR3	1	0.295600194679	0.00369520874647\n\
-N	HS	1	0.204906705172	0.0132309697301\n\
-N	HA1	1	0.284196691087	0.00887560431745\n\
-N	HA2	1	0.284196691087	0.00771491480186\n\
-N	HA3	1	0.284196691087	0.00648182492821\n\
-N	NC2	1	0.329632525712	0.0187114168357\n\
-N	NH2	1	0.329632525712	0.0187114168357\n\
-N	NH3	1	0.329632525712	0.0187114168357\n\
-N	NP	1	0.329632525712	0.0187114168357\n\
-N	NR1	1	0.329632525712	0.0187114168357\n\
-N	NR2	1	0.329632525712	0.0187114168357\n\
-N	NR3	1	0.329632525712	0.0187114168357\n\
-N	NY	1	0.329632525712	0.0187114168357\n\
-N	OC	1	0.31626904494	0.0144938011577\n\
-N	OH1	1	0.322505335967	0.0163176\n\
-N	OS	1	0.322505335967	0.0163176\n\
-N	S	1	0.342996006484	0.0280671252536\n\
-N	SM	1	0.340768759689	0.0257919081884\n\
-N	SS	1	0.360813980847	0.0286840588481\n\
-NH1	NH1	1	0.276178602624	0.8368\n\
-NH1	O	1	0.262815121852	0.648182492821\n\
-NH1	OB	1	0.262815121852	0.648182492821\n\
-NH1	C	1	0.31626904494	0.6205874894\n\
-NH1	CA	1	0.315591961915	0.49505755625\n\
-NH1	CC	1	0.31626904494	0.49505755625\n\
-NH1	CD	1	0.31626904494	0.49505755625\n\
-NH1	CE1	1	0.324287133404	0.487934054561\n\
-NH1	CE2	1	0.323396234685	0.473365563598\n\
-NH1	CPH1	1	0.298451070577	0.4184\n\
-NH1	CPH2	1	0.298451070577	0.4184\n\
-NH1	CS	1	0.334087019303	0.6205874894\n\
-NH1	CPT	1	0.303796462886	0.588740986173\n\
-NH1	CY	1	0.315378146222	0.505554643535\n\
-NH1	CAI	1	0.315378146222	0.505554643535\n\
-NH1	H	1	0.158089977534	0.401315181871\n\
-NH1	HA	1	0.255687932106	0.277535162457\n\
-NH1	HB1	1	0.255687932106	0.277535162457\n\
-NH1	HB2	1	0.257469729543	0.313101890125\n\
-NH1	HE1	1	0.24945164108	0.329448489449\n\
-NH1	HE2	1	0.250342539797	0.301712530731\n\
-NH1	HC	1	0.158089977534	0.401315181871\n\
-NH1	HR1	1	0.218270185945	0.401315181871\n\
-NH1	HR2	1	0.200452211582	0.401315181871\n\
-NH1	HR3	1	0.268873233135	0.165254758963\n\
-NH1	HS	1	0.178179743628	0.591706954497\n\
-NH1	HA1	1	0.257469729543	0.396929091904\n\
-NH1	HA2	1	0.257469729543	0.345021478752\n\
-NH1	HA3	1	0.257469729543	0.289876023155\n\
-NH1	NC2	1	0.302905564168	0.8368\n\
-NH1	NH2	1	0.302905564168	0.8368\n\
-NH1	NH3	1	0.302905564168	0.8368\n\
-NH1	NP	1	0.302905564168	0.8368\n\
-NH1	NR1	1	0.302905564168	0.8368\n\
-NH1	NR2	1	0.302905564168	0.8368\n\
-NH1	NR3	1	0.302905564168	0.8368\n\
-NH1	NY	1	0.302905564168	0.8368\n\
-NH1	OC	1	0.289542083396	0.648182492821\n\
-NH1	OH1	1	0.295778374423	0.729745256593\n\
-NH1	OS	1	0.295778374423	0.729745256593\n\
-NH1	S	1	0.31626904494	1.2552\n\
-NH1	SM	1	0.314041798145	1.15344919957\n\
-NH1	SS	1	0.334087019303	1.2827901091\n\
-O	O	1	0.249451641079	0.50208\n\
-O	OB	1	0.249451641079	0.50208\n\
-O	C	1	0.302905564167	0.480705002262\n\
-O	CA	1	0.302228481142	0.383469934154\n\
-O	CC	1	0.302905564167	0.383469934154\n\
-O	CD	1	0.302905564167	0.383469934154\n\
-O	CE1	1	0.310923652631	0.377952093472\n\
-O	CE2	1	0.310032753913	0.366667388896\n\
-O	CPH1	1	0.285087589805	0.324091246411\n\
-O	CPH2	1	0.285087589805	0.324091246411\n\
-O	CS	1	0.320723538531	0.480705002262\n\
-O	CPT	1	0.290432982113	0.456036806936\n\
-O	CY	1	0.30201466545	0.391600943002\n\
-O	CAI	1	0.30201466545	0.391600943002\n\
-O	H	1	0.144726496762	0.310857403193\n\
-O	HA	1	0.242324451334	0.214977812437\n\
-O	HB1	1	0.242324451334	0.214977812437\n\
-O	HB2	1	0.24410624877	0.242527681224\n\
-O	HE1	1	0.236088160307	0.255189702614\n\
-O	HE2	1	0.236979059025	0.233705521373\n\
-O	HC	1	0.144726496762	0.310857403193\n\
-O	HR1	1	0.204906705172	0.310857403193\n\
-O	HR2	1	0.18708873081	0.310857403193\n\
-O	HR3	1	0.255509752363	0.128005785869\n\
-O	HS	1	0.164816262856	0.45833423612\n\
-O	HA1	1	0.24410624877	0.307459952514\n\
-O	HA2	1	0.24410624877	0.267252488258\n\
-O	HA3	1	0.24410624877	0.224537002029\n\
-O	NC2	1	0.289542083396	0.648182492821\n\
-O	NH2	1	0.289542083396	0.648182492821\n\
-O	NH3	1	0.289542083396	0.648182492821\n\
-O	NP	1	0.289542083396	0.648182492821\n\
-O	NR1	1	0.289542083396	0.648182492821\n\
-O	NR2	1	0.289542083396	0.648182492821\n\
-O	NR3	1	0.289542083396	0.648182492821\n\
-O	NY	1	0.289542083396	0.648182492821\n\
-O	OC	1	0.276178602624	0.50208\n\
-O	OH1	1	0.28241489365	0.565258245152\n\
-O	OS	1	0.28241489365	0.565258245152\n\
-O	S	1	0.302905564167	0.972273739232\n\
-O	SM	1	0.300678317372	0.89345790813\n\
-O	SS	1	0.320723538531	0.993644945843\n\
-OB	OB	1	0.249451641079	0.50208\n\
-OB	C	1	0.302905564167	0.480705002262\n\
-OB	CA	1	0.302228481142	0.383469934154\n\
-OB	CC	1	0.302905564167	0.383469934154\n\
-OB	CD	1	0.302905564167	0.383469934154\n\
-OB	CE1	1	0.310923652631	0.377952093472\n\
-OB	CE2	1	0.310032753913	0.366667388896\n\
-OB	CPH1	1	0.285087589805	0.324091246411\n\
-OB	CPH2	1	0.285087589805	0.324091246411\n\
-OB	CS	1	0.320723538531	0.480705002262\n\
-OB	CPT	1	0.290432982113	0.456036806936\n\
-OB	CY	1	0.30201466545	0.391600943002\n\
-OB	CAI	1	0.30201466545	0.391600943002\n\
-OB	H	1	0.144726496762	0.310857403193\n\
-OB	HA	1	0.242324451334	0.214977812437\n\
-OB	HB1	1	0.242324451334	0.214977812437\n\
-OB	HB2	1	0.24410624877	0.242527681224\n\
-OB	HE1	1	0.236088160307	0.255189702614\n\
-OB	HE2	1	0.236979059025	0.233705521373\n\
-OB	HC	1	0.144726496762	0.310857403193\n\
-OB	HR1	1	0.204906705172	0.310857403193\n\
-OB	HR2	1	0.18708873081	0.310857403193\n\
-OB	HR3	1	0.255509752363	0.128005785869\n\
-OB	HS	1	0.164816262856	0.45833423612\n\
-OB	HA1	1	0.24410624877	0.307459952514\n\
-OB	HA2	1	0.24410624877	0.267252488258\n\
-OB	HA3	1	0.24410624877	0.224537002029\n\
-OB	NC2	1	0.289542083396	0.648182492821\n\
-OB	NH2	1	0.289542083396	0.648182492821\n\
-OB	NH3	1	0.289542083396	0.648182492821\n\
-OB	NP	1	0.289542083396	0.648182492821\n\
-OB	NR1	1	0.289542083396	0.648182492821\n\
-OB	NR2	1	0.289542083396	0.648182492821\n\
-OB	NR3	1	0.289542083396	0.648182492821\n\
-OB	NY	1	0.289542083396	0.648182492821\n\
-OB	OC	1	0.276178602624	0.50208\n\
-OB	OH1	1	0.28241489365	0.565258245152\n\
-OB	OS	1	0.28241489365	0.565258245152\n\
-OB	S	1	0.302905564167	0.972273739232\n\
-OB	SM	1	0.300678317372	0.89345790813\n\
-OB	SS	1	0.320723538531	0.993644945843\n";
-}
-
-#endif
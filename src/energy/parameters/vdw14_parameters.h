@@ -0,0 +1,659 @@
+// vdw14_parameters.h --- Typed table of the parameters in vdw14.itp
+// Generated by generate_parameter_tables.cmake from vdw14.itp. Do not edit.
+// Copyright (C) 2026 agent
+// Copyright (c) 1991-2000, University of Groningen, The Netherlands.
+// Copyright (c) 2001-2004, The GROMACS development team,
+//
+// This file is part of Phaistos
+//
+// Phaistos is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Phaistos is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Phaistos.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+#ifndef TERM_CHARMM_VDW14_PARAMETERS_H
+#define TERM_CHARMM_VDW14_PARAMETERS_H
+
+#include "atom_types.h"
+
+namespace charmm_parameters {
+
+//! Non-bonded 1-4 parameters (from vdw14.itp)
+struct NonBonded14Record {
+     AtomTypeId atom_type1;
+     AtomTypeId atom_type2;
+     unsigned int pair_function;
+     double sigma;
+     double epsilon;
+};
+
+//! Number of entries in non_bonded_14_parameters
+const unsigned int N_NON_BONDED_14_PARAMETERS = 611;
+
+//! Non-bonded 1-4 parameters (from vdw14.itp)
+const NonBonded14Record non_bonded_14_parameters[N_NON_BONDED_14_PARAMETERS] = {
+     {ATOM_TYPE_CP1, ATOM_TYPE_CP1, 1, 0.338541512893, 0.04184},
+     {ATOM_TYPE_CP1, ATOM_TYPE_CP2, 1, 0.338541512893, 0.04184},
+     {ATOM_TYPE_CP1, ATOM_TYPE_CP3, 1, 0.338541512893, 0.04184},
+     {ATOM_TYPE_CP1, ATOM_TYPE_CT, 1, 0.338541512893, 0.04184},
+     {ATOM_TYPE_CP1, ATOM_TYPE_CT1, 1, 0.338541512893, 0.04184},
+     {ATOM_TYPE_CP1, ATOM_TYPE_CT2, 1, 0.338541512893, 0.04184},
+     {ATOM_TYPE_CP1, ATOM_TYPE_CT2A, 1, 0.338541512893, 0.04184},
+     {ATOM_TYPE_CP1, ATOM_TYPE_CT3, 1, 0.338541512893, 0.04184},
+     {ATOM_TYPE_CP1, ATOM_TYPE_HP, 1, 0.290272620344, 0.0724690057887},
+     {ATOM_TYPE_CP1, ATOM_TYPE_N, 1, 0.334087019303, 0.004184},
+     {ATOM_TYPE_CP1, ATOM_TYPE_NH1, 1, 0.307360057759, 0.187114168357},
+     {ATOM_TYPE_CP1, ATOM_TYPE_O, 1, 0.293996576986, 0.144938011577},
+     {ATOM_TYPE_CP1, ATOM_TYPE_OB, 1, 0.293996576986, 0.144938011577},
+     {ATOM_TYPE_CP1, ATOM_TYPE_C, 1, 0.347450500074, 0.138767581228},
+     {ATOM_TYPE_CP1, ATOM_TYPE_CA, 1, 0.346773417049, 0.110698234855},
+     {ATOM_TYPE_CP1, ATOM_TYPE_CC, 1, 0.347450500074, 0.110698234855},
+     {ATOM_TYPE_CP1, ATOM_TYPE_CD, 1, 0.347450500074, 0.110698234855},
+     {ATOM_TYPE_CP1, ATOM_TYPE_CE1, 1, 0.355468588538, 0.109105371453},
+     {ATOM_TYPE_CP1, ATOM_TYPE_CE2, 1, 0.354577689819, 0.105847757841},
+     {ATOM_TYPE_CP1, ATOM_TYPE_CPH1, 1, 0.329632525712, 0.0935570841786},
+     {ATOM_TYPE_CP1, ATOM_TYPE_CPH2, 1, 0.329632525712, 0.0935570841786},
+     {ATOM_TYPE_CP1, ATOM_TYPE_CS, 1, 0.365268474437, 0.138767581228},
+     {ATOM_TYPE_CP1, ATOM_TYPE_CPT, 1, 0.334977918021, 0.131646486622},
+     {ATOM_TYPE_CP1, ATOM_TYPE_CY, 1, 0.346559601356, 0.113045454929},
+     {ATOM_TYPE_CP1, ATOM_TYPE_CAI, 1, 0.346559601356, 0.113045454929},
+     {ATOM_TYPE_CP1, ATOM_TYPE_H, 1, 0.189271432669, 0.0897368027066},
+     {ATOM_TYPE_CP1, ATOM_TYPE_HA, 1, 0.286869387241, 0.06205874894},
+     {ATOM_TYPE_CP1, ATOM_TYPE_HB1, 1, 0.286869387241, 0.06205874894},
+     {ATOM_TYPE_CP1, ATOM_TYPE_HB2, 1, 0.288651184678, 0.0700117110204},
+     {ATOM_TYPE_CP1, ATOM_TYPE_HE1, 1, 0.280633096214, 0.0736669217492},
+     {ATOM_TYPE_CP1, ATOM_TYPE_HE2, 1, 0.281523994932, 0.0674649728378},
+     {ATOM_TYPE_CP1, ATOM_TYPE_HC, 1, 0.189271432669, 0.0897368027066},
+     {ATOM_TYPE_CP1, ATOM_TYPE_HR1, 1, 0.249451641079, 0.0897368027066},
+     {ATOM_TYPE_CP1, ATOM_TYPE_HR2, 1, 0.231633666716, 0.0897368027066},
+     {ATOM_TYPE_CP1, ATOM_TYPE_HR3, 1, 0.300054688269, 0.0369520874647},
+     {ATOM_TYPE_CP1, ATOM_TYPE_HS, 1, 0.209361198763, 0.132309697301},
+     {ATOM_TYPE_CP1, ATOM_TYPE_HA1, 1, 0.288651184678, 0.0887560431745},
+     {ATOM_TYPE_CP1, ATOM_TYPE_HA2, 1, 0.288651184678, 0.0771491480186},
+     {ATOM_TYPE_CP1, ATOM_TYPE_HA3, 1, 0.288651184678, 0.0648182492821},
+     {ATOM_TYPE_CP1, ATOM_TYPE_NC2, 1, 0.334087019303, 0.187114168357},
+     {ATOM_TYPE_CP1, ATOM_TYPE_NH2, 1, 0.334087019303, 0.187114168357},
+     {ATOM_TYPE_CP1, ATOM_TYPE_NH3, 1, 0.334087019303, 0.187114168357},
+     {ATOM_TYPE_CP1, ATOM_TYPE_NP, 1, 0.334087019303, 0.187114168357},
+     {ATOM_TYPE_CP1, ATOM_TYPE_NR1, 1, 0.334087019303, 0.187114168357},
+     {ATOM_TYPE_CP1, ATOM_TYPE_NR2, 1, 0.334087019303, 0.187114168357},
+     {ATOM_TYPE_CP1, ATOM_TYPE_NR3, 1, 0.334087019303, 0.187114168357},
+     {ATOM_TYPE_CP1, ATOM_TYPE_NY, 1, 0.334087019303, 0.187114168357},
+     {ATOM_TYPE_CP1, ATOM_TYPE_OC, 1, 0.320723538531, 0.144938011577},
+     {ATOM_TYPE_CP1, ATOM_TYPE_OH1, 1, 0.326959829558, 0.163176},
+     {ATOM_TYPE_CP1, ATOM_TYPE_OS, 1, 0.326959829558, 0.163176},
+     {ATOM_TYPE_CP1, ATOM_TYPE_S, 1, 0.347450500074, 0.280671252536},
+     {ATOM_TYPE_CP1, ATOM_TYPE_SM, 1, 0.345223253279, 0.257919081884},
+     {ATOM_TYPE_CP1, ATOM_TYPE_SS, 1, 0.365268474437, 0.286840588481},
+     {ATOM_TYPE_CP2, ATOM_TYPE_CP2, 1, 0.338541512893, 0.04184},
+     {ATOM_TYPE_CP2, ATOM_TYPE_CP3, 1, 0.338541512893, 0.04184},
+     {ATOM_TYPE_CP2, ATOM_TYPE_CT, 1, 0.338541512893, 0.04184},
+     {ATOM_TYPE_CP2, ATOM_TYPE_CT1, 1, 0.338541512893, 0.04184},
+     {ATOM_TYPE_CP2, ATOM_TYPE_CT2, 1, 0.338541512893, 0.04184},
+     {ATOM_TYPE_CP2, ATOM_TYPE_CT2A, 1, 0.338541512893, 0.04184},
+     {ATOM_TYPE_CP2, ATOM_TYPE_CT3, 1, 0.338541512893, 0.04184},
+     {ATOM_TYPE_CP2, ATOM_TYPE_HP, 1, 0.290272620344, 0.0724690057887},
+     {ATOM_TYPE_CP2, ATOM_TYPE_N, 1, 0.334087019303, 0.004184},
+     {ATOM_TYPE_CP2, ATOM_TYPE_NH1, 1, 0.307360057759, 0.187114168357},
+     {ATOM_TYPE_CP2, ATOM_TYPE_O, 1, 0.293996576986, 0.144938011577},
+     {ATOM_TYPE_CP2, ATOM_TYPE_OB, 1, 0.293996576986, 0.144938011577},
+     {ATOM_TYPE_CP2, ATOM_TYPE_C, 1, 0.347450500074, 0.138767581228},
+     {ATOM_TYPE_CP2, ATOM_TYPE_CA, 1, 0.346773417049, 0.110698234855},
+     {ATOM_TYPE_CP2, ATOM_TYPE_CC, 1, 0.347450500074, 0.110698234855},
+     {ATOM_TYPE_CP2, ATOM_TYPE_CD, 1, 0.347450500074, 0.110698234855},
+     {ATOM_TYPE_CP2, ATOM_TYPE_CE1, 1, 0.355468588538, 0.109105371453},
+     {ATOM_TYPE_CP2, ATOM_TYPE_CE2, 1, 0.354577689819, 0.105847757841},
+     {ATOM_TYPE_CP2, ATOM_TYPE_CPH1, 1, 0.329632525712, 0.0935570841786},
+     {ATOM_TYPE_CP2, ATOM_TYPE_CPH2, 1, 0.329632525712, 0.0935570841786},
+     {ATOM_TYPE_CP2, ATOM_TYPE_CS, 1, 0.365268474437, 0.138767581228},
+     {ATOM_TYPE_CP2, ATOM_TYPE_CPT, 1, 0.334977918021, 0.131646486622},
+     {ATOM_TYPE_CP2, ATOM_TYPE_CY, 1, 0.346559601356, 0.113045454929},
+     {ATOM_TYPE_CP2, ATOM_TYPE_CAI, 1, 0.346559601356, 0.113045454929},
+     {ATOM_TYPE_CP2, ATOM_TYPE_H, 1, 0.189271432669, 0.0897368027066},
+     {ATOM_TYPE_CP2, ATOM_TYPE_HA, 1, 0.286869387241, 0.06205874894},
+     {ATOM_TYPE_CP2, ATOM_TYPE_HB1, 1, 0.286869387241, 0.06205874894},
+     {ATOM_TYPE_CP2, ATOM_TYPE_HB2, 1, 0.288651184678, 0.0700117110204},
+     {ATOM_TYPE_CP2, ATOM_TYPE_HE1, 1, 0.280633096214, 0.0736669217492},
+     {ATOM_TYPE_CP2, ATOM_TYPE_HE2, 1, 0.281523994932, 0.0674649728378},
+     {ATOM_TYPE_CP2, ATOM_TYPE_HC, 1, 0.189271432669, 0.0897368027066},
+     {ATOM_TYPE_CP2, ATOM_TYPE_HR1, 1, 0.249451641079, 0.0897368027066},
+     {ATOM_TYPE_CP2, ATOM_TYPE_HR2, 1, 0.231633666716, 0.0897368027066},
+     {ATOM_TYPE_CP2, ATOM_TYPE_HR3, 1, 0.300054688269, 0.0369520874647},
+     {ATOM_TYPE_CP2, ATOM_TYPE_HS, 1, 0.209361198763, 0.132309697301},
+     {ATOM_TYPE_CP2, ATOM_TYPE_HA1, 1, 0.288651184678, 0.0887560431745},
+     {ATOM_TYPE_CP2, ATOM_TYPE_HA2, 1, 0.288651184678, 0.0771491480186},
+     {ATOM_TYPE_CP2, ATOM_TYPE_HA3, 1, 0.288651184678, 0.0648182492821},
+     {ATOM_TYPE_CP2, ATOM_TYPE_NC2, 1, 0.334087019303, 0.187114168357},
+     {ATOM_TYPE_CP2, ATOM_TYPE_NH2, 1, 0.334087019303, 0.187114168357},
+     {ATOM_TYPE_CP2, ATOM_TYPE_NH3, 1, 0.334087019303, 0.187114168357},
+     {ATOM_TYPE_CP2, ATOM_TYPE_NP, 1, 0.334087019303, 0.187114168357},
+     {ATOM_TYPE_CP2, ATOM_TYPE_NR1, 1, 0.334087019303, 0.187114168357},
+     {ATOM_TYPE_CP2, ATOM_TYPE_NR2, 1, 0.334087019303, 0.187114168357},
+     {ATOM_TYPE_CP2, ATOM_TYPE_NR3, 1, 0.334087019303, 0.187114168357},
+     {ATOM_TYPE_CP2, ATOM_TYPE_NY, 1, 0.334087019303, 0.187114168357},
+     {ATOM_TYPE_CP2, ATOM_TYPE_OC, 1, 0.320723538531, 0.144938011577},
+     {ATOM_TYPE_CP2, ATOM_TYPE_OH1, 1, 0.326959829558, 0.163176},
+     {ATOM_TYPE_CP2, ATOM_TYPE_OS, 1, 0.326959829558, 0.163176},
+     {ATOM_TYPE_CP2, ATOM_TYPE_S, 1, 0.347450500074, 0.280671252536},
+     {ATOM_TYPE_CP2, ATOM_TYPE_SM, 1, 0.345223253279, 0.257919081884},
+     {ATOM_TYPE_CP2, ATOM_TYPE_SS, 1, 0.365268474437, 0.286840588481},
+     {ATOM_TYPE_CP3, ATOM_TYPE_CP3, 1, 0.338541512893, 0.04184},
+     {ATOM_TYPE_CP3, ATOM_TYPE_CT, 1, 0.338541512893, 0.04184},
+     {ATOM_TYPE_CP3, ATOM_TYPE_CT1, 1, 0.338541512893, 0.04184},
+     {ATOM_TYPE_CP3, ATOM_TYPE_CT2, 1, 0.338541512893, 0.04184},
+     {ATOM_TYPE_CP3, ATOM_TYPE_CT2A, 1, 0.338541512893, 0.04184},
+     {ATOM_TYPE_CP3, ATOM_TYPE_CT3, 1, 0.338541512893, 0.04184},
+     {ATOM_TYPE_CP3, ATOM_TYPE_HP, 1, 0.290272620344, 0.0724690057887},
+     {ATOM_TYPE_CP3, ATOM_TYPE_N, 1, 0.334087019303, 0.004184},
+     {ATOM_TYPE_CP3, ATOM_TYPE_NH1, 1, 0.307360057759, 0.187114168357},
+     {ATOM_TYPE_CP3, ATOM_TYPE_O, 1, 0.293996576986, 0.144938011577},
+     {ATOM_TYPE_CP3, ATOM_TYPE_OB, 1, 0.293996576986, 0.144938011577},
+     {ATOM_TYPE_CP3, ATOM_TYPE_C, 1, 0.347450500074, 0.138767581228},
+     {ATOM_TYPE_CP3, ATOM_TYPE_CA, 1, 0.346773417049, 0.110698234855},
+     {ATOM_TYPE_CP3, ATOM_TYPE_CC, 1, 0.347450500074, 0.110698234855},
+     {ATOM_TYPE_CP3, ATOM_TYPE_CD, 1, 0.347450500074, 0.110698234855},
+     {ATOM_TYPE_CP3, ATOM_TYPE_CE1, 1, 0.355468588538, 0.109105371453},
+     {ATOM_TYPE_CP3, ATOM_TYPE_CE2, 1, 0.354577689819, 0.105847757841},
+     {ATOM_TYPE_CP3, ATOM_TYPE_CPH1, 1, 0.329632525712, 0.0935570841786},
+     {ATOM_TYPE_CP3, ATOM_TYPE_CPH2, 1, 0.329632525712, 0.0935570841786},
+     {ATOM_TYPE_CP3, ATOM_TYPE_CS, 1, 0.365268474437, 0.138767581228},
+     {ATOM_TYPE_CP3, ATOM_TYPE_CPT, 1, 0.334977918021, 0.131646486622},
+     {ATOM_TYPE_CP3, ATOM_TYPE_CY, 1, 0.346559601356, 0.113045454929},
+     {ATOM_TYPE_CP3, ATOM_TYPE_CAI, 1, 0.346559601356, 0.113045454929},
+     {ATOM_TYPE_CP3, ATOM_TYPE_H, 1, 0.189271432669, 0.0897368027066},
+     {ATOM_TYPE_CP3, ATOM_TYPE_HA, 1, 0.286869387241, 0.06205874894},
+     {ATOM_TYPE_CP3, ATOM_TYPE_HB1, 1, 0.286869387241, 0.06205874894},
+     {ATOM_TYPE_CP3, ATOM_TYPE_HB2, 1, 0.288651184678, 0.0700117110204},
+     {ATOM_TYPE_CP3, ATOM_TYPE_HE1, 1, 0.280633096214, 0.0736669217492},
+     {ATOM_TYPE_CP3, ATOM_TYPE_HE2, 1, 0.281523994932, 0.0674649728378},
+     {ATOM_TYPE_CP3, ATOM_TYPE_HC, 1, 0.189271432669, 0.0897368027066},
+     {ATOM_TYPE_CP3, ATOM_TYPE_HR1, 1, 0.249451641079, 0.0897368027066},
+     {ATOM_TYPE_CP3, ATOM_TYPE_HR2, 1, 0.231633666716, 0.0897368027066},
+     {ATOM_TYPE_CP3, ATOM_TYPE_HR3, 1, 0.300054688269, 0.0369520874647},
+     {ATOM_TYPE_CP3, ATOM_TYPE_HS, 1, 0.209361198763, 0.132309697301},
+     {ATOM_TYPE_CP3, ATOM_TYPE_HA1, 1, 0.288651184678, 0.0887560431745},
+     {ATOM_TYPE_CP3, ATOM_TYPE_HA2, 1, 0.288651184678, 0.0771491480186},
+     {ATOM_TYPE_CP3, ATOM_TYPE_HA3, 1, 0.288651184678, 0.0648182492821},
+     {ATOM_TYPE_CP3, ATOM_TYPE_NC2, 1, 0.334087019303, 0.187114168357},
+     {ATOM_TYPE_CP3, ATOM_TYPE_NH2, 1, 0.334087019303, 0.187114168357},
+     {ATOM_TYPE_CP3, ATOM_TYPE_NH3, 1, 0.334087019303, 0.187114168357},
+     {ATOM_TYPE_CP3, ATOM_TYPE_NP, 1, 0.334087019303, 0.187114168357},
+     {ATOM_TYPE_CP3, ATOM_TYPE_NR1, 1, 0.334087019303, 0.187114168357},
+     {ATOM_TYPE_CP3, ATOM_TYPE_NR2, 1, 0.334087019303, 0.187114168357},
+     {ATOM_TYPE_CP3, ATOM_TYPE_NR3, 1, 0.334087019303, 0.187114168357},
+     {ATOM_TYPE_CP3, ATOM_TYPE_NY, 1, 0.334087019303, 0.187114168357},
+     {ATOM_TYPE_CP3, ATOM_TYPE_OC, 1, 0.320723538531, 0.144938011577},
+     {ATOM_TYPE_CP3, ATOM_TYPE_OH1, 1, 0.326959829558, 0.163176},
+     {ATOM_TYPE_CP3, ATOM_TYPE_OS, 1, 0.326959829558, 0.163176},
+     {ATOM_TYPE_CP3, ATOM_TYPE_S, 1, 0.347450500074, 0.280671252536},
+     {ATOM_TYPE_CP3, ATOM_TYPE_SM, 1, 0.345223253279, 0.257919081884},
+     {ATOM_TYPE_CP3, ATOM_TYPE_SS, 1, 0.365268474437, 0.286840588481},
+     {ATOM_TYPE_CT, ATOM_TYPE_CT, 1, 0.338541512893, 0.04184},
+     {ATOM_TYPE_CT, ATOM_TYPE_CT1, 1, 0.338541512893, 0.04184},
+     {ATOM_TYPE_CT, ATOM_TYPE_CT2, 1, 0.338541512893, 0.04184},
+     {ATOM_TYPE_CT, ATOM_TYPE_CT2A, 1, 0.338541512893, 0.04184},
+     {ATOM_TYPE_CT, ATOM_TYPE_CT3, 1, 0.338541512893, 0.04184},
+     {ATOM_TYPE_CT, ATOM_TYPE_HP, 1, 0.290272620344, 0.0724690057887},
+     {ATOM_TYPE_CT, ATOM_TYPE_N, 1, 0.334087019303, 0.004184},
+     {ATOM_TYPE_CT, ATOM_TYPE_NH1, 1, 0.307360057759, 0.187114168357},
+     {ATOM_TYPE_CT, ATOM_TYPE_O, 1, 0.293996576986, 0.144938011577},
+     {ATOM_TYPE_CT, ATOM_TYPE_OB, 1, 0.293996576986, 0.144938011577},
+     {ATOM_TYPE_CT, ATOM_TYPE_C, 1, 0.347450500074, 0.138767581228},
+     {ATOM_TYPE_CT, ATOM_TYPE_CA, 1, 0.346773417049, 0.110698234855},
+     {ATOM_TYPE_CT, ATOM_TYPE_CC, 1, 0.347450500074, 0.110698234855},
+     {ATOM_TYPE_CT, ATOM_TYPE_CD, 1, 0.347450500074, 0.110698234855},
+     {ATOM_TYPE_CT, ATOM_TYPE_CE1, 1, 0.355468588538, 0.109105371453},
+     {ATOM_TYPE_CT, ATOM_TYPE_CE2, 1, 0.354577689819, 0.105847757841},
+     {ATOM_TYPE_CT, ATOM_TYPE_CPH1, 1, 0.329632525712, 0.0935570841786},
+     {ATOM_TYPE_CT, ATOM_TYPE_CPH2, 1, 0.329632525712, 0.0935570841786},
+     {ATOM_TYPE_CT, ATOM_TYPE_CS, 1, 0.365268474437, 0.138767581228},
+     {ATOM_TYPE_CT, ATOM_TYPE_CPT, 1, 0.334977918021, 0.131646486622},
+     {ATOM_TYPE_CT, ATOM_TYPE_CY, 1, 0.346559601356, 0.113045454929},
+     {ATOM_TYPE_CT, ATOM_TYPE_CAI, 1, 0.346559601356, 0.113045454929},
+     {ATOM_TYPE_CT, ATOM_TYPE_H, 1, 0.189271432669, 0.0897368027066},
+     {ATOM_TYPE_CT, ATOM_TYPE_HA, 1, 0.286869387241, 0.06205874894},
+     {ATOM_TYPE_CT, ATOM_TYPE_HB1, 1, 0.286869387241, 0.06205874894},
+     {ATOM_TYPE_CT, ATOM_TYPE_HB2, 1, 0.288651184678, 0.0700117110204},
+     {ATOM_TYPE_CT, ATOM_TYPE_HE1, 1, 0.280633096214, 0.0736669217492},
+     {ATOM_TYPE_CT, ATOM_TYPE_HE2, 1, 0.281523994932, 0.0674649728378},
+     {ATOM_TYPE_CT, ATOM_TYPE_HC, 1, 0.189271432669, 0.0897368027066},
+     {ATOM_TYPE_CT, ATOM_TYPE_HR1, 1, 0.249451641079, 0.0897368027066},
+     {ATOM_TYPE_CT, ATOM_TYPE_HR2, 1, 0.231633666716, 0.0897368027066},
+     {ATOM_TYPE_CT, ATOM_TYPE_HR3, 1, 0.300054688269, 0.0369520874647},
+     {ATOM_TYPE_CT, ATOM_TYPE_HS, 1, 0.209361198763, 0.132309697301},
+     {ATOM_TYPE_CT, ATOM_TYPE_HA1, 1, 0.288651184678, 0.0887560431745},
+     {ATOM_TYPE_CT, ATOM_TYPE_HA2, 1, 0.288651184678, 0.0771491480186},
+     {ATOM_TYPE_CT, ATOM_TYPE_HA3, 1, 0.288651184678, 0.0648182492821},
+     {ATOM_TYPE_CT, ATOM_TYPE_NC2, 1, 0.334087019303, 0.187114168357},
+     {ATOM_TYPE_CT, ATOM_TYPE_NH2, 1, 0.334087019303, 0.187114168357},
+     {ATOM_TYPE_CT, ATOM_TYPE_NH3, 1, 0.334087019303, 0.187114168357},
+     {ATOM_TYPE_CT, ATOM_TYPE_NP, 1, 0.334087019303, 0.187114168357},
+     {ATOM_TYPE_CT, ATOM_TYPE_NR1, 1, 0.334087019303, 0.187114168357},
+     {ATOM_TYPE_CT, ATOM_TYPE_NR2, 1, 0.334087019303, 0.187114168357},
+     {ATOM_TYPE_CT, ATOM_TYPE_NR3, 1, 0.334087019303, 0.187114168357},
+     {ATOM_TYPE_CT, ATOM_TYPE_NY, 1, 0.334087019303, 0.187114168357},
+     {ATOM_TYPE_CT, ATOM_TYPE_OC, 1, 0.320723538531, 0.144938011577},
+     {ATOM_TYPE_CT, ATOM_TYPE_OH1, 1, 0.326959829558, 0.163176},
+     {ATOM_TYPE_CT, ATOM_TYPE_OS, 1, 0.326959829558, 0.163176},
+     {ATOM_TYPE_CT, ATOM_TYPE_S, 1, 0.347450500074, 0.280671252536},
+     {ATOM_TYPE_CT, ATOM_TYPE_SM, 1, 0.345223253279, 0.257919081884},
+     {ATOM_TYPE_CT, ATOM_TYPE_SS, 1, 0.365268474437, 0.286840588481},
+     {ATOM_TYPE_CT1, ATOM_TYPE_CT1, 1, 0.338541512893, 0.04184},
+     {ATOM_TYPE_CT1, ATOM_TYPE_CT2, 1, 0.338541512893, 0.04184},
+     {ATOM_TYPE_CT1, ATOM_TYPE_CT2A, 1, 0.338541512893, 0.04184},
+     {ATOM_TYPE_CT1, ATOM_TYPE_CT3, 1, 0.338541512893, 0.04184},
+     {ATOM_TYPE_CT1, ATOM_TYPE_HP, 1, 0.290272620344, 0.0724690057887},
+     {ATOM_TYPE_CT1, ATOM_TYPE_N, 1, 0.334087019303, 0.004184},
+     {ATOM_TYPE_CT1, ATOM_TYPE_NH1, 1, 0.307360057759, 0.187114168357},
+     {ATOM_TYPE_CT1, ATOM_TYPE_O, 1, 0.293996576986, 0.144938011577},
+     {ATOM_TYPE_CT1, ATOM_TYPE_OB, 1, 0.293996576986, 0.144938011577},
+     {ATOM_TYPE_CT1, ATOM_TYPE_C, 1, 0.347450500074, 0.138767581228},
+     {ATOM_TYPE_CT1, ATOM_TYPE_CA, 1, 0.346773417049, 0.110698234855},
+     {ATOM_TYPE_CT1, ATOM_TYPE_CC, 1, 0.347450500074, 0.110698234855},
+     {ATOM_TYPE_CT1, ATOM_TYPE_CD, 1, 0.347450500074, 0.110698234855},
+     {ATOM_TYPE_CT1, ATOM_TYPE_CE1, 1, 0.355468588538, 0.109105371453},
+     {ATOM_TYPE_CT1, ATOM_TYPE_CE2, 1, 0.354577689819, 0.105847757841},
+     {ATOM_TYPE_CT1, ATOM_TYPE_CPH1, 1, 0.329632525712, 0.0935570841786},
+     {ATOM_TYPE_CT1, ATOM_TYPE_CPH2, 1, 0.329632525712, 0.0935570841786},
+     {ATOM_TYPE_CT1, ATOM_TYPE_CS, 1, 0.365268474437, 0.138767581228},
+     {ATOM_TYPE_CT1, ATOM_TYPE_CPT, 1, 0.334977918021, 0.131646486622},
+     {ATOM_TYPE_CT1, ATOM_TYPE_CY, 1, 0.346559601356, 0.113045454929},
+     {ATOM_TYPE_CT1, ATOM_TYPE_CAI, 1, 0.346559601356, 0.113045454929},
+     {ATOM_TYPE_CT1, ATOM_TYPE_H, 1, 0.189271432669, 0.0897368027066},
+     {ATOM_TYPE_CT1, ATOM_TYPE_HA, 1, 0.286869387241, 0.06205874894},
+     {ATOM_TYPE_CT1, ATOM_TYPE_HB1, 1, 0.286869387241, 0.06205874894},
+     {ATOM_TYPE_CT1, ATOM_TYPE_HB2, 1, 0.288651184678, 0.0700117110204},
+     {ATOM_TYPE_CT1, ATOM_TYPE_HE1, 1, 0.280633096214, 0.0736669217492},
+     {ATOM_TYPE_CT1, ATOM_TYPE_HE2, 1, 0.281523994932, 0.0674649728378},
+     {ATOM_TYPE_CT1, ATOM_TYPE_HC, 1, 0.189271432669, 0.0897368027066},
+     {ATOM_TYPE_CT1, ATOM_TYPE_HR1, 1, 0.249451641079, 0.0897368027066},
+     {ATOM_TYPE_CT1, ATOM_TYPE_HR2, 1, 0.231633666716, 0.0897368027066},
+     {ATOM_TYPE_CT1, ATOM_TYPE_HR3, 1, 0.300054688269, 0.0369520874647},
+     {ATOM_TYPE_CT1, ATOM_TYPE_HS, 1, 0.209361198763, 0.132309697301},
+     {ATOM_TYPE_CT1, ATOM_TYPE_HA1, 1, 0.288651184678, 0.0887560431745},
+     {ATOM_TYPE_CT1, ATOM_TYPE_HA2, 1, 0.288651184678, 0.0771491480186},
+     {ATOM_TYPE_CT1, ATOM_TYPE_HA3, 1, 0.288651184678, 0.0648182492821},
+     {ATOM_TYPE_CT1, ATOM_TYPE_NC2, 1, 0.334087019303, 0.187114168357},
+     {ATOM_TYPE_CT1, ATOM_TYPE_NH2, 1, 0.334087019303, 0.187114168357},
+     {ATOM_TYPE_CT1, ATOM_TYPE_NH3, 1, 0.334087019303, 0.187114168357},
+     {ATOM_TYPE_CT1, ATOM_TYPE_NP, 1, 0.334087019303, 0.187114168357},
+     {ATOM_TYPE_CT1, ATOM_TYPE_NR1, 1, 0.334087019303, 0.187114168357},
+     {ATOM_TYPE_CT1, ATOM_TYPE_NR2, 1, 0.334087019303, 0.187114168357},
+     {ATOM_TYPE_CT1, ATOM_TYPE_NR3, 1, 0.334087019303, 0.187114168357},
+     {ATOM_TYPE_CT1, ATOM_TYPE_NY, 1, 0.334087019303, 0.187114168357},
+     {ATOM_TYPE_CT1, ATOM_TYPE_OC, 1, 0.320723538531, 0.144938011577},
+     {ATOM_TYPE_CT1, ATOM_TYPE_OH1, 1, 0.326959829558, 0.163176},
+     {ATOM_TYPE_CT1, ATOM_TYPE_OS, 1, 0.326959829558, 0.163176},
+     {ATOM_TYPE_CT1, ATOM_TYPE_S, 1, 0.347450500074, 0.280671252536},
+     {ATOM_TYPE_CT1, ATOM_TYPE_SM, 1, 0.345223253279, 0.257919081884},
+     {ATOM_TYPE_CT1, ATOM_TYPE_SS, 1, 0.365268474437, 0.286840588481},
+     {ATOM_TYPE_CT2, ATOM_TYPE_CT2, 1, 0.338541512893, 0.04184},
+     {ATOM_TYPE_CT2, ATOM_TYPE_CT2A, 1, 0.338541512893, 0.04184},
+     {ATOM_TYPE_CT2, ATOM_TYPE_CT3, 1, 0.338541512893, 0.04184},
+     {ATOM_TYPE_CT2, ATOM_TYPE_HP, 1, 0.290272620344, 0.0724690057887},
+     {ATOM_TYPE_CT2, ATOM_TYPE_N, 1, 0.334087019303, 0.004184},
+     {ATOM_TYPE_CT2, ATOM_TYPE_NH1, 1, 0.307360057759, 0.187114168357},
+     {ATOM_TYPE_CT2, ATOM_TYPE_O, 1, 0.293996576986, 0.144938011577},
+     {ATOM_TYPE_CT2, ATOM_TYPE_OB, 1, 0.293996576986, 0.144938011577},
+     {ATOM_TYPE_CT2, ATOM_TYPE_C, 1, 0.347450500074, 0.138767581228},
+     {ATOM_TYPE_CT2, ATOM_TYPE_CA, 1, 0.346773417049, 0.110698234855},
+     {ATOM_TYPE_CT2, ATOM_TYPE_CC, 1, 0.347450500074, 0.110698234855},
+     {ATOM_TYPE_CT2, ATOM_TYPE_CD, 1, 0.347450500074, 0.110698234855},
+     {ATOM_TYPE_CT2, ATOM_TYPE_CE1, 1, 0.355468588538, 0.109105371453},
+     {ATOM_TYPE_CT2, ATOM_TYPE_CE2, 1, 0.354577689819, 0.105847757841},
+     {ATOM_TYPE_CT2, ATOM_TYPE_CPH1, 1, 0.329632525712, 0.0935570841786},
+     {ATOM_TYPE_CT2, ATOM_TYPE_CPH2, 1, 0.329632525712, 0.0935570841786},
+     {ATOM_TYPE_CT2, ATOM_TYPE_CS, 1, 0.365268474437, 0.138767581228},
+     {ATOM_TYPE_CT2, ATOM_TYPE_CPT, 1, 0.334977918021, 0.131646486622},
+     {ATOM_TYPE_CT2, ATOM_TYPE_CY, 1, 0.346559601356, 0.113045454929},
+     {ATOM_TYPE_CT2, ATOM_TYPE_CAI, 1, 0.346559601356, 0.113045454929},
+     {ATOM_TYPE_CT2, ATOM_TYPE_H, 1, 0.189271432669, 0.0897368027066},
+     {ATOM_TYPE_CT2, ATOM_TYPE_HA, 1, 0.286869387241, 0.06205874894},
+     {ATOM_TYPE_CT2, ATOM_TYPE_HB1, 1, 0.286869387241, 0.06205874894},
+     {ATOM_TYPE_CT2, ATOM_TYPE_HB2, 1, 0.288651184678, 0.0700117110204},
+     {ATOM_TYPE_CT2, ATOM_TYPE_HE1, 1, 0.280633096214, 0.0736669217492},
+     {ATOM_TYPE_CT2, ATOM_TYPE_HE2, 1, 0.281523994932, 0.0674649728378},
+     {ATOM_TYPE_CT2, ATOM_TYPE_HC, 1, 0.189271432669, 0.0897368027066},
+     {ATOM_TYPE_CT2, ATOM_TYPE_HR1, 1, 0.249451641079, 0.0897368027066},
+     {ATOM_TYPE_CT2, ATOM_TYPE_HR2, 1, 0.231633666716, 0.0897368027066},
+     {ATOM_TYPE_CT2, ATOM_TYPE_HR3, 1, 0.300054688269, 0.0369520874647},
+     {ATOM_TYPE_CT2, ATOM_TYPE_HS, 1, 0.209361198763, 0.132309697301},
+     {ATOM_TYPE_CT2, ATOM_TYPE_HA1, 1, 0.288651184678, 0.0887560431745},
+     {ATOM_TYPE_CT2, ATOM_TYPE_HA2, 1, 0.288651184678, 0.0771491480186},
+     {ATOM_TYPE_CT2, ATOM_TYPE_HA3, 1, 0.288651184678, 0.0648182492821},
+     {ATOM_TYPE_CT2, ATOM_TYPE_NC2, 1, 0.334087019303, 0.187114168357},
+     {ATOM_TYPE_CT2, ATOM_TYPE_NH2, 1, 0.334087019303, 0.187114168357},
+     {ATOM_TYPE_CT2, ATOM_TYPE_NH3, 1, 0.334087019303, 0.187114168357},
+     {ATOM_TYPE_CT2, ATOM_TYPE_NP, 1, 0.334087019303, 0.187114168357},
+     {ATOM_TYPE_CT2, ATOM_TYPE_NR1, 1, 0.334087019303, 0.187114168357},
+     {ATOM_TYPE_CT2, ATOM_TYPE_NR2, 1, 0.334087019303, 0.187114168357},
+     {ATOM_TYPE_CT2, ATOM_TYPE_NR3, 1, 0.334087019303, 0.187114168357},
+     {ATOM_TYPE_CT2, ATOM_TYPE_NY, 1, 0.334087019303, 0.187114168357},
+     {ATOM_TYPE_CT2, ATOM_TYPE_OC, 1, 0.320723538531, 0.144938011577},
+     {ATOM_TYPE_CT2, ATOM_TYPE_OH1, 1, 0.326959829558, 0.163176},
+     {ATOM_TYPE_CT2, ATOM_TYPE_OS, 1, 0.326959829558, 0.163176},
+     {ATOM_TYPE_CT2, ATOM_TYPE_S, 1, 0.347450500074, 0.280671252536},
+     {ATOM_TYPE_CT2, ATOM_TYPE_SM, 1, 0.345223253279, 0.257919081884},
+     {ATOM_TYPE_CT2, ATOM_TYPE_SS, 1, 0.365268474437, 0.286840588481},
+     {ATOM_TYPE_CT2A, ATOM_TYPE_CT2A, 1, 0.338541512893, 0.04184},
+     {ATOM_TYPE_CT2A, ATOM_TYPE_CT3, 1, 0.338541512893, 0.04184},
+     {ATOM_TYPE_CT2A, ATOM_TYPE_HP, 1, 0.290272620344, 0.0724690057887},
+     {ATOM_TYPE_CT2A, ATOM_TYPE_N, 1, 0.334087019303, 0.004184},
+     {ATOM_TYPE_CT2A, ATOM_TYPE_NH1, 1, 0.307360057759, 0.187114168357},
+     {ATOM_TYPE_CT2A, ATOM_TYPE_O, 1, 0.293996576986, 0.144938011577},
+     {ATOM_TYPE_CT2A, ATOM_TYPE_OB, 1, 0.293996576986, 0.144938011577},
+     {ATOM_TYPE_CT2A, ATOM_TYPE_C, 1, 0.347450500074, 0.138767581228},
+     {ATOM_TYPE_CT2A, ATOM_TYPE_CA, 1, 0.346773417049, 0.110698234855},
+     {ATOM_TYPE_CT2A, ATOM_TYPE_CC, 1, 0.347450500074, 0.110698234855},
+     {ATOM_TYPE_CT2A, ATOM_TYPE_CD, 1, 0.347450500074, 0.110698234855},
+     {ATOM_TYPE_CT2A, ATOM_TYPE_CE1, 1, 0.355468588538, 0.109105371453},
+     {ATOM_TYPE_CT2A, ATOM_TYPE_CE2, 1, 0.354577689819, 0.105847757841},
+     {ATOM_TYPE_CT2A, ATOM_TYPE_CPH1, 1, 0.329632525712, 0.0935570841786},
+     {ATOM_TYPE_CT2A, ATOM_TYPE_CPH2, 1, 0.329632525712, 0.0935570841786},
+     {ATOM_TYPE_CT2A, ATOM_TYPE_CS, 1, 0.365268474437, 0.138767581228},
+     {ATOM_TYPE_CT2A, ATOM_TYPE_CPT, 1, 0.334977918021, 0.131646486622},
+     {ATOM_TYPE_CT2A, ATOM_TYPE_CY, 1, 0.346559601356, 0.113045454929},
+     {ATOM_TYPE_CT2A, ATOM_TYPE_CAI, 1, 0.346559601356, 0.113045454929},
+     {ATOM_TYPE_CT2A, ATOM_TYPE_H, 1, 0.189271432669, 0.0897368027066},
+     {ATOM_TYPE_CT2A, ATOM_TYPE_HA, 1, 0.286869387241, 0.06205874894},
+     {ATOM_TYPE_CT2A, ATOM_TYPE_HB1, 1, 0.286869387241, 0.06205874894},
+     {ATOM_TYPE_CT2A, ATOM_TYPE_HB2, 1, 0.288651184678, 0.0700117110204},
+     {ATOM_TYPE_CT2A, ATOM_TYPE_HE1, 1, 0.280633096214, 0.0736669217492},
+     {ATOM_TYPE_CT2A, ATOM_TYPE_HE2, 1, 0.281523994932, 0.0674649728378},
+     {ATOM_TYPE_CT2A, ATOM_TYPE_HC, 1, 0.189271432669, 0.0897368027066},
+     {ATOM_TYPE_CT2A, ATOM_TYPE_HR1, 1, 0.249451641079, 0.0897368027066},
+     {ATOM_TYPE_CT2A, ATOM_TYPE_HR2, 1, 0.231633666716, 0.0897368027066},
+     {ATOM_TYPE_CT2A, ATOM_TYPE_HR3, 1, 0.300054688269, 0.0369520874647},
+     {ATOM_TYPE_CT2A, ATOM_TYPE_HS, 1, 0.209361198763, 0.132309697301},
+     {ATOM_TYPE_CT2A, ATOM_TYPE_HA1, 1, 0.288651184678, 0.0887560431745},
+     {ATOM_TYPE_CT2A, ATOM_TYPE_HA2, 1, 0.288651184678, 0.0771491480186},
+     {ATOM_TYPE_CT2A, ATOM_TYPE_HA3, 1, 0.288651184678, 0.0648182492821},
+     {ATOM_TYPE_CT2A, ATOM_TYPE_NC2, 1, 0.334087019303, 0.187114168357},
+     {ATOM_TYPE_CT2A, ATOM_TYPE_NH2, 1, 0.334087019303, 0.187114168357},
+     {ATOM_TYPE_CT2A, ATOM_TYPE_NH3, 1, 0.334087019303, 0.187114168357},
+     {ATOM_TYPE_CT2A, ATOM_TYPE_NP, 1, 0.334087019303, 0.187114168357},
+     {ATOM_TYPE_CT2A, ATOM_TYPE_NR1, 1, 0.334087019303, 0.187114168357},
+     {ATOM_TYPE_CT2A, ATOM_TYPE_NR2, 1, 0.334087019303, 0.187114168357},
+     {ATOM_TYPE_CT2A, ATOM_TYPE_NR3, 1, 0.334087019303, 0.187114168357},
+     {ATOM_TYPE_CT2A, ATOM_TYPE_NY, 1, 0.334087019303, 0.187114168357},
+     {ATOM_TYPE_CT2A, ATOM_TYPE_OC, 1, 0.320723538531, 0.144938011577},
+     {ATOM_TYPE_CT2A, ATOM_TYPE_OH1, 1, 0.326959829558, 0.163176},
+     {ATOM_TYPE_CT2A, ATOM_TYPE_OS, 1, 0.326959829558, 0.163176},
+     {ATOM_TYPE_CT2A, ATOM_TYPE_S, 1, 0.347450500074, 0.280671252536},
+     {ATOM_TYPE_CT2A, ATOM_TYPE_SM, 1, 0.345223253279, 0.257919081884},
+     {ATOM_TYPE_CT2A, ATOM_TYPE_SS, 1, 0.365268474437, 0.286840588481},
+     {ATOM_TYPE_CT3, ATOM_TYPE_CT3, 1, 0.338541512893, 0.04184},
+     {ATOM_TYPE_CT3, ATOM_TYPE_HP, 1, 0.290272620344, 0.0724690057887},
+     {ATOM_TYPE_CT3, ATOM_TYPE_N, 1, 0.334087019303, 0.004184},
+     {ATOM_TYPE_CT3, ATOM_TYPE_NH1, 1, 0.307360057759, 0.187114168357},
+     {ATOM_TYPE_CT3, ATOM_TYPE_O, 1, 0.293996576986, 0.144938011577},
+     {ATOM_TYPE_CT3, ATOM_TYPE_OB, 1, 0.293996576986, 0.144938011577},
+     {ATOM_TYPE_CT3, ATOM_TYPE_C, 1, 0.347450500074, 0.138767581228},
+     {ATOM_TYPE_CT3, ATOM_TYPE_CA, 1, 0.346773417049, 0.110698234855},
+     {ATOM_TYPE_CT3, ATOM_TYPE_CC, 1, 0.347450500074, 0.110698234855},
+     {ATOM_TYPE_CT3, ATOM_TYPE_CD, 1, 0.347450500074, 0.110698234855},
+     {ATOM_TYPE_CT3, ATOM_TYPE_CE1, 1, 0.355468588538, 0.109105371453},
+     {ATOM_TYPE_CT3, ATOM_TYPE_CE2, 1, 0.354577689819, 0.105847757841},
+     {ATOM_TYPE_CT3, ATOM_TYPE_CPH1, 1, 0.329632525712, 0.0935570841786},
+     {ATOM_TYPE_CT3, ATOM_TYPE_CPH2, 1, 0.329632525712, 0.0935570841786},
+     {ATOM_TYPE_CT3, ATOM_TYPE_CS, 1, 0.365268474437, 0.138767581228},
+     {ATOM_TYPE_CT3, ATOM_TYPE_CPT, 1, 0.334977918021, 0.131646486622},
+     {ATOM_TYPE_CT3, ATOM_TYPE_CY, 1, 0.346559601356, 0.113045454929},
+     {ATOM_TYPE_CT3, ATOM_TYPE_CAI, 1, 0.346559601356, 0.113045454929},
+     {ATOM_TYPE_CT3, ATOM_TYPE_H, 1, 0.189271432669, 0.0897368027066},
+     {ATOM_TYPE_CT3, ATOM_TYPE_HA, 1, 0.286869387241, 0.06205874894},
+     {ATOM_TYPE_CT3, ATOM_TYPE_HB1, 1, 0.286869387241, 0.06205874894},
+     {ATOM_TYPE_CT3, ATOM_TYPE_HB2, 1, 0.288651184678, 0.0700117110204},
+     {ATOM_TYPE_CT3, ATOM_TYPE_HE1, 1, 0.280633096214, 0.0736669217492},
+     {ATOM_TYPE_CT3, ATOM_TYPE_HE2, 1, 0.281523994932, 0.0674649728378},
+     {ATOM_TYPE_CT3, ATOM_TYPE_HC, 1, 0.189271432669, 0.0897368027066},
+     {ATOM_TYPE_CT3, ATOM_TYPE_HR1, 1, 0.249451641079, 0.0897368027066},
+     {ATOM_TYPE_CT3, ATOM_TYPE_HR2, 1, 0.231633666716, 0.0897368027066},
+     {ATOM_TYPE_CT3, ATOM_TYPE_HR3, 1, 0.300054688269, 0.0369520874647},
+     {ATOM_TYPE_CT3, ATOM_TYPE_HS, 1, 0.209361198763, 0.132309697301},
+     {ATOM_TYPE_CT3, ATOM_TYPE_HA1, 1, 0.288651184678, 0.0887560431745},
+     {ATOM_TYPE_CT3, ATOM_TYPE_HA2, 1, 0.288651184678, 0.0771491480186},
+     {ATOM_TYPE_CT3, ATOM_TYPE_HA3, 1, 0.288651184678, 0.0648182492821},
+     {ATOM_TYPE_CT3, ATOM_TYPE_NC2, 1, 0.334087019303, 0.187114168357},
+     {ATOM_TYPE_CT3, ATOM_TYPE_NH2, 1, 0.334087019303, 0.187114168357},
+     {ATOM_TYPE_CT3, ATOM_TYPE_NH3, 1, 0.334087019303, 0.187114168357},
+     {ATOM_TYPE_CT3, ATOM_TYPE_NP, 1, 0.334087019303, 0.187114168357},
+     {ATOM_TYPE_CT3, ATOM_TYPE_NR1, 1, 0.334087019303, 0.187114168357},
+     {ATOM_TYPE_CT3, ATOM_TYPE_NR2, 1, 0.334087019303, 0.187114168357},
+     {ATOM_TYPE_CT3, ATOM_TYPE_NR3, 1, 0.334087019303, 0.187114168357},
+     {ATOM_TYPE_CT3, ATOM_TYPE_NY, 1, 0.334087019303, 0.187114168357},
+     {ATOM_TYPE_CT3, ATOM_TYPE_OC, 1, 0.320723538531, 0.144938011577},
+     {ATOM_TYPE_CT3, ATOM_TYPE_OH1, 1, 0.326959829558, 0.163176},
+     {ATOM_TYPE_CT3, ATOM_TYPE_OS, 1, 0.326959829558, 0.163176},
+     {ATOM_TYPE_CT3, ATOM_TYPE_S, 1, 0.347450500074, 0.280671252536},
+     {ATOM_TYPE_CT3, ATOM_TYPE_SM, 1, 0.345223253279, 0.257919081884},
+     {ATOM_TYPE_CT3, ATOM_TYPE_SS, 1, 0.365268474437, 0.286840588481},
+     {ATOM_TYPE_HP, ATOM_TYPE_HP, 1, 0.242003727796, 0.12552},
+     {ATOM_TYPE_HP, ATOM_TYPE_N, 1, 0.285818126754, 0.00724690057887},
+     {ATOM_TYPE_HP, ATOM_TYPE_NH1, 1, 0.25909116521, 0.324091246411},
+     {ATOM_TYPE_HP, ATOM_TYPE_O, 1, 0.245727684437, 0.25104},
+     {ATOM_TYPE_HP, ATOM_TYPE_OB, 1, 0.245727684437, 0.25104},
+     {ATOM_TYPE_HP, ATOM_TYPE_C, 1, 0.299181607526, 0.240352501131},
+     {ATOM_TYPE_HP, ATOM_TYPE_CA, 1, 0.298504524501, 0.191734967077},
+     {ATOM_TYPE_HP, ATOM_TYPE_CC, 1, 0.299181607526, 0.191734967077},
+     {ATOM_TYPE_HP, ATOM_TYPE_CD, 1, 0.299181607526, 0.191734967077},
+     {ATOM_TYPE_HP, ATOM_TYPE_CE1, 1, 0.30719969599, 0.188976046736},
+     {ATOM_TYPE_HP, ATOM_TYPE_CE2, 1, 0.306308797271, 0.183333694448},
+     {ATOM_TYPE_HP, ATOM_TYPE_CPH1, 1, 0.281363633163, 0.162045623205},
+     {ATOM_TYPE_HP, ATOM_TYPE_CPH2, 1, 0.281363633163, 0.162045623205},
+     {ATOM_TYPE_HP, ATOM_TYPE_CS, 1, 0.316999581889, 0.240352501131},
+     {ATOM_TYPE_HP, ATOM_TYPE_CPT, 1, 0.286709025472, 0.228018403468},
+     {ATOM_TYPE_HP, ATOM_TYPE_CY, 1, 0.298290708808, 0.195800471501},
+     {ATOM_TYPE_HP, ATOM_TYPE_CAI, 1, 0.298290708808, 0.195800471501},
+     {ATOM_TYPE_HP, ATOM_TYPE_H, 1, 0.14100254012, 0.155428701597},
+     {ATOM_TYPE_HP, ATOM_TYPE_HA, 1, 0.238600494692, 0.107488906218},
+     {ATOM_TYPE_HP, ATOM_TYPE_HB1, 1, 0.238600494692, 0.107488906218},
+     {ATOM_TYPE_HP, ATOM_TYPE_HB2, 1, 0.240382292129, 0.121263840612},
+     {ATOM_TYPE_HP, ATOM_TYPE_HE1, 1, 0.232364203665, 0.127594851307},
+     {ATOM_TYPE_HP, ATOM_TYPE_HE2, 1, 0.233255102384, 0.116852760686},
+     {ATOM_TYPE_HP, ATOM_TYPE_HC, 1, 0.14100254012, 0.155428701597},
+     {ATOM_TYPE_HP, ATOM_TYPE_HR1, 1, 0.20118274853, 0.155428701597},
+     {ATOM_TYPE_HP, ATOM_TYPE_HR2, 1, 0.183364774168, 0.155428701597},
+     {ATOM_TYPE_HP, ATOM_TYPE_HR3, 1, 0.251785795721, 0.0640028929346},
+     {ATOM_TYPE_HP, ATOM_TYPE_HS, 1, 0.161092306214, 0.22916711806},
+     {ATOM_TYPE_HP, ATOM_TYPE_HA1, 1, 0.240382292129, 0.153729976257},
+     {ATOM_TYPE_HP, ATOM_TYPE_HA2, 1, 0.240382292129, 0.133626244129},
+     {ATOM_TYPE_HP, ATOM_TYPE_HA3, 1, 0.240382292129, 0.112268501014},
+     {ATOM_TYPE_HP, ATOM_TYPE_NC2, 1, 0.285818126754, 0.324091246411},
+     {ATOM_TYPE_HP, ATOM_TYPE_NH2, 1, 0.285818126754, 0.324091246411},
+     {ATOM_TYPE_HP, ATOM_TYPE_NH3, 1, 0.285818126754, 0.324091246411},
+     {ATOM_TYPE_HP, ATOM_TYPE_NP, 1, 0.285818126754, 0.324091246411},
+     {ATOM_TYPE_HP, ATOM_TYPE_NR1, 1, 0.285818126754, 0.324091246411},
+     {ATOM_TYPE_HP, ATOM_TYPE_NR2, 1, 0.285818126754, 0.324091246411},
+     {ATOM_TYPE_HP, ATOM_TYPE_NR3, 1, 0.285818126754, 0.324091246411},
+     {ATOM_TYPE_HP, ATOM_TYPE_NY, 1, 0.285818126754, 0.324091246411},
+     {ATOM_TYPE_HP, ATOM_TYPE_OC, 1, 0.272454645982, 0.25104},
+     {ATOM_TYPE_HP, ATOM_TYPE_OH1, 1, 0.278690937009, 0.282629122576},
+     {ATOM_TYPE_HP, ATOM_TYPE_OS, 1, 0.278690937009, 0.282629122576},
+     {ATOM_TYPE_HP, ATOM_TYPE_S, 1, 0.299181607526, 0.486136869616},
+     {ATOM_TYPE_HP, ATOM_TYPE_SM, 1, 0.29695436073, 0.446728954065},
+     {ATOM_TYPE_HP, ATOM_TYPE_SS, 1, 0.316999581889, 0.496822472922},
+     {ATOM_TYPE_N, ATOM_TYPE_N, 1, 0.329632525712, 0.0004184},
+     {ATOM_TYPE_N, ATOM_TYPE_NH1, 1, 0.302905564168, 0.0187114168357},
+     {ATOM_TYPE_N, ATOM_TYPE_O, 1, 0.289542083396, 0.0144938011577},
+     {ATOM_TYPE_N, ATOM_TYPE_OB, 1, 0.289542083396, 0.0144938011577},
+     {ATOM_TYPE_N, ATOM_TYPE_C, 1, 0.342996006484, 0.0138767581228},
+     {ATOM_TYPE_N, ATOM_TYPE_CA, 1, 0.342318923459, 0.0110698234855},
+     {ATOM_TYPE_N, ATOM_TYPE_CC, 1, 0.342996006484, 0.0110698234855},
+     {ATOM_TYPE_N, ATOM_TYPE_CD, 1, 0.342996006484, 0.0110698234855},
+     {ATOM_TYPE_N, ATOM_TYPE_CE1, 1, 0.351014094948, 0.0109105371453},
+     {ATOM_TYPE_N, ATOM_TYPE_CE2, 1, 0.350123196229, 0.0105847757841},
+     {ATOM_TYPE_N, ATOM_TYPE_CPH1, 1, 0.325178032121, 0.00935570841786},
+     {ATOM_TYPE_N, ATOM_TYPE_CPH2, 1, 0.325178032121, 0.00935570841786},
+     {ATOM_TYPE_N, ATOM_TYPE_CS, 1, 0.360813980847, 0.0138767581228},
+     {ATOM_TYPE_N, ATOM_TYPE_CPT, 1, 0.33052342443, 0.0131646486622},
+     {ATOM_TYPE_N, ATOM_TYPE_CY, 1, 0.342105107766, 0.0113045454929},
+     {ATOM_TYPE_N, ATOM_TYPE_CAI, 1, 0.342105107766, 0.0113045454929},
+     {ATOM_TYPE_N, ATOM_TYPE_H, 1, 0.184816939078, 0.00897368027066},
+     {ATOM_TYPE_N, ATOM_TYPE_HA, 1, 0.28241489365, 0.006205874894},
+     {ATOM_TYPE_N, ATOM_TYPE_HB1, 1, 0.28241489365, 0.006205874894},
+     {ATOM_TYPE_N, ATOM_TYPE_HB2, 1, 0.284196691087, 0.00700117110204},
+     {ATOM_TYPE_N, ATOM_TYPE_HE1, 1, 0.276178602624, 0.00736669217492},
+     {ATOM_TYPE_N, ATOM_TYPE_HE2, 1, 0.277069501341, 0.00674649728378},
+     {ATOM_TYPE_N, ATOM_TYPE_HC, 1, 0.184816939078, 0.00897368027066},
+     {ATOM_TYPE_N, ATOM_TYPE_HR1, 1, 0.244997147489, 0.00897368027066},
+     {ATOM_TYPE_N, ATOM_TYPE_HR2, 1, 0.227179173126, 0.00897368027066},
+     {ATOM_TYPE_N, ATOM_TYPE_HR3, 1, 0.295600194679, 0.00369520874647},
+     {ATOM_TYPE_N, ATOM_TYPE_HS, 1, 0.204906705172, 0.0132309697301},
+     {ATOM_TYPE_N, ATOM_TYPE_HA1, 1, 0.284196691087, 0.00887560431745},
+     {ATOM_TYPE_N, ATOM_TYPE_HA2, 1, 0.284196691087, 0.00771491480186},
+     {ATOM_TYPE_N, ATOM_TYPE_HA3, 1, 0.284196691087, 0.00648182492821},
+     {ATOM_TYPE_N, ATOM_TYPE_NC2, 1, 0.329632525712, 0.0187114168357},
+     {ATOM_TYPE_N, ATOM_TYPE_NH2, 1, 0.329632525712, 0.0187114168357},
+     {ATOM_TYPE_N, ATOM_TYPE_NH3, 1, 0.329632525712, 0.0187114168357},
+     {ATOM_TYPE_N, ATOM_TYPE_NP, 1, 0.329632525712, 0.0187114168357},
+     {ATOM_TYPE_N, ATOM_TYPE_NR1, 1, 0.329632525712, 0.0187114168357},
+     {ATOM_TYPE_N, ATOM_TYPE_NR2, 1, 0.329632525712, 0.0187114168357},
+     {ATOM_TYPE_N, ATOM_TYPE_NR3, 1, 0.329632525712, 0.0187114168357},
+     {ATOM_TYPE_N, ATOM_TYPE_NY, 1, 0.329632525712, 0.0187114168357},
+     {ATOM_TYPE_N, ATOM_TYPE_OC, 1, 0.31626904494, 0.0144938011577},
+     {ATOM_TYPE_N, ATOM_TYPE_OH1, 1, 0.322505335967, 0.0163176},
+     {ATOM_TYPE_N, ATOM_TYPE_OS, 1, 0.322505335967, 0.0163176},
+     {ATOM_TYPE_N, ATOM_TYPE_S, 1, 0.342996006484, 0.0280671252536},
+     {ATOM_TYPE_N, ATOM_TYPE_SM, 1, 0.340768759689, 0.0257919081884},
+     {ATOM_TYPE_N, ATOM_TYPE_SS, 1, 0.360813980847, 0.0286840588481},
+     {ATOM_TYPE_NH1, ATOM_TYPE_NH1, 1, 0.276178602624, 0.8368},
+     {ATOM_TYPE_NH1, ATOM_TYPE_O, 1, 0.262815121852, 0.648182492821},
+     {ATOM_TYPE_NH1, ATOM_TYPE_OB, 1, 0.262815121852, 0.648182492821},
+     {ATOM_TYPE_NH1, ATOM_TYPE_C, 1, 0.31626904494, 0.6205874894},
+     {ATOM_TYPE_NH1, ATOM_TYPE_CA, 1, 0.315591961915, 0.49505755625},
+     {ATOM_TYPE_NH1, ATOM_TYPE_CC, 1, 0.31626904494, 0.49505755625},
+     {ATOM_TYPE_NH1, ATOM_TYPE_CD, 1, 0.31626904494, 0.49505755625},
+     {ATOM_TYPE_NH1, ATOM_TYPE_CE1, 1, 0.324287133404, 0.487934054561},
+     {ATOM_TYPE_NH1, ATOM_TYPE_CE2, 1, 0.323396234685, 0.473365563598},
+     {ATOM_TYPE_NH1, ATOM_TYPE_CPH1, 1, 0.298451070577, 0.4184},
+     {ATOM_TYPE_NH1, ATOM_TYPE_CPH2, 1, 0.298451070577, 0.4184},
+     {ATOM_TYPE_NH1, ATOM_TYPE_CS, 1, 0.334087019303, 0.6205874894},
+     {ATOM_TYPE_NH1, ATOM_TYPE_CPT, 1, 0.303796462886, 0.588740986173},
+     {ATOM_TYPE_NH1, ATOM_TYPE_CY, 1, 0.315378146222, 0.505554643535},
+     {ATOM_TYPE_NH1, ATOM_TYPE_CAI, 1, 0.315378146222, 0.505554643535},
+     {ATOM_TYPE_NH1, ATOM_TYPE_H, 1, 0.158089977534, 0.401315181871},
+     {ATOM_TYPE_NH1, ATOM_TYPE_HA, 1, 0.255687932106, 0.277535162457},
+     {ATOM_TYPE_NH1, ATOM_TYPE_HB1, 1, 0.255687932106, 0.277535162457},
+     {ATOM_TYPE_NH1, ATOM_TYPE_HB2, 1, 0.257469729543, 0.313101890125},
+     {ATOM_TYPE_NH1, ATOM_TYPE_HE1, 1, 0.24945164108, 0.329448489449},
+     {ATOM_TYPE_NH1, ATOM_TYPE_HE2, 1, 0.250342539797, 0.301712530731},
+     {ATOM_TYPE_NH1, ATOM_TYPE_HC, 1, 0.158089977534, 0.401315181871},
+     {ATOM_TYPE_NH1, ATOM_TYPE_HR1, 1, 0.218270185945, 0.401315181871},
+     {ATOM_TYPE_NH1, ATOM_TYPE_HR2, 1, 0.200452211582, 0.401315181871},
+     {ATOM_TYPE_NH1, ATOM_TYPE_HR3, 1, 0.268873233135, 0.165254758963},
+     {ATOM_TYPE_NH1, ATOM_TYPE_HS, 1, 0.178179743628, 0.591706954497},
+     {ATOM_TYPE_NH1, ATOM_TYPE_HA1, 1, 0.257469729543, 0.396929091904},
+     {ATOM_TYPE_NH1, ATOM_TYPE_HA2, 1, 0.257469729543, 0.345021478752},
+     {ATOM_TYPE_NH1, ATOM_TYPE_HA3, 1, 0.257469729543, 0.289876023155},
+     {ATOM_TYPE_NH1, ATOM_TYPE_NC2, 1, 0.302905564168, 0.8368},
+     {ATOM_TYPE_NH1, ATOM_TYPE_NH2, 1, 0.302905564168, 0.8368},
+     {ATOM_TYPE_NH1, ATOM_TYPE_NH3, 1, 0.302905564168, 0.8368},
+     {ATOM_TYPE_NH1, ATOM_TYPE_NP, 1, 0.302905564168, 0.8368},
+     {ATOM_TYPE_NH1, ATOM_TYPE_NR1, 1, 0.302905564168, 0.8368},
+     {ATOM_TYPE_NH1, ATOM_TYPE_NR2, 1, 0.302905564168, 0.8368},
+     {ATOM_TYPE_NH1, ATOM_TYPE_NR3, 1, 0.302905564168, 0.8368},
+     {ATOM_TYPE_NH1, ATOM_TYPE_NY, 1, 0.302905564168, 0.8368},
+     {ATOM_TYPE_NH1, ATOM_TYPE_OC, 1, 0.289542083396, 0.648182492821},
+     {ATOM_TYPE_NH1, ATOM_TYPE_OH1, 1, 0.295778374423, 0.729745256593},
+     {ATOM_TYPE_NH1, ATOM_TYPE_OS, 1, 0.295778374423, 0.729745256593},
+     {ATOM_TYPE_NH1, ATOM_TYPE_S, 1, 0.31626904494, 1.2552},
+     {ATOM_TYPE_NH1, ATOM_TYPE_SM, 1, 0.314041798145, 1.15344919957},
+     {ATOM_TYPE_NH1, ATOM_TYPE_SS, 1, 0.334087019303, 1.2827901091},
+     {ATOM_TYPE_O, ATOM_TYPE_O, 1, 0.249451641079, 0.50208},
+     {ATOM_TYPE_O, ATOM_TYPE_OB, 1, 0.249451641079, 0.50208},
+     {ATOM_TYPE_O, ATOM_TYPE_C, 1, 0.302905564167, 0.480705002262},
+     {ATOM_TYPE_O, ATOM_TYPE_CA, 1, 0.302228481142, 0.383469934154},
+     {ATOM_TYPE_O, ATOM_TYPE_CC, 1, 0.302905564167, 0.383469934154},
+     {ATOM_TYPE_O, ATOM_TYPE_CD, 1, 0.302905564167, 0.383469934154},
+     {ATOM_TYPE_O, ATOM_TYPE_CE1, 1, 0.310923652631, 0.377952093472},
+     {ATOM_TYPE_O, ATOM_TYPE_CE2, 1, 0.310032753913, 0.366667388896},
+     {ATOM_TYPE_O, ATOM_TYPE_CPH1, 1, 0.285087589805, 0.324091246411},
+     {ATOM_TYPE_O, ATOM_TYPE_CPH2, 1, 0.285087589805, 0.324091246411},
+     {ATOM_TYPE_O, ATOM_TYPE_CS, 1, 0.320723538531, 0.480705002262},
+     {ATOM_TYPE_O, ATOM_TYPE_CPT, 1, 0.290432982113, 0.456036806936},
+     {ATOM_TYPE_O, ATOM_TYPE_CY, 1, 0.30201466545, 0.391600943002},
+     {ATOM_TYPE_O, ATOM_TYPE_CAI, 1, 0.30201466545, 0.391600943002},
+     {ATOM_TYPE_O, ATOM_TYPE_H, 1, 0.144726496762, 0.310857403193},
+     {ATOM_TYPE_O, ATOM_TYPE_HA, 1, 0.242324451334, 0.214977812437},
+     {ATOM_TYPE_O, ATOM_TYPE_HB1, 1, 0.242324451334, 0.214977812437},
+     {ATOM_TYPE_O, ATOM_TYPE_HB2, 1, 0.24410624877, 0.242527681224},
+     {ATOM_TYPE_O, ATOM_TYPE_HE1, 1, 0.236088160307, 0.255189702614},
+     {ATOM_TYPE_O, ATOM_TYPE_HE2, 1, 0.236979059025, 0.233705521373},
+     {ATOM_TYPE_O, ATOM_TYPE_HC, 1, 0.144726496762, 0.310857403193},
+     {ATOM_TYPE_O, ATOM_TYPE_HR1, 1, 0.204906705172, 0.310857403193},
+     {ATOM_TYPE_O, ATOM_TYPE_HR2, 1, 0.18708873081, 0.310857403193},
+     {ATOM_TYPE_O, ATOM_TYPE_HR3, 1, 0.255509752363, 0.128005785869},
+     {ATOM_TYPE_O, ATOM_TYPE_HS, 1, 0.164816262856, 0.45833423612},
+     {ATOM_TYPE_O, ATOM_TYPE_HA1, 1, 0.24410624877, 0.307459952514},
+     {ATOM_TYPE_O, ATOM_TYPE_HA2, 1, 0.24410624877, 0.267252488258},
+     {ATOM_TYPE_O, ATOM_TYPE_HA3, 1, 0.24410624877, 0.224537002029},
+     {ATOM_TYPE_O, ATOM_TYPE_NC2, 1, 0.289542083396, 0.648182492821},
+     {ATOM_TYPE_O, ATOM_TYPE_NH2, 1, 0.289542083396, 0.648182492821},
+     {ATOM_TYPE_O, ATOM_TYPE_NH3, 1, 0.289542083396, 0.648182492821},
+     {ATOM_TYPE_O, ATOM_TYPE_NP, 1, 0.289542083396, 0.648182492821},
+     {ATOM_TYPE_O, ATOM_TYPE_NR1, 1, 0.289542083396, 0.648182492821},
+     {ATOM_TYPE_O, ATOM_TYPE_NR2, 1, 0.289542083396, 0.648182492821},
+     {ATOM_TYPE_O, ATOM_TYPE_NR3, 1, 0.289542083396, 0.648182492821},
+     {ATOM_TYPE_O, ATOM_TYPE_NY, 1, 0.289542083396, 0.648182492821},
+     {ATOM_TYPE_O, ATOM_TYPE_OC, 1, 0.276178602624, 0.50208},
+     {ATOM_TYPE_O, ATOM_TYPE_OH1, 1, 0.28241489365, 0.565258245152},
+     {ATOM_TYPE_O, ATOM_TYPE_OS, 1, 0.28241489365, 0.565258245152},
+     {ATOM_TYPE_O, ATOM_TYPE_S, 1, 0.302905564167, 0.972273739232},
+     {ATOM_TYPE_O, ATOM_TYPE_SM, 1, 0.300678317372, 0.89345790813},
+     {ATOM_TYPE_O, ATOM_TYPE_SS, 1, 0.320723538531, 0.993644945843},
+     {ATOM_TYPE_OB, ATOM_TYPE_OB, 1, 0.249451641079, 0.50208},
+     {ATOM_TYPE_OB, ATOM_TYPE_C, 1, 0.302905564167, 0.480705002262},
+     {ATOM_TYPE_OB, ATOM_TYPE_CA, 1, 0.302228481142, 0.383469934154},
+     {ATOM_TYPE_OB, ATOM_TYPE_CC, 1, 0.302905564167, 0.383469934154},
+     {ATOM_TYPE_OB, ATOM_TYPE_CD, 1, 0.302905564167, 0.383469934154},
+     {ATOM_TYPE_OB, ATOM_TYPE_CE1, 1, 0.310923652631, 0.377952093472},
+     {ATOM_TYPE_OB, ATOM_TYPE_CE2, 1, 0.310032753913, 0.366667388896},
+     {ATOM_TYPE_OB, ATOM_TYPE_CPH1, 1, 0.285087589805, 0.324091246411},
+     {ATOM_TYPE_OB, ATOM_TYPE_CPH2, 1, 0.285087589805, 0.324091246411},
+     {ATOM_TYPE_OB, ATOM_TYPE_CS, 1, 0.320723538531, 0.480705002262},
+     {ATOM_TYPE_OB, ATOM_TYPE_CPT, 1, 0.290432982113, 0.456036806936},
+     {ATOM_TYPE_OB, ATOM_TYPE_CY, 1, 0.30201466545, 0.391600943002},
+     {ATOM_TYPE_OB, ATOM_TYPE_CAI, 1, 0.30201466545, 0.391600943002},
+     {ATOM_TYPE_OB, ATOM_TYPE_H, 1, 0.144726496762, 0.310857403193},
+     {ATOM_TYPE_OB, ATOM_TYPE_HA, 1, 0.242324451334, 0.214977812437},
+     {ATOM_TYPE_OB, ATOM_TYPE_HB1, 1, 0.242324451334, 0.214977812437},
+     {ATOM_TYPE_OB, ATOM_TYPE_HB2, 1, 0.24410624877, 0.242527681224},
+     {ATOM_TYPE_OB, ATOM_TYPE_HE1, 1, 0.236088160307, 0.255189702614},
+     {ATOM_TYPE_OB, ATOM_TYPE_HE2, 1, 0.236979059025, 0.233705521373},
+     {ATOM_TYPE_OB, ATOM_TYPE_HC, 1, 0.144726496762, 0.310857403193},
+     {ATOM_TYPE_OB, ATOM_TYPE_HR1, 1, 0.204906705172, 0.310857403193},
+     {ATOM_TYPE_OB, ATOM_TYPE_HR2, 1, 0.18708873081, 0.310857403193},
+     {ATOM_TYPE_OB, ATOM_TYPE_HR3, 1, 0.255509752363, 0.128005785869},
+     {ATOM_TYPE_OB, ATOM_TYPE_HS, 1, 0.164816262856, 0.45833423612},
+     {ATOM_TYPE_OB, ATOM_TYPE_HA1, 1, 0.24410624877, 0.307459952514},
+     {ATOM_TYPE_OB, ATOM_TYPE_HA2, 1, 0.24410624877, 0.267252488258},
+     {ATOM_TYPE_OB, ATOM_TYPE_HA3, 1, 0.24410624877, 0.224537002029},
+     {ATOM_TYPE_OB, ATOM_TYPE_NC2, 1, 0.289542083396, 0.648182492821},
+     {ATOM_TYPE_OB, ATOM_TYPE_NH2, 1, 0.289542083396, 0.648182492821},
+     {ATOM_TYPE_OB, ATOM_TYPE_NH3, 1, 0.289542083396, 0.648182492821},
+     {ATOM_TYPE_OB, ATOM_TYPE_NP, 1, 0.289542083396, 0.648182492821},
+     {ATOM_TYPE_OB, ATOM_TYPE_NR1, 1, 0.289542083396, 0.648182492821},
+     {ATOM_TYPE_OB, ATOM_TYPE_NR2, 1, 0.289542083396, 0.648182492821},
+     {ATOM_TYPE_OB, ATOM_TYPE_NR3, 1, 0.289542083396, 0.648182492821},
+     {ATOM_TYPE_OB, ATOM_TYPE_NY, 1, 0.289542083396, 0.648182492821},
+     {ATOM_TYPE_OB, ATOM_TYPE_OC, 1, 0.276178602624, 0.50208},
+     {ATOM_TYPE_OB, ATOM_TYPE_OH1, 1, 0.28241489365, 0.565258245152},
+     {ATOM_TYPE_OB, ATOM_TYPE_OS, 1, 0.28241489365, 0.565258245152},
+     {ATOM_TYPE_OB, ATOM_TYPE_S, 1, 0.302905564167, 0.972273739232},
+     {ATOM_TYPE_OB, ATOM_TYPE_SM, 1, 0.300678317372, 0.89345790813},
+     {ATOM_TYPE_OB, ATOM_TYPE_SS, 1, 0.320723538531, 0.993644945843},
+};
+
+} // End namespace charmm_parameters
+
+#endif
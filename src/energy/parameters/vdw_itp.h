@@ -1,83 +0,0 @@
-// vdw_itp.h --- std::string'ed version of vdw.itp
-// Copyright (C) 2014 Anders S. Christensen
-// Copyright (c) 1991-2000, University of Groningen, The Netherlands.
-// Copyright (c) 2001-2004, The GROMACS development team,
-//
-// This file is part of Phaistos
-//
-// Phaistos is free software: you can redistribute it and/or modify
-// it under the terms of the GNU General Public License as published by
-// the Free Software Foundation, either version 3 of the License, or
-// (at your option) any later version.
-//
-// Phaistos is distributed in the hope that it will be useful,
-// but WITHOUT ANY WARRANTY; without even the implied warranty of
-// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
-// GNU General Public License for more details.
-//
-// You should have received a copy of the GNU General Public License
-// along with Phaistos.  If not, see <http://www.gnu.org/licenses/>.
-//
-
-#ifndef TERM_CHARMM_VDW_ITP_H
-#define TERM_CHARMM_VDW_ITP_H
-
-namespace charmm_constants {
-
-const static std::string vdw_itp = "C	17	12.01100	0.51	A	0.356359487256	0.46024 \n\
-CA	17	12.01100	-0.115	A	0.355005321205	0.29288 \n\
-CC	17	12.01100	1.00	A	0.356359487256	0.29288 \n\
-CD	17	12.01100	0.75	A	0.356359487256	0.29288 \n\
-CE1	17	12.01100	0.000	A	0.372395664183	0.284512 \n\
-CE2	17	12.01100	0.000	A	0.370613866746	0.267776 \n\
-CP1	17	12.01100	0.02	A	0.405358916754	0.08368 \n\
-CP2	17	12.01100	-0.18	A	0.387540942391	0.23012 \n\
-CP3	17	12.01100	0.00	A	0.387540942391	0.23012 \n\
-CPH1	17	12.01100	0.05	A	0.320723538531	0.2092 \n\
-CPH2	17	12.01100	0.10	A	0.320723538531	0.2092 \n\
-CS	17	12.01100	0.000	A	0.391995435982	0.46024 \n\
-CPT	17	12.01100	0.11	A	0.331414323148	0.414216 \n\
-CY	17	12.01100	-0.03	A	0.35457768982	0.305432 \n\
-CAI	17	12.01100	-0.27	A	0.35457768982	0.305432 \n\
-CT	17	12.01100	0.000	A	0.405358916754	0.08368 \n\
-CT1	17	12.01100	0.07	A	0.356359487256	0.133888 \n\
-CT2	17	12.01100	-0.18	A	0.358141284692	0.234304 \n\
-CT2A	17	12.01100	-0.10	A	0.358141284692	0.234304 \n\
-CT3	17	12.01100	-0.11	A	0.363486677001	0.326352 \n\
-H	1	1.00800	0.31	A	0.0400013524445	0.192464 \n\
-HA	1	1.00800	0.000	A	0.235197261589	0.092048 \n\
-HB1	1	1.00800	0.09	A	0.235197261589	0.092048 \n\
-HB2	1	1.00800	0.09	A	0.238760856462	0.117152 \n\
-HE1	1	1.00800	0.000	A	0.222724679535	0.129704 \n\
-HE2	1	1.00800	0.000	A	0.224506476971	0.108784 \n\
-HC	1	1.00800	0.30	A	0.0400013524445	0.192464 \n\
-HP	1	1.00800	0.115	A	0.242003727796	0.12552 \n\
-HR1	1	1.00800	0.00	A	0.160361769265	0.192464 \n\
-HR2	1	1.00800	0.00	A	0.12472582054	0.192464 \n\
-HR3	1	1.00800	0.09	A	0.261567863646	0.0326352 \n\
-HS	1	1.00800	0.16	A	0.0801808846326	0.4184 \n\
-HA1	1	1.00800	0.09	A	0.238760856462	0.18828 \n\
-HA2	1	1.00800	0.09	A	0.238760856462	0.142256 \n\
-HA3	1	1.00800	0.09	A	0.238760856462	0.100416 \n\
-N	7	14.00700	-0.29	A	0.329632525712	0.8368 \n\
-NC2	7	14.00700	-0.121	A	0.329632525712	0.8368 \n\
-NH1	7	14.00700	-0.47	A	0.329632525712	0.8368 \n\
-NH2	7	14.00700	-0.62	A	0.329632525712	0.8368 \n\
-NH3	7	14.00700	-0.90	A	0.329632525712	0.8368 \n\
-NP	7	14.00700	0.000	A	0.329632525712	0.8368 \n\
-NR1	7	14.00700	-0.36	A	0.329632525712	0.8368 \n\
-NR2	7	14.00700	-0.70	A	0.329632525712	0.8368 \n\
-NR3	7	14.00700	-0.55	A	0.329632525712	0.8368 \n\
-NY	7	14.00700	-0.51	A	0.329632525712	0.8368 \n\
-O	8	15.99940	-0.51	A	0.302905564168	0.50208 \n\
-OB	8	15.99940	-0.55	A	0.302905564168	0.50208 \n\
-OC	8	15.99940	-0.50	A	0.302905564168	0.50208 \n\
-OH1	8	15.99940	-0.54	A	0.315378146222	0.6363864 \n\
-OS	8	15.99940	0.000	A	0.315378146222	0.6363864 \n\
-S	16	32.06000	-0.09	A	0.356359487256	1.8828 \n\
-SM	16	32.06000	0.000	A	0.351904993665	1.58992 \n\
-SS	16	32.06000	0.000	A	0.391995435982	1.96648 \n";
-
-}
-
-#endif
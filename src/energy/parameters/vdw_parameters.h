@@ -0,0 +1,102 @@
+// vdw_parameters.h --- Typed table of the parameters in vdw.itp
+// Generated by generate_parameter_tables.cmake from vdw.itp. Do not edit.
+// Copyright (C) 2026 agent
+// Copyright (c) 1991-2000, University of Groningen, The Netherlands.
+// Copyright (c) 2001-2004, The GROMACS development team,
+//
+// This file is part of Phaistos
+//
+// Phaistos is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Phaistos is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Phaistos.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+#ifndef TERM_CHARMM_VDW_PARAMETERS_H
+#define TERM_CHARMM_VDW_PARAMETERS_H
+
+#include "atom_types.h"
+
+namespace charmm_parameters {
+
+//! Non-bonded parameters (from vdw.itp)
+struct NonBondedRecord {
+     AtomTypeId atom_type;
+     unsigned int atom_number;
+     double atom_mass;
+     const char * atom_ptype;
+     double sigma;
+     double epsilon;
+};
+
+//! Number of entries in non_bonded_parameters
+const unsigned int N_NON_BONDED_PARAMETERS = 53;
+
+//! Non-bonded parameters (from vdw.itp)
+const NonBondedRecord non_bonded_parameters[N_NON_BONDED_PARAMETERS] = {
+     {ATOM_TYPE_C, 17, 12.01100, "A", 0.356359487256, 0.46024},
+     {ATOM_TYPE_CA, 17, 12.01100, "A", 0.355005321205, 0.29288},
+     {ATOM_TYPE_CC, 17, 12.01100, "A", 0.356359487256, 0.29288},
+     {ATOM_TYPE_CD, 17, 12.01100, "A", 0.356359487256, 0.29288},
+     {ATOM_TYPE_CE1, 17, 12.01100, "A", 0.372395664183, 0.284512},
+     {ATOM_TYPE_CE2, 17, 12.01100, "A", 0.370613866746, 0.267776},
+     {ATOM_TYPE_CP1, 17, 12.01100, "A", 0.405358916754, 0.08368},
+     {ATOM_TYPE_CP2, 17, 12.01100, "A", 0.387540942391, 0.23012},
+     {ATOM_TYPE_CP3, 17, 12.01100, "A", 0.387540942391, 0.23012},
+     {ATOM_TYPE_CPH1, 17, 12.01100, "A", 0.320723538531, 0.2092},
+     {ATOM_TYPE_CPH2, 17, 12.01100, "A", 0.320723538531, 0.2092},
+     {ATOM_TYPE_CS, 17, 12.01100, "A", 0.391995435982, 0.46024},
+     {ATOM_TYPE_CPT, 17, 12.01100, "A", 0.331414323148, 0.414216},
+     {ATOM_TYPE_CY, 17, 12.01100, "A", 0.35457768982, 0.305432},
+     {ATOM_TYPE_CAI, 17, 12.01100, "A", 0.35457768982, 0.305432},
+     {ATOM_TYPE_CT, 17, 12.01100, "A", 0.405358916754, 0.08368},
+     {ATOM_TYPE_CT1, 17, 12.01100, "A", 0.356359487256, 0.133888},
+     {ATOM_TYPE_CT2, 17, 12.01100, "A", 0.358141284692, 0.234304},
+     {ATOM_TYPE_CT2A, 17, 12.01100, "A", 0.358141284692, 0.234304},
+     {ATOM_TYPE_CT3, 17, 12.01100, "A", 0.363486677001, 0.326352},
+     {ATOM_TYPE_H, 1, 1.00800, "A", 0.0400013524445, 0.192464},
+     {ATOM_TYPE_HA, 1, 1.00800, "A", 0.235197261589, 0.092048},
+     {ATOM_TYPE_HB1, 1, 1.00800, "A", 0.235197261589, 0.092048},
+     {ATOM_TYPE_HB2, 1, 1.00800, "A", 0.238760856462, 0.117152},
+     {ATOM_TYPE_HE1, 1, 1.00800, "A", 0.222724679535, 0.129704},
+     {ATOM_TYPE_HE2, 1, 1.00800, "A", 0.224506476971, 0.108784},
+     {ATOM_TYPE_HC, 1, 1.00800, "A", 0.0400013524445, 0.192464},
+     {ATOM_TYPE_HP, 1, 1.00800, "A", 0.242003727796, 0.12552},
+     {ATOM_TYPE_HR1, 1, 1.00800, "A", 0.160361769265, 0.192464},
+     {ATOM_TYPE_HR2, 1, 1.00800, "A", 0.12472582054, 0.192464},
+     {ATOM_TYPE_HR3, 1, 1.00800, "A", 0.261567863646, 0.0326352},
+     {ATOM_TYPE_HS, 1, 1.00800, "A", 0.0801808846326, 0.4184},
+     {ATOM_TYPE_HA1, 1, 1.00800, "A", 0.238760856462, 0.18828},
+     {ATOM_TYPE_HA2, 1, 1.00800, "A", 0.238760856462, 0.142256},
+     {ATOM_TYPE_HA3, 1, 1.00800, "A", 0.238760856462, 0.100416},
+     {ATOM_TYPE_N, 7, 14.00700, "A", 0.329632525712, 0.8368},
+     {ATOM_TYPE_NC2, 7, 14.00700, "A", 0.329632525712, 0.8368},
+     {ATOM_TYPE_NH1, 7, 14.00700, "A", 0.329632525712, 0.8368},
+     {ATOM_TYPE_NH2, 7, 14.00700, "A", 0.329632525712, 0.8368},
+     {ATOM_TYPE_NH3, 7, 14.00700, "A", 0.329632525712, 0.8368},
+     {ATOM_TYPE_NP, 7, 14.00700, "A", 0.329632525712, 0.8368},
+     {ATOM_TYPE_NR1, 7, 14.00700, "A", 0.329632525712, 0.8368},
+     {ATOM_TYPE_NR2, 7, 14.00700, "A", 0.329632525712, 0.8368},
+     {ATOM_TYPE_NR3, 7, 14.00700, "A", 0.329632525712, 0.8368},
+     {ATOM_TYPE_NY, 7, 14.00700, "A", 0.329632525712, 0.8368},
+     {ATOM_TYPE_O, 8, 15.99940, "A", 0.302905564168, 0.50208},
+     {ATOM_TYPE_OB, 8, 15.99940, "A", 0.302905564168, 0.50208},
+     {ATOM_TYPE_OC, 8, 15.99940, "A", 0.302905564168, 0.50208},
+     {ATOM_TYPE_OH1, 8, 15.99940, "A", 0.315378146222, 0.6363864},
+     {ATOM_TYPE_OS, 8, 15.99940, "A", 0.315378146222, 0.6363864},
+     {ATOM_TYPE_S, 16, 32.06000, "A", 0.356359487256, 1.8828},
+     {ATOM_TYPE_SM, 16, 32.06000, "A", 0.351904993665, 1.58992},
+     {ATOM_TYPE_SS, 16, 32.06000, "A", 0.391995435982, 1.96648},
+};
+
+} // End namespace charmm_parameters
+
+#endif
@@ -0,0 +1,153 @@
+// bond_graph.h -- Covalent bond graph of a chain
+// Copyright (C) 2026 agent
+//
+// This file is part of PHAISTOS
+//
+// PHAISTOS is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// PHAISTOS is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Phaistos.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+#ifndef TERM_BOND_GRAPH_H
+#define TERM_BOND_GRAPH_H
+
+#include <vector>
+#include <map>
+#include <algorithm>
+
+namespace topology {
+
+//! Number of bonds within which atom pairs are excluded or treated as 1-4 pairs
+const unsigned int BOND_GRAPH_DEPTH = 3;
+
+//! Covalent bond graph of a chain. Atoms are identified by their position in
+//! chain iteration order (the order of generate_atom_type_infos() and of a new
+//! CoordinateBuffer). The atoms within BOND_GRAPH_DEPTH bonds of each atom are
+//! found once by breadth-first search, so the number of bonds between two
+//! atoms (as by chain_distance()) is a lookup in a short list.
+class BondGraph {
+
+     //! Index of each atom
+     std::map<phaistos::Atom *, unsigned int> index_map;
+
+public:
+
+     //! Atoms in chain iteration order
+     std::vector<phaistos::Atom *> atoms;
+
+     //! Index of the first atom of each residue (followed by the number of atoms)
+     std::vector<unsigned int> residue_begin;
+
+     //! Atoms bonded to each atom (in CovalentBondIterator order)
+     std::vector<std::vector<unsigned int> > bonded;
+
+     //! Atoms within BOND_GRAPH_DEPTH bonds of each atom (except the atom itself),
+     //! sorted by index, with the number of bonds between them
+     std::vector<std::vector<std::pair<unsigned int, unsigned int> > > neighbours;
+
+     //! Default constructor
+     BondGraph() {}
+
+     //! Constructor
+     //! \param chain Molecule chain
+     BondGraph(phaistos::ChainFB *chain) {
+
+          using namespace phaistos;
+
+          for (AtomIterator<ChainFB, definitions::ALL> it(*chain); !it.end(); ++it) {
+               this->index_map[&*it] = this->atoms.size();
+               this->atoms.push_back(&*it);
+          }
+
+          const unsigned int n_atoms = this->atoms.size();
+
+          this->residue_begin.assign(chain->size() + 1, n_atoms);
+          for (unsigned int i = n_atoms; i > 0; i--) {
+               this->residue_begin[this->atoms[i-1]->residue->index] = i-1;
+          }
+
+          this->bonded.resize(n_atoms);
+          for (unsigned int i = 0; i < n_atoms; i++) {
+               for (CovalentBondIterator<ChainFB> it(this->atoms[i], CovalentBondIterator<ChainFB>::DEPTH_1_ONLY);
+                    !it.end(); ++it) {
+                    this->bonded[i].push_back(get_index(&*it));
+               }
+          }
+
+          // Breadth-first search to BOND_GRAPH_DEPTH bonds from each atom
+          std::vector<unsigned int> distance(n_atoms, BOND_GRAPH_DEPTH + 1);
+          std::vector<unsigned int> queue;
+
+          this->neighbours.resize(n_atoms);
+          for (unsigned int i = 0; i < n_atoms; i++) {
+
+               queue.clear();
+               queue.push_back(i);
+               distance[i] = 0;
+
+               for (unsigned int k = 0; k < queue.size(); k++) {
+
+                    const unsigned int atom = queue[k];
+                    if (distance[atom] == BOND_GRAPH_DEPTH)
+                         continue;
+
+                    for (unsigned int l = 0; l < this->bonded[atom].size(); l++) {
+
+                         const unsigned int next = this->bonded[atom][l];
+                         if (distance[next] <= BOND_GRAPH_DEPTH)
+                              continue;
+
+                         distance[next] = distance[atom] + 1;
+                         queue.push_back(next);
+                    }
+               }
+
+               for (unsigned int k = 1; k < queue.size(); k++) {
+                    this->neighbours[i].push_back(std::make_pair(queue[k], distance[queue[k]]));
+               }
+               std::sort(this->neighbours[i].begin(), this->neighbours[i].end());
+
+               for (unsigned int k = 0; k < queue.size(); k++) {
+                    distance[queue[k]] = BOND_GRAPH_DEPTH + 1;
+               }
+          }
+     }
+
+     //! Index of an atom
+     //! \param atom Atom in the chain
+     //! \returns Position of the atom in chain iteration order
+     unsigned int get_index(phaistos::Atom *atom) const {
+          return this->index_map.find(atom)->second;
+     }
+
+     //! Number of bonds between two atoms
+     //! \param index1 Index of first atom
+     //! \param index2 Index of second atom
+     //! \returns Number of bonds (BOND_GRAPH_DEPTH+1 if the atoms are further apart)
+     unsigned int get_distance(const unsigned int index1, const unsigned int index2) const {
+
+          if (index1 == index2)
+               return 0;
+
+          const std::vector<std::pair<unsigned int, unsigned int> > &list = this->neighbours[index1];
+          std::vector<std::pair<unsigned int, unsigned int> >::const_iterator it
+               = std::lower_bound(list.begin(), list.end(), std::make_pair(index2, 0u));
+
+          if (it == list.end() || it->first != index2)
+               return BOND_GRAPH_DEPTH + 1;
+          return it->second;
+     }
+};
+
+} // End namespace topology
+
+#endif
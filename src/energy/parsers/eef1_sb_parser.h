@@ -21,11 +21,15 @@
 #define EEF1_SB_PARSER_H
 
 #include <string>
+#include <map>
+#include <vector>
 #include <math.h>
 
 #include <boost/type_traits/is_base_of.hpp>
+#include <boost/thread/mutex.hpp>
 #include "energy/energy_term.h"
 #include "protein/iterators/pair_iterator_chaintree.h"
+#include "../parameters/atom_types.h"
 
 namespace eef1_sb_parser {
 
@@ -33,17 +37,16 @@ namespace eef1_sb_parser {
 // as implemented in CHARMM ... note that these are slightly
 // different that the atom types defined in CHARMM36 in Gromacs.
 
-//! Returns the atom type according to the CHARMM36-EEF1-SB force field    
-//! \param atom Pointer the atom for which the type is to be determined
-//! \returns A string with the CHARMM36-EEF1-SB atom type
-std::string get_atom_type(const phaistos::Atom *atom) {
+//! Sets the atom types of a residue according to the CHARMM36-EEF1-SB force field.
+//! The types only depend on the residue type, the terminal status and which of
+//! the protons HD1, HD2, HE1 and HE2 are present (see get_residue_template_key()).
+//! \param res Pointer to the residue
+//! \param atom_map Map from atom to CHARMM36-EEF1-SB atom type
+void set_atom_types(phaistos::Residue *res, std::map<phaistos::definitions::AtomEnum, std::string> &atom_map) {
 
     using namespace phaistos;
     using namespace definitions;
 
-    Residue *res = atom->residue;
-    std::map<AtomEnum, std::string> atom_map;
-
     switch (res->residue_type) {
     case definitions::ALA:
         atom_map[N]   = "NH1";
@@ -497,11 +500,11 @@ std::string get_atom_type(const phaistos::Atom *atom) {
         break;
 
     default:
-        std::cout << "ASC: Unknown residue type: " << atom->residue << std::endl;
+        std::cout << "ASC: Unknown residue type: " << res << std::endl;
         break;
     };
 
-    if (atom->residue->terminal_status == NTERM) {
+    if (res->terminal_status == NTERM) {
         switch (res->residue_type) {
         case GLY:
             atom_map[N]    = "NH3";
@@ -538,31 +541,23 @@ std::string get_atom_type(const phaistos::Atom *atom) {
         }
     }
 
-    if (atom->residue->terminal_status == CTERM) {
+    if (res->terminal_status == CTERM) {
         atom_map[C]    = "CC";
         atom_map[O]    = "OC";
         atom_map[OXT]  = "OC";
     }
-
-
-    if (atom_map.count(atom->atom_type) < 1)
-        std::cout << "ASC: NOT found atom: " << atom << std::endl;
-
-    return atom_map[atom->atom_type];
-
 }
 
-//! Returns the atom charge according to the CHARMM36-EEF1-SB force field    
-//! \param atom Pointer the atom for which the charge is to be determined
-//! \returns A double containing the CHARMM36-EEF1-SB atom charge
-double get_atom_charge(phaistos::Atom *atom) {
+//! Sets the atom charges of a residue according to the CHARMM36-EEF1-SB force field.
+//! Like the atom types, the charges only depend on the key of the residue
+//! (see get_residue_template_key()).
+//! \param res Pointer to the residue
+//! \param atom_map Map from atom to CHARMM36-EEF1-SB atom charge
+void set_atom_charges(phaistos::Residue *res, std::map<phaistos::definitions::AtomEnum, double> &atom_map) {
 
     using namespace phaistos;
     using namespace definitions;
 
-    Residue *res = atom->residue;
-    std::map<AtomEnum, double> atom_map;
-
     switch (res->residue_type) {
     case definitions::ALA:
         atom_map[N]   = -0.47;
@@ -1062,13 +1057,13 @@ double get_atom_charge(phaistos::Atom *atom) {
         break;
 
     default:
-        std::cout << "ASC: Unknown residue type: " << atom->residue << std::endl;
+        std::cout << "ASC: Unknown residue type: " << res << std::endl;
         break;
     };
 
 
     // Neutral NTERM is currently not supported in Phaistos.
-    if (atom->residue->terminal_status == NTERM) {
+    if (res->terminal_status == NTERM) {
         switch (res->residue_type) {
         case GLY:
             atom_map[N]    = -0.9;
@@ -1098,19 +1093,208 @@ double get_atom_charge(phaistos::Atom *atom) {
     }
 
     // Neutral CTERM is currently not supported in Phaistos.
-    if (atom->residue->terminal_status == CTERM) {
+    if (res->terminal_status == CTERM) {
         atom_map[C]    = 1.0;
         atom_map[O]    = -0.5;
         atom_map[OXT]  = -0.5;
     }
+}
+
+//! Optional protons which select the protonation state of ASP, GLU and HIS
+enum ProtonationFlag {
+    PROTONATED_HD1 = 1,
+    PROTONATED_HD2 = 2,
+    PROTONATED_HE1 = 4,
+    PROTONATED_HE2 = 8
+};
+
+//! Key of the atom types and charges of a residue: residue type, terminal
+//! status and protonation state (these are all that set_atom_types() and
+//! set_atom_charges() depend on).
+//! \param res Pointer to the residue
+//! \returns Key
+unsigned int get_residue_template_key(phaistos::Residue *res) {
+
+    using namespace phaistos;
+    using namespace definitions;
+
+    unsigned int protonation = 0;
+    if (res->has_atom(HD1)) protonation |= PROTONATED_HD1;
+    if (res->has_atom(HD2)) protonation |= PROTONATED_HD2;
+    if (res->has_atom(HE1)) protonation |= PROTONATED_HE1;
+    if (res->has_atom(HE2)) protonation |= PROTONATED_HE2;
+
+    return (((unsigned int)res->residue_type) << 8) | (((unsigned int)res->terminal_status) << 4) | protonation;
+}
+
+//! Atom type IDs and charges of all residues with the same key, indexed by AtomEnum
+struct ResidueTemplate {
+
+    //! Atom type IDs (N_ATOM_TYPES for atoms without a type)
+    charmm_parameters::AtomTypeId atom_type_ids[phaistos::definitions::ATOM_ENUM_SIZE];
+
+    //! Atom charges
+    double charges[phaistos::definitions::ATOM_ENUM_SIZE];
+
+    //! Whether the charge of an atom is defined
+    bool has_charge[phaistos::definitions::ATOM_ENUM_SIZE];
+};
+
+//! Make the atom type and charge tables of a residue
+//! \param res Pointer to the residue
+//! \returns Residue template
+ResidueTemplate make_residue_template(phaistos::Residue *res) {
+
+    using namespace phaistos;
+    using namespace definitions;
+
+    std::map<AtomEnum, std::string> atom_types;
+    set_atom_types(res, atom_types);
+
+    std::map<AtomEnum, double> atom_charges;
+    set_atom_charges(res, atom_charges);
+
+    ResidueTemplate residue_template;
+    std::fill(residue_template.atom_type_ids, residue_template.atom_type_ids + ATOM_ENUM_SIZE,
+              charmm_parameters::N_ATOM_TYPES);
+    std::fill(residue_template.charges, residue_template.charges + ATOM_ENUM_SIZE, 0.0);
+    std::fill(residue_template.has_charge, residue_template.has_charge + ATOM_ENUM_SIZE, false);
+
+    for (std::map<AtomEnum, std::string>::const_iterator it = atom_types.begin(); it != atom_types.end(); ++it) {
+        residue_template.atom_type_ids[it->first]
+            = (charmm_parameters::AtomTypeId)charmm_parameters::get_atom_type_id(it->second);
+    }
+
+    for (std::map<AtomEnum, double>::const_iterator it = atom_charges.begin(); it != atom_charges.end(); ++it) {
+        residue_template.charges[it->first] = it->second;
+        residue_template.has_charge[it->first] = true;
+    }
+
+    return residue_template;
+}
+
+//! Returns the (shared) atom type and charge tables of a residue.
+//! The tables are made the first time a residue with the same key is seen,
+//! under a lock since terms in different threads can be set up at the same time.
+//! Templates are never removed, so the returned pointer stays valid.
+//! \param res Pointer to the residue
+//! \returns Residue template
+const ResidueTemplate *get_residue_template(phaistos::Residue *res) {
+
+    static std::map<unsigned int, ResidueTemplate> residue_templates;
+    static boost::mutex residue_templates_mutex;
+
+    const unsigned int key = get_residue_template_key(res);
+
+    boost::mutex::scoped_lock lock(residue_templates_mutex);
+
+    std::map<unsigned int, ResidueTemplate>::iterator it = residue_templates.find(key);
+    if (it == residue_templates.end()) {
+        it = residue_templates.insert(std::make_pair(key, make_residue_template(res))).first;
+    }
 
-    if (atom_map.count(atom->atom_type) < 1) {
+    return &it->second;
+}
+
+//! Returns the atom type ID according to the CHARMM36-EEF1-SB force field
+//! \param atom Pointer the atom for which the type is to be determined
+//! \returns ID of the CHARMM36-EEF1-SB atom type (N_ATOM_TYPES if the atom has no type)
+charmm_parameters::AtomTypeId get_atom_type_id(const phaistos::Atom *atom) {
+
+    const charmm_parameters::AtomTypeId id = get_residue_template(atom->residue)->atom_type_ids[atom->atom_type];
+
+    if (id == charmm_parameters::N_ATOM_TYPES)
+        std::cout << "ASC: NOT found atom: " << atom << std::endl;
+
+    return id;
+}
+
+//! Returns the name of an atom type ID
+//! \param id Atom type ID
+//! \returns Name of the atom type (empty for N_ATOM_TYPES)
+std::string get_atom_type_name(const unsigned int id) {
+
+    if (id >= charmm_parameters::N_ATOM_TYPES)
+        return "";
+
+    return charmm_parameters::atom_type_names[id];
+}
+
+//! Returns the atom type according to the CHARMM36-EEF1-SB force field    
+//! \param atom Pointer the atom for which the type is to be determined
+//! \returns A string with the CHARMM36-EEF1-SB atom type
+std::string get_atom_type(const phaistos::Atom *atom) {
+    return get_atom_type_name(get_atom_type_id(atom));
+}
+
+//! Returns the atom charge according to the CHARMM36-EEF1-SB force field    
+//! \param atom Pointer the atom for which the charge is to be determined
+//! \returns A double containing the CHARMM36-EEF1-SB atom charge
+double get_atom_charge(const phaistos::Atom *atom) {
+
+    const ResidueTemplate *residue_template = get_residue_template(atom->residue);
+
+    if (!residue_template->has_charge[atom->atom_type]) {
         std::cout << "# EEF1-SB ERROR: No charges found for atom: " << atom << std::endl;
         exit(1);
     }
-    return atom_map[atom->atom_type];
-
+    return residue_template->charges[atom->atom_type];
 }
 
+
+//! Atom type IDs and charges of all atoms in a chain. The residue template
+//! of each residue is looked up once, after which the type and charge of
+//! an atom are array lookups.
+class ChainAtomTypes {
+
+    //! Residue template of each residue
+    std::vector<const ResidueTemplate *> residue_templates;
+
+public:
+
+    //! Default constructor
+    ChainAtomTypes() {}
+
+    //! Constructor
+    //! \param chain Molecule chain
+    ChainAtomTypes(phaistos::ChainFB *chain)
+        : residue_templates(chain->size(), (const ResidueTemplate *)NULL) {
+
+        using namespace phaistos;
+
+        for (ResidueIterator<ChainFB> it(*chain); !it.end(); ++it) {
+            this->residue_templates[it->index] = get_residue_template(&*it);
+        }
+    }
+
+    //! Atom type ID of an atom in the chain
+    //! \param atom Pointer to the atom
+    //! \returns ID of the CHARMM36-EEF1-SB atom type (N_ATOM_TYPES if the atom has no type)
+    charmm_parameters::AtomTypeId get_atom_type_id(const phaistos::Atom *atom) const {
+
+        const charmm_parameters::AtomTypeId id
+            = this->residue_templates[atom->residue->index]->atom_type_ids[atom->atom_type];
+
+        if (id == charmm_parameters::N_ATOM_TYPES)
+            std::cout << "ASC: NOT found atom: " << atom << std::endl;
+
+        return id;
+    }
+
+    //! Charge of an atom in the chain
+    //! \param atom Pointer to the atom
+    //! \returns CHARMM36-EEF1-SB atom charge
+    double get_atom_charge(const phaistos::Atom *atom) const {
+
+        const ResidueTemplate *residue_template = this->residue_templates[atom->residue->index];
+
+        if (!residue_template->has_charge[atom->atom_type]) {
+            std::cout << "# EEF1-SB ERROR: No charges found for atom: " << atom << std::endl;
+            exit(1);
+        }
+        return residue_template->charges[atom->atom_type];
+    }
+};
+
 } // End namespace gromacs parser
 #endif
@@ -0,0 +1,106 @@
+// parameter_index.h -- Hash index of force field parameters by atom types
+// Copyright (C) 2026 agent
+//
+// This file is part of PHAISTOS
+//
+// PHAISTOS is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// PHAISTOS is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Phaistos.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+#ifndef TERM_PARAMETER_INDEX_H
+#define TERM_PARAMETER_INDEX_H
+
+#include <vector>
+#include <algorithm>
+#include <boost/cstdint.hpp>
+#include <boost/unordered_map.hpp>
+
+#include "../parameters/atom_types.h"
+
+namespace topology {
+
+//! Key of a tuple of up to four atom type IDs
+typedef boost::uint64_t ParameterKey;
+
+//! Number of bits per atom type ID in a ParameterKey
+const unsigned int PARAMETER_KEY_BITS = 16;
+
+//! Key of a tuple of atom type IDs
+//! \param ids Atom type IDs
+//! \param n Number of IDs (at most 4)
+//! \param reverse Whether to use the IDs in reverse order
+//! \returns Key
+inline ParameterKey make_parameter_key(const unsigned int *ids, const unsigned int n, const bool reverse=false) {
+
+     ParameterKey key = 0;
+     for (unsigned int i = 0; i < n; i++) {
+          key = (key << PARAMETER_KEY_BITS) | ids[reverse ? n-1-i : i];
+     }
+     return key;
+}
+
+//! Key of a tuple of atom type IDs which is the same for the tuple and its reverse
+//! (parameters apply to interactions in both directions).
+//! \param ids Atom type IDs
+//! \param n Number of IDs (at most 4)
+//! \returns Key
+inline ParameterKey make_canonical_parameter_key(const unsigned int *ids, const unsigned int n) {
+     return std::min(make_parameter_key(ids, n), make_parameter_key(ids, n, true));
+}
+
+
+//! Hash index from keys of atom type tuples to the parameters with these types.
+//! The parameters of a key are kept in the order they were added (i.e. the
+//! order of the parameter file), so the first and last matches of the
+//! previous linear searches are the first and last entries.
+class ParameterIndex {
+
+     //! Parameter indexes for each key
+     boost::unordered_map<ParameterKey, std::vector<unsigned int> > entries;
+
+public:
+
+     //! Add a parameter
+     //! \param key Key of the atom types of the parameter
+     //! \param index Index of the parameter
+     void add(const ParameterKey key, const unsigned int index) {
+          entries[key].push_back(index);
+     }
+
+     //! Find the parameters with a key
+     //! \param key Key of atom types
+     //! \returns Indexes of the parameters in the order they were added (NULL if there are none)
+     const std::vector<unsigned int> *find(const ParameterKey key) const {
+
+          boost::unordered_map<ParameterKey, std::vector<unsigned int> >::const_iterator it = entries.find(key);
+          if (it == entries.end())
+               return NULL;
+          return &it->second;
+     }
+};
+
+
+//! Hash indexes of the parameters with specific atom types and of the
+//! parameters with wildcard ("X") atom types, which are used as fallback.
+struct TieredParameterIndex {
+
+     //! Parameters with specific atom types
+     ParameterIndex specific;
+
+     //! Parameters with wildcard atom types
+     ParameterIndex wildcard;
+};
+
+} // End namespace topology
+
+#endif
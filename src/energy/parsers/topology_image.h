@@ -0,0 +1,778 @@
+// topology_image.h -- Binary images of interaction lists, reused across runs
+// Copyright (C) 2026 agent
+//
+// This file is part of PHAISTOS
+//
+// PHAISTOS is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// PHAISTOS is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Phaistos.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+#ifndef TERM_TOPOLOGY_IMAGE_H
+#define TERM_TOPOLOGY_IMAGE_H
+
+#include <string>
+#include <vector>
+#include <map>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <sstream>
+#include <iomanip>
+#include <cstdlib>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <boost/cstdint.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include "eef1_sb_parser.h"
+#include "topology_items.h"
+#include "../parameters/vdw_parameters.h"
+#include "../parameters/vdw14_parameters.h"
+#include "../parameters/bond_stretch_parameters.h"
+#include "../parameters/angle_bend_parameters.h"
+#include "../parameters/torsion_parameters.h"
+#include "../parameters/imptor_parameters.h"
+#include "../parameters/solvpar_17_inp.h"
+
+namespace topology {
+
+//! Version of the image format and of the code generating the interactions.
+//! Must be increased when either changes, so that old images are no longer used.
+const boost::uint32_t TOPOLOGY_IMAGE_VERSION = 2;
+
+//! Identifies topology image files
+const char TOPOLOGY_IMAGE_MAGIC[8] = {'C', 'H', 'A', 'R', 'M', 'M', 'T', 'I'};
+
+//! Key of a chain topology (and of the parameters the interactions are generated from)
+typedef boost::uint64_t TopologyKey;
+
+//! Add bytes to a 64-bit FNV-1a hash
+//! \param hash Hash so far
+//! \param data Bytes
+//! \param size Number of bytes
+//! \returns Hash
+inline TopologyKey hash_bytes(TopologyKey hash, const void *data, const unsigned int size) {
+
+     const unsigned char *bytes = static_cast<const unsigned char *>(data);
+     for (unsigned int i = 0; i < size; i++) {
+          hash = (hash ^ bytes[i]) * 1099511628211ULL;
+     }
+     return hash;
+}
+
+//! Add a value to a 64-bit FNV-1a hash
+//! \param hash Hash so far
+//! \param value Value (of a type without padding)
+//! \returns Hash
+template <typename T>
+inline TopologyKey hash_value(const TopologyKey hash, const T &value) {
+     return hash_bytes(hash, &value, sizeof(T));
+}
+
+//! Hash of the parameter tables and of the EEF1-SB solvation parameters
+//! \returns Hash
+TopologyKey get_parameter_hash() {
+
+     using namespace charmm_parameters;
+
+     TopologyKey hash = 14695981039346656037ULL;
+     hash = hash_value(hash, TOPOLOGY_IMAGE_VERSION);
+     hash = hash_value(hash, (boost::uint32_t)N_ATOM_TYPES);
+
+     for (unsigned int i = 0; i < N_NON_BONDED_PARAMETERS; i++) {
+          const NonBondedRecord &r = non_bonded_parameters[i];
+          hash = hash_value(hash, (boost::uint32_t)r.atom_type);
+          hash = hash_value(hash, r.atom_mass);
+          hash = hash_value(hash, r.sigma);
+          hash = hash_value(hash, r.epsilon);
+     }
+     for (unsigned int i = 0; i < N_NON_BONDED_14_PARAMETERS; i++) {
+          const NonBonded14Record &r = non_bonded_14_parameters[i];
+          hash = hash_value(hash, (boost::uint32_t)r.atom_type1);
+          hash = hash_value(hash, (boost::uint32_t)r.atom_type2);
+          hash = hash_value(hash, r.sigma);
+          hash = hash_value(hash, r.epsilon);
+     }
+     for (unsigned int i = 0; i < N_BOND_STRETCH_PARAMETERS; i++) {
+          const BondStretchRecord &r = bond_stretch_parameters[i];
+          hash = hash_value(hash, (boost::uint32_t)r.type1);
+          hash = hash_value(hash, (boost::uint32_t)r.type2);
+          hash = hash_value(hash, r.r0);
+          hash = hash_value(hash, r.kb);
+     }
+     for (unsigned int i = 0; i < N_ANGLE_BEND_PARAMETERS; i++) {
+          const AngleBendRecord &r = angle_bend_parameters[i];
+          hash = hash_value(hash, (boost::uint32_t)r.type1);
+          hash = hash_value(hash, (boost::uint32_t)r.type2);
+          hash = hash_value(hash, (boost::uint32_t)r.type3);
+          hash = hash_value(hash, r.theta0);
+          hash = hash_value(hash, r.k0);
+          hash = hash_value(hash, r.r13);
+          hash = hash_value(hash, r.kub);
+     }
+     for (unsigned int i = 0; i < N_TORSION_PARAMETERS; i++) {
+          const TorsionRecord &r = torsion_parameters[i];
+          hash = hash_value(hash, (boost::uint32_t)r.type1);
+          hash = hash_value(hash, (boost::uint32_t)r.type2);
+          hash = hash_value(hash, (boost::uint32_t)r.type3);
+          hash = hash_value(hash, (boost::uint32_t)r.type4);
+          hash = hash_value(hash, r.phi0);
+          hash = hash_value(hash, r.cp);
+          hash = hash_value(hash, (boost::uint32_t)r.mult);
+     }
+     for (unsigned int i = 0; i < N_IMPROPER_TORSION_PARAMETERS; i++) {
+          const ImproperTorsionRecord &r = improper_torsion_parameters[i];
+          hash = hash_value(hash, (boost::uint32_t)r.type1);
+          hash = hash_value(hash, (boost::uint32_t)r.type2);
+          hash = hash_value(hash, (boost::uint32_t)r.type3);
+          hash = hash_value(hash, (boost::uint32_t)r.type4);
+          hash = hash_value(hash, r.phi0);
+          hash = hash_value(hash, r.cp);
+     }
+
+     hash = hash_bytes(hash, charmm_constants::solvpar_inp.data(), charmm_constants::solvpar_inp.size());
+
+     return hash;
+}
+
+//! Key of the topology of a chain: a hash of the parameters, the residue types,
+//! terminal and protonation states and the atoms of each residue.
+//! \param chain Molecule chain
+//! \returns Key
+TopologyKey get_topology_key(phaistos::ChainFB *chain) {
+
+     using namespace phaistos;
+
+     TopologyKey key = get_parameter_hash();
+
+     for (int r = 0; r < chain->size(); r++) {
+          key = hash_value(key, (boost::uint32_t)eef1_sb_parser::get_residue_template_key(&(*chain)[r]));
+     }
+
+     for (AtomIterator<ChainFB, definitions::ALL> it(*chain); !it.end(); ++it) {
+          key = hash_value(key, (boost::uint32_t)it->residue->index);
+          key = hash_value(key, (boost::uint32_t)it->atom_type);
+     }
+
+     return key;
+}
+
+
+//! Header of a topology image file
+struct TopologyImageHeader {
+
+     //! TOPOLOGY_IMAGE_MAGIC
+     char magic[8];
+
+     //! TOPOLOGY_IMAGE_VERSION
+     boost::uint32_t version;
+
+     //! Size of each interaction record (to detect images written by a different build)
+     boost::uint32_t record_size;
+
+     //! Topology key of the chain (see get_topology_key())
+     boost::uint64_t key;
+
+     //! Number of atoms
+     boost::uint64_t n_atoms;
+
+     //! Number of interactions
+     boost::uint64_t n_interactions;
+};
+
+//! Atom in a topology image, compared with the chain when the image is read
+struct TopologyImageAtom {
+
+     //! Index of the residue of the atom
+     boost::uint32_t residue_index;
+
+     //! Atom name (AtomEnum)
+     boost::uint32_t atom_type;
+
+     //! CHARMM36 atom type ID
+     boost::uint32_t atom_type_id;
+
+     //! Unused (alignment)
+     boost::uint32_t padding;
+
+     //! Partial charge
+     double charge;
+};
+
+//! Bond-stretch interaction in a topology image
+struct BondedPairImageRecord {
+
+     //! Atom indexes (in chain iteration order)
+     boost::uint32_t atom_indexes[4];
+
+     double kb;
+     double r0;
+};
+
+//! Angle-bend interaction in a topology image
+struct AngleBendImageRecord {
+
+     //! Atom indexes (in chain iteration order)
+     boost::uint32_t atom_indexes[4];
+
+     double theta0;
+     double k0;
+     double r13;
+     double kub;
+};
+
+//! Torsion interaction in a topology image
+struct TorsionImageRecord {
+
+     //! Atom indexes (in chain iteration order)
+     boost::uint32_t atom_indexes[4];
+
+     double phi0;
+     double cp;
+     boost::uint32_t mult;
+     boost::uint32_t dof_type;
+     boost::int32_t dof_residue_index;
+
+     //! Unused (alignment)
+     boost::uint32_t padding;
+};
+
+//! Improper torsion interaction in a topology image
+struct ImproperTorsionImageRecord {
+
+     //! Atom indexes (in chain iteration order)
+     boost::uint32_t atom_indexes[4];
+
+     double phi0;
+     double cp;
+};
+
+//! Non-bonded interaction in a topology image
+struct NonBondedImageRecord {
+
+     //! Atom indexes (in chain iteration order)
+     boost::uint32_t atom_indexes[4];
+
+     boost::uint32_t index1;
+     boost::uint32_t index2;
+     boost::uint32_t is_14_interaction;
+     boost::uint32_t do_eef1;
+     double qq;
+     double c6;
+     double c12;
+     double fac_12;
+     double fac_21;
+     double R_vdw_1;
+     double R_vdw_2;
+     double lambda1;
+     double lambda2;
+};
+
+//! CMAP interaction in a topology image
+struct CmapImageRecord {
+
+     //! Atom indexes (unused, CMAP interactions refer to their residue)
+     boost::uint32_t atom_indexes[4];
+
+     boost::int32_t residue_index;
+     boost::uint32_t cmap_type_index;
+};
+
+//! Record type of each interaction type in a topology image. Records have
+//! fixed-size fields and no pointers, so an image can be mapped and read by
+//! any process that uses the same parameters.
+template <typename INTERACTION> struct TopologyImageRecord;
+template <> struct TopologyImageRecord<BondedPairInteraction> { typedef BondedPairImageRecord Type; };
+template <> struct TopologyImageRecord<AngleBendInteraction> { typedef AngleBendImageRecord Type; };
+template <> struct TopologyImageRecord<TorsionInteraction> { typedef TorsionImageRecord Type; };
+template <> struct TopologyImageRecord<ImproperTorsionInteraction> { typedef ImproperTorsionImageRecord Type; };
+template <> struct TopologyImageRecord<NonBondedInteraction> { typedef NonBondedImageRecord Type; };
+template <> struct TopologyImageRecord<CmapInteraction> { typedef CmapImageRecord Type; };
+
+//! Copy the parameters of a bond-stretch interaction to and from its image record
+inline void copy_parameters(const BondedPairInteraction &interaction, BondedPairImageRecord &record) {
+     record.kb = interaction.kb;
+     record.r0 = interaction.r0;
+}
+inline void copy_parameters(const BondedPairImageRecord &record, BondedPairInteraction &interaction) {
+     interaction.kb = record.kb;
+     interaction.r0 = record.r0;
+}
+
+//! Copy the parameters of an angle-bend interaction to and from its image record
+inline void copy_parameters(const AngleBendInteraction &interaction, AngleBendImageRecord &record) {
+     record.theta0 = interaction.theta0;
+     record.k0 = interaction.k0;
+     record.r13 = interaction.r13;
+     record.kub = interaction.kub;
+}
+inline void copy_parameters(const AngleBendImageRecord &record, AngleBendInteraction &interaction) {
+     interaction.theta0 = record.theta0;
+     interaction.k0 = record.k0;
+     interaction.r13 = record.r13;
+     interaction.kub = record.kub;
+}
+
+//! Copy the parameters of a torsion interaction to and from its image record
+inline void copy_parameters(const TorsionInteraction &interaction, TorsionImageRecord &record) {
+     record.phi0 = interaction.phi0;
+     record.cp = interaction.cp;
+     record.mult = interaction.mult;
+     record.dof_type = interaction.dof_type;
+     record.dof_residue_index = interaction.dof_residue_index;
+}
+inline void copy_parameters(const TorsionImageRecord &record, TorsionInteraction &interaction) {
+     interaction.phi0 = record.phi0;
+     interaction.cp = record.cp;
+     interaction.mult = record.mult;
+     interaction.dof_type = record.dof_type;
+     interaction.dof_residue_index = record.dof_residue_index;
+}
+
+//! Copy the parameters of an improper torsion interaction to and from its image record
+inline void copy_parameters(const ImproperTorsionInteraction &interaction, ImproperTorsionImageRecord &record) {
+     record.phi0 = interaction.phi0;
+     record.cp = interaction.cp;
+}
+inline void copy_parameters(const ImproperTorsionImageRecord &record, ImproperTorsionInteraction &interaction) {
+     interaction.phi0 = record.phi0;
+     interaction.cp = record.cp;
+}
+
+//! Copy the parameters of a non-bonded interaction to and from its image record
+inline void copy_parameters(const NonBondedInteraction &interaction, NonBondedImageRecord &record) {
+     record.index1 = interaction.index1;
+     record.index2 = interaction.index2;
+     record.is_14_interaction = interaction.is_14_interaction;
+     record.do_eef1 = interaction.do_eef1;
+     record.qq = interaction.qq;
+     record.c6 = interaction.c6;
+     record.c12 = interaction.c12;
+     record.fac_12 = interaction.fac_12;
+     record.fac_21 = interaction.fac_21;
+     record.R_vdw_1 = interaction.R_vdw_1;
+     record.R_vdw_2 = interaction.R_vdw_2;
+     record.lambda1 = interaction.lambda1;
+     record.lambda2 = interaction.lambda2;
+}
+inline void copy_parameters(const NonBondedImageRecord &record, NonBondedInteraction &interaction) {
+     interaction.index1 = record.index1;
+     interaction.index2 = record.index2;
+     interaction.is_14_interaction = (record.is_14_interaction != 0);
+     interaction.do_eef1 = (record.do_eef1 != 0);
+     interaction.qq = record.qq;
+     interaction.c6 = record.c6;
+     interaction.c12 = record.c12;
+     interaction.fac_12 = record.fac_12;
+     interaction.fac_21 = record.fac_21;
+     interaction.R_vdw_1 = record.R_vdw_1;
+     interaction.R_vdw_2 = record.R_vdw_2;
+     interaction.lambda1 = record.lambda1;
+     interaction.lambda2 = record.lambda2;
+}
+
+//! Copy the parameters of a CMAP interaction to and from its image record
+inline void copy_parameters(const CmapInteraction &interaction, CmapImageRecord &record) {
+     record.residue_index = interaction.residue_index;
+     record.cmap_type_index = interaction.cmap_type_index;
+}
+inline void copy_parameters(const CmapImageRecord &record, CmapInteraction &interaction) {
+     interaction.residue_index = record.residue_index;
+     interaction.cmap_type_index = record.cmap_type_index;
+}
+
+//! Atom pointers of a bond-stretch interaction
+inline unsigned int get_atom_pointers(BondedPairInteraction &interaction, phaistos::Atom **atoms[4]) {
+     atoms[0] = &interaction.atom1;
+     atoms[1] = &interaction.atom2;
+     return 2;
+}
+
+//! Atom pointers of an angle-bend interaction
+inline unsigned int get_atom_pointers(AngleBendInteraction &interaction, phaistos::Atom **atoms[4]) {
+     atoms[0] = &interaction.atom1;
+     atoms[1] = &interaction.atom2;
+     atoms[2] = &interaction.atom3;
+     return 3;
+}
+
+//! Atom pointers of a torsion interaction
+inline unsigned int get_atom_pointers(TorsionInteraction &interaction, phaistos::Atom **atoms[4]) {
+     atoms[0] = &interaction.atom1;
+     atoms[1] = &interaction.atom2;
+     atoms[2] = &interaction.atom3;
+     atoms[3] = &interaction.atom4;
+     return 4;
+}
+
+//! Atom pointers of an improper torsion interaction
+inline unsigned int get_atom_pointers(ImproperTorsionInteraction &interaction, phaistos::Atom **atoms[4]) {
+     atoms[0] = &interaction.atom1;
+     atoms[1] = &interaction.atom2;
+     atoms[2] = &interaction.atom3;
+     atoms[3] = &interaction.atom4;
+     return 4;
+}
+
+//! Atom pointers of a non-bonded interaction
+inline unsigned int get_atom_pointers(NonBondedInteraction &interaction, phaistos::Atom **atoms[4]) {
+     atoms[0] = &interaction.atom1;
+     atoms[1] = &interaction.atom2;
+     return 2;
+}
+
+//! Atom pointers of a CMAP interaction (which refers to its residue instead)
+inline unsigned int get_atom_pointers(CmapInteraction &, phaistos::Atom **[4]) {
+     return 0;
+}
+
+//! Set the residue pointer of an interaction read from an image
+//! \returns False if the residue is not in the chain
+template <typename INTERACTION>
+inline bool set_residue_pointer(INTERACTION &, phaistos::ChainFB *) {
+     return true;
+}
+
+//! Set the residue pointer of a CMAP interaction from its residue_index
+//! \returns False if the residue is not in the chain
+inline bool set_residue_pointer(CmapInteraction &interaction, phaistos::ChainFB *chain) {
+
+     if (interaction.residue_index < 0 || interaction.residue_index >= chain->size())
+          return false;
+
+     interaction.residue = &(*chain)[interaction.residue_index];
+     return true;
+}
+
+
+//! Read-only memory mapping of a topology image file. The mapping is shared
+//! (MAP_SHARED), so processes reading the same image share its pages in the
+//! page cache instead of each holding a private copy.
+class TopologyImageMapping {
+
+     //! Start of the mapping (NULL: not mapped)
+     void *data;
+
+     //! Size of the mapping in bytes
+     std::size_t size;
+
+     // Not copyable (shared through boost::shared_ptr instead)
+     TopologyImageMapping(const TopologyImageMapping &);
+     TopologyImageMapping &operator=(const TopologyImageMapping &);
+
+public:
+
+     //! Constructor. Maps the file if it exists and is not empty
+     //! \param filename Name of the image file
+     TopologyImageMapping(const std::string &filename)
+          : data(NULL), size(0) {
+
+          const int fd = open(filename.c_str(), O_RDONLY);
+          if (fd < 0)
+               return;
+
+          struct stat file_status;
+          if (fstat(fd, &file_status) == 0 && file_status.st_size > 0) {
+               void *address = mmap(NULL, file_status.st_size, PROT_READ, MAP_SHARED, fd, 0);
+               if (address != MAP_FAILED) {
+                    this->data = address;
+                    this->size = file_status.st_size;
+               }
+          }
+
+          // The mapping remains valid after the file is closed
+          close(fd);
+     }
+
+     //! Destructor
+     ~TopologyImageMapping() {
+          if (this->data)
+               munmap(this->data, this->size);
+     }
+
+     //! Whether the file is mapped
+     bool is_mapped() const {
+          return this->data != NULL;
+     }
+
+     //! Start of the mapping (page aligned)
+     const char *get_data() const {
+          return static_cast<const char *>(this->data);
+     }
+
+     //! Size of the mapping in bytes
+     std::size_t get_size() const {
+          return this->size;
+     }
+};
+
+
+//! Directory of topology images. Each interaction list of a chain is stored in
+//! a file named by the topology key of the chain and the name of the list. The
+//! file holds the atoms of the chain (with atom types and charges) and the
+//! interactions as fixed-size records with atom indexes instead of pointers. It
+//! is written once, to a temporary file with a unique name which is then
+//! renamed, so processes and threads sharing the directory never read a partial
+//! image. Later runs map the file read-only and shared, check the atoms against
+//! the chain and resolve the atom indexes to the atoms of their own chain. The
+//! mappings are kept as long as the directory object (held by the term).
+class TopologyImageDirectory {
+
+     //! Directory ("": images are neither read nor written)
+     std::string directory;
+
+     //! Molecule chain
+     phaistos::ChainFB *chain;
+
+     //! Topology key of the chain
+     TopologyKey key;
+
+     //! Atoms of the chain in iteration order
+     std::vector<phaistos::Atom *> atoms;
+
+     //! Atoms of the chain as stored in images
+     std::vector<TopologyImageAtom> image_atoms;
+
+     //! Mapped images, by name of the interaction list
+     std::map<std::string, boost::shared_ptr<const TopologyImageMapping> > mappings;
+
+public:
+
+     //! Default constructor (images disabled)
+     TopologyImageDirectory()
+          : chain(NULL), key(0) {}
+
+     //! Constructor
+     //! \param chain Molecule chain
+     //! \param directory Directory of the images ("": disabled)
+     TopologyImageDirectory(phaistos::ChainFB *chain, const std::string &directory)
+          : directory(directory), chain(chain), key(0) {
+
+          using namespace phaistos;
+
+          if (this->directory.empty())
+               return;
+
+          this->key = get_topology_key(chain);
+
+          const eef1_sb_parser::ChainAtomTypes atom_types(chain);
+
+          for (AtomIterator<ChainFB, definitions::ALL> it(*chain); !it.end(); ++it) {
+
+               TopologyImageAtom image_atom;
+               image_atom.residue_index = it->residue->index;
+               image_atom.atom_type = it->atom_type;
+               image_atom.atom_type_id = atom_types.get_atom_type_id(&*it);
+               image_atom.padding = 0;
+               image_atom.charge = atom_types.get_atom_charge(&*it);
+
+               this->atoms.push_back(&*it);
+               this->image_atoms.push_back(image_atom);
+          }
+     }
+
+     //! Whether images are used
+     bool is_enabled() const {
+          return !this->directory.empty();
+     }
+
+     //! File name of an image
+     //! \param name Name of the interaction list
+     //! \returns File name
+     std::string get_filename(const std::string &name) const {
+
+          std::ostringstream filename;
+          filename << this->directory << "/charmm-topology-"
+                   << std::hex << std::setw(16) << std::setfill('0') << this->key
+                   << "-" << name << ".bin";
+          return filename.str();
+     }
+
+     //! Read an interaction list from its image
+     //! \param name Name of the interaction list
+     //! \param interactions Interactions (output)
+     //! \returns False if there is no valid image
+     template <typename INTERACTION>
+     bool read(const std::string &name, std::vector<INTERACTION> &interactions) {
+
+          typedef typename TopologyImageRecord<INTERACTION>::Type Record;
+
+          if (!is_enabled())
+               return false;
+
+          const std::string filename = get_filename(name);
+
+          // A missing image is the normal case before the first run
+          boost::shared_ptr<const TopologyImageMapping> mapping(new TopologyImageMapping(filename));
+          if (!mapping->is_mapped())
+               return false;
+
+          const char *data = mapping->get_data();
+          const std::size_t size = mapping->get_size();
+
+          const unsigned int n_atoms = this->image_atoms.size();
+
+          if (size < sizeof(TopologyImageHeader)) {
+               std::cerr << "# Warning: Ignoring truncated topology image " << filename << "\n";
+               return false;
+          }
+
+          const TopologyImageHeader &header = *reinterpret_cast<const TopologyImageHeader *>(data);
+
+          if (std::memcmp(header.magic, TOPOLOGY_IMAGE_MAGIC, sizeof(header.magic)) != 0 ||
+              header.version != TOPOLOGY_IMAGE_VERSION ||
+              header.record_size != sizeof(Record) ||
+              header.key != this->key ||
+              header.n_atoms != n_atoms ||
+              size != (sizeof(TopologyImageHeader) +
+                       n_atoms * sizeof(TopologyImageAtom) +
+                       header.n_interactions * sizeof(Record))) {
+               std::cerr << "# Warning: Ignoring topology image " << filename << ", which does not match the chain\n";
+               return false;
+          }
+
+          // Compare atoms, types and charges with the chain (this also guards against key collisions)
+          const TopologyImageAtom *image_atoms = reinterpret_cast<const TopologyImageAtom *>(data + sizeof(TopologyImageHeader));
+          for (unsigned int i = 0; i < n_atoms; i++) {
+               if (image_atoms[i].residue_index != this->image_atoms[i].residue_index ||
+                   image_atoms[i].atom_type     != this->image_atoms[i].atom_type ||
+                   image_atoms[i].atom_type_id  != this->image_atoms[i].atom_type_id ||
+                   image_atoms[i].charge        != this->image_atoms[i].charge) {
+                    std::cerr << "# Warning: Ignoring topology image " << filename << ", whose atoms do not match the chain\n";
+                    return false;
+               }
+          }
+
+          // The header and atoms are multiples of 8 bytes, so the records are aligned
+          const Record *records = reinterpret_cast<const Record *>(data + sizeof(TopologyImageHeader) +
+                                                                   n_atoms * sizeof(TopologyImageAtom));
+
+          interactions.resize(header.n_interactions);
+          for (unsigned int i = 0; i < interactions.size(); i++) {
+
+               copy_parameters(records[i], interactions[i]);
+
+               if (!set_residue_pointer(interactions[i], this->chain)) {
+                    std::cerr << "# Warning: Ignoring corrupt topology image " << filename << "\n";
+                    interactions.clear();
+                    return false;
+               }
+
+               phaistos::Atom **atom_pointers[4];
+               const unsigned int n = get_atom_pointers(interactions[i], atom_pointers);
+               for (unsigned int k = 0; k < n; k++) {
+
+                    if (records[i].atom_indexes[k] >= n_atoms) {
+                         std::cerr << "# Warning: Ignoring corrupt topology image " << filename << "\n";
+                         interactions.clear();
+                         return false;
+                    }
+                    *atom_pointers[k] = this->atoms[records[i].atom_indexes[k]];
+               }
+          }
+
+          this->mappings[name] = mapping;
+
+          return true;
+     }
+
+     //! Write the image of an interaction list. Failure to write is not an error,
+     //! since the list is then generated again in the next run.
+     //! \param name Name of the interaction list
+     //! \param interactions Interactions
+     template <typename INTERACTION>
+     void write(const std::string &name, const std::vector<INTERACTION> &interactions) const {
+
+          typedef typename TopologyImageRecord<INTERACTION>::Type Record;
+
+          if (!is_enabled())
+               return;
+
+          std::map<phaistos::Atom *, unsigned int> atom_indexes;
+          for (unsigned int i = 0; i < this->atoms.size(); i++) {
+               atom_indexes[this->atoms[i]] = i;
+          }
+
+          TopologyImageHeader header;
+          std::memset(&header, 0, sizeof(header));
+          std::memcpy(header.magic, TOPOLOGY_IMAGE_MAGIC, sizeof(header.magic));
+          header.version = TOPOLOGY_IMAGE_VERSION;
+          header.record_size = sizeof(Record);
+          header.key = this->key;
+          header.n_atoms = this->atoms.size();
+          header.n_interactions = interactions.size();
+
+          const std::string filename = get_filename(name);
+
+          // A unique temporary file in the same directory, so that threads and
+          // processes writing the same image do not write to the same file
+          std::string temporary_filename = filename + ".tmpXXXXXX";
+          std::vector<char> temporary_filename_buffer(temporary_filename.begin(), temporary_filename.end());
+          temporary_filename_buffer.push_back('\0');
+
+          const int fd = mkstemp(&temporary_filename_buffer[0]);
+          if (fd < 0) {
+               std::cerr << "# Warning: Could not write topology image " << filename << "\n";
+               return;
+          }
+          temporary_filename = &temporary_filename_buffer[0];
+
+          // mkstemp creates the file readable by the owner only
+          fchmod(fd, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
+
+          FILE *file = fdopen(fd, "wb");
+          bool ok = (file != NULL);
+
+          if (ok) {
+               ok = (std::fwrite(&header, sizeof(header), 1, file) == 1);
+          }
+          if (ok && !this->image_atoms.empty()) {
+               ok = (std::fwrite(&this->image_atoms[0], sizeof(TopologyImageAtom), this->image_atoms.size(), file)
+                     == this->image_atoms.size());
+          }
+
+          for (unsigned int i = 0; ok && i < interactions.size(); i++) {
+
+               // Cleared first, so that unused indexes and padding are zero
+               Record record;
+               std::memset(&record, 0, sizeof(record));
+               copy_parameters(interactions[i], record);
+
+               INTERACTION interaction = interactions[i];
+               phaistos::Atom **atom_pointers[4];
+               const unsigned int n = get_atom_pointers(interaction, atom_pointers);
+               for (unsigned int k = 0; k < n; k++) {
+                    record.atom_indexes[k] = atom_indexes.find(*atom_pointers[k])->second;
+               }
+
+               ok = (std::fwrite(&record, sizeof(record), 1, file) == 1);
+          }
+
+          if (file) {
+               ok = (std::fclose(file) == 0) && ok;
+          } else {
+               close(fd);
+          }
+
+          if (!ok || std::rename(temporary_filename.c_str(), filename.c_str()) != 0) {
+               std::cerr << "# Warning: Could not write topology image " << filename << "\n";
+               std::remove(temporary_filename.c_str());
+          }
+     }
+};
+
+} // End namespace topology
+
+#endif
@@ -22,6 +22,8 @@
 
 #include <string>
 
+#include "../parameters/atom_types.h"
+
 namespace topology {
 
 //! Class to hold all information for a CMAP correction evaluation
@@ -35,7 +37,7 @@ struct CmapInteraction {
 //! Class to hold all parameters to evaluate the non-bonded interaction between two atoms
 struct NonBondedParameter {
 
-    std::string atom_type;
+    charmm_parameters::AtomTypeId atom_type;
     unsigned int atom_number;
     double atom_mass;
     double atom_charge;
@@ -49,8 +51,8 @@ struct NonBondedParameter {
 //! Class to hold all parameters to evaluate the non-bonded "1-4" interaction between two atoms
 struct NonBonded14Parameter {
 
-    std::string atom_type1;
-    std::string atom_type2;
+    charmm_parameters::AtomTypeId atom_type1;
+    charmm_parameters::AtomTypeId atom_type2;
     unsigned int pair_function;
     double sigma;
     double epsilon;
@@ -63,6 +65,9 @@ struct NonBondedInteraction {
 
     phaistos::Atom *atom1;
     phaistos::Atom *atom2;
+    // Positions of atom1 and atom2 in a coordinate buffer (see spatial_ordering.h)
+    unsigned int index1;
+    unsigned int index2;
     double qq;
     double c6;
     double c12;
@@ -81,10 +86,10 @@ struct NonBondedInteraction {
 //! Class to hold all parameters for a torsion energy term
 struct TorsionParameter {
 
-    std::string type1;
-    std::string type2;
-    std::string type3;
-    std::string type4;
+    charmm_parameters::AtomTypeId type1;
+    charmm_parameters::AtomTypeId type2;
+    charmm_parameters::AtomTypeId type3;
+    charmm_parameters::AtomTypeId type4;
     double phi0;
     double cp;
     unsigned int mult;
@@ -92,6 +97,22 @@ struct TorsionParameter {
 };
 
 
+//! Torsional degrees of freedom of a ChainFB residue
+const unsigned int DOF_PHI = 0;
+const unsigned int DOF_PSI = 1;
+const unsigned int DOF_OMEGA = 2;
+const unsigned int DOF_CHI1 = 3;
+const unsigned int DOF_CHI2 = 4;
+const unsigned int DOF_CHI3 = 5;
+const unsigned int DOF_CHI4 = 6;
+
+//! Number of torsional degrees of freedom per residue
+const unsigned int N_DOF_TYPES = 7;
+
+//! Marks a torsion that does not correspond to a degree of freedom
+const unsigned int DOF_NONE = N_DOF_TYPES;
+
+
 //! Class to hold all parameters for a torsion energy term and the four atoms involved in the interaction
 struct TorsionInteraction {
 
@@ -103,13 +124,18 @@ struct TorsionInteraction {
     double cp;
     unsigned int mult;
 
+    // Degree of freedom with the same central bond (DOF_NONE if there is none),
+    // from which the dihedral angle can be read up to a constant offset
+    unsigned int dof_type;
+    int dof_residue_index;
+
 };
 
 
 //! Class to hold parameters for a bond-stretch interaction
 struct BondedPairParameter {
-    std::string type1;
-    std::string type2;
+    charmm_parameters::AtomTypeId type1;
+    charmm_parameters::AtomTypeId type2;
     double kb;
     double r0;
 };
@@ -126,9 +152,9 @@ struct BondedPairInteraction {
 
 //! Class to hold parameters for an angle-bend (and Urey-Bradley) energy term.
 struct AngleBendParameter {
-    std::string type1;
-    std::string type2;
-    std::string type3;
+    charmm_parameters::AtomTypeId type1;
+    charmm_parameters::AtomTypeId type2;
+    charmm_parameters::AtomTypeId type3;
     double theta0;
     double k0;
     double r13;
@@ -152,10 +178,10 @@ struct AngleBendInteraction {
 //! Class to hold parameters for an improper torsion energy term
 struct ImproperTorsionParameter {
 
-    std::string type1;
-    std::string type2;
-    std::string type3;
-    std::string type4;
+    charmm_parameters::AtomTypeId type1;
+    charmm_parameters::AtomTypeId type2;
+    charmm_parameters::AtomTypeId type3;
+    charmm_parameters::AtomTypeId type4;
     double phi0;
     double cp;
 
@@ -22,27 +22,127 @@
 
 #include <string>
 #include <math.h>
+#include <cstdlib>
+#include <algorithm>
+#include <map>
+
+#include <boost/shared_ptr.hpp>
 
 #include "protein/iterators/pair_iterator_chaintree.h"
 
 #include "eef1_sb_parser.h"
 #include "topology_items.h"
+#include "parameter_index.h"
+#include "bond_graph.h"
+#include "topology_image.h"
+#include "../parallel_sum.h"
 #include "../constants.h"
+#include "../parameters/vdw_parameters.h"
+#include "../parameters/vdw14_parameters.h"
+#include "../parameters/bond_stretch_parameters.h"
+#include "../parameters/angle_bend_parameters.h"
+#include "../parameters/torsion_parameters.h"
+#include "../parameters/imptor_parameters.h"
 
 
 namespace topology {
 
 
+//! Covalent bond graph and atom types of a chain, which the interaction generators
+//! need. A term that generates several interaction lists passes one object to all
+//! generators, so that each is built at most once (when it is first used).
+class ChainTopology {
+
+    //! Molecule chain
+    phaistos::ChainFB *chain;
+
+    //! Covalent bond graph (NULL until first used)
+    boost::shared_ptr<const BondGraph> bond_graph;
+
+    //! Atom types (NULL until first used)
+    boost::shared_ptr<const eef1_sb_parser::ChainAtomTypes> atom_types;
+
+public:
+
+    //! Default constructor
+    ChainTopology()
+        : chain(NULL) {}
+
+    //! Constructor
+    //! \param chain Molecule chain
+    explicit ChainTopology(phaistos::ChainFB *chain)
+        : chain(chain) {}
+
+    //! Molecule chain
+    phaistos::ChainFB *get_chain() const {
+        return this->chain;
+    }
+
+    //! Covalent bond graph of the chain
+    const BondGraph &get_bond_graph() {
+        if (!this->bond_graph)
+            this->bond_graph.reset(new BondGraph(this->chain));
+        return *this->bond_graph;
+    }
+
+    //! Atom types of the chain
+    const eef1_sb_parser::ChainAtomTypes &get_atom_types() {
+        if (!this->atom_types)
+            this->atom_types.reset(new eef1_sb_parser::ChainAtomTypes(this->chain));
+        return *this->atom_types;
+    }
+};
+
+
+//! Interned IDs of the atom types occurring in CMAP interactions
+enum CmapAtomType {CMAP_ATOM_C=0, CMAP_ATOM_N, CMAP_ATOM_NH1,
+                   CMAP_ATOM_CT1, CMAP_ATOM_CT2, CMAP_ATOM_CP1, CMAP_ATOM_OTHER};
+
+//! Number of CMAP types
+const unsigned int N_CMAP_TYPES = 6;
+
+//! Atom types of the C(i-1), N, CA, C, N(i+1) atoms of each CMAP type
+const CmapAtomType cmap_type_atoms[N_CMAP_TYPES][5] = {
+     {CMAP_ATOM_C, CMAP_ATOM_NH1, CMAP_ATOM_CT1, CMAP_ATOM_C, CMAP_ATOM_NH1},
+     {CMAP_ATOM_C, CMAP_ATOM_NH1, CMAP_ATOM_CT1, CMAP_ATOM_C, CMAP_ATOM_N},
+     {CMAP_ATOM_C, CMAP_ATOM_N,   CMAP_ATOM_CP1, CMAP_ATOM_C, CMAP_ATOM_NH1},
+     {CMAP_ATOM_C, CMAP_ATOM_N,   CMAP_ATOM_CP1, CMAP_ATOM_C, CMAP_ATOM_N},
+     {CMAP_ATOM_C, CMAP_ATOM_NH1, CMAP_ATOM_CT2, CMAP_ATOM_C, CMAP_ATOM_NH1},
+     {CMAP_ATOM_C, CMAP_ATOM_NH1, CMAP_ATOM_CT2, CMAP_ATOM_C, CMAP_ATOM_N}};
+
+//! Interned CMAP atom type ID of an atom
+//! \param atom_types Atom types of the chain
+//! \param atom Atom
+//! \returns ID of the atom type (CMAP_ATOM_OTHER if the type does not occur in CMAP interactions)
+CmapAtomType get_cmap_atom_type(const eef1_sb_parser::ChainAtomTypes &atom_types, const phaistos::Atom *atom) {
+
+     using namespace charmm_parameters;
+
+     switch (atom_types.get_atom_type_id(atom)) {
+     case ATOM_TYPE_C:   return CMAP_ATOM_C;
+     case ATOM_TYPE_N:   return CMAP_ATOM_N;
+     case ATOM_TYPE_NH1: return CMAP_ATOM_NH1;
+     case ATOM_TYPE_CT1: return CMAP_ATOM_CT1;
+     case ATOM_TYPE_CT2: return CMAP_ATOM_CT2;
+     case ATOM_TYPE_CP1: return CMAP_ATOM_CP1;
+     default:            return CMAP_ATOM_OTHER;
+     }
+}
+
+
 //! Generates an vector, over which all CMAP interactions in the chain can be iterated.
-//! \param chain The protein chain object.
+//! \param topology Bond graph and atom types of the protein chain
 //! \returns A vector of CMAP interaction term objects
-std::vector<CmapInteraction> generate_cmap_interactions(phaistos::ChainFB *chain) {
+std::vector<CmapInteraction> generate_cmap_interactions(ChainTopology &topology) {
 
     using namespace phaistos;
     using namespace definitions;
 
     std::vector<CmapInteraction> cmap_interactions;
 
+    phaistos::ChainFB *chain = topology.get_chain();
+    const eef1_sb_parser::ChainAtomTypes &atom_types = topology.get_atom_types();
+
     int i = -1;
 
     for (ResidueIterator<ChainFB> it(*(chain)); !(it).end(); ++it) {
@@ -53,321 +153,659 @@ std::vector<CmapInteraction> generate_cmap_interactions(phaistos::ChainFB *chain
           if (res->terminal_status == NTERM) continue;
           if (res->terminal_status == CTERM) continue;
 
-          std::string type1 = eef1_sb_parser::get_atom_type((*(res->get_neighbour(-1)))[C]);
-          std::string type2 = eef1_sb_parser::get_atom_type((*res)[N]);
-          std::string type3 = eef1_sb_parser::get_atom_type((*res)[CA]);
-          std::string type4 = eef1_sb_parser::get_atom_type((*res)[C]);
-          std::string type5 = eef1_sb_parser::get_atom_type((*(res->get_neighbour(+1)))[N]);
+          const CmapAtomType types[5] = {get_cmap_atom_type(atom_types, (*(res->get_neighbour(-1)))[C]),
+                                         get_cmap_atom_type(atom_types, (*res)[N]),
+                                         get_cmap_atom_type(atom_types, (*res)[CA]),
+                                         get_cmap_atom_type(atom_types, (*res)[C]),
+                                         get_cmap_atom_type(atom_types, (*(res->get_neighbour(+1)))[N])};
 
           CmapInteraction cmap_interaction;
 
           cmap_interaction.residue = res;
           cmap_interaction.residue_index = i;
 
-          if ((type1 == "C") &&
-              (type2 == "NH1") &&
-              (type3 == "CT1") &&
-              (type4 == "C") &&
-              (type5 == "NH1")) {
-                cmap_interaction.cmap_type_index = 0;
-          } else if ((type1 == "C") &&
-                     (type2 == "NH1") &&
-                     (type3 == "CT1") &&
-                     (type4 == "C") &&
-                     (type5 == "N")) {
-                cmap_interaction.cmap_type_index = 1;
-          } else if ((type1 == "C") &&
-                     (type2 == "N") &&
-                     (type3 == "CP1") &&
-                     (type4 == "C") &&
-                     (type5 == "NH1")) {
-                cmap_interaction.cmap_type_index = 2;
-          } else if ((type1 == "C") &&
-                     (type2 == "N") &&
-                     (type3 == "CP1") &&
-                     (type4 == "C") &&
-                     (type5 == "N")) {
-                cmap_interaction.cmap_type_index = 3;
-          } else if ((type1 == "C") &&
-                     (type2 == "NH1") &&
-                     (type3 == "CT2") &&
-                     (type4 == "C") &&
-                     (type5 == "NH1")) {
-                cmap_interaction.cmap_type_index = 4;
-          } else if ((type1 == "C") &&
-                     (type2 == "NH1") &&
-                     (type3 == "CT2") &&
-                     (type4 == "C") &&
-                     (type5 == "N")) {
-                cmap_interaction.cmap_type_index = 5;
-          } else {
+          unsigned int cmap_type_index = 0;
+          while (cmap_type_index < N_CMAP_TYPES &&
+                 !std::equal(types, types + 5, cmap_type_atoms[cmap_type_index])) {
+                cmap_type_index++;
+          }
+
+          if (cmap_type_index == N_CMAP_TYPES) {
                 std::cerr << "# Error: Unknown CMAP parameters for residue" << *res << " .\n";
                 exit(EXIT_FAILURE);
           }
 
+          cmap_interaction.cmap_type_index = cmap_type_index;
+
           cmap_interactions.push_back(cmap_interaction);
     }
 
     return cmap_interactions;
 }
 
+//! Generates an vector, over which all CMAP interactions in the chain can be iterated.
+//! \param chain The protein chain object.
+//! \returns A vector of CMAP interaction term objects
+std::vector<CmapInteraction> generate_cmap_interactions(phaistos::ChainFB *chain) {
+
+    ChainTopology topology(chain);
+    return generate_cmap_interactions(topology);
+}
+
 
-//! Reads a GROMACS van der Waal parameter .itp file (converted to one long string) and returns a vector of parameter objects 
-//! \param itp A parameter file in converted to string
+//! Returns the van der Waal parameters from the table generated from vdw.itp
 //! \returns A vector of non-bonded parameters
-std::vector<NonBondedParameter> read_nonbonded_parameters(const std::string &itp) {
+std::vector<NonBondedParameter> get_nonbonded_parameters() {
 
-    std::istringstream input_stream(itp);
+    using namespace charmm_parameters;
 
-    std::vector<NonBondedParameter> parameters;
+    std::vector<NonBondedParameter> parameters(N_NON_BONDED_PARAMETERS);
 
-    while (input_stream.good()) {
+    for (unsigned int i = 0; i < N_NON_BONDED_PARAMETERS; i++) {
 
-        std::string line;
-        std::getline(input_stream, line);
+        const NonBondedRecord &record = non_bonded_parameters[i];
+        NonBondedParameter &parameter = parameters[i];
 
-        boost::trim(line);
+        parameter.atom_type   = record.atom_type;
+        parameter.atom_number = record.atom_number;
+        parameter.atom_mass   = record.atom_mass;
+        parameter.atom_charge = 0.0;
+        parameter.atom_ptype  = record.atom_ptype;
+        parameter.sigma       = record.sigma;
+        parameter.epsilon     = record.epsilon;
+    }
 
-        if (line.size() == 0 || line[0] == ';') {
-            continue;
-        }
+    return parameters;
+}
 
-        std::vector<std::string> split_line;
-        boost::split(split_line, line, boost::is_any_of(" \t"), boost::token_compress_on);
 
-        NonBondedParameter parameter;
+//! Returns the van der Waal "1-4" parameters from the table generated from vdw14.itp
+//! \returns A vector of non-bonded "1-4" parameters
+std::vector<NonBonded14Parameter> get_nonbonded_14_parameters() {
 
-        parameter.atom_type   = boost::lexical_cast<std::string >(split_line[0]);
-        parameter.atom_number = boost::lexical_cast<unsigned int>(split_line[1]);
-        parameter.atom_mass   = boost::lexical_cast<double      >(split_line[2]);
-        parameter.atom_charge = 0.0;
-        parameter.atom_ptype  = boost::lexical_cast<std::string >(split_line[4]);
-        parameter.sigma       = boost::lexical_cast<double      >(split_line[5]);
-        parameter.epsilon     = boost::lexical_cast<double      >(split_line[6]);
+    using namespace charmm_parameters;
+
+    std::vector<NonBonded14Parameter> parameters(N_NON_BONDED_14_PARAMETERS);
 
-        parameters.push_back(parameter);
+    for (unsigned int i = 0; i < N_NON_BONDED_14_PARAMETERS; i++) {
 
-      }
+        const NonBonded14Record &record = non_bonded_14_parameters[i];
+        NonBonded14Parameter &parameter = parameters[i];
+
+        parameter.atom_type1    = record.atom_type1;
+        parameter.atom_type2    = record.atom_type2;
+        parameter.pair_function = record.pair_function;
+        parameter.sigma         = record.sigma;
+        parameter.epsilon       = record.epsilon;
+    }
 
     return parameters;
 }
 
 
-//! Reads a GROMACS van der Waal "1-4" parameter .itp file (converted to one long string) and returns a vector of parameter objects 
-//! \param itp A parameter file in converted to string
-//! \returns A vector of non-bonded parameters
-std::vector<NonBonded14Parameter> read_nonbonded_14_parameters(const std::string &itp) {
+//! Make a hash index of non-bonded parameters by atom type
+//! \param non_bonded_parameters Non-bonded parameters
+//! \returns Index
+ParameterIndex make_non_bonded_index(const std::vector<NonBondedParameter> &non_bonded_parameters) {
 
-    std::istringstream input_stream(itp);
+    ParameterIndex index;
 
-    std::vector<NonBonded14Parameter> parameters;
+    for (unsigned int i = 0; i < non_bonded_parameters.size(); i++) {
+        const unsigned int id = non_bonded_parameters[i].atom_type;
+        index.add(make_parameter_key(&id, 1), i);
+    }
 
-    while (input_stream.good()) {
+    return index;
+}
 
-        std::string line;
-        std::getline(input_stream, line);
 
-        boost::trim(line);
+//! Find the non-bonded parameter of an atom type
+//! \param atom_type_id Atom type ID
+//! \param non_bonded_parameters Non-bonded parameters
+//! \param non_bonded_index Index of non-bonded parameters (see make_non_bonded_index())
+//! \returns First parameter with the atom type (default parameter if there is none)
+NonBondedParameter get_non_bonded_parameter(const unsigned int atom_type_id,
+        const std::vector<NonBondedParameter> &non_bonded_parameters,
+        const ParameterIndex &non_bonded_index) {
 
-        if (line.size() == 0 || line[0] == ';') {
-            continue;
-        }
+    const std::vector<unsigned int> *matches = non_bonded_index.find(make_parameter_key(&atom_type_id, 1));
 
-        std::vector<std::string> split_line;
-        boost::split(split_line, line, boost::is_any_of(" \t"), boost::token_compress_on);
+    if (matches)
+        return non_bonded_parameters[matches->front()];
 
-        NonBonded14Parameter parameter;
+    return NonBondedParameter();
+}
 
-        parameter.atom_type1    = boost::lexical_cast<std::string >(split_line[0]);
-        parameter.atom_type2    = boost::lexical_cast<std::string >(split_line[1]);
-        parameter.pair_function = boost::lexical_cast<unsigned int>(split_line[2]);
-        parameter.sigma         = boost::lexical_cast<double      >(split_line[3]);
-        parameter.epsilon       = boost::lexical_cast<double      >(split_line[4]);
 
-        parameters.push_back(parameter);
+//! Make a hash index of non-bonded "1-4" parameters by pair of atom types
+//! \param non_bonded14_parameters Non-bonded "1-4" parameters
+//! \returns Index
+ParameterIndex make_non_bonded14_index(const std::vector<NonBonded14Parameter> &non_bonded14_parameters) {
 
-      }
+    ParameterIndex index;
 
-    return parameters;
+    for (unsigned int i = 0; i < non_bonded14_parameters.size(); i++) {
+        const unsigned int ids[2] = {non_bonded14_parameters[i].atom_type1, non_bonded14_parameters[i].atom_type2};
+        index.add(make_canonical_parameter_key(ids, 2), i);
+    }
+
+    return index;
 }
 
+struct AtomTypeInfo {
+    phaistos::Atom  *atom;
+    NonBondedParameter non_bonded_parameter;
+    unsigned int atom_type_id;
+    double charge;
+};
+
 
-NonBondedParameter get_non_bonded_parameter(const std::string &atom_type,
-        const std::vector<NonBondedParameter> &non_bonded_parameters) {
+//! Collect atom type, charge and van der Waals parameters for all atoms in the chain.
+//! \param topology Bond graph and atom types of the protein chain
+//! \param non_bonded_parameters Non-bonded parameters
+//! \returns A vector with an entry for each atom (in chain iteration order)
+std::vector<AtomTypeInfo> generate_atom_type_infos(ChainTopology &topology,
+    const std::vector<NonBondedParameter> &non_bonded_parameters) {
 
-    NonBondedParameter parameter;
+    using namespace phaistos;
 
-    for (unsigned int i = 0; i < non_bonded_parameters.size(); i++) {
+    std::vector<AtomTypeInfo> atom_type_infos;
 
-        if (non_bonded_parameters[i].atom_type == atom_type)
-            return non_bonded_parameters[i];
+    phaistos::ChainFB *chain = topology.get_chain();
+    const ParameterIndex non_bonded_index = make_non_bonded_index(non_bonded_parameters);
+    const eef1_sb_parser::ChainAtomTypes &atom_types = topology.get_atom_types();
 
-    }
+    for (AtomIterator<ChainFB, definitions::ALL> it1(*chain); !it1.end(); ++it1) {
 
-    return parameter;
+        AtomTypeInfo atom_type_info;
+
+        Atom *atom1 = &*it1;
+
+        atom_type_info.atom = atom1;
+        atom_type_info.atom_type_id = atom_types.get_atom_type_id(atom1);
+        atom_type_info.charge = atom_types.get_atom_charge(atom1);
+        atom_type_info.non_bonded_parameter = get_non_bonded_parameter(atom_type_info.atom_type_id,
+                                                                       non_bonded_parameters,
+                                                                       non_bonded_index);
+
+        atom_type_infos.push_back(atom_type_info);
+    }
 
+    return atom_type_infos;
 }
 
-NonBonded14Parameter get_non_bonded14_parameter(const std::string &atom_type1, 
-        const std::string &atom_type2,
+
+//! Find the non-bonded "1-4" parameter of a pair of atoms.
+//! If there is no specific parameter for the pair of atom types, it is
+//! derived from the non-bonded parameters of the two atoms.
+//! \param atom_type_info1 First atom
+//! \param atom_type_info2 Second atom
+//! \param non_bonded14_parameters Non-bonded "1-4" parameters
+//! \param non_bonded14_index Index of non-bonded "1-4" parameters (see make_non_bonded14_index())
+//! \returns Non-bonded "1-4" parameter
+NonBonded14Parameter get_non_bonded14_parameter(const AtomTypeInfo &atom_type_info1,
+        const AtomTypeInfo &atom_type_info2,
         const std::vector<NonBonded14Parameter> &non_bonded14_parameters,
-        const std::vector<NonBondedParameter> &non_bonded_parameters) {
+        const ParameterIndex &non_bonded14_index) {
+
+    const unsigned int ids[2] = {atom_type_info1.atom_type_id, atom_type_info2.atom_type_id};
+    const std::vector<unsigned int> *matches = non_bonded14_index.find(make_canonical_parameter_key(ids, 2));
+
+    if (matches)
+        return non_bonded14_parameters[matches->front()];
+
+    const NonBondedParameter &parameter1 = atom_type_info1.non_bonded_parameter;
+    const NonBondedParameter &parameter2 = atom_type_info2.non_bonded_parameter;
 
     NonBonded14Parameter parameter;
-    bool found_parameter = false;
 
-    for (unsigned int i = 0; i < non_bonded14_parameters.size(); i++) {
+    parameter.atom_type1 = (charmm_parameters::AtomTypeId)atom_type_info1.atom_type_id;
+    parameter.atom_type2 = (charmm_parameters::AtomTypeId)atom_type_info2.atom_type_id;
 
-        if (((non_bonded14_parameters[i].atom_type1 == atom_type1) &&
-             (non_bonded14_parameters[i].atom_type2 == atom_type2)) ||
-            ((non_bonded14_parameters[i].atom_type1 == atom_type2) &&
-             (non_bonded14_parameters[i].atom_type2 == atom_type1))) {
+    const double epsilon_effective = sqrt(parameter1.epsilon * parameter2.epsilon);
+    const double sigma_effective   = 0.5 * (parameter1.sigma + parameter2.sigma);
 
-            parameter = non_bonded14_parameters[i];
-            found_parameter = true;
-            break;
+    parameter.sigma = sigma_effective;
+    parameter.epsilon = epsilon_effective;
+
+    return parameter;
+}
 
+
+//! Find all atom pairs closer than a cutoff using a cell list.
+//! Atoms are binned in a grid with cells no smaller than the cutoff, so only
+//! atoms in the same or neighbouring cells need to be compared, which is O(N).
+//! \param atom_type_infos Atoms (see generate_atom_type_infos())
+//! \param cutoff Distance cutoff (Angstrom)
+//! \returns Pairs of atom indexes (i,j) with i < j, sorted by i, then j
+std::vector<std::pair<unsigned int, unsigned int> > generate_candidate_pairs(const std::vector<AtomTypeInfo> &atom_type_infos,
+                                                                            const double cutoff) {
+
+    using namespace phaistos;
+
+    std::vector<std::pair<unsigned int, unsigned int> > candidate_pairs;
+
+    const unsigned int n_atoms = atom_type_infos.size();
+    if (n_atoms == 0)
+        return candidate_pairs;
+
+    // Bounding box of all atoms
+    Vector_3D lower = atom_type_infos[0].atom->position;
+    Vector_3D upper = atom_type_infos[0].atom->position;
+    for (unsigned int i = 1; i < n_atoms; i++) {
+        const Vector_3D &position = atom_type_infos[i].atom->position;
+        for (unsigned int d = 0; d < 3; d++) {
+            lower[d] = std::min(lower[d], position[d]);
+            upper[d] = std::max(upper[d], position[d]);
         }
     }
 
-    if (!found_parameter) {
+    // Use cells of the size of the cutoff, but make them larger if the grid
+    // would have many more cells than atoms (e.g. for extended chains).
+    double cell_size = cutoff;
+    unsigned int n_cells[3];
+    while (true) {
 
-        NonBondedParameter parameter1 = get_non_bonded_parameter(atom_type1, non_bonded_parameters);
-        NonBondedParameter parameter2 = get_non_bonded_parameter(atom_type2, non_bonded_parameters);
+        double total_cells = 1.0;
+        for (unsigned int d = 0; d < 3; d++) {
+            n_cells[d] = (unsigned int)((upper[d] - lower[d]) / cell_size) + 1;
+            total_cells *= n_cells[d];
+        }
 
-        parameter.atom_type1 = atom_type1;
-        parameter.atom_type2 = atom_type1;
+        if (total_cells <= 8.0 * n_atoms + 64.0)
+            break;
 
-        const double epsilon_effective = sqrt(parameter1.epsilon * parameter2.epsilon);
-        const double sigma_effective   = 0.5 * (parameter1.sigma + parameter2.sigma);
+        cell_size *= 1.25;
+    }
 
-        parameter.sigma = sigma_effective;
-        parameter.epsilon = epsilon_effective;
+    // Bin atoms in cells (counting sort, so atoms in each cell are in increasing order)
+    std::vector<unsigned int> atom_cell(n_atoms);
+    std::vector<unsigned int> cell_start(n_cells[0] * n_cells[1] * n_cells[2] + 1, 0);
+    for (unsigned int i = 0; i < n_atoms; i++) {
 
+        unsigned int cell = 0;
+        for (unsigned int d = 0; d < 3; d++) {
+            const unsigned int c = std::min((unsigned int)((atom_type_infos[i].atom->position[d] - lower[d]) / cell_size),
+                                            n_cells[d] - 1);
+            cell = cell * n_cells[d] + c;
+        }
+        atom_cell[i] = cell;
+        cell_start[cell + 1]++;
+    }
+    for (unsigned int c = 0; c + 1 < cell_start.size(); c++) {
+        cell_start[c + 1] += cell_start[c];
+    }
+    std::vector<unsigned int> cell_atoms(n_atoms);
+    std::vector<unsigned int> cell_fill(cell_start.begin(), cell_start.end() - 1);
+    for (unsigned int i = 0; i < n_atoms; i++) {
+        cell_atoms[cell_fill[atom_cell[i]]++] = i;
     }
 
-    return parameter;
+    const double cutoff_sq = cutoff * cutoff;
+    std::vector<unsigned int> neighbours;
+
+    for (unsigned int i = 0; i < n_atoms; i++) {
+
+        const Vector_3D &position1 = atom_type_infos[i].atom->position;
+
+        const unsigned int cz = atom_cell[i] % n_cells[2];
+        const unsigned int cy = (atom_cell[i] / n_cells[2]) % n_cells[1];
+        const unsigned int cx = atom_cell[i] / (n_cells[2] * n_cells[1]);
+
+        neighbours.clear();
+
+        for (unsigned int x = (cx > 0 ? cx - 1 : 0); x <= std::min(cx + 1, n_cells[0] - 1); x++) {
+            for (unsigned int y = (cy > 0 ? cy - 1 : 0); y <= std::min(cy + 1, n_cells[1] - 1); y++) {
+                for (unsigned int z = (cz > 0 ? cz - 1 : 0); z <= std::min(cz + 1, n_cells[2] - 1); z++) {
+
+                    const unsigned int cell = (x * n_cells[1] + y) * n_cells[2] + z;
+
+                    for (unsigned int k = cell_start[cell]; k < cell_start[cell + 1]; k++) {
+
+                        const unsigned int j = cell_atoms[k];
+
+                        if (j <= i)
+                            continue;
+
+                        if ((atom_type_infos[j].atom->position - position1).norm_squared() < cutoff_sq)
+                            neighbours.push_back(j);
+                    }
+                }
+            }
+        }
+
+        std::sort(neighbours.begin(), neighbours.end());
+
+        for (unsigned int k = 0; k < neighbours.size(); k++) {
+            candidate_pairs.push_back(std::make_pair(i, neighbours[k]));
+        }
+    }
 
+    return candidate_pairs;
 }
 
-struct AtomTypeInfo {
-    phaistos::Atom  *atom;
-    NonBondedParameter non_bonded_parameter;
-    std::string atom_type;
-    double charge;
-};
 
-std::vector<NonBondedInteraction> generate_non_bonded_interactions(phaistos::ChainFB *chain,
-    const std::vector<NonBondedParameter> &non_bonded_parameters,
-    const std::vector<NonBonded14Parameter> &non_bonded_14_parameters) {
+//! Add the non-bonded interaction between two atoms (if they are not excluded).
+//! \param atom_type_info1 First atom
+//! \param atom_type_info2 Second atom
+//! \param d Number of bonds between the atoms (see BondGraph::get_distance())
+//! \param non_bonded_14_parameters Non-bonded 1-4 parameters
+//! \param non_bonded_14_index Index of non-bonded 1-4 parameters (see make_non_bonded14_index())
+//! \param non_bonded_interactions List the interaction is added to
+//! \returns True if an interaction was added
+bool add_non_bonded_interaction(const AtomTypeInfo &atom_type_info1,
+    const AtomTypeInfo &atom_type_info2,
+    const unsigned int d,
+    const std::vector<NonBonded14Parameter> &non_bonded_14_parameters,
+    const ParameterIndex &non_bonded_14_index,
+    std::vector<NonBondedInteraction> &non_bonded_interactions) {
 
     using namespace phaistos;
 
-    std::vector<NonBondedInteraction> non_bonded_interactions;
+    Atom *atom1 = atom_type_info1.atom;
+    Atom *atom2 = atom_type_info2.atom;
 
-    std::vector<AtomTypeInfo> atom_type_infos;
+    if (d < 3)
+        return false;
 
-    for (AtomIterator<ChainFB, definitions::ALL> it1(*chain); !it1.end(); ++it1) {
+    const double atom_charge1 = atom_type_info1.charge;
+    const double atom_charge2 = atom_type_info2.charge;
 
-        AtomTypeInfo atom_type_info;
+    NonBondedInteraction non_bonded_interaction;
 
-        Atom *atom1 = &*it1;
+    non_bonded_interaction.atom1 = atom1;
+    non_bonded_interaction.atom2 = atom2;
+    non_bonded_interaction.qq  = atom_charge1 * atom_charge2 * charmm_constants::FELEC;
 
-        atom_type_info.atom = atom1;
-        atom_type_info.atom_type = eef1_sb_parser::get_atom_type(atom1);
-        atom_type_info.charge = eef1_sb_parser::get_atom_charge(atom1);
-        atom_type_info.non_bonded_parameter = get_non_bonded_parameter(atom_type_info.atom_type,
-                                                                       non_bonded_parameters);
+    if (d > 3) {
 
-        atom_type_infos.push_back(atom_type_info);
-    }
-    
+        const NonBondedParameter &parameter1 = atom_type_info1.non_bonded_parameter;
+        const NonBondedParameter &parameter2 = atom_type_info2.non_bonded_parameter;
 
-    for (unsigned int i = 0; i < atom_type_infos.size(); i++) {
+        const double epsilon_effective = std::sqrt(parameter1.epsilon * parameter2.epsilon);
+        const double sigma_effective   = 0.5 * (parameter1.sigma + parameter2.sigma);
+
+        non_bonded_interaction.c6  = 4 * epsilon_effective * std::pow(sigma_effective, 6.0);
+        non_bonded_interaction.c12 = 4 * epsilon_effective * std::pow(sigma_effective, 12.0);
 
+        non_bonded_interaction.is_14_interaction = false;
 
-        Atom *atom1 = atom_type_infos[i].atom;
-        const std::string atom_type1 = atom_type_infos[i].atom_type;
-        const double atom_charge1 = atom_type_infos[i].charge;
-        const NonBondedParameter parameter1 = atom_type_infos[i].non_bonded_parameter;
+    } else {
 
-        for (unsigned int j = 0; j < atom_type_infos.size(); j++) {
+        const NonBonded14Parameter parameter14 = get_non_bonded14_parameter(atom_type_info1,
+                                                                            atom_type_info2,
+                                                                            non_bonded_14_parameters,
+                                                                            non_bonded_14_index);
 
-            if (i > j) continue;
+        non_bonded_interaction.c6  = 4 * parameter14.epsilon * std::pow(parameter14.sigma, 6.0);
+        non_bonded_interaction.c12 = 4 * parameter14.epsilon * std::pow(parameter14.sigma, 12.0);
 
-            Atom *atom2 = atom_type_infos[j].atom;
-            const std::string atom_type2 = atom_type_infos[j].atom_type;
-            const double atom_charge2 = atom_type_infos[j].charge;
-            const NonBondedParameter parameter2 = atom_type_infos[j].non_bonded_parameter;
+        non_bonded_interaction.is_14_interaction = true;
+    }
 
-            const int d = chain_distance<ChainFB>(atom1,atom2);
+    // No EEF1-SB contribution unless set by the caller
+    non_bonded_interaction.do_eef1 = false;
 
-            if (d > 3) {
-               NonBondedInteraction non_bonded_interaction;
+    non_bonded_interactions.push_back(non_bonded_interaction);
 
-               double epsilon_effective = std::sqrt(parameter1.epsilon * parameter2.epsilon);
-               double sigma_effective   = 0.5 * (parameter1.sigma + parameter2.sigma);
+    return true;
+}
 
-               non_bonded_interaction.atom1 = atom1;
-               non_bonded_interaction.atom2 = atom2;
-               //non_bonded_interaction.q1 = atom_charge1;
-               //non_bonded_interaction.q2 = atom_charge2;
-               //non_bonded_interaction.sigma1 = parameter1.sigma;
-               //non_bonded_interaction.sigma2 = parameter2.sigma;
-               //non_bonded_interaction.epsilon1 = parameter1.epsilon;
-               //non_bonded_interaction.epsilon2 = parameter2.epsilon;
-               //non_bonded_interaction.sigma_effective = sigma_effective;
-               //non_bonded_interaction.epsilon_effective = epsilon_effective;
-               // non_bonded_interaction.qq  = non_bonded_interaction.q1 * non_bonded_interaction.q2 * charmm_constants::FELEC;
-               non_bonded_interaction.qq  = atom_charge1 * atom_charge2 * charmm_constants::FELEC;
-               non_bonded_interaction.c6  = 4 * epsilon_effective * std::pow(sigma_effective, 6.0);
-               non_bonded_interaction.c12 = 4 * epsilon_effective * std::pow(sigma_effective, 12.0);
 
-               non_bonded_interaction.is_14_interaction = false;
+//! Set EEF1-SB parameters of a non-bonded interaction.
+//! \param non_bonded_interaction The interaction
+//! \param eef1_index1 EEF1-SB atom type index of first atom
+//! \param eef1_index2 EEF1-SB atom type index of second atom
+//! \param factors Pairwise EEF1-SB prefactors
+//! \param vdw_radii EEF1-SB van der Waals radii
+//! \param lambda EEF1-SB correlation lengths
+void set_eef1_parameters(NonBondedInteraction &non_bonded_interaction,
+                         const unsigned int eef1_index1,
+                         const unsigned int eef1_index2,
+                         const std::vector< std::vector<double> > &factors,
+                         const std::vector<double> &vdw_radii,
+                         const std::vector<double> &lambda) {
 
-               //non_bonded_interaction.i1 = i;
-               //non_bonded_interaction.i2 = j;
+    using namespace phaistos;
 
+    // EEF1-SB is computed between heavy atoms that are at least three bonds apart (this holds for all interactions)
+    if ((non_bonded_interaction.atom1->mass == definitions::atom_h_weight) ||
+        (non_bonded_interaction.atom2->mass == definitions::atom_h_weight)) {
 
-               non_bonded_interactions.push_back(non_bonded_interaction);
+        non_bonded_interaction.do_eef1 = false;
+        return;
+    }
 
-             } else if (d == 3) {
+    non_bonded_interaction.do_eef1 = true;
 
+    non_bonded_interaction.fac_12 = factors[eef1_index1][eef1_index2];
+    non_bonded_interaction.fac_21 = factors[eef1_index2][eef1_index1];
+    non_bonded_interaction.R_vdw_1 = vdw_radii[eef1_index1];
+    non_bonded_interaction.R_vdw_2 = vdw_radii[eef1_index2];
+    non_bonded_interaction.lambda1 = lambda[eef1_index1];
+    non_bonded_interaction.lambda2 = lambda[eef1_index2];
+}
 
-                NonBonded14Parameter parameter14 = get_non_bonded14_parameter(atom_type1, atom_type2,
-                                                                              non_bonded_14_parameters,
-                                                                              non_bonded_parameters);
 
-                NonBondedParameter parameter2 = get_non_bonded_parameter(atom_type2, non_bonded_parameters);
-                NonBondedInteraction non_bonded_interaction;
+//! Builds the non-bonded interactions of a range of atom pairs (see charmm_parallel::chunked_build()).
+//! The range is either a range of candidate pairs (see generate_candidate_pairs())
+//! or, if no candidate pairs are set, a range of atoms whose pairs with all
+//! later atoms are built.
+struct NonBondedInteractionBuilder {
+
+    //! Atom type information of each atom (see generate_atom_type_infos())
+    const std::vector<AtomTypeInfo> &atom_type_infos;
+
+    //! Bond graph of the chain
+    const BondGraph &bond_graph;
+
+    //! Non-bonded 1-4 parameters
+    const std::vector<NonBonded14Parameter> &non_bonded_14_parameters;
+
+    //! Index of non-bonded 1-4 parameters (see make_non_bonded14_index())
+    const ParameterIndex &non_bonded_14_index;
+
+    //! Candidate pairs (NULL: all pairs)
+    const std::vector<std::pair<unsigned int, unsigned int> > *candidate_pairs;
+
+    //! EEF1-SB parameter index of each atom (NULL: no EEF1-SB parameters are set)
+    const std::vector<unsigned int> *eef1_indexes;
+
+    //! Pairwise EEF1-SB prefactors
+    const std::vector< std::vector<double> > *factors;
+
+    //! EEF1-SB van der Waals radii
+    const std::vector<double> *vdw_radii;
+
+    //! EEF1-SB correlation lengths
+    const std::vector<double> *lambda;
+
+    //! Constructor
+    NonBondedInteractionBuilder(const std::vector<AtomTypeInfo> &atom_type_infos,
+                                const BondGraph &bond_graph,
+                                const std::vector<NonBonded14Parameter> &non_bonded_14_parameters,
+                                const ParameterIndex &non_bonded_14_index)
+        : atom_type_infos(atom_type_infos),
+          bond_graph(bond_graph),
+          non_bonded_14_parameters(non_bonded_14_parameters),
+          non_bonded_14_index(non_bonded_14_index),
+          candidate_pairs(NULL),
+          eef1_indexes(NULL),
+          factors(NULL),
+          vdw_radii(NULL),
+          lambda(NULL) {}
+
+    //! Add the interaction between two atoms (if they are not excluded)
+    //! \param i Index of first atom
+    //! \param j Index of second atom
+    //! \param non_bonded_interactions List the interaction is added to
+    void add_pair(const unsigned int i, const unsigned int j,
+                  std::vector<NonBondedInteraction> &non_bonded_interactions) const {
+
+        if (add_non_bonded_interaction(atom_type_infos[i], atom_type_infos[j], bond_graph.get_distance(i, j),
+                                       non_bonded_14_parameters, non_bonded_14_index,
+                                       non_bonded_interactions) && eef1_indexes) {
+            set_eef1_parameters(non_bonded_interactions.back(), (*eef1_indexes)[i], (*eef1_indexes)[j],
+                                *factors, *vdw_radii, *lambda);
+        }
+    }
 
-                non_bonded_interaction.atom1 = atom1;
-                non_bonded_interaction.atom2 = atom2;
-                // non_bonded_interaction.q1 = atom_charge1;
-                // non_bonded_interaction.q2 = atom_charge2;
-                // non_bonded_interaction.sigma1 = parameter1.sigma;
-                // non_bonded_interaction.sigma2 = parameter2.sigma;
-                // non_bonded_interaction.epsilon1 = parameter1.epsilon;
-                // non_bonded_interaction.epsilon2 = parameter2.epsilon;
-                // non_bonded_interaction.sigma_effective = parameter14.sigma;
-                // non_bonded_interaction.epsilon_effective = parameter14.epsilon;
-                // non_bonded_interaction.qq  = non_bonded_interaction.q1 * non_bonded_interaction.q2 * charmm_constants::FELEC;
-                non_bonded_interaction.qq  = atom_charge1 * atom_charge2 * charmm_constants::FELEC;
-                non_bonded_interaction.c6  = 4 * parameter14.epsilon * std::pow(parameter14.sigma, 6.0);
-                non_bonded_interaction.c12 = 4 * parameter14.epsilon * std::pow(parameter14.sigma, 12.0);
+    //! Add the interactions of a range of candidate pairs or atoms
+    //! \param begin Index of first candidate pair or atom
+    //! \param end Index after last candidate pair or atom
+    //! \param non_bonded_interactions List the interactions are added to
+    void operator()(const unsigned int begin, const unsigned int end,
+                    std::vector<NonBondedInteraction> &non_bonded_interactions) const {
 
-                non_bonded_interaction.is_14_interaction = true;
+        if (candidate_pairs) {
 
-                non_bonded_interactions.push_back(non_bonded_interaction);
+            for (unsigned int k = begin; k < end; k++) {
+                add_pair((*candidate_pairs)[k].first, (*candidate_pairs)[k].second, non_bonded_interactions);
+            }
+
+        } else {
+
+            for (unsigned int i = begin; i < end; i++) {
+                for (unsigned int j = i + 1; j < atom_type_infos.size(); j++) {
+                    add_pair(i, j, non_bonded_interactions);
+                }
             }
         }
     }
+};
+
+
+//! Build non-bonded interactions from candidate pairs within a cutoff or from all atom pairs.
+//! \param builder Builder (its candidate pairs are set here)
+//! \param cutoff Only include atom pairs closer than this distance (Angstrom, 0: all pairs)
+//! \param threads Number of threads (0: all available)
+//! \param non_bonded_interactions Output list
+void build_non_bonded_interactions(NonBondedInteractionBuilder builder,
+                                   const double cutoff,
+                                   const int threads,
+                                   std::vector<NonBondedInteraction> &non_bonded_interactions) {
+
+    if (cutoff > 0.0) {
+
+        const std::vector<std::pair<unsigned int, unsigned int> > candidate_pairs
+            = generate_candidate_pairs(builder.atom_type_infos, cutoff);
+
+        builder.candidate_pairs = &candidate_pairs;
+        charmm_parallel::chunked_build(builder, candidate_pairs.size(), threads, non_bonded_interactions,
+                                       charmm_parallel::DEFAULT_CHUNK_SIZE);
+
+    } else {
+
+        builder.candidate_pairs = NULL;
+        charmm_parallel::chunked_build(builder, builder.atom_type_infos.size(), threads, non_bonded_interactions);
+    }
+}
+
+
+//! Generate non-bonded (van der Waals and Coulomb) interactions.
+//! \param topology Bond graph and atom types of the protein chain
+//! \param non_bonded_parameters Non-bonded parameters
+//! \param non_bonded_14_parameters Non-bonded 1-4 parameters
+//! \param cutoff Only include atom pairs closer than this distance (Angstrom, 0: all pairs)
+//! \param threads Number of threads (0: all available). The result does not depend on the number of threads.
+//! \returns A vector of non-bonded interactions
+std::vector<NonBondedInteraction> generate_non_bonded_interactions(ChainTopology &topology,
+    const std::vector<NonBondedParameter> &non_bonded_parameters,
+    const std::vector<NonBonded14Parameter> &non_bonded_14_parameters,
+    const double cutoff=0.0,
+    const int threads=1) {
+
+    std::vector<NonBondedInteraction> non_bonded_interactions;
+
+    const std::vector<AtomTypeInfo> atom_type_infos = generate_atom_type_infos(topology, non_bonded_parameters);
+    const ParameterIndex non_bonded_14_index = make_non_bonded14_index(non_bonded_14_parameters);
+
+    const NonBondedInteractionBuilder builder(atom_type_infos, topology.get_bond_graph(),
+                                              non_bonded_14_parameters, non_bonded_14_index);
+
+    build_non_bonded_interactions(builder, cutoff, threads, non_bonded_interactions);
 
     return non_bonded_interactions;
 }
 
+//! Generate non-bonded (van der Waals and Coulomb) interactions.
+//! \param chain The protein chain object.
+//! \param non_bonded_parameters Non-bonded parameters
+//! \param non_bonded_14_parameters Non-bonded 1-4 parameters
+//! \param cutoff Only include atom pairs closer than this distance (Angstrom, 0: all pairs)
+//! \param threads Number of threads (0: all available). The result does not depend on the number of threads.
+//! \returns A vector of non-bonded interactions
+std::vector<NonBondedInteraction> generate_non_bonded_interactions(phaistos::ChainFB *chain,
+    const std::vector<NonBondedParameter> &non_bonded_parameters,
+    const std::vector<NonBonded14Parameter> &non_bonded_14_parameters,
+    const double cutoff=0.0,
+    const int threads=1) {
+
+    ChainTopology topology(chain);
+    return generate_non_bonded_interactions(topology, non_bonded_parameters, non_bonded_14_parameters,
+                                            cutoff, threads);
+}
+
 
+//! Generate non-bonded (van der Waals, Coulomb and EEF1-SB) interactions.
+//! \param topology Bond graph and atom types of the protein chain
+//! \param non_bonded_parameters Non-bonded parameters
+//! \param non_bonded_14_parameters Non-bonded 1-4 parameters
+//! \param dGref EEF1-SB reference solvation free energies
+//! \param factors Pairwise EEF1-SB prefactors
+//! \param vdw_radii EEF1-SB van der Waals radii
+//! \param lambda EEF1-SB correlation lengths
+//! \param eef1_atom_type_indexes EEF1-SB parameter index of each atom type ID
+//! \param cutoff Only include atom pairs closer than this distance (Angstrom, 0: all pairs)
+//! \param threads Number of threads (0: all available). The result does not depend on the number of threads.
+//! \returns A vector of non-bonded interactions
+std::vector<NonBondedInteraction> generate_non_bonded_interactions_cached(ChainTopology &topology,
+                    const std::vector<NonBondedParameter> &non_bonded_parameters,
+                    const std::vector<NonBonded14Parameter> &non_bonded_14_parameters,
+                    const std::vector<double> &dGref,
+                    const std::vector< std::vector<double> > &factors,
+                    const std::vector<double> &vdw_radii,
+                    const std::vector<double> &lambda,
+                    const std::vector<unsigned int> &eef1_atom_type_indexes,
+                    const double cutoff=0.0,
+                    const int threads=1) {
+
+    std::vector<NonBondedInteraction> non_bonded_interactions;
+
+    const std::vector<AtomTypeInfo> atom_type_infos = generate_atom_type_infos(topology, non_bonded_parameters);
+    const ParameterIndex non_bonded_14_index = make_non_bonded14_index(non_bonded_14_parameters);
+
+    // Look up EEF1-SB parameter index once per heavy atom
+    std::vector<unsigned int> eef1_indexes(atom_type_infos.size(), 0);
+    for (unsigned int i = 0; i < atom_type_infos.size(); i++) {
+        if (atom_type_infos[i].atom->mass != phaistos::definitions::atom_h_weight)
+            eef1_indexes[i] = eef1_atom_type_indexes[atom_type_infos[i].atom_type_id];
+    }
+
+    NonBondedInteractionBuilder builder(atom_type_infos, topology.get_bond_graph(),
+                                        non_bonded_14_parameters, non_bonded_14_index);
+    builder.eef1_indexes = &eef1_indexes;
+    builder.factors = &factors;
+    builder.vdw_radii = &vdw_radii;
+    builder.lambda = &lambda;
+
+    build_non_bonded_interactions(builder, cutoff, threads, non_bonded_interactions);
 
+    return non_bonded_interactions;
+}
+
+//! Generate non-bonded (van der Waals, Coulomb and EEF1-SB) interactions.
+//! \param chain The protein chain object.
+//! \param non_bonded_parameters Non-bonded parameters
+//! \param non_bonded_14_parameters Non-bonded 1-4 parameters
+//! \param dGref EEF1-SB reference solvation free energies
+//! \param factors Pairwise EEF1-SB prefactors
+//! \param vdw_radii EEF1-SB van der Waals radii
+//! \param lambda EEF1-SB correlation lengths
+//! \param eef1_atom_type_indexes EEF1-SB parameter index of each atom type ID
+//! \param cutoff Only include atom pairs closer than this distance (Angstrom, 0: all pairs)
+//! \param threads Number of threads (0: all available). The result does not depend on the number of threads.
+//! \returns A vector of non-bonded interactions
 std::vector<NonBondedInteraction> generate_non_bonded_interactions_cached(phaistos::ChainFB *chain,
                     const std::vector<NonBondedParameter> &non_bonded_parameters,
                     const std::vector<NonBonded14Parameter> &non_bonded_14_parameters,
@@ -375,298 +813,564 @@ std::vector<NonBondedInteraction> generate_non_bonded_interactions_cached(phaist
                     const std::vector< std::vector<double> > &factors,
                     const std::vector<double> &vdw_radii,
                     const std::vector<double> &lambda,
-                    // &eef1_atom_type_index_map cannot be const for some reason?
-                    std::map<std::string, unsigned int> &eef1_atom_type_index_map) {
+                    const std::vector<unsigned int> &eef1_atom_type_indexes,
+                    const double cutoff=0.0,
+                    const int threads=1) {
+
+    ChainTopology topology(chain);
+    return generate_non_bonded_interactions_cached(topology, non_bonded_parameters, non_bonded_14_parameters,
+                                                   dGref, factors, vdw_radii, lambda, eef1_atom_type_indexes,
+                                                   cutoff, threads);
+}
 
-    using namespace phaistos;
 
-    std::vector<NonBondedInteraction> non_bonded_interactions;
+//! Returns the torsion parameters from the table generated from torsion.itp
+//! \returns A vector of torsion parameters
+std::vector<TorsionParameter> get_torsion_parameters() {
 
-    std::vector<AtomTypeInfo> atom_type_infos;
+    using namespace charmm_parameters;
 
-    for (AtomIterator<ChainFB, definitions::ALL> it1(*chain); !it1.end(); ++it1) {
+    std::vector<TorsionParameter> parameters(N_TORSION_PARAMETERS);
 
-        AtomTypeInfo atom_type_info;
+    for (unsigned int i = 0; i < N_TORSION_PARAMETERS; i++) {
 
-        Atom *atom1 = &*it1;
+        const TorsionRecord &record = torsion_parameters[i];
+        TorsionParameter &parameter = parameters[i];
 
-        atom_type_info.atom = atom1;
-        atom_type_info.atom_type = eef1_sb_parser::get_atom_type(atom1);
-        atom_type_info.charge = eef1_sb_parser::get_atom_charge(atom1);
-        atom_type_info.non_bonded_parameter = get_non_bonded_parameter(atom_type_info.atom_type,
-                                                                       non_bonded_parameters);
+        parameter.type1 = record.type1;
+        parameter.type2 = record.type2;
+        parameter.type3 = record.type3;
+        parameter.type4 = record.type4;
+        parameter.phi0  = record.phi0;
+        parameter.cp    = record.cp;
+        parameter.mult  = record.mult;
+    }
 
-        atom_type_infos.push_back(atom_type_info);
+    return parameters;
+}
+
+
+//! Atoms defining a side chain dihedral angle (chi1 to chi4)
+//! \param residue_type Residue type
+//! \param chi Index of the angle (0 for chi1)
+//! \param atoms The four atoms (output)
+//! \returns False if the residue type does not have this angle
+inline bool get_sidechain_dihedral_atoms(const phaistos::definitions::ResidueEnum residue_type,
+                                         const unsigned int chi,
+                                         phaistos::definitions::AtomEnum *atoms) {
+
+    using namespace phaistos::definitions;
+
+    switch (chi) {
+    case 0:
+        atoms[0] = N; atoms[1] = CA; atoms[2] = CB;
+        switch (residue_type) {
+        case ARG: case ASN: case ASP: case GLN: case GLU: case HIS: case LEU:
+        case LYS: case MET: case PHE: case PRO: case TRP: case TYR: atoms[3] = CG; return true;
+        case ILE: case VAL: atoms[3] = CG1; return true;
+        case SER: atoms[3] = OG; return true;
+        case THR: atoms[3] = OG1; return true;
+        case CYS: atoms[3] = SG; return true;
+        default: return false;
+        }
+    case 1:
+        atoms[0] = CA; atoms[1] = CB; atoms[2] = CG;
+        switch (residue_type) {
+        case ARG: case GLN: case GLU: case LYS: case PRO: atoms[3] = CD; return true;
+        case LEU: case PHE: case TRP: case TYR: atoms[3] = CD1; return true;
+        case ASN: case ASP: atoms[3] = OD1; return true;
+        case HIS: atoms[3] = ND1; return true;
+        case MET: atoms[3] = SD; return true;
+        case ILE: atoms[2] = CG1; atoms[3] = CD1; return true;
+        default: return false;
+        }
+    case 2:
+        atoms[0] = CB; atoms[1] = CG; atoms[2] = CD;
+        switch (residue_type) {
+        case ARG: atoms[3] = NE; return true;
+        case GLN: case GLU: atoms[3] = OE1; return true;
+        case LYS: atoms[3] = CE; return true;
+        case MET: atoms[2] = SD; atoms[3] = CE; return true;
+        default: return false;
+        }
+    case 3:
+        atoms[0] = CG; atoms[1] = CD;
+        switch (residue_type) {
+        case ARG: atoms[2] = NE; atoms[3] = CZ; return true;
+        case LYS: atoms[2] = CE; atoms[3] = NZ; return true;
+        default: return false;
+        }
+    default:
+        return false;
     }
-    
+}
 
-    for (unsigned int i = 0; i < atom_type_infos.size(); i++) {
 
+//! Current value of a torsional degree of freedom as stored in the chain
+//! \param residue Residue
+//! \param dof_type Degree of freedom (DOF_PHI, ..., DOF_CHI4)
+//! \param sidechain_dihedrals Side chain dihedrals of the residue (as returned by get_sidechain_dihedrals())
+//! \returns The angle in radians
+inline double get_degree_of_freedom(phaistos::ResidueFB &residue,
+                                    const unsigned int dof_type,
+                                    const std::vector<double> &sidechain_dihedrals) {
+
+    switch (dof_type) {
+    case DOF_PHI:
+        return residue.get_phi();
+    case DOF_PSI:
+        return residue.get_psi();
+    case DOF_OMEGA:
+        return residue.get_omega();
+    default:
+        return sidechain_dihedrals[dof_type - DOF_CHI1];
+    }
+}
 
-        Atom *atom1 = atom_type_infos[i].atom;
-        const std::string atom_type1 = atom_type_infos[i].atom_type;
-        const double atom_charge1 = atom_type_infos[i].charge;
-        const NonBondedParameter parameter1 = atom_type_infos[i].non_bonded_parameter;
 
-        for (unsigned int j = 0; j < atom_type_infos.size(); j++) {
+//! Flag the torsions that can be read from the internal coordinates of the chain.
+//! A torsion corresponds to a degree of freedom of ChainFB (phi, psi, omega or chi1-4)
+//! if it has the same central bond. Its dihedral angle then differs from the degree
+//! of freedom by a constant offset as long as bond angles are unchanged. A degree of
+//! freedom is only used if the value stored in the chain matches the standard
+//! definition from the atom positions, so both conventions for the residue that
+//! omega belongs to are recognized, and torsions are otherwise left to be
+//! computed from Cartesian coordinates.
+//! \param chain The protein chain object.
+//! \param torsion_interactions Torsion interactions, which are flagged (dof_type, dof_residue_index)
+void flag_torsion_degrees_of_freedom(phaistos::ChainFB *chain,
+                                     std::vector<TorsionInteraction> &torsion_interactions) {
 
-            if (i > j) continue;
+    using namespace phaistos;
+    using namespace definitions;
 
-            Atom *atom2 = atom_type_infos[j].atom;
-            const std::string atom_type2 = atom_type_infos[j].atom_type;
-            const double atom_charge2 = atom_type_infos[j].charge;
-            const NonBondedParameter parameter2 = atom_type_infos[j].non_bonded_parameter;
+    typedef std::pair<Atom *, Atom *> Bond;
 
-            const int d = chain_distance<ChainFB>(atom1,atom2);
+    // Degree of freedom (residue, type) of each central bond
+    std::map<Bond, std::pair<int, unsigned int> > bond_dofs;
 
-            if (d > 3) {
-               NonBondedInteraction non_bonded_interaction;
+    for (int r = 0; r < chain->size(); r++) {
 
-               double epsilon_effective = sqrt(parameter1.epsilon * parameter2.epsilon);
-               double sigma_effective   = 0.5 * (parameter1.sigma + parameter2.sigma);
+        ResidueFB &residue = (*chain)[r];
+        Residue *previous = residue.get_neighbour(-1);
+        Residue *next = residue.get_neighbour(+1);
 
-               non_bonded_interaction.atom1 = atom1;
-               non_bonded_interaction.atom2 = atom2;
-               // non_bonded_interaction.q1 = atom_charge1;
-               // non_bonded_interaction.q2 = atom_charge2;
-               // non_bonded_interaction.sigma1 = parameter1.sigma;
-               // non_bonded_interaction.sigma2 = parameter2.sigma;
-               // non_bonded_interaction.epsilon1 = parameter1.epsilon;
-               // non_bonded_interaction.epsilon2 = parameter2.epsilon;
-               // non_bonded_interaction.sigma_effective = sigma_effective;
-               // non_bonded_interaction.epsilon_effective = epsilon_effective;
-               // non_bonded_interaction.qq  = non_bonded_interaction.q1 * non_bonded_interaction.q2 * charmm_constants::FELEC;
-               non_bonded_interaction.qq  = atom_charge1 * atom_charge2 * charmm_constants::FELEC;
-               non_bonded_interaction.c6  = 4 * epsilon_effective * std::pow(sigma_effective, 6.0);
-               non_bonded_interaction.c12 = 4 * epsilon_effective * std::pow(sigma_effective, 12.0);
+        const std::vector<double> sidechain_dihedrals = residue.get_sidechain_dihedrals();
 
-               non_bonded_interaction.is_14_interaction = false;
+        for (unsigned int dof_type = 0; dof_type < N_DOF_TYPES; dof_type++) {
 
-               // non_bonded_interaction.i1 = i;
-               // non_bonded_interaction.i2 = j;
+            // Candidate definitions of the degree of freedom
+            std::vector<std::vector<Atom *> > candidates;
 
-               if (!(atom1->mass == definitions::atom_h_weight) &&
-                   !(chain_distance<ChainFB>(atom1,atom2) < 3) &&
-                   !(atom2->mass == definitions::atom_h_weight)) {
+            if (dof_type == DOF_PHI && previous) {
+                Atom *atoms[4] = {(*previous)[C], residue[N], residue[CA], residue[C]};
+                candidates.push_back(std::vector<Atom *>(atoms, atoms+4));
+            } else if (dof_type == DOF_PSI && next) {
+                Atom *atoms[4] = {residue[N], residue[CA], residue[C], (*next)[N]};
+                candidates.push_back(std::vector<Atom *>(atoms, atoms+4));
+            } else if (dof_type == DOF_OMEGA) {
+                if (previous) {
+                    Atom *atoms[4] = {(*previous)[CA], (*previous)[C], residue[N], residue[CA]};
+                    candidates.push_back(std::vector<Atom *>(atoms, atoms+4));
+                }
+                if (next) {
+                    Atom *atoms[4] = {residue[CA], residue[C], (*next)[N], (*next)[CA]};
+                    candidates.push_back(std::vector<Atom *>(atoms, atoms+4));
+                }
+            } else if (dof_type >= DOF_CHI1 && dof_type - DOF_CHI1 < sidechain_dihedrals.size()) {
+                AtomEnum atom_types[4];
+                if (get_sidechain_dihedral_atoms(residue.residue_type, dof_type - DOF_CHI1, atom_types) &&
+                    residue.has_atom(atom_types[0]) && residue.has_atom(atom_types[1]) &&
+                    residue.has_atom(atom_types[2]) && residue.has_atom(atom_types[3])) {
+                    Atom *atoms[4] = {residue[atom_types[0]], residue[atom_types[1]], residue[atom_types[2]], residue[atom_types[3]]};
+                    candidates.push_back(std::vector<Atom *>(atoms, atoms+4));
+                }
+            }
 
-                   non_bonded_interaction.do_eef1 = true;
+            if (candidates.empty())
+                continue;
 
-                   std::string atom_type36_1 = atom_type_infos[i].atom_type;
-                   std::string atom_type36_2 = atom_type_infos[j].atom_type;
+            const double value = get_degree_of_freedom(residue, dof_type, sidechain_dihedrals);
 
-                   unsigned int index1 = eef1_atom_type_index_map[atom_type36_1];
-                   unsigned int index2 = eef1_atom_type_index_map[atom_type36_2];
+            for (unsigned int c = 0; c < candidates.size(); c++) {
 
-                   non_bonded_interaction.fac_12 = factors[index1][index2];
-                   non_bonded_interaction.fac_21 = factors[index2][index1];
-                   non_bonded_interaction.R_vdw_1 = vdw_radii[index1];
-                   non_bonded_interaction.R_vdw_2 = vdw_radii[index2];
-                   non_bonded_interaction.lambda1 = lambda[index1];
-                   non_bonded_interaction.lambda2 = lambda[index2];
+                const std::vector<Atom *> &atoms = candidates[c];
+                if (!atoms[0] || !atoms[1] || !atoms[2] || !atoms[3])
+                    continue;
 
-               } else { 
-                   non_bonded_interaction.do_eef1 = false;
-               }
-               non_bonded_interactions.push_back(non_bonded_interaction);
+                const double dihedral = calc_dihedral(atoms[0]->position, atoms[1]->position,
+                                                      atoms[2]->position, atoms[3]->position);
 
-             } else if (d == 3) {
+                // Accept the definition if it reproduces the stored value
+                if (std::fabs(std::sin(0.5 * (dihedral - value))) < 1e-6) {
+                    bond_dofs[Bond(std::min(atoms[1], atoms[2]), std::max(atoms[1], atoms[2]))] = std::make_pair(r, dof_type);
+                    break;
+                }
+            }
+        }
+    }
 
+    for (unsigned int i = 0; i < torsion_interactions.size(); i++) {
 
-                NonBonded14Parameter parameter14 = get_non_bonded14_parameter(atom_type1, atom_type2,
-                                                                              non_bonded_14_parameters,
-                                                                              non_bonded_parameters);
+        TorsionInteraction &interaction = torsion_interactions[i];
 
-                NonBondedParameter parameter2 = get_non_bonded_parameter(atom_type2, non_bonded_parameters);
-                NonBondedInteraction non_bonded_interaction;
+        std::map<Bond, std::pair<int, unsigned int> >::const_iterator it =
+            bond_dofs.find(Bond(std::min(interaction.atom2, interaction.atom3), std::max(interaction.atom2, interaction.atom3)));
 
-                non_bonded_interaction.atom1 = atom1;
-                non_bonded_interaction.atom2 = atom2;
-                // non_bonded_interaction.q1 = atom_charge1;
-                // non_bonded_interaction.q2 = atom_charge2;
-                // non_bonded_interaction.sigma1 = parameter1.sigma;
-                // non_bonded_interaction.sigma2 = parameter2.sigma;
-                // non_bonded_interaction.epsilon1 = parameter1.epsilon;
-                // non_bonded_interaction.epsilon2 = parameter2.epsilon;
-                // non_bonded_interaction.sigma_effective = parameter14.sigma;
-                // non_bonded_interaction.epsilon_effective = parameter14.epsilon;
-                non_bonded_interaction.qq  = atom_charge1 * atom_charge2 * charmm_constants::FELEC;
-                non_bonded_interaction.c6  = 4 * parameter14.epsilon * std::pow(parameter14.sigma, 6.0);
-                non_bonded_interaction.c12 = 4 * parameter14.epsilon * std::pow(parameter14.sigma, 12.0);
+        if (it == bond_dofs.end()) {
+            interaction.dof_type = DOF_NONE;
+            interaction.dof_residue_index = -1;
+        } else {
+            interaction.dof_residue_index = it->second.first;
+            interaction.dof_type = it->second.second;
+        }
+    }
+}
 
-                non_bonded_interaction.is_14_interaction = true;
 
-               if (!(atom1->mass == definitions::atom_h_weight) &&
-                   !(chain_distance<ChainFB>(atom1,atom2) < 3) &&
-                   !(atom2->mass == definitions::atom_h_weight)) {
+//! Make hash indexes of torsion parameters. Parameters with specific atom types
+//! are indexed by all four atom types, X-A-B-X wildcard parameters by the two
+//! central atom types.
+//! \param torsion_parameters Torsion parameters
+//! \returns Indexes
+TieredParameterIndex make_torsion_index(const std::vector<TorsionParameter> &torsion_parameters) {
 
-                   non_bonded_interaction.do_eef1 = true;
+    TieredParameterIndex index;
 
-                   std::string atom_type36_1 = atom_type_infos[i].atom_type;
-                   std::string atom_type36_2 = atom_type_infos[j].atom_type;
-
-                   unsigned int index1 = eef1_atom_type_index_map[atom_type36_1];
-                   unsigned int index2 = eef1_atom_type_index_map[atom_type36_2];
+    for (unsigned int i = 0; i < torsion_parameters.size(); i++) {
 
-                   non_bonded_interaction.fac_12 = factors[index1][index2];
-                   non_bonded_interaction.fac_21 = factors[index2][index1];
-                   non_bonded_interaction.R_vdw_1 = vdw_radii[index1];
-                   non_bonded_interaction.R_vdw_2 = vdw_radii[index2];
-                   non_bonded_interaction.lambda1 = lambda[index1];
-                   non_bonded_interaction.lambda2 = lambda[index2];
-
-               } else { 
-                   non_bonded_interaction.do_eef1 = false;
-               }
-
-                non_bonded_interactions.push_back(non_bonded_interaction);
-            }
+        const TorsionParameter &p = torsion_parameters[i];
+
+        const unsigned int ids[4] = {p.type1, p.type2, p.type3, p.type4};
+
+        index.specific.add(make_canonical_parameter_key(ids, 4), i);
+
+        if ((ids[0] == charmm_parameters::ATOM_TYPE_X) && (ids[3] == charmm_parameters::ATOM_TYPE_X))
+            index.wildcard.add(make_canonical_parameter_key(ids + 1, 2), i);
+    }
+
+    return index;
+}
+
+
+//! Atoms of other residues within this number of bonds of a residue are part of
+//! its context (see get_residue_context_key())
+const unsigned int RESIDUE_CONTEXT_BONDS = 2;
+
+//! Key of the context of a residue: its template key (residue type, terminal and
+//! protonation state), its atoms, and the atoms of other residues within
+//! RESIDUE_CONTEXT_BONDS bonds of it (by residue offset, position in the residue,
+//! name and atom type). Each atom of a bonded interaction is within two bonds of
+//! the atom (or residue) the interaction is built from, so the bonded interactions
+//! built from residues with the same context only differ in their atom pointers.
+//! \param chain The protein chain object.
+//! \param bond_graph Bond graph of the chain
+//! \param atom_types Atom types of the chain
+//! \param r Residue index
+//! \returns Key
+std::vector<unsigned int> get_residue_context_key(phaistos::ChainFB *chain,
+                                                  const BondGraph &bond_graph,
+                                                  const eef1_sb_parser::ChainAtomTypes &atom_types,
+                                                  const int r) {
+
+    using namespace phaistos;
+
+    const unsigned int begin = bond_graph.residue_begin[r];
+    const unsigned int end = bond_graph.residue_begin[r+1];
+
+    std::vector<unsigned int> key;
+    key.push_back(eef1_sb_parser::get_residue_template_key(&(*chain)[r]));
+    key.push_back(end - begin);
+
+    std::vector<unsigned int> context_atoms;
+    for (unsigned int index = begin; index < end; index++) {
+
+        key.push_back(bond_graph.atoms[index]->atom_type);
+        key.push_back(atom_types.get_atom_type_id(bond_graph.atoms[index]));
+
+        const std::vector<std::pair<unsigned int, unsigned int> > &neighbours = bond_graph.neighbours[index];
+        for (unsigned int k = 0; k < neighbours.size(); k++) {
+            if ((neighbours[k].second <= RESIDUE_CONTEXT_BONDS) &&
+                (neighbours[k].first < begin || neighbours[k].first >= end))
+                context_atoms.push_back(neighbours[k].first);
         }
     }
 
-    return non_bonded_interactions;
+    std::sort(context_atoms.begin(), context_atoms.end());
+    context_atoms.erase(std::unique(context_atoms.begin(), context_atoms.end()), context_atoms.end());
+
+    for (unsigned int k = 0; k < context_atoms.size(); k++) {
+        Atom *atom = bond_graph.atoms[context_atoms[k]];
+        key.push_back(atom->residue->index - r);
+        key.push_back(context_atoms[k] - bond_graph.residue_begin[atom->residue->index]);
+        key.push_back(atom->atom_type);
+        key.push_back(atom_types.get_atom_type_id(atom));
+    }
+
+    return key;
 }
 
 
-std::vector<TorsionParameter> read_torsion_parameters(const std::string &itp) {
+//! Interaction of a residue template, with its atoms given relative to the residue
+template <typename INTERACTION>
+struct ResidueTemplateEntry {
+
+    //! Residue of each atom, relative to the residue the template is stamped on
+    int residue_offsets[4];
+
+    //! Position of each atom in its residue
+    unsigned int positions[4];
+
+    //! Interaction (with NULL atom pointers)
+    INTERACTION interaction;
+};
+
+
+//! Builds interactions by stamping residue templates (see charmm_parallel::chunked_build()).
+//! The interactions built by BUILDER from the atoms of the first residue with each
+//! context (see get_residue_context_key()) are stored as a template when the
+//! stamper is constructed. The template is then copied with the atom pointers of
+//! each residue with the same context. The interactions are in the same order as if
+//! BUILDER was used for the whole chain. Only worth it if building the interactions
+//! of a residue costs more than its context key, as for torsions.
+template <typename BUILDER, typename INTERACTION>
+class ResidueTemplateBuilder {
 
-    std::istringstream input_stream(itp);
+    //! Bond graph of the chain
+    const BondGraph &bond_graph;
 
-    std::vector<TorsionParameter> parameters;
+    //! Templates, in order of the first residue with their context
+    std::vector<std::vector<ResidueTemplateEntry<INTERACTION> > > templates;
 
-    while (input_stream.good()) {
+    //! Template of each residue
+    std::vector<unsigned int> residue_templates;
 
-        std::string line;
-        std::getline(input_stream, line);
+    //! Make a template from the interactions of a residue
+    //! \param r Residue index
+    //! \param interactions Interactions built from the residue
+    //! \returns Template
+    std::vector<ResidueTemplateEntry<INTERACTION> > make_template(const int r,
+                                                                  const std::vector<INTERACTION> &interactions) const {
 
-        boost::trim(line);
+        std::vector<ResidueTemplateEntry<INTERACTION> > entries(interactions.size());
 
-        // std::cout << line << std::endl;
-        if (line.size() == 0 || line[0] == ';') {
-            continue;
+        for (unsigned int i = 0; i < interactions.size(); i++) {
+
+            ResidueTemplateEntry<INTERACTION> &entry = entries[i];
+            entry.interaction = interactions[i];
+
+            phaistos::Atom **atom_pointers[4];
+            const unsigned int n = get_atom_pointers(entry.interaction, atom_pointers);
+            for (unsigned int k = 0; k < n; k++) {
+                const int residue_index = (*atom_pointers[k])->residue->index;
+                entry.residue_offsets[k] = residue_index - r;
+                entry.positions[k] = bond_graph.get_index(*atom_pointers[k]) - bond_graph.residue_begin[residue_index];
+                *atom_pointers[k] = NULL;
+            }
         }
 
-        std::vector<std::string> split_line;
-        boost::split(split_line, line, boost::is_any_of(" \t"), boost::token_compress_on);
+        return entries;
+    }
 
-        TorsionParameter parameter;
+public:
 
-        parameter.type1 = boost::lexical_cast<std::string >(split_line[0]);
-        parameter.type2 = boost::lexical_cast<std::string >(split_line[1]);
-        parameter.type3 = boost::lexical_cast<std::string >(split_line[2]);
-        parameter.type4 = boost::lexical_cast<std::string >(split_line[3]);
-        parameter.phi0  = boost::lexical_cast<double>(split_line[5]);
-        parameter.cp    = boost::lexical_cast<double>(split_line[6]);
-        parameter.mult  = boost::lexical_cast<unsigned int >(split_line[7]);
+    //! Constructor. Builds the templates of all residue contexts in the chain.
+    //! \param builder Builder of the interactions of a range of atoms
+    //! \param chain Molecule chain
+    //! \param bond_graph Bond graph of the chain
+    //! \param atom_types Atom types of the chain
+    ResidueTemplateBuilder(const BUILDER &builder,
+                           phaistos::ChainFB *chain,
+                           const BondGraph &bond_graph,
+                           const eef1_sb_parser::ChainAtomTypes &atom_types)
+        : bond_graph(bond_graph),
+          residue_templates(chain->size()) {
 
-        parameters.push_back(parameter);
+        std::map<std::vector<unsigned int>, unsigned int> template_indices;
+        std::vector<INTERACTION> residue_interactions;
 
-      }
+        for (int r = 0; r < chain->size(); r++) {
 
-    return parameters;
+            const std::vector<unsigned int> key = get_residue_context_key(chain, bond_graph, atom_types, r);
+
+            std::map<std::vector<unsigned int>, unsigned int>::const_iterator it = template_indices.find(key);
+            if (it != template_indices.end()) {
+                residue_templates[r] = it->second;
+                continue;
+            }
+
+            residue_interactions.clear();
+            builder(bond_graph.residue_begin[r], bond_graph.residue_begin[r+1], residue_interactions);
+
+            residue_templates[r] = templates.size();
+            template_indices.insert(std::make_pair(key, residue_templates[r]));
+            templates.push_back(make_template(r, residue_interactions));
+        }
+    }
+
+    //! Add the interactions of a range of residues
+    //! \param begin Index of first residue
+    //! \param end Index after last residue
+    //! \param interactions List the interactions are added to
+    void operator()(const unsigned int begin, const unsigned int end,
+                    std::vector<INTERACTION> &interactions) const {
+
+        for (unsigned int r = begin; r < end; r++) {
+
+            const std::vector<ResidueTemplateEntry<INTERACTION> > &residue_template = templates[residue_templates[r]];
+
+            for (unsigned int i = 0; i < residue_template.size(); i++) {
+
+                const ResidueTemplateEntry<INTERACTION> &entry = residue_template[i];
+
+                interactions.push_back(entry.interaction);
+
+                phaistos::Atom **atom_pointers[4];
+                const unsigned int n = get_atom_pointers(interactions.back(), atom_pointers);
+                for (unsigned int k = 0; k < n; k++) {
+                    *atom_pointers[k]
+                        = bond_graph.atoms[bond_graph.residue_begin[r + entry.residue_offsets[k]] + entry.positions[k]];
+                }
+            }
+        }
+    }
+};
+
+
+//! Make a torsion interaction
+//! \param atom1 First atom
+//! \param atom2 Second atom
+//! \param atom3 Third atom
+//! \param atom4 Fourth atom
+//! \param p Torsion parameter
+//! \returns Torsion interaction
+TorsionInteraction make_torsion_interaction(phaistos::Atom *atom1, phaistos::Atom *atom2,
+                                            phaistos::Atom *atom3, phaistos::Atom *atom4,
+                                            const TorsionParameter &p) {
+
+    TorsionInteraction torsion_interaction;
+    torsion_interaction.atom1 = atom1;
+    torsion_interaction.atom2 = atom2;
+    torsion_interaction.atom3 = atom3;
+    torsion_interaction.atom4 = atom4;
+    torsion_interaction.phi0  = p.phi0;
+    torsion_interaction.cp    = p.cp;
+    torsion_interaction.mult  = p.mult;
+    return torsion_interaction;
 }
 
 
-std::vector<TorsionInteraction> generate_torsion_interactions(phaistos::ChainFB *chain,
-    const std::vector<TorsionParameter> &torsion_parameters) {
+//! Builds the torsion interactions around the bonds of a range of atoms (see charmm_parallel::chunked_build())
+struct TorsionInteractionBuilder {
 
-    using namespace phaistos;
+    //! Bond graph of the chain
+    const BondGraph &bond_graph;
 
-    std::vector<TorsionInteraction> torsion_interactions;
+    //! Atom types of the chain
+    const eef1_sb_parser::ChainAtomTypes &atom_types;
 
-    // all torsions
-    for (AtomIterator<ChainFB, definitions::ALL> it2(*chain); !it2.end(); ++it2) {
-        Atom *atom2 = &*it2;
-        for (AtomIterator<ChainFB, definitions::ALL> it3(*chain); !it3.end(); ++it3) {
-            Atom *atom3 = &*it3;
+    //! Torsion parameters
+    const std::vector<TorsionParameter> &torsion_parameters;
 
-            if ((atom2->residue->index >
-                 atom3->residue->index ) ||
-                ((atom2->residue->index == atom3->residue->index) &&
-                 (atom2->index > atom3->index)))
-                continue;
+    //! Indexes of torsion parameters (see make_torsion_index())
+    const TieredParameterIndex &torsion_index;
 
-            if(chain_distance<ChainFB>(atom2,atom3) != 1)
-                continue;
-            for (CovalentBondIterator<ChainFB> it1(atom2, CovalentBondIterator<ChainFB>::DEPTH_1_ONLY);
-                !it1.end(); ++it1) {
-                Atom *atom1 = &*it1;
-                for (CovalentBondIterator<ChainFB> it4(atom3, CovalentBondIterator<ChainFB>::DEPTH_1_ONLY);
-                    !it4.end(); ++it4) {
-                    Atom *atom4 = &*it4;
-
-                    if ((atom2 != atom4) && (atom1 != atom3)) {
-
-                        bool found_this_parameter = false;
-
-                        std::string type1 = eef1_sb_parser::get_atom_type(atom1);
-                        std::string type2 = eef1_sb_parser::get_atom_type(atom2);
-                        std::string type3 = eef1_sb_parser::get_atom_type(atom3);
-                        std::string type4 = eef1_sb_parser::get_atom_type(atom4);
-
-                        for (unsigned int i = 0; i < torsion_parameters.size(); i++) {
-
-                            TorsionParameter p = torsion_parameters[i];
-
-                            if ((p.type1 == type1) && (p.type2 == type2) && (p.type3 == type3)&& (p.type4 == type4)) {
-                                TorsionInteraction torsion_interaction;
-                                torsion_interaction.atom1 = atom1;
-                                torsion_interaction.atom2 = atom2;
-                                torsion_interaction.atom3 = atom3;
-                                torsion_interaction.atom4 = atom4;
-                                torsion_interaction.phi0  = p.phi0;
-                                torsion_interaction.cp    = p.cp;
-                                torsion_interaction.mult  = p.mult;
-                                found_this_parameter = true;
-                                torsion_interactions.push_back(torsion_interaction);
-
-                            } else if ((p.type1 == type4) && (p.type2 == type3) && (p.type3 == type2)&& (p.type4 == type1)) {
-                                TorsionInteraction torsion_interaction;
-                                torsion_interaction.atom1 = atom4;
-                                torsion_interaction.atom2 = atom3;
-                                torsion_interaction.atom3 = atom2;
-                                torsion_interaction.atom4 = atom1;
-                                torsion_interaction.phi0  = p.phi0;
-                                torsion_interaction.cp    = p.cp;
-                                torsion_interaction.mult  = p.mult;
-                                found_this_parameter = true;
-                                torsion_interactions.push_back(torsion_interaction);
-                            }
-                        }
+    //! Key of the atom types of each parameter in file order, to orient matches
+    const std::vector<ParameterKey> &parameter_keys;
+
+    //! Constructor
+    TorsionInteractionBuilder(const BondGraph &bond_graph,
+                              const eef1_sb_parser::ChainAtomTypes &atom_types,
+                              const std::vector<TorsionParameter> &torsion_parameters,
+                              const TieredParameterIndex &torsion_index,
+                              const std::vector<ParameterKey> &parameter_keys)
+        : bond_graph(bond_graph),
+          atom_types(atom_types),
+          torsion_parameters(torsion_parameters),
+          torsion_index(torsion_index),
+          parameter_keys(parameter_keys) {}
+
+    //! Add the torsion interactions whose atom2 is in a range of atoms
+    //! \param begin Index of first atom (see BondGraph)
+    //! \param end Index after last atom
+    //! \param torsion_interactions List the interactions are added to
+    void operator()(const unsigned int begin, const unsigned int end,
+                    std::vector<TorsionInteraction> &torsion_interactions) const {
+
+        using namespace phaistos;
+
+        // Torsions around each bond (atom2, atom3) with atom3 after atom2 in the chain
+        std::vector<unsigned int> bonded3;
+        for (unsigned int index2 = begin; index2 < end; index2++) {
+            Atom *atom2 = bond_graph.atoms[index2];
+            const std::vector<unsigned int> &bonded2 = bond_graph.bonded[index2];
+
+            bonded3 = bonded2;
+            std::sort(bonded3.begin(), bonded3.end());
+
+            for (unsigned int k3 = 0; k3 < bonded3.size(); k3++) {
+                Atom *atom3 = bond_graph.atoms[bonded3[k3]];
+
+                if ((atom2->residue->index >
+                     atom3->residue->index ) ||
+                    ((atom2->residue->index == atom3->residue->index) &&
+                     (atom2->index > atom3->index)))
+                    continue;
+
+                for (unsigned int k1 = 0; k1 < bonded2.size(); k1++) {
+                    Atom *atom1 = bond_graph.atoms[bonded2[k1]];
+                    for (unsigned int k4 = 0; k4 < bond_graph.bonded[bonded3[k3]].size(); k4++) {
+                        Atom *atom4 = bond_graph.atoms[bond_graph.bonded[bonded3[k3]][k4]];
 
-                        if (!found_this_parameter) {
-                            for (unsigned int i = 0; i < torsion_parameters.size(); i++) {
-
-                                TorsionParameter p = torsion_parameters[i];
-
-                                if ((p.type1 == "X") && (p.type2 == type2) && (p.type3 == type3)&& (p.type4 == "X")) {
-                                    TorsionInteraction torsion_interaction;
-                                    torsion_interaction.atom1 = atom1;
-                                    torsion_interaction.atom2 = atom2;
-                                    torsion_interaction.atom3 = atom3;
-                                    torsion_interaction.atom4 = atom4;
-                                    torsion_interaction.phi0  = p.phi0;
-                                    torsion_interaction.cp    = p.cp;
-                                    torsion_interaction.mult  = p.mult;
-                                    found_this_parameter = true;
-                                    torsion_interactions.push_back(torsion_interaction);
-                                    break;
-                                } else if ((p.type1 == "X") && (p.type2 == type3) && (p.type3 == type2)&& (p.type4 == "X")) {
-                                    TorsionInteraction torsion_interaction;
-                                    torsion_interaction.atom1 = atom4;
-                                    torsion_interaction.atom2 = atom3;
-                                    torsion_interaction.atom3 = atom2;
-                                    torsion_interaction.atom4 = atom1;
-                                    torsion_interaction.phi0  = p.phi0;
-                                    torsion_interaction.cp    = p.cp;
-                                    torsion_interaction.mult  = p.mult;
-                                    found_this_parameter = true;
-                                    torsion_interactions.push_back(torsion_interaction);
-                                    break;
+                        if ((atom2 != atom4) && (atom1 != atom3)) {
+
+                            const unsigned int ids[4] = {atom_types.get_atom_type_id(atom1),
+                                                         atom_types.get_atom_type_id(atom2),
+                                                         atom_types.get_atom_type_id(atom3),
+                                                         atom_types.get_atom_type_id(atom4)};
+
+                            // All parameters with these atom types, in either direction
+                            const std::vector<unsigned int> *matches
+                                = torsion_index.specific.find(make_canonical_parameter_key(ids, 4));
+
+                            if (matches) {
+
+                                for (unsigned int k = 0; k < matches->size(); k++) {
+
+                                    const TorsionParameter &p = torsion_parameters[(*matches)[k]];
+
+                                    if (parameter_keys[(*matches)[k]] == make_parameter_key(ids, 4)) {
+                                        torsion_interactions.push_back(make_torsion_interaction(atom1, atom2, atom3, atom4, p));
+                                    } else {
+                                        torsion_interactions.push_back(make_torsion_interaction(atom4, atom3, atom2, atom1, p));
+                                    }
+                                }
+
+                            } else {
+
+                                // Otherwise the first X-A-B-X wildcard parameter
+                                matches = torsion_index.wildcard.find(make_canonical_parameter_key(ids + 1, 2));
+
+                                if (matches) {
+
+                                    const TorsionParameter &p = torsion_parameters[matches->front()];
+                                    const unsigned int wildcard_ids[4] = {charmm_parameters::ATOM_TYPE_X, ids[1], ids[2],
+                                                                          charmm_parameters::ATOM_TYPE_X};
+
+                                    if (parameter_keys[matches->front()] == make_parameter_key(wildcard_ids, 4)) {
+                                        torsion_interactions.push_back(make_torsion_interaction(atom1, atom2, atom3, atom4, p));
+                                    } else {
+                                        torsion_interactions.push_back(make_torsion_interaction(atom4, atom3, atom2, atom1, p));
+                                    }
+
+                                } else {
+                                    std::cout << "ASC: TORERR COULD NOT FIND DIHEDRAL PARAM" << atom1 << atom2 << atom3 << atom4 << std::endl;
+                                    std::cout << "ASC: TORERR COULD NOT FIND DIHEDRAL PARAM   "
+                                              << eef1_sb_parser::get_atom_type_name(ids[0]) << "  "
+                                              << eef1_sb_parser::get_atom_type_name(ids[1]) << "  "
+                                              << eef1_sb_parser::get_atom_type_name(ids[2]) << "  "
+                                              << eef1_sb_parser::get_atom_type_name(ids[3]) << "  " << std::endl;
                                 }
-                            }
-                            if (!found_this_parameter) {
-                                std::cout << "ASC: TORERR COULD NOT FIND DIHEDRAL PARAM" << atom1 << atom2 << atom3 << atom4 << std::endl;
-                                std::cout << "ASC: TORERR COULD NOT FIND DIHEDRAL PARAM   " << type1 << "  " << type2 << "  " << type3 << "  " << type4 << "  " << std::endl;
                             }
                         }
                     }
@@ -674,72 +1378,149 @@ std::vector<TorsionInteraction> generate_torsion_interactions(phaistos::ChainFB
             }
         }
     }
+};
+
+
+//! Generates the torsion interactions of a chain.
+//! \param topology Bond graph and atom types of the protein chain
+//! \param torsion_parameters Torsion parameters
+//! \param threads Number of threads (0: all available). The result does not depend on the number of threads.
+//! \returns A vector of torsion interactions
+std::vector<TorsionInteraction> generate_torsion_interactions(ChainTopology &topology,
+    const std::vector<TorsionParameter> &torsion_parameters,
+    const int threads=1) {
+
+    std::vector<TorsionInteraction> torsion_interactions;
+
+    phaistos::ChainFB *chain = topology.get_chain();
+    const TieredParameterIndex torsion_index = make_torsion_index(torsion_parameters);
+    const eef1_sb_parser::ChainAtomTypes &atom_types = topology.get_atom_types();
+
+    // Atom types of each parameter in file order, to orient matches
+    std::vector<ParameterKey> parameter_keys(torsion_parameters.size());
+    for (unsigned int i = 0; i < torsion_parameters.size(); i++) {
+        const TorsionParameter &p = torsion_parameters[i];
+        const unsigned int ids[4] = {p.type1, p.type2, p.type3, p.type4};
+        parameter_keys[i] = make_parameter_key(ids, 4);
+    }
+
+    const BondGraph &bond_graph = topology.get_bond_graph();
+
+    const TorsionInteractionBuilder builder(bond_graph, atom_types, torsion_parameters,
+                                            torsion_index, parameter_keys);
+    const ResidueTemplateBuilder<TorsionInteractionBuilder, TorsionInteraction> stamper(builder, chain,
+                                                                                        bond_graph, atom_types);
+    charmm_parallel::chunked_build(stamper, chain->size(), threads, torsion_interactions);
+
+    flag_torsion_degrees_of_freedom(chain, torsion_interactions);
+
     return torsion_interactions;
 }
 
+//! Generates the torsion interactions of a chain.
+//! \param chain The protein chain object.
+//! \param torsion_parameters Torsion parameters
+//! \param threads Number of threads (0: all available). The result does not depend on the number of threads.
+//! \returns A vector of torsion interactions
+std::vector<TorsionInteraction> generate_torsion_interactions(phaistos::ChainFB *chain,
+    const std::vector<TorsionParameter> &torsion_parameters,
+    const int threads=1) {
 
-std::vector<BondedPairParameter> read_bonded_pair_parameters(const std::string &itp) {
+    ChainTopology topology(chain);
+    return generate_torsion_interactions(topology, torsion_parameters, threads);
+}
 
-    std::istringstream input_stream(itp);
 
-    std::vector<BondedPairParameter> parameters;
+//! Returns the bond-stretch parameters from the table generated from bond_stretch.itp
+//! \returns A vector of bond-stretch parameters
+std::vector<BondedPairParameter> get_bonded_pair_parameters() {
 
-    while (input_stream.good()) {
+    using namespace charmm_parameters;
 
-        std::string line;
-        std::getline(input_stream, line);
+    std::vector<BondedPairParameter> parameters(N_BOND_STRETCH_PARAMETERS);
 
-        boost::trim(line);
+    for (unsigned int i = 0; i < N_BOND_STRETCH_PARAMETERS; i++) {
 
-        if (line.size() == 0 || line[0] == ';') {
-            continue;
-        }
+        const BondStretchRecord &record = bond_stretch_parameters[i];
+        BondedPairParameter &parameter = parameters[i];
 
-        std::vector<std::string> split_line;
-        boost::split(split_line, line, boost::is_any_of(" \t"), boost::token_compress_on);
+        parameter.type1 = record.type1;
+        parameter.type2 = record.type2;
+        parameter.r0    = record.r0;
+        parameter.kb    = record.kb;
+    }
 
-        BondedPairParameter parameter;
+    return parameters;
+}
 
-        parameter.type1 = boost::lexical_cast<std::string >(split_line[0]);
-        parameter.type2 = boost::lexical_cast<std::string >(split_line[1]);
-        parameter.r0    = boost::lexical_cast<double>(split_line[3]);
-        parameter.kb    = boost::lexical_cast<double>(split_line[4]);
 
-        parameters.push_back(parameter);
+//! Make a hash index of bond-stretch parameters by pair of atom types
+//! \param bonded_pair_parameters Bond-stretch parameters
+//! \returns Index
+ParameterIndex make_bonded_pair_index(const std::vector<BondedPairParameter> &bonded_pair_parameters) {
 
-      }
+    ParameterIndex index;
 
-    return parameters;
+    for (unsigned int i = 0; i < bonded_pair_parameters.size(); i++) {
+        const unsigned int ids[2] = {bonded_pair_parameters[i].type1, bonded_pair_parameters[i].type2};
+        index.add(make_canonical_parameter_key(ids, 2), i);
+    }
+
+    return index;
 }
 
 
-std::vector<BondedPairInteraction> generate_bonded_pair_interactions(phaistos::ChainFB *chain,
-                    std::vector<BondedPairParameter> bonded_pair_parameters) {
+//! Builds the bond-stretch interactions of a range of atoms (see charmm_parallel::chunked_build())
+struct BondedPairInteractionBuilder {
 
-    using namespace phaistos;
+    //! Bond graph of the chain
+    const BondGraph &bond_graph;
 
-    std::vector<BondedPairInteraction> bonded_pairs;
+    //! Atom types of the chain
+    const eef1_sb_parser::ChainAtomTypes &atom_types;
 
+    //! Bond-stretch parameters
+    const std::vector<BondedPairParameter> &bonded_pair_parameters;
 
-    for (AtomIterator<ChainFB,definitions::ALL> it1(*(chain)); !it1.end(); ++it1) {
-        Atom *atom1 = &*it1;
-        std::string type1 = eef1_sb_parser::get_atom_type(atom1);
+    //! Index of bond-stretch parameters (see make_bonded_pair_index())
+    const ParameterIndex &bonded_pair_index;
+
+    //! Constructor
+    BondedPairInteractionBuilder(const BondGraph &bond_graph,
+                                 const eef1_sb_parser::ChainAtomTypes &atom_types,
+                                 const std::vector<BondedPairParameter> &bonded_pair_parameters,
+                                 const ParameterIndex &bonded_pair_index)
+        : bond_graph(bond_graph),
+          atom_types(atom_types),
+          bonded_pair_parameters(bonded_pair_parameters),
+          bonded_pair_index(bonded_pair_index) {}
 
-        for (CovalentBondIterator<ChainFB> it2(atom1, CovalentBondIterator<ChainFB>::DEPTH_1_ONLY);
-            !it2.end(); ++it2) {
+    //! Add the bond-stretch interactions of the bonds from a range of atoms to atoms after them in the chain
+    //! \param begin Index of first atom (see BondGraph)
+    //! \param end Index after last atom
+    //! \param bonded_pairs List the interactions are added to
+    void operator()(const unsigned int begin, const unsigned int end,
+                    std::vector<BondedPairInteraction> &bonded_pairs) const {
 
-            Atom *atom2 = &*it2;
-            if (atom1->residue->index < atom2->residue->index ||
-                (atom1->residue->index == atom2->residue->index && atom1->index < atom2->index)) {
+        using namespace phaistos;
 
-                std::string type2 = eef1_sb_parser::get_atom_type(atom2);
+        for (unsigned int index1 = begin; index1 < end; index1++) {
+            Atom *atom1 = bond_graph.atoms[index1];
+            const unsigned int type1 = atom_types.get_atom_type_id(atom1);
 
-                for (unsigned int i = 0; i < bonded_pair_parameters.size(); i++) {
+            for (unsigned int k2 = 0; k2 < bond_graph.bonded[index1].size(); k2++) {
 
-                    BondedPairParameter parameter = bonded_pair_parameters[i];
+                Atom *atom2 = bond_graph.atoms[bond_graph.bonded[index1][k2]];
+                if (atom1->residue->index < atom2->residue->index ||
+                    (atom1->residue->index == atom2->residue->index && atom1->index < atom2->index)) {
 
-                    if (((parameter.type1 == type1) && (parameter.type2 == type2)) ||
-                        ((parameter.type1 == type2) && (parameter.type2 == type1))) {
+                    const unsigned int ids[2] = {type1, atom_types.get_atom_type_id(atom2)};
+                    const std::vector<unsigned int> *matches
+                        = bonded_pair_index.find(make_canonical_parameter_key(ids, 2));
+
+                    if (matches) {
+
+                        const BondedPairParameter &parameter = bonded_pair_parameters[matches->front()];
 
                         BondedPairInteraction pair;
                         pair.atom1 = atom1;
@@ -748,90 +1529,147 @@ std::vector<BondedPairInteraction> generate_bonded_pair_interactions(phaistos::C
                         pair.r0 = parameter.r0;
 
                         bonded_pairs.push_back(pair);
-
-                        break;
                     }
                 }
             }
         }
     }
+};
 
-    return bonded_pairs;
 
-}
+//! Generates the bond-stretch interactions of a chain.
+//! \param topology Bond graph and atom types of the protein chain
+//! \param bonded_pair_parameters Bond-stretch parameters
+//! \param threads Number of threads (0: all available). The result does not depend on the number of threads.
+//! \returns A vector of bond-stretch interactions
+std::vector<BondedPairInteraction> generate_bonded_pair_interactions(ChainTopology &topology,
+                    const std::vector<BondedPairParameter> &bonded_pair_parameters,
+                    const int threads=1) {
 
-std::vector<AngleBendParameter> read_angle_bend_parameters(const std::string &itp) {
+    std::vector<BondedPairInteraction> bonded_pairs;
 
-    std::istringstream input_stream(itp);
+    const ParameterIndex bonded_pair_index = make_bonded_pair_index(bonded_pair_parameters);
+    const eef1_sb_parser::ChainAtomTypes &atom_types = topology.get_atom_types();
+    const BondGraph &bond_graph = topology.get_bond_graph();
 
-    std::vector<AngleBendParameter> parameters;
+    charmm_parallel::chunked_build(BondedPairInteractionBuilder(bond_graph, atom_types, bonded_pair_parameters,
+                                                                bonded_pair_index),
+                                   bond_graph.atoms.size(), threads, bonded_pairs);
 
-    while (input_stream.good()) {
+    return bonded_pairs;
+}
 
-        std::string line;
-        std::getline(input_stream, line);
+//! Generates the bond-stretch interactions of a chain.
+//! \param chain The protein chain object.
+//! \param bonded_pair_parameters Bond-stretch parameters
+//! \param threads Number of threads (0: all available). The result does not depend on the number of threads.
+//! \returns A vector of bond-stretch interactions
+std::vector<BondedPairInteraction> generate_bonded_pair_interactions(phaistos::ChainFB *chain,
+                    const std::vector<BondedPairParameter> &bonded_pair_parameters,
+                    const int threads=1) {
 
-        boost::trim(line);
+    ChainTopology topology(chain);
+    return generate_bonded_pair_interactions(topology, bonded_pair_parameters, threads);
+}
 
-        // std::cout << line << std::endl;
-        if (line.size() == 0 || line[0] == ';') {
-            continue;
-        }
+//! Returns the angle-bend parameters from the table generated from angle_bend.itp
+//! \returns A vector of angle-bend parameters
+std::vector<AngleBendParameter> get_angle_bend_parameters() {
 
-        std::vector<std::string> split_line;
-        boost::split(split_line, line, boost::is_any_of(" \t"), boost::token_compress_on);
+    using namespace charmm_parameters;
 
-        AngleBendParameter parameter;
+    std::vector<AngleBendParameter> parameters(N_ANGLE_BEND_PARAMETERS);
 
-        parameter.type1  = boost::lexical_cast<std::string >(split_line[0]);
-        parameter.type2  = boost::lexical_cast<std::string >(split_line[1]);
-        parameter.type3  = boost::lexical_cast<std::string >(split_line[2]);
-        parameter.theta0 = boost::lexical_cast<double>(split_line[4]);
-        parameter.k0     = boost::lexical_cast<double>(split_line[5]);
-        parameter.r13    = boost::lexical_cast<double>(split_line[6]);
-        parameter.kub    = boost::lexical_cast<double>(split_line[7]);
+    for (unsigned int i = 0; i < N_ANGLE_BEND_PARAMETERS; i++) {
 
-        parameters.push_back(parameter);
+        const AngleBendRecord &record = angle_bend_parameters[i];
+        AngleBendParameter &parameter = parameters[i];
 
-      }
+        parameter.type1  = record.type1;
+        parameter.type2  = record.type2;
+        parameter.type3  = record.type3;
+        parameter.theta0 = record.theta0;
+        parameter.k0     = record.k0;
+        parameter.r13    = record.r13;
+        parameter.kub    = record.kub;
+    }
 
     return parameters;
 }
 
 
-std::vector<AngleBendInteraction> generate_angle_bend_interactions(phaistos::ChainFB *chain,
-    const std::vector<AngleBendParameter> &angle_bend_parameters) {
+//! Make a hash index of angle-bend parameters by triplet of atom types
+//! \param angle_bend_parameters Angle-bend parameters
+//! \returns Index
+ParameterIndex make_angle_bend_index(const std::vector<AngleBendParameter> &angle_bend_parameters) {
 
-    using namespace phaistos;
+    ParameterIndex index;
 
-    std::vector<AngleBendInteraction> angle_bend_interactions;
+    for (unsigned int i = 0; i < angle_bend_parameters.size(); i++) {
+        const unsigned int ids[3] = {angle_bend_parameters[i].type1, angle_bend_parameters[i].type2, angle_bend_parameters[i].type3};
+        index.add(make_canonical_parameter_key(ids, 3), i);
+    }
+
+    return index;
+}
+
+
+//! Builds the angle-bend interactions centered on a range of atoms (see charmm_parallel::chunked_build())
+struct AngleBendInteractionBuilder {
+
+    //! Bond graph of the chain
+    const BondGraph &bond_graph;
+
+    //! Atom types of the chain
+    const eef1_sb_parser::ChainAtomTypes &atom_types;
+
+    //! Angle-bend parameters
+    const std::vector<AngleBendParameter> &angle_bend_parameters;
+
+    //! Index of angle-bend parameters (see make_angle_bend_index())
+    const ParameterIndex &angle_bend_index;
+
+    //! Constructor
+    AngleBendInteractionBuilder(const BondGraph &bond_graph,
+                                const eef1_sb_parser::ChainAtomTypes &atom_types,
+                                const std::vector<AngleBendParameter> &angle_bend_parameters,
+                                const ParameterIndex &angle_bend_index)
+        : bond_graph(bond_graph),
+          atom_types(atom_types),
+          angle_bend_parameters(angle_bend_parameters),
+          angle_bend_index(angle_bend_index) {}
+
+    //! Add the angle-bend interactions whose atom2 is in a range of atoms
+    //! \param begin Index of first atom (see BondGraph)
+    //! \param end Index after last atom
+    //! \param angle_bend_interactions List the interactions are added to
+    void operator()(const unsigned int begin, const unsigned int end,
+                    std::vector<AngleBendInteraction> &angle_bend_interactions) const {
 
-    for (AtomIterator<ChainFB,definitions::ALL> it1(*(chain)); !it1.end(); ++it1) {
-        Atom *atom2 = &*it1;
+        using namespace phaistos;
 
-        std::string type2 = eef1_sb_parser::get_atom_type(atom2);
-        for (CovalentBondIterator<ChainFB> it2(atom2, CovalentBondIterator<ChainFB>::DEPTH_1_ONLY);
-            !it2.end(); ++it2) {
+        for (unsigned int index2 = begin; index2 < end; index2++) {
+            Atom *atom2 = bond_graph.atoms[index2];
+            const std::vector<unsigned int> &bonded2 = bond_graph.bonded[index2];
 
-            Atom *atom1 = &*it2;
-            std::string type1 = eef1_sb_parser::get_atom_type(atom1);
+            const unsigned int type_id2 = atom_types.get_atom_type_id(atom2);
 
-            CovalentBondIterator<ChainFB> it3(it2);
-            // Fancy way to discard it3 = it1
-            ++it3;
-            for (; !it3.end(); ++it3) {
-                Atom *atom3 = &*it3;
+            for (unsigned int k1 = 0; k1 < bonded2.size(); k1++) {
 
-                std::string type3 = eef1_sb_parser::get_atom_type(atom3);
+                Atom *atom1 = bond_graph.atoms[bonded2[k1]];
+                const unsigned int type_id1 = atom_types.get_atom_type_id(atom1);
 
-                bool found_this_parameter = false;
+                // Each pair of bonded atoms once
+                for (unsigned int k3 = k1 + 1; k3 < bonded2.size(); k3++) {
+                    Atom *atom3 = bond_graph.atoms[bonded2[k3]];
 
-                for (unsigned int i = 0; i < angle_bend_parameters.size(); i++) {
+                    const unsigned int ids[3] = {type_id1, type_id2, atom_types.get_atom_type_id(atom3)};
+                    const std::vector<unsigned int> *matches
+                        = angle_bend_index.find(make_canonical_parameter_key(ids, 3));
 
-                    AngleBendParameter parameter = angle_bend_parameters[i];
+                    if (matches) {
 
-                    if (((parameter.type1 == type1) && (parameter.type2 == type2) && (parameter.type3 == type3)) ||
-                        ((parameter.type1 == type3) && (parameter.type2 == type2) && (parameter.type3 == type1))) {
+                        const AngleBendParameter &parameter = angle_bend_parameters[matches->front()];
 
                         AngleBendInteraction interaction;
                         interaction.atom1 = atom1;
@@ -842,280 +1680,407 @@ std::vector<AngleBendInteraction> generate_angle_bend_interactions(phaistos::Cha
                         interaction.r13    = parameter.r13;
                         interaction.kub    = parameter.kub;
 
-                        found_this_parameter = true;
                         angle_bend_interactions.push_back(interaction);
 
-                        break;
+                    } else {
+                        std::cout << "ASC: COULD NOT FIND angle bend PARAM" << atom1 << atom2 << atom3 << std::endl;
+                        std::cout << "ASC: COULD NOT FIND angle-bend PARAM   "
+                                  << eef1_sb_parser::get_atom_type_name(ids[0]) << "  "
+                                  << eef1_sb_parser::get_atom_type_name(ids[1]) << "  "
+                                  << eef1_sb_parser::get_atom_type_name(ids[2]) << std::endl;
                     }
                 }
-                if (!found_this_parameter) {
-                    std::cout << "ASC: COULD NOT FIND angle bend PARAM" << atom1 << atom2 << atom3 << std::endl;
-                    std::cout << "ASC: COULD NOT FIND angle-bend PARAM   " << type1 << "  " << type2 << "  " << type3 << std::endl;
-                }
             }
         }
     }
+};
 
-    return angle_bend_interactions;
 
-}
+//! Generates the angle-bend (and Urey-Bradley) interactions of a chain.
+//! \param topology Bond graph and atom types of the protein chain
+//! \param angle_bend_parameters Angle-bend parameters
+//! \param threads Number of threads (0: all available). The result does not depend on the number of threads.
+//! \returns A vector of angle-bend interactions
+std::vector<AngleBendInteraction> generate_angle_bend_interactions(ChainTopology &topology,
+    const std::vector<AngleBendParameter> &angle_bend_parameters,
+    const int threads=1) {
 
+    std::vector<AngleBendInteraction> angle_bend_interactions;
 
-std::vector<ImproperTorsionParameter> read_improper_torsion_parameters(const std::string &itp) {
+    const ParameterIndex angle_bend_index = make_angle_bend_index(angle_bend_parameters);
+    const eef1_sb_parser::ChainAtomTypes &atom_types = topology.get_atom_types();
+    const BondGraph &bond_graph = topology.get_bond_graph();
 
-    std::istringstream input_stream(itp);
+    charmm_parallel::chunked_build(AngleBendInteractionBuilder(bond_graph, atom_types, angle_bend_parameters,
+                                                               angle_bend_index),
+                                   bond_graph.atoms.size(), threads, angle_bend_interactions);
 
-    std::vector<ImproperTorsionParameter> parameters;
+    return angle_bend_interactions;
+}
 
-    while (input_stream.good()) {
+//! Generates the angle-bend (and Urey-Bradley) interactions of a chain.
+//! \param chain The protein chain object.
+//! \param angle_bend_parameters Angle-bend parameters
+//! \param threads Number of threads (0: all available). The result does not depend on the number of threads.
+//! \returns A vector of angle-bend interactions
+std::vector<AngleBendInteraction> generate_angle_bend_interactions(phaistos::ChainFB *chain,
+    const std::vector<AngleBendParameter> &angle_bend_parameters,
+    const int threads=1) {
 
-        std::string line;
-        std::getline(input_stream, line);
+    ChainTopology topology(chain);
+    return generate_angle_bend_interactions(topology, angle_bend_parameters, threads);
+}
 
-        boost::trim(line);
 
-        // std::cout << line << std::endl;
-        if (line.size() == 0 || line[0] == ';') {
-            continue;
-        }
+//! Returns the improper torsion parameters from the table generated from imptor.itp
+//! \returns A vector of improper torsion parameters
+std::vector<ImproperTorsionParameter> get_improper_torsion_parameters() {
 
-        std::vector<std::string> split_line;
-        boost::split(split_line, line, boost::is_any_of(" \t"), boost::token_compress_on);
+    using namespace charmm_parameters;
 
-        ImproperTorsionParameter parameter;
+    std::vector<ImproperTorsionParameter> parameters(N_IMPROPER_TORSION_PARAMETERS);
 
-        parameter.type1 = boost::lexical_cast<std::string >(split_line[0]);
-        parameter.type2 = boost::lexical_cast<std::string >(split_line[1]);
-        parameter.type3 = boost::lexical_cast<std::string >(split_line[2]);
-        parameter.type4 = boost::lexical_cast<std::string >(split_line[3]);
-        parameter.phi0  = boost::lexical_cast<double>(split_line[5]);
-        parameter.cp    = boost::lexical_cast<double>(split_line[6]);
+    for (unsigned int i = 0; i < N_IMPROPER_TORSION_PARAMETERS; i++) {
 
-        parameters.push_back(parameter);
+        const ImproperTorsionRecord &record = improper_torsion_parameters[i];
+        ImproperTorsionParameter &parameter = parameters[i];
 
-      }
+        parameter.type1 = record.type1;
+        parameter.type2 = record.type2;
+        parameter.type3 = record.type3;
+        parameter.type4 = record.type4;
+        parameter.phi0  = record.phi0;
+        parameter.cp    = record.cp;
+    }
 
     return parameters;
 }
 
 
-ImproperTorsionInteraction atoms_to_improper_torsion(const std::vector<phaistos::Atom*> &atoms,
-    const std::vector<ImproperTorsionParameter> &improper_torsion_parameters) {
+//! Make hash indexes of improper torsion parameters. Parameters with specific atom
+//! types are indexed by all four atom types, A-X-X-B wildcard parameters by the
+//! two outer atom types.
+//! \param improper_torsion_parameters Improper torsion parameters
+//! \returns Indexes
+TieredParameterIndex make_improper_torsion_index(const std::vector<ImproperTorsionParameter> &improper_torsion_parameters) {
 
-    ImproperTorsionInteraction improper_torsion;
-
-    improper_torsion.atom1 = atoms[0];
-    improper_torsion.atom2 = atoms[1];
-    improper_torsion.atom3 = atoms[2];
-    improper_torsion.atom4 = atoms[3];
-
-    std::string type1 = eef1_sb_parser::get_atom_type(atoms[0]);
-    std::string type2 = eef1_sb_parser::get_atom_type(atoms[1]);
-    std::string type3 = eef1_sb_parser::get_atom_type(atoms[2]);
-    std::string type4 = eef1_sb_parser::get_atom_type(atoms[3]);
-
-    bool found_parameter = false;
+    TieredParameterIndex index;
 
     for (unsigned int i = 0; i < improper_torsion_parameters.size(); i++) {
 
-        ImproperTorsionParameter p = improper_torsion_parameters[i];
+        const ImproperTorsionParameter &p = improper_torsion_parameters[i];
 
-        if (((p.type1 == type1) && (p.type2 == type2) && (p.type3 == type3) && (p.type4 == type4)) ||
-            ((p.type1 == type4) && (p.type2 == type3) && (p.type3 == type2) && (p.type4 == type1)) ||
-            ((p.type1 == type1) && (p.type2 == "X"  ) && (p.type3 == "X"  ) && (p.type4 == type4)) ||
-            ((p.type1 == type4) && (p.type2 == "X"  ) && (p.type3 == "X"  ) && (p.type4 == type1))) {
+        const unsigned int ids[4] = {p.type1, p.type2, p.type3, p.type4};
 
-            found_parameter = true;
+        index.specific.add(make_canonical_parameter_key(ids, 4), i);
 
-            improper_torsion.phi0 = p.phi0;
-            improper_torsion.cp = p.cp;
+        if ((ids[1] == charmm_parameters::ATOM_TYPE_X) && (ids[2] == charmm_parameters::ATOM_TYPE_X)) {
+            const unsigned int outer_ids[2] = {ids[0], ids[3]};
+            index.wildcard.add(make_canonical_parameter_key(outer_ids, 2), i);
         }
     }
 
-    if (!found_parameter)
-        std::cout << "ERROR: DIDN'T FIND PARAMETER" << std::endl;
-
-    return improper_torsion;
+    return index;
 }
 
 
-std::vector<ImproperTorsionInteraction> generate_improper_torsion_interactions(phaistos::ChainFB *chain,
-    const std::vector<ImproperTorsionParameter> &improper_torsion_parameters) {
-
-    using namespace phaistos;
-    using namespace definitions;
-    using namespace vector_utils;
-
-    std::vector<ImproperTorsionInteraction> improper_torsions;
+//! Make an improper torsion interaction.
+//! As in the parameter file order, the last matching parameter is used,
+//! whether it has specific or wildcard atom types.
+//! \param atoms The four atoms
+//! \param atom_types Atom types of the chain
+//! \param improper_torsion_parameters Improper torsion parameters
+//! \param improper_torsion_index Indexes of improper torsion parameters (see make_improper_torsion_index())
+//! \returns Improper torsion interaction
+ImproperTorsionInteraction atoms_to_improper_torsion(const std::vector<phaistos::Atom*> &atoms,
+    const eef1_sb_parser::ChainAtomTypes &atom_types,
+    const std::vector<ImproperTorsionParameter> &improper_torsion_parameters,
+    const TieredParameterIndex &improper_torsion_index) {
 
-    for (ResidueIterator<ChainFB> res(*(chain)); !(res).end(); ++res) {
+    ImproperTorsionInteraction improper_torsion;
 
+    improper_torsion.atom1 = atoms[0];
+    improper_torsion.atom2 = atoms[1];
+    improper_torsion.atom3 = atoms[2];
+    improper_torsion.atom4 = atoms[3];
 
-        std::vector<std::vector<AtomEnum> > enum_pairs;
+    const unsigned int ids[4] = {atom_types.get_atom_type_id(atoms[0]),
+                                 atom_types.get_atom_type_id(atoms[1]),
+                                 atom_types.get_atom_type_id(atoms[2]),
+                                 atom_types.get_atom_type_id(atoms[3])};
+    const unsigned int outer_ids[2] = {ids[0], ids[3]};
 
+    const std::vector<unsigned int> *specific_matches
+        = improper_torsion_index.specific.find(make_canonical_parameter_key(ids, 4));
+    const std::vector<unsigned int> *wildcard_matches
+        = improper_torsion_index.wildcard.find(make_canonical_parameter_key(outer_ids, 2));
 
-        switch (res->residue_type) {
-        case ALA:
-            break;
+    const bool found_parameter = (specific_matches || wildcard_matches);
 
-        case ARG:
-            enum_pairs.push_back(make_vector(CZ,      NH1,     NH2,     NE));
-            break;
+    if (found_parameter) {
 
-        case ASN:
-            enum_pairs.push_back(make_vector(CG,      ND2,     CB,      OD1));
-            enum_pairs.push_back(make_vector(CG,      CB,      ND2,     OD1));
-            enum_pairs.push_back(make_vector(ND2,     CG,      HD21,    HD22));
-            enum_pairs.push_back(make_vector(ND2,    CG,      HD22,    HD21));
-            break;
+        unsigned int index = 0;
+        if (specific_matches)
+            index = specific_matches->back();
+        if (wildcard_matches)
+            index = std::max(index, wildcard_matches->back());
 
-        case ASP:
-            enum_pairs.push_back(make_vector(CG,      CB,      OD2,     OD1));
-            break;
+        improper_torsion.phi0 = improper_torsion_parameters[index].phi0;
+        improper_torsion.cp = improper_torsion_parameters[index].cp;
+    }
 
-        case CYS:
-            break;
+    if (!found_parameter)
+        std::cout << "ERROR: DIDN'T FIND PARAMETER" << std::endl;
 
-        case GLN:
-	        enum_pairs.push_back(make_vector(CD,	NE2,	CG,	OE1));
-        	enum_pairs.push_back(make_vector(CD,	CG,	NE2,	OE1));
-        	enum_pairs.push_back(make_vector(NE2,	CD,	HE21,	HE22));
-        	enum_pairs.push_back(make_vector(NE2,	CD,	HE22,	HE21));
-            break;
+    return improper_torsion;
+}
 
-        case GLU:
-         	enum_pairs.push_back(make_vector(CD,	CG,	OE2,	OE1));
-            break;
 
-        case GLY:
-            break;
+//! Builds the improper torsion interactions of a range of residues (see charmm_parallel::chunked_build())
+struct ImproperTorsionInteractionBuilder {
+
+    //! Molecule chain
+    phaistos::ChainFB *chain;
+
+    //! Atom types of the chain
+    const eef1_sb_parser::ChainAtomTypes &atom_types;
+
+    //! Improper torsion parameters
+    const std::vector<ImproperTorsionParameter> &improper_torsion_parameters;
+
+    //! Indexes of improper torsion parameters (see make_improper_torsion_index())
+    const TieredParameterIndex &improper_torsion_index;
+
+    //! Constructor
+    ImproperTorsionInteractionBuilder(phaistos::ChainFB *chain,
+                                      const eef1_sb_parser::ChainAtomTypes &atom_types,
+                                      const std::vector<ImproperTorsionParameter> &improper_torsion_parameters,
+                                      const TieredParameterIndex &improper_torsion_index)
+        : chain(chain),
+          atom_types(atom_types),
+          improper_torsion_parameters(improper_torsion_parameters),
+          improper_torsion_index(improper_torsion_index) {}
+
+    //! Add the improper torsion interactions of a range of residues
+    //! \param begin Index of first residue
+    //! \param end Index after last residue
+    //! \param improper_torsions List the interactions are added to
+    void operator()(const unsigned int begin, const unsigned int end,
+                    std::vector<ImproperTorsionInteraction> &improper_torsions) const {
+
+        using namespace phaistos;
+        using namespace definitions;
+        using namespace vector_utils;
+
+        for (unsigned int r = begin; r < end; r++) {
+            Residue *res = &(*chain)[r];
+
+            std::vector<std::vector<AtomEnum> > enum_pairs;
+
+
+            switch (res->residue_type) {
+            case ALA:
+                break;
+
+            case ARG:
+                enum_pairs.push_back(make_vector(CZ,      NH1,     NH2,     NE));
+                break;
+
+            case ASN:
+                enum_pairs.push_back(make_vector(CG,      ND2,     CB,      OD1));
+                enum_pairs.push_back(make_vector(CG,      CB,      ND2,     OD1));
+                enum_pairs.push_back(make_vector(ND2,     CG,      HD21,    HD22));
+                enum_pairs.push_back(make_vector(ND2,    CG,      HD22,    HD21));
+                break;
+
+            case ASP:
+                enum_pairs.push_back(make_vector(CG,      CB,      OD2,     OD1));
+                break;
+
+            case CYS:
+                break;
+
+            case GLN:
+    	        enum_pairs.push_back(make_vector(CD,	NE2,	CG,	OE1));
+            	enum_pairs.push_back(make_vector(CD,	CG,	NE2,	OE1));
+            	enum_pairs.push_back(make_vector(NE2,	CD,	HE21,	HE22));
+            	enum_pairs.push_back(make_vector(NE2,	CD,	HE22,	HE21));
+                break;
+
+            case GLU:
+             	enum_pairs.push_back(make_vector(CD,	CG,	OE2,	OE1));
+                break;
+
+            case GLY:
+                break;
+
+            case HIS:
+                if (res->has_atom(HD1) && res->has_atom(HE2)) {
+                    enum_pairs.push_back(make_vector(ND1, 	CG	, CE1,	HD1));
+                	enum_pairs.push_back(make_vector(ND1, 	CE1	, CG , HD1));
+                	enum_pairs.push_back(make_vector(NE2, 	CD2	, CE1,	HE2));
+                	enum_pairs.push_back(make_vector(NE2, 	CE1	, CD2,	HE2));
+                } else if (!(res->has_atom(HD1)) && res->has_atom(HE2)) {
+                	enum_pairs.push_back(make_vector(NE2, 	CD2	, CE1,	HE2));
+                	enum_pairs.push_back(make_vector(CD2, 	CG	, NE2,	HD2));
+                	enum_pairs.push_back(make_vector(CE1, 	ND1	, NE2,	HE1));
+                	enum_pairs.push_back(make_vector(NE2, 	CE1	, CD2,	HE2));
+                	enum_pairs.push_back(make_vector(CD2, 	NE2	, CG , HD2));
+            	    enum_pairs.push_back(make_vector(CE1, 	NE2	, ND1,	HE1));
+                } else if (res->has_atom(HD1) && !(res->has_atom(HE2))) {
+                	enum_pairs.push_back(make_vector(ND1, 	CG	, CE1,	HD1));
+                	enum_pairs.push_back(make_vector(CD2, 	CG	, NE2,	HD2));
+                	enum_pairs.push_back(make_vector(CE1, 	ND1	, NE2,	HE1));
+                	enum_pairs.push_back(make_vector(ND1, 	CE1	, CG , HD1));
+            	    enum_pairs.push_back(make_vector(CD2, 	NE2	, CG , HD2));
+                	enum_pairs.push_back(make_vector(CE1, 	NE2	, ND1,	HE1));
+                } else {
+                    std::cout << "Unknown protonations state on " << *res << std::endl;
+                }
+                break;
 
-        case HIS:
-            if (res->has_atom(HD1) && res->has_atom(HE2)) {
-                enum_pairs.push_back(make_vector(ND1, 	CG	, CE1,	HD1));
-            	enum_pairs.push_back(make_vector(ND1, 	CE1	, CG , HD1));
-            	enum_pairs.push_back(make_vector(NE2, 	CD2	, CE1,	HE2));
-            	enum_pairs.push_back(make_vector(NE2, 	CE1	, CD2,	HE2));
-            } else if (!(res->has_atom(HD1)) && res->has_atom(HE2)) {
-            	enum_pairs.push_back(make_vector(NE2, 	CD2	, CE1,	HE2));
-            	enum_pairs.push_back(make_vector(CD2, 	CG	, NE2,	HD2));
-            	enum_pairs.push_back(make_vector(CE1, 	ND1	, NE2,	HE1));
-            	enum_pairs.push_back(make_vector(NE2, 	CE1	, CD2,	HE2));
-            	enum_pairs.push_back(make_vector(CD2, 	NE2	, CG , HD2));
-        	    enum_pairs.push_back(make_vector(CE1, 	NE2	, ND1,	HE1));
-            } else if (res->has_atom(HD1) && !(res->has_atom(HE2))) {
-            	enum_pairs.push_back(make_vector(ND1, 	CG	, CE1,	HD1));
-            	enum_pairs.push_back(make_vector(CD2, 	CG	, NE2,	HD2));
-            	enum_pairs.push_back(make_vector(CE1, 	ND1	, NE2,	HE1));
-            	enum_pairs.push_back(make_vector(ND1, 	CE1	, CG , HD1));
-        	    enum_pairs.push_back(make_vector(CD2, 	NE2	, CG , HD2));
-            	enum_pairs.push_back(make_vector(CE1, 	NE2	, ND1,	HE1));
-            } else {
-                std::cout << "Unknown protonations state on " << res << std::endl;
-            }
-            break;
+            case ILE:
+                break;
 
-        case ILE:
-            break;
+            case LEU:
+                break;
 
-        case LEU:
-            break;
+            case LYS:
+                break;
 
-        case LYS:
-            break;
+            case MET:
+                break;
 
-        case MET:
-            break;
+            case PHE:
+                break;
 
-        case PHE:
-            break;
+            case PRO:
+                break;
 
-        case PRO:
-            break;
+            case SER:
+                break;
 
-        case SER:
-            break;
+            case THR:
+                break;
 
-        case THR:
-            break;
+            case TRP:
+                break;
 
-        case TRP:
-            break;
+            case TYR:
+                break;
 
-        case TYR:
-            break;
+            case VAL:
+                break;
 
-        case VAL:
-            break;
+            default:
+                std::cout << "ASC: Unknown residue type: " << *res << std::endl;
+                break;
+            };
 
-        default:
-            std::cout << "ASC: Unknown residue type: " << res << std::endl;
-            break;
-        };
 
+            for (unsigned int i = 0; i < enum_pairs.size(); i++) {
 
-        for (unsigned int i = 0; i < enum_pairs.size(); i++) {
+                ImproperTorsionInteraction sc_improper_torsion 
+                    = atoms_to_improper_torsion(make_vector((*res)[enum_pairs[i][0]],
+                                                            (*res)[enum_pairs[i][1]],
+                                                            (*res)[enum_pairs[i][2]],
+                                                            (*res)[enum_pairs[i][3]]),
+                                                atom_types,
+                                                improper_torsion_parameters,
+                                                improper_torsion_index);
 
-            ImproperTorsionInteraction sc_improper_torsion 
-                = atoms_to_improper_torsion(make_vector((*res)[enum_pairs[i][0]],
-                                                        (*res)[enum_pairs[i][1]],
-                                                        (*res)[enum_pairs[i][2]],
-                                                        (*res)[enum_pairs[i][3]]),
-                                            improper_torsion_parameters);
+                improper_torsions.push_back(sc_improper_torsion);
 
-            improper_torsions.push_back(sc_improper_torsion);
 
+            }
 
+            Residue *previous_residue = res->get_neighbour(-1);
+            Residue *next_residue     = res->get_neighbour(+1);
+
+             //N   -C  CA  HN
+             if (!(res->terminal_status == NTERM)) {
+
+                 AtomEnum amide_atom = H;
+
+                 if (res->residue_type == PRO)
+                    amide_atom = CD;
+
+                 ImproperTorsionInteraction bb_improper_torsion 
+                     = atoms_to_improper_torsion(make_vector((*res)[N],
+                                                             (*previous_residue)[C],
+                                                             (*res)[CA],
+                                                             (*res)[amide_atom]),
+                                                atom_types,
+                                                    improper_torsion_parameters,
+                                                improper_torsion_index);
+
+                 improper_torsions.push_back(bb_improper_torsion);
+             }
+
+              //C   CA  +N  O
+             if (!(res->terminal_status == CTERM)) {
+
+                 ImproperTorsionInteraction bb_improper_torsion 
+                     = atoms_to_improper_torsion(make_vector((*res)[C],
+                                                             (*res)[CA],
+                                                             (*next_residue)[N],
+                                                             (*res)[O]),
+                                                atom_types,
+                                                    improper_torsion_parameters,
+                                                improper_torsion_index);
+
+                 improper_torsions.push_back(bb_improper_torsion);
+             } else if (res->terminal_status == CTERM) {
+
+                 ImproperTorsionInteraction bb_improper_torsion 
+                     = atoms_to_improper_torsion(make_vector((*res)[C],
+                                                             (*res)[CA],
+                                                             (*res)[OXT],
+                                                             (*res)[O]),
+                                                atom_types,
+                                                    improper_torsion_parameters,
+                                                improper_torsion_index);
+
+                 improper_torsions.push_back(bb_improper_torsion);
+             }
         }
+    }
+};
 
-        Residue *previous_residue = res->get_neighbour(-1);
-        Residue *next_residue     = res->get_neighbour(+1);
-
-         //N   -C  CA  HN
-         if (!(res->terminal_status == NTERM)) {
-
-             AtomEnum amide_atom = H;
-
-             if (res->residue_type == PRO)
-                amide_atom = CD;
-
-             ImproperTorsionInteraction bb_improper_torsion 
-                 = atoms_to_improper_torsion(make_vector((*res)[N],
-                                                         (*previous_residue)[C],
-                                                         (*res)[CA],
-                                                         (*res)[amide_atom]),
-                                                improper_torsion_parameters);
-
-             improper_torsions.push_back(bb_improper_torsion);
-         }
-
-          //C   CA  +N  O
-         if (!(res->terminal_status == CTERM)) {
-
-             ImproperTorsionInteraction bb_improper_torsion 
-                 = atoms_to_improper_torsion(make_vector((*res)[C],
-                                                         (*res)[CA],
-                                                         (*next_residue)[N],
-                                                         (*res)[O]),
-                                                improper_torsion_parameters);
 
-             improper_torsions.push_back(bb_improper_torsion);
-         } else if (res->terminal_status == CTERM) {
+//! Generates the improper torsion interactions of a chain.
+//! \param topology Bond graph and atom types of the protein chain
+//! \param improper_torsion_parameters Improper torsion parameters
+//! \param threads Number of threads (0: all available). The result does not depend on the number of threads.
+//! \returns A vector of improper torsion interactions
+std::vector<ImproperTorsionInteraction> generate_improper_torsion_interactions(ChainTopology &topology,
+    const std::vector<ImproperTorsionParameter> &improper_torsion_parameters,
+    const int threads=1) {
 
-             ImproperTorsionInteraction bb_improper_torsion 
-                 = atoms_to_improper_torsion(make_vector((*res)[C],
-                                                         (*res)[CA],
-                                                         (*res)[OXT],
-                                                         (*res)[O]),
-                                                improper_torsion_parameters);
+    std::vector<ImproperTorsionInteraction> improper_torsions;
 
-             improper_torsions.push_back(bb_improper_torsion);
-         }
+    phaistos::ChainFB *chain = topology.get_chain();
+    const TieredParameterIndex improper_torsion_index = make_improper_torsion_index(improper_torsion_parameters);
+    const eef1_sb_parser::ChainAtomTypes &atom_types = topology.get_atom_types();
 
-    }
+    charmm_parallel::chunked_build(ImproperTorsionInteractionBuilder(chain, atom_types, improper_torsion_parameters,
+                                                                     improper_torsion_index),
+                                   chain->size(), threads, improper_torsions);
 
     return improper_torsions;
+}
+
+//! Generates the improper torsion interactions of a chain.
+//! \param chain The protein chain object.
+//! \param improper_torsion_parameters Improper torsion parameters
+//! \param threads Number of threads (0: all available). The result does not depend on the number of threads.
+//! \returns A vector of improper torsion interactions
+std::vector<ImproperTorsionInteraction> generate_improper_torsion_interactions(phaistos::ChainFB *chain,
+    const std::vector<ImproperTorsionParameter> &improper_torsion_parameters,
+    const int threads=1) {
 
+    ChainTopology topology(chain);
+    return generate_improper_torsion_interactions(topology, improper_torsion_parameters, threads);
 }
 
 } // End namespace topology
@@ -0,0 +1,223 @@
+// spatial_ordering.h -- Space-filling-curve ordered coordinate buffer for pair traversal
+// Copyright (C) 2026 agent
+//
+// This file is part of Phaistos
+//
+// Phaistos is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Phaistos is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Phaistos.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+#ifndef CHARMM_SPATIAL_ORDERING_H
+#define CHARMM_SPATIAL_ORDERING_H
+
+#include <vector>
+#include <map>
+#include <algorithm>
+
+#include "parsers/topology_items.h"
+
+namespace charmm_spatial {
+
+//! Number of bits per dimension in a Morton key
+const unsigned int MORTON_BITS = 10;
+
+//! Spread the lower 10 bits of an integer so that there are two zero bits between each bit
+//! \param x Integer with at most 10 bits
+//! \return Spread integer
+inline unsigned int spread_bits(unsigned int x) {
+
+     x &= 0x000003ff;
+     x = (x | (x << 16)) & 0xff0000ff;
+     x = (x | (x <<  8)) & 0x0300f00f;
+     x = (x | (x <<  4)) & 0x030c30c3;
+     x = (x | (x <<  2)) & 0x09249249;
+     return x;
+}
+
+//! Morton (Z-order) key of a position in a bounding box
+//! \param position Position
+//! \param origin Lower corner of the bounding box
+//! \param inv_cell_size Inverse size of a grid cell
+//! \return Morton key
+inline unsigned int morton_key(const phaistos::Vector_3D &position,
+                               const phaistos::Vector_3D &origin,
+                               const double inv_cell_size) {
+
+     const unsigned int max_cell = (1u << MORTON_BITS) - 1;
+
+     unsigned int cell[3];
+     for (unsigned int d = 0; d < 3; d++) {
+          const double x = (position[d] - origin[d]) * inv_cell_size;
+          cell[d] = (x <= 0.0) ? 0 : std::min((unsigned int)x, max_cell);
+     }
+
+     return (spread_bits(cell[0]) << 2) | (spread_bits(cell[1]) << 1) | spread_bits(cell[2]);
+}
+
+
+//! Set the indexes (index1, index2) of a list of interactions to the positions of their atoms in a list of atoms
+//! \param atoms List of atoms
+//! \param interactions Interaction list
+inline void assign_atom_indexes(const std::vector<phaistos::Atom *> &atoms,
+                                std::vector<topology::NonBondedInteraction> &interactions) {
+
+     std::map<phaistos::Atom *, unsigned int> index_map;
+     for (unsigned int i = 0; i < atoms.size(); i++) {
+          index_map[atoms[i]] = i;
+     }
+
+     for (unsigned int k = 0; k < interactions.size(); k++) {
+          interactions[k].index1 = index_map[interactions[k].atom1];
+          interactions[k].index2 = index_map[interactions[k].atom2];
+     }
+}
+
+
+//! Contiguous copy of atom coordinates, optionally in Morton order.
+//! Pair lists store indexes into this buffer (index1, index2), so the
+//! inner loops of the non-bonded terms read coordinates from one array
+//! rather than through atom pointers scattered over residue objects.
+class CoordinateBuffer {
+
+public:
+
+     //! Atoms in buffer order
+     std::vector<phaistos::Atom *> atoms;
+
+     //! Positions of atoms in buffer order
+     std::vector<phaistos::Vector_3D> positions;
+
+     //! Default constructor
+     CoordinateBuffer() {}
+
+     //! Constructor. Atoms are initially in chain iteration order.
+     //! \param chain Molecule chain
+     CoordinateBuffer(phaistos::ChainFB *chain) {
+
+          for (phaistos::AtomIterator<phaistos::ChainFB, phaistos::definitions::ALL> it(*chain); !it.end(); ++it) {
+               this->atoms.push_back(&*it);
+          }
+          this->positions.resize(this->atoms.size());
+          update();
+     }
+
+     //! Copy current atom positions into the buffer
+     void update() {
+
+          for (unsigned int i = 0; i < this->atoms.size(); i++) {
+               this->positions[i] = this->atoms[i]->position;
+          }
+     }
+
+     //! Set the buffer indexes of a list of interactions from their atom pointers
+     //! \param interactions Interaction list
+     void assign_indexes(std::vector<topology::NonBondedInteraction> &interactions) const {
+          assign_atom_indexes(this->atoms, interactions);
+     }
+
+     //! Reorder the buffer along a Morton curve through the current atom positions
+     //! \return Map from old to new buffer index
+     std::vector<unsigned int> sort_morton() {
+
+          const unsigned int n_atoms = this->atoms.size();
+
+          update();
+
+          std::vector<unsigned int> new_index(n_atoms);
+          if (n_atoms == 0)
+               return new_index;
+
+          // Bounding box of all atoms
+          phaistos::Vector_3D lower = this->positions[0];
+          phaistos::Vector_3D upper = this->positions[0];
+          for (unsigned int i = 1; i < n_atoms; i++) {
+               for (unsigned int d = 0; d < 3; d++) {
+                    lower[d] = std::min(lower[d], this->positions[i][d]);
+                    upper[d] = std::max(upper[d], this->positions[i][d]);
+               }
+          }
+
+          double extent = 0.0;
+          for (unsigned int d = 0; d < 3; d++) {
+               extent = std::max(extent, upper[d] - lower[d]);
+          }
+          const double inv_cell_size = (extent > 0.0) ? (1u << MORTON_BITS) / (extent * (1.0 + 1e-9)) : 0.0;
+
+          // Sort by key (ties broken by current order, so sorting is deterministic)
+          std::vector<std::pair<unsigned int, unsigned int> > keys(n_atoms);
+          for (unsigned int i = 0; i < n_atoms; i++) {
+               keys[i] = std::make_pair(morton_key(this->positions[i], lower, inv_cell_size), i);
+          }
+          std::sort(keys.begin(), keys.end());
+
+          std::vector<phaistos::Atom *> sorted_atoms(n_atoms);
+          for (unsigned int i = 0; i < n_atoms; i++) {
+               sorted_atoms[i] = this->atoms[keys[i].second];
+               new_index[keys[i].second] = i;
+          }
+          this->atoms.swap(sorted_atoms);
+
+          update();
+
+          return new_index;
+     }
+};
+
+
+//! Ordering of interactions by the buffer positions of their atoms
+struct InteractionBufferCompare {
+
+     //! Comparison operator
+     bool operator()(const topology::NonBondedInteraction &interaction1,
+                     const topology::NonBondedInteraction &interaction2) const {
+
+          const unsigned int low1 = std::min(interaction1.index1, interaction1.index2);
+          const unsigned int low2 = std::min(interaction2.index1, interaction2.index2);
+
+          if (low1 != low2)
+               return low1 < low2;
+
+          return std::max(interaction1.index1, interaction1.index2) < std::max(interaction2.index1, interaction2.index2);
+     }
+};
+
+
+//! Reorder a coordinate buffer along a Morton curve and update the interaction
+//! indexes accordingly. Interactions are sorted to follow the buffer order within
+//! each of the given ranges, so consecutive interactions touch nearby coordinates.
+//! \param coordinate_buffer Coordinate buffer
+//! \param interactions Interaction list
+//! \param range_begins First index of each range of interactions that is sorted separately
+inline void reorder_interactions(CoordinateBuffer &coordinate_buffer,
+                                 std::vector<topology::NonBondedInteraction> &interactions,
+                                 const std::vector<unsigned int> &range_begins=std::vector<unsigned int>(1, 0)) {
+
+     const std::vector<unsigned int> new_index = coordinate_buffer.sort_morton();
+
+     for (unsigned int k = 0; k < interactions.size(); k++) {
+          interactions[k].index1 = new_index[interactions[k].index1];
+          interactions[k].index2 = new_index[interactions[k].index2];
+     }
+
+     for (unsigned int r = 0; r < range_begins.size(); r++) {
+
+          const unsigned int begin = range_begins[r];
+          const unsigned int end = (r + 1 < range_begins.size()) ? range_begins[r + 1] : interactions.size();
+
+          std::sort(interactions.begin() + begin, interactions.begin() + end, InteractionBufferCompare());
+     }
+}
+
+} // End namespace charmm_spatial
+
+#endif
@@ -0,0 +1,93 @@
+// switching.h -- CHARMM atom-based switching function for non-bonded cutoffs
+// Copyright (C) 2026 agent
+//
+// This file is part of Phaistos
+//
+// Phaistos is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Phaistos is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Phaistos.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+#ifndef CHARMM_SWITCHING_H
+#define CHARMM_SWITCHING_H
+
+#include <iostream>
+#include <cstdlib>
+
+namespace charmm_switching {
+
+//! CHARMM atom-based energy switching function (SWITch for electrostatics, VSWItch for van der Waals).
+//! S(r) = 1 for r < ctonnb, 0 for r > ctofnb, and in between
+//! S(r) = (roff^2 - r^2)^2 (roff^2 + 2 r^2 - 3 ron^2) / (roff^2 - ron^2)^3
+class SwitchingFunction {
+
+public:
+
+     //! Whether a cutoff is used at all
+     bool enabled;
+
+     //! Square of distance where switching starts (ctonnb^2)
+     double r_on_sq;
+
+     //! Square of distance where the energy is zero (ctofnb^2)
+     double r_off_sq;
+
+     //! 1 / (roff^2 - ron^2)^3
+     double inv_denominator;
+
+     //! Constructor
+     //! \param ctonnb Distance where switching starts (Angstrom)
+     //! \param ctofnb Distance beyond which the energy is zero (Angstrom, 0: no cutoff)
+     SwitchingFunction(const double ctonnb=0.0, const double ctofnb=0.0)
+          : enabled(ctofnb > 0.0),
+            r_on_sq(ctonnb * ctonnb),
+            r_off_sq(ctofnb * ctofnb),
+            inv_denominator(0.0) {
+
+          if (!this->enabled)
+               return;
+
+          if (ctonnb > ctofnb || ctonnb < 0.0) {
+               std::cerr << "# Error: ctonnb (" << ctonnb << ") must be between 0 and ctofnb (" << ctofnb << ").\n";
+               exit(EXIT_FAILURE);
+          }
+
+          // ctonnb == ctofnb is a plain truncation
+          if (this->r_off_sq > this->r_on_sq) {
+               const double denominator = this->r_off_sq - this->r_on_sq;
+               this->inv_denominator = 1.0 / (denominator * denominator * denominator);
+          }
+     }
+
+     //! Whether an atom pair is beyond the cutoff (only meaningful if enabled)
+     //! \param r_sq Squared distance
+     //! \return True if the pair does not contribute
+     bool is_cut(const double r_sq) const {
+          return r_sq >= this->r_off_sq;
+     }
+
+     //! Value of the switching function for a pair within the cutoff
+     //! \param r_sq Squared distance (must be less than ctofnb^2)
+     //! \return Value of S(r)
+     double value(const double r_sq) const {
+
+          if (r_sq <= this->r_on_sq)
+               return 1.0;
+
+          const double d = this->r_off_sq - r_sq;
+          return d * d * (this->r_off_sq + 2.0 * r_sq - 3.0 * this->r_on_sq) * this->inv_denominator;
+     }
+};
+
+} // End namespace charmm_switching
+
+#endif
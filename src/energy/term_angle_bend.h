@@ -24,7 +24,9 @@
 
 #include "energy/energy_term.h"
 #include "parsers/topology_parser.h"
-#include "parameters/angle_bend_itp.h"
+#include "parameters/angle_bend_parameters.h"
+#include "parallel_sum.h"
+#include "bonded_kernels.h"
 
 namespace phaistos {
 
@@ -39,11 +41,36 @@ protected:
 
 public:
 
-     //! Use same settings as base class
-     typedef EnergyTerm<ChainFB>::SettingsClassicEnergy Settings;
+     //! Local settings class.
+     const class Settings: public EnergyTerm<ChainFB>::SettingsClassicEnergy {
+     public:
+
+          //! Number of threads used in evaluation (0: all available)
+          int threads;
+
+          //! Directory of topology images ("": interactions are always generated)
+          std::string topology_image_dir;
+
+          //! Constructor
+          Settings(int threads=1,
+                   std::string topology_image_dir="")
+               : threads(threads),
+                 topology_image_dir(topology_image_dir) {}
+
+          //! Output operator
+          friend std::ostream &operator<<(std::ostream &o, const Settings &settings) {
+               o << "threads:" << settings.threads << "\n";
+               o << "topology-image-dir:" << settings.topology_image_dir << "\n";
+               o << static_cast<const EnergyTerm<ChainFB>::Settings>(settings);
+               return o;
+          }
+     } settings;    //!< Local settings object
 
      //! List of all angle energy terms that need to be computed
-     std::vector<topology::AngleBendInteraction> angle_bend_interactions;
+     charmm_bonded::AngleList angle_bend_interactions;
+
+     //! Topology images of the interaction lists (keeps the images that were read mapped)
+     topology::TopologyImageDirectory topology_images;
 
      //! Constructor.
      //! \param chain Molecule chain
@@ -52,13 +79,10 @@ public:
      TermCharmmAngleBend(ChainFB *chain,
                     const Settings &settings = Settings(),
                     RandomNumberEngine *random_number_engine = &random_global)
-          : EnergyTermCommon(chain, "charmm-angle-bend", settings, random_number_engine) {
+          : EnergyTermCommon(chain, "charmm-angle-bend", settings, random_number_engine),
+            settings(settings) {
 
-          std::vector<topology::AngleBendParameter> angle_bend_parameters = 
-                    topology::read_angle_bend_parameters(charmm_constants::angle_bend_itp);
-
-          this->angle_bend_interactions =
-                    topology::generate_angle_bend_interactions(this->chain, angle_bend_parameters);
+          setup_interactions();
      }
 
      //! Copy constructor.
@@ -69,67 +93,89 @@ public:
      TermCharmmAngleBend(const TermCharmmAngleBend &other,
                  RandomNumberEngine *random_number_engine,
                  int thread_index, ChainFB *chain)
-          : EnergyTermCommon(other, random_number_engine, thread_index, chain) {
+          : EnergyTermCommon(other, random_number_engine, thread_index, chain),
+            settings(other.settings) {
+
+          setup_interactions();
+     }
+
+     //! Read the interactions from their topology image, or generate them
+     void setup_interactions() {
+
+          std::vector<topology::AngleBendInteraction> angle_bend_interactions;
+
+          this->topology_images = topology::TopologyImageDirectory(this->chain, this->settings.topology_image_dir);
+          if (!this->topology_images.read("angle-bend", angle_bend_interactions)) {
 
-          std::vector<topology::AngleBendParameter> angle_bend_parameters = 
-                    topology::read_angle_bend_parameters(charmm_constants::angle_bend_itp);
+               std::vector<topology::AngleBendParameter> angle_bend_parameters =
+                         topology::get_angle_bend_parameters();
 
-          this->angle_bend_interactions =
-                    topology::generate_angle_bend_interactions(this->chain, angle_bend_parameters);
+               angle_bend_interactions = topology::generate_angle_bend_interactions(this->chain, angle_bend_parameters,
+                                                                                    this->settings.threads);
+               this->topology_images.write("angle-bend", angle_bend_interactions);
+          }
 
+          charmm_bonded::fill(angle_bend_interactions, this->angle_bend_interactions);
      }
 
-     //! Evaluate chain energy
-     //! \param move_info object containing information about last move
-     //! \return angle bend potential energy of the chain in the object
-     double evaluate(MoveInfo *move_info = NULL) {
+     //! Sum the energies of a range of angles
+     //! \param begin Index of first angle
+     //! \param end Index after last angle
+     //! \param energies Sums of angle bend energies (index 0) and Urey-Bradley energies (index 1) in kJ/mol
+     void calculate_energy_range(const unsigned int begin, const unsigned int end, double *energies) const {
 
-          double energy_sum = 0.0;
-          double energy_angle = 0.0;
-          double energy_urey = 0.0;
+          this->angle_bend_interactions.add_energies(begin, end, energies);
+     }
 
-          for (unsigned int i = 0; i < this->angle_bend_interactions.size(); i++){
+     //! Print the energy of each angle
+     void print_interactions() const {
 
-               topology::AngleBendInteraction interaction = this->angle_bend_interactions[i];
+          const charmm_bonded::AngleList &angles = this->angle_bend_interactions;
 
-               const double theta = calc_angle((interaction.atom1)->position,
-                                               (interaction.atom2)->position,
-                                               (interaction.atom3)->position);
+          double theta[charmm_bonded::BLOCK_SIZE];
+          double r13[charmm_bonded::BLOCK_SIZE];
+          double energy_angle_bend_temp[charmm_bonded::BLOCK_SIZE];
+          double energy_urey_bradley_temp[charmm_bonded::BLOCK_SIZE];
 
-               // Angle bend part
-               const double dtheta = theta - interaction.theta0 * charmm_constants::DEG_TO_RAD;
-               const double energy_angle_bend_temp = 0.5 * interaction.k0 * dtheta * dtheta; 
+          for (unsigned int block = 0; block < angles.size(); block += charmm_bonded::BLOCK_SIZE) {
 
-               energy_angle += energy_angle_bend_temp;
+               const unsigned int n = std::min(charmm_bonded::BLOCK_SIZE, angles.size() - block);
+               angles.evaluate_block(block, n, theta, r13, energy_angle_bend_temp, energy_urey_bradley_temp);
 
-               // Urey-Bradley part
-               const double r13 = ((interaction.atom1)->position - (interaction.atom3)->position).norm() * charmm_constants::ANGS_TO_NM;
-               const double dr = r13 - interaction.r13;
-               const double energy_urey_bradley_temp = 0.5 * interaction.kub * dr * dr;
+               for (unsigned int i = 0; i < n; i++) {
 
-               energy_urey += energy_urey_bradley_temp;
-               energy_sum += energy_angle_bend_temp + energy_urey_bradley_temp;
+                    std::cout << "# CHARMM angle-bend-term:"
 
+                              << " a1: " << angles.atom1[block + i]
+                              << " a2: " << angles.atom2[block + i]
+                              << " a3: " << angles.atom3[block + i]
 
-               if (this->settings.debug > 1) {
+                              << " angle: " << theta[i] * charmm_constants::RAD_TO_DEG
+                              << " e_bend: " << energy_angle_bend_temp[i]
 
-                   std::cout << "# CHARMM angle-bend-term:" 
+                              << " r: : " << r13[i] * charmm_constants::NM_TO_ANGS
+                              << " e_ub : " << energy_urey_bradley_temp[i]
 
-                             << " a1: " << interaction.atom1
-                             << " a2: " << interaction.atom2
-                             << " a3: " << interaction.atom3
+                              << std::endl;
+               }
+          }
+     }
 
-                             << " angle: " << theta * charmm_constants::RAD_TO_DEG
-                             << " e_bend: " << energy_angle_bend_temp
+     //! Evaluate chain energy
+     //! \param move_info object containing information about last move
+     //! \return angle bend potential energy of the chain in the object
+     double evaluate(MoveInfo *move_info = NULL) {
 
-                             << " r: : " << r13 * charmm_constants::NM_TO_ANGS
-                             << " e_ub : " << energy_urey_bradley_temp
+          double energies[2];
+          charmm_parallel::chunked_sum(*this, &TermCharmmAngleBend::calculate_energy_range,
+                                       this->angle_bend_interactions.size(), 2, this->settings.threads, energies);
 
-                             << std::endl;
-                             
-              
-                }
+          const double energy_angle = energies[0];
+          const double energy_urey = energies[1];
+          const double energy_sum = energy_angle + energy_urey;
 
+          if (this->settings.debug > 1) {
+               print_interactions();
           }
 
           if (this->settings.debug > 0) {
@@ -23,7 +23,8 @@
 #include <string>
 #include "energy/energy_term.h"
 #include "parsers/topology_parser.h"
-#include "parameters/bond_stretch_itp.h"
+#include "parameters/bond_stretch_parameters.h"
+#include "bonded_kernels.h"
 
 namespace phaistos {
 
@@ -42,7 +43,7 @@ public:
      typedef EnergyTerm<ChainFB>::SettingsClassicEnergy Settings;
 
      //! List of all bonded pair interactions that need to be computed
-     std::vector<topology::BondedPairInteraction> bonded_pair_interactions;
+     charmm_bonded::BondList bonded_pair_interactions;
 
      //! Constructor
      //! \param chain Molecule chain
@@ -55,10 +56,11 @@ public:
 
           // Read parameters from parameter file
           std::vector<topology::BondedPairParameter> bonded_pair_parameters 
-              = topology::read_bonded_pair_parameters(charmm_constants::bond_stretch_itp);
+              = topology::get_bonded_pair_parameters();
 
           // Generate bond stretch terms
-          this->bonded_pair_interactions = topology::generate_bonded_pair_interactions(this->chain, bonded_pair_parameters);
+          charmm_bonded::fill(topology::generate_bonded_pair_interactions(this->chain, bonded_pair_parameters),
+                              this->bonded_pair_interactions);
 
      }
 
@@ -74,49 +76,56 @@ public:
 
           // Read parameters from parameter file
           std::vector<topology::BondedPairParameter> bonded_pair_parameters 
-              = topology::read_bonded_pair_parameters(charmm_constants::bond_stretch_itp);
+              = topology::get_bonded_pair_parameters();
 
           // Generate bond stretch terms
-          this->bonded_pair_interactions = topology::generate_bonded_pair_interactions(this->chain, bonded_pair_parameters);
+          charmm_bonded::fill(topology::generate_bonded_pair_interactions(this->chain, bonded_pair_parameters),
+                              this->bonded_pair_interactions);
 
      }
 
-     //! Evaluate chain energy
-     //! \param move_info object containing information about last move
-     //! \return bond stretch potential energy of the chain in the object
-     double evaluate(MoveInfo *move_info=NULL) {
-
-          double e_bond = 0.0;
+     //! Print the energy of each bond
+     void print_interactions() const {
 
-          for (unsigned int i = 0; i < this->bonded_pair_interactions.size(); i++){
+          const charmm_bonded::BondList &pairs = this->bonded_pair_interactions;
 
-               topology::BondedPairInteraction pair = this->bonded_pair_interactions[i];
+          double r[charmm_bonded::BLOCK_SIZE];
+          double e_bond_temp[charmm_bonded::BLOCK_SIZE];
 
-               const double r = ((pair.atom1)->position - (pair.atom2)->position).norm() * charmm_constants::ANGS_TO_NM;
-               const double kb = pair.kb;
-               const double r0 = pair.r0;
+          for (unsigned int block = 0; block < pairs.size(); block += charmm_bonded::BLOCK_SIZE) {
 
-               const double dr = r - r0;
-               const double e_bond_temp = 0.5 * kb * dr * dr;
+               const unsigned int n = std::min(charmm_bonded::BLOCK_SIZE, pairs.size() - block);
+               pairs.evaluate_block(block, n, r, e_bond_temp);
 
-               e_bond += e_bond_temp;
-
-
-               if (this->settings.debug > 1) {
+               for (unsigned int i = 0; i < n; i++) {
 
                    std::cout << "# CHARMM bond-stretch-term:" 
 
-                             << " a1: " << pair.atom1
-                             << " a2: " << pair.atom2
+                             << " a1: " << pairs.atom1[block + i]
+                             << " a2: " << pairs.atom2[block + i]
 
-                             << " r: : " << r * charmm_constants::NM_TO_ANGS
-                             << " e_stretch : " << e_bond_temp
+                             << " r: : " << r[i] * charmm_constants::NM_TO_ANGS
+                             << " e_stretch : " << e_bond_temp[i]
 
                              << std::endl;
-                             
                }
-          
           }
+     }
+
+     //! Evaluate chain energy
+     //! \param move_info object containing information about last move
+     //! \return bond stretch potential energy of the chain in the object
+     double evaluate(MoveInfo *move_info=NULL) {
+
+          double energies[1] = {0.0};
+          this->bonded_pair_interactions.add_energies(0, this->bonded_pair_interactions.size(), energies);
+
+          const double e_bond = energies[0];
+
+          if (this->settings.debug > 1) {
+               print_interactions();
+          }
+
           if (this->settings.debug > 0) {
                printf("     bond-stretch E = %15.6f kJ/mol\n", e_bond);
                printf("     bond-stretch E = %15.6f kcal/mol\n", e_bond * charmm_constants::KJ_TO_KCAL);
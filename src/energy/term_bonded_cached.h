@@ -25,10 +25,12 @@
 #include "energy/energy_term.h"
 #include "parsers/topology_parser.h"
 #include "term_cmap_tables.h"
-#include "parameters/angle_bend_itp.h"
-#include "parameters/bond_stretch_itp.h"
-#include "parameters/imptor_itp.h"
-#include "parameters/torsion_itp.h"
+#include "cache_statistics.h"
+#include "bonded_kernels.h"
+#include "parameters/angle_bend_parameters.h"
+#include "parameters/bond_stretch_parameters.h"
+#include "parameters/imptor_parameters.h"
+#include "parameters/torsion_parameters.h"
 
 
 namespace phaistos {
@@ -54,17 +56,39 @@ public:
           bool ignore_improper_torsion_angles;
           bool ignore_cmap_correction;
 
+          //! Whether to print cache statistics when the term is destroyed
+          bool print_cache_statistics;
+
+          //! Whether to skip the bond stretch, angle bend and Urey-Bradley terms in moves
+          //! that leave the bond geometry unchanged, and the backbone dihedral terms in
+          //! moves that leave the backbone atoms in place
+          bool skip_invariant_terms;
+
+          //! Number of threads used to generate the interactions (0: all available)
+          int threads;
+
+          //! Directory of topology images ("": interactions are always generated)
+          std::string topology_image_dir;
+
           //! Constructor
           Settings(bool ignore_bond_angles=false,
                    bool ignore_bond_stretch=false,
                    bool ignore_torsion_angles=false,
                    bool ignore_improper_torsion_angles=false,
-                   bool ignore_cmap_correction=false)
+                   bool ignore_cmap_correction=false,
+                   bool print_cache_statistics=false,
+                   bool skip_invariant_terms=true,
+                   int threads=1,
+                   std::string topology_image_dir="")
                : ignore_bond_angles(ignore_bond_angles),
                  ignore_bond_stretch(ignore_bond_stretch),
                  ignore_torsion_angles(ignore_torsion_angles),
                  ignore_improper_torsion_angles(ignore_improper_torsion_angles),
-                 ignore_cmap_correction(ignore_cmap_correction) {}
+                 ignore_cmap_correction(ignore_cmap_correction),
+                 print_cache_statistics(print_cache_statistics),
+                 skip_invariant_terms(skip_invariant_terms),
+                 threads(threads),
+                 topology_image_dir(topology_image_dir) {}
 
           //! Output operator
           friend std::ostream &operator<<(std::ostream &o, const Settings &settings) {
@@ -73,21 +97,48 @@ public:
                o << "ignore-torsion-angles:" << settings.ignore_torsion_angles << "\n";
                o << "ignore-improper-torsion-angles:" << settings.ignore_improper_torsion_angles << "\n";
                o << "ignore-cmap-correction:" << settings.ignore_cmap_correction << "\n";
+               o << "print-cache-statistics:" << settings.print_cache_statistics << "\n";
+               o << "skip-invariant-terms:" << settings.skip_invariant_terms << "\n";
+               o << "threads:" << settings.threads << "\n";
+               o << "topology-image-dir:" << settings.topology_image_dir << "\n";
                o << static_cast<const EnergyTerm<ChainFB>::Settings>(settings);
                return o;
           }
      } settings;    //!< Local settings object
 
+     //! Energy group of bond stretch, angle bend and Urey-Bradley interactions,
+     //! which do not change in moves that only change dihedrals
+     static const unsigned int GEOMETRY = 0;
+
+     //! Energy group of torsions and improper torsions between backbone atoms
+     //! (including CB) and the CMAP correction, which do not change in side chain moves
+     static const unsigned int BACKBONE_DIHEDRALS = 1;
+
+     //! Energy group of all other torsions and improper torsions
+     static const unsigned int SIDECHAIN_DIHEDRALS = 2;
+
+     //! Number of energy groups
+     static const unsigned int N_ENERGY_GROUPS = 3;
+
      //! Struct that holds lists of all interaction the needs 
      //! to be computed if a residue is changed.
      struct BondedCachedResidue {
 
-          std::vector<topology::AngleBendInteraction> angle_bend_interactions;
-          std::vector<topology::BondedPairInteraction> bonded_pair_interactions;
-          std::vector<topology::ImproperTorsionInteraction> improper_torsion_interactions;
-          std::vector<topology::TorsionInteraction> torsion_interactions;
+          charmm_bonded::AngleList angle_bend_interactions;
+          charmm_bonded::BondList bonded_pair_interactions;
+
+          // Dihedral interactions, indexed by BACKBONE_DIHEDRALS or SIDECHAIN_DIHEDRALS
+          charmm_bonded::ImproperList improper_torsion_interactions[N_ENERGY_GROUPS];
+          charmm_bonded::TorsionList torsion_interactions[N_ENERGY_GROUPS];
+
+          // Torsions that correspond to degrees of freedom of the chain
+          charmm_bonded::TorsionList dof_torsion_interactions[N_ENERGY_GROUPS];
+
           topology::CmapInteraction cmap_interaction;
 
+          // Positions of the atoms of the BACKBONE_DIHEDRALS group when it was last computed
+          charmm_bonded::PositionReference backbone_positions;
+
           // If the CMAP correction has to be computed for this residue, 
           // i.e. if it is not first or last residue in the chain.
           bool has_cmap;
@@ -98,11 +149,16 @@ public:
           // Backup of last energy, which is used in caching.
           double energy_old;
 
+          // Current energy of each energy group
+          double group_energy_new[N_ENERGY_GROUPS];
+
+          // Backup of last energy of each energy group
+          double group_energy_old[N_ENERGY_GROUPS];
+
      };
 
-     //! Table which contains the CMAP correction tables
-     //! in Gromacs' format
-     std::vector<std::vector<double> > cmap_data;
+     //! Bicubic coefficients of the CMAP correction tables (shared)
+     boost::shared_ptr<const charmm_cmap::CmapTable> cmap_table;
 
      //! Vector containing a list of all interaction 
      std::vector<BondedCachedResidue> bonded_cached_residues;
@@ -122,41 +178,92 @@ public:
      //! Flag to keep track of none-moves
      bool none_move;
 
+     //! Counters for cache effectiveness
+     charmm_cache::CacheStatistics statistics;
+
+     //! Torsional degrees of freedom of the chain
+     charmm_bonded::DegreesOfFreedom degrees_of_freedom;
+
+     //! Whether the offsets between torsions and degrees of freedom have to be
+     //! updated if the current move is accepted
+     bool offsets_outdated;
+
+     //! Bond geometry of the chain when the offsets were last updated
+     //! (only used if skip_invariant_terms is set)
+     charmm_bonded::BondGeometry bond_geometry;
+
+     //! Topology images of the interaction lists (keeps the images that were read mapped)
+     topology::TopologyImageDirectory topology_images;
+
+     //! Whether the backbone positions have to be updated if the current move is accepted
+     bool backbone_outdated;
+
      //! Setup 
      void setup_caches() {
 
-          // Get CMAP data from the Gromacs code.
-          this->cmap_data = charmm_cmap::setup_cmap();
-          std::vector<topology::CmapInteraction> cmap_interactions 
-              = topology::generate_cmap_interactions(this->chain);
+          // Get the shared CMAP interpolation coefficients
+          this->cmap_table = charmm_cmap::get_cmap_table();
+
+          // Interaction lists are read from their topology images if there are any
+          this->topology_images = topology::TopologyImageDirectory(this->chain, this->settings.topology_image_dir);
+
+          // Bond graph and atom types, shared by all generators (built when first needed)
+          topology::ChainTopology chain_topology(this->chain);
+
+          std::vector<topology::CmapInteraction> cmap_interactions;
+          if (!this->topology_images.read("cmap", cmap_interactions)) {
+               cmap_interactions = topology::generate_cmap_interactions(chain_topology);
+               this->topology_images.write("cmap", cmap_interactions);
+          }
+
+          std::vector<topology::AngleBendInteraction> angle_bend_interactions;
+          if (!this->topology_images.read("angle-bend", angle_bend_interactions)) {
+
+               // Read angle-bend parameters.
+               std::vector<topology::AngleBendParameter> angle_bend_parameters = 
+                         topology::get_angle_bend_parameters();
+
+               angle_bend_interactions = topology::generate_angle_bend_interactions(chain_topology, angle_bend_parameters,
+                                                                                    this->settings.threads);
+               this->topology_images.write("angle-bend", angle_bend_interactions);
+          }
+
+          std::vector<topology::BondedPairInteraction> bonded_pair_interactions;
+          if (!this->topology_images.read("bond-stretch", bonded_pair_interactions)) {
 
-          // Read angle-bend parameters.
-          std::vector<topology::AngleBendParameter> angle_bend_parameters = 
-                    topology::read_angle_bend_parameters(charmm_constants::angle_bend_itp);
+               // Read bond-stretch parameters.
+               std::vector<topology::BondedPairParameter> bonded_pair_parameters 
+                   = topology::get_bonded_pair_parameters();
 
-          std::vector<topology::AngleBendInteraction> angle_bend_interactions 
-              = topology::generate_angle_bend_interactions(this->chain, angle_bend_parameters);
+               bonded_pair_interactions = topology::generate_bonded_pair_interactions(chain_topology, bonded_pair_parameters,
+                                                                                      this->settings.threads);
+               this->topology_images.write("bond-stretch", bonded_pair_interactions);
+          }
 
-          // Read bond-stretch parameters.
-          std::vector<topology::BondedPairParameter> bonded_pair_parameters 
-              = topology::read_bonded_pair_parameters(charmm_constants::bond_stretch_itp);
+          std::vector<topology::ImproperTorsionInteraction> improper_torsion_interactions;
+          if (!this->topology_images.read("improper-torsion", improper_torsion_interactions)) {
 
-          std::vector<topology::BondedPairInteraction> bonded_pair_interactions
-              = topology::generate_bonded_pair_interactions(this->chain, bonded_pair_parameters);
+               // Read improper torsion parameters.
+               std::vector<topology::ImproperTorsionParameter> improper_torsion_parameters 
+                         = topology::get_improper_torsion_parameters();
 
-          // Read improper torsion parameters.
-          std::vector<topology::ImproperTorsionParameter> improper_torsion_parameters 
-                    = topology::read_improper_torsion_parameters(charmm_constants::imptor_itp);
+               improper_torsion_interactions
+                   = topology::generate_improper_torsion_interactions(chain_topology, improper_torsion_parameters,
+                                                                      this->settings.threads);
+               this->topology_images.write("improper-torsion", improper_torsion_interactions);
+          }
 
-          std::vector<topology::ImproperTorsionInteraction> improper_torsion_interactions
-              = topology::generate_improper_torsion_interactions(this->chain, improper_torsion_parameters);
+          std::vector<topology::TorsionInteraction> torsion_interactions;
+          if (!this->topology_images.read("torsion", torsion_interactions)) {
 
-          // Get proper torsion parameters.
-          std::vector<topology::TorsionParameter> torsion_parameters 
-                    = topology::read_torsion_parameters(charmm_constants::torsion_itp);
+               // Get proper torsion parameters.
+               std::vector<topology::TorsionParameter> torsion_parameters 
+                         = topology::get_torsion_parameters();
 
-          std::vector<topology::TorsionInteraction> torsion_interactions
-              = topology::generate_torsion_interactions(this->chain, torsion_parameters);
+               torsion_interactions = topology::generate_torsion_interactions(chain_topology, torsion_parameters,
+                                                                              this->settings.threads);
+               this->topology_images.write("torsion", torsion_interactions);
+          }
 
           // Make room in cache vector for all residues.
           this->bonded_cached_residues.resize(this->chain->size());
@@ -172,7 +279,7 @@ public:
                index = std::min((interaction.atom3)->residue->index,
                                 index);
 
-               this->bonded_cached_residues[index].angle_bend_interactions.push_back(interaction);
+               this->bonded_cached_residues[index].angle_bend_interactions.add(interaction);
 
           }
 
@@ -184,7 +291,7 @@ public:
                int index = std::min((interaction.atom1)->residue->index,
                                     (interaction.atom2)->residue->index);
 
-               this->bonded_cached_residues[index].bonded_pair_interactions.push_back(interaction);
+               this->bonded_cached_residues[index].bonded_pair_interactions.add(interaction);
 
           }
 
@@ -202,7 +309,7 @@ public:
                index = std::min((interaction.atom4)->residue->index,
                                 index);
 
-               this->bonded_cached_residues[index].improper_torsion_interactions.push_back(interaction);
+               this->bonded_cached_residues[index].improper_torsion_interactions[get_dihedral_group(interaction)].add(interaction);
 
           }
 
@@ -220,7 +327,11 @@ public:
                index = std::min((interaction.atom4)->residue->index,
                                 index);
 
-               this->bonded_cached_residues[index].torsion_interactions.push_back(interaction);
+               if (interaction.dof_type == topology::DOF_NONE) {
+                    this->bonded_cached_residues[index].torsion_interactions[get_dihedral_group(interaction)].add(interaction);
+               } else {
+                    this->bonded_cached_residues[index].dof_torsion_interactions[get_dihedral_group(interaction)].add(interaction);
+               }
 
           }
 
@@ -240,130 +351,275 @@ public:
 
          }
 
+         // Initialize the offsets between torsions and degrees of freedom
+         this->degrees_of_freedom.resize(this->chain->size());
+         for (unsigned int i = 0; i < this->bonded_cached_residues.size(); i ++) {
+              for (unsigned int group = 0; group < N_ENERGY_GROUPS; group++) {
+                   this->bonded_cached_residues[i].dof_torsion_interactions[group].use_degrees_of_freedom(this->degrees_of_freedom);
+              }
+         }
+         this->degrees_of_freedom.update(this->chain, 0, this->chain->size() - 1);
+         update_offsets(0, this->chain->size() - 1);
+         this->offsets_outdated = false;
+
+         // References to find out which energy groups a move changed
+         if (this->settings.skip_invariant_terms) {
+
+              this->bond_geometry = charmm_bonded::BondGeometry(chain_topology.get_bond_graph());
+
+              for (unsigned int i = 0; i < this->bonded_cached_residues.size(); i ++) {
+
+                   BondedCachedResidue &cached_residue = this->bonded_cached_residues[i];
+                   cached_residue.backbone_positions.add(cached_residue.torsion_interactions[BACKBONE_DIHEDRALS]);
+                   cached_residue.backbone_positions.add(cached_residue.dof_torsion_interactions[BACKBONE_DIHEDRALS]);
+                   cached_residue.backbone_positions.add(cached_residue.improper_torsion_interactions[BACKBONE_DIHEDRALS]);
+
+                   if (cached_residue.has_cmap) {
+                        Residue *residue = cached_residue.cmap_interaction.residue;
+                        cached_residue.backbone_positions.add((*(residue->get_neighbour(-1)))[definitions::C]);
+                        cached_residue.backbone_positions.add((*residue)[definitions::N]);
+                        cached_residue.backbone_positions.add((*residue)[definitions::CA]);
+                        cached_residue.backbone_positions.add((*residue)[definitions::C]);
+                        cached_residue.backbone_positions.add((*(residue->get_neighbour(+1)))[definitions::N]);
+                   }
+              }
+         }
+         this->backbone_outdated = false;
+
          // Initialize energies
          this->energy_new  = 0.0;
          this->energy_old  = 0.0;
 
          // Initialize each cache
-         for (unsigned int i = 0; i < this->bonded_cached_residues.size(); i ++) {
+         const bool all_groups[N_ENERGY_GROUPS] = {true, true, true};
 
-             double residue_energy = calculate_cached_residue_energy(bonded_cached_residues[i]);
-             this->energy_new  += residue_energy;
-             this->energy_old  += residue_energy;
+         for (unsigned int i = 0; i < this->bonded_cached_residues.size(); i ++) {
 
-             this->bonded_cached_residues[i].energy_new = residue_energy;
-             this->bonded_cached_residues[i].energy_old = residue_energy;
+             update_cached_residue(bonded_cached_residues[i], all_groups);
+             backup_cached_residue(bonded_cached_residues[i]);
 
+             this->energy_new  += this->bonded_cached_residues[i].energy_new;
+             this->energy_old  += this->bonded_cached_residues[i].energy_new;
          }
 
      }
 
-     //! Calculate energy of a cached residue object
+     //! Whether an atom is a backbone atom (or CB), i.e. is not moved by side chain moves
+     //! \param atom Atom
+     static bool is_backbone_atom(const Atom *atom) {
+
+          switch (atom->atom_type) {
+          case definitions::N: case definitions::CA: case definitions::C:
+          case definitions::O: case definitions::OXT: case definitions::CB:
+          case definitions::H: case definitions::H1: case definitions::H2: case definitions::H3:
+          case definitions::HA: case definitions::HA2: case definitions::HA3:
+               return true;
+          default:
+               return false;
+          }
+     }
+
+     //! Energy group of a torsion or improper torsion
+     //! \param interaction Torsion or improper torsion interaction
+     //! \returns BACKBONE_DIHEDRALS if all four atoms are backbone atoms, otherwise SIDECHAIN_DIHEDRALS
+     template <typename INTERACTION>
+     static unsigned int get_dihedral_group(const INTERACTION &interaction) {
+
+          if (is_backbone_atom(interaction.atom1) && is_backbone_atom(interaction.atom2) &&
+              is_backbone_atom(interaction.atom3) && is_backbone_atom(interaction.atom4)) {
+               return BACKBONE_DIHEDRALS;
+          }
+          return SIDECHAIN_DIHEDRALS;
+     }
+
+     //! Calculate the energy of one energy group of a cached residue object
      //! \param cached_residue A residue object for which the energy is calculated
-     //! \returns The energy of the residue
-     double calculate_cached_residue_energy(BondedCachedResidue &cached_residue) {
+     //! \param group Energy group
+     //! \param use_degrees_of_freedom Whether to read torsions from the degrees of freedom of the chain
+     //! \returns The energy of the group
+     double calculate_cached_residue_energy(const BondedCachedResidue &cached_residue, const unsigned int group,
+                                            const bool use_degrees_of_freedom) const {
 
           // Initialize residue energy
           double energy_sum = 0.0;
 
-          // Calculate bond angle terms
-          if (!(this->settings.ignore_bond_angles)) {
+          if (group == GEOMETRY) {
 
-              for (unsigned int i = 0; i < cached_residue.angle_bend_interactions.size(); i++){
+               // Calculate bond angle terms
+               if (!(this->settings.ignore_bond_angles)) {
 
-                   topology::AngleBendInteraction interaction = cached_residue.angle_bend_interactions[i];
+                    double energies[2] = {0.0, 0.0};
+                    cached_residue.angle_bend_interactions.add_energies(0, cached_residue.angle_bend_interactions.size(), energies);
 
-                   const double theta = calc_angle((interaction.atom1)->position,
-                                                   (interaction.atom2)->position,
-                                                   (interaction.atom3)->position);
+                    energy_sum += energies[0] + energies[1];
+               }
 
-                   // Angle bend part
-                   const double dtheta = theta - interaction.theta0 * charmm_constants::DEG_TO_RAD;
-                   const double energy_angle_bend_temp = 0.5 * interaction.k0 * dtheta * dtheta;
+               // Calculate bond stretch terms
+               if (!(this->settings.ignore_bond_stretch)) {
 
-                   // Urey-Bradley part
-                   const double r13 = ((interaction.atom1)->position - (interaction.atom3)->position).norm() * charmm_constants::ANGS_TO_NM;
-                   const double dr = r13 - interaction.r13;
-                   const double energy_urey_bradley_temp = 0.5 * interaction.kub * dr * dr;
+                    double energies[1] = {0.0};
+                    cached_residue.bonded_pair_interactions.add_energies(0, cached_residue.bonded_pair_interactions.size(), energies);
 
-                   energy_sum += energy_angle_bend_temp + energy_urey_bradley_temp;
+                    energy_sum += energies[0];
                }
+
+               return energy_sum;
           }
 
-          // Calculate bond stretch terms
-          if (!(this->settings.ignore_bond_stretch)) {
+          // Calculate improper torsion terms
+          if (!(this->settings.ignore_improper_torsion_angles)) {
+
+               const charmm_bonded::ImproperList &impropers = cached_residue.improper_torsion_interactions[group];
 
-               for (unsigned int i = 0; i < cached_residue.bonded_pair_interactions.size(); i++){
+               double energies[1] = {0.0};
+               impropers.add_energies(0, impropers.size(), energies);
 
-                    topology::BondedPairInteraction interaction = cached_residue.bonded_pair_interactions[i];
+               energy_sum += energies[0];
+          }
 
-                    const double r = ((interaction.atom1)->position - (interaction.atom2)->position).norm() * charmm_constants::ANGS_TO_NM;
-                    const double kb = interaction.kb;
-                    const double r0 = interaction.r0;
+          // Calculate torsion terms
+          if (!(this->settings.ignore_torsion_angles)) {
 
-                    const double dr = r - r0;
-                    const double e_bond_temp = 0.5 * kb * dr * dr;
+               const charmm_bonded::TorsionList &torsions = cached_residue.torsion_interactions[group];
+               const charmm_bonded::TorsionList &dof_torsions = cached_residue.dof_torsion_interactions[group];
 
-                    energy_sum += e_bond_temp;
+               double energies[1] = {0.0};
+               torsions.add_energies(0, torsions.size(), energies);
+               dof_torsions.add_energies(0, dof_torsions.size(), energies,
+                                         use_degrees_of_freedom ? &this->degrees_of_freedom : NULL);
 
-               }
+               energy_sum += energies[0];
           }
 
-          // Calculate improper torsion terms
-          if (!(this->settings.ignore_improper_torsion_angles)) {
+          // Calculate CMAP correction terms
+          if (group == BACKBONE_DIHEDRALS && !(this->settings.ignore_cmap_correction)) {
+               if (cached_residue.has_cmap) {
+                     const int residue_index = cached_residue.cmap_interaction.residue_index;
+                     const unsigned int cmap_type_index = cached_residue.cmap_interaction.cmap_type_index;
 
-               for (unsigned int i = 0; i < cached_residue.improper_torsion_interactions.size(); i++){
+                     const double phi = (*(this->chain))[residue_index].get_phi();
+                     const double psi = (*(this->chain))[residue_index].get_psi();
 
-                    topology::ImproperTorsionInteraction interaction = cached_residue.improper_torsion_interactions[i];
+                     energy_sum += this->cmap_table->energy(phi, psi, cmap_type_index);
+               }
+          }
 
-                    const double phi = calc_dihedral((interaction.atom1)->position,
-                                                     (interaction.atom2)->position,
-                                                     (interaction.atom3)->position,
-                                                     (interaction.atom4)->position);
+          return energy_sum;
 
-                    const double dphi = phi - interaction.phi0 * charmm_constants::DEG_TO_RAD;
-                    const double energy_improper_torsion_temp = 0.5 * interaction.cp * dphi * dphi;
+     }
 
-                    energy_sum += energy_improper_torsion_temp;
+     //! Number of interactions in one energy group of a residue (for cache statistics)
+     //! \param cached_residue The residue for which interactions are counted
+     //! \param group Energy group
+     //! \returns The number of interactions that are not ignored
+     unsigned long count_cached_residue_interactions(const BondedCachedResidue &cached_residue, const unsigned int group) const {
 
-               }
+          unsigned long n_interactions = 0;
+
+          if (group == GEOMETRY) {
+               if (!(this->settings.ignore_bond_angles))
+                    n_interactions += cached_residue.angle_bend_interactions.size();
+               if (!(this->settings.ignore_bond_stretch))
+                    n_interactions += cached_residue.bonded_pair_interactions.size();
+               return n_interactions;
           }
 
-          // Calculate torsion terms
-          if (!(this->settings.ignore_torsion_angles)) {
+          if (!(this->settings.ignore_improper_torsion_angles))
+               n_interactions += cached_residue.improper_torsion_interactions[group].size();
+          if (!(this->settings.ignore_torsion_angles))
+               n_interactions += cached_residue.torsion_interactions[group].size()
+                               + cached_residue.dof_torsion_interactions[group].size();
+          if (group == BACKBONE_DIHEDRALS && !(this->settings.ignore_cmap_correction) && cached_residue.has_cmap)
+               n_interactions += 1;
 
-               for (unsigned int i = 0; i < cached_residue.torsion_interactions.size(); i++){
+          return n_interactions;
+     }
 
-                    topology::TorsionInteraction interaction = cached_residue.torsion_interactions[i];
+     //! Recalculate the energy of a cached residue object
+     //! \param cached_residue A residue object for which the energy is calculated
+     //! \param groups Flags for the energy groups that are recalculated. The others keep their cached energy.
+     //! If the bond geometry is unchanged, torsions are read from the degrees of freedom of the chain.
+     //! \returns The number of interactions recalculated
+     unsigned long update_cached_residue(BondedCachedResidue &cached_residue, const bool *groups) const {
 
-                    double angle = calc_dihedral((interaction.atom1)->position,
-                                                 (interaction.atom2)->position,
-                                                 (interaction.atom3)->position,
-                                                 (interaction.atom4)->position);
+          unsigned long n_interactions = 0;
 
-                    const double e_torsion_temp = interaction.cp * std::cos(interaction.mult * angle - interaction.phi0 * charmm_constants::DEG_TO_RAD) 
-                                                    + interaction.cp;
+          const bool use_degrees_of_freedom = !groups[GEOMETRY];
 
-                    energy_sum += e_torsion_temp;
-              }
+          cached_residue.energy_new = 0.0;
+
+          for (unsigned int group = 0; group < N_ENERGY_GROUPS; group++) {
+
+               if (groups[group]) {
+                    cached_residue.group_energy_new[group] = calculate_cached_residue_energy(cached_residue, group,
+                                                                                             use_degrees_of_freedom);
+                    n_interactions += count_cached_residue_interactions(cached_residue, group);
+               }
 
+               cached_residue.energy_new += cached_residue.group_energy_new[group];
           }
 
-          // Calculate CMAP correction terms
-          if (!(this->settings.ignore_cmap_correction)) {
-               if (cached_residue.has_cmap) {
-                     const int residue_index = cached_residue.cmap_interaction.residue_index;
-                     const unsigned int cmap_type_index = cached_residue.cmap_interaction.cmap_type_index;
+          return n_interactions;
+     }
 
-                     const double phi = (*(this->chain))[residue_index].get_phi();
-                     const double psi = (*(this->chain))[residue_index].get_psi();
+     //! Update the offsets between torsions and the degrees of freedom of the chain
+     //! for a range of residues, from the current atom positions and degrees of freedom
+     //! \param first_residue Index of first residue
+     //! \param last_residue Index of last residue
+     void update_offsets(const int first_residue, const int last_residue) {
 
-                     energy_sum += charmm_cmap::cmap_energy(phi, psi, cmap_type_index, this->cmap_data);
+          for (int i = first_residue; i <= last_residue; i++) {
+               for (unsigned int group = 0; group < N_ENERGY_GROUPS; group++) {
+                    this->bonded_cached_residues[i].dof_torsion_interactions[group].update_offsets(this->degrees_of_freedom);
                }
           }
+     }
 
-          return energy_sum;
+     //! Backup the energies of a cached residue object
+     //! \param cached_residue A residue object
+     void backup_cached_residue(BondedCachedResidue &cached_residue) const {
 
+          cached_residue.energy_old = cached_residue.energy_new;
+          for (unsigned int group = 0; group < N_ENERGY_GROUPS; group++) {
+               cached_residue.group_energy_old[group] = cached_residue.group_energy_new[group];
+          }
+     }
+
+     //! Restore the energies of a cached residue object from the backup
+     //! \param cached_residue A residue object
+     void restore_cached_residue(BondedCachedResidue &cached_residue) const {
+
+          cached_residue.energy_new = cached_residue.energy_old;
+          for (unsigned int group = 0; group < N_ENERGY_GROUPS; group++) {
+               cached_residue.group_energy_new[group] = cached_residue.group_energy_old[group];
+          }
+     }
+
+     //! Energy groups that have changed in a move of the residues start_index..end_index,
+     //! found from what the move did to the atoms rather than from the type of move.
+     //! Bond lengths, bond angles and Urey-Bradley distances are unchanged if the bond
+     //! geometry of the range is (as in moves that only change dihedrals), and the
+     //! backbone dihedrals if none of their atoms has moved (as in side chain moves).
+     //! \param move_info Object containing information about the move
+     //! \param groups Flags for the energy groups that can change (output)
+     void get_modified_groups(const MoveInfo *move_info, bool *groups) const {
+
+          for (unsigned int group = 0; group < N_ENERGY_GROUPS; group++) {
+               groups[group] = true;
+          }
+
+          if (!move_info || !this->settings.skip_invariant_terms)
+               return;
+
+          groups[GEOMETRY] = !this->bond_geometry.is_unchanged(this->start_index, this->end_index);
+
+          groups[BACKBONE_DIHEDRALS] = false;
+          for (int i = this->start_index; i < this->end_index+1; i ++) {
+               if (!this->bonded_cached_residues[i].backbone_positions.is_unchanged()) {
+                    groups[BACKBONE_DIHEDRALS] = true;
+                    break;
+               }
+          }
      }
 
      //! Constructor.
@@ -373,7 +629,9 @@ public:
      TermCharmmBondedCached(ChainFB *chain,
                     const Settings &settings = Settings(),
                     RandomNumberEngine *random_number_engine = &random_global)
-          : EnergyTermCommon(chain, "charmm-bonded-cached", settings, random_number_engine) {
+          : EnergyTermCommon(chain, "charmm-bonded-cached", settings, random_number_engine),
+            settings(settings),
+            statistics(0) {
 
          this->none_move = false;
          setup_caches();
@@ -387,12 +645,29 @@ public:
      TermCharmmBondedCached(const TermCharmmBondedCached &other,
                  RandomNumberEngine *random_number_engine,
                  int thread_index, ChainFB *chain)
-          : EnergyTermCommon(other, random_number_engine, thread_index, chain) {
+          : EnergyTermCommon(other, random_number_engine, thread_index, chain),
+            settings(other.settings),
+            statistics(thread_index) {
 
           this->none_move = false;
           setup_caches();
      }
 
+     //! Destructor. Prints cache statistics if requested in settings (from the copy in thread 0 only).
+     ~TermCharmmBondedCached() {
+
+          // Thread copies each count their own moves, only the main copy reports
+          if (this->settings.print_cache_statistics && this->statistics.thread_index == 0) {
+               print_cache_statistics();
+          }
+     }
+
+     //! Print cache statistics collected so far
+     //! \param o Output stream
+     void print_cache_statistics(std::ostream &o=std::cout) const {
+          this->statistics.print(o, "charmm-bonded-cached", "residues", "interactions");
+     }
+
      //! Evaluate chain energy
      //! \param move_info object containing information about last move
      //! \return angle bend potential energy of the chain in the object
@@ -414,6 +689,7 @@ public:
  
                    // Notify accept/reject functions that this was a none_move
                    this->none_move = true;
+                   this->statistics.none_moves++;
  
                    // Return energy.
                    return this->energy_new * charmm_constants::KJ_TO_KCAL;
@@ -431,13 +707,27 @@ public:
           // Local delta energy required for OpenMP -- can't just write to this->energy_new.
           double delta_energy_local = 0.0;
 
+          // Number of interactions recomputed (for cache statistics)
+          unsigned long n_interactions = 0;
+
+          // Energy groups that have to be recomputed
+          bool groups[N_ENERGY_GROUPS];
+          get_modified_groups(move_info, groups);
+
+          // With unchanged bond geometry, torsions are read from the degrees of freedom
+          // (also those of the residue after the range, which torsions in the range can refer to).
+          // Otherwise the offsets have to be updated if the move is accepted.
+          if (!groups[GEOMETRY]) {
+               this->degrees_of_freedom.update(this->chain, this->start_index, this->end_index + 1);
+          } else {
+               this->offsets_outdated = true;
+          }
+          this->backbone_outdated = this->settings.skip_invariant_terms && groups[BACKBONE_DIHEDRALS];
+
           // #pragma omp parallel for reduction(+:delta_energy_local) schedule(static)
           for (int i = this->start_index; i < this->end_index+1; i ++) {
 
-               const double residue_energy = 
-                    calculate_cached_residue_energy(this->bonded_cached_residues[i]);
-
-               this->bonded_cached_residues[i].energy_new = residue_energy;
+               n_interactions += update_cached_residue(this->bonded_cached_residues[i], groups);
 
                delta_energy_local += this->bonded_cached_residues[i].energy_new
                                    - this->bonded_cached_residues[i].energy_old;
@@ -446,6 +736,8 @@ public:
           // Add energy delta
           this->energy_new  += delta_energy_local;
 
+          this->statistics.add_evaluation(this->end_index - this->start_index + 1, n_interactions);
+
           // Return energy (and convert from kJ to kcal)
           return this->energy_new * charmm_constants::KJ_TO_KCAL;
      }
@@ -455,13 +747,33 @@ public:
      void accept() {
 
         if (this->none_move == false) {
+
+            this->statistics.accepts++;
+
             // If move is accepted, backup energies in all pairs that were recomputed
             for (int i = this->start_index; i < this->end_index+1; i ++) {
 
-                this->bonded_cached_residues[i].energy_old
-                    = this->bonded_cached_residues[i].energy_new;
+                backup_cached_residue(this->bonded_cached_residues[i]);
             }
             this->energy_old = this->energy_new;
+
+            // Bond geometry may have changed, so update the offsets of the torsions
+            if (this->offsets_outdated) {
+                this->degrees_of_freedom.update(this->chain, this->start_index, this->end_index + 1);
+                update_offsets(this->start_index, this->end_index);
+                if (this->settings.skip_invariant_terms) {
+                    this->bond_geometry.update(this->start_index, this->end_index);
+                }
+                this->offsets_outdated = false;
+            }
+
+            // Backbone atoms have moved, so update their reference positions
+            if (this->backbone_outdated) {
+                for (int i = this->start_index; i < this->end_index+1; i ++) {
+                    this->bonded_cached_residues[i].backbone_positions.update();
+                }
+                this->backbone_outdated = false;
+            }
         }
     }
 
@@ -469,13 +781,17 @@ public:
     //! Reject move and roll-back energies
     void reject() {
 
+        this->offsets_outdated = false;
+        this->backbone_outdated = false;
+
         if (this->none_move == false) {
 
+            this->statistics.rejects++;
+
             // If move is accepted, restore energies in all pairs that were recomputed
             for (int i = this->start_index; i < this->end_index+1; i ++) {
 
-                this->bonded_cached_residues[i].energy_new
-                    = this->bonded_cached_residues[i].energy_old;
+                restore_cached_residue(this->bonded_cached_residues[i]);
             }
             this->energy_new = this->energy_old;
         }
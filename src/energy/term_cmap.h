@@ -44,13 +44,114 @@ protected:
 public:
 
 
-     //! Table which contains the CMAP correction tables
-     //! in Gromacs' internal formatting
-     std::vector<std::vector<double> > cmap_data;
+     //! Bicubic coefficients of the CMAP correction tables (shared)
+     boost::shared_ptr<const charmm_cmap::CmapTable> cmap_table;
 
      //! Vector containing all terms in the CMAP correction.
      std::vector<topology::CmapInteraction> cmap_interactions;
 
+     //! Index of the CMAP interaction of each residue (-1 if none)
+     std::vector<int> residue_interaction_index;
+
+     //! CMAP energy of each interaction after the current move
+     std::vector<double> interaction_energy_new;
+
+     //! CMAP energy of each interaction before the current move
+     std::vector<double> interaction_energy_old;
+
+     //! Interactions recomputed in the current move
+     std::vector<unsigned int> modified_interactions;
+
+     //! Work arrays with phi and psi angles, CMAP types and energies of
+     //! the recomputed interactions
+     std::vector<double> phi_values;
+     std::vector<double> psi_values;
+     std::vector<unsigned int> cmap_type_values;
+     std::vector<double> energies;
+
+     //! Energy after the current move
+     double energy_new;
+
+     //! Backup of energy before current move
+     double energy_old;
+
+     //! Flag to keep track of none-moves
+     bool none_move;
+
+     //! Setup coefficient table and interaction arrays
+     void setup_interactions() {
+
+          // Get the shared CMAP interpolation coefficients
+          this->cmap_table = charmm_cmap::get_cmap_table();
+
+          // Make a list of all CMAP interactions
+          this->cmap_interactions = topology::generate_cmap_interactions(this->chain);
+
+          const unsigned int n = this->cmap_interactions.size();
+
+          this->residue_interaction_index.assign(this->chain->size(), -1);
+          for (unsigned int i = 0; i < n; i++) {
+               this->residue_interaction_index[this->cmap_interactions[i].residue_index] = i;
+          }
+
+          this->interaction_energy_new.assign(n, 0.0);
+          this->interaction_energy_old.assign(n, 0.0);
+          this->modified_interactions.reserve(n);
+
+          // Arrays have one spare element, so they are never empty
+          this->phi_values.resize(n + 1);
+          this->psi_values.resize(n + 1);
+          this->cmap_type_values.resize(n + 1, 0);
+          this->energies.resize(n + 1);
+
+          this->none_move = false;
+
+          // Initialize energies of each interaction
+          this->energy_new = 0.0;
+          for (unsigned int i = 0; i < n; i++) {
+               const int residue_index = this->cmap_interactions[i].residue_index;
+               this->interaction_energy_new[i] = this->cmap_table->energy((*(this->chain))[residue_index].get_phi(),
+                                                                          (*(this->chain))[residue_index].get_psi(),
+                                                                          this->cmap_interactions[i].cmap_type_index);
+               this->interaction_energy_old[i] = this->interaction_energy_new[i];
+               this->energy_new += this->interaction_energy_new[i];
+          }
+          this->energy_old = this->energy_new;
+     }
+
+     //! Find the interactions whose phi or psi angle may have changed.
+     //! Residues next to a modified range are included, since changes
+     //! in bond geometry at the ends of the range can affect their angles.
+     //! \param move_info Object containing information about the move (NULL: all interactions)
+     void find_modified_interactions(const MoveInfo *move_info) {
+
+          this->modified_interactions.clear();
+
+          if (!move_info) {
+               for (unsigned int i = 0; i < this->cmap_interactions.size(); i++) {
+                    this->modified_interactions.push_back(i);
+               }
+               return;
+          }
+
+          for (unsigned int k = 0; k < move_info->modified_angles.size(); k++) {
+
+               const int first = std::max(0, move_info->modified_angles[k].first - 1);
+               const int last = std::min(move_info->modified_angles[k].second + 1, this->chain->size() - 1);
+
+               for (int r = first; r <= last; r++) {
+                    if (this->residue_interaction_index[r] >= 0)
+                         this->modified_interactions.push_back(this->residue_interaction_index[r]);
+               }
+          }
+
+          // Ranges may overlap
+          std::sort(this->modified_interactions.begin(), this->modified_interactions.end());
+          this->modified_interactions.erase(std::unique(this->modified_interactions.begin(),
+                                                        this->modified_interactions.end()),
+                                            this->modified_interactions.end());
+     }
+
      //! Use same settings as base class
      typedef EnergyTerm<ChainFB>::SettingsClassicEnergy Settings;
 
@@ -63,11 +164,7 @@ public:
                         RandomNumberEngine *random_number_engine = &random_global)
           : EnergyTermCommon(chain, "charmm-cmap", settings, random_number_engine) {
 
-          // Get CMAP data from the Gromacs code.
-          this->cmap_data = charmm_cmap::setup_cmap();
-
-          // Make a list of all CMAP interactions
-          this->cmap_interactions = topology::generate_cmap_interactions(this->chain);
+          setup_interactions();
      }
 
      //! Copy constructor.
@@ -80,53 +177,115 @@ public:
                         int thread_index, ChainFB *chain)
           : EnergyTermCommon(other, random_number_engine, thread_index, chain) {
 
-          // Get CMAP data from the Gromacs code.
-          this->cmap_data = charmm_cmap::setup_cmap();
-
-          // Make a list of all CMAP interactions
-          this->cmap_interactions = topology::generate_cmap_interactions(this->chain);
+          setup_interactions();
 
      }
 
      //! Evaluate chain energy
      //! \param move_info object containing information about last move
-     //! \return torsional potential energy of the chain in the object
+     //! \return CMAP correction energy of the chain in the object
      double evaluate(MoveInfo *move_info=NULL) {
 
-          double cmap_energy = 0.0;
+          // By default don't treat energy evaluation as a none move
+          this->none_move = false;
 
-          for (unsigned int i = 0; i < this->cmap_interactions.size(); i++) {
+          if (move_info && move_info->modified_angles.empty()) {
 
-               const int residue_index = (this->cmap_interactions)[i].residue_index;
-               const unsigned int cmap_type_index = (this->cmap_interactions)[i].cmap_type_index;
-               const double phi = (*(this->chain))[residue_index].get_phi();
-               const double psi = (*(this->chain))[residue_index].get_psi();
+               // Notify accept/reject functions that this was a none_move
+               this->none_move = true;
+
+               // Return energy.
+               return this->energy_new * charmm_constants::KJ_TO_KCAL;
+          }
 
-               cmap_energy += charmm_cmap::cmap_energy(phi, psi, cmap_type_index, this->cmap_data);
+          find_modified_interactions(move_info);
 
-               if (this->settings.debug > 1) {
+          const unsigned int n = this->modified_interactions.size();
+
+          for (unsigned int k = 0; k < n; k++) {
+               const topology::CmapInteraction &interaction = this->cmap_interactions[this->modified_interactions[k]];
+               this->phi_values[k] = (*(this->chain))[interaction.residue_index].get_phi();
+               this->psi_values[k] = (*(this->chain))[interaction.residue_index].get_psi();
+               this->cmap_type_values[k] = interaction.cmap_type_index;
+          }
+
+          this->cmap_table->energies(n, &this->phi_values[0], &this->psi_values[0],
+                                     &this->cmap_type_values[0], &this->energies[0]);
+
+          if (move_info) {
+
+               // Add energy delta of the recomputed interactions
+               double delta_energy = 0.0;
+               for (unsigned int k = 0; k < n; k++) {
+                    const unsigned int i = this->modified_interactions[k];
+                    this->interaction_energy_new[i] = this->energies[k];
+                    delta_energy += this->interaction_energy_new[i] - this->interaction_energy_old[i];
+               }
+               this->energy_new = this->energy_old + delta_energy;
+
+          } else {
+
+               // Resum the energy from scratch
+               this->energy_new = 0.0;
+               for (unsigned int k = 0; k < n; k++) {
+                    this->interaction_energy_new[k] = this->energies[k];
+                    this->energy_new += this->energies[k];
+               }
+          }
+
+          if (this->settings.debug > 1) {
+               for (unsigned int k = 0; k < n; k++) {
+
+                   const topology::CmapInteraction &interaction = this->cmap_interactions[this->modified_interactions[k]];
 
                    std::cout << "# CHARMM cmap:" 
 
-                             << " i: " << residue_index + 1
-                             << " cmap-type: " << cmap_type_index
+                             << " i: " << interaction.residue_index + 1
+                             << " cmap-type: " << interaction.cmap_type_index
 
-                             << " phi: " << phi * charmm_constants::RAD_TO_DEG
-                             << " psi: " << psi * charmm_constants::RAD_TO_DEG
+                             << " phi: " << this->phi_values[k] * charmm_constants::RAD_TO_DEG
+                             << " psi: " << this->psi_values[k] * charmm_constants::RAD_TO_DEG
 
-                             << " e_cmap : " << charmm_cmap::cmap_energy(phi, psi, cmap_type_index, this->cmap_data)
+                             << " e_cmap : " << this->energies[k]
 
                              << std::endl;
-                }
-
+               }
           }
           
           if (this->settings.debug > 0) {
-               printf("             CMAP E = %15.6f kJ/mol\n", cmap_energy);
-               printf("             CMAP E = %15.6f kcal/mol\n", cmap_energy * charmm_constants::KJ_TO_KCAL);
+               printf("             CMAP E = %15.6f kJ/mol\n", this->energy_new);
+               printf("             CMAP E = %15.6f kcal/mol\n", this->energy_new * charmm_constants::KJ_TO_KCAL);
+          }
+
+          return this->energy_new * charmm_constants::KJ_TO_KCAL;
+     }
+
+
+     //! Accept move and backup energies
+     void accept() {
+
+          if (this->none_move == false) {
+               // If move is accepted, backup energies of all interactions that were recomputed
+               for (unsigned int k = 0; k < this->modified_interactions.size(); k++) {
+                    const unsigned int i = this->modified_interactions[k];
+                    this->interaction_energy_old[i] = this->interaction_energy_new[i];
+               }
+               this->energy_old = this->energy_new;
           }
+     }
 
-          return cmap_energy  * charmm_constants::KJ_TO_KCAL;
+
+     //! Reject move and roll-back energies
+     void reject() {
+
+          if (this->none_move == false) {
+               // If move is rejected, restore energies of all interactions that were recomputed
+               for (unsigned int k = 0; k < this->modified_interactions.size(); k++) {
+                    const unsigned int i = this->modified_interactions[k];
+                    this->interaction_energy_new[i] = this->interaction_energy_old[i];
+               }
+               this->energy_new = this->energy_old;
+          }
      }
 
 };
@@ -22,6 +22,11 @@
 #ifndef TERM_CHARMM_CMAP_TABLES_H
 #define TERM_CHARMM_CMAP_TABLES_H
 
+#include <vector>
+#include <algorithm>
+#include <boost/shared_ptr.hpp>
+#include <boost/noncopyable.hpp>
+
 namespace charmm_cmap {
 
 //! Matrix used in the CMAP interpolation
@@ -736,6 +741,257 @@ double cmap_energy(const double phi,
 }
 
 
+
+//! Number of grid points along each axis of a CMAP table
+const int CMAP_GRID_SPACING = 24;
+
+//! Number of bicubic coefficients in each CMAP grid cell
+const int CMAP_N_COEFFICIENTS = 16;
+
+//! Number of CMAP types
+const unsigned int N_CMAP_TYPES = 6;
+
+//! Energy grid of each CMAP type
+const double *const cmap_grids[N_CMAP_TYPES] = {grid0, grid1, grid2, grid3, grid4, grid5};
+
+//! Alignment of the coefficient table (bytes)
+const unsigned int CMAP_ALIGNMENT = 64;
+
+//! Bicubic CMAP interpolation with the coefficients of every grid cell
+//! precomputed. A lookup then only needs the cell index and a 4x4 Horner
+//! evaluation, instead of gathering the 16 grid values and multiplying
+//! them with cmap_coeff_matrix in every call.
+//! CMAP types with identical grids share one set of coefficients, and the
+//! 16 coefficients of a cell fill exactly two cache lines. The table is
+//! immutable and is shared by all terms and threads (see get_cmap_table()).
+class CmapTable: boost::noncopyable {
+
+     //! Number of distinct CMAP tables
+     unsigned int n_maps;
+
+     //! Distinct table used by each CMAP type
+     unsigned int map_index[N_CMAP_TYPES];
+
+     //! Storage for the coefficients, including padding for alignment
+     std::vector<double> storage;
+
+     //! Aligned coefficients, indexed by [(map*cells + cell)*16 + i*4 + j],
+     //! where i and j are the powers of the phi and psi cell coordinates
+     const double *coefficients;
+
+     //! Locate (phi,psi) on the grid
+     //! \param phi Phi angle
+     //! \param psi Psi angle
+     //! \param cell Output: grid cell index
+     //! \param tt Output: phi coordinate within the cell [0;1]
+     //! \param tu Output: psi coordinate within the cell [0;1]
+     static inline void locate(const double phi, const double psi,
+                               int &cell, double &tt, double &tu) {
+
+          const double dx = 2*M_PI / CMAP_GRID_SPACING;
+
+          double xphi1 = phi + M_PI;
+          double xphi2 = psi + M_PI;
+
+          // Range mangling
+          if (xphi1 < 0)
+               xphi1 += 2*M_PI;
+          else if (xphi1 >= 2*M_PI)
+               xphi1 -= 2*M_PI;
+
+          if (xphi2 < 0)
+               xphi2 += 2*M_PI;
+          else if (xphi2 >= 2*M_PI)
+               xphi2 -= 2*M_PI;
+
+          xphi1 /= dx;
+          xphi2 /= dx;
+
+          int iphi1 = (int)xphi1;
+          int iphi2 = (int)xphi2;
+
+          tt = xphi1 - iphi1;
+          tu = xphi2 - iphi2;
+
+          // Angles rounding up to exactly 2*pi belong to the last cell
+          if (iphi1 >= CMAP_GRID_SPACING) {
+               iphi1 = CMAP_GRID_SPACING - 1;
+               tt = 1.0;
+          }
+          if (iphi2 >= CMAP_GRID_SPACING) {
+               iphi2 = CMAP_GRID_SPACING - 1;
+               tu = 1.0;
+          }
+
+          cell = iphi1*CMAP_GRID_SPACING + iphi2;
+     }
+
+     //! Evaluate the bicubic polynomial of a cell by Horner's scheme
+     //! \param tc Coefficients of the cell
+     //! \param tt Phi coordinate within the cell
+     //! \param tu Psi coordinate within the cell
+     //! \return Interpolated energy
+     static inline double horner(const double *tc, const double tt, const double tu) {
+
+          double e = 0.0;
+          for (int i = 3; i >= 0; i--) {
+               e = tt*e + ((tc[i*4+3]*tu + tc[i*4+2])*tu + tc[i*4+1])*tu + tc[i*4];
+          }
+          return e;
+     }
+
+     //! Calculate the coefficients of all cells of one table
+     //! \param cmapdata Table in Gromacs' internal format (see setup_cmap_gromacs())
+     //! \param tc Output: coefficients of the table
+     static void calculate_coefficients(const std::vector<double> &cmapdata, double *tc) {
+
+          // Derivatives in the Gromacs tables are per degree
+          const double dx = 360.0 / CMAP_GRID_SPACING;
+
+          for (int iphi1 = 0; iphi1 < CMAP_GRID_SPACING; iphi1++) {
+               for (int iphi2 = 0; iphi2 < CMAP_GRID_SPACING; iphi2++) {
+
+                    int ip1m1, ip1p1, ip1p2;
+                    int ip2m1, ip2p1, ip2p2;
+                    cmap_setup_grid_index(iphi1, CMAP_GRID_SPACING, &ip1m1, &ip1p1, &ip1p2);
+                    cmap_setup_grid_index(iphi2, CMAP_GRID_SPACING, &ip2m1, &ip2p1, &ip2p2);
+
+                    const int pos[4] = {iphi1*CMAP_GRID_SPACING+iphi2,
+                                        ip1p1*CMAP_GRID_SPACING+iphi2,
+                                        ip1p1*CMAP_GRID_SPACING+ip2p1,
+                                        iphi1*CMAP_GRID_SPACING+ip2p1};
+
+                    double tx[16];
+                    for (int i = 0; i < 4; i++) {
+                         tx[i]    = cmapdata[pos[i]*4];
+                         tx[i+4]  = cmapdata[pos[i]*4+1]*dx;
+                         tx[i+8]  = cmapdata[pos[i]*4+2]*dx;
+                         tx[i+12] = cmapdata[pos[i]*4+3]*dx*dx;
+                    }
+
+                    double *cell_tc = &tc[pos[0]*CMAP_N_COEFFICIENTS];
+                    for (int idx = 0; idx < 16; idx++) {
+                         double xx = 0.0;
+                         for (int k = 0; k < 16; k++) {
+                              xx += cmap_coeff_matrix[k*16+idx]*tx[k];
+                         }
+                         cell_tc[idx] = xx;
+                    }
+               }
+          }
+     }
+
+public:
+
+     //! Constructor. Fits splines to the distinct CMAP grids and
+     //! precomputes their interpolation coefficients.
+     CmapTable()
+          : n_maps(0) {
+
+          const int n_grid_points = CMAP_GRID_SPACING*CMAP_GRID_SPACING;
+
+          // Find the distinct grids
+          std::vector<unsigned int> distinct_types;
+          for (unsigned int type = 0; type < N_CMAP_TYPES; type++) {
+
+               map_index[type] = n_maps;
+               for (unsigned int k = 0; k < distinct_types.size(); k++) {
+                    const double *grid = cmap_grids[distinct_types[k]];
+                    if (std::equal(grid, grid + n_grid_points, cmap_grids[type])) {
+                         map_index[type] = k;
+                         break;
+                    }
+               }
+               if (map_index[type] == n_maps) {
+                    distinct_types.push_back(type);
+                    n_maps++;
+               }
+          }
+
+          // Allocate aligned storage
+          const unsigned int map_size = n_grid_points*CMAP_N_COEFFICIENTS;
+          const unsigned int padding = CMAP_ALIGNMENT/sizeof(double);
+          storage.resize(n_maps*map_size + padding);
+
+          const size_t misalignment = reinterpret_cast<size_t>(&storage[0]) % CMAP_ALIGNMENT;
+          double *aligned = &storage[0];
+          if (misalignment != 0)
+               aligned += (CMAP_ALIGNMENT - misalignment)/sizeof(double);
+          coefficients = aligned;
+
+          for (unsigned int k = 0; k < n_maps; k++) {
+               calculate_coefficients(setup_cmap_gromacs(cmap_grids[distinct_types[k]]),
+                                      aligned + k*map_size);
+          }
+     }
+
+     //! Number of distinct CMAP tables
+     unsigned int size() const {
+          return n_maps;
+     }
+
+     //! Interpolated CMAP energy
+     //! \param phi Phi angle of the residue
+     //! \param psi Psi angle of the residue
+     //! \param cmap_type_index Index {0 ... 5} of the CMAP type.
+     //! \return CMAP energy (kJ/mol)
+     double energy(const double phi, const double psi,
+                   const unsigned int cmap_type_index) const {
+
+          int cell;
+          double tt, tu;
+          locate(phi, psi, cell, tt, tu);
+
+          const int n_cells = CMAP_GRID_SPACING*CMAP_GRID_SPACING;
+          return horner(&coefficients[(map_index[cmap_type_index]*n_cells + cell)*CMAP_N_COEFFICIENTS], tt, tu);
+     }
+
+     //! Interpolated CMAP energies for many residues at once.
+     //! The loop has no dependencies between residues and is vectorized
+     //! when compiled with OpenMP SIMD support.
+     //! \param n Number of residues
+     //! \param phi Phi angles
+     //! \param psi Psi angles
+     //! \param cmap_type_index Indices {0 ... 5} of the CMAP types
+     //! \param energies Output: CMAP energies (kJ/mol)
+     void energies(const unsigned int n,
+                   const double *phi, const double *psi,
+                   const unsigned int *cmap_type_index,
+                   double *energies) const {
+
+          const int n_cells = CMAP_GRID_SPACING*CMAP_GRID_SPACING;
+          const double *table = coefficients;
+          const unsigned int *maps = map_index;
+
+#pragma omp simd
+          for (unsigned int k = 0; k < n; k++) {
+
+               int cell;
+               double tt, tu;
+               locate(phi[k], psi[k], cell, tt, tu);
+
+               energies[k] = horner(&table[(maps[cmap_type_index[k]]*n_cells + cell)*CMAP_N_COEFFICIENTS], tt, tu);
+          }
+     }
+};
+
+
+//! Build the CMAP table
+//! \return Pointer to a new CMAP table
+inline boost::shared_ptr<const CmapTable> make_cmap_table() {
+     return boost::shared_ptr<const CmapTable>(new CmapTable());
+}
+
+//! The CMAP table shared by all terms and threads.
+//! It is built on first use, in the (thread-safe) initialization of a local static.
+//! \return Pointer to the immutable CMAP table
+boost::shared_ptr<const CmapTable> get_cmap_table() {
+
+     static const boost::shared_ptr<const CmapTable> table = make_cmap_table();
+
+     return table;
+}
+
 } // End namespace charmm_cmap
 
 #endif
@@ -24,7 +24,10 @@
 #include <boost/tokenizer.hpp>
 #include "energy/energy_term.h"
 #include "parsers/eef1_sb_parser.h"
+#include "parsers/topology_parser.h"
 #include "parameters/solvpar_17_inp.h"
+#include "spatial_ordering.h"
+#include "parallel_sum.h"
 
 namespace phaistos {
 
@@ -49,13 +52,41 @@ protected:
      std::vector<double> vdw_radii;
      //! Lookup tables containing parameters
      std::vector<double> lambda;
-     //! Lookup tables containing parameters
-     std::map<std::string, unsigned int> eef1_atom_type_index_map;
+     //! EEF1-SB parameter index of each atom type ID
+     std::vector<unsigned int> eef1_atom_type_indexes;
+
+     //! Atom type IDs of the atoms in the chain
+     eef1_sb_parser::ChainAtomTypes atom_types;
+
+     //! Pairs of heavy atoms at least three bonds apart, with EEF1-SB parameters
+     std::vector<topology::NonBondedInteraction> eef1_interactions;
+
+     //! Sum of reference solvation energies of all heavy atoms (kcal/mol)
+     double dGref_total;
+
+     //! Contiguous copy of the atom coordinates
+     charmm_spatial::CoordinateBuffer coordinate_buffer;
 
 public:
 
-     //! Use same settings as base class
-     typedef EnergyTerm<ChainFB>::SettingsClassicEnergy Settings;
+     //! Local settings class.
+     const class Settings: public EnergyTerm<ChainFB>::SettingsClassicEnergy {
+     public:
+
+          //! Number of threads used in evaluation (0: all available)
+          int threads;
+
+          //! Constructor
+          Settings(int threads=1)
+               : threads(threads) {}
+
+          //! Output operator
+          friend std::ostream &operator<<(std::ostream &o, const Settings &settings) {
+               o << "threads:" << settings.threads << "\n";
+               o << static_cast<const EnergyTerm<ChainFB>::Settings>(settings);
+               return o;
+          }
+     } settings;    //!< Local settings object
 
      //! Constructor
      //! \param chain Molecule chain
@@ -64,7 +95,8 @@ public:
      TermCharmmImplicitSolvent(ChainFB *chain,
               const Settings &settings=Settings(),
               RandomNumberEngine *random_number_engine = &random_global)
-          : EnergyTermCommon(chain, "charmm-implicit-solvent", settings, random_number_engine) {
+          : EnergyTermCommon(chain, "charmm-implicit-solvent", settings, random_number_engine),
+            settings(settings) {
 
           initialize();
 
@@ -80,7 +112,8 @@ public:
                      RandomNumberEngine *random_number_engine,
                      int thread_index, ChainFB *chain)
           : EnergyTermCommon(other, random_number_engine, thread_index, chain),
-            counter(other.counter){
+            counter(other.counter),
+            settings(other.settings) {
 
           initialize();
      }
@@ -103,6 +136,7 @@ public:
           std::vector<double> pp;
 
           unsigned int eef1_atom_type_index = 0;
+          eef1_atom_type_indexes.assign(charmm_parameters::N_ATOM_TYPES + 1, 0);
 
           while (getline(f_h,line)) {
 
@@ -120,7 +154,7 @@ public:
 
                          atoms.push_back((*beg).c_str());
 
-                         eef1_atom_type_index_map[(*beg).c_str()] = eef1_atom_type_index;
+                         eef1_atom_type_indexes[charmm_parameters::get_atom_type_id(*beg)] = eef1_atom_type_index;
                          eef1_atom_type_index++;
 
                     } else {
@@ -173,44 +207,91 @@ public:
                factors.push_back(factors_i);
           }
 
+          setup_interactions();
      }
 
-     //! Evaluate eef1 interaction between 2 atoms
-     //! \param atom1 First atom
-     //! \param atom2 Second atom
-     //! \param chg1 Eef1 of atom1
-     //! \param chg2 Eef1 of atom2
-     //! \return Implicit solvent energy for atom pair
-     double calculate_contribution(Atom *atom1, Atom *atom2, int index1, int index2) {
+     //! Build the list of heavy atom pairs. Atom types and bonds do not change,
+     //! so parameters are looked up and exclusions are tested only once.
+     void setup_interactions() {
+
+          this->coordinate_buffer = charmm_spatial::CoordinateBuffer(this->chain);
+          this->atom_types = eef1_sb_parser::ChainAtomTypes(this->chain);
+
+          const std::vector<Atom *> &atoms = this->coordinate_buffer.atoms;
+
+          std::vector<unsigned int> heavy_atoms;
+          std::vector<unsigned int> eef1_indexes;
+
+          this->dGref_total = 0.0;
+
+          for (unsigned int i = 0; i < atoms.size(); i++) {
+
+               if (atoms[i]->mass == definitions::atom_h_weight) continue;
+
+               heavy_atoms.push_back(i);
+               eef1_indexes.push_back(get_index(atoms[i]));
+
+               this->dGref_total += dGref[eef1_indexes.back()];
+          }
+
+          // Bond graph indexes of the heavy atoms
+          const topology::BondGraph bond_graph(this->chain);
+          std::vector<unsigned int> graph_indexes(heavy_atoms.size());
+          for (unsigned int i = 0; i < heavy_atoms.size(); i++) {
+               graph_indexes[i] = bond_graph.get_index(atoms[heavy_atoms[i]]);
+          }
+
+          this->eef1_interactions.clear();
+
+          for (unsigned int i = 0; i < heavy_atoms.size(); i++) {
+               for (unsigned int j = i + 1; j < heavy_atoms.size(); j++) {
 
-             return calc_implicit_solvent_energy(atom1,atom2,index1,index2);
+                    Atom *atom1 = atoms[heavy_atoms[i]];
+                    Atom *atom2 = atoms[heavy_atoms[j]];
+
+                    const unsigned int d = bond_graph.get_distance(graph_indexes[i], graph_indexes[j]);
+
+                    if (d < 3) continue;
+
+                    topology::NonBondedInteraction interaction;
+                    interaction.atom1 = atom1;
+                    interaction.atom2 = atom2;
+                    interaction.index1 = heavy_atoms[i];
+                    interaction.index2 = heavy_atoms[j];
+                    interaction.qq = 0.0;
+                    interaction.c6 = 0.0;
+                    interaction.c12 = 0.0;
+                    interaction.is_14_interaction = (d == 3);
+
+                    topology::set_eef1_parameters(interaction, eef1_indexes[i], eef1_indexes[j],
+                                                  this->factors, this->vdw_radii, this->lambda);
+
+                    this->eef1_interactions.push_back(interaction);
+               }
+          }
      }
 
      //! Evaluate a eef1 interaction between two atoms
-     //! \param atom1 First atom
-     //! \param atom2 Second atom
-     //! \param chg1 Eef1 of atom1
-     //! \param chg2 Eef1 of atom2
-     //! \return Eef1 energy for atom pair
-     double calc_implicit_solvent_energy(Atom *atom1, Atom *atom2, int index1, int index2) {
+     //! \param interaction Atom pair
+     //! \param r2 Squared distance between the atoms (output)
+     //! \return Eef1 energy for atom pair in kcal/mol (zero beyond 9 Angstrom)
+     double calculate_interaction_energy(const topology::NonBondedInteraction &interaction, double &r2) const {
 
-          counter++;
+          r2 = (this->coordinate_buffer.positions[interaction.index1]
+              - this->coordinate_buffer.positions[interaction.index2]).norm_squared();
 
-          double r_ij = (atom1->position - atom2->position).norm();
-          double r_ij_sq = r_ij*r_ij;
-          double R_min_i = vdw_radii[index1];
-          double R_min_j = vdw_radii[index2];
+          if (r2 > 81.0)
+               return 0.0;
 
-          double lambda_i = lambda[index1];
-          double lambda_j = lambda[index2];
+          const double r_ij = std::sqrt(r2);
 
-          double arg_ij = std::fabs((r_ij - R_min_i)/lambda_i);
-          double arg_ji = std::fabs((r_ij - R_min_j)/lambda_j);
+          const double arg_ij = std::fabs((r_ij - interaction.R_vdw_1)/interaction.lambda1);
+          const double arg_ji = std::fabs((r_ij - interaction.R_vdw_2)/interaction.lambda2);
 
           // In CHARMM the exponential is not calculated explicitly
           // A lookup table is used instead
-          int bin_ij = int(arg_ij*100);
-          int bin_ji = int(arg_ji*100);
+          const int bin_ij = int(arg_ij*100);
+          const int bin_ji = int(arg_ji*100);
 
           double exp_ij = 0.0;
           double exp_ji = 0.0;
@@ -218,12 +299,12 @@ public:
           if (bin_ij < 350) exp_ij = charmm_constants::EXP_EEF1[bin_ij];
           if (bin_ji < 350) exp_ji = charmm_constants::EXP_EEF1[bin_ji];
 
-          double cont_ij = -factors[index1][index2]*exp_ij/r_ij_sq;
-          double cont_ji = -factors[index2][index1]*exp_ji/r_ij_sq;
+          const double cont_ij = -interaction.fac_12*exp_ij/r2;
+          const double cont_ji = -interaction.fac_21*exp_ji/r2;
 
           // The code below is using the full std::exp function rather than lookup-table
-          // double cont_ij = -factors[index1][index2]*std::exp(-(arg_ij*arg_ij))/r_ij_sq;
-          // double cont_ji = -factors[index2][index1]*std::exp(-(arg_ji*arg_ji))/r_ij_sq;
+          // double cont_ij = -interaction.fac_12*std::exp(-(arg_ij*arg_ij))/r2;
+          // double cont_ji = -interaction.fac_21*std::exp(-(arg_ji*arg_ji))/r2;
 
           return (cont_ij+cont_ji);
      }
@@ -231,65 +312,66 @@ public:
      //! Return index in parameter table corresponding to the atomtype
      int get_index(Atom *atom){
 
-          std::string atom_type = eef1_sb_parser::get_atom_type(atom);
-          unsigned int eef1_atom_type_index = eef1_atom_type_index_map[atom_type];
+          unsigned int eef1_atom_type_index = this->eef1_atom_type_indexes[this->atom_types.get_atom_type_id(atom)];
 
           return (int)eef1_atom_type_index;
      }
 
-     //! Evaluate chain energy
-     //! \param move_info object containing information about last move
-     //! \return vdw potential energy of the chain in the object
-     double evaluate(MoveInfo *move_info=NULL) {
+     //! Sum the energies of a range of atom pairs
+     //! \param begin Index of first atom pair
+     //! \param end Index after last atom pair
+     //! \param energies Sum of energies (index 0) in kcal/mol and number of pairs within 9 Angstrom (index 1)
+     void calculate_energy_range(const unsigned int begin, const unsigned int end, double *energies) const {
 
-          double energy_sum=0.0;
-          counter=0;
+          for (unsigned int i = begin; i < end; i++) {
 
-          unsigned int i_atom = 0;
+               double r2;
+               energies[0] += calculate_interaction_energy(this->eef1_interactions[i], r2);
 
-          double dGref_total = 0.0;
+               if (r2 <= 81.0)
+                    energies[1] += 1.0;
+          }
+     }
 
-          // Iterate all the atom pairs on the chain
-          for (AtomIterator<ChainFB, definitions::ALL> it1(*this->chain); !it1.end(); ++it1) {
-               i_atom++;
-               Atom *atom1 = &*it1;
-               int index1 = get_index(atom1);
+     //! Print the energy of each atom pair within 9 Angstrom
+     void print_interactions() const {
 
-               if (atom1->mass == definitions::atom_h_weight) continue;
+          for (unsigned int i = 0; i < this->eef1_interactions.size(); i++) {
 
-               energy_sum += dGref[index1];
-               dGref_total += dGref[index1];
+               const topology::NonBondedInteraction &interaction = this->eef1_interactions[i];
 
-               unsigned int j_atom = 0;
+               double r2;
+               const double energy_temp = calculate_interaction_energy(interaction, r2);
 
-               for (AtomIterator<ChainFB, definitions::ALL> it2(*this->chain); !it2.end(); ++it2) {
-                    j_atom++;
+               if (r2 > 81.0) continue;
 
-                    Atom *atom2 = &*it2;
-                    int index2 = get_index(atom2);
+               std::cout << "# CHARMM implicit-solvent:"
 
-                    if (j_atom <= i_atom) continue;
-                    if (chain_distance<ChainFB>(atom1,atom2) < 3) continue;
-                    if (atom2->mass == definitions::atom_h_weight) continue;
-                    if ((atom1->position - atom2->position).norm() > 9) continue;
+                         << " a1: " << interaction.atom1
+                         << " a2: " << interaction.atom2
 
-                    const double energy_sum_temp = calculate_contribution(atom1, atom2,index1,index2);
-                    energy_sum += energy_sum_temp;
+                         << " e_solv : " << energy_temp
 
-                    if (this->settings.debug > 1) {
+                         << std::endl;
+          }
+     }
 
-                        std::cout << "# CHARMM implicit-solvent:" 
+     //! Evaluate chain energy
+     //! \param move_info object containing information about last move
+     //! \return vdw potential energy of the chain in the object
+     double evaluate(MoveInfo *move_info=NULL) {
 
-                                  << " a1: " << atom1
-                                  << " a2: " << atom2
+          this->coordinate_buffer.update();
 
-                                  << " e_solv : " << energy_sum_temp
+          double energies[2];
+          charmm_parallel::chunked_sum(*this, &TermCharmmImplicitSolvent::calculate_energy_range,
+                                       this->eef1_interactions.size(), 2, this->settings.threads, energies);
 
-                                  << std::endl;
-              
-                    }
-               }
+          const double energy_sum = this->dGref_total + energies[0];
+          counter = (int)energies[1];
 
+          if (this->settings.debug > 1) {
+               print_interactions();
           }
 
           if (this->settings.debug > 0) {
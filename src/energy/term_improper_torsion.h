@@ -22,7 +22,8 @@
 
 #include "energy/energy_term.h"
 #include "parsers/topology_parser.h"
-#include "parameters/imptor_itp.h"
+#include "parameters/imptor_parameters.h"
+#include "bonded_kernels.h"
 
 namespace phaistos {
 
@@ -40,7 +41,7 @@ public:
      typedef EnergyTerm<ChainFB>::SettingsClassicEnergy Settings;
 
      //! List of interactions that need to be computed
-     std::vector<topology::ImproperTorsionInteraction> improper_torsion_interactions;
+     charmm_bonded::ImproperList improper_torsion_interactions;
 
      //! Constructor.
      //! \param chain Molecule chain
@@ -52,10 +53,10 @@ public:
           : EnergyTermCommon(chain, "charmm-improper-torsion", settings, random_number_engine) {
 
           std::vector<topology::ImproperTorsionParameter> improper_torsion_parameters 
-                    = topology::read_improper_torsion_parameters(charmm_constants::imptor_itp);
+                    = topology::get_improper_torsion_parameters();
 
-          this->improper_torsion_interactions 
-                    = topology::generate_improper_torsion_interactions(this->chain, improper_torsion_parameters);
+          charmm_bonded::fill(topology::generate_improper_torsion_interactions(this->chain, improper_torsion_parameters),
+                              this->improper_torsion_interactions);
 
      }
 
@@ -70,48 +71,55 @@ public:
           : EnergyTermCommon(other, random_number_engine, thread_index, chain) {
 
           std::vector<topology::ImproperTorsionParameter> improper_torsion_parameters 
-                    = topology::read_improper_torsion_parameters(charmm_constants::imptor_itp);
+                    = topology::get_improper_torsion_parameters();
 
-          this->improper_torsion_interactions 
-                    = topology::generate_improper_torsion_interactions(this->chain, improper_torsion_parameters);
+          charmm_bonded::fill(topology::generate_improper_torsion_interactions(this->chain, improper_torsion_parameters),
+                              this->improper_torsion_interactions);
 
      }
 
-     //! Evaluate
-     //! \param move_info object containing information about last move
-     //! \return improper torsional potential energy of the chain in the object
-     double evaluate(MoveInfo *move_info=NULL) {
+     //! Print the energy of each improper torsion
+     void print_interactions() const {
 
-          double energy_improper_torsion = 0.0;
+          const charmm_bonded::ImproperList &impropers = this->improper_torsion_interactions;
 
-          for (unsigned int i = 0; i < this->improper_torsion_interactions.size(); i++) {
+          double phi[charmm_bonded::BLOCK_SIZE];
+          double energy_improper_torsion_temp[charmm_bonded::BLOCK_SIZE];
 
-               topology::ImproperTorsionInteraction interaction = this->improper_torsion_interactions[i];
+          for (unsigned int block = 0; block < impropers.size(); block += charmm_bonded::BLOCK_SIZE) {
 
-               const double phi = calc_dihedral((interaction.atom1)->position,
-                                                (interaction.atom2)->position,
-                                                (interaction.atom3)->position,
-                                                (interaction.atom4)->position);
+               const unsigned int n = std::min(charmm_bonded::BLOCK_SIZE, impropers.size() - block);
+               impropers.evaluate_block(block, n, phi, energy_improper_torsion_temp);
 
-               const double dphi = phi - interaction.phi0 * charmm_constants::DEG_TO_RAD;
-               const double energy_improper_torsion_temp = 0.5 * interaction.cp * dphi * dphi;
-
-               energy_improper_torsion += energy_improper_torsion_temp;
-
-               if (this->settings.debug > 1) {
+               for (unsigned int i = 0; i < n; i++) {
 
                    std::cout << "# CHARMM improper-torsion:" 
 
-                             << " a1: " << interaction.atom1
-                             << " a2: " << interaction.atom2
-                             << " a3: " << interaction.atom3
-                             << " a4: " << interaction.atom4
+                             << " a1: " << impropers.atom1[block + i]
+                             << " a2: " << impropers.atom2[block + i]
+                             << " a3: " << impropers.atom3[block + i]
+                             << " a4: " << impropers.atom4[block + i]
 
-                             << " angle: " << phi * charmm_constants::RAD_TO_DEG
-                             << " e_improper_torsion: " <<  energy_improper_torsion_temp
+                             << " angle: " << phi[i] * charmm_constants::RAD_TO_DEG
+                             << " e_improper_torsion: " <<  energy_improper_torsion_temp[i]
 
                              << std::endl;
-                }
+               }
+          }
+     }
+
+     //! Evaluate
+     //! \param move_info object containing information about last move
+     //! \return improper torsional potential energy of the chain in the object
+     double evaluate(MoveInfo *move_info=NULL) {
+
+          double energies[1] = {0.0};
+          this->improper_torsion_interactions.add_energies(0, this->improper_torsion_interactions.size(), energies);
+
+          const double energy_improper_torsion = energies[0];
+
+          if (this->settings.debug > 1) {
+               print_interactions();
           }
 
           if (this->settings.debug > 0) {
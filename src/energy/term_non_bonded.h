@@ -21,6 +21,7 @@
 #define TERM_CHARMM_NON_BONDED_H
 
 #include <string>
+#include <algorithm>
 
 #include <boost/tokenizer.hpp>
 #include <boost/type_traits/is_base_of.hpp>
@@ -30,8 +31,13 @@
 #include "parsers/topology_parser.h"
 #include "parsers/eef1_sb_parser.h"
 #include "constants.h"
-#include "parameters/vdw14_itp.h"
-#include "parameters/vdw_itp.h"
+#include "far_field.h"
+#include "spatial_ordering.h"
+#include "switching.h"
+#include "neighbour_list.h"
+#include "parallel_sum.h"
+#include "parameters/vdw14_parameters.h"
+#include "parameters/vdw_parameters.h"
 #include "parameters/solvpar_17_inp.h"
 
 namespace phaistos {
@@ -46,51 +52,380 @@ protected:
      std::vector<topology::NonBondedInteraction> non_bonded_interactions;
      double dGref_total;
 
+     //! Range of interactions between two residues in non_bonded_interactions
+     struct ResiduePairInteractions {
+
+          //! Index of first residue
+          unsigned int residue1_index;
+
+          //! Index of second residue
+          unsigned int residue2_index;
+
+          //! Index of first interaction in the pair
+          unsigned int begin;
+
+          //! Index after last interaction in the pair
+          unsigned int end;
+
+          //! Summary used in the far-field approximation
+          charmm_far_field::ResiduePairSummary summary;
+     };
+
+     //! Ordering of interactions by residue pair
+     struct ResiduePairCompare {
+
+          //! Number of residues in the chain
+          unsigned int n_residues;
+
+          //! Constructor
+          ResiduePairCompare(unsigned int n_residues)
+               : n_residues(n_residues) {}
+
+          //! Key of the residue pair of an interaction (lower triangle)
+          unsigned int key(const topology::NonBondedInteraction &interaction) const {
+               const unsigned int residue1_index = (interaction.atom1)->residue->index;
+               const unsigned int residue2_index = (interaction.atom2)->residue->index;
+               return std::max(residue1_index, residue2_index) * this->n_residues
+                    + std::min(residue1_index, residue2_index);
+          }
+
+          //! Comparison operator
+          bool operator()(const topology::NonBondedInteraction &interaction1,
+                          const topology::NonBondedInteraction &interaction2) const {
+               return key(interaction1) < key(interaction2);
+          }
+     };
+
+     //! Interactions grouped by residue pairs (only used in far-field mode)
+     std::vector<ResiduePairInteractions> residue_pairs;
+
+     //! Atoms and charges in each residue (only used in far-field mode)
+     std::vector<std::vector<charmm_far_field::ChargedAtom> > residue_atoms;
+
+     //! Multipole summary of each residue (only used in far-field mode)
+     std::vector<charmm_far_field::ResidueSummary> residue_summaries;
+
+     //! Contiguous copy of atom coordinates used in the pair loop
+     charmm_spatial::CoordinateBuffer coordinate_buffer;
+
+     //! Number of evaluations since the coordinate buffer was last reordered
+     int evaluations_since_reorder;
+
+     //! Switching function used with a non-bonded cutoff
+     charmm_switching::SwitchingFunction switching_function;
+
+     //! Van der Waals parameters (kept for rebuilding the pair list)
+     std::vector<topology::NonBondedParameter> non_bonded_parameters;
+
+     //! Van der Waals 1-4 parameters (kept for rebuilding the pair list)
+     std::vector<topology::NonBonded14Parameter> non_bonded_14_parameters;
+
+     //! Bond graph and atom types of the chain (kept for rebuilding the pair list)
+     topology::ChainTopology chain_topology;
+
+     //! Topology images of the interaction lists (keeps the images that were read mapped)
+     topology::TopologyImageDirectory topology_images;
+
+     //! EEF1-SB reference solvation free energies
+     std::vector<double> dGref;
+
+     //! Pairwise EEF1-SB prefactors
+     std::vector< std::vector<double> > factors;
+
+     //! EEF1-SB van der Waals radii
+     std::vector<double> vdw_radii;
+
+     //! EEF1-SB correlation lengths
+     std::vector<double> lambda;
+
+     //! EEF1-SB parameter index of each atom type ID
+     std::vector<unsigned int> eef1_atom_type_indexes;
+
+     //! Atom type IDs and charges of the atoms in the chain
+     eef1_sb_parser::ChainAtomTypes atom_types;
+
+     //! Distance within which atom pairs are kept in the pair list (0: all pairs)
+     double pair_list_cutoff;
+
+     //! Atom displacements since the pair list was built
+     charmm_neighbour_list::DisplacementTracker displacement_tracker;
+
+     //! Pair list built for the positions of the latest evaluation, if the current list
+     //! was not valid for them. It replaces the current list if the move is accepted.
+     std::vector<topology::NonBondedInteraction> pending_interactions;
+
+     //! Whether pending_interactions was used in the latest evaluation
+     bool has_pending_pair_list;
+
 public:
 
-     //! Use same settings as base class
-     typedef EnergyTerm<ChainFB>::SettingsClassicEnergy Settings;
+     //! Number of residue pairs summed in one chunk in multithreaded far-field evaluation
+     static const unsigned int FAR_FIELD_CHUNK_SIZE = 64;
+
+     //! Index of 1-4 van der Waals energy in energy component arrays
+     static const unsigned int VDW_14 = 0;
+     //! Index of van der Waals energy of other pairs in energy component arrays
+     static const unsigned int VDW_SR = 1;
+     //! Index of 1-4 Coulomb energy in energy component arrays
+     static const unsigned int COUL_14 = 2;
+     //! Index of Coulomb energy of other pairs in energy component arrays
+     static const unsigned int COUL_SR = 3;
+     //! Index of EEF1-SB pair energy in energy component arrays
+     static const unsigned int EEF1 = 4;
+     //! Number of energy components
+     static const unsigned int N_COMPONENTS = 5;
+
+     //! Energy components of the last evaluation in kJ/mol (VDW_14, VDW_SR, COUL_14, COUL_SR and EEF1,
+     //! where EEF1 includes the reference solvation energy). Far-field approximated pairs are not included.
+     double energy_components[N_COMPONENTS];
+
+     //! Energy of far-field approximated residue pairs in the last evaluation (kJ/mol)
+     double far_field_energy;
+
+     //! Number of residue pairs approximated in the last evaluation
+     unsigned int far_field_pairs;
+
+     //! Bound on the error of the far-field approximation in the last evaluation (kcal/mol)
+     double far_field_error_bound;
+
+     //! Local settings class
+     const class Settings: public EnergyTerm<ChainFB>::SettingsClassicEnergy {
+     public:
+
+          //! Centroid distance beyond which residue pairs are approximated (0: disabled)
+          double far_field_cutoff;
+
+          //! Largest error bound allowed for an approximated residue pair (kcal/mol)
+          double far_field_tolerance;
+
+          //! Number of evaluations between reorderings of the coordinate buffer along a Morton curve (0: never)
+          int spatial_reorder_interval;
+
+          //! Distance where switching of van der Waals and Coulomb energies starts (Angstrom)
+          double ctonnb;
+
+          //! Distance beyond which atom pairs do not contribute (Angstrom, 0: no cutoff)
+          double ctofnb;
+
+          //! Distance within which atom pairs are kept in the pair list (Angstrom, 0: ctofnb + 2)
+          double cutnb;
+
+          //! Number of threads used in evaluation (0: all available)
+          int threads;
+
+          //! Directory of topology images, used if there is no cutoff ("": interactions are always generated)
+          std::string topology_image_dir;
+
+          //! Constructor
+          Settings(double far_field_cutoff=0.0,
+                   double far_field_tolerance=0.01,
+                   int spatial_reorder_interval=1000,
+                   double ctonnb=0.0,
+                   double ctofnb=0.0,
+                   double cutnb=0.0,
+                   int threads=1,
+                   std::string topology_image_dir="")
+               : far_field_cutoff(far_field_cutoff),
+                 far_field_tolerance(far_field_tolerance),
+                 spatial_reorder_interval(spatial_reorder_interval),
+                 ctonnb(ctonnb),
+                 ctofnb(ctofnb),
+                 cutnb(cutnb),
+                 threads(threads),
+                 topology_image_dir(topology_image_dir) {}
+
+          //! Output operator
+          friend std::ostream &operator<<(std::ostream &o, const Settings &settings) {
+               o << "far-field-cutoff:" << settings.far_field_cutoff << "\n";
+               o << "far-field-tolerance:" << settings.far_field_tolerance << "\n";
+               o << "spatial-reorder-interval:" << settings.spatial_reorder_interval << "\n";
+               o << "ctonnb:" << settings.ctonnb << "\n";
+               o << "ctofnb:" << settings.ctofnb << "\n";
+               o << "cutnb:" << settings.cutnb << "\n";
+               o << "threads:" << settings.threads << "\n";
+               o << "topology-image-dir:" << settings.topology_image_dir << "\n";
+               o << static_cast<const EnergyTerm<ChainFB>::Settings>(settings);
+               return o;
+          }
+     } settings;    //!< Local settings object
 
 
+     //! Read parameters and generate the interactions
      void setup_interactions() {
 
+          initialize(this->dGref, this->factors, this->vdw_radii, this->lambda, this->eef1_atom_type_indexes);
 
-          std::vector<double> dGref;
-          std::vector< std::vector<double> > factors;
-          std::vector<double> vdw_radii;
-          std::vector<double> lambda;
-          std::map<std::string, unsigned int> eef1_atom_type_index_map;
+          this->non_bonded_parameters = topology::get_nonbonded_parameters();
+          this->non_bonded_14_parameters = topology::get_nonbonded_14_parameters();
 
-          initialize(dGref, factors, vdw_radii, lambda, eef1_atom_type_index_map);
+          this->chain_topology = topology::ChainTopology(this->chain);
+          this->atom_types = this->chain_topology.get_atom_types();
 
+          this->dGref_total = 0.0;
 
-          std::vector<topology::NonBondedParameter> non_bonded_parameters
-              = topology::read_nonbonded_parameters(charmm_constants::vdw_itp);
+          for (AtomIterator<ChainFB, definitions::ALL> it(*this->chain); !it.end(); ++it) {
 
-          std::vector<topology::NonBonded14Parameter> non_bonded_14_parameters
-              = topology::read_nonbonded_14_parameters(charmm_constants::vdw14_itp);
+              Atom *atom = &*it;
 
-          this->non_bonded_interactions = topology::generate_non_bonded_interactions_cached(this->chain,
-                                                                  non_bonded_parameters,
-                                                                  non_bonded_14_parameters,
-                                                                  dGref,
-                                                                  factors,
-                                                                  vdw_radii,
-                                                                  lambda,
-                                                                  eef1_atom_type_index_map);
+              unsigned int index = this->eef1_atom_type_indexes[this->atom_types.get_atom_type_id(atom)];
 
-            std::cout << this->non_bonded_interactions.size() << std::endl;
-            this->dGref_total = 0.0;
+              this->dGref_total += this->dGref[index];
+          }
 
-            for (AtomIterator<ChainFB, definitions::ALL> it(*this->chain); !it.end(); ++it) {
+          this->far_field_pairs = 0;
+          this->far_field_error_bound = 0.0;
+          this->far_field_energy = 0.0;
+          std::fill(this->energy_components, this->energy_components + N_COMPONENTS, 0.0);
 
-                Atom *atom = &*it;
-                std::string atom_type = eef1_sb_parser::get_atom_type(atom);
+          this->switching_function = charmm_switching::SwitchingFunction(this->settings.ctonnb, this->settings.ctofnb);
+          this->pair_list_cutoff = charmm_neighbour_list::pair_list_cutoff(this->settings.ctofnb, this->settings.cutnb);
+          this->has_pending_pair_list = false;
 
-                unsigned int index = eef1_atom_type_index_map[atom_type];
+          this->non_bonded_interactions = generate_interactions();
+          setup_pair_list();
 
-                this->dGref_total += dGref[index];
-            }
+          std::cout << this->non_bonded_interactions.size() << std::endl;
+     }
+
+     //! Generate the interactions (within the pair list cutoff, if any). Without a
+     //! cutoff, they are read from their topology image if there is one.
+     //! \return A vector of non-bonded interactions
+     std::vector<topology::NonBondedInteraction> generate_interactions() {
+
+          std::vector<topology::NonBondedInteraction> non_bonded_interactions;
+
+          // A list within a cutoff depends on the atom positions, so only the list of all pairs has an image
+          this->topology_images = topology::TopologyImageDirectory(this->chain,
+                                                                   (this->pair_list_cutoff > 0.0) ? std::string()
+                                                                                                  : this->settings.topology_image_dir);
+          if (!this->topology_images.read("non-bonded-eef1", non_bonded_interactions)) {
+
+               non_bonded_interactions = topology::generate_non_bonded_interactions_cached(this->chain_topology,
+                                                                                           this->non_bonded_parameters,
+                                                                                           this->non_bonded_14_parameters,
+                                                                                           this->dGref,
+                                                                                           this->factors,
+                                                                                           this->vdw_radii,
+                                                                                           this->lambda,
+                                                                                           this->eef1_atom_type_indexes,
+                                                                                           this->pair_list_cutoff,
+                                                                                           this->settings.threads);
+               this->topology_images.write("non-bonded-eef1", non_bonded_interactions);
+          }
+
+          return non_bonded_interactions;
+     }
+
+     //! Set up far-field grouping, the coordinate buffer and displacement tracking for the current interactions
+     void setup_pair_list() {
+
+          if (this->settings.far_field_cutoff > 0.0) {
+              setup_far_field();
+          }
+
+          setup_coordinate_buffer();
+
+          if (this->pair_list_cutoff > 0.0) {
+              this->displacement_tracker = charmm_neighbour_list::DisplacementTracker(this->chain,
+                                                                                      this->pair_list_cutoff - this->settings.ctofnb);
+          }
+     }
+
+     //! Set up the coordinate buffer and the buffer indexes of all interactions
+     void setup_coordinate_buffer() {
+
+          this->coordinate_buffer = charmm_spatial::CoordinateBuffer(this->chain);
+          this->coordinate_buffer.assign_indexes(this->non_bonded_interactions);
+          this->evaluations_since_reorder = 0;
+
+          if (this->settings.spatial_reorder_interval > 0) {
+               reorder_coordinate_buffer();
+          }
+     }
+
+     //! Reorder the coordinate buffer along a Morton curve and sort the interactions
+     //! to match. In far-field mode, interactions are only sorted within each residue pair.
+     void reorder_coordinate_buffer() {
+
+          std::vector<unsigned int> range_begins(1, 0);
+
+          if (!this->residue_pairs.empty()) {
+               range_begins.clear();
+               for (unsigned int k = 0; k < this->residue_pairs.size(); k++) {
+                    range_begins.push_back(this->residue_pairs[k].begin);
+               }
+          }
+
+          charmm_spatial::reorder_interactions(this->coordinate_buffer, this->non_bonded_interactions, range_begins);
+     }
+
+     //! Refresh the coordinate buffer, and periodically reorder it and the interactions
+     void update_coordinate_buffer() {
+
+          if ((this->settings.spatial_reorder_interval > 0) &&
+              (this->evaluations_since_reorder >= this->settings.spatial_reorder_interval)) {
+
+               reorder_coordinate_buffer();
+               this->evaluations_since_reorder = 0;
+
+          } else {
+               this->coordinate_buffer.update();
+          }
+
+          this->evaluations_since_reorder++;
+     }
+
+     //! Group interactions by residue pairs and summarize each pair for the far-field approximation
+     void setup_far_field() {
+
+          const unsigned int n_residues = this->chain->size();
+
+          // Store atoms and charges in each residue
+          this->residue_atoms.assign(n_residues, std::vector<charmm_far_field::ChargedAtom>());
+          for (AtomIterator<ChainFB, definitions::ALL> it(*this->chain); !it.end(); ++it) {
+
+               charmm_far_field::ChargedAtom charged_atom;
+               charged_atom.atom = &*it;
+               charged_atom.charge = this->atom_types.get_atom_charge(charged_atom.atom);
+
+               this->residue_atoms[charged_atom.atom->residue->index].push_back(charged_atom);
+          }
+          this->residue_summaries.resize(n_residues);
+
+          // Make interactions between each pair of residues contiguous
+          ResiduePairCompare compare(n_residues);
+          std::stable_sort(this->non_bonded_interactions.begin(), this->non_bonded_interactions.end(), compare);
+
+          this->residue_pairs.clear();
+          unsigned int begin = 0;
+          while (begin < this->non_bonded_interactions.size()) {
+
+               const unsigned int key = compare.key(this->non_bonded_interactions[begin]);
+
+               unsigned int end = begin + 1;
+               while (end < this->non_bonded_interactions.size() &&
+                      compare.key(this->non_bonded_interactions[end]) == key) {
+                    end++;
+               }
+
+               ResiduePairInteractions residue_pair;
+               residue_pair.residue1_index = key / n_residues;
+               residue_pair.residue2_index = key % n_residues;
+               residue_pair.begin = begin;
+               residue_pair.end = end;
+               residue_pair.summary = charmm_far_field::calculate_residue_pair_summary(
+                                             this->non_bonded_interactions, begin, end,
+                                             this->residue_atoms[residue_pair.residue1_index].size(),
+                                             this->residue_atoms[residue_pair.residue2_index].size());
+
+               // A residue never interacts with itself in the far field
+               if (residue_pair.residue1_index == residue_pair.residue2_index)
+                    residue_pair.summary.eligible = false;
+
+               this->residue_pairs.push_back(residue_pair);
+
+               begin = end;
+          }
      }
 
      // Big long initialize code from Wouter/Sandro
@@ -98,7 +433,7 @@ public:
                      std::vector< std::vector<double> > &factors,
                      std::vector<double> &vdw_radii,
                      std::vector<double> &lambda,
-                     std::map<std::string, unsigned int> &eef1_atom_type_index_map) {
+                     std::vector<unsigned int> &eef1_atom_type_indexes) {
 
           // Read parameter file
           std::vector<std::string> atoms;
@@ -115,6 +450,7 @@ public:
           std::vector<double> pp;
 
           unsigned int eef1_atom_type_index = 0;
+          eef1_atom_type_indexes.assign(charmm_parameters::N_ATOM_TYPES + 1, 0);
 
           while (getline(f_h,line)) {
 
@@ -132,7 +468,7 @@ public:
 
                          atoms.push_back((*beg).c_str());
 
-                         eef1_atom_type_index_map[(*beg).c_str()] = eef1_atom_type_index;
+                         eef1_atom_type_indexes[charmm_parameters::get_atom_type_id(*beg)] = eef1_atom_type_index;
                          eef1_atom_type_index++;
 
                     } else {
@@ -195,7 +531,8 @@ public:
      TermCharmmNonBonded(ChainFB *chain,
                     const Settings &settings = Settings(),
                     RandomNumberEngine *random_number_engine = &random_global)
-          : EnergyTermCommon(chain, "charmm-non-bonded", settings, random_number_engine) {
+          : EnergyTermCommon(chain, "charmm-non-bonded", settings, random_number_engine),
+            settings(settings) {
 
         setup_interactions();
      }
@@ -208,65 +545,374 @@ public:
      TermCharmmNonBonded(const TermCharmmNonBonded &other,
                  RandomNumberEngine *random_number_engine,
                  int thread_index, ChainFB *chain)
-          : EnergyTermCommon(other, random_number_engine, thread_index, chain) {
+          : EnergyTermCommon(other, random_number_engine, thread_index, chain),
+            settings(other.settings) {
 
         setup_interactions();
 
         }
 
 
+     //! Calculate the energy components of a single atom pair. The squared distance is calculated once
+     //! and shared by the van der Waals, Coulomb and EEF1-SB parts.
+     //! \param interaction Atom pair
+     //! \param r2 Squared distance between the atoms (output)
+     //! \param vdw_energy van der Waals energy in kJ/mol (output)
+     //! \param coul_energy Coulomb energy in kJ/mol (output)
+     //! \param eef1_energy EEF1-SB solvation energy in kJ/mol (output)
+     void calculate_interaction_energies(const topology::NonBondedInteraction &interaction,
+                                         double &r2, double &vdw_energy, double &coul_energy, double &eef1_energy) const {
+
+          r2 = (this->coordinate_buffer.positions[interaction.index1]
+              - this->coordinate_buffer.positions[interaction.index2]).norm_squared();
+
+          vdw_energy = 0.0;
+          coul_energy = 0.0;
+          eef1_energy = 0.0;
+
+          // Pairs beyond the cutoff do not contribute
+          if (this->switching_function.enabled && this->switching_function.is_cut(r2))
+              return;
+
+          const double inv_r2 = 1.0 / r2; // convert to nanometers
+          const double inv_r6 = inv_r2 * inv_r2 * inv_r2 * charmm_constants::NM6_TO_ANGS6;
+
+          // Vdw and coulomb energy (using nm and kJ).
+          vdw_energy = (interaction.c12 * inv_r6 - interaction.c6) * inv_r6;
+          coul_energy = interaction.qq * inv_r2 * charmm_constants::TEN_OVER_ONE_POINT_FIVE;
+
+          // Switch vdw and coulomb energy to zero between ctonnb and ctofnb
+          if (this->switching_function.enabled) {
+              const double switching_value = this->switching_function.value(r2);
+              vdw_energy *= switching_value;
+              coul_energy *= switching_value;
+          }
+
+          // If the pair has a contribution to EEF1-SB solvation term
+          if ((interaction.do_eef1) && (r2 < 81.0)) {
+
+              // From Sandro's code -- this bit is in angstrom and kcal.
+              const double r_ij = std::sqrt(r2);
+
+              const double arg_ij = std::fabs((r_ij - interaction.R_vdw_1)/interaction.lambda1);
+              const double arg_ji = std::fabs((r_ij - interaction.R_vdw_2)/interaction.lambda2);
+
+              const int bin_ij = int(arg_ij*100);
+              const int bin_ji = int(arg_ji*100);
+
+              double exp_ij = 0.0;
+              double exp_ji = 0.0;
+
+              if (bin_ij < 350) exp_ij = charmm_constants::EXP_EEF1[bin_ij];
+              if (bin_ji < 350) exp_ji = charmm_constants::EXP_EEF1[bin_ji];
+
+              // Solvation energy (in kcal, so convert to kJ)
+              eef1_energy = -(interaction.fac_12*exp_ij + interaction.fac_21*exp_ji) * inv_r2 * charmm_constants::KCAL_TO_KJ;
+          }
+     }
+
+     //! Add the energy components of a single atom pair to an array of components
+     //! \param interaction Atom pair
+     //! \param energies Energy components (VDW_14, VDW_SR, COUL_14, COUL_SR and EEF1) in kJ/mol
+     void add_interaction_energies(const topology::NonBondedInteraction &interaction, double *energies) const {
+
+          double r2, vdw_energy, coul_energy, eef1_energy;
+          calculate_interaction_energies(interaction, r2, vdw_energy, coul_energy, eef1_energy);
+
+          if (interaction.is_14_interaction) {
+               energies[VDW_14] += vdw_energy;
+               energies[COUL_14] += coul_energy;
+          } else {
+               energies[VDW_SR] += vdw_energy;
+               energies[COUL_SR] += coul_energy;
+          }
+          energies[EEF1] += eef1_energy;
+     }
+
+     //! Interactions used in the current evaluation
+     //! \return The pending pair list if one was built for the latest move, otherwise the current pair list
+     const std::vector<topology::NonBondedInteraction> &evaluated_interactions() const {
+
+          if (this->has_pending_pair_list)
+               return this->pending_interactions;
+
+          return this->non_bonded_interactions;
+     }
+
+     //! Sum the energies of a range of interactions
+     //! \param begin Index of first interaction
+     //! \param end Index after last interaction
+     //! \param energies Sums of energy components (VDW_14, VDW_SR, COUL_14, COUL_SR and EEF1) in kJ/mol
+     void calculate_energy_range(const unsigned int begin, const unsigned int end, double *energies) const {
+
+          const std::vector<topology::NonBondedInteraction> &interactions = evaluated_interactions();
+
+          for (unsigned int i = begin; i < end; i++) {
+
+               // This is the loop where the majority of the time is spent. Feel free to optimize!
+               add_interaction_energies(interactions[i], energies);
+          }
+     }
+
+     //! Sum the energies of a range of residue pairs in far-field mode
+     //! \param begin Index of first residue pair
+     //! \param end Index after last residue pair
+     //! \param energies Sums of energy components of exactly evaluated pairs (first N_COMPONENTS entries),
+     //!                 followed by the far-field energy and error bound in kJ/mol and the number of approximated residue pairs
+     void calculate_far_field_range(const unsigned int begin, const unsigned int end, double *energies) const {
+
+          for (unsigned int k = begin; k < end; k++) {
+
+               const ResiduePairInteractions &residue_pair = this->residue_pairs[k];
+
+               double far_field_energy = 0.0;
+               double far_field_error_bound = 0.0;
+
+               if (charmm_far_field::calculate_far_field_energy(this->residue_summaries[residue_pair.residue1_index],
+                                                                this->residue_summaries[residue_pair.residue2_index],
+                                                                residue_pair.summary,
+                                                                this->settings.far_field_cutoff,
+                                                                this->settings.far_field_tolerance,
+                                                                far_field_energy,
+                                                                far_field_error_bound,
+                                                                this->settings.ctofnb)) {
+
+                    energies[N_COMPONENTS] += far_field_energy;
+                    energies[N_COMPONENTS + 1] += far_field_error_bound;
+                    energies[N_COMPONENTS + 2] += 1.0;
+
+               } else {
+
+                    for (unsigned int i = residue_pair.begin; i < residue_pair.end; i++) {
+                         add_interaction_energies(this->non_bonded_interactions[i], energies);
+                    }
+               }
+          }
+     }
+
+     //! Whether a residue pair was approximated in the last far-field evaluation
+     //! \param residue_pair Residue pair
+     //! \return True if the pair was evaluated from residue summaries
+     bool is_far_field_pair(const ResiduePairInteractions &residue_pair) const {
+
+          double far_field_energy = 0.0;
+          double far_field_error_bound = 0.0;
+
+          return charmm_far_field::calculate_far_field_energy(this->residue_summaries[residue_pair.residue1_index],
+                                                              this->residue_summaries[residue_pair.residue2_index],
+                                                              residue_pair.summary,
+                                                              this->settings.far_field_cutoff,
+                                                              this->settings.far_field_tolerance,
+                                                              far_field_energy,
+                                                              far_field_error_bound,
+                                                              this->settings.ctofnb);
+     }
+
+     //! Print the van der Waals, Coulomb and EEF1-SB energies of a single atom pair,
+     //! in the same format as the charmm-vdw, charmm-coulomb and charmm-implicit-solvent terms
+     //! \param interaction Atom pair
+     void print_interaction(const topology::NonBondedInteraction &interaction) const {
+
+          double r2, vdw_energy, coul_energy, eef1_energy;
+          calculate_interaction_energies(interaction, r2, vdw_energy, coul_energy, eef1_energy);
+
+          if (this->switching_function.enabled && this->switching_function.is_cut(r2))
+               return;
+
+          const double r = std::sqrt(r2);
+
+          if (interaction.is_14_interaction) {
+               std::cout << "# CHARMM vdw-14:";
+          } else {
+               std::cout << "# CHARMM vdw:";
+          }
+
+          std::cout << " a1: " << interaction.atom1
+                    << " a2: " << interaction.atom2
+
+                    << " c6: " <<  interaction.c6
+                    << " c12: " <<  interaction.c12
+
+                    << " r: " << r
+
+                    << " e_vdw: " << vdw_energy
+
+                    << std::endl;
+
+          if (interaction.is_14_interaction) {
+               std::cout << "# CHARMM coulomb-14:";
+          } else {
+               std::cout << "# CHARMM coulomb:";
+          }
+
+          std::cout << " a1: " << interaction.atom1
+                    << " a2: " << interaction.atom2
+
+                    << " q1*q2: " <<  interaction.qq
+
+                    << " r: " << r
+
+                    << " e_coul: " << coul_energy
+
+                    << std::endl;
+
+          if ((interaction.do_eef1) && (r2 < 81.0)) {
+
+               std::cout << "# CHARMM implicit-solvent:"
+
+                         << " a1: " << interaction.atom1
+                         << " a2: " << interaction.atom2
+
+                         << " e_solv : " << eef1_energy * charmm_constants::KJ_TO_KCAL
+
+                         << std::endl;
+          }
+     }
+
+     //! Print the energies of each exactly evaluated atom pair
+     void print_interactions() const {
+
+          if (this->residue_pairs.empty() || this->has_pending_pair_list) {
+
+               const std::vector<topology::NonBondedInteraction> &interactions = evaluated_interactions();
+
+               for (unsigned int i = 0; i < interactions.size(); i++) {
+                    print_interaction(interactions[i]);
+               }
+               return;
+          }
+
+          for (unsigned int k = 0; k < this->residue_pairs.size(); k++) {
+
+               const ResiduePairInteractions &residue_pair = this->residue_pairs[k];
+
+               if (is_far_field_pair(residue_pair))
+                    continue;
+
+               for (unsigned int i = residue_pair.begin; i < residue_pair.end; i++) {
+                    print_interaction(this->non_bonded_interactions[i]);
+               }
+          }
+     }
+
+     //! Print the energy components of the last evaluation,
+     //! in the same format as the charmm-vdw, charmm-coulomb and charmm-implicit-solvent terms
+     void print_energy_components() const {
+
+          const double vdw_total = this->energy_components[VDW_14] + this->energy_components[VDW_SR];
+          const double coul_total = this->energy_components[COUL_14] + this->energy_components[COUL_SR];
+
+          printf("           vdW-14 E = %15.6f kJ/mol\n", this->energy_components[VDW_14]);
+          printf("           vdW-14 E = %15.6f kcal/mol\n", this->energy_components[VDW_14] * charmm_constants::KJ_TO_KCAL);
+          printf("           vdW-SR E = %15.6f kJ/mol\n", this->energy_components[VDW_SR]);
+          printf("           vdW-SR E = %15.6f kcal/mol\n", this->energy_components[VDW_SR] * charmm_constants::KJ_TO_KCAL);
+          printf("        vdW-total E = %15.6f kJ/mol\n", vdw_total);
+          printf("        vdW-total E = %15.6f kcal/mol\n", vdw_total * charmm_constants::KJ_TO_KCAL);
+          printf("          Coul-14 E = %15.6f kJ/mol\n", this->energy_components[COUL_14]);
+          printf("          Coul-14 E = %15.6f kcal/mol\n", this->energy_components[COUL_14] * charmm_constants::KJ_TO_KCAL);
+          printf("          Coul-SR E = %15.6f kJ/mol\n", this->energy_components[COUL_SR]);
+          printf("          Coul-SR E = %15.6f kcal/mol\n", this->energy_components[COUL_SR] * charmm_constants::KJ_TO_KCAL);
+          printf("       Coul-total E = %15.6f kJ/mol\n", coul_total);
+          printf("       Coul-total E = %15.6f kcal/mol\n", coul_total * charmm_constants::KJ_TO_KCAL);
+          printf(" implicit-solvent E = %15.6f kJ/mol\n", this->energy_components[EEF1]);
+          printf(" implicit-solvent E = %15.6f kcal/mol\n", this->energy_components[EEF1] * charmm_constants::KJ_TO_KCAL);
+     }
+
+
      //! Evaluate chain energy
      //! \param move_info object containing information about last move
      //! \return vdw potential energy of the chain in the object
      double evaluate(MoveInfo *move_info=NULL) {
 
+          update_coordinate_buffer();
 
-          double energy_sum = this->dGref_total * charmm_constants::KCAL_TO_KJ;
-
-          for (unsigned int i = 0; i < this->non_bonded_interactions.size(); i++) {
+          // If atoms may have moved into the cutoff from outside the pair list, evaluate with a new
+          // list. It only replaces the current list if the move is accepted (see accept()).
+          // With a cutoff, far-field pairs are exactly zero, so all pairs are simply evaluated exactly.
+          this->has_pending_pair_list = false;
+          if ((this->pair_list_cutoff > 0.0) && this->displacement_tracker.needs_rebuild()) {
 
-                // This is the loop where the majority of the time is spent. Feel free to optimize!
+               this->pending_interactions = generate_interactions();
+               this->coordinate_buffer.assign_indexes(this->pending_interactions);
+               this->has_pending_pair_list = true;
+          }
 
-                // Make local copy of atom pair k.
-                topology::NonBondedInteraction interaction = this->non_bonded_interactions[i];
+          double energies[N_COMPONENTS + 3];
 
-                const double r2 = ((interaction.atom1)->position - (interaction.atom2)->position).norm_squared();
+          if (this->residue_pairs.empty() || this->has_pending_pair_list) {
 
-                const double inv_r2 = 1.0 / r2; // convert to nanometers
-                const double inv_r6 = inv_r2 * inv_r2 * inv_r2 * charmm_constants::NM6_TO_ANGS6;
+               // Exact evaluation of all atom pairs
+               charmm_parallel::chunked_sum(*this, &TermCharmmNonBonded::calculate_energy_range,
+                                            evaluated_interactions().size(), N_COMPONENTS, this->settings.threads, energies);
 
-                // Add vdw and coulomb energy (using nm and kJ).
-                energy_sum += (interaction.c12 * inv_r6 - interaction.c6) * inv_r6     // VDW energy
-                    + interaction.qq * inv_r2 * charmm_constants::TEN_OVER_ONE_POINT_FIVE;   // Coulomb energy
+               energies[N_COMPONENTS] = 0.0;
+               energies[N_COMPONENTS + 1] = 0.0;
+               energies[N_COMPONENTS + 2] = 0.0;
 
-                // If the pair has a contribution to EEF1-SB solvation term
-                if ((interaction.do_eef1) && (r2 < 81.0)) {
+          } else {
 
-                    // From Sandro's code -- this bit is in angstrom and kcal.
-                    const double r_ij = std::sqrt(r2);
+               // Far-field mode: approximate distant residue pairs from residue summaries
+               for (unsigned int i = 0; i < this->residue_atoms.size(); i++) {
+                    this->residue_summaries[i] = charmm_far_field::calculate_residue_summary(this->residue_atoms[i]);
+               }
 
-                    const double arg_ij = std::fabs((r_ij - interaction.R_vdw_1)/interaction.lambda1);
-                    const double arg_ji = std::fabs((r_ij - interaction.R_vdw_2)/interaction.lambda2);
+               charmm_parallel::chunked_sum(*this, &TermCharmmNonBonded::calculate_far_field_range,
+                                            this->residue_pairs.size(), N_COMPONENTS + 3, this->settings.threads, energies,
+                                            FAR_FIELD_CHUNK_SIZE);
+          }
 
-                    const int bin_ij = int(arg_ij*100);
-                    const int bin_ji = int(arg_ji*100);
+          energies[EEF1] += this->dGref_total * charmm_constants::KCAL_TO_KJ;
 
-                    double exp_ij = 0.0;
-                    double exp_ji = 0.0;
+          double energy_sum = 0.0;
+          for (unsigned int c = 0; c < N_COMPONENTS; c++) {
+               this->energy_components[c] = energies[c];
+               energy_sum += energies[c];
+          }
 
-                    if (bin_ij < 350) exp_ij = charmm_constants::EXP_EEF1[bin_ij];
-                    if (bin_ji < 350) exp_ji = charmm_constants::EXP_EEF1[bin_ji];
+          this->far_field_energy = energies[N_COMPONENTS];
+          this->far_field_error_bound = energies[N_COMPONENTS + 1] * charmm_constants::KJ_TO_KCAL;
+          this->far_field_pairs = (unsigned int)energies[N_COMPONENTS + 2];
 
-                    // Add solvation energy (in kcal, so convert to kJ)
-                    energy_sum -= (interaction.fac_12*exp_ij + interaction.fac_21*exp_ji) * inv_r2 * charmm_constants::KCAL_TO_KJ;
+          energy_sum += this->far_field_energy;
 
-                }
+          if (this->settings.debug > 1) {
+               print_interactions();
+          }
 
+          if (this->settings.debug > 0) {
+               print_energy_components();
 
+               if (!this->residue_pairs.empty()) {
+                   printf("        far-field E = %15.6f kJ/mol\n", this->far_field_energy);
+                   printf("        far-field E = %15.6f kcal/mol\n", this->far_field_energy * charmm_constants::KJ_TO_KCAL);
+                   printf("  Far-field pairs     = %15d\n", this->far_field_pairs);
+                   printf("  Far-field error     < %15.6f kcal/mol\n", this->far_field_error_bound);
+               }
           }
 
           return energy_sum * charmm_constants::KJ_TO_KCAL;
      }
+
+     //! Accept move. Replaces the pair list if a new one was needed for the move.
+     void accept() {
+
+          if (this->has_pending_pair_list) {
+               this->non_bonded_interactions.swap(this->pending_interactions);
+               this->pending_interactions.clear();
+               this->has_pending_pair_list = false;
+
+               setup_pair_list();
+          }
+     }
+
+     //! Reject move. A pair list built for the move is discarded.
+     void reject() {
+
+          if (this->has_pending_pair_list) {
+               this->pending_interactions.clear();
+               this->has_pending_pair_list = false;
+          }
+     }
 };
 
 }
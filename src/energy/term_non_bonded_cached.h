@@ -30,8 +30,13 @@
 #include "parsers/topology_parser.h"
 #include "parsers/eef1_sb_parser.h"
 #include "constants.h"
-#include "parameters/vdw14_itp.h"
-#include "parameters/vdw_itp.h"
+#include "cache_statistics.h"
+#include "far_field.h"
+#include "switching.h"
+#include "neighbour_list.h"
+#include "spatial_ordering.h"
+#include "parameters/vdw14_parameters.h"
+#include "parameters/vdw_parameters.h"
 #include "parameters/solvpar_17_inp.h"
 
 namespace phaistos {
@@ -56,12 +61,67 @@ protected:
         //! A list of all interactions that need to be computed
         std::vector<topology::NonBondedInteraction> interactions;
 
+        //! Number of interactions (at the front of interactions) in the Verlet list.
+        //! Equal to the number of interactions if no cutoff is used.
+        unsigned int n_active;
+
+        //! Whether the pair was recomputed in the current move (scratch space)
+        bool is_modified;
+
+     };
+
+     //! Struct that holds the far-field state of a residue pair
+     //! (kept apart from CachedResidueInteraction, and only allocated in far-field mode).
+     struct CachedFarFieldInteraction {
+
+        //! Summary used in the far-field approximation
+        charmm_far_field::ResiduePairSummary summary;
+
+        //! Whether the pair was approximated in its latest evaluation
+        bool is_far_field;
+
+        //! Bound on the far-field error before latest move (kcal/mol, zero if exact)
+        double error_bound_old;
+
+        //! Bound on the far-field error after latest move (kcal/mol, zero if exact)
+        double error_bound_new;
+
+     };
+
+     //! Struct that holds the summed energy of all residue pairs
+     //! between two blocks of consecutive residues.
+     struct CachedBlockInteraction {
+
+        //! Energy before latest move
+        double energy_old;
+
+        //! Energy after latest move
+        double energy_new;
+
      };
 
      //! Lookup table containing interactions that need to be recomputed.
-     //! The size is L x L where L is the length of the chain. Only the upper triangle
-     //! is filled.
-     std::vector< std::vector<CachedResidueInteraction> > cached_residue_interactions;
+     //! The size is L x L where L is the length of the chain, stored flat
+     //! at index i*L + j. Only the lower triangle (i >= j) is filled.
+     std::vector<CachedResidueInteraction> cached_residue_interactions;
+
+     //! Far-field state of each residue pair, indexed as cached_residue_interactions
+     //! (only used in far-field mode, empty otherwise)
+     std::vector<CachedFarFieldInteraction> cached_far_field_interactions;
+
+     //! Second cache level: energy totals over pairs of residue blocks.
+     //! The size is N x N where N is the number of blocks, stored flat
+     //! at index I*N + J. Only the lower triangle (I >= J) is filled.
+     std::vector<CachedBlockInteraction> cached_block_interactions;
+
+     //! For each residue, the (sorted) residues it has interactions with in the Verlet lists
+     std::vector<std::vector<unsigned int> > residue_neighbours;
+
+     //! Number of residues in each block
+     unsigned int block_size;
+
+     //! Number of blocks in the chain
+     unsigned int n_blocks;
 
      //! The total energy after the latest move
      double total_energy;
@@ -69,17 +129,150 @@ protected:
      //! The total energy before the latest move
      double total_energy_old;
 
-     //! List of indexes in the cache that need to be recomputed after last move
-     std::vector<std::vector<unsigned int> > cache_indexes;
+     //! Residue pair cells that were recomputed in the latest move
+     std::vector<unsigned int> modified_cells;
+
+     //! Block pair cells that were updated in the latest move
+     std::vector<unsigned int> modified_blocks;
+
+     //! Energy change per block pair in the latest move (scratch space)
+     std::vector<double> block_delta_energy;
+
+     //! Flags marking block pairs already in modified_blocks (scratch space)
+     std::vector<bool> block_is_modified;
 
      bool none_move;
 
      double dGref_total;
 
+     //! Index of first residue that was moved in current move
+     unsigned int start_index;
+
+     //! Index of last residue that was moved in current move
+     unsigned int end_index;
+
+     //! Atom type IDs and charges of the atoms in the chain
+     eef1_sb_parser::ChainAtomTypes atom_types;
+
+     //! Topology images of the interaction lists (keeps the images that were read mapped)
+     topology::TopologyImageDirectory topology_images;
+
+     //! Atoms and charges in each residue (only used in far-field mode)
+     std::vector<std::vector<charmm_far_field::ChargedAtom> > residue_atoms;
+
+     //! Multipole summary of each residue (only used in far-field mode)
+     std::vector<charmm_far_field::ResidueSummary> residue_summaries;
+
+     //! Multipole summary of each residue before latest move (only used in far-field mode)
+     std::vector<charmm_far_field::ResidueSummary> residue_summaries_old;
+
+     //! Bound on the far-field error before latest move (kcal/mol)
+     double far_field_error_bound_old;
+
+     //! Switching function used with a non-bonded cutoff
+     charmm_switching::SwitchingFunction switching_function;
+
+     //! Distance within which atom pairs are kept in the Verlet lists (0: all pairs)
+     double pair_list_cutoff;
+
+     //! Atom displacements since the Verlet list of each residue was built
+     charmm_neighbour_list::DisplacementTracker displacement_tracker;
+
+     //! Moved residues with atoms that have moved more than half the skin in the current move
+     std::vector<unsigned int> stale_residues;
+
+     //! Flags marking residues in stale_residues
+     std::vector<bool> residue_is_stale;
+
+     //! Bounding sphere centers of moved residues in the current move (only set if a residue is stale)
+     std::vector<Vector_3D> current_centers;
+
+     //! Bounding sphere radii of moved residues in the current move (only set if a residue is stale)
+     std::vector<double> current_radii;
+
+     //! Centers of spheres bounding the reference spheres of the residues in each block (only with a cutoff)
+     std::vector<Vector_3D> block_reference_centers;
+
+     //! Radii of spheres bounding the reference spheres of the residues in each block (only with a cutoff)
+     std::vector<double> block_reference_radii;
+
+     //! Residues which may form a pair with a stale residue within the cutoff (scratch space)
+     std::vector<unsigned int> partner_residues;
+
+     //! Counters for cache effectiveness
+     charmm_cache::CacheStatistics statistics;
+
 public:
 
-     //! Use same settings as base class
-     typedef EnergyTerm<ChainFB>::SettingsClassicEnergy Settings;
+     //! Bound on the error of the far-field approximation in the current energy (kcal/mol)
+     double far_field_error_bound;
+
+     //! Local settings class
+     const class Settings: public EnergyTerm<ChainFB>::SettingsClassicEnergy {
+     public:
+
+          //! Number of residues per block in the block level of the cache (0: automatic)
+          int block_size;
+
+          //! Whether to print cache statistics when the term is destroyed
+          bool print_cache_statistics;
+
+          //! Centroid distance beyond which residue pairs are approximated (0: disabled)
+          double far_field_cutoff;
+
+          //! Largest error bound allowed for an approximated residue pair (kcal/mol)
+          double far_field_tolerance;
+
+          //! Distance where switching of van der Waals and Coulomb energies starts (Angstrom)
+          double ctonnb;
+
+          //! Distance beyond which atom pairs do not contribute (Angstrom, 0: no cutoff)
+          double ctofnb;
+
+          //! Distance within which atom pairs are kept in the Verlet lists (Angstrom, 0: ctofnb + 2)
+          double cutnb;
+
+          //! Number of threads used to generate the interactions (0: all available)
+          int threads;
+
+          //! Directory of topology images ("": interactions are always generated)
+          std::string topology_image_dir;
+
+          //! Constructor
+          Settings(int block_size=0,
+                   bool print_cache_statistics=false,
+                   double far_field_cutoff=0.0,
+                   double far_field_tolerance=0.01,
+                   double ctonnb=0.0,
+                   double ctofnb=0.0,
+                   double cutnb=0.0,
+                   int threads=1,
+                   std::string topology_image_dir="")
+               : block_size(block_size),
+                 print_cache_statistics(print_cache_statistics),
+                 far_field_cutoff(far_field_cutoff),
+                 far_field_tolerance(far_field_tolerance),
+                 ctonnb(ctonnb),
+                 ctofnb(ctofnb),
+                 cutnb(cutnb),
+                 threads(threads),
+                 topology_image_dir(topology_image_dir) {}
+
+          //! Output operator
+          friend std::ostream &operator<<(std::ostream &o, const Settings &settings) {
+               o << "block-size:" << settings.block_size << "\n";
+               o << "print-cache-statistics:" << settings.print_cache_statistics << "\n";
+               o << "far-field-cutoff:" << settings.far_field_cutoff << "\n";
+               o << "far-field-tolerance:" << settings.far_field_tolerance << "\n";
+               o << "ctonnb:" << settings.ctonnb << "\n";
+               o << "ctofnb:" << settings.ctofnb << "\n";
+               o << "cutnb:" << settings.cutnb << "\n";
+               o << "threads:" << settings.threads << "\n";
+               o << "topology-image-dir:" << settings.topology_image_dir << "\n";
+               o << static_cast<const EnergyTerm<ChainFB>::Settings>(settings);
+               return o;
+          }
+     } settings;    //!< Local settings object
 
 
      //! Calculate the energy of a diatomic interaction
@@ -141,135 +334,552 @@ public:
           std::vector< std::vector<double> > factors;
           std::vector<double> vdw_radii;
           std::vector<double> lambda;
-          std::map<std::string, unsigned int> eef1_atom_type_index_map;
+          std::vector<unsigned int> eef1_atom_type_indexes;
+
+          initialize(dGref, factors, vdw_radii, lambda, eef1_atom_type_indexes);
 
-          initialize(dGref, factors, vdw_radii, lambda, eef1_atom_type_index_map);
 
+          std::vector<topology::NonBondedInteraction> non_bonded_interactions;
 
-          std::vector<topology::NonBondedParameter> non_bonded_parameters
-              = topology::read_nonbonded_parameters(charmm_constants::vdw_itp);
+          // Bond graph and atom types, shared by the generator and this term (built when first needed)
+          topology::ChainTopology chain_topology(this->chain);
 
-          std::vector<topology::NonBonded14Parameter> non_bonded_14_parameters
-              = topology::read_nonbonded_14_parameters(charmm_constants::vdw14_itp);
+          this->topology_images = topology::TopologyImageDirectory(this->chain, this->settings.topology_image_dir);
+          if (!this->topology_images.read("non-bonded-eef1", non_bonded_interactions)) {
 
-          std::vector<topology::NonBondedInteraction> non_bonded_interactions
-              = topology::generate_non_bonded_interactions_cached(this->chain,
-                                                                  non_bonded_parameters,
-                                                                  non_bonded_14_parameters,
-                                                                  dGref,
-                                                                  factors,
-                                                                  vdw_radii,
-                                                                  lambda,
-                                                                  eef1_atom_type_index_map);
+               std::vector<topology::NonBondedParameter> non_bonded_parameters
+                   = topology::get_nonbonded_parameters();
+
+               std::vector<topology::NonBonded14Parameter> non_bonded_14_parameters
+                   = topology::get_nonbonded_14_parameters();
+
+               non_bonded_interactions
+                   = topology::generate_non_bonded_interactions_cached(chain_topology,
+                                                                       non_bonded_parameters,
+                                                                       non_bonded_14_parameters,
+                                                                       dGref,
+                                                                       factors,
+                                                                       vdw_radii,
+                                                                       lambda,
+                                                                       eef1_atom_type_indexes,
+                                                                       0.0,
+                                                                       this->settings.threads);
+               this->topology_images.write("non-bonded-eef1", non_bonded_interactions);
+          }
 
             std::cout << non_bonded_interactions.size() << std::endl;
+            this->atom_types = chain_topology.get_atom_types();
+
             this->dGref_total = 0.0;
 
             for (AtomIterator<ChainFB, definitions::ALL> it(*this->chain); !it.end(); ++it) {
 
                 Atom *atom = &*it;
-                std::string atom_type = eef1_sb_parser::get_atom_type(atom);
 
-                unsigned int index = eef1_atom_type_index_map[atom_type];
+                unsigned int index = eef1_atom_type_indexes[this->atom_types.get_atom_type_id(atom)];
 
                 this->dGref_total += dGref[index];
             }
 
-            // Fill up cached matrix and set energy to zero
-            for (int i = 0; i < this->chain->size(); i++) {
+            this->switching_function = charmm_switching::SwitchingFunction(this->settings.ctonnb, this->settings.ctofnb);
+            this->pair_list_cutoff = charmm_neighbour_list::pair_list_cutoff(this->settings.ctofnb, this->settings.cutnb);
 
-                // Dummy residue pair
-                std::vector<CachedResidueInteraction> temp_interaction_vector;
-                this->cached_residue_interactions.push_back(temp_interaction_vector);
+            const unsigned int n_residues = this->chain->size();
 
-                for (int j = 0; j < this->chain->size(); j++) {
+            // Choose block size. By default, blocks of sqrt(L) residues balance the
+            // number of block totals against the number of residue pairs per block.
+            if (this->settings.block_size > 0) {
+                this->block_size = this->settings.block_size;
+            } else {
+                this->block_size = std::max(1, (int)std::sqrt((double)n_residues));
+            }
+            this->n_blocks = (n_residues + this->block_size - 1) / this->block_size;
 
-                    // Initialize residue pair and push back
-                    CachedResidueInteraction temp_interaction;
-                    temp_interaction.energy_old = 0.0;
-                    temp_interaction.energy_new = 0.0;
-                    this->cached_residue_interactions[i].push_back(temp_interaction);
+            // Fill up cached matrix and set energy to zero
+            CachedResidueInteraction empty_interaction;
+            empty_interaction.energy_old = 0.0;
+            empty_interaction.energy_new = 0.0;
+            empty_interaction.n_active = 0;
+            empty_interaction.is_modified = false;
+            this->cached_residue_interactions.assign(n_residues * n_residues, empty_interaction);
+
+            CachedBlockInteraction empty_block_interaction;
+            empty_block_interaction.energy_old = 0.0;
+            empty_block_interaction.energy_new = 0.0;
+            this->cached_block_interactions.assign(this->n_blocks * this->n_blocks, empty_block_interaction);
+
+            this->block_delta_energy.assign(this->n_blocks * this->n_blocks, 0.0);
+            this->block_is_modified.assign(this->n_blocks * this->n_blocks, false);
+
+            // With a cutoff, interactions refer to atoms in the displacement tracker
+            if (this->pair_list_cutoff > 0.0) {
+                this->displacement_tracker = charmm_neighbour_list::DisplacementTracker(this->chain,
+                                                                                        this->pair_list_cutoff - this->settings.ctofnb);
+                charmm_spatial::assign_atom_indexes(this->displacement_tracker.atoms, non_bonded_interactions);
+
+                this->block_reference_centers.resize(this->n_blocks);
+                this->block_reference_radii.resize(this->n_blocks);
+                for (unsigned int block_index = 0; block_index < this->n_blocks; block_index++) {
+                    update_block_reference_sphere(block_index);
                 }
             }
+            this->stale_residues.clear();
+            this->residue_is_stale.assign(n_residues, false);
+            this->current_centers.resize(n_residues);
+            this->current_radii.resize(n_residues);
 
             // Fill atom pairs in cache matrix
             for (unsigned int i = 0; i < non_bonded_interactions.size(); i++) {
 
-                topology::NonBondedInteraction interaction = non_bonded_interactions[i];
+                const topology::NonBondedInteraction &interaction = non_bonded_interactions[i];
 
                 // Get the residue indexes of the atoms involved in this pair
                 int residue1_index = (interaction.atom1)->residue->index;
                 int residue2_index = (interaction.atom2)->residue->index;
 
-                // Make sure we only fill out the upper triangle of the cache matrix
-                if (residue2_index > residue1_index) {
-                    this->cached_residue_interactions[residue2_index][residue1_index].interactions.push_back(interaction);
-                } else {
-                    this->cached_residue_interactions[residue1_index][residue2_index].interactions.push_back(interaction);
+                this->cached_residue_interactions[cell_index(residue1_index, residue2_index)].interactions.push_back(interaction);
+            }
+
+            this->cached_far_field_interactions.clear();
+            if (this->settings.far_field_cutoff > 0.0) {
+                setup_far_field();
+            }
+
+            // Set up Verlet lists (all interactions are active without a cutoff)
+            for (unsigned int i = 0; i < n_residues; i++) {
+                for (unsigned int j = 0; j <= i; j++) {
+
+                    CachedResidueInteraction &cached_interaction = this->cached_residue_interactions[cell_index(i, j)];
+
+                    if (this->pair_list_cutoff > 0.0) {
+                        update_verlet_list(i, j, cached_interaction);
+                    } else {
+                        cached_interaction.n_active = cached_interaction.interactions.size();
+                    }
                 }
             }
 
             // Initialize total energies
             this->total_energy = this->dGref_total;
             this->total_energy_old = this->dGref_total;
+            this->far_field_error_bound = 0.0;
+            this->far_field_error_bound_old = 0.0;
+
+            this->residue_neighbours.assign(n_residues, std::vector<unsigned int>());
+
+            // Calculate energy for each cache matrix element and sum into blocks
+            for (unsigned int i = 0; i < n_residues; i++) {
+                for (unsigned int j = 0; j <= i; j++) {
 
-            // Calculate energy for each cache matrix element
-            for (int i = 0; i < this->chain->size(); i++) {
-                for (int j = 0; j < this->chain->size(); j++) {
+                    CachedResidueInteraction &cached_interaction = this->cached_residue_interactions[cell_index(i, j)];
 
-                    // Reset matrix element energies
-                    this->cached_residue_interactions[i][j].energy_old = 0.0;
-                    this->cached_residue_interactions[i][j].energy_new = 0.0;
-                    // if (j > i) continue;
+                    // Residue pairs that are not in the Verlet lists are beyond the cutoff
+                    if (cached_interaction.n_active == 0)
+                        continue;
 
-                    // Sum over all interactions in that matrix element
-                    for (unsigned int k = 0; k < this->cached_residue_interactions[i][j].interactions.size(); k++) {
+                    // Register residue pair as neighbours
+                    this->residue_neighbours[i].push_back(j);
+                    if (i != j)
+                        this->residue_neighbours[j].push_back(i);
 
-                        topology::NonBondedInteraction interaction = this->cached_residue_interactions[i][j].interactions[k];
+                    CachedFarFieldInteraction *far_field_interaction = get_far_field_interaction(cell_index(i, j));
 
-                        double interaction_energy = calculate_interaction_energy(interaction);
+                    const double interaction_energy = calculate_cell_energy(i, j, cached_interaction, far_field_interaction);
 
-                        // Add to matrix element
-                        this->cached_residue_interactions[i][j].energy_old += interaction_energy;
-                        this->cached_residue_interactions[i][j].energy_new += interaction_energy;
+                    cached_interaction.energy_old = interaction_energy;
+                    cached_interaction.energy_new = interaction_energy;
 
-                        //Add to toal energies
-                        this->total_energy     += interaction_energy;
-                        this->total_energy_old += interaction_energy;
+                    if (far_field_interaction) {
+                        far_field_interaction->error_bound_old = far_field_interaction->error_bound_new;
+                        this->far_field_error_bound += far_field_interaction->error_bound_new;
+                        this->far_field_error_bound_old += far_field_interaction->error_bound_new;
                     }
+
+                    CachedBlockInteraction &cached_block_interaction = this->cached_block_interactions[block_cell_index(i, j)];
+                    cached_block_interaction.energy_old += interaction_energy;
+                    cached_block_interaction.energy_new += interaction_energy;
+
+                    //Add to toal energies
+                    this->total_energy     += interaction_energy;
+                    this->total_energy_old += interaction_energy;
                 }
             }
 
             std::cout << "Total constructor energy " << this->total_energy << std::endl;
 
+            this->modified_cells.clear();
+            this->modified_blocks.clear();
+     }
+
 
-            this->cache_indexes = get_cache_indexes(0, this->chain->size() -1);
+     //! Store atoms and charges per residue and summarize each residue pair for the far-field approximation
+     void setup_far_field() {
+
+          const unsigned int n_residues = this->chain->size();
+
+          this->residue_atoms.assign(n_residues, std::vector<charmm_far_field::ChargedAtom>());
+          for (AtomIterator<ChainFB, definitions::ALL> it(*this->chain); !it.end(); ++it) {
+
+               charmm_far_field::ChargedAtom charged_atom;
+               charged_atom.atom = &*it;
+               charged_atom.charge = this->atom_types.get_atom_charge(charged_atom.atom);
+
+               this->residue_atoms[charged_atom.atom->residue->index].push_back(charged_atom);
+          }
+
+          this->residue_summaries.resize(n_residues);
+          for (unsigned int i = 0; i < n_residues; i++) {
+               this->residue_summaries[i] = charmm_far_field::calculate_residue_summary(this->residue_atoms[i]);
+          }
+          this->residue_summaries_old = this->residue_summaries;
+
+          CachedFarFieldInteraction empty_far_field_interaction;
+          empty_far_field_interaction.summary.eligible = false;
+          empty_far_field_interaction.is_far_field = false;
+          empty_far_field_interaction.error_bound_old = 0.0;
+          empty_far_field_interaction.error_bound_new = 0.0;
+          this->cached_far_field_interactions.assign(n_residues * n_residues, empty_far_field_interaction);
+
+          // A residue never interacts with itself in the far field, so only i > j
+          for (unsigned int i = 0; i < n_residues; i++) {
+               for (unsigned int j = 0; j < i; j++) {
+
+                    const CachedResidueInteraction &cached_interaction = this->cached_residue_interactions[cell_index(i, j)];
+
+                    this->cached_far_field_interactions[cell_index(i, j)].summary = charmm_far_field::calculate_residue_pair_summary(
+                                                                cached_interaction.interactions,
+                                                                0, cached_interaction.interactions.size(),
+                                                                this->residue_atoms[i].size(),
+                                                                this->residue_atoms[j].size());
+               }
+          }
      }
 
 
-     // Returns the pairs indexes for the residues which need recomputation after
-     // an MC move has been carried out.
-     std::vector<std::vector<unsigned int> > get_cache_indexes(const unsigned int start,
-                                                               const unsigned int end) {
-        using namespace vector_utils;
-        std::vector<std::vector<unsigned int> > indexes;
+     //! Select the interactions of a residue pair whose atoms had reference positions within the pair list cutoff,
+     //! and move them to the front of the interaction list.
+     //! \param residue1_index Index of first residue
+     //! \param residue2_index Index of second residue
+     //! \param cached_interaction Residue pair cell
+     void update_verlet_list(const unsigned int residue1_index,
+                             const unsigned int residue2_index,
+                             CachedResidueInteraction &cached_interaction) {
 
-        unsigned int last = (unsigned int)this->chain->size();
+          if (!this->displacement_tracker.references_within(residue1_index, residue2_index, this->pair_list_cutoff)) {
+               cached_interaction.n_active = 0;
+               return;
+          }
 
-        for (unsigned int i = start; i < end + 1; i++) {
-            for (unsigned int j = 0; j < last; j++) {
+          std::vector<topology::NonBondedInteraction> &interactions = cached_interaction.interactions;
 
-                if (j < start) {
-                    indexes.push_back(make_vector(i, j));
-                } else if (j > end) {
-                    indexes.push_back(make_vector(j, i));
-                } else if (i >= j) {
-                    indexes.push_back(make_vector(i, j));
-                }
-            }
-        }
+          cached_interaction.n_active = std::partition(interactions.begin(), interactions.end(),
+                                                       charmm_neighbour_list::ReferenceDistanceWithin(this->displacement_tracker,
+                                                                                                      this->pair_list_cutoff))
+                                        - interactions.begin();
+     }
+
+
+     //! Rebuild the Verlet lists of all residue pairs involving a residue from its current positions
+     //! \param residue_index Index of residue
+     void rebuild_verlet_lists(const unsigned int residue_index) {
+
+          this->displacement_tracker.reset(residue_index);
+          update_block_reference_sphere(residue_index / this->block_size);
 
-        return indexes;
+          // Pairs that are not in the Verlet lists and are beyond the pair list cutoff stay inactive
+          find_partner_residues(residue_index,
+                                this->displacement_tracker.reference_centers[residue_index],
+                                this->displacement_tracker.reference_radii[residue_index] + this->pair_list_cutoff,
+                                false);
+
+          for (unsigned int k = 0; k < this->partner_residues.size(); k++) {
+
+               const unsigned int j = this->partner_residues[k];
+
+               CachedResidueInteraction &cached_interaction = this->cached_residue_interactions[cell_index(residue_index, j)];
+
+               if (cached_interaction.interactions.empty())
+                    continue;
+
+               const bool was_active = (cached_interaction.n_active > 0);
+
+               update_verlet_list(residue_index, j, cached_interaction);
+
+               const bool is_active = (cached_interaction.n_active > 0);
+
+               if (is_active == was_active)
+                    continue;
+
+               // Keep residue neighbour lists sorted
+               std::vector<unsigned int> &neighbours1 = this->residue_neighbours[residue_index];
+               std::vector<unsigned int> &neighbours2 = this->residue_neighbours[j];
+
+               if (is_active) {
+                    neighbours1.insert(std::lower_bound(neighbours1.begin(), neighbours1.end(), j), j);
+                    if (j != residue_index)
+                         neighbours2.insert(std::lower_bound(neighbours2.begin(), neighbours2.end(), residue_index), residue_index);
+               } else {
+                    neighbours1.erase(std::lower_bound(neighbours1.begin(), neighbours1.end(), j));
+                    if (j != residue_index)
+                         neighbours2.erase(std::lower_bound(neighbours2.begin(), neighbours2.end(), residue_index));
+               }
+          }
+     }
+
+
+     //! Recompute the sphere bounding the reference spheres of the residues in a block
+     //! \param block_index Index of block
+     void update_block_reference_sphere(const unsigned int block_index) {
+
+          const unsigned int begin = block_index * this->block_size;
+          const unsigned int end = std::min(begin + this->block_size, (unsigned int)this->chain->size());
+
+          Vector_3D &center = this->block_reference_centers[block_index];
+          double &radius = this->block_reference_radii[block_index];
+
+          center = Vector_3D(0.0, 0.0, 0.0);
+          for (unsigned int i = begin; i < end; i++) {
+               center = center + this->displacement_tracker.reference_centers[i];
+          }
+          center = center * (1.0 / (end - begin));
+
+          radius = 0.0;
+          for (unsigned int i = begin; i < end; i++) {
+               radius = std::max(radius, (this->displacement_tracker.reference_centers[i] - center).norm()
+                                         + this->displacement_tracker.reference_radii[i]);
+          }
+     }
+
+
+     //! Find the residues which may form a pair with a residue within a distance, in
+     //! increasing order: its current neighbours and the residues in the blocks whose
+     //! reference spheres are within reach. Other blocks are skipped as a whole, so
+     //! only blocks near the residue are visited residue by residue.
+     //! \param residue_index Index of residue
+     //! \param center Center of the residue
+     //! \param reach Distance from center within which partners are found (on top of the block radii)
+     //! \param current Whether the current positions are used (residues outside the moved region are
+     //!                within half the skin of their reference positions, residues in it are always included)
+     void find_partner_residues(const unsigned int residue_index,
+                                const Vector_3D &center,
+                                double reach,
+                                const bool current) {
+
+          const unsigned int n_residues = this->chain->size();
+
+          this->partner_residues = this->residue_neighbours[residue_index];
+
+          if (current)
+               reach += this->displacement_tracker.half_skin;
+
+          for (unsigned int block_index = 0; block_index < this->n_blocks; block_index++) {
+
+               const unsigned int begin = block_index * this->block_size;
+               const unsigned int end = std::min(begin + this->block_size, n_residues);
+
+               const bool in_moved_region = current && begin <= this->end_index && end > this->start_index;
+
+               const double block_reach = reach + this->block_reference_radii[block_index];
+
+               if (in_moved_region ||
+                   (center - this->block_reference_centers[block_index]).norm_squared() < block_reach * block_reach) {
+                    for (unsigned int j = begin; j < end; j++) {
+                         this->partner_residues.push_back(j);
+                    }
+               }
+          }
+
+          std::sort(this->partner_residues.begin(), this->partner_residues.end());
+          this->partner_residues.erase(std::unique(this->partner_residues.begin(), this->partner_residues.end()),
+                                       this->partner_residues.end());
+     }
+
+
+     //! Whether two residues can have atom pairs within the cutoff at the current positions.
+     //! Only valid during a move with stale residues (see evaluate()).
+     //! \param residue1_index Index of first residue
+     //! \param residue2_index Index of second residue
+     //! \return False if all atom pairs are beyond ctofnb
+     bool residues_may_interact(const unsigned int residue1_index,
+                                const unsigned int residue2_index) const {
+
+          double reach = this->settings.ctofnb;
+          Vector_3D centers[2];
+
+          const unsigned int residue_indexes[2] = {residue1_index, residue2_index};
+          for (unsigned int k = 0; k < 2; k++) {
+
+               const unsigned int index = residue_indexes[k];
+
+               // Residues that did not move are within half the skin of their reference positions
+               if (index >= this->start_index && index <= this->end_index) {
+                    centers[k] = this->current_centers[index];
+                    reach += this->current_radii[index];
+               } else {
+                    centers[k] = this->displacement_tracker.reference_centers[index];
+                    reach += this->displacement_tracker.reference_radii[index] + this->displacement_tracker.half_skin;
+               }
+          }
+
+          return (centers[0] - centers[1]).norm_squared() < reach * reach;
+     }
+
+
+     //! Far-field state of a residue pair
+     //! \param cell Index of the residue pair in the flat cache matrix
+     //! \return Pointer into cached_far_field_interactions (NULL if far-field mode is disabled)
+     CachedFarFieldInteraction *get_far_field_interaction(const unsigned int cell) {
+
+          if (this->cached_far_field_interactions.empty())
+               return NULL;
+          return &this->cached_far_field_interactions[cell];
+     }
+
+
+     //! Calculate the energy of a residue pair, using the far-field approximation if enabled and applicable.
+     //! \param residue1_index Index of first residue
+     //! \param residue2_index Index of second residue
+     //! \param cached_interaction Residue pair cell
+     //! \param far_field_interaction Far-field state of the residue pair (NULL if far-field mode is disabled)
+     //! \param all_pairs Whether to evaluate all atom pairs rather than only those in the Verlet list
+     //! \return Energy of the residue pair in kcal/mol
+     double calculate_cell_energy(const unsigned int residue1_index,
+                                  const unsigned int residue2_index,
+                                  const CachedResidueInteraction &cached_interaction,
+                                  CachedFarFieldInteraction *far_field_interaction,
+                                  const bool all_pairs=false) const {
+
+          if (far_field_interaction) {
+               far_field_interaction->is_far_field = false;
+               far_field_interaction->error_bound_new = 0.0;
+          }
+
+          if (far_field_interaction && far_field_interaction->summary.eligible) {
+
+               double far_field_energy = 0.0;
+               double far_field_error_bound = 0.0;
+
+               if (charmm_far_field::calculate_far_field_energy(this->residue_summaries[residue1_index],
+                                                                this->residue_summaries[residue2_index],
+                                                                far_field_interaction->summary,
+                                                                this->settings.far_field_cutoff,
+                                                                this->settings.far_field_tolerance,
+                                                                far_field_energy,
+                                                                far_field_error_bound,
+                                                                this->settings.ctofnb)) {
+
+                    far_field_interaction->is_far_field = true;
+                    far_field_interaction->error_bound_new = far_field_error_bound * charmm_constants::KJ_TO_KCAL;
+
+                    return far_field_energy * charmm_constants::KJ_TO_KCAL;
+               }
+          }
+
+          return calculate_cached_residue_energy(cached_interaction, all_pairs);
+     }
+
+
+     //! Index of a residue pair in the flat cache matrix.
+     //! \param residue1_index Index of first residue
+     //! \param residue2_index Index of second residue
+     //! \return Index into cached_residue_interactions
+     unsigned int cell_index(const unsigned int residue1_index,
+                             const unsigned int residue2_index) const {
+
+          const unsigned int n_residues = this->chain->size();
+
+          // Make sure we only fill out the lower triangle of the cache matrix
+          if (residue1_index >= residue2_index) {
+               return residue1_index * n_residues + residue2_index;
+          } else {
+               return residue2_index * n_residues + residue1_index;
+          }
+     }
+
+
+     //! Index of the block pair containing a residue pair in the flat block matrix.
+     //! \param residue1_index Index of first residue
+     //! \param residue2_index Index of second residue
+     //! \return Index into cached_block_interactions
+     unsigned int block_cell_index(const unsigned int residue1_index,
+                                   const unsigned int residue2_index) const {
+
+          const unsigned int block1_index = residue1_index / this->block_size;
+          const unsigned int block2_index = residue2_index / this->block_size;
+
+          if (block1_index >= block2_index) {
+               return block1_index * this->n_blocks + block2_index;
+          } else {
+               return block2_index * this->n_blocks + block1_index;
+          }
+     }
+
+
+     //! Calculate the energy of all atom pairs in a residue pair.
+     //! \param cached_interaction Residue pair cell
+     //! \param all_pairs Whether to evaluate all atom pairs rather than only those in the Verlet list
+     //! \return Energy of the residue pair in kcal/mol
+     double calculate_cached_residue_energy(const CachedResidueInteraction &cached_interaction,
+                                            const bool all_pairs=false) const {
+
+          double energy = 0.0;
+
+          const unsigned int n_interactions = all_pairs ? cached_interaction.interactions.size()
+                                                        : cached_interaction.n_active;
+
+          // Loop over all pairs of atoms, k, in the residue pair.
+          for (unsigned int k = 0; k < n_interactions; k++) {
+
+              // This is the loop where the majority of the time is spent. Feel free to optimize!
+
+              const topology::NonBondedInteraction &interaction = cached_interaction.interactions[k];
+
+              const double r2 = ((interaction.atom1)->position - (interaction.atom2)->position).norm_squared();
+
+              // Pairs beyond the cutoff do not contribute
+              if (this->switching_function.enabled && this->switching_function.is_cut(r2))
+                  continue;
+
+              const double inv_r2 = 1.0 / r2; // convert to nanometers
+              const double inv_r6 = inv_r2 * inv_r2 * inv_r2 * charmm_constants::NM6_TO_ANGS6;
+
+              // Vdw and coulomb energy (using nm and kJ).
+              double pair_energy = (interaction.c12 * inv_r6 - interaction.c6) * inv_r6           // VDW energy
+                                 + interaction.qq * inv_r2 * charmm_constants::TEN_OVER_ONE_POINT_FIVE;   // Coulomb energy
+
+              // Switch vdw and coulomb energy to zero between ctonnb and ctofnb
+              if (this->switching_function.enabled)
+                  pair_energy *= this->switching_function.value(r2);
+
+              energy += pair_energy;
+
+              // If the pair has a contribution to EEF1-SB solvation term
+              if ((interaction.do_eef1) && (r2 < 81.0)) {
+
+                  // From Sandro's code -- this bit is in angstrom and kcal.
+                  const double r_ij = std::sqrt(r2);
+
+                  const double arg_ij = std::fabs((r_ij - interaction.R_vdw_1)/interaction.lambda1);
+                  const double arg_ji = std::fabs((r_ij - interaction.R_vdw_2)/interaction.lambda2);
+
+                  const int bin_ij = int(arg_ij*100);
+                  const int bin_ji = int(arg_ji*100);
+
+                  double exp_ij = 0.0;
+                  double exp_ji = 0.0;
+
+                  if (bin_ij < 350) exp_ij = charmm_constants::EXP_EEF1[bin_ij];
+                  if (bin_ji < 350) exp_ji = charmm_constants::EXP_EEF1[bin_ji];
+
+                  // Add solvation energy (in kcal, so convert to kJ)
+                  energy -= (interaction.fac_12*exp_ij + interaction.fac_21*exp_ji) * inv_r2 * charmm_constants::KCAL_TO_KJ;
+
+              }
+
+          }
+
+          // Energies are summed in kJ, so convert to kcal now.
+          return energy * charmm_constants::KJ_TO_KCAL;
      }
 
 
@@ -280,7 +890,9 @@ public:
      TermCharmmNonBondedCached(ChainFB *chain,
                     const Settings &settings = Settings(),
                     RandomNumberEngine *random_number_engine = &random_global)
-          : EnergyTermCommon(chain, "charmm-non-bonded-cached", settings, random_number_engine) {
+          : EnergyTermCommon(chain, "charmm-non-bonded-cached", settings, random_number_engine),
+            statistics(0),
+            settings(settings) {
 
           this->none_move = false;
           setup_caches();
@@ -295,19 +907,38 @@ public:
      TermCharmmNonBondedCached(const TermCharmmNonBondedCached &other,
                  RandomNumberEngine *random_number_engine,
                  int thread_index, ChainFB *chain)
-          : EnergyTermCommon(other, random_number_engine, thread_index, chain) {
+          : EnergyTermCommon(other, random_number_engine, thread_index, chain),
+            statistics(thread_index),
+            settings(other.settings) {
 
           this->none_move = false;
           setup_caches();
      }
 
 
+     //! Destructor. Prints cache statistics if requested in settings (from the copy in thread 0 only).
+     ~TermCharmmNonBondedCached() {
+
+          // Thread copies each count their own moves, only the main copy reports
+          if (this->settings.print_cache_statistics && this->statistics.thread_index == 0) {
+               print_cache_statistics();
+          }
+     }
+
+
+     //! Print cache statistics collected so far
+     //! \param o Output stream
+     void print_cache_statistics(std::ostream &o=std::cout) const {
+          this->statistics.print(o, "charmm-non-bonded-cached", "residue pairs", "atom pairs", true);
+     }
+
+
      // Big long initialize code from Wouter/Sandro
      void initialize(std::vector<double> &dGref,
                      std::vector< std::vector<double> > &factors,
                      std::vector<double> &vdw_radii,
                      std::vector<double> &lambda,
-                     std::map<std::string, unsigned int> &eef1_atom_type_index_map) {
+                     std::vector<unsigned int> &eef1_atom_type_indexes) {
 
           // Read parameter file
           std::vector<std::string> atoms;
@@ -324,6 +955,7 @@ public:
           std::vector<double> pp;
 
           unsigned int eef1_atom_type_index = 0;
+          eef1_atom_type_indexes.assign(charmm_parameters::N_ATOM_TYPES + 1, 0);
 
           while (getline(f_h,line)) {
 
@@ -341,7 +973,7 @@ public:
 
                          atoms.push_back((*beg).c_str());
 
-                         eef1_atom_type_index_map[(*beg).c_str()] = eef1_atom_type_index;
+                         eef1_atom_type_indexes[charmm_parameters::get_atom_type_id(*beg)] = eef1_atom_type_index;
                          eef1_atom_type_index++;
 
                     } else {
@@ -405,10 +1037,11 @@ public:
 
          // Indexes of first and last residue for which the
          // position of atoms have changed since last move.
-         unsigned int start_index = 0;
-         unsigned int end_index = this->chain->size() - 1;
+         this->start_index = 0;
+         this->end_index = this->chain->size() - 1;
 
          this->none_move = false;
+         clear_stale_residues();
 
          if (move_info) {
 
@@ -417,6 +1050,7 @@ public:
 
                   // Notify accept/reject functions that this was a none_move
                   this->none_move = true;
+                  this->statistics.none_moves++;
 
                   // Return energy.
                   return this->total_energy;
@@ -425,78 +1059,84 @@ public:
              } else {
 
                 // If these are set explicitly by the move, read these here.
-                start_index = move_info->modified_positions_start;
-                end_index = move_info->modified_positions_end - 1;
+                this->start_index = move_info->modified_positions_start;
+                this->end_index = move_info->modified_positions_end - 1;
 
             }
         }
 
-        // Get the indexes of all pairs of residues which must be recomputed
-        this->cache_indexes = get_cache_indexes(start_index, end_index);
+        this->modified_cells.clear();
+        this->modified_blocks.clear();
 
         // Local delta energy required for OpenMP.
         double delta_energy_local = 0.0;
 
-        // Loop over all pairs which must be recomputed
-        // #pragma omp parallel for reduction(+:delta_energy_local) schedule(static)
-        for (unsigned int k = 0; k < this->cache_indexes.size(); k++) {
-
-            // Local index variables for residues i and j.
-            unsigned int i = this->cache_indexes[k][0];
-            unsigned int j = this->cache_indexes[k][1];
+        // Number of atom pairs recomputed (for cache statistics)
+        unsigned long n_atom_pairs = 0;
 
-            // Reset interaction energy of the residue pair ij.
-            this->cached_residue_interactions[i][j].energy_new = 0.0;
+        // Local change in the far-field error bound
+        double delta_far_field_error_bound = 0.0;
 
-            // Loop over all pairs of atoms, k, in the residue pair ij.
-            for (unsigned int k = 0; k < this->cached_residue_interactions[i][j].interactions.size(); k++) {
-
-                // This is the loop where the majority of the time is spent. Feel free to optimize!
-
-                // Make local copy of atom pair k.
-                topology::NonBondedInteraction interaction = this->cached_residue_interactions[i][j].interactions[k];
-
-                const double r2 = ((interaction.atom1)->position - (interaction.atom2)->position).norm_squared();
+        // Update multipole summaries of moved residues
+        if (!this->residue_atoms.empty()) {
+            for (unsigned int i = this->start_index; i < this->end_index + 1; i++) {
+                this->residue_summaries[i] = charmm_far_field::calculate_residue_summary(this->residue_atoms[i]);
+            }
+        }
 
-                const double inv_r2 = 1.0 / r2; // convert to nanometers
-                const double inv_r6 = inv_r2 * inv_r2 * inv_r2 * charmm_constants::NM6_TO_ANGS6;
+        // With a cutoff, find moved residues whose Verlet lists may be incomplete at the new positions.
+        // Their residue pairs are evaluated from all atom pairs, and their lists are only rebuilt if the move is accepted.
+        if (this->pair_list_cutoff > 0.0) {
 
-                // Add vdw and coulomb energy (using nm and kJ).
-                this->cached_residue_interactions[i][j].energy_new += (interaction.c12 * inv_r6 - interaction.c6) * inv_r6                    // VDW energy
-                                                                       + interaction.qq * inv_r2 * charmm_constants::TEN_OVER_ONE_POINT_FIVE;   // Coulomb energy
+            for (unsigned int i = this->start_index; i < this->end_index + 1; i++) {
+                if (this->displacement_tracker.needs_rebuild(i)) {
+                    this->stale_residues.push_back(i);
+                    this->residue_is_stale[i] = true;
+                }
+            }
 
-                // If the pair has a contribution to EEF1-SB solvation term
-                if ((interaction.do_eef1) && (r2 < 81.0)) {
+            if (!this->stale_residues.empty()) {
+                for (unsigned int i = this->start_index; i < this->end_index + 1; i++) {
+                    this->displacement_tracker.current_sphere(i, this->current_centers[i], this->current_radii[i]);
+                }
+            }
+        }
 
-                    // From Sandro's code -- this bit is in angstrom and kcal.
-                    const double r_ij = std::sqrt(r2);
+        // Loop over all residue pairs with a moved residue which must be recomputed
+        for (unsigned int i = this->start_index; i < this->end_index + 1; i++) {
 
-                    const double arg_ij = std::fabs((r_ij - interaction.R_vdw_1)/interaction.lambda1);
-                    const double arg_ji = std::fabs((r_ij - interaction.R_vdw_2)/interaction.lambda2);
+            if (this->residue_is_stale[i]) {
 
-                    const int bin_ij = int(arg_ij*100);
-                    const int bin_ji = int(arg_ji*100);
+                // Pairs of a stale residue are recomputed if they were in range before,
+                // or if the residues may be within the cutoff now
+                find_partner_residues(i, this->current_centers[i], this->current_radii[i] + this->settings.ctofnb, true);
 
-                    double exp_ij = 0.0;
-                    double exp_ji = 0.0;
+                for (unsigned int k = 0; k < this->partner_residues.size(); k++) {
+                    update_cell(i, this->partner_residues[k], delta_energy_local, n_atom_pairs, delta_far_field_error_bound);
+                }
 
-                    if (bin_ij < 350) exp_ij = charmm_constants::EXP_EEF1[bin_ij];
-                    if (bin_ji < 350) exp_ji = charmm_constants::EXP_EEF1[bin_ji];
+            } else {
 
-                    // Add solvation energy (in kcal, so convert to kJ)
-                    this->cached_residue_interactions[i][j].energy_new -= (interaction.fac_12*exp_ij + interaction.fac_21*exp_ji) * inv_r2 * charmm_constants::KCAL_TO_KJ;
+                const std::vector<unsigned int> &neighbours = this->residue_neighbours[i];
 
+                for (unsigned int k = 0; k < neighbours.size(); k++) {
+                    update_cell(i, neighbours[k], delta_energy_local, n_atom_pairs, delta_far_field_error_bound);
                 }
-
             }
+        }
 
-            // Energies are summed in kJ, so convert to kcal now.
-            this->cached_residue_interactions[i][j].energy_new *= charmm_constants::KJ_TO_KCAL;
+        for (unsigned int k = 0; k < this->modified_cells.size(); k++) {
+            this->cached_residue_interactions[this->modified_cells[k]].is_modified = false;
+        }
+
+        // Update block totals
+        for (unsigned int k = 0; k < this->modified_blocks.size(); k++) {
 
-            // Compute delta energy for the residue pair ij (I.e. subtract old, add new)
-            delta_energy_local += this->cached_residue_interactions[i][j].energy_new
-                                - this->cached_residue_interactions[i][j].energy_old;
+            const unsigned int block_cell = this->modified_blocks[k];
 
+            this->cached_block_interactions[block_cell].energy_new = this->cached_block_interactions[block_cell].energy_old
+                                                                   + this->block_delta_energy[block_cell];
+            this->block_is_modified[block_cell] = false;
         }
 
         // Select update scheme for total energy (necessary for precision when the change in energy is large)
@@ -504,48 +1144,188 @@ public:
         // Required accuracy is around 1e-7, so if dE is > 1e6, then do a full summation to be safe.
         if (std::fabs(delta_energy_local) > 1e6) {
 
-            // Get reference solvation energy of system
-            this->total_energy = this->dGref_total;
+            this->statistics.full_resums++;
 
-            // Get the indexes of all pairs of residues which must be recomputed
-            std::vector<std::vector<unsigned int> > all_indexes = get_cache_indexes(0, this->chain->size() - 1);
+            // Resum the modified block totals from their residue pairs
+            for (unsigned int k = 0; k < this->modified_blocks.size(); k++) {
+                resum_block(this->modified_blocks[k]);
+            }
 
-            for (unsigned int k = 0; k < all_indexes.size(); k++) {
+            // Get reference solvation energy of system
+            this->total_energy = this->dGref_total;
 
-                // Local index variables for residues i and j.
-                unsigned int i = all_indexes[k][0];
-                unsigned int j = all_indexes[k][1];
-                this->total_energy += this->cached_residue_interactions[i][j].energy_new;
+            // Sum over all block totals
+            for (unsigned int block1_index = 0; block1_index < this->n_blocks; block1_index++) {
+                for (unsigned int block2_index = 0; block2_index <= block1_index; block2_index++) {
+                    this->total_energy += this->cached_block_interactions[block1_index * this->n_blocks + block2_index].energy_new;
+                }
             }
 
         // If the energy difference is small, then just add the delta energy.
         } else {
 
             // Add delta energy for the move to total energy.
-            this->total_energy += delta_energy_local;
+            this->total_energy = this->total_energy_old + delta_energy_local;
         }
 
+        this->far_field_error_bound = this->far_field_error_bound_old + delta_far_field_error_bound;
+
+        if (this->settings.debug > 0 && !this->residue_atoms.empty()) {
+            printf("  Far-field error     < %15.6f kcal/mol\n", this->far_field_error_bound);
+        }
+
+        this->statistics.add_evaluation(this->modified_cells.size(), n_atom_pairs);
+
         // Return energy.
         return this->total_energy;
 
     }
 
 
+    //! Recompute the energy of a residue pair in the current move (if not already done)
+    //! and register the change in energy with its block pair.
+    //! \param residue1_index Index of first residue (a moved residue)
+    //! \param residue2_index Index of second residue
+    //! \param delta_energy_local Total change in energy in the current move
+    //! \param n_atom_pairs Number of atom pairs recomputed in the current move
+    //! \param delta_far_field_error_bound Total change in the far-field error bound in the current move
+    void update_cell(const unsigned int residue1_index,
+                     const unsigned int residue2_index,
+                     double &delta_energy_local,
+                     unsigned long &n_atom_pairs,
+                     double &delta_far_field_error_bound) {
+
+        const unsigned int cell = cell_index(residue1_index, residue2_index);
+        CachedResidueInteraction &cached_interaction = this->cached_residue_interactions[cell];
+        CachedFarFieldInteraction *far_field_interaction = get_far_field_interaction(cell);
+
+        // Pairs with both residues in the moved region are visited twice, count them once.
+        if (cached_interaction.interactions.empty() || cached_interaction.is_modified)
+            return;
+
+        // The Verlet list cannot be used if one of the residues is stale
+        const bool all_pairs = this->residue_is_stale[residue1_index] || this->residue_is_stale[residue2_index];
+
+        if (all_pairs && !residues_may_interact(residue1_index, residue2_index)) {
+
+            // All atom pairs are beyond the cutoff. Nothing changes unless the pair was in range before.
+            if (cached_interaction.energy_old == 0.0 && (!far_field_interaction || far_field_interaction->error_bound_old == 0.0))
+                return;
+
+            cached_interaction.energy_new = 0.0;
+            if (far_field_interaction) {
+                far_field_interaction->is_far_field = false;
+                far_field_interaction->error_bound_new = 0.0;
+            }
+
+        } else {
+
+            cached_interaction.energy_new = calculate_cell_energy(residue1_index, residue2_index, cached_interaction,
+                                                                  far_field_interaction, all_pairs);
+
+            if (!far_field_interaction || !far_field_interaction->is_far_field)
+                n_atom_pairs += all_pairs ? cached_interaction.interactions.size() : cached_interaction.n_active;
+        }
+
+        cached_interaction.is_modified = true;
+
+        if (far_field_interaction) {
+            delta_far_field_error_bound += far_field_interaction->error_bound_new - far_field_interaction->error_bound_old;
+        }
+
+        // Compute delta energy for the residue pair ij (I.e. subtract old, add new)
+        const double delta_energy = cached_interaction.energy_new - cached_interaction.energy_old;
+
+        this->modified_cells.push_back(cell);
+
+        // Accumulate delta energy in the block pair containing residue pair ij
+        const unsigned int block_cell = block_cell_index(residue1_index, residue2_index);
+        if (!this->block_is_modified[block_cell]) {
+            this->block_is_modified[block_cell] = true;
+            this->block_delta_energy[block_cell] = 0.0;
+            this->modified_blocks.push_back(block_cell);
+        }
+        this->block_delta_energy[block_cell] += delta_energy;
+
+        delta_energy_local += delta_energy;
+    }
+
+
+    //! Forget stale residues of the previous move
+    void clear_stale_residues() {
+
+        for (unsigned int k = 0; k < this->stale_residues.size(); k++) {
+            this->residue_is_stale[this->stale_residues[k]] = false;
+        }
+        this->stale_residues.clear();
+    }
+
+
+    //! Recompute the total of a block pair from its residue pairs
+    //! \param block_cell Index of the block pair in cached_block_interactions
+    void resum_block(const unsigned int block_cell) {
+
+        const unsigned int n_residues = this->chain->size();
+
+        const unsigned int block1_index = block_cell / this->n_blocks;
+        const unsigned int block2_index = block_cell % this->n_blocks;
+
+        const unsigned int residue1_end = std::min((block1_index + 1) * this->block_size, n_residues);
+        const unsigned int residue2_end = std::min((block2_index + 1) * this->block_size, n_residues);
+
+        double energy = 0.0;
+        for (unsigned int i = block1_index * this->block_size; i < residue1_end; i++) {
+            for (unsigned int j = block2_index * this->block_size; j < std::min(residue2_end, i + 1); j++) {
+                energy += this->cached_residue_interactions[i * n_residues + j].energy_new;
+            }
+        }
+
+        this->cached_block_interactions[block_cell].energy_new = energy;
+    }
+
+
     //! Accept move and backup energies
     void accept() {
 
         if (this->none_move == false) {
 
+            this->statistics.accepts++;
+
             // If move is accepted, backup energies in all pairs that were recomputed
-            for (unsigned int k = 0; k < this->cache_indexes.size(); k++) {
-                unsigned int i = this->cache_indexes[k][0];
-                unsigned int j = this->cache_indexes[k][1];
-                this->cached_residue_interactions[i][j].energy_old = this->cached_residue_interactions[i][j].energy_new;
+            for (unsigned int k = 0; k < this->modified_cells.size(); k++) {
+                CachedResidueInteraction &cached_interaction = this->cached_residue_interactions[this->modified_cells[k]];
+                cached_interaction.energy_old = cached_interaction.energy_new;
+            }
+
+            // ... and the far-field error bounds and summaries of moved residues
+            if (!this->residue_atoms.empty()) {
+                for (unsigned int k = 0; k < this->modified_cells.size(); k++) {
+                    CachedFarFieldInteraction &far_field_interaction = this->cached_far_field_interactions[this->modified_cells[k]];
+                    far_field_interaction.error_bound_old = far_field_interaction.error_bound_new;
+                }
+                for (unsigned int i = this->start_index; i < this->end_index + 1; i++) {
+                    this->residue_summaries_old[i] = this->residue_summaries[i];
+                }
+            }
+
+            // ... and in all block pairs that were updated
+            for (unsigned int k = 0; k < this->modified_blocks.size(); k++) {
+                CachedBlockInteraction &cached_block_interaction = this->cached_block_interactions[this->modified_blocks[k]];
+                cached_block_interaction.energy_old = cached_block_interaction.energy_new;
             }
 
             //Backup total energy
             this->total_energy_old = this->total_energy;
+            this->far_field_error_bound_old = this->far_field_error_bound;
+
+            // ... and rebuild Verlet lists of residues that have moved too far
+            for (unsigned int k = 0; k < this->stale_residues.size(); k++) {
+                rebuild_verlet_lists(this->stale_residues[k]);
+            }
+            this->statistics.pair_list_rebuilds += this->stale_residues.size();
         }
+
+        clear_stale_residues();
     }
 
 
@@ -554,16 +1334,38 @@ public:
 
         if (this->none_move == false) {
 
-            // If move is accepted, restore energies in all pairs that were recomputed
-            for (unsigned int k = 0; k < this->cache_indexes.size(); k++) {
-                unsigned int i = this->cache_indexes[k][0];
-                unsigned int j = this->cache_indexes[k][1];
-                this->cached_residue_interactions[i][j].energy_new = this->cached_residue_interactions[i][j].energy_old;
+            this->statistics.rejects++;
+
+            // If move is rejected, restore energies in all pairs that were recomputed
+            for (unsigned int k = 0; k < this->modified_cells.size(); k++) {
+                CachedResidueInteraction &cached_interaction = this->cached_residue_interactions[this->modified_cells[k]];
+                cached_interaction.energy_new = cached_interaction.energy_old;
+            }
+
+            // ... and the far-field error bounds and summaries of moved residues
+            if (!this->residue_atoms.empty()) {
+                for (unsigned int k = 0; k < this->modified_cells.size(); k++) {
+                    CachedFarFieldInteraction &far_field_interaction = this->cached_far_field_interactions[this->modified_cells[k]];
+                    far_field_interaction.error_bound_new = far_field_interaction.error_bound_old;
+                }
+                for (unsigned int i = this->start_index; i < this->end_index + 1; i++) {
+                    this->residue_summaries[i] = this->residue_summaries_old[i];
+                }
+            }
+
+            // ... and in all block pairs that were updated
+            for (unsigned int k = 0; k < this->modified_blocks.size(); k++) {
+                CachedBlockInteraction &cached_block_interaction = this->cached_block_interactions[this->modified_blocks[k]];
+                cached_block_interaction.energy_new = cached_block_interaction.energy_old;
             }
 
             // Restore total energy
             this->total_energy = this->total_energy_old;
+            this->far_field_error_bound = this->far_field_error_bound_old;
         }
+
+        // Verlet lists are never rebuilt for rejected moves
+        clear_stale_residues();
     }
 
 
@@ -25,7 +25,9 @@
 #include <boost/type_traits/is_base_of.hpp>
 #include "energy/energy_term.h"
 #include "parsers/topology_parser.h"
-#include "parameters/torsion_itp.h"
+#include "parameters/torsion_parameters.h"
+#include "parallel_sum.h"
+#include "bonded_kernels.h"
 
 namespace phaistos {
 
@@ -37,12 +39,63 @@ private:
      //! For convenience, define local EnergyTermCommon
      typedef phaistos::EnergyTermCommon<TermCharmmTorsion, ChainFB> EnergyTermCommon;
 
-     std::vector<topology::TorsionInteraction> torsion_interactions;
+     //! Torsions computed from atom positions
+     charmm_bonded::TorsionList torsion_interactions;
+
+     //! Torsions that correspond to degrees of freedom of the chain
+     charmm_bonded::TorsionList dof_torsion_interactions;
+
+     //! Torsional degrees of freedom of the chain
+     charmm_bonded::DegreesOfFreedom degrees_of_freedom;
+
+     //! Whether the torsions in dof_torsion_interactions are read from the
+     //! degrees of freedom in the current evaluation
+     bool use_degrees_of_freedom;
+
+     //! Whether the offsets between torsions and degrees of freedom have to be
+     //! updated if the current move is accepted
+     bool offsets_outdated;
+
+     //! Bond geometry of the chain when the offsets were last updated
+     //! (only used if read_degrees_of_freedom is set)
+     charmm_bonded::BondGeometry bond_geometry;
+
+     //! Topology images of the interaction lists (keeps the images that were read mapped)
+     topology::TopologyImageDirectory topology_images;
 
 public:
 
-     //! Use same settings as base class
-     typedef EnergyTerm<ChainFB>::SettingsClassicEnergy Settings;
+     //! Local settings class.
+     const class Settings: public EnergyTerm<ChainFB>::SettingsClassicEnergy {
+     public:
+
+          //! Number of threads used in evaluation (0: all available)
+          int threads;
+
+          //! Whether to read torsions from the degrees of freedom of the chain in moves
+          //! that leave the bond geometry unchanged
+          bool read_degrees_of_freedom;
+
+          //! Directory of topology images ("": interactions are always generated)
+          std::string topology_image_dir;
+
+          //! Constructor
+          Settings(int threads=1,
+                   bool read_degrees_of_freedom=false,
+                   std::string topology_image_dir="")
+               : threads(threads),
+                 read_degrees_of_freedom(read_degrees_of_freedom),
+                 topology_image_dir(topology_image_dir) {}
+
+          //! Output operator
+          friend std::ostream &operator<<(std::ostream &o, const Settings &settings) {
+               o << "threads:" << settings.threads << "\n";
+               o << "read-degrees-of-freedom:" << settings.read_degrees_of_freedom << "\n";
+               o << "topology-image-dir:" << settings.topology_image_dir << "\n";
+               o << static_cast<const EnergyTerm<ChainFB>::Settings>(settings);
+               return o;
+          }
+     } settings;    //!< Local settings object
 
      //! Constructor.
      //! \param chain Molecule chain
@@ -51,13 +104,10 @@ public:
      TermCharmmTorsion(ChainFB *chain,
                         const Settings &settings=Settings(),
                         RandomNumberEngine *random_number_engine = &random_global)
-          : EnergyTermCommon(chain, "charmm-torsion", settings, random_number_engine) {
+          : EnergyTermCommon(chain, "charmm-torsion", settings, random_number_engine),
+            settings(settings) {
 
-          std::vector<topology::TorsionParameter> torsion_parameters 
-                    = topology::read_torsion_parameters(charmm_constants::torsion_itp);
-
-          this->torsion_interactions
-                    = topology::generate_torsion_interactions(this->chain, torsion_parameters);
+          setup_interactions();
 
      }
 
@@ -70,53 +120,168 @@ public:
      TermCharmmTorsion(const TermCharmmTorsion &other,
                         RandomNumberEngine *random_number_engine,
                         int thread_index, ChainFB *chain)
-          : EnergyTermCommon(other, random_number_engine, thread_index, chain) {
+          : EnergyTermCommon(other, random_number_engine, thread_index, chain),
+            settings(other.settings) {
+
+          setup_interactions();
+
+     }
+
+
+     //! Generate the torsions (or read them from their topology image) and split them
+     //! into those that correspond to degrees of freedom of the chain and those that do not
+     void setup_interactions() {
+
+          std::vector<topology::TorsionInteraction> torsion_interactions;
+
+          // Bond graph and atom types, shared by the generator and the bond geometry (built when first needed)
+          topology::ChainTopology chain_topology(this->chain);
+
+          this->topology_images = topology::TopologyImageDirectory(this->chain, this->settings.topology_image_dir);
+          if (!this->topology_images.read("torsion", torsion_interactions)) {
 
-          std::vector<topology::TorsionParameter> torsion_parameters 
-                    = topology::read_torsion_parameters(charmm_constants::torsion_itp);
+               std::vector<topology::TorsionParameter> torsion_parameters 
+                         = topology::get_torsion_parameters();
 
-          this->torsion_interactions
-                    = topology::generate_torsion_interactions(this->chain, torsion_parameters);
+               torsion_interactions = topology::generate_torsion_interactions(chain_topology, torsion_parameters,
+                                                                              this->settings.threads);
+               this->topology_images.write("torsion", torsion_interactions);
+          }
 
+          for (unsigned int i = 0; i < torsion_interactions.size(); i++) {
+
+               if (torsion_interactions[i].dof_type == topology::DOF_NONE) {
+                    this->torsion_interactions.add(torsion_interactions[i]);
+               } else {
+                    this->dof_torsion_interactions.add(torsion_interactions[i]);
+               }
+          }
+
+          this->degrees_of_freedom.resize(this->chain->size());
+          this->dof_torsion_interactions.use_degrees_of_freedom(this->degrees_of_freedom);
+          if (this->settings.read_degrees_of_freedom) {
+               this->bond_geometry = charmm_bonded::BondGeometry(chain_topology.get_bond_graph());
+          }
+          update_offsets();
+
+          this->use_degrees_of_freedom = false;
      }
 
+     //! Update the offsets between torsions and degrees of freedom (and the
+     //! reference bond geometry) from the current atom positions
+     void update_offsets() {
 
-     //! Evaluate chain energy
-     //! \param move_info object containing information about last move
-     //! \return torsional potential energy of the chain in the object
-     double evaluate(MoveInfo *move_info=NULL) {
+          this->degrees_of_freedom.update(this->chain, 0, this->chain->size() - 1);
+          this->dof_torsion_interactions.update_offsets(this->degrees_of_freedom);
+          if (this->settings.read_degrees_of_freedom) {
+               this->bond_geometry.update(0, this->chain->size() - 1);
+          }
+          this->offsets_outdated = false;
+     }
 
+     //! Whether a move left the bond geometry of the chain unchanged, so that the
+     //! offsets between torsions and degrees of freedom are still valid. Only the
+     //! moved residues (and their neighbours) are checked.
+     //! \param move_info Object containing information about the move
+     bool is_bond_geometry_unchanged(const MoveInfo *move_info) const {
 
-        double energy_torsion = 0.0;
+          if (!move_info)
+               return false;
 
-        for (unsigned int i = 0; i < this->torsion_interactions.size(); i++) {
+          // None-move
+          if (move_info->modified_angles.empty())
+               return true;
 
-            topology::TorsionInteraction interaction = this->torsion_interactions[i];
+          return this->bond_geometry.is_unchanged(std::max(0, move_info->modified_positions_start - 1),
+                                                  std::min(move_info->modified_positions_end + 1, this->chain->size() - 1));
+     }
 
-            double phi = calc_dihedral((interaction.atom1)->position,
-                                         (interaction.atom2)->position,
-                                         (interaction.atom3)->position,
-                                         (interaction.atom4)->position);
+     //! Sum the energies of a range of torsions computed from atom positions
+     //! \param begin Index of first torsion
+     //! \param end Index after last torsion
+     //! \param energies Sum of energies (index 0) in kJ/mol
+     void calculate_energy_range(const unsigned int begin, const unsigned int end, double *energies) const {
 
-            const double energy_torsion_temp =  interaction.cp + 
-                    interaction.cp * std::cos(interaction.mult * phi - interaction.phi0 * charmm_constants::DEG_TO_RAD);
+        this->torsion_interactions.add_energies(begin, end, energies);
+     }
 
-            energy_torsion += energy_torsion_temp;
-             if (this->settings.debug > 1) {
+     //! Sum the energies of a range of torsions that correspond to degrees of freedom
+     //! \param begin Index of first torsion
+     //! \param end Index after last torsion
+     //! \param energies Sum of energies (index 0) in kJ/mol
+     void calculate_dof_energy_range(const unsigned int begin, const unsigned int end, double *energies) const {
 
-                std::cout << "# CHARMM torsion:" 
+        this->dof_torsion_interactions.add_energies(begin, end, energies,
+                                                    this->use_degrees_of_freedom ? &this->degrees_of_freedom : NULL);
+     }
+
+     //! Print the energy of each torsion (summed over multiplicities)
+     void print_interactions() const {
+
+        print_interactions(this->torsion_interactions);
+        print_interactions(this->dof_torsion_interactions);
+     }
 
-                          << " a1: " << interaction.atom1
-                          << " a2: " << interaction.atom2
-                          << " a3: " << interaction.atom3
-                          << " a4: " << interaction.atom4
+     //! Print the energy of each torsion in a list (summed over multiplicities)
+     //! \param torsions Torsion list
+     void print_interactions(const charmm_bonded::TorsionList &torsions) const {
+
+        double cos_phi[charmm_bonded::BLOCK_SIZE];
+        double sin_phi[charmm_bonded::BLOCK_SIZE];
+        double energy_torsion_temp[charmm_bonded::BLOCK_SIZE];
+
+        for (unsigned int block = 0; block < torsions.size(); block += charmm_bonded::BLOCK_SIZE) {
+
+            const unsigned int n = std::min(charmm_bonded::BLOCK_SIZE, torsions.size() - block);
+            torsions.evaluate_block(block, n, cos_phi, sin_phi, energy_torsion_temp);
+
+            for (unsigned int i = 0; i < n; i++) {
+
+                const double phi = std::atan2(sin_phi[i], cos_phi[i]);
+
+                std::cout << "# CHARMM torsion:"
+
+                          << " a1: " << torsions.atom1[block + i]
+                          << " a2: " << torsions.atom2[block + i]
+                          << " a3: " << torsions.atom3[block + i]
+                          << " a4: " << torsions.atom4[block + i]
 
                           << " angle: " << phi * charmm_constants::RAD_TO_DEG
-                          << " e_torsion: " <<  energy_torsion_temp
+                          << " e_torsion: " <<  energy_torsion_temp[i]
 
                           << std::endl;
-             }
+            }
+        }
+     }
+
+
+     //! Evaluate chain energy
+     //! \param move_info object containing information about last move
+     //! \return torsional potential energy of the chain in the object
+     double evaluate(MoveInfo *move_info=NULL) {
+
+        // If the move only changed dihedrals (as pivot and side chain moves do), the
+        // offsets between torsions and degrees of freedom are unchanged
+        this->use_degrees_of_freedom = this->settings.read_degrees_of_freedom && is_bond_geometry_unchanged(move_info);
+
+        if (this->use_degrees_of_freedom) {
+            this->degrees_of_freedom.update(this->chain, 0, this->chain->size() - 1);
+        } else {
+            this->offsets_outdated = true;
+        }
+
+        double energies[1];
+        charmm_parallel::chunked_sum(*this, &TermCharmmTorsion::calculate_energy_range,
+                                     this->torsion_interactions.size(), 1, this->settings.threads, energies);
+
+        double dof_energies[1];
+        charmm_parallel::chunked_sum(*this, &TermCharmmTorsion::calculate_dof_energy_range,
+                                     this->dof_torsion_interactions.size(), 1, this->settings.threads, dof_energies);
+
+        const double energy_torsion = energies[0] + dof_energies[0];
 
+        if (this->settings.debug > 1) {
+            print_interactions();
         }
 
         if (this->settings.debug > 0) {
@@ -128,6 +293,21 @@ public:
 
      }
 
+     //! Accept last energy evaluation
+     void accept() {
+
+        // Bond geometry may have changed, so update the offsets of the torsions
+        if (this->offsets_outdated) {
+            update_offsets();
+        }
+     }
+
+     //! Reject last energy evaluation
+     void reject() {
+
+        this->offsets_outdated = false;
+     }
+
 };
 
 }
@@ -27,9 +27,13 @@
 #include "energy/energy_term.h"
 
 #include "parsers/topology_parser.h"
+#include "spatial_ordering.h"
+#include "switching.h"
+#include "neighbour_list.h"
+#include "parallel_sum.h"
 
-#include "parameters/vdw14_itp.h"
-#include "parameters/vdw_itp.h"
+#include "parameters/vdw14_parameters.h"
+#include "parameters/vdw_parameters.h"
 
 namespace phaistos {
 
@@ -42,10 +46,90 @@ protected:
      //! For convenience, define local EnergyTermCommon
      typedef phaistos::EnergyTermCommon<TermCharmmVdw, ChainFB> EnergyTermCommon;
 
+     //! Contiguous copy of atom coordinates used in the pair loop
+     charmm_spatial::CoordinateBuffer coordinate_buffer;
+
+     //! Number of evaluations since the coordinate buffer was last reordered
+     int evaluations_since_reorder;
+
+     //! Switching function used with a non-bonded cutoff
+     charmm_switching::SwitchingFunction switching_function;
+
+     //! Van der Waals parameters (kept for rebuilding the pair list)
+     std::vector<topology::NonBondedParameter> non_bonded_parameters;
+
+     //! Van der Waals 1-4 parameters (kept for rebuilding the pair list)
+     std::vector<topology::NonBonded14Parameter> non_bonded_14_parameters;
+
+     //! Bond graph and atom types of the chain (kept for rebuilding the pair list)
+     topology::ChainTopology chain_topology;
+
+     //! Topology images of the interaction lists (keeps the images that were read mapped)
+     topology::TopologyImageDirectory topology_images;
+
+     //! Distance within which atom pairs are kept in the pair list (0: all pairs)
+     double pair_list_cutoff;
+
+     //! Atom displacements since the pair list was built
+     charmm_neighbour_list::DisplacementTracker displacement_tracker;
+
+     //! Pair list built for the positions of the latest evaluation, if the current list
+     //! was not valid for them. It replaces the current list if the move is accepted.
+     std::vector<topology::NonBondedInteraction> pending_interactions;
+
+     //! Whether pending_interactions was used in the latest evaluation
+     bool has_pending_pair_list;
+
 public:
 
-     //! Use same settings as base class
-     typedef EnergyTerm<ChainFB>::SettingsClassicEnergy Settings;
+     //! Local settings class
+     const class Settings: public EnergyTerm<ChainFB>::SettingsClassicEnergy {
+     public:
+
+          //! Number of evaluations between reorderings of the coordinate buffer along a Morton curve (0: never)
+          int spatial_reorder_interval;
+
+          //! Distance where switching of the energy starts (Angstrom)
+          double ctonnb;
+
+          //! Distance beyond which atom pairs do not contribute (Angstrom, 0: no cutoff)
+          double ctofnb;
+
+          //! Distance within which atom pairs are kept in the pair list (Angstrom, 0: ctofnb + 2)
+          double cutnb;
+
+          //! Number of threads used in evaluation (0: all available)
+          int threads;
+
+          //! Directory of topology images, used if there is no cutoff ("": interactions are always generated)
+          std::string topology_image_dir;
+
+          //! Constructor
+          Settings(int spatial_reorder_interval=1000,
+                   double ctonnb=0.0,
+                   double ctofnb=0.0,
+                   double cutnb=0.0,
+                   int threads=1,
+                   std::string topology_image_dir="")
+               : spatial_reorder_interval(spatial_reorder_interval),
+                 ctonnb(ctonnb),
+                 ctofnb(ctofnb),
+                 cutnb(cutnb),
+                 threads(threads),
+                 topology_image_dir(topology_image_dir) {}
+
+          //! Output operator
+          friend std::ostream &operator<<(std::ostream &o, const Settings &settings) {
+               o << "spatial-reorder-interval:" << settings.spatial_reorder_interval << "\n";
+               o << "ctonnb:" << settings.ctonnb << "\n";
+               o << "ctofnb:" << settings.ctofnb << "\n";
+               o << "cutnb:" << settings.cutnb << "\n";
+               o << "threads:" << settings.threads << "\n";
+               o << "topology-image-dir:" << settings.topology_image_dir << "\n";
+               o << static_cast<const EnergyTerm<ChainFB>::Settings>(settings);
+               return o;
+          }
+     } settings;    //!< Local settings object
 
      std::vector<topology::NonBondedInteraction> non_bonded_interactions;
 
@@ -56,18 +140,18 @@ public:
      TermCharmmVdw(ChainFB *chain,
                     const Settings &settings = Settings(),
                     RandomNumberEngine *random_number_engine = &random_global)
-          : EnergyTermCommon(chain, "charmm-vdw", settings, random_number_engine) {
+          : EnergyTermCommon(chain, "charmm-vdw", settings, random_number_engine),
+            settings(settings) {
 
-              std::vector<topology::NonBondedParameter> non_bonded_parameters
-                  = topology::read_nonbonded_parameters(charmm_constants::vdw_itp);
+              this->non_bonded_parameters = topology::get_nonbonded_parameters();
+              this->non_bonded_14_parameters = topology::get_nonbonded_14_parameters();
+              this->chain_topology = topology::ChainTopology(this->chain);
 
-              std::vector<topology::NonBonded14Parameter> non_bonded_14_parameters =
-                  topology::read_nonbonded_14_parameters(charmm_constants::vdw14_itp);
+              this->switching_function = charmm_switching::SwitchingFunction(this->settings.ctonnb, this->settings.ctofnb);
+              this->pair_list_cutoff = charmm_neighbour_list::pair_list_cutoff(this->settings.ctofnb, this->settings.cutnb);
+              this->has_pending_pair_list = false;
 
-              this->non_bonded_interactions = 
-                  topology::generate_non_bonded_interactions(this->chain,
-                                                             non_bonded_parameters,
-                                                             non_bonded_14_parameters);
+              setup_interactions();
      }
 
      //! Copy constructor.
@@ -78,79 +162,207 @@ public:
      TermCharmmVdw(const TermCharmmVdw &other,
                  RandomNumberEngine *random_number_engine,
                  int thread_index, ChainFB *chain)
-          : EnergyTermCommon(other, random_number_engine, thread_index, chain) {
+          : EnergyTermCommon(other, random_number_engine, thread_index, chain),
+            settings(other.settings) {
 
 
-              std::vector<topology::NonBondedParameter> non_bonded_parameters
-                  = topology::read_nonbonded_parameters(charmm_constants::vdw_itp);
+              this->non_bonded_parameters = topology::get_nonbonded_parameters();
+              this->non_bonded_14_parameters = topology::get_nonbonded_14_parameters();
+              this->chain_topology = topology::ChainTopology(this->chain);
 
-              std::vector<topology::NonBonded14Parameter> non_bonded_14_parameters =
-                  topology::read_nonbonded_14_parameters(charmm_constants::vdw14_itp);
+              this->switching_function = charmm_switching::SwitchingFunction(this->settings.ctonnb, this->settings.ctofnb);
+              this->pair_list_cutoff = charmm_neighbour_list::pair_list_cutoff(this->settings.ctofnb, this->settings.cutnb);
+              this->has_pending_pair_list = false;
 
-              this->non_bonded_interactions = 
-                  topology::generate_non_bonded_interactions(this->chain,
-                                                             non_bonded_parameters,
-                                                             non_bonded_14_parameters);
+              setup_interactions();
      }
 
 
 
-     //! Evaluate chain energy
-     //! \param move_info object containing information about last move
-     //! \return vdw potential energy of the chain in the object
-     double evaluate(MoveInfo *move_info=NULL) {
+     //! Generate the interactions (within the pair list cutoff, if any) and set up the coordinate buffer
+     void setup_interactions() {
 
-          double vdw_energy = 0.0;
-          double vdw14_energy = 0.0;
+          // A list within a cutoff depends on the atom positions, so only the list of all pairs has an image
+          this->topology_images = topology::TopologyImageDirectory(this->chain,
+                                                                   (this->pair_list_cutoff > 0.0) ? std::string()
+                                                                                                  : this->settings.topology_image_dir);
+          if (!this->topology_images.read("non-bonded", this->non_bonded_interactions)) {
 
-          for (unsigned int i = 0; i < this->non_bonded_interactions.size(); i++) {
+               this->non_bonded_interactions =
+                   topology::generate_non_bonded_interactions(this->chain_topology,
+                                                              this->non_bonded_parameters,
+                                                              this->non_bonded_14_parameters,
+                                                              this->pair_list_cutoff,
+                                                              this->settings.threads);
+               this->topology_images.write("non-bonded", this->non_bonded_interactions);
+          }
 
-              topology::NonBondedInteraction interaction = this->non_bonded_interactions[i];
+          setup_pair_list();
+     }
 
-               const double r2 = ((interaction.atom1)->position - (interaction.atom2)->position).norm_squared();
-               const double inv_r2 = charmm_constants::NM2_TO_ANGS2 / r2;
-               const double inv_r6 = inv_r2 * inv_r2 * inv_r2;
-               const double inv_r12 = inv_r6 * inv_r6;
-               const double vdw_energy_temp = interaction.c12 * inv_r12 - interaction.c6 * inv_r6;
+     //! Set up the coordinate buffer and displacement tracking for the current interactions
+     void setup_pair_list() {
 
-               if (interaction.is_14_interaction) {
+          setup_coordinate_buffer();
+
+          if (this->pair_list_cutoff > 0.0) {
+               this->displacement_tracker = charmm_neighbour_list::DisplacementTracker(this->chain,
+                                                                                       this->pair_list_cutoff - this->settings.ctofnb);
+          }
+     }
+
+     //! Set up the coordinate buffer and the buffer indexes of all interactions
+     void setup_coordinate_buffer() {
+
+          this->coordinate_buffer = charmm_spatial::CoordinateBuffer(this->chain);
+          this->coordinate_buffer.assign_indexes(this->non_bonded_interactions);
+          this->evaluations_since_reorder = 0;
+
+          if (this->settings.spatial_reorder_interval > 0) {
+               charmm_spatial::reorder_interactions(this->coordinate_buffer, this->non_bonded_interactions);
+          }
+     }
+
+     //! Refresh the coordinate buffer, and periodically reorder it and the interactions
+     void update_coordinate_buffer() {
+
+          if ((this->settings.spatial_reorder_interval > 0) &&
+              (this->evaluations_since_reorder >= this->settings.spatial_reorder_interval)) {
+
+               charmm_spatial::reorder_interactions(this->coordinate_buffer, this->non_bonded_interactions);
+               this->evaluations_since_reorder = 0;
+
+          } else {
+               this->coordinate_buffer.update();
+          }
+
+          this->evaluations_since_reorder++;
+     }
+
+
+     //! Interactions used in the current evaluation
+     //! \return The pending pair list if one was built for the latest move, otherwise the current pair list
+     const std::vector<topology::NonBondedInteraction> &evaluated_interactions() const {
+
+          if (this->has_pending_pair_list)
+               return this->pending_interactions;
+
+          return this->non_bonded_interactions;
+     }
+
+     //! Calculate the energy of a single atom pair
+     //! \param interaction Atom pair
+     //! \param r2 Squared distance between the atoms (output)
+     //! \return van der Waals energy in kJ/mol (zero beyond the cutoff)
+     double calculate_interaction_energy(const topology::NonBondedInteraction &interaction, double &r2) const {
+
+          r2 = (this->coordinate_buffer.positions[interaction.index1]
+              - this->coordinate_buffer.positions[interaction.index2]).norm_squared();
+
+          // Pairs beyond the cutoff do not contribute
+          if (this->switching_function.enabled && this->switching_function.is_cut(r2))
+               return 0.0;
+
+          const double inv_r2 = charmm_constants::NM2_TO_ANGS2 / r2;
+          const double inv_r6 = inv_r2 * inv_r2 * inv_r2;
+          const double inv_r12 = inv_r6 * inv_r6;
+          double vdw_energy_temp = interaction.c12 * inv_r12 - interaction.c6 * inv_r6;
+
+          // Switch energy to zero between ctonnb and ctofnb (CHARMM vswitch)
+          if (this->switching_function.enabled)
+               vdw_energy_temp *= this->switching_function.value(r2);
+
+          return vdw_energy_temp;
+     }
+
+     //! Sum the energies of a range of interactions
+     //! \param begin Index of first interaction
+     //! \param end Index after last interaction
+     //! \param energies Sums of 1-4 energies (index 0) and regular energies (index 1) in kJ/mol
+     void calculate_energy_range(const unsigned int begin, const unsigned int end, double *energies) const {
+
+          const std::vector<topology::NonBondedInteraction> &interactions = evaluated_interactions();
 
-                    vdw14_energy += vdw_energy_temp;
+          for (unsigned int i = begin; i < end; i++) {
 
-                    if (this->settings.debug > 1) {
+               double r2;
+               const double vdw_energy_temp = calculate_interaction_energy(interactions[i], r2);
 
-                       std::cout << "# CHARMM vdw-14:";
-                  
-                    }
- 
+               if (interactions[i].is_14_interaction) {
+                    energies[0] += vdw_energy_temp;
                } else {
- 
-                   vdw_energy += vdw_energy_temp;
+                    energies[1] += vdw_energy_temp;
+               }
+          }
+     }
+
+     //! Print the energy of each atom pair within the cutoff
+     void print_interactions() const {
+
+          const std::vector<topology::NonBondedInteraction> &interactions = evaluated_interactions();
 
-                    if (this->settings.debug > 1) {
+          for (unsigned int i = 0; i < interactions.size(); i++) {
 
-                       std::cout << "# CHARMM vdw:";
-                  
-                    }
+               const topology::NonBondedInteraction &interaction = interactions[i];
+
+               double r2;
+               const double vdw_energy_temp = calculate_interaction_energy(interaction, r2);
+
+               if (this->switching_function.enabled && this->switching_function.is_cut(r2))
+                    continue;
+
+               if (interaction.is_14_interaction) {
+                    std::cout << "# CHARMM vdw-14:";
+               } else {
+                    std::cout << "# CHARMM vdw:";
                }
 
-               if (this->settings.debug > 1) {
+               std::cout << " a1: " << interaction.atom1
+                         << " a2: " << interaction.atom2
+
+                         << " c6: " <<  interaction.c6
+                         << " c12: " <<  interaction.c12
+
+                         << " r: " << std::sqrt(r2)
 
-                       std::cout << " a1: " << interaction.atom1
-                                 << " a2: " << interaction.atom2
+                         << " e_vdw: " << vdw_energy_temp
 
-                                 << " c6: " <<  interaction.c6
-                                 << " c12: " <<  interaction.c12
+                         << std::endl;
+          }
+     }
 
-                                 << " r: " << std::sqrt(r2)
 
-                                 << " e_vdw: " << vdw_energy_temp
+     //! Evaluate chain energy
+     //! \param move_info object containing information about last move
+     //! \return vdw potential energy of the chain in the object
+     double evaluate(MoveInfo *move_info=NULL) {
 
-                                 << std::endl;
-                }
+          update_coordinate_buffer();
+
+          // If atoms may have moved into the cutoff from outside the pair list, evaluate with a new
+          // list. It only replaces the current list if the move is accepted (see accept()).
+          this->has_pending_pair_list = false;
+          if ((this->pair_list_cutoff > 0.0) && this->displacement_tracker.needs_rebuild()) {
+
+               this->pending_interactions =
+                   topology::generate_non_bonded_interactions(this->chain_topology,
+                                                              this->non_bonded_parameters,
+                                                              this->non_bonded_14_parameters,
+                                                              this->pair_list_cutoff,
+                                                              this->settings.threads);
+               this->coordinate_buffer.assign_indexes(this->pending_interactions);
+               this->has_pending_pair_list = true;
+          }
 
+          double energies[2];
+          charmm_parallel::chunked_sum(*this, &TermCharmmVdw::calculate_energy_range,
+                                       evaluated_interactions().size(), 2, this->settings.threads, energies);
 
+          const double vdw14_energy = energies[0];
+          const double vdw_energy = energies[1];
 
+          if (this->settings.debug > 1) {
+               print_interactions();
           }
 
           const double total_energy = (vdw14_energy + vdw_energy) * charmm_constants::KJ_TO_KCAL;
@@ -167,6 +379,27 @@ public:
           return total_energy;
 
      }
+
+     //! Accept move. Replaces the pair list if a new one was needed for the move.
+     void accept() {
+
+          if (this->has_pending_pair_list) {
+               this->non_bonded_interactions.swap(this->pending_interactions);
+               this->pending_interactions.clear();
+               this->has_pending_pair_list = false;
+
+               setup_pair_list();
+          }
+     }
+
+     //! Reject move. A pair list built for the move is discarded.
+     void reject() {
+
+          if (this->has_pending_pair_list) {
+               this->pending_interactions.clear();
+               this->has_pending_pair_list = false;
+          }
+     }
 };
 
 }
@@ -0,0 +1,303 @@
+// test_cached_moves.cpp --- Test of the CHARMM36/EEF1-SB terms that reuse energies between moves
+// Copyright (C) 2026 agent
+//
+// This file is part of PHAISTOS
+//
+// PHAISTOS is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// PHAISTOS is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with PHAISTOS.  If not, see <http://www.gnu.org/licenses/>.
+
+// Applies a sequence of backbone dihedral, side chain dihedral and bond-changing
+// moves to a chain, accepting or rejecting each at random, and compares the
+// energy of a term that reuses energies from earlier moves with the energy of
+// a freshly constructed term after every move.
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <cstdlib>
+#include <cmath>
+
+#include "protein/chain_fb.h"
+#include "protein/definitions.h"
+
+#include "energy/term_bonded_cached.h"
+#include "energy/term_torsion.h"
+
+//! Number of moves applied to the chain in each test
+const int N_MOVES = 200;
+
+//! Largest accepted difference to the energy of a fresh term (kcal/mol)
+const double TOLERANCE = 1e-6;
+
+//! Uniform random number in [-1,1]
+double random_uniform() {
+     return 2.0 * std::rand() / RAND_MAX - 1.0;
+}
+
+//! Rotate an atom around an axis
+//! \param atom Atom
+//! \param origin Point on the axis
+//! \param axis Direction of the axis
+//! \param angle Rotation angle in radians
+void rotate_atom(phaistos::Atom *atom, const phaistos::Vector_3D &origin, const phaistos::Vector_3D &axis, const double angle) {
+
+     using namespace phaistos;
+
+     const Vector_3D k = axis * (1.0 / axis.norm());
+     const Vector_3D v = atom->position - origin;
+
+     // Rodrigues' rotation formula
+     atom->position = origin + v * std::cos(angle) + (k % v) * std::sin(angle) + k * ((k * v) * (1.0 - std::cos(angle)));
+}
+
+//! Atom positions of a chain
+//! \param chain Molecule chain
+std::vector<phaistos::Vector_3D> get_positions(phaistos::ChainFB *chain) {
+
+     using namespace phaistos;
+
+     std::vector<Vector_3D> positions;
+     for (AtomIterator<ChainFB, definitions::ALL> it(*chain); !it.end(); ++it) {
+          positions.push_back(it->position);
+     }
+     return positions;
+}
+
+//! Restore the atom positions of a chain
+//! \param chain Molecule chain
+//! \param positions Positions from get_positions()
+void set_positions(phaistos::ChainFB *chain, const std::vector<phaistos::Vector_3D> &positions) {
+
+     using namespace phaistos;
+
+     unsigned int i = 0;
+     for (AtomIterator<ChainFB, definitions::ALL> it(*chain); !it.end(); ++it) {
+          it->position = positions[i++];
+     }
+}
+
+//! Rotate the phi dihedral of a residue, moving the rest of the chain towards the C-terminus
+//! \param chain Molecule chain
+//! \param index Index of residue (not the first)
+//! \param move_info Information about the move (output)
+void move_backbone_dihedral(phaistos::ChainFB *chain, const int index, phaistos::MoveInfo &move_info) {
+
+     using namespace phaistos;
+     using namespace definitions;
+
+     Residue &residue = (*chain)[index];
+     const Vector_3D origin = residue[N]->position;
+     const Vector_3D axis = residue[CA]->position - origin;
+     const double angle = random_uniform();
+
+     for (unsigned int i = 0; i < residue.atoms.size(); i++) {
+          const AtomEnum atom_type = residue.atoms[i]->atom_type;
+          if (atom_type != N && atom_type != H && atom_type != H1 && atom_type != H2 && atom_type != H3 && atom_type != CA)
+               rotate_atom(residue.atoms[i], origin, axis, angle);
+     }
+     for (int r = index + 1; r < chain->size(); r++) {
+          for (unsigned int i = 0; i < (*chain)[r].atoms.size(); i++) {
+               rotate_atom((*chain)[r].atoms[i], origin, axis, angle);
+          }
+     }
+
+     move_info.move_type = NON_LOCAL;
+     move_info.modified_angles.push_back(std::make_pair(index, index));
+     move_info.modified_positions_start = index;
+     move_info.modified_positions_end = chain->size() - 1;
+}
+
+//! Rotate the side chain of a residue around the CA-CB bond
+//! \param chain Molecule chain
+//! \param index Index of residue (with a CB atom)
+//! \param move_info Information about the move (output)
+void move_sidechain_dihedral(phaistos::ChainFB *chain, const int index, phaistos::MoveInfo &move_info) {
+
+     using namespace phaistos;
+     using namespace definitions;
+
+     Residue &residue = (*chain)[index];
+     const Vector_3D origin = residue[CA]->position;
+     const Vector_3D axis = residue[CB]->position - origin;
+     const double angle = 3.0 * random_uniform();
+
+     for (unsigned int i = 0; i < residue.atoms.size(); i++) {
+          if (!TermCharmmBondedCached::is_backbone_atom(residue.atoms[i]))
+               rotate_atom(residue.atoms[i], origin, axis, angle);
+     }
+
+     move_info.move_type = SIDECHAIN;
+     move_info.modified_angles.push_back(std::make_pair(index, index));
+     move_info.modified_positions_start = index;
+     move_info.modified_positions_end = index;
+}
+
+//! Displace all atoms of a residue, which changes bond lengths and angles
+//! \param chain Molecule chain
+//! \param index Index of residue
+//! \param move_info Information about the move (output)
+void move_bond_geometry(phaistos::ChainFB *chain, const int index, phaistos::MoveInfo &move_info) {
+
+     using namespace phaistos;
+     using namespace definitions;
+
+     Residue &residue = (*chain)[index];
+     for (unsigned int i = 0; i < residue.atoms.size(); i++) {
+          residue.atoms[i]->position = residue.atoms[i]->position
+                                     + Vector_3D(random_uniform(), random_uniform(), random_uniform()) * 0.05;
+     }
+
+     move_info.move_type = LOCAL;
+     move_info.modified_angles.push_back(std::make_pair(index, index));
+     move_info.modified_positions_start = index;
+     move_info.modified_positions_end = index;
+}
+
+//! Apply a random move of one of the three kinds above
+//! \param chain Molecule chain
+//! \param move_info Information about the move (output)
+void apply_random_move(phaistos::ChainFB *chain, phaistos::MoveInfo &move_info) {
+
+     using namespace definitions;
+
+     const int index = 1 + std::rand() % (chain->size() - 1);
+
+     int move = std::rand() % 3;
+
+     // Residues without CB (glycine) have no side chain dihedral
+     if (move == 1 && !(*chain)[index].has_atom(CB))
+          move = 0;
+
+     if (move == 0) {
+          move_backbone_dihedral(chain, index, move_info);
+     } else if (move == 1) {
+          move_sidechain_dihedral(chain, index, move_info);
+     } else {
+          move_bond_geometry(chain, index, move_info);
+     }
+}
+
+//! Compare the energy of a term with that of a fresh term
+//! \param name Name of the test
+//! \param energy Energy of the term
+//! \param reference Fresh term
+//! \returns 1 if the energies differ, otherwise 0
+template <typename TERM>
+unsigned int compare_energy(const std::string &name, const double energy, TERM &reference) {
+
+     const double expected = reference.evaluate();
+
+     if (std::fabs(energy - expected) > TOLERANCE * std::max(1.0, std::fabs(expected))) {
+          std::cout << name << ": energy " << energy << ", fresh term " << expected << "\n";
+          return 1;
+     }
+     return 0;
+}
+
+//! Apply N_MOVES random moves, accepted or rejected at random, and compare the
+//! energy of a term after each evaluation and after each accept or reject
+//! (evaluated as a none-move) with that of a fresh term
+//! \param chain Molecule chain
+//! \param name Name of the test
+//! \param settings Settings of the tested term
+//! \param reference_settings Settings of the fresh terms
+//! \returns Number of mismatches
+template <typename TERM>
+unsigned int test_moves(phaistos::ChainFB *chain, const std::string &name,
+                        const typename TERM::Settings &settings,
+                        const typename TERM::Settings &reference_settings) {
+
+     using namespace phaistos;
+
+     const std::vector<Vector_3D> initial_positions = get_positions(chain);
+
+     TERM term(chain, settings);
+
+     unsigned int n_accepted = 0;
+     unsigned int n_mismatches = 0;
+
+     for (int i = 0; i < N_MOVES; i++) {
+
+          const std::vector<Vector_3D> positions = get_positions(chain);
+
+          MoveInfo move_info;
+          apply_random_move(chain, move_info);
+
+          const double energy = term.evaluate(&move_info);
+          {
+               TERM reference(chain, reference_settings);
+               n_mismatches += compare_energy(name + " (move)", energy, reference);
+          }
+
+          if (std::rand() % 2) {
+               term.accept();
+               n_accepted++;
+          } else {
+               set_positions(chain, positions);
+               term.reject();
+          }
+
+          MoveInfo none_move;
+          const double energy_after = term.evaluate(&none_move);
+          term.accept();
+          {
+               TERM reference(chain, reference_settings);
+               n_mismatches += compare_energy(name + " (after accept/reject)", energy_after, reference);
+          }
+     }
+
+     set_positions(chain, initial_positions);
+
+     std::cout << name << ": " << N_MOVES << " moves, " << n_accepted << " accepted, "
+               << n_mismatches << " mismatches\n";
+     return n_mismatches;
+}
+
+
+int main(int argc, char *argv[]) {
+
+     using namespace phaistos;
+     using namespace definitions;
+
+     if (argc < 2) {
+          std::cout << "USAGE: ./test_cached_moves <pdb-file>" << std::endl;
+          exit(1);
+     }
+
+     // Create chain from PDB filename
+     std::string pdb_filename = argv[1];
+     ChainFB chain(pdb_filename, ALL_ATOMS);
+
+     std::srand(1);
+
+     unsigned int n_mismatches = 0;
+
+     TermCharmmBondedCached::Settings settings_bonded_cached;
+     TermCharmmBondedCached::Settings reference_settings_bonded_cached;
+     settings_bonded_cached.skip_invariant_terms = true;
+     reference_settings_bonded_cached.skip_invariant_terms = false;
+     n_mismatches += test_moves<TermCharmmBondedCached>(&chain, "charmm-bonded-cached",
+                                                        settings_bonded_cached,
+                                                        reference_settings_bonded_cached);
+
+     TermCharmmTorsion::Settings settings_torsion;
+     TermCharmmTorsion::Settings reference_settings_torsion;
+     settings_torsion.read_degrees_of_freedom = true;
+     reference_settings_torsion.read_degrees_of_freedom = false;
+     n_mismatches += test_moves<TermCharmmTorsion>(&chain, "charmm-torsion",
+                                                   settings_torsion,
+                                                   reference_settings_torsion);
+
+     return (n_mismatches == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -40,9 +40,6 @@
 #include "energy/term_angle_bend.h"
 #include "energy/term_torsion.h"
 #include "energy/term_improper_torsion.h"
-#include "energy/term_vdw.h"
-#include "energy/term_coulomb.h"
-#include "energy/term_implicit_solvent.h"
 #include "energy/term_cmap.h"
 
 //! Method to evaluate a PDB file using energy terms
@@ -60,32 +57,26 @@ void test_terms(phaistos::ChainFB *chain, int debug_level) {
      TermCharmmBondStretch::Settings settings_bond_stretch;
      TermCharmmAngleBend::Settings settings_angle_bend;
      TermCharmmTorsion::Settings settings_torsion;
-     TermCharmmVdw::Settings settings_vdw;
      TermCharmmImproperTorsion::Settings settings_improper_torsion;
-     TermCharmmCoulomb::Settings settings_coulomb;
-     TermCharmmImplicitSolvent::Settings settings_implicit_solvent;
+     TermCharmmNonBonded::Settings settings_non_bonded;
      TermCharmmCmap::Settings settings_cmap;
 
      // Set debug-level (which controls output)
      settings_bond_stretch.debug = debug_level;
      settings_angle_bend.debug = debug_level;
      settings_torsion.debug = debug_level;
-     settings_vdw.debug = debug_level;
      settings_improper_torsion.debug = debug_level;
-     settings_coulomb.debug = debug_level;
-     settings_implicit_solvent.debug = debug_level;
+     settings_non_bonded.debug = debug_level;
      settings_cmap.debug = debug_level;
 
      // Add terms to energy object
      energy.add_term(new TermCharmmBondStretch(chain, settings_bond_stretch));
      energy.add_term(new TermCharmmAngleBend(chain, settings_angle_bend));
      energy.add_term(new TermCharmmTorsion(chain, settings_torsion));
-     energy.add_term(new TermCharmmVdw(chain, settings_vdw));
      energy.add_term(new TermCharmmImproperTorsion(chain, settings_improper_torsion));
-     energy.add_term(new TermCharmmCoulomb(chain, settings_coulomb));
-     energy.add_term(new TermCharmmImplicitSolvent(chain, settings_implicit_solvent));
      energy.add_term(new TermCharmmCmap(chain, settings_cmap));
-     energy.add_term(new TermCharmmNonBonded(chain));
+     // vdW-14, vdW-SR, Coul-14, Coul-SR and EEF1 are reported by the non-bonded term in a single pass
+     energy.add_term(new TermCharmmNonBonded(chain, settings_non_bonded));
      energy.add_term(new TermCharmmBondedCached(chain));
      energy.add_term(new TermCharmmNonBondedCached(chain));
 
@@ -0,0 +1,303 @@
+// test_topology.cpp --- Test of the CHARMM36/EEF1-SB topology generation
+// Copyright (C) 2026 agent
+//
+// This file is part of PHAISTOS
+//
+// PHAISTOS is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// PHAISTOS is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with PHAISTOS.  If not, see <http://www.gnu.org/licenses/>.
+
+// Compares the covalent bond graph with chain_distance(), and the hash index
+// lookups of torsion and improper torsion parameters with linear scans of the
+// parameter tables in file order (as the topology parser used to do).
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <cstdlib>
+#include <functional>
+
+#include "protein/chain_fb.h"
+#include "protein/definitions.h"
+
+#include "energy/parsers/topology_parser.h"
+
+//! Number of bonds between two atoms as used for exclusions
+//! \param d Number of bonds (or any value outside 0..BOND_GRAPH_DEPTH if further apart)
+//! \returns d, or BOND_GRAPH_DEPTH+1 if the atoms are further apart
+unsigned int clip_distance(const int d) {
+
+     if (d < 0 || d > (int)topology::BOND_GRAPH_DEPTH)
+          return topology::BOND_GRAPH_DEPTH + 1;
+     return d;
+}
+
+//! Compare the number of bonds between all atoms in the same or in neighbouring
+//! residues in the bond graph with chain_distance()
+//! \param chain Molecule chain
+//! \returns Number of mismatches
+unsigned int test_bond_graph(phaistos::ChainFB *chain) {
+
+     using namespace phaistos;
+
+     const topology::BondGraph bond_graph(chain);
+
+     unsigned int n_pairs = 0;
+     unsigned int n_mismatches = 0;
+
+     for (unsigned int i = 0; i < bond_graph.atoms.size(); i++) {
+          for (unsigned int j = i + 1; j < bond_graph.atoms.size(); j++) {
+
+               Atom *atom1 = bond_graph.atoms[i];
+               Atom *atom2 = bond_graph.atoms[j];
+
+               if (std::abs(atom1->residue->index - atom2->residue->index) > 1)
+                    continue;
+
+               const unsigned int expected = clip_distance(chain_distance<ChainFB>(atom1, atom2));
+               const unsigned int d1 = bond_graph.get_distance(i, j);
+               const unsigned int d2 = bond_graph.get_distance(j, i);
+
+               n_pairs++;
+               if (d1 != expected || d2 != expected) {
+                    n_mismatches++;
+                    std::cout << "Bond graph: " << atom1 << " " << atom2
+                              << " distance " << d1 << " " << d2 << ", chain_distance " << expected << "\n";
+               }
+          }
+     }
+
+     std::cout << "Bond graph: " << n_pairs << " atom pairs, " << n_mismatches << " mismatches\n";
+     return n_mismatches;
+}
+
+
+//! Torsion interactions of a list of atom quadruplets, with parameters found by
+//! the linear scan of the parameter table: all specific parameters (in either
+//! direction) in file order, or otherwise the first X-A-B-X wildcard parameter.
+//! \param quadruplets Atom quadruplets
+//! \param torsion_parameters Torsion parameters
+//! \returns Torsion interactions
+std::vector<topology::TorsionInteraction> scan_torsion_parameters(const std::vector<std::vector<phaistos::Atom *> > &quadruplets,
+                                                                  const std::vector<topology::TorsionParameter> &torsion_parameters) {
+
+     using namespace topology;
+     using charmm_parameters::ATOM_TYPE_X;
+
+     std::vector<TorsionInteraction> torsion_interactions;
+
+     for (unsigned int q = 0; q < quadruplets.size(); q++) {
+
+          phaistos::Atom *const *atoms = &quadruplets[q][0];
+          unsigned int ids[4];
+          for (unsigned int k = 0; k < 4; k++) {
+               ids[k] = eef1_sb_parser::get_atom_type_id(atoms[k]);
+          }
+
+          bool found_parameter = false;
+
+          for (unsigned int i = 0; i < torsion_parameters.size(); i++) {
+
+               const TorsionParameter &p = torsion_parameters[i];
+
+               if (p.type1 == ids[0] && p.type2 == ids[1] && p.type3 == ids[2] && p.type4 == ids[3]) {
+                    torsion_interactions.push_back(make_torsion_interaction(atoms[0], atoms[1], atoms[2], atoms[3], p));
+                    found_parameter = true;
+               } else if (p.type1 == ids[3] && p.type2 == ids[2] && p.type3 == ids[1] && p.type4 == ids[0]) {
+                    torsion_interactions.push_back(make_torsion_interaction(atoms[3], atoms[2], atoms[1], atoms[0], p));
+                    found_parameter = true;
+               }
+          }
+
+          for (unsigned int i = 0; i < torsion_parameters.size() && !found_parameter; i++) {
+
+               const TorsionParameter &p = torsion_parameters[i];
+
+               if (p.type1 == ATOM_TYPE_X && p.type2 == ids[1] && p.type3 == ids[2] && p.type4 == ATOM_TYPE_X) {
+                    torsion_interactions.push_back(make_torsion_interaction(atoms[0], atoms[1], atoms[2], atoms[3], p));
+                    found_parameter = true;
+               } else if (p.type1 == ATOM_TYPE_X && p.type2 == ids[2] && p.type3 == ids[1] && p.type4 == ATOM_TYPE_X) {
+                    torsion_interactions.push_back(make_torsion_interaction(atoms[3], atoms[2], atoms[1], atoms[0], p));
+                    found_parameter = true;
+               }
+          }
+     }
+
+     return torsion_interactions;
+}
+
+//! Atom quadruplet, in the same order for both directions
+std::vector<phaistos::Atom *> get_quadruplet(phaistos::Atom *atom1, phaistos::Atom *atom2,
+                                             phaistos::Atom *atom3, phaistos::Atom *atom4) {
+
+     std::vector<phaistos::Atom *> quadruplet(4);
+     quadruplet[0] = atom1;
+     quadruplet[1] = atom2;
+     quadruplet[2] = atom3;
+     quadruplet[3] = atom4;
+     if (std::less<phaistos::Atom *>()(atom4, atom1))
+          std::reverse(quadruplet.begin(), quadruplet.end());
+     return quadruplet;
+}
+
+//! Atom quadruplet of an interaction, in the same order for both directions
+template <typename INTERACTION>
+std::vector<phaistos::Atom *> get_quadruplet(const INTERACTION &interaction) {
+     return get_quadruplet(interaction.atom1, interaction.atom2, interaction.atom3, interaction.atom4);
+}
+
+//! Order of torsion interactions by atom quadruplet only (so that a stable sort
+//! keeps the order of the parameters of each quadruplet)
+bool quadruplet_less(const topology::TorsionInteraction &interaction1, const topology::TorsionInteraction &interaction2) {
+     return get_quadruplet(interaction1) < get_quadruplet(interaction2);
+}
+
+//! Compare the torsion interactions of a chain with those found by linear scans
+//! of the parameter table, including the order of the parameters of each quadruplet
+//! \param chain Molecule chain
+//! \returns Number of mismatches
+unsigned int test_torsion_lookup(phaistos::ChainFB *chain) {
+
+     using namespace topology;
+
+     const std::vector<TorsionParameter> torsion_parameters = get_torsion_parameters();
+
+     std::vector<TorsionInteraction> torsion_interactions = generate_torsion_interactions(chain, torsion_parameters);
+
+     // Enumerate all bonded atom quadruplets with the covalent bond iterator
+     std::vector<std::vector<phaistos::Atom *> > quadruplets;
+     for (phaistos::AtomIterator<phaistos::ChainFB, definitions::ALL> it2(*chain); !it2.end(); ++it2) {
+          phaistos::Atom *atom2 = &*it2;
+          for (phaistos::CovalentBondIterator<phaistos::ChainFB> it1(atom2, phaistos::CovalentBondIterator<phaistos::ChainFB>::DEPTH_1_ONLY);
+               !it1.end(); ++it1) {
+               for (phaistos::CovalentBondIterator<phaistos::ChainFB> it3(atom2, phaistos::CovalentBondIterator<phaistos::ChainFB>::DEPTH_1_ONLY);
+                    !it3.end(); ++it3) {
+                    phaistos::Atom *atom3 = &*it3;
+                    for (phaistos::CovalentBondIterator<phaistos::ChainFB> it4(atom3, phaistos::CovalentBondIterator<phaistos::ChainFB>::DEPTH_1_ONLY);
+                         !it4.end(); ++it4) {
+
+                         if (&*it1 == atom3 || &*it4 == atom2)
+                              continue;
+
+                         quadruplets.push_back(get_quadruplet(&*it1, atom2, atom3, &*it4));
+                    }
+               }
+          }
+     }
+     std::sort(quadruplets.begin(), quadruplets.end());
+     quadruplets.erase(std::unique(quadruplets.begin(), quadruplets.end()), quadruplets.end());
+
+     std::vector<TorsionInteraction> expected_interactions = scan_torsion_parameters(quadruplets, torsion_parameters);
+
+     std::stable_sort(torsion_interactions.begin(), torsion_interactions.end(), quadruplet_less);
+     std::stable_sort(expected_interactions.begin(), expected_interactions.end(), quadruplet_less);
+
+     unsigned int n_mismatches = 0;
+
+     if (torsion_interactions.size() != expected_interactions.size()) {
+          std::cout << "Torsions: " << torsion_interactions.size() << " interactions, "
+                    << expected_interactions.size() << " expected\n";
+          return 1;
+     }
+
+     for (unsigned int i = 0; i < torsion_interactions.size(); i++) {
+
+          const TorsionInteraction &t = torsion_interactions[i];
+          const TorsionInteraction &e = expected_interactions[i];
+
+          if (t.atom1 != e.atom1 || t.atom2 != e.atom2 || t.atom3 != e.atom3 || t.atom4 != e.atom4 ||
+              t.phi0 != e.phi0 || t.cp != e.cp || t.mult != e.mult) {
+               n_mismatches++;
+               std::cout << "Torsions: " << t.atom1 << " " << t.atom2 << " " << t.atom3 << " " << t.atom4
+                         << " phi0 " << t.phi0 << " cp " << t.cp << " mult " << t.mult
+                         << ", expected phi0 " << e.phi0 << " cp " << e.cp << " mult " << e.mult << "\n";
+          }
+     }
+
+     std::cout << "Torsions: " << torsion_interactions.size() << " interactions, " << n_mismatches << " mismatches\n";
+     return n_mismatches;
+}
+
+
+//! Compare the improper torsion parameters of a chain with those found by a linear
+//! scan of the parameter table: the last parameter that matches in either direction,
+//! with specific or A-X-X-B wildcard atom types
+//! \param chain Molecule chain
+//! \returns Number of mismatches
+unsigned int test_improper_torsion_lookup(phaistos::ChainFB *chain) {
+
+     using namespace topology;
+     using charmm_parameters::ATOM_TYPE_X;
+
+     const std::vector<ImproperTorsionParameter> improper_torsion_parameters = get_improper_torsion_parameters();
+
+     const std::vector<ImproperTorsionInteraction> improper_torsions
+          = generate_improper_torsion_interactions(chain, improper_torsion_parameters);
+
+     unsigned int n_mismatches = 0;
+
+     for (unsigned int i = 0; i < improper_torsions.size(); i++) {
+
+          const ImproperTorsionInteraction &t = improper_torsions[i];
+
+          const unsigned int ids[4] = {eef1_sb_parser::get_atom_type_id(t.atom1), eef1_sb_parser::get_atom_type_id(t.atom2),
+                                       eef1_sb_parser::get_atom_type_id(t.atom3), eef1_sb_parser::get_atom_type_id(t.atom4)};
+
+          int expected = -1;
+          for (unsigned int k = 0; k < improper_torsion_parameters.size(); k++) {
+
+               const ImproperTorsionParameter &p = improper_torsion_parameters[k];
+
+               if ((p.type1 == ids[0] && p.type2 == ids[1] && p.type3 == ids[2] && p.type4 == ids[3]) ||
+                   (p.type1 == ids[3] && p.type2 == ids[2] && p.type3 == ids[1] && p.type4 == ids[0]) ||
+                   (p.type1 == ids[0] && p.type2 == ATOM_TYPE_X && p.type3 == ATOM_TYPE_X && p.type4 == ids[3]) ||
+                   (p.type1 == ids[3] && p.type2 == ATOM_TYPE_X && p.type3 == ATOM_TYPE_X && p.type4 == ids[0])) {
+                    expected = k;
+               }
+          }
+
+          if (expected < 0 ||
+              t.phi0 != improper_torsion_parameters[expected].phi0 ||
+              t.cp != improper_torsion_parameters[expected].cp) {
+               n_mismatches++;
+               std::cout << "Improper torsions: " << t.atom1 << " " << t.atom2 << " " << t.atom3 << " " << t.atom4
+                         << " phi0 " << t.phi0 << " cp " << t.cp << ", expected parameter " << expected << "\n";
+          }
+     }
+
+     std::cout << "Improper torsions: " << improper_torsions.size() << " interactions, " << n_mismatches << " mismatches\n";
+     return n_mismatches;
+}
+
+
+int main(int argc, char *argv[]) {
+
+     using namespace phaistos;
+     using namespace definitions;
+
+     if (argc < 2) {
+          std::cout << "USAGE: ./test_topology <pdb-file>" << std::endl;
+          exit(1);
+     }
+
+     // Create chain from PDB filename
+     std::string pdb_filename = argv[1];
+     ChainFB chain(pdb_filename, ALL_ATOMS);
+
+     unsigned int n_mismatches = 0;
+     n_mismatches += test_bond_graph(&chain);
+     n_mismatches += test_torsion_lookup(&chain);
+     n_mismatches += test_improper_torsion_lookup(&chain);
+
+     return (n_mismatches == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}